@@ -4,6 +4,10 @@
 @date   2026/01/16
 @author 陈家耀
 @eidt   2026.01.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 增加完成中断(使能/除能中断, 设置完成阈值, 等待完成)
+        2026.10.16 1.02 增加影子配置寄存器(配置下一次处理, 提交配置并启动)
+        2026.10.16 1.03 运行周期数计数器扩展为64位, 通过快照读取
+        2026.10.16 1.04 通过可替换的寄存器访问后端读写寄存器区, DMA地址经总线地址转换
 ************************************************************************************************************************/
 
 #include "axi_element_wise_proc.h"
@@ -15,6 +19,7 @@
 
 // 各寄存器域的偏移地址
 #define REG_REGION_PROP_OFS 0x0000
+#define REG_REGION_PM_SNAP_OFS 0x0038
 #define REG_REGION_CTRL_OFS 0x0040
 #define REG_REGION_STS_OFS 0x0060
 #define REG_REGION_BUF_CFG_OFS 0x0080
@@ -22,36 +27,105 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static int axi_element_wise_proc_wr_buf_cfg_regs(AxiElmWiseProcHandler* handler, const AxiElmWiseProcBufCfg* buf_cfg, uint8_t use_op_a_or_b); // 写缓存区配置寄存器
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@private
+@brief  读寄存器
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+        reg 寄存器地址(由寄存器域指针得到)
+@return 读到的值
+*************************/
+static inline uint32_t axi_element_wise_proc_rd_reg(const AxiElmWiseProcHandler* handler, const volatile uint32_t* reg){
+#ifdef AXI_ELM_WISE_PROC_MMIO_CB
+	return handler->mmio.rd(handler->mmio.mmio_arg, (uintptr_t)reg);
+#else
+	(void)handler;
+
+	return *reg;
+#endif
+}
+
+/*************************
+@private
+@brief  写寄存器
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+        reg 寄存器地址(由寄存器域指针得到)
+        data 待写的值
+@return none
+*************************/
+static inline void axi_element_wise_proc_wr_reg(const AxiElmWiseProcHandler* handler, volatile uint32_t* reg, uint32_t data){
+#ifdef AXI_ELM_WISE_PROC_MMIO_CB
+	handler->mmio.wr(handler->mmio.mmio_arg, (uintptr_t)reg, data);
+#else
+	(void)handler;
+
+	*reg = data;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /*************************
 @init
 @public
-@brief  初始化通用逐元素操作处理单元
+@brief  初始化通用逐元素操作处理单元(以指针直接访问寄存器区)
 @param  handler 通用逐元素操作处理单元(加速器句柄)
         baseaddr 加速器基地址
 @return 是否成功
 *************************/
 int axi_element_wise_proc_init(AxiElmWiseProcHandler* handler, uint32_t baseaddr){
-	uint32_t* test_ptr = (uint32_t*)baseaddr;
+	AxiElmWiseProcMmio mmio;
+
+	memset((void*)&mmio, 0, sizeof(mmio));
+
+	mmio.reg_base = (uintptr_t)baseaddr;
+
+	return axi_element_wise_proc_init_mmio(handler, &mmio);
+}
+
+/*************************
+@init
+@public
+@brief  初始化通用逐元素操作处理单元(指定寄存器访问后端)
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+        mmio 寄存器访问后端
+@return 是否成功
+*************************/
+int axi_element_wise_proc_init_mmio(AxiElmWiseProcHandler* handler, const AxiElmWiseProcMmio* mmio){
+#ifdef AXI_ELM_WISE_PROC_MMIO_CB
+	if(mmio->rd == NULL || mmio->wr == NULL){
+		return -1;
+	}
+#endif
 
-	if((test_ptr[1] & 0x3FFFFFFF) != ELM_WISE_PROC_ACC_TYPE){
+	handler->mmio = *mmio;
+
+	handler->reg_region_prop = (AxiElmWiseProcRegRgnProp*)(mmio->reg_base + REG_REGION_PROP_OFS);
+	handler->reg_region_pm_snap = (AxiElmWiseProcRegRgnPmSnap*)(mmio->reg_base + REG_REGION_PM_SNAP_OFS);
+	handler->reg_region_ctrl = (AxiElmWiseProcRegRgnCtrl*)(mmio->reg_base + REG_REGION_CTRL_OFS);
+	handler->reg_region_sts = (AxiElmWiseProcRegRgnSts*)(mmio->reg_base + REG_REGION_STS_OFS);
+	handler->reg_region_buf_cfg = (AxiElmWiseProcRegRgnBufCfg*)(mmio->reg_base + REG_REGION_BUF_CFG_OFS);
+	handler->reg_region_fu_cfg = (AxiElmWiseProcRegRgnFuCfg*)(mmio->reg_base + REG_REGION_FU_CFG_OFS);
+
+	if((axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->acc_name) & 0x3FFFFFFF) != ELM_WISE_PROC_ACC_TYPE){
 		return -1;
 	}
 
-	handler->reg_base_ptr = (uint32_t*)baseaddr;
-	handler->reg_region_prop = (AxiElmWiseProcRegRgnProp*)(baseaddr + REG_REGION_PROP_OFS);
-	handler->reg_region_ctrl = (AxiElmWiseProcRegRgnCtrl*)(baseaddr + REG_REGION_CTRL_OFS);
-	handler->reg_region_sts = (AxiElmWiseProcRegRgnSts*)(baseaddr + REG_REGION_STS_OFS);
-	handler->reg_region_buf_cfg = (AxiElmWiseProcRegRgnBufCfg*)(baseaddr + REG_REGION_BUF_CFG_OFS);
-	handler->reg_region_fu_cfg = (AxiElmWiseProcRegRgnFuCfg*)(baseaddr + REG_REGION_FU_CFG_OFS);
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl4, 0x00000000);
+	handler->next_cfg_valid = 0;
+	handler->next_use_op_a_or_b = 0;
 
-	uint32_t version_encoded = handler->reg_region_prop->version;
+	uint32_t version_encoded = axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->version);
 	handler->property.version[8] = '\0';
 	for(int i = 0;i < 8;i++){
 		handler->property.version[i] = '0' + (version_encoded & 0x0000000F);
 		version_encoded >>= 4;
 	}
 
-	uint32_t accelerator_type_encoded = handler->reg_region_prop->acc_name;
+	uint32_t accelerator_type_encoded = axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->acc_name);
 	handler->property.accelerator_type[6] = '\0';
 	for(int i = 0;i < 6;i++){
 		uint8_t now_c = (uint8_t)(accelerator_type_encoded & 0x0000001F);
@@ -62,39 +136,62 @@ int axi_element_wise_proc_init(AxiElmWiseProcHandler* handler, uint32_t baseaddr
 
 	handler->property.accelerator_id = (uint8_t)(accelerator_type_encoded >> 30);
 
-	handler->property.mm2s_stream_data_width = (uint16_t)(handler->reg_region_prop->info0 & 0x0000FFFF);
-	handler->property.s2mm_stream_data_width = (uint16_t)((handler->reg_region_prop->info0 >> 16) & 0x0000FFFF);
-	handler->property.element_wise_proc_pipeline_n = (uint8_t)(handler->reg_region_prop->info1 & 0x000000FF);
-
-	handler->property.in_stream_width_1B_supported = (handler->reg_region_prop->info1 & (1 << 8)) ? 0x01:0x00;
-	handler->property.in_stream_width_2B_supported = (handler->reg_region_prop->info1 & (1 << 9)) ? 0x01:0x00;
-	handler->property.in_stream_width_4B_supported = (handler->reg_region_prop->info1 & (1 << 10)) ? 0x01:0x00;
-	handler->property.out_stream_width_1B_supported = (handler->reg_region_prop->info1 & (1 << 11)) ? 0x01:0x00;
-	handler->property.out_stream_width_2B_supported = (handler->reg_region_prop->info1 & (1 << 12)) ? 0x01:0x00;
-	handler->property.out_stream_width_4B_supported = (handler->reg_region_prop->info1 & (1 << 13)) ? 0x01:0x00;
-	handler->property.in_data_cvt_fp16_to_fp32_supported = (handler->reg_region_prop->info1 & (1 << 14)) ? 0x01:0x00;
-	handler->property.in_data_cvt_int_to_fp32_supported = (handler->reg_region_prop->info1 & (1 << 15)) ? 0x01:0x00;
-	handler->property.cal_fmt_s16_supported = (handler->reg_region_prop->info1 & (1 << 16)) ? 0x01:0x00;
-	handler->property.cal_fmt_s32_supported = (handler->reg_region_prop->info1 & (1 << 17)) ? 0x01:0x00;
-	handler->property.cal_fmt_fp32_supported = (handler->reg_region_prop->info1 & (1 << 18)) ? 0x01:0x00;
-	handler->property.out_data_cvt_fp32_to_s33_supported = (handler->reg_region_prop->info1 & (1 << 19)) ? 0x01:0x00;
-	handler->property.round_s33_supported = (handler->reg_region_prop->info1 & (1 << 20)) ? 0x01:0x00;
-	handler->property.round_fp32_supported = (handler->reg_region_prop->info1 & (1 << 21)) ? 0x01:0x00;
-
-	handler->reg_region_fu_cfg->fu_bypass_cfg = 0x00000000;
-	handler->property.exist_in_data_cvt_unit = (handler->reg_region_fu_cfg->fu_bypass_cfg & (1 << 0)) ? 0x00:0x01;
-	handler->property.exist_pow2_cell = (handler->reg_region_fu_cfg->fu_bypass_cfg & (1 << 1)) ? 0x00:0x01;
-	handler->property.exist_mac_cell = (handler->reg_region_fu_cfg->fu_bypass_cfg & (1 << 2)) ? 0x00:0x01;
-	handler->property.exist_out_data_cvt_unit = (handler->reg_region_fu_cfg->fu_bypass_cfg & (1 << 3)) ? 0x00:0x01;
-	handler->property.exist_round_cell = (handler->reg_region_fu_cfg->fu_bypass_cfg & (1 << 4)) ? 0x00:0x01;
-
-	handler->reg_region_ctrl->ctrl0 = (1 << 3);
-	handler->property.performance_monitor_supported = (handler->reg_region_ctrl->ctrl0 & (1 << 3)) ? 0x01:0x00;
-	handler->reg_region_ctrl->ctrl0 = 0x00000000;
+	handler->property.mm2s_stream_data_width = (uint16_t)(axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info0) & 0x0000FFFF);
+	handler->property.s2mm_stream_data_width = (uint16_t)((axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info0) >> 16) & 0x0000FFFF);
+	handler->property.element_wise_proc_pipeline_n = (uint8_t)(axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & 0x000000FF);
+
+	handler->property.in_stream_width_1B_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 8)) ? 0x01:0x00;
+	handler->property.in_stream_width_2B_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 9)) ? 0x01:0x00;
+	handler->property.in_stream_width_4B_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 10)) ? 0x01:0x00;
+	handler->property.out_stream_width_1B_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 11)) ? 0x01:0x00;
+	handler->property.out_stream_width_2B_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 12)) ? 0x01:0x00;
+	handler->property.out_stream_width_4B_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 13)) ? 0x01:0x00;
+	handler->property.in_data_cvt_fp16_to_fp32_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 14)) ? 0x01:0x00;
+	handler->property.in_data_cvt_int_to_fp32_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 15)) ? 0x01:0x00;
+	handler->property.cal_fmt_s16_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 16)) ? 0x01:0x00;
+	handler->property.cal_fmt_s32_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 17)) ? 0x01:0x00;
+	handler->property.cal_fmt_fp32_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 18)) ? 0x01:0x00;
+	handler->property.out_data_cvt_fp32_to_s33_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 19)) ? 0x01:0x00;
+	handler->property.round_s33_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 20)) ? 0x01:0x00;
+	handler->property.round_fp32_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_prop->info1) & (1 << 21)) ? 0x01:0x00;
+
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_fu_cfg->fu_bypass_cfg, 0x00000000);
+	handler->property.exist_in_data_cvt_unit = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_fu_cfg->fu_bypass_cfg) & (1 << 0)) ? 0x00:0x01;
+	handler->property.exist_pow2_cell = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_fu_cfg->fu_bypass_cfg) & (1 << 1)) ? 0x00:0x01;
+	handler->property.exist_mac_cell = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_fu_cfg->fu_bypass_cfg) & (1 << 2)) ? 0x00:0x01;
+	handler->property.exist_out_data_cvt_unit = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_fu_cfg->fu_bypass_cfg) & (1 << 3)) ? 0x00:0x01;
+	handler->property.exist_round_cell = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_fu_cfg->fu_bypass_cfg) & (1 << 4)) ? 0x00:0x01;
+
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, (1 << 3));
+	handler->property.performance_monitor_supported = (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0) & (1 << 3)) ? 0x01:0x00;
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, 0x00000000);
+
+	handler->done_threshold = 0;
+	handler->wait_hook = NULL;
+	handler->wait_hook_arg = NULL;
+
+	axi_element_wise_proc_disable_irq(handler);
+	axi_element_wise_proc_clr_irq(handler);
 
 	return 0;
 }
 
+/*************************
+@cfg
+@public
+@brief  把主机指针转换为加速器DMA使用的总线地址
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+        ptr 主机指针
+@return 总线地址
+*************************/
+uint32_t axi_element_wise_proc_bus_addr(AxiElmWiseProcHandler* handler, const void* ptr){
+	if(handler->mmio.bus_addr == NULL){
+		return (uint32_t)((uintptr_t)ptr);
+	}else{
+		return handler->mmio.bus_addr(handler->mmio.bus_addr_arg, ptr);
+	}
+}
+
 /*************************
 @ctrl
 @public
@@ -103,9 +200,9 @@ int axi_element_wise_proc_init(AxiElmWiseProcHandler* handler, uint32_t baseaddr
 @return 是否成功
 *************************/
 int axi_element_wise_proc_enable(AxiElmWiseProcHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | (1 << 0);
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | (1 << 0));
 
 	return 0;
 }
@@ -118,9 +215,9 @@ int axi_element_wise_proc_enable(AxiElmWiseProcHandler* handler){
 @return none
 *************************/
 void axi_element_wise_proc_disable(AxiElmWiseProcHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~(1 << 0));
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~(1 << 0)));
 }
 
 /*************************
@@ -131,9 +228,9 @@ void axi_element_wise_proc_disable(AxiElmWiseProcHandler* handler){
 @return 是否成功
 *************************/
 int axi_element_wise_proc_enable_data_hub_and_proc_core(AxiElmWiseProcHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | (1 << 1) | (1 << 2);
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | (1 << 1) | (1 << 2));
 
 	return 0;
 }
@@ -146,9 +243,9 @@ int axi_element_wise_proc_enable_data_hub_and_proc_core(AxiElmWiseProcHandler* h
 @return none
 *************************/
 void axi_element_wise_proc_disable_data_hub_and_proc_core(AxiElmWiseProcHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~((1 << 1) | (1 << 2)));
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~((1 << 1) | (1 << 2))));
 }
 
 /*************************
@@ -165,8 +262,8 @@ int axi_element_wise_proc_enable_cycle_n_cnt(AxiElmWiseProcHandler* handler){
 		return -1;
 	}
 
-	pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | (1 << 3);
+	pre_ctrl0 = axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | (1 << 3));
 
 	return 0;
 }
@@ -179,9 +276,9 @@ int axi_element_wise_proc_enable_cycle_n_cnt(AxiElmWiseProcHandler* handler){
 @return none
 *************************/
 void axi_element_wise_proc_disable_cycle_n_cnt(AxiElmWiseProcHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~(1 << 3));
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~(1 << 3)));
 }
 
 /*************************
@@ -194,37 +291,54 @@ void axi_element_wise_proc_disable_cycle_n_cnt(AxiElmWiseProcHandler* handler){
 @return 是否成功
 *************************/
 int axi_element_wise_proc_start(AxiElmWiseProcHandler* handler, const AxiElmWiseProcBufCfg* buf_cfg, uint8_t use_op_a_or_b){
-	if(handler->reg_region_ctrl->ctrl1 & 0x00000007){
+	if(axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl1) & 0x00000007){
 		return -1;
 	}
 
-	if((handler->reg_region_ctrl->ctrl0 & 0x00000007) != 0x00000007){
+	if((axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0) & 0x00000007) != 0x00000007){
 		return -2;
 	}
 
+	if(axi_element_wise_proc_wr_buf_cfg_regs(handler, buf_cfg, use_op_a_or_b)){
+		return -3;
+	}
+
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl1,
+		(1 << 0) |
+		(use_op_a_or_b ? (1 << 1):0) |
+		(1 << 2));
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  检查并写缓存区配置寄存器
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+        buf_cfg 缓存区基地址和大小配置(指针)
+        use_op_a_or_b 是否使用非常量的操作数A或B
+@return 是否成功
+*************************/
+static int axi_element_wise_proc_wr_buf_cfg_regs(AxiElmWiseProcHandler* handler, const AxiElmWiseProcBufCfg* buf_cfg, uint8_t use_op_a_or_b){
 	if(
 		(buf_cfg->op_x_buf_len & 0xFF000000) ||
 		(use_op_a_or_b && (buf_cfg->op_a_b_buf_len & 0xFF000000)) ||
 		(buf_cfg->res_buf_len & 0xFF000000)
 	){
-		return -3;
+		return -1;
 	}
 
-	handler->reg_region_buf_cfg->buf_cfg0 = (uint32_t)buf_cfg->op_x_buf_baseaddr;
-	handler->reg_region_buf_cfg->buf_cfg3 = buf_cfg->op_x_buf_len;
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_buf_cfg->buf_cfg0, axi_element_wise_proc_bus_addr(handler, buf_cfg->op_x_buf_baseaddr));
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_buf_cfg->buf_cfg3, buf_cfg->op_x_buf_len);
 
 	if(use_op_a_or_b){
-		handler->reg_region_buf_cfg->buf_cfg1 = (uint32_t)buf_cfg->op_a_b_buf_baseaddr;
-		handler->reg_region_buf_cfg->buf_cfg4 = buf_cfg->op_a_b_buf_len;
+		axi_element_wise_proc_wr_reg(handler, &handler->reg_region_buf_cfg->buf_cfg1, axi_element_wise_proc_bus_addr(handler, buf_cfg->op_a_b_buf_baseaddr));
+		axi_element_wise_proc_wr_reg(handler, &handler->reg_region_buf_cfg->buf_cfg4, buf_cfg->op_a_b_buf_len);
 	}
 
-	handler->reg_region_buf_cfg->buf_cfg2 = (uint32_t)buf_cfg->res_buf_baseaddr;
-	handler->reg_region_buf_cfg->buf_cfg5 = buf_cfg->res_buf_len;
-
-	handler->reg_region_ctrl->ctrl1 =
-		(1 << 0) |
-		(use_op_a_or_b ? (1 << 1):0) |
-		(1 << 2);
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_buf_cfg->buf_cfg2, axi_element_wise_proc_bus_addr(handler, buf_cfg->res_buf_baseaddr));
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_buf_cfg->buf_cfg5, buf_cfg->res_buf_len);
 
 	return 0;
 }
@@ -284,46 +398,129 @@ int axi_element_wise_proc_cfg(AxiElmWiseProcHandler* handler, const AxiElmWisePr
 		return -2;
 	}
 
-	handler->reg_region_fu_cfg->fmt_cfg =
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_fu_cfg->fmt_cfg,
 		((uint32_t)cfg->in_data_fmt) |
 		(((uint32_t)cfg->cal_fmt) << 8) |
-		(((uint32_t)cfg->out_data_fmt) << 16);
+		(((uint32_t)cfg->out_data_fmt) << 16));
 
-	handler->reg_region_fu_cfg->fixed_point_cfg0 =
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_fu_cfg->fixed_point_cfg0,
 		((uint32_t)cfg->in_fixed_point_quat_accrc) |
 		(((uint32_t)cfg->op_x_fixed_point_quat_accrc) << 8) |
 		(((uint32_t)cfg->op_a_fixed_point_quat_accrc) << 16) |
-		(((uint32_t)cfg->s33_cvt_fixed_point_quat_accrc) << 24);
+		(((uint32_t)cfg->s33_cvt_fixed_point_quat_accrc) << 24));
 
-	handler->reg_region_fu_cfg->fixed_point_cfg1 =
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_fu_cfg->fixed_point_cfg1,
 		((uint32_t)cfg->round_in_fixed_point_quat_accrc) |
 		(((uint32_t)cfg->round_out_fixed_point_quat_accrc) << 8) |
-		(((uint32_t)(cfg->round_in_fixed_point_quat_accrc - cfg->round_out_fixed_point_quat_accrc)) << 16);
+		(((uint32_t)(cfg->round_in_fixed_point_quat_accrc - cfg->round_out_fixed_point_quat_accrc)) << 16));
 
-	handler->reg_region_fu_cfg->op_a_b_cfg0 =
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_fu_cfg->op_a_b_cfg0,
 		((uint32_t)cfg->is_op_a_eq_1) |
 		(((uint32_t)cfg->is_op_b_eq_0) << 1) |
 		(((uint32_t)cfg->is_op_a_const) << 8) |
-		(((uint32_t)cfg->is_op_b_const) << 9);
+		(((uint32_t)cfg->is_op_b_const) << 9));
 
 	if(cfg->is_op_a_const && (!cfg->is_op_a_eq_1)){
-		handler->reg_region_fu_cfg->op_a_b_cfg1 = *(cfg->op_a_const_val_ptr);
+		axi_element_wise_proc_wr_reg(handler, &handler->reg_region_fu_cfg->op_a_b_cfg1, *(cfg->op_a_const_val_ptr));
 	}
 
 	if(cfg->is_op_b_const && (!cfg->is_op_b_eq_0)){
-		handler->reg_region_fu_cfg->op_a_b_cfg2 = *(cfg->op_b_const_val_ptr);
+		axi_element_wise_proc_wr_reg(handler, &handler->reg_region_fu_cfg->op_a_b_cfg2, *(cfg->op_b_const_val_ptr));
 	}
 
-	handler->reg_region_fu_cfg->fu_bypass_cfg =
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_fu_cfg->fu_bypass_cfg,
 		(cfg->use_in_data_cvt_unit ? 0:(1 << 0)) |
 		(cfg->use_pow2_cell ? 0:(1 << 1)) |
 		(cfg->use_mac_cell ? 0:(1 << 2)) |
 		(cfg->use_out_data_cvt_unit ? 0:(1 << 3)) |
-		(cfg->use_round_cell ? 0:(1 << 4));
+		(cfg->use_round_cell ? 0:(1 << 4)));
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  配置下一次处理(写影子配置寄存器)
+        可在通用逐元素操作处理单元处理期间调用, 配置会在下一次调用axi_element_wise_proc_commit_and_start时被提交
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+        cfg 功能单元配置参数(指针)
+        buf_cfg 缓存区基地址和大小配置(指针)
+        use_op_a_or_b 是否使用非常量的操作数A或B
+@return 是否成功
+*************************/
+int axi_element_wise_proc_cfg_next(AxiElmWiseProcHandler* handler, const AxiElmWiseProcFuCfg* cfg,
+	const AxiElmWiseProcBufCfg* buf_cfg, uint8_t use_op_a_or_b){
+	int res;
+
+	if(
+		(buf_cfg->op_x_buf_len & 0xFF000000) ||
+		(use_op_a_or_b && (buf_cfg->op_a_b_buf_len & 0xFF000000)) ||
+		(buf_cfg->res_buf_len & 0xFF000000)
+	){
+		return -3;
+	}
+
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl4, 0x00000001);
+
+	res = axi_element_wise_proc_cfg(handler, cfg);
+
+	if(res == 0){
+		axi_element_wise_proc_wr_buf_cfg_regs(handler, buf_cfg, use_op_a_or_b);
+	}
+
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl4, 0x00000000);
+
+	if(res == 0){
+		handler->next_cfg_valid = 1;
+		handler->next_use_op_a_or_b = use_op_a_or_b;
+	}
+
+	return res;
+}
+
+/*************************
+@ctrl
+@public
+@brief  提交下一次处理的配置并启动通用逐元素操作处理单元
+        待提交的影子配置寄存器会在发送DMA命令的同时被提交到配置寄存器
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_element_wise_proc_commit_and_start(AxiElmWiseProcHandler* handler){
+	if(axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl1) & 0x00000007){
+		return -1;
+	}
+
+	if((axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl0) & 0x00000007) != 0x00000007){
+		return -2;
+	}
+
+	if(!handler->next_cfg_valid){
+		return -3;
+	}
+
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl1,
+		(1 << 0) |
+		(handler->next_use_op_a_or_b ? (1 << 1):0) |
+		(1 << 2));
+
+	handler->next_cfg_valid = 0;
 
 	return 0;
 }
 
+/*************************
+@sts
+@public
+@brief  判断是否存在待提交的下一次配置
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+@return 是否存在待提交的配置
+*************************/
+uint8_t axi_element_wise_proc_is_next_cfg_pending(AxiElmWiseProcHandler* handler){
+	return (handler->next_cfg_valid || (axi_element_wise_proc_rd_reg(handler, &handler->reg_region_ctrl->ctrl4) & 0x00000002)) ? 0x01:0x00;
+}
+
 /*************************
 @sts
 @public
@@ -335,11 +532,11 @@ int axi_element_wise_proc_cfg(AxiElmWiseProcHandler* handler, const AxiElmWisePr
 uint32_t axi_element_wise_proc_get_cmd_fns_n(AxiElmWiseProcHandler* handler, AxiElmWiseProcCmdFnsNQueryType query_type){
 	switch(query_type){
 	case ELM_Q_CMD_FNS_N_MM2S_0:
-		return handler->reg_region_sts->sts0;
+		return axi_element_wise_proc_rd_reg(handler, &handler->reg_region_sts->sts0);
 	case ELM_Q_CMD_FNS_N_MM2S_1:
-		return handler->reg_region_sts->sts1;
+		return axi_element_wise_proc_rd_reg(handler, &handler->reg_region_sts->sts1);
 	case ELM_Q_CMD_FNS_N_S2MM:
-		return handler->reg_region_sts->sts2;
+		return axi_element_wise_proc_rd_reg(handler, &handler->reg_region_sts->sts2);
 	}
 
 	return 0xFFFFFFFF;
@@ -355,15 +552,15 @@ uint32_t axi_element_wise_proc_get_cmd_fns_n(AxiElmWiseProcHandler* handler, Axi
 *************************/
 int axi_element_wise_proc_clr_cmd_fns_n(AxiElmWiseProcHandler* handler, AxiElmWiseProcCmdFnsNClrType clr_type){
 	if(clr_type == ELM_C_CMD_FNS_N_MM2S_0 || clr_type == ELM_C_ALL){
-		handler->reg_region_sts->sts0 = 0;
+		axi_element_wise_proc_wr_reg(handler, &handler->reg_region_sts->sts0, 0);
 	}
 
 	if(clr_type == ELM_C_CMD_FNS_N_MM2S_1 || clr_type == ELM_C_ALL){
-		handler->reg_region_sts->sts1 = 0;
+		axi_element_wise_proc_wr_reg(handler, &handler->reg_region_sts->sts1, 0);
 	}
 
 	if(clr_type == ELM_C_CMD_FNS_N_S2MM || clr_type == ELM_C_ALL){
-		handler->reg_region_sts->sts2 = 0;
+		axi_element_wise_proc_wr_reg(handler, &handler->reg_region_sts->sts2, 0);
 	}
 
 	return 0;
@@ -382,7 +579,10 @@ int axi_element_wise_proc_get_pm_cnt(AxiElmWiseProcHandler* handler, AxiElmWiseP
 		return -1;
 	}
 
-	pm_sts->cycle_n = handler->reg_region_sts->sts3;
+	// 锁存快照并选择运行周期数(快照编号0)
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl5, 0x00000001);
+
+	pm_sts->cycle_n = (((uint64_t)axi_element_wise_proc_rd_reg(handler, &handler->reg_region_pm_snap->pm_snap_hi)) << 32) | ((uint64_t)axi_element_wise_proc_rd_reg(handler, &handler->reg_region_pm_snap->pm_snap_lo));
 
 	return 0;
 }
@@ -399,7 +599,103 @@ int axi_element_wise_proc_clr_pm_cnt(AxiElmWiseProcHandler* handler){
 		return -1;
 	}
 
-	handler->reg_region_sts->sts3 = 0;
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_sts->sts3, 0);
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  使能完成中断
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_element_wise_proc_enable_irq(AxiElmWiseProcHandler* handler){
+	if(handler->done_threshold == 0){
+		return -1;
+	}
+
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl2, 0x00000001);
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  除能完成中断
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+@return none
+*************************/
+void axi_element_wise_proc_disable_irq(AxiElmWiseProcHandler* handler){
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl2, 0x00000000);
+}
+
+/*************************
+@cfg
+@public
+@brief  设置完成阈值
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+        s2mm_cmd_n 完成时S2MM通道完成的命令数
+@return 是否成功
+*************************/
+int axi_element_wise_proc_set_done_threshold(AxiElmWiseProcHandler* handler, uint32_t s2mm_cmd_n){
+	if(s2mm_cmd_n == 0){
+		return -2;
+	}
+
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_ctrl->ctrl3, s2mm_cmd_n);
+	handler->done_threshold = s2mm_cmd_n;
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  清除完成中断等待标志
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+@return none
+*************************/
+void axi_element_wise_proc_clr_irq(AxiElmWiseProcHandler* handler){
+	axi_element_wise_proc_wr_reg(handler, &handler->reg_region_sts->sts4, 0x00000001);
+}
+
+/*************************
+@cfg
+@public
+@brief  设置等待完成时的回调函数
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+        hook 回调函数(可以为NULL)
+        arg 回调函数的参数
+@return none
+*************************/
+void axi_element_wise_proc_set_wait_hook(AxiElmWiseProcHandler* handler, AxiElmWiseProcWaitHook hook, void* arg){
+	handler->wait_hook = hook;
+	handler->wait_hook_arg = arg;
+}
+
+/*************************
+@sts
+@public
+@brief  等待通用逐元素操作处理单元完成(S2MM通道完成的命令数达到完成阈值),
+        等待期间反复调用回调函数(如令CPU休眠直到完成中断到来), 未设置回调函数时退化为轮询
+@param  handler 通用逐元素操作处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_element_wise_proc_wait_done(AxiElmWiseProcHandler* handler){
+	if(handler->done_threshold == 0){
+		return -1;
+	}
+
+	while(axi_element_wise_proc_rd_reg(handler, &handler->reg_region_sts->sts2) < handler->done_threshold){
+		if(handler->wait_hook != NULL){
+			handler->wait_hook(handler->wait_hook_arg);
+		}
+	}
+
+	axi_element_wise_proc_clr_irq(handler);
 
 	return 0;
 }
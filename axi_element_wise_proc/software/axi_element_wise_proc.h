@@ -4,6 +4,10 @@
 @date   2026/01/16
 @author 陈家耀
 @eidt   2026.01.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 增加完成中断(使能/除能中断, 设置完成阈值, 等待完成)
+        2026.10.16 1.02 增加影子配置寄存器(配置下一次处理, 提交配置并启动)
+        2026.10.16 1.03 运行周期数计数器扩展为64位, 通过快照读取
+        2026.10.16 1.04 增加可替换的寄存器访问后端(直接访问/Linux UIO映射/回调函数)和总线地址转换
 ************************************************************************************************************************/
 
 #include <stdint.h>
@@ -60,6 +64,21 @@ typedef enum{
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// 函数指针类型: 等待完成时的回调函数
+typedef void (*AxiElmWiseProcWaitHook)(void* arg);
+
+// 寄存器访问后端
+//     默认以指针直接访问寄存器区(裸机下为物理地址, Linux下为mmap映射/dev/uioN得到的虚拟地址), 访问函数被内联为单条load/store指令
+//     编译时定义AXI_ELM_WISE_PROC_MMIO_CB则通过回调函数访问(用于仿真器/模拟器), 此时基地址只用于区分所访问的寄存器
+// 函数指针类型: 读1个字(addr为基地址 + 偏移地址)
+typedef uint32_t (*AxiElmWiseProcMmioRd)(void* arg, uintptr_t addr);
+// 函数指针类型: 写1个字(addr为基地址 + 偏移地址)
+typedef void (*AxiElmWiseProcMmioWr)(void* arg, uintptr_t addr, uint32_t data);
+// 函数指针类型: 把主机指针转换为加速器DMA使用的总线地址
+typedef uint32_t (*AxiElmWiseProcBusAddr)(void* arg, const void* ptr);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 // 结构体: 加速器属性
 typedef struct{
 	char version[9]; // 版本号
@@ -103,10 +122,20 @@ typedef struct{
 	uint32_t info1;
 }AxiElmWiseProcRegRgnProp;
 
+// 结构体: 寄存器域(性能监测快照)
+typedef struct{
+	uint32_t pm_snap_lo;
+	uint32_t pm_snap_hi;
+}AxiElmWiseProcRegRgnPmSnap;
+
 // 结构体: 寄存器域(控制)
 typedef struct{
 	uint32_t ctrl0;
 	uint32_t ctrl1;
+	uint32_t ctrl2;
+	uint32_t ctrl3;
+	uint32_t ctrl4;
+	uint32_t ctrl5;
 }AxiElmWiseProcRegRgnCtrl;
 
 // 结构体: 寄存器域(状态)
@@ -115,6 +144,7 @@ typedef struct{
 	uint32_t sts1;
 	uint32_t sts2;
 	uint32_t sts3;
+	uint32_t sts4;
 }AxiElmWiseProcRegRgnSts;
 
 // 结构体: 寄存器域(缓存区配置)
@@ -179,26 +209,48 @@ typedef struct{
 
 // 结构体: 性能监测状态
 typedef struct{
-	uint32_t cycle_n; // 运行周期数
+	uint64_t cycle_n; // 运行周期数
 }AxiElmWiseProcPerfMonsts;
 
+// 结构体: 寄存器访问后端
+typedef struct{
+	uintptr_t reg_base; // 寄存器区基地址
+
+	AxiElmWiseProcMmioRd rd; // 读回调函数(仅在定义AXI_ELM_WISE_PROC_MMIO_CB时使用)
+	AxiElmWiseProcMmioWr wr; // 写回调函数(仅在定义AXI_ELM_WISE_PROC_MMIO_CB时使用)
+	void* mmio_arg; // 读写回调函数的参数
+
+	AxiElmWiseProcBusAddr bus_addr; // 总线地址转换函数(为NULL时直接取指针的低32位)
+	void* bus_addr_arg; // 总线地址转换函数的参数
+}AxiElmWiseProcMmio;
+
 // 结构体: 通用逐元素操作处理单元
 typedef struct{
-	uint32_t* reg_base_ptr; // 寄存器区基地址
+	AxiElmWiseProcMmio mmio; // 寄存器访问后端
 
 	// 寄存器域
 	AxiElmWiseProcRegRgnProp* reg_region_prop; // 寄存器域(属性)
+	AxiElmWiseProcRegRgnPmSnap* reg_region_pm_snap; // 寄存器域(性能监测快照)
 	AxiElmWiseProcRegRgnCtrl* reg_region_ctrl; // 寄存器域(控制)
 	AxiElmWiseProcRegRgnSts* reg_region_sts; // 寄存器域(状态)
 	AxiElmWiseProcRegRgnBufCfg* reg_region_buf_cfg; // 寄存器域(缓存区配置)
 	AxiElmWiseProcRegRgnFuCfg* reg_region_fu_cfg; // 寄存器域(功能单元配置)
 
 	AxiElmWiseProcProp property; // 加速器属性
+
+	uint32_t done_threshold; // 完成阈值(S2MM通道完成的命令数)
+	AxiElmWiseProcWaitHook wait_hook; // 等待完成时的回调函数
+	void* wait_hook_arg; // 等待完成时的回调函数的参数
+
+	uint8_t next_cfg_valid; // 是否存在待提交的下一次配置
+	uint8_t next_use_op_a_or_b; // 下一次处理是否使用非常量的操作数A或B
 }AxiElmWiseProcHandler;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int axi_element_wise_proc_init(AxiElmWiseProcHandler* handler, uint32_t baseaddr); // 初始化通用逐元素操作处理单元
+int axi_element_wise_proc_init_mmio(AxiElmWiseProcHandler* handler, const AxiElmWiseProcMmio* mmio); // 初始化通用逐元素操作处理单元(指定寄存器访问后端)
+uint32_t axi_element_wise_proc_bus_addr(AxiElmWiseProcHandler* handler, const void* ptr); // 把主机指针转换为总线地址
 
 int axi_element_wise_proc_enable(AxiElmWiseProcHandler* handler); // 使能加速器
 void axi_element_wise_proc_disable(AxiElmWiseProcHandler* handler); // 除能加速器
@@ -209,8 +261,20 @@ void axi_element_wise_proc_disable_cycle_n_cnt(AxiElmWiseProcHandler* handler);
 int axi_element_wise_proc_start(AxiElmWiseProcHandler* handler, const AxiElmWiseProcBufCfg* buf_cfg, uint8_t use_op_a_or_b); // 启动通用逐元素操作处理单元
 
 int axi_element_wise_proc_cfg(AxiElmWiseProcHandler* handler, const AxiElmWiseProcFuCfg* cfg); // 配置通用逐元素操作处理单元
+// 配置下一次处理(写影子配置寄存器)
+int axi_element_wise_proc_cfg_next(AxiElmWiseProcHandler* handler, const AxiElmWiseProcFuCfg* cfg,
+	const AxiElmWiseProcBufCfg* buf_cfg, uint8_t use_op_a_or_b);
+int axi_element_wise_proc_commit_and_start(AxiElmWiseProcHandler* handler); // 提交下一次处理的配置并启动通用逐元素操作处理单元
+uint8_t axi_element_wise_proc_is_next_cfg_pending(AxiElmWiseProcHandler* handler); // 判断是否存在待提交的下一次配置
 
 uint32_t axi_element_wise_proc_get_cmd_fns_n(AxiElmWiseProcHandler* handler, AxiElmWiseProcCmdFnsNQueryType query_type); // 查询DMA命令完成数
 int axi_element_wise_proc_clr_cmd_fns_n(AxiElmWiseProcHandler* handler, AxiElmWiseProcCmdFnsNClrType clr_type); // 清除DMA命令完成数计数器
 int axi_element_wise_proc_get_pm_cnt(AxiElmWiseProcHandler* handler, AxiElmWiseProcPerfMonsts* pm_sts); // 获取性能监测计数器的值
 int axi_element_wise_proc_clr_pm_cnt(AxiElmWiseProcHandler* handler); // 清除性能监测计数器
+
+int axi_element_wise_proc_enable_irq(AxiElmWiseProcHandler* handler); // 使能完成中断
+void axi_element_wise_proc_disable_irq(AxiElmWiseProcHandler* handler); // 除能完成中断
+int axi_element_wise_proc_set_done_threshold(AxiElmWiseProcHandler* handler, uint32_t s2mm_cmd_n); // 设置完成阈值
+void axi_element_wise_proc_clr_irq(AxiElmWiseProcHandler* handler); // 清除完成中断等待标志
+void axi_element_wise_proc_set_wait_hook(AxiElmWiseProcHandler* handler, AxiElmWiseProcWaitHook hook, void* arg); // 设置等待完成时的回调函数
+int axi_element_wise_proc_wait_done(AxiElmWiseProcHandler* handler); // 等待通用逐元素操作处理单元完成
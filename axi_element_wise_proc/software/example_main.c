@@ -44,12 +44,14 @@
 
 #include "xparameters.h"
 #include "xil_cache.h"
+#include "sleep.h"
 
 #include <stdio.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 static int element_wise_proc_test(const AxiElmWiseProcBufCfg* buf_cfg, const AxiElmWiseProcFuCfg* fu_cfg);
+static void wait_done_hook(void* arg);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -90,6 +92,9 @@ int main(){
 		return -1;
 	}
 
+	// 设置等待完成时的回调函数
+	axi_element_wise_proc_set_wait_hook(&axi_element_wise_proc, wait_done_hook, NULL);
+
 	/* 计算: 32X + B */
 	// 从SD卡读取操作数X
 	if(sd_card_fatfs_fopen(&file_handler, "op_x_0.bin", FA_READ, 0)){
@@ -282,6 +287,14 @@ static int element_wise_proc_test(const AxiElmWiseProcBufCfg* buf_cfg, const Axi
 		return -1;
 	}
 
+	// 设置完成阈值并使能完成中断
+	if(axi_element_wise_proc_set_done_threshold(&axi_element_wise_proc, 1)){
+		return -1;
+	}
+	if(axi_element_wise_proc_enable_irq(&axi_element_wise_proc)){
+		return -1;
+	}
+
 	// 启动通用逐元素操作处理单元
 	if(axi_element_wise_proc_start(
 		&axi_element_wise_proc,
@@ -292,7 +305,9 @@ static int element_wise_proc_test(const AxiElmWiseProcBufCfg* buf_cfg, const Axi
 	}
 
 	// 等待逐元素操作处理完成(S2MM通道传输完成)
-	while(axi_element_wise_proc_get_cmd_fns_n(&axi_element_wise_proc, ELM_Q_CMD_FNS_N_S2MM) < 1);
+	if(axi_element_wise_proc_wait_done(&axi_element_wise_proc)){
+		return -1;
+	}
 
 	// 除能性能监测
 	axi_element_wise_proc_disable_cycle_n_cnt(&axi_element_wise_proc);
@@ -307,3 +322,8 @@ static int element_wise_proc_test(const AxiElmWiseProcBufCfg* buf_cfg, const Axi
 
 	return 0;
 }
+
+// 等待完成时的回调函数: 可在此处执行CPU侧的预处理/后处理, 或令CPU休眠直到完成中断到来
+static void wait_done_hook(void* arg){
+	usleep(50);
+}
@@ -157,7 +157,10 @@ module axi_element_wise_proc #(
 	output wire[S2MM_STREAM_DATA_WIDTH/8-1:0] m_dma_strm_axis_keep,
 	output wire m_dma_strm_axis_last,
 	output wire m_dma_strm_axis_valid,
-	input wire m_dma_strm_axis_ready
+	input wire m_dma_strm_axis_ready,
+	
+	// 中断
+	output wire irq // 完成中断
 );
 	
 	/** 函数 **/
@@ -289,6 +292,8 @@ module axi_element_wise_proc #(
 		.mm2s_1_cmd_done(mm2s_1_cmd_done),
 		.s2mm_cmd_done(s2mm_cmd_done),
 		
+		.irq(irq),
+		
 		.in_data_cvt_unit_bypass(in_data_cvt_unit_bypass),
 		.pow2_cell_bypass(pow2_cell_bypass),
 		.mac_cell_bypass(mac_cell_bypass),
@@ -58,6 +58,14 @@ SOFTWARE.
 	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x38/14 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   lo     |         |      性能监测计数器快照低32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x3C/15 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   hi     |         |      性能监测计数器快照高32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	********************************************************************************************************
+	--------------------------------------------------------------------------------------------------------
 	| ctrl0    | 0x40/16 |0: 使能加速器                  |      RW      |                                  |
 	|          |         |1: 使能数据枢纽                |      RW      |                                  |
 	|          |         |2: 使能处理核心                |      RW      |                                  |
@@ -67,6 +75,19 @@ SOFTWARE.
 	|          |         |1: 发送1号MM2S通道的DMA命令    |      RW      | 写1发送命令, 读该位时得到等待标志|
 	|          |         |2: 发送S2MM通道的DMA命令       |      RW      | 写1发送命令, 读该位时得到等待标志|
 	--------------------------------------------------------------------------------------------------------
+	| ctrl2    | 0x48/18 |0: 使能完成中断                |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl3    | 0x4C/19 |31~0: 完成中断的               |      RW      | 当S2MM通道完成的命令数           |
+	|          |         |      S2MM命令数阈值           |              | 计至该值时产生完成中断           |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl4    | 0x50/20 | 0: 写影子配置寄存器           |      RW      | 为1时, 经AXI-Lite写配置寄存器    |
+	|          |         |                               |              | 仅写入影子配置寄存器组           |
+	|          |         | 1: 影子配置寄存器待提交标志   |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl5    | 0x54/21 | 0: 锁存性能监测计数器快照     |      WO      | 向该位写1会在同1个周期内锁存     |
+	|          |         |                               |              | 全部性能监测计数器               |
+	|          |         |11~8: 快照读索引               |      RW      | 0对应sts3                        |
+	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
 	| sts0     | 0x60/24 |31~0: 0号MM2S通道完成的命令数  |      WC      |                                  |
@@ -77,6 +98,8 @@ SOFTWARE.
 	--------------------------------------------------------------------------------------------------------
 	| sts3     | 0x6C/27 |31~0: 运行周期数               |      WC      | 仅当支持性能监测时, 该字段可用   |
 	--------------------------------------------------------------------------------------------------------
+	| sts4     | 0x70/28 |0: 完成中断等待标志            |      WC      | 写1清零                          |
+	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
 	| buf_cfg0 | 0x80/32 |31~0: 操作数X缓存区基地址      |      RW      |                                  |
@@ -127,7 +150,10 @@ SOFTWARE.
 	--------------------------------------------------------------------------------------------------------
 
 注意：
-无
+当ctrl4[0]为1时, 写配置寄存器只会写入影子配置寄存器组, 这些配置会在下一次发送DMA命令时被提交,
+因此可在处理当前数据期间写入下一次处理的配置
+sts3为64位计数器, 直接读该寄存器得到的是实时值的低32位;
+向ctrl5[0]写1会把它锁存到快照, 再经pm_snap_lo/pm_snap_hi读出一致的64位值
 
 协议:
 AXI-Lite SLAVE
@@ -215,6 +241,9 @@ module reg_if_for_element_wise_proc #(
 	input wire mm2s_1_cmd_done, // 1号MM2S通道命令完成(指示)
 	input wire s2mm_cmd_done, // S2MM通道命令完成(指示)
 	
+	// 中断
+	output wire irq, // 完成中断
+	
 	// 运行时参数
 	// [执行单元旁路]
 	output wire in_data_cvt_unit_bypass, // 旁路输入数据转换单元
@@ -450,7 +479,7 @@ module reg_if_for_element_wise_proc #(
 	assign fp32_to_fp16_round_supported_r = EN_ROUND_UNIT & ROUND_FP32_ROUND_SUPPORTED;
 	
 	/**
-	寄存器(ctrl0, ctrl1)
+	寄存器(ctrl0, ctrl1, ctrl2, ctrl3, ctrl4, ctrl5)
 	
 	--------------------------------------------------------------------------------------------------------
 	| ctrl0    | 0x40/16 |0: 使能加速器                  |      RW      |                                  |
@@ -462,6 +491,19 @@ module reg_if_for_element_wise_proc #(
 	|          |         |1: 发送1号MM2S通道的DMA命令    |      RW      | 写1发送命令, 读该位时得到等待标志|
 	|          |         |2: 发送S2MM通道的DMA命令       |      RW      | 写1发送命令, 读该位时得到等待标志|
 	--------------------------------------------------------------------------------------------------------
+	| ctrl2    | 0x48/18 |0: 使能完成中断                |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl3    | 0x4C/19 |31~0: 完成中断的               |      RW      | 当S2MM通道完成的命令数           |
+	|          |         |      S2MM命令数阈值           |              | 计至该值时产生完成中断           |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl4    | 0x50/20 | 0: 写影子配置寄存器           |      RW      | 为1时, 经AXI-Lite写配置寄存器    |
+	|          |         |                               |              | 仅写入影子配置寄存器组           |
+	|          |         | 1: 影子配置寄存器待提交标志   |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl5    | 0x54/21 | 0: 锁存性能监测计数器快照     |      WO      | 向该位写1会在同1个周期内锁存     |
+	|          |         |                               |              | 全部性能监测计数器               |
+	|          |         |11~8: 快照读索引               |      RW      | 0对应sts3                        |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	reg en_accelerator_r; // 使能加速器
 	reg en_data_hub_r; // 使能数据枢纽
@@ -473,6 +515,11 @@ module reg_if_for_element_wise_proc #(
 	wire mm2s_0_cmd_pending_r; // 等待0号MM2S通道的DMA命令传输完成(标志)
 	wire mm2s_1_cmd_pending_r; // 等待1号MM2S通道的DMA命令传输完成(标志)
 	wire s2mm_cmd_pending_r; // 等待S2MM通道的DMA命令传输完成(标志)
+	reg en_done_irq_r; // 使能完成中断
+	reg[31:0] done_irq_s2mm_cmd_n_th_r; // 完成中断的S2MM命令数阈值
+	reg shadow_cfg_wen_r; // 写影子配置寄存器
+	reg pm_snap_r; // 锁存性能监测计数器快照(指示)
+	reg[3:0] pm_snap_sel_r; // 快照读索引
 	
 	assign en_accelerator = en_accelerator_r;
 	assign en_data_hub = en_data_hub_r;
@@ -504,8 +551,54 @@ module reg_if_for_element_wise_proc #(
 				{3{regs_en & regs_wen & (regs_addr == 17)}} & regs_din[2:0];
 	end
 	
+	// 使能完成中断
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			en_done_irq_r <= 1'b0;
+		else if(regs_en & regs_wen & (regs_addr == 18))
+			en_done_irq_r <= # SIM_DELAY regs_din[0];
+	end
+	
+	// 完成中断的S2MM命令数阈值
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			done_irq_s2mm_cmd_n_th_r <= 32'd0;
+		else if(regs_en & regs_wen & (regs_addr == 19))
+			done_irq_s2mm_cmd_n_th_r <= # SIM_DELAY regs_din[31:0];
+	end
+	
+	// 写影子配置寄存器
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			shadow_cfg_wen_r <= 1'b0;
+		else if(regs_en & regs_wen & (regs_addr == 20))
+			shadow_cfg_wen_r <= # SIM_DELAY regs_din[0];
+	end
+	
+	// 锁存性能监测计数器快照(指示)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_r <= 1'b0;
+		else
+			pm_snap_r <= # SIM_DELAY 
+				EN_PERF_MON & regs_en & regs_wen & (regs_addr == 21) & regs_din[0];
+	end
+	
+	// 快照读索引
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_sel_r <= 4'd0;
+		else if(regs_en & regs_wen & (regs_addr == 21))
+			pm_snap_sel_r <= # SIM_DELAY regs_din[11:8];
+	end
+	
 	/**
-	寄存器(sts0, sts1, sts2, sts3)
+	寄存器(sts0, sts1, sts2, sts3, sts4)
 	
 	--------------------------------------------------------------------------------------------------------
 	| sts0     | 0x60/24 |31~0: 0号MM2S通道完成的命令数  |      WC      |                                  |
@@ -516,11 +609,17 @@ module reg_if_for_element_wise_proc #(
 	--------------------------------------------------------------------------------------------------------
 	| sts3     | 0x6C/27 |31~0: 运行周期数               |      WC      | 仅当支持性能监测时, 该字段可用   |
 	--------------------------------------------------------------------------------------------------------
+	| sts4     | 0x70/28 |0: 完成中断等待标志            |      WC      | 写1清零                          |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	reg[31:0] dma_mm2s_0_fns_cmd_n_r; // 0号MM2S通道完成的命令数
 	reg[31:0] dma_mm2s_1_fns_cmd_n_r; // 1号MM2S通道完成的命令数
 	reg[31:0] dma_s2mm_fns_cmd_n_r; // S2MM通道完成的命令数
-	reg[31:0] cycle_n_cnt_r; // 运行周期数计数器
+	reg[63:0] cycle_n_cnt_r; // 运行周期数计数器
+	reg done_irq_pending_r; // 完成中断等待标志
+	reg irq_r; // 完成中断
+	
+	assign irq = irq_r;
 	
 	// 0号MM2S通道完成的命令数
 	always @(posedge aclk or negedge aresetn)
@@ -567,11 +666,37 @@ module reg_if_for_element_wise_proc #(
 					(dma_s2mm_fns_cmd_n_r + 1'b1);
 	end
 	
+	// 完成中断等待标志(S2MM通道完成的命令数递增至阈值时置位, 向sts4[0]写1时清零)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			done_irq_pending_r <= 1'b0;
+		else if(
+			(
+				en_accelerator_r & s2mm_cmd_done & (~(regs_en & regs_wen & (regs_addr == 26))) & 
+				(done_irq_s2mm_cmd_n_th_r != 32'd0) & ((dma_s2mm_fns_cmd_n_r + 1'b1) == done_irq_s2mm_cmd_n_th_r)
+			) | 
+			(regs_en & regs_wen & (regs_addr == 28) & regs_din[0])
+		)
+			done_irq_pending_r <= # SIM_DELAY 
+				en_accelerator_r & s2mm_cmd_done & (~(regs_en & regs_wen & (regs_addr == 26))) & 
+				(done_irq_s2mm_cmd_n_th_r != 32'd0) & ((dma_s2mm_fns_cmd_n_r + 1'b1) == done_irq_s2mm_cmd_n_th_r);
+	end
+	
+	// 完成中断
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			irq_r <= 1'b0;
+		else
+			irq_r <= # SIM_DELAY en_done_irq_r & done_irq_pending_r;
+	end
+	
 	// 运行周期数计数器
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			cycle_n_cnt_r <= 32'd0;
+			cycle_n_cnt_r <= 64'd0;
 		else if(
 			EN_PERF_MON & 
 			(
@@ -581,10 +706,98 @@ module reg_if_for_element_wise_proc #(
 		)
 			cycle_n_cnt_r <= # SIM_DELAY 
 				(regs_en & regs_wen & (regs_addr == 27)) ? 
-					32'd0:
+					64'd0:
 					(cycle_n_cnt_r + 1'b1);
 	end
 	
+	/**
+	寄存器(pm_snap_lo, pm_snap_hi)
+	
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x38/14 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   lo     |         |      性能监测计数器快照低32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x3C/15 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   hi     |         |      性能监测计数器快照高32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	
+	向ctrl5[0]写1的下1个周期锁存全部性能监测计数器, 此后经pm_snap_lo/pm_snap_hi读取到的64位值来自同1个周期
+	快照读索引 -> 
+		0: 运行周期数(sts3)
+	**/
+	localparam integer PM_SNAP_N = 1; // 快照中的计数器个数
+	
+	wire[PM_SNAP_N*64-1:0] pm_snap_din; // 待锁存的性能监测计数器
+	reg[PM_SNAP_N*64-1:0] pm_snap_regs; // 性能监测计数器快照
+	wire[63:0] pm_snap_sel_dout; // 快照读索引所选的性能监测计数器快照
+	
+	assign pm_snap_din = {cycle_n_cnt_r};
+	assign pm_snap_sel_dout = 
+		(pm_snap_sel_r < PM_SNAP_N) ? 
+			pm_snap_regs[pm_snap_sel_r*64+:64]:
+			64'd0;
+	
+	// 性能监测计数器快照
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_regs <= {(PM_SNAP_N*64){1'b0}};
+		else if(EN_PERF_MON & pm_snap_r)
+			pm_snap_regs <= # SIM_DELAY pm_snap_din;
+	end
+	
+	/**
+	影子配置寄存器
+	
+	当ctrl4[0]为1时, 经AXI-Lite写配置寄存器(偏移地址>=0x80)只会写入影子配置寄存器组并置位对应的待提交标志, 
+	不影响正在运行的计算; 在所有通道均无等待完成的DMA命令时发送DMA命令(向ctrl1[2:0]写非0值)时, 所有待提交的影子配置寄存器在同1个周期内被提交到配置寄存器
+	**/
+	localparam integer CFG_REGS_BASEADDR = 32; // 配置寄存器的起始偏移地址
+	
+	reg[31:0] shadow_cfg_regs[CFG_REGS_BASEADDR:REGS_N-1]; // 影子配置寄存器组
+	reg[REGS_N-1:CFG_REGS_BASEADDR] shadow_cfg_pending; // 影子配置寄存器待提交标志
+	wire shadow_cfg_wen; // 影子配置寄存器写使能
+	wire shadow_cfg_commit; // 提交影子配置寄存器(指示)
+	wire[REGS_N-1:CFG_REGS_BASEADDR] cfg_regs_upd; // 配置寄存器更新使能
+	wire[31:0] cfg_regs_upd_din[CFG_REGS_BASEADDR:REGS_N-1]; // 配置寄存器更新数据
+	
+	assign shadow_cfg_wen = 
+		regs_en & regs_wen & shadow_cfg_wen_r & (regs_addr >= CFG_REGS_BASEADDR);
+	assign shadow_cfg_commit = 
+		regs_en & regs_wen & (regs_addr == 17) & (|regs_din[2:0]) & 
+		(~mm2s_0_cmd_pending) & (~mm2s_1_cmd_pending) & (~s2mm_cmd_pending);
+	
+	// 影子配置寄存器组
+	always @(posedge aclk)
+	begin
+		if(shadow_cfg_wen)
+			shadow_cfg_regs[regs_addr] <= # SIM_DELAY regs_din;
+	end
+	
+	genvar cfg_regs_i;
+	generate
+		for(cfg_regs_i = CFG_REGS_BASEADDR;cfg_regs_i < REGS_N;cfg_regs_i = cfg_regs_i + 1)
+		begin:shadow_cfg_blk
+			// 写配置寄存器时直接更新, 或在提交时由影子配置寄存器更新
+			assign cfg_regs_upd[cfg_regs_i] = 
+				(regs_en & regs_wen & (~shadow_cfg_wen) & (regs_addr == cfg_regs_i)) | 
+				(shadow_cfg_commit & shadow_cfg_pending[cfg_regs_i]);
+			assign cfg_regs_upd_din[cfg_regs_i] = 
+				shadow_cfg_commit ? 
+					shadow_cfg_regs[cfg_regs_i]:
+					regs_din;
+			
+			// 影子配置寄存器待提交标志
+			always @(posedge aclk or negedge aresetn)
+			begin
+				if(~aresetn)
+					shadow_cfg_pending[cfg_regs_i] <= 1'b0;
+				else if(shadow_cfg_commit | (shadow_cfg_wen & (regs_addr == cfg_regs_i)))
+					shadow_cfg_pending[cfg_regs_i] <= # SIM_DELAY ~shadow_cfg_commit;
+			end
+		end
+	endgenerate
+	
 	/**
 	寄存器(buf_cfg0, buf_cfg1, buf_cfg2, buf_cfg3, buf_cfg4, buf_cfg5)
 	
@@ -619,38 +832,38 @@ module reg_if_for_element_wise_proc #(
 	// 操作数X缓存区基地址
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 32))
-			op_x_buf_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[32])
+			op_x_buf_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[32][31:0];
 	end
 	// 操作数A或B缓存区基地址
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 33))
-			op_a_b_buf_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[33])
+			op_a_b_buf_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[33][31:0];
 	end
 	// 结果缓存区基地址
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 34))
-			res_buf_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[34])
+			res_buf_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[34][31:0];
 	end
 	// 操作数X缓存区大小
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 35))
-			op_x_buf_len_r <= # SIM_DELAY regs_din[23:0];
+		if(cfg_regs_upd[35])
+			op_x_buf_len_r <= # SIM_DELAY cfg_regs_upd_din[35][23:0];
 	end
 	// 操作数A或B缓存区大小
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 36))
-			op_a_b_buf_len_r <= # SIM_DELAY regs_din[23:0];
+		if(cfg_regs_upd[36])
+			op_a_b_buf_len_r <= # SIM_DELAY cfg_regs_upd_din[36][23:0];
 	end
 	// 结果缓存区大小
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 37))
-			res_buf_len_r <= # SIM_DELAY regs_din[23:0];
+		if(cfg_regs_upd[37])
+			res_buf_len_r <= # SIM_DELAY cfg_regs_upd_din[37][23:0];
 	end
 	
 	/**
@@ -744,59 +957,59 @@ module reg_if_for_element_wise_proc #(
 	// 输入数据格式
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 48))
-			in_data_fmt_r <= # SIM_DELAY regs_din[2:0];
+		if(cfg_regs_upd[48])
+			in_data_fmt_r <= # SIM_DELAY cfg_regs_upd_din[48][2:0];
 	end
 	// 计算数据格式
 	always @(posedge aclk)
 	begin
 		if(
-			regs_en & regs_wen & (regs_addr == 48) & 
+			cfg_regs_upd[48] & 
 			(
-				(CAL_INT16_SUPPORTED & (regs_din[9:8] == CAL_FMT_INT16)) | 
-				(CAL_INT32_SUPPORTED & (regs_din[9:8] == CAL_FMT_INT32)) | 
-				(CAL_FP32_SUPPORTED & (regs_din[9:8] == CAL_FMT_FP32))
+				(CAL_INT16_SUPPORTED & (cfg_regs_upd_din[48][9:8] == CAL_FMT_INT16)) | 
+				(CAL_INT32_SUPPORTED & (cfg_regs_upd_din[48][9:8] == CAL_FMT_INT32)) | 
+				(CAL_FP32_SUPPORTED & (cfg_regs_upd_din[48][9:8] == CAL_FMT_FP32))
 			)
 		)
-			cal_calfmt_r <= # SIM_DELAY regs_din[9:8];
+			cal_calfmt_r <= # SIM_DELAY cfg_regs_upd_din[48][9:8];
 	end
 	// 输出数据格式
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 48))
-			out_data_fmt_r <= # SIM_DELAY regs_din[18:16];
+		if(cfg_regs_upd[48])
+			out_data_fmt_r <= # SIM_DELAY cfg_regs_upd_din[48][18:16];
 	end
 	
 	// 转换为S33输出数据的定点数量化精度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 49) & OUT_DATA_CVT_S33_OUT_DATA_SUPPORTED)
-			s33_cvt_fixed_point_quat_accrc_r <= # SIM_DELAY regs_din[29:24];
+		if(cfg_regs_upd[49] & OUT_DATA_CVT_S33_OUT_DATA_SUPPORTED)
+			s33_cvt_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[49][29:24];
 	end
 	// 操作数A的定点数量化精度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 49) & (CAL_INT16_SUPPORTED | CAL_INT32_SUPPORTED))
-			op_a_fixed_point_quat_accrc_r <= # SIM_DELAY regs_din[20:16];
+		if(cfg_regs_upd[49] & (CAL_INT16_SUPPORTED | CAL_INT32_SUPPORTED))
+			op_a_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[49][20:16];
 	end
 	// 操作数X的定点数量化精度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 49) & (CAL_INT16_SUPPORTED | CAL_INT32_SUPPORTED))
-			op_x_fixed_point_quat_accrc_r <= # SIM_DELAY regs_din[12:8];
+		if(cfg_regs_upd[49] & (CAL_INT16_SUPPORTED | CAL_INT32_SUPPORTED))
+			op_x_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[49][12:8];
 	end
 	// 输入定点数量化精度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 49) & IN_DATA_CVT_S33_IN_DATA_SUPPORTED)
-			in_fixed_point_quat_accrc_r <= # SIM_DELAY regs_din[5:0];
+		if(cfg_regs_upd[49] & IN_DATA_CVT_S33_IN_DATA_SUPPORTED)
+			in_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[49][5:0];
 	end
 	
 	// 舍入单元输入定点数量化精度, 舍入单元输出定点数量化精度, 定点数舍入位数
 	always @(posedge aclk)
 	begin
 		if(
-			regs_en & regs_wen & (regs_addr == 50) & 
+			cfg_regs_upd[50] & 
 			ROUND_S33_ROUND_SUPPORTED
 		)
 			{
@@ -804,36 +1017,36 @@ module reg_if_for_element_wise_proc #(
 				round_out_fixed_point_quat_accrc_r,
 				round_in_fixed_point_quat_accrc_r
 			} <= # SIM_DELAY {
-				regs_din[20:16],
-				regs_din[12:8],
-				regs_din[4:0]
+				cfg_regs_upd_din[50][20:16],
+				cfg_regs_upd_din[50][12:8],
+				cfg_regs_upd_din[50][4:0]
 			};
 	end
 	
 	// 操作数A的实际值恒为1(标志), 操作数B的实际值恒为0(标志), 操作数A为常量(标志), 操作数B为常量(标志)
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 51))
+		if(cfg_regs_upd[51])
 			{is_op_b_const_r, is_op_a_const_r, is_op_b_eq_0_r, is_op_a_eq_1_r} <= # SIM_DELAY {
-				regs_din[9],
-				regs_din[8],
-				regs_din[1],
-				regs_din[0]
+				cfg_regs_upd_din[51][9],
+				cfg_regs_upd_din[51][8],
+				cfg_regs_upd_din[51][1],
+				cfg_regs_upd_din[51][0]
 			};
 	end
 	
 	// 操作数A的常量值
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 52))
-			op_a_const_val_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[52])
+			op_a_const_val_r <= # SIM_DELAY cfg_regs_upd_din[52][31:0];
 	end
 	
 	// 操作数B的常量值
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 53))
-			op_b_const_val_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[53])
+			op_b_const_val_r <= # SIM_DELAY cfg_regs_upd_din[53][31:0];
 	end
 	
 	// 旁路输入数据转换单元, 旁路二次幂计算单元, 旁路乘加计算单元, 旁路输出数据转换单元, 旁路舍入单元
@@ -847,7 +1060,7 @@ module reg_if_for_element_wise_proc #(
 				pow2_cell_bypass_r,
 				in_data_cvt_unit_bypass_r
 			} <= 5'b11111;
-		else if(regs_en & regs_wen & (regs_addr == 54))
+		else if(cfg_regs_upd[54])
 			{
 				round_cell_bypass_r,
 				out_data_cvt_unit_bypass_r,
@@ -855,7 +1068,7 @@ module reg_if_for_element_wise_proc #(
 				pow2_cell_bypass_r,
 				in_data_cvt_unit_bypass_r
 			} <= # SIM_DELAY 
-				regs_din[4:0] | 
+				cfg_regs_upd_din[54][4:0] | 
 				(~{
 					EN_ROUND_UNIT,
 					EN_OUT_DATA_CVT,
@@ -893,13 +1106,21 @@ module reg_if_for_element_wise_proc #(
 					element_wise_proc_pipeline_n_r[7:0]
 				};
 				
+				14: regs_dout <= # SIM_DELAY {pm_snap_sel_dout[31:0]};
+				15: regs_dout <= # SIM_DELAY {pm_snap_sel_dout[63:32]};
+				
 				16: regs_dout <= # SIM_DELAY {24'd0, 4'd0, en_cycle_n_cnt_r, en_proc_core_r, en_data_hub_r, en_accelerator_r};
 				17: regs_dout <= # SIM_DELAY {24'd0, 5'd0, s2mm_cmd_pending_r, mm2s_1_cmd_pending_r, mm2s_0_cmd_pending_r};
+				18: regs_dout <= # SIM_DELAY {24'd0, 7'd0, en_done_irq_r};
+				19: regs_dout <= # SIM_DELAY {done_irq_s2mm_cmd_n_th_r[31:0]};
+				20: regs_dout <= # SIM_DELAY {30'd0, |shadow_cfg_pending, shadow_cfg_wen_r};
+				21: regs_dout <= # SIM_DELAY {20'd0, pm_snap_sel_r[3:0], 8'd0};
 				
 				24: regs_dout <= # SIM_DELAY {dma_mm2s_0_fns_cmd_n_r[31:0]};
 				25: regs_dout <= # SIM_DELAY {dma_mm2s_1_fns_cmd_n_r[31:0]};
 				26: regs_dout <= # SIM_DELAY {dma_s2mm_fns_cmd_n_r[31:0]};
 				27: regs_dout <= # SIM_DELAY {cycle_n_cnt_r[31:0]};
+				28: regs_dout <= # SIM_DELAY {24'd0, 7'd0, done_irq_pending_r};
 				
 				32: regs_dout <= # SIM_DELAY {op_x_buf_baseaddr_r[31:0]};
 				33: regs_dout <= # SIM_DELAY {op_a_b_buf_baseaddr_r[31:0]};
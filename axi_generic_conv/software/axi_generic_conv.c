@@ -18,6 +18,25 @@
         2026.01.06 1.32 增加对sigmoid函数值查找表的初始化
         2026.01.11 1.40 增加对tanh激活函数的支持
         2026.04.07 1.50 增加对2x2和4x4卷积核的支持
+        2026.10.16 1.51 增加完成中断(使能/除能中断, 设置完成阈值, 等待完成)
+        2026.10.16 1.52 增加层描述符链(生成层描述符, 链接层描述符, 提交描述符链, 等待描述符链完成)
+        2026.10.16 1.53 增加影子配置寄存器(配置下一层, 提交配置并启动)
+        2026.10.16 1.54 增加缓存划分规划(自动选择缓存Bank划分、表面行长度、权重块宽度与计算轮次)
+        2026.10.16 1.55 增加扩展性能监测计数器组(乘加阵列停顿周期数, S2MM通道反压周期数, 特征图表面行置换次数, 卷积核交换区重新加载次数)
+        2026.10.16 1.56 性能监测计数器扩展为64位, 通过快照一次性读取
+        2026.10.16 1.57 通过可替换的寄存器访问后端读写寄存器区和存储器区, DMA地址经总线地址转换
+        2026.10.17 1.58 增加融合2x2最大池化配置
+        2026.10.17 1.59 增加融合残差相加配置
+        2026.10.17 1.60 增加输出特征图跨距配置(直接写入拼接后特征图的通道切片)
+        2026.10.17 1.61 增加输入特征图跨距配置(直接读取更大特征图中的区域或通道切片)
+        2026.10.17 1.62 支持INT8运算数据格式(每个16位数据为1对INT8通道, 按通道对数配置硬件通道数)
+        2026.10.17 1.63 增加INT8逐通道重量化配置
+        2026.10.17 1.65 增加零通道组跳过配置
+        2026.10.17 1.66 公开获取卷积核边长的函数(供分块执行/数据重排/运行时复用)
+        2026.10.17 1.67 增加输出舍入单元的定点数量化精度配置
+        2026.10.17 1.68 以memcpy代替浮点字段与32位字之间的指针类型双关, 增加INT8逐通道重量化的参考计算
+        2026.10.17 1.69 缓存划分规划支持以回调函数给出候选方案的代价(供性能模型按估计的运行周期数规划)
+        2026.10.17 1.70 INT8逐通道重量化的输出特征图按通道对存储(1字节输出特征图), 增加计算输出特征点字节数的函数
 ************************************************************************************************************************/
 
 #include "axi_generic_conv.h"
@@ -29,14 +48,21 @@
 
 // 各寄存器域的偏移地址
 #define REG_REGION_PROP_OFS 0x0000
+#define REG_REGION_PM_OFS 0x0020
 #define REG_REGION_CTRL_OFS 0x0040
 #define REG_REGION_STS_OFS 0x0060
 #define REG_REGION_CAL_CFG_OFS 0x0090
 #define REG_REGION_GRP_CONV_CFG_OFS 0x00A0
 #define REG_REGION_FMAP_CFG_OFS 0x00C0
+#define REG_REGION_OFMAP_PITCH_CFG_OFS 0x00D8
+#define REG_REGION_IFMAP_PITCH_CFG_OFS 0x00E0
 #define REG_REGION_KRN_CFG_OFS 0x0100
 #define REG_REGION_BUF_CFG_OFS 0x0140
 #define REG_REGION_BN_ACT_CFG_OFS 0x0180
+#define REG_REGION_SPA_CFG_OFS 0x01C0
+
+// 零通道组位图的最大长度
+#define ZERO_CGRP_MAP_LEN 256
 
 // BN参数存储器域的偏移地址
 #define MEM_REGION_BN_PARAMS_OFS 0x0000
@@ -46,44 +72,122 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static int axi_generic_conv_cal_cfg_regs(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, AxiGnrConvLayerDesc* desc); // 计算配置寄存器的值
+static void axi_generic_conv_wr_cfg_regs(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, const AxiGnrConvLayerDesc* desc); // 写配置寄存器
+static uint32_t axi_generic_conv_cal_vld_cgrpn(const AxiGnrConvCfg* cfg, uint32_t cgrpn); // 计算非零通道组数
+static uint32_t axi_generic_conv_cal_fmbufrown(const AxiGnrConvProp* prop, uint16_t fmbufbankn, AxiGnrConvFmbufColnType fmbufcoln); // 计算特征图缓存可缓存表面行数
+static uint32_t axi_generic_conv_cal_kbufgrpn(const AxiGnrConvProp* prop, uint16_t fmbufbankn, uint32_t kernal_len,
+	AxiGnrConvWgtblkSfcNType sfc_n_each_wgtblk); // 计算卷积核缓存可缓存通道组数
+static uint32_t axi_generic_conv_cal_mid_res_buf_row_n(const AxiGnrConvProp* prop, uint32_t mid_res_item_n_foreach_row); // 计算中间结果缓存可缓存行数
+static uint64_t axi_generic_conv_rd_pm_snap(AxiGnrConvHandler* handler, uint8_t snap_id); // 读取性能监测计数器快照
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@private
+@brief  读寄存器区/存储器区的1个字
+@param  handler 通用卷积处理单元(加速器句柄)
+        reg 字地址(由寄存器域指针得到)
+@return 读到的值
+*************************/
+static inline uint32_t axi_generic_conv_rd_reg(const AxiGnrConvHandler* handler, const volatile uint32_t* reg){
+#ifdef AXI_GNR_CONV_MMIO_CB
+	return handler->mmio.rd(handler->mmio.mmio_arg, (uintptr_t)reg);
+#else
+	(void)handler;
+
+	return *reg;
+#endif
+}
+
+/*************************
+@private
+@brief  写寄存器区/存储器区的1个字
+@param  handler 通用卷积处理单元(加速器句柄)
+        reg 字地址(由寄存器域指针得到)
+        data 待写的值
+@return none
+*************************/
+static inline void axi_generic_conv_wr_reg(const AxiGnrConvHandler* handler, volatile uint32_t* reg, uint32_t data){
+#ifdef AXI_GNR_CONV_MMIO_CB
+	handler->mmio.wr(handler->mmio.mmio_arg, (uintptr_t)reg, data);
+#else
+	(void)handler;
+
+	*reg = data;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /*************************
 @init
 @public
-@brief  初始化通用卷积处理单元
+@brief  初始化通用卷积处理单元(以指针直接访问寄存器区和存储器区)
 @param  handler 通用卷积处理单元(加速器句柄)
         baseaddr 加速器基地址
         mem_base BN参数与Sigmoid函数值查找表存储器基地址
 @return 是否成功
 *************************/
 int axi_generic_conv_init(AxiGnrConvHandler* handler, uint32_t baseaddr, uint32_t mem_base){
-	uint32_t* test_ptr = (uint32_t*)baseaddr;
+	AxiGnrConvMmio mmio;
+
+	memset((void*)&mmio, 0, sizeof(mmio));
+
+	mmio.reg_base = (uintptr_t)baseaddr;
+	mmio.mem_base = (uintptr_t)mem_base;
+
+	return axi_generic_conv_init_mmio(handler, &mmio);
+}
 
-	if((test_ptr[1] & 0x3FFFFFFF) != CONV_ACC_TYPE){
+/*************************
+@init
+@public
+@brief  初始化通用卷积处理单元(指定寄存器访问后端)
+@param  handler 通用卷积处理单元(加速器句柄)
+        mmio 寄存器访问后端
+@return 是否成功
+*************************/
+int axi_generic_conv_init_mmio(AxiGnrConvHandler* handler, const AxiGnrConvMmio* mmio){
+#ifdef AXI_GNR_CONV_MMIO_CB
+	if(mmio->rd == NULL || mmio->wr == NULL){
+		return -1;
+	}
+#endif
+
+	handler->mmio = *mmio;
+
+	handler->reg_region_prop = (AxiGnrConvRegRgnProp*)(mmio->reg_base + REG_REGION_PROP_OFS);
+	handler->reg_region_pm = (AxiGnrConvRegRgnPm*)(mmio->reg_base + REG_REGION_PM_OFS);
+	handler->reg_region_ctrl = (AxiGnrConvRegRgnCtrl*)(mmio->reg_base + REG_REGION_CTRL_OFS);
+	handler->reg_region_sts = (AxiGnrConvRegRgnSts*)(mmio->reg_base + REG_REGION_STS_OFS);
+	handler->reg_region_cal_cfg = (AxiGnrConvRegRgnCalCfg*)(mmio->reg_base + REG_REGION_CAL_CFG_OFS);
+	handler->reg_region_grp_conv_cfg = (AxiGnrConvRegRgnGrpConvCfg*)(mmio->reg_base + REG_REGION_GRP_CONV_CFG_OFS);
+	handler->reg_region_fmap_cfg = (AxiGnrConvRegRgnFmapCfg*)(mmio->reg_base + REG_REGION_FMAP_CFG_OFS);
+	handler->reg_region_ofmap_pitch_cfg = (AxiGnrConvRegRgnOfmapPitchCfg*)(mmio->reg_base + REG_REGION_OFMAP_PITCH_CFG_OFS);
+	handler->reg_region_ifmap_pitch_cfg = (AxiGnrConvRegRgnIfmapPitchCfg*)(mmio->reg_base + REG_REGION_IFMAP_PITCH_CFG_OFS);
+	handler->reg_region_kernal_cfg = (AxiGnrConvRegRgnKrnCfg*)(mmio->reg_base + REG_REGION_KRN_CFG_OFS);
+	handler->reg_region_buffer_cfg = (AxiGnrConvRegRgnBufCfg*)(mmio->reg_base + REG_REGION_BUF_CFG_OFS);
+	handler->reg_region_bn_act_cfg = (AxiGnrConvRegRgnBNActCfg*)(mmio->reg_base + REG_REGION_BN_ACT_CFG_OFS);
+	handler->reg_region_spa_cfg = (AxiGnrConvRegRgnSpaCfg*)(mmio->reg_base + REG_REGION_SPA_CFG_OFS);
+
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->acc_name) & 0x3FFFFFFF) != CONV_ACC_TYPE){
 		return -1;
 	}
 
-	handler->reg_base_ptr = (uint32_t*)baseaddr;
-	handler->reg_region_prop = (AxiGnrConvRegRgnProp*)(baseaddr + REG_REGION_PROP_OFS);
-	handler->reg_region_ctrl = (AxiGnrConvRegRgnCtrl*)(baseaddr + REG_REGION_CTRL_OFS);
-	handler->reg_region_sts = (AxiGnrConvRegRgnSts*)(baseaddr + REG_REGION_STS_OFS);
-	handler->reg_region_cal_cfg = (AxiGnrConvRegRgnCalCfg*)(baseaddr + REG_REGION_CAL_CFG_OFS);
-	handler->reg_region_grp_conv_cfg = (AxiGnrConvRegRgnGrpConvCfg*)(baseaddr + REG_REGION_GRP_CONV_CFG_OFS);
-	handler->reg_region_fmap_cfg = (AxiGnrConvRegRgnFmapCfg*)(baseaddr + REG_REGION_FMAP_CFG_OFS);
-	handler->reg_region_kernal_cfg = (AxiGnrConvRegRgnKrnCfg*)(baseaddr + REG_REGION_KRN_CFG_OFS);
-	handler->reg_region_buffer_cfg = (AxiGnrConvRegRgnBufCfg*)(baseaddr + REG_REGION_BUF_CFG_OFS);
-	handler->reg_region_bn_act_cfg = (AxiGnrConvRegRgnBNActCfg*)(baseaddr + REG_REGION_BN_ACT_CFG_OFS);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl5, 0x00000000);
 
-	handler->bn_params_mem = (BNParam*)(mem_base + MEM_REGION_BN_PARAMS_OFS);
-	handler->sigmoid_lut_mem = (uint16_t*)(mem_base + MEM_REGION_SIGMOID_LUT_OFS);
+	handler->bn_params_mem = (BNParam*)(mmio->mem_base + MEM_REGION_BN_PARAMS_OFS);
+	handler->sigmoid_lut_mem = (uint16_t*)(mmio->mem_base + MEM_REGION_SIGMOID_LUT_OFS);
 
-	uint32_t version_encoded = handler->reg_region_prop->version;
+	uint32_t version_encoded = axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->version);
 	handler->property.version[8] = '\0';
 	for(int i = 0;i < 8;i++){
 		handler->property.version[i] = '0' + (version_encoded & 0x0000000F);
 		version_encoded >>= 4;
 	}
 
-	uint32_t accelerator_type_encoded = handler->reg_region_prop->acc_name;
+	uint32_t accelerator_type_encoded = axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->acc_name);
 	handler->property.accelerator_type[6] = '\0';
 	for(int i = 0;i < 6;i++){
 		uint8_t now_c = (uint8_t)(accelerator_type_encoded & 0x0000001F);
@@ -94,115 +198,115 @@ int axi_generic_conv_init(AxiGnrConvHandler* handler, uint32_t baseaddr, uint32_
 
 	handler->property.accelerator_id = (uint8_t)(accelerator_type_encoded >> 30);
 
-	handler->property.atomic_k = (uint8_t)((handler->reg_region_prop->info0 & 0x000000FF) + 1);
-	handler->property.atomic_c = (uint8_t)(((handler->reg_region_prop->info0 >> 8) & 0x000000FF) + 1);
-	handler->property.bn_act_prl_n = (uint8_t)((handler->reg_region_prop->info4 & 0x000000FF) + 1);
-	handler->property.max_cal_round_n = (uint8_t)(((handler->reg_region_prop->info0 >> 16) & 0x000000FF) + 1);
-	handler->property.mm2s_stream_data_width = (uint16_t)((handler->reg_region_prop->info1 & 0x000000FF) + 1);
-	handler->property.s2mm_stream_data_width = (uint16_t)(((handler->reg_region_prop->info1 >> 8) & 0x000000FF) + 1);
-	handler->property.phy_buf_bank_n = (uint16_t)(((handler->reg_region_prop->info1 >> 16) & 0x0000FFFF) + 1);
-	handler->property.phy_buf_bank_depth = (uint16_t)((handler->reg_region_prop->info2 & 0x0000FFFF) + 1);
-	handler->property.max_fmbuf_row_n = (uint16_t)(((handler->reg_region_prop->info2 >> 16) & 0x0000FFFF) + 1);
-	handler->property.max_kernal_n = (uint16_t)(((handler->reg_region_prop->info4 >> 16) & 0x0000FFFF) + 1);
-	handler->property.mid_res_buf_bank_n = (uint8_t)((handler->reg_region_prop->info3 & 0x000000FF) + 1);
-	handler->property.mid_res_buf_bank_depth = (uint16_t)(((handler->reg_region_prop->info3 >> 16) & 0x0000FFFF) + 1);
-
-	handler->reg_region_cal_cfg->cal_cfg = (uint32_t)CONV_INT8;
-	if((handler->reg_region_cal_cfg->cal_cfg & 0x00000007) == CONV_INT8){
+	handler->property.atomic_k = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info0) & 0x000000FF) + 1);
+	handler->property.atomic_c = (uint8_t)(((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info0) >> 8) & 0x000000FF) + 1);
+	handler->property.bn_act_prl_n = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info4) & 0x000000FF) + 1);
+	handler->property.max_cal_round_n = (uint8_t)(((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info0) >> 16) & 0x000000FF) + 1);
+	handler->property.mm2s_stream_data_width = (uint16_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info1) & 0x000000FF) + 1);
+	handler->property.s2mm_stream_data_width = (uint16_t)(((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info1) >> 8) & 0x000000FF) + 1);
+	handler->property.phy_buf_bank_n = (uint16_t)(((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info1) >> 16) & 0x0000FFFF) + 1);
+	handler->property.phy_buf_bank_depth = (uint16_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info2) & 0x0000FFFF) + 1);
+	handler->property.max_fmbuf_row_n = (uint16_t)(((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info2) >> 16) & 0x0000FFFF) + 1);
+	handler->property.max_kernal_n = (uint16_t)(((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info4) >> 16) & 0x0000FFFF) + 1);
+	handler->property.mid_res_buf_bank_n = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info3) & 0x000000FF) + 1);
+	handler->property.mid_res_buf_bank_depth = (uint16_t)(((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info3) >> 16) & 0x0000FFFF) + 1);
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg, (uint32_t)CONV_INT8);
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg) & 0x00000007) == CONV_INT8){
 		handler->property.int8_supported = 1;
 	}else{
 		handler->property.int8_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg = (uint32_t)CONV_INT16;
-	if((handler->reg_region_cal_cfg->cal_cfg & 0x00000007) == CONV_INT16){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg, (uint32_t)CONV_INT16);
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg) & 0x00000007) == CONV_INT16){
 		handler->property.int16_supported = 1;
 	}else{
 		handler->property.int16_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg = (uint32_t)CONV_FP16;
-	if((handler->reg_region_cal_cfg->cal_cfg & 0x00000007) == CONV_FP16){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg, (uint32_t)CONV_FP16);
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg) & 0x00000007) == CONV_FP16){
 		handler->property.fp16_supported = 1;
 	}else{
 		handler->property.fp16_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg = (7 << 8);
-	if(((handler->reg_region_cal_cfg->cal_cfg >> 8) & 0x00000007) == 7){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg, (7 << 8));
+	if(((axi_generic_conv_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg) >> 8) & 0x00000007) == 7){
 		handler->property.large_v_stride_supported = 1;
 	}else{
 		handler->property.large_v_stride_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg = (7 << 11);
-	if(((handler->reg_region_cal_cfg->cal_cfg >> 11) & 0x00000007) == 7){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg, (7 << 11));
+	if(((axi_generic_conv_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg) >> 11) & 0x00000007) == 7){
 		handler->property.large_h_stride_supported = 1;
 	}else{
 		handler->property.large_h_stride_supported = 0;
 	}
 
-	handler->reg_region_grp_conv_cfg->grp_conv0 = 0x00000001;
-	if(handler->reg_region_grp_conv_cfg->grp_conv0 & 0x00000001){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_grp_conv_cfg->grp_conv0, 0x00000001);
+	if(axi_generic_conv_rd_reg(handler, &handler->reg_region_grp_conv_cfg->grp_conv0) & 0x00000001){
 		handler->property.group_conv_supported = 1;
 	}else{
 		handler->property.group_conv_supported = 0;
 	}
 
-	handler->reg_region_fmap_cfg->fmap_cfg4 = 7;
-	if((handler->reg_region_fmap_cfg->fmap_cfg4 & 0x00000007) == 7){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4, 7);
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4) & 0x00000007) == 7){
 		handler->property.ext_padding_supported = 1;
 	}else{
 		handler->property.ext_padding_supported = 0;
 	}
 
-	handler->reg_region_fmap_cfg->fmap_cfg4 = (7 << 6);
-	if(((handler->reg_region_fmap_cfg->fmap_cfg4 >> 6) & 0x00000007) == 7){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4, (7 << 6));
+	if(((axi_generic_conv_rd_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4) >> 6) & 0x00000007) == 7){
 		handler->property.inner_padding_supported = 1;
 	}else{
 		handler->property.inner_padding_supported = 0;
 	}
 
-	handler->reg_region_kernal_cfg->krn_cfg1 = (15 << 4);
-	if(((handler->reg_region_kernal_cfg->krn_cfg1 >> 4) & 0x0000000F) == 15){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_kernal_cfg->krn_cfg1, (15 << 4));
+	if(((axi_generic_conv_rd_reg(handler, &handler->reg_region_kernal_cfg->krn_cfg1) >> 4) & 0x0000000F) == 15){
 		handler->property.kernal_dilation_supported = 1;
 	}else{
 		handler->property.kernal_dilation_supported = 0;
 	}
 
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | 0x00000004;
-	if(handler->reg_region_ctrl->ctrl0 & 0x00000004){
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | 0x00000004);
+	if(axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0) & 0x00000004){
 		handler->property.performance_monitor_supported = 1;
 	}else{
 		handler->property.performance_monitor_supported = 0;
 	}
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0);
 
-	handler->reg_region_bn_act_cfg->bn_cfg = 0x00000001;
-	if(handler->reg_region_bn_act_cfg->bn_cfg & 0x00000001){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->bn_cfg, 0x00000001);
+	if(axi_generic_conv_rd_reg(handler, &handler->reg_region_bn_act_cfg->bn_cfg) & 0x00000001){
 		handler->property.bn_supported = 1;
 	}else{
 		handler->property.bn_supported = 0;
 	}
-	handler->reg_region_bn_act_cfg->bn_cfg = 0x00000000;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->bn_cfg, 0x00000000);
 
-	handler->reg_region_bn_act_cfg->act_cfg0 = (uint32_t)ACT_FUNC_LEAKY_RELU;
-	if((handler->reg_region_bn_act_cfg->act_cfg0 & 0x00000007) == ACT_FUNC_LEAKY_RELU){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->act_cfg0, (uint32_t)ACT_FUNC_LEAKY_RELU);
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_bn_act_cfg->act_cfg0) & 0x00000007) == ACT_FUNC_LEAKY_RELU){
 		handler->property.leaky_relu_supported = 1;
 	}else{
 		handler->property.leaky_relu_supported = 0;
 	}
 
-	handler->reg_region_bn_act_cfg->act_cfg0 = (uint32_t)ACT_FUNC_SIGMOID;
-	if((handler->reg_region_bn_act_cfg->act_cfg0 & 0x00000007) == ACT_FUNC_SIGMOID){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->act_cfg0, (uint32_t)ACT_FUNC_SIGMOID);
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_bn_act_cfg->act_cfg0) & 0x00000007) == ACT_FUNC_SIGMOID){
 		handler->property.sigmoid_supported = 1;
 	}else{
 		handler->property.sigmoid_supported = 0;
 	}
 
-	handler->reg_region_bn_act_cfg->act_cfg0 = (uint32_t)ACT_FUNC_TANH;
-	if((handler->reg_region_bn_act_cfg->act_cfg0 & 0x00000007) == ACT_FUNC_TANH){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->act_cfg0, (uint32_t)ACT_FUNC_TANH);
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_bn_act_cfg->act_cfg0) & 0x00000007) == ACT_FUNC_TANH){
 		handler->property.tanh_supported = 1;
 	}else{
 		handler->property.tanh_supported = 0;
@@ -210,11 +314,42 @@ int axi_generic_conv_init(AxiGnrConvHandler* handler, uint32_t baseaddr, uint32_
 
 	axi_generic_conv_disable_cal_sub_sys(handler);
 
-	handler->property.mid_res_buf_clk_rate = (uint8_t)(handler->reg_region_prop->info5 & 0x0000000F);
+	handler->property.mid_res_buf_clk_rate = (uint8_t)(axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) & 0x0000000F);
+	handler->property.layer_desc_supported = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) >> 8) & 0x00000001);
+	handler->property.fused_max_pool_supported = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) >> 9) & 0x00000001);
+	handler->property.fused_max_pool_buf_depth = (axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) >> 16) + 1;
+	handler->property.residual_add_supported = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) >> 10) & 0x00000001);
+	handler->property.ofmap_pitch_supported = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) >> 11) & 0x00000001);
+	handler->property.ifmap_pitch_supported = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) >> 12) & 0x00000001);
+	handler->property.int8_requant_supported = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) >> 13) & 0x00000001);
+	handler->property.zero_cgrp_skip_supported = (uint8_t)((axi_generic_conv_rd_reg(handler, &handler->reg_region_prop->info5) >> 14) & 0x00000001);
+
+	handler->done_threshold = 0;
+	handler->wait_hook = NULL;
+	handler->wait_hook_arg = NULL;
+
+	axi_generic_conv_disable_irq(handler);
+	axi_generic_conv_clr_irq(handler);
 
 	return 0;
 }
 
+/*************************
+@cfg
+@public
+@brief  把主机指针转换为加速器DMA使用的总线地址
+@param  handler 通用卷积处理单元(加速器句柄)
+        ptr 主机指针
+@return 总线地址
+*************************/
+uint32_t axi_generic_conv_bus_addr(AxiGnrConvHandler* handler, const void* ptr){
+	if(handler->mmio.bus_addr == NULL){
+		return (uint32_t)((uintptr_t)ptr);
+	}else{
+		return handler->mmio.bus_addr(handler->mmio.bus_addr_arg, ptr);
+	}
+}
+
 /*************************
 @ctrl
 @public
@@ -223,9 +358,9 @@ int axi_generic_conv_init(AxiGnrConvHandler* handler, uint32_t baseaddr, uint32_
 @return 是否成功
 *************************/
 int axi_generic_conv_enable(AxiGnrConvHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | 0x00000001;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | 0x00000001);
 
 	return 0;
 }
@@ -238,9 +373,9 @@ int axi_generic_conv_enable(AxiGnrConvHandler* handler){
 @return none
 *************************/
 void axi_generic_conv_disable(AxiGnrConvHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~0x00000001);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~0x00000001));
 }
 
 /*************************
@@ -251,9 +386,9 @@ void axi_generic_conv_disable(AxiGnrConvHandler* handler){
 @return 是否成功
 *************************/
 int axi_generic_conv_enable_cal_sub_sys(AxiGnrConvHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | 0x00000002;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | 0x00000002);
 
 	return 0;
 }
@@ -266,9 +401,9 @@ int axi_generic_conv_enable_cal_sub_sys(AxiGnrConvHandler* handler){
 @return none
 *************************/
 void axi_generic_conv_disable_cal_sub_sys(AxiGnrConvHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~0x00000002);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~0x00000002));
 }
 
 /*************************
@@ -283,9 +418,9 @@ int axi_generic_conv_enable_pm_cnt(AxiGnrConvHandler* handler){
 		return -1;
 	}
 
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | 0x00000004;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | 0x00000004);
 
 	return 0;
 }
@@ -298,9 +433,9 @@ int axi_generic_conv_enable_pm_cnt(AxiGnrConvHandler* handler){
 @return none
 *************************/
 void axi_generic_conv_disable_pm_cnt(AxiGnrConvHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~0x00000004);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~0x00000004));
 }
 
 /*************************
@@ -311,9 +446,9 @@ void axi_generic_conv_disable_pm_cnt(AxiGnrConvHandler* handler){
 @return 是否成功
 *************************/
 int axi_generic_conv_enable_bn_act_proc(AxiGnrConvHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | 0x00000008;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | 0x00000008);
 
 	return 0;
 }
@@ -326,9 +461,9 @@ int axi_generic_conv_enable_bn_act_proc(AxiGnrConvHandler* handler){
 @return none
 *************************/
 void axi_generic_conv_disable_bn_act_proc(AxiGnrConvHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~0x00000008);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~0x00000008));
 }
 
 /*************************
@@ -339,7 +474,7 @@ void axi_generic_conv_disable_bn_act_proc(AxiGnrConvHandler* handler){
 @return 是否成功
 *************************/
 int axi_generic_conv_start(AxiGnrConvHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
 	if(!(pre_ctrl0 & 0x00000002)){
 		return -1;
@@ -349,7 +484,7 @@ int axi_generic_conv_start(AxiGnrConvHandler* handler){
 		return -2;
 	}
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | 0x00000700;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | 0x00000700);
 
 	return 0;
 }
@@ -363,7 +498,7 @@ int axi_generic_conv_start(AxiGnrConvHandler* handler){
 *************************/
 uint8_t axi_generic_conv_is_busy(AxiGnrConvHandler* handler){
 	// 注意: 仅仅检查"请求生成单元是否空闲"是不够的!
-	if((handler->reg_region_sts->sts0 & 0x00000007) != 0x00000007){
+	if((axi_generic_conv_rd_reg(handler, &handler->reg_region_sts->sts0) & 0x00000007) != 0x00000007){
 		return 1;
 	}
 
@@ -383,6 +518,159 @@ int axi_generic_conv_cfg(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
 		return -1;
 	}
 
+	AxiGnrConvLayerDesc desc;
+
+	if(axi_generic_conv_cal_cfg_regs(handler, cfg, &desc)){
+		return -2;
+	}
+
+	axi_generic_conv_wr_cfg_regs(handler, cfg, &desc);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  配置下一层(写影子配置寄存器)
+        可在通用卷积处理单元忙碌时调用, 配置会在下一次启动时被提交
+        注意: ctrl0中的使能位与BN参数存储器不属于影子配置寄存器, 须在启动前另行设置
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_cfg_next(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
+	if(handler->property.layer_desc_supported && axi_generic_conv_is_layer_desc_chain_busy(handler)){
+		return -1;
+	}
+
+	AxiGnrConvLayerDesc desc;
+
+	if(axi_generic_conv_cal_cfg_regs(handler, cfg, &desc)){
+		return -2;
+	}
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl5, 0x00000001);
+	axi_generic_conv_wr_cfg_regs(handler, cfg, &desc);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl5, 0x00000000);
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  提交下一层的配置并启动通用卷积处理单元
+        待提交的影子配置寄存器会在启动的同时被提交到配置寄存器
+@param  handler 通用卷积处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_commit_and_start(AxiGnrConvHandler* handler){
+	if(handler->property.layer_desc_supported && axi_generic_conv_is_layer_desc_chain_busy(handler)){
+		return -2;
+	}
+
+	return axi_generic_conv_start(handler);
+}
+
+/*************************
+@sts
+@public
+@brief  判断是否存在待提交的下一层配置
+@param  handler 通用卷积处理单元(加速器句柄)
+@return 是否存在待提交的配置
+*************************/
+uint8_t axi_generic_conv_is_next_cfg_pending(AxiGnrConvHandler* handler){
+	return (axi_generic_conv_rd_reg(handler, &handler->reg_region_ctrl->ctrl5) & 0x00000002) ? 0x01:0x00;
+}
+
+/*************************
+@cfg
+@private
+@brief  写配置寄存器
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+        desc 层描述符(句柄), 提供各配置寄存器的值
+@return none
+*************************/
+static void axi_generic_conv_wr_cfg_regs(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, const AxiGnrConvLayerDesc* desc){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg, desc->cal_cfg.cal_cfg);
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_grp_conv_cfg->grp_conv0, desc->grp_conv_cfg.grp_conv0);
+
+	if(cfg->group_n > 1){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_grp_conv_cfg->grp_conv1, desc->grp_conv_cfg.grp_conv1);
+	}
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg0, desc->fmap_cfg.fmap_cfg0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg1, desc->fmap_cfg.fmap_cfg1);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg2, desc->fmap_cfg.fmap_cfg2);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg3, desc->fmap_cfg.fmap_cfg3);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4, desc->fmap_cfg.fmap_cfg4);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg5, desc->fmap_cfg.fmap_cfg5);
+
+	if(handler->property.ofmap_pitch_supported){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_ofmap_pitch_cfg->fmap_cfg6, desc->ofmap_pitch_cfg.fmap_cfg6);
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_ofmap_pitch_cfg->fmap_cfg7, desc->ofmap_pitch_cfg.fmap_cfg7);
+	}
+
+	if(handler->property.ifmap_pitch_supported){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_ifmap_pitch_cfg->fmap_cfg8, desc->ifmap_pitch_cfg.fmap_cfg8);
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_ifmap_pitch_cfg->fmap_cfg9, desc->ifmap_pitch_cfg.fmap_cfg9);
+	}
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_kernal_cfg->krn_cfg0, desc->kernal_cfg.krn_cfg0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_kernal_cfg->krn_cfg1, desc->kernal_cfg.krn_cfg1);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_kernal_cfg->krn_cfg2, desc->kernal_cfg.krn_cfg2);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_kernal_cfg->krn_cfg3, desc->kernal_cfg.krn_cfg3);
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_buffer_cfg->buf_cfg0, desc->buffer_cfg.buf_cfg0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_buffer_cfg->buf_cfg1, desc->buffer_cfg.buf_cfg1);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_buffer_cfg->buf_cfg2, desc->buffer_cfg.buf_cfg2);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_buffer_cfg->buf_cfg3, desc->buffer_cfg.buf_cfg3);
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->bn_cfg, desc->bn_act_cfg.bn_cfg);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->act_cfg0, desc->bn_act_cfg.act_cfg0);
+
+	if(cfg->bn_act_cfg.act_func_type == ACT_FUNC_LEAKY_RELU){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->act_cfg1, desc->bn_act_cfg.act_cfg1);
+	}
+
+	if(handler->property.residual_add_supported){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->res_cfg0, desc->bn_act_cfg.res_cfg0);
+
+		if(cfg->bn_act_cfg.en_residual_add){
+			axi_generic_conv_wr_reg(handler, &handler->reg_region_bn_act_cfg->res_cfg1, desc->bn_act_cfg.res_cfg1);
+		}
+	}
+
+	if(handler->property.zero_cgrp_skip_supported){
+		if(cfg->zero_cgrp_map != NULL){
+			uint32_t cgrpn = (desc->kernal_cfg.krn_cfg1 >> 16) + 1;
+			uint32_t map_cgrpn = (cgrpn > ZERO_CGRP_MAP_LEN) ? ZERO_CGRP_MAP_LEN:cgrpn;
+
+			for(uint32_t i = 0;i < (map_cgrpn + 31) / 32;i++){
+				axi_generic_conv_wr_reg(handler, &handler->reg_region_spa_cfg->zero_cgrp_map[i], cfg->zero_cgrp_map[i]);
+			}
+
+			axi_generic_conv_wr_reg(handler, &handler->reg_region_spa_cfg->spa_cfg0,
+				0x00000001 | ((axi_generic_conv_cal_vld_cgrpn(cfg, cgrpn) - 1) << 16));
+		}else{
+			axi_generic_conv_wr_reg(handler, &handler->reg_region_spa_cfg->spa_cfg0, 0x00000000);
+		}
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  检查配置参数并计算各配置寄存器的值
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+        desc 层描述符(句柄), 计算结果写入其配置寄存器字段
+@return 是否成功
+*************************/
+static int axi_generic_conv_cal_cfg_regs(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, AxiGnrConvLayerDesc* desc){
 	if(cfg->bn_act_cfg.use_bn_unit && (!handler->property.bn_supported)){
 		return -2;
 	}
@@ -422,6 +710,11 @@ int axi_generic_conv_cfg(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
 		return -2;
 	}
 
+	// INT8时每对通道共用1个16位数据, 而组卷积要求每组的通道数与核数相同, 故不支持组卷积
+	if(cfg->cal_cfg.cal_fmt == CONV_INT8 && cfg->group_n > 1){
+		return -2;
+	}
+
 	if(cfg->fmap_cfg.external_padding_left > 7 || (cfg->fmap_cfg.external_padding_left > 0 && (!handler->property.ext_padding_supported))){
 		return -2;
 	}
@@ -477,35 +770,41 @@ int axi_generic_conv_cfg(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
 		return -2;
 	}
 
+	if(
+		(cfg->cal_cfg.cal_fmt == CONV_INT8 || cfg->cal_cfg.cal_fmt == CONV_INT16) &&
+		(cfg->bn_act_cfg.out_fixed_point_quat_accrc >= 16)
+	){
+		return -2;
+	}
+
 	if(cfg->kernal_cfg.kernal_n > handler->property.max_kernal_n){
 		return -2;
 	}
 
 	uint32_t ifmap_size = cfg->fmap_cfg.ifmap_width * cfg->fmap_cfg.ifmap_height;
-	uint32_t n_foreach_group = cfg->fmap_cfg.ifmap_chn_n / cfg->group_n;
-	uint32_t data_size_foreach_group = ifmap_size * n_foreach_group * (cfg->cal_cfg.cal_fmt == CONV_INT8 ? 1:2);
+	uint32_t hw_chn_n = axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->fmap_cfg.ifmap_chn_n);
+	uint32_t n_foreach_group = hw_chn_n / cfg->group_n;
+	uint32_t data_size_foreach_group = ifmap_size * n_foreach_group * 2;
 	uint32_t fmap_ext_i_bottom =
 		((uint32_t)cfg->fmap_cfg.ifmap_height) + ((uint32_t)cfg->fmap_cfg.external_padding_top) +
 		((uint32_t)(cfg->fmap_cfg.ifmap_height - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom) - 1;
 
-	uint32_t kernal_len;
-
-	switch(cfg->kernal_cfg.kernal_shape){
-	case CONV_KRN_1x1: kernal_len = 1;break;
-	case CONV_KRN_3x3: kernal_len = 3;break;
-	case CONV_KRN_5x5: kernal_len = 5;break;
-	case CONV_KRN_7x7: kernal_len = 7;break;
-	case CONV_KRN_9x9: kernal_len = 9;break;
-	case CONV_KRN_11x11: kernal_len = 11;break;
-	case CONV_KRN_4x4: kernal_len = 4;break;
-	case CONV_KRN_2x2: kernal_len = 2;break;
-	}
+	uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
 
 	uint32_t dilated_kernal_len = kernal_len + (kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
-	uint32_t c_foreach_set = (cfg->group_n > 1) ? n_foreach_group:cfg->kernal_cfg.kernal_chn_n;
+	uint32_t c_foreach_set = (cfg->group_n > 1) ? n_foreach_group:hw_chn_n;
 	uint32_t cgrpn_foreach_kernal_set =
 		(c_foreach_set / handler->property.atomic_c) +
 		(c_foreach_set % handler->property.atomic_c ? 1:0);
+	// 零通道组跳过不支持组卷积, 且须至少保留1个非零通道组(非零通道组数 - 1的字段为10位)
+	if(cfg->zero_cgrp_map != NULL){
+		uint32_t vld_cgrpn = axi_generic_conv_cal_vld_cgrpn(cfg, cgrpn_foreach_kernal_set);
+
+		if((!handler->property.zero_cgrp_skip_supported) || cfg->group_n > 1 || vld_cgrpn == 0 || vld_cgrpn > 1024){
+			return -2;
+		}
+	}
+
 	uint32_t kernal_set_n =
 		(cfg->group_n > 1) ?
 			cfg->group_n:
@@ -522,44 +821,9 @@ int axi_generic_conv_cfg(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
 	uint32_t ofmap_width;
 	uint32_t ofmap_height;
 
-	uint32_t fmbufrown = ((uint32_t)cfg->buffer_cfg.fmbufbankn) * ((uint32_t)handler->property.phy_buf_bank_depth);
-
-	switch(cfg->buffer_cfg.fmbufcoln){
-	case CONV_COLN_4: fmbufrown >>= 2;break;
-	case CONV_COLN_8: fmbufrown >>= 3;break;
-	case CONV_COLN_16: fmbufrown >>= 4;break;
-	case CONV_COLN_32: fmbufrown >>= 5;break;
-	case CONV_COLN_64: fmbufrown >>= 6;break;
-	case CONV_COLN_128: fmbufrown >>= 7;break;
-	case CONV_COLN_256: fmbufrown >>= 8;break;
-	case CONV_COLN_512: fmbufrown >>= 9;break;
-	case CONV_COLN_1024: fmbufrown >>= 10;break;
-	case CONV_COLN_2048: fmbufrown >>= 11;break;
-	case CONV_COLN_4096: fmbufrown >>= 12;break;
-	}
-
-	if(fmbufrown > handler->property.max_fmbuf_row_n){
-		fmbufrown = handler->property.max_fmbuf_row_n;
-	}
-
+	uint32_t fmbufrown = axi_generic_conv_cal_fmbufrown(&handler->property, cfg->buffer_cfg.fmbufbankn, cfg->buffer_cfg.fmbufcoln);
 	uint32_t kbufgrpn =
-		((uint32_t)(handler->property.phy_buf_bank_n - cfg->buffer_cfg.fmbufbankn)) * ((uint32_t)handler->property.phy_buf_bank_depth) /
-		(kernal_len * kernal_len);
-
-	switch(cfg->buffer_cfg.sfc_n_each_wgtblk){
-	case CONV_WGTBLK_SFC_N_1: break;
-	case CONV_WGTBLK_SFC_N_2: kbufgrpn >>= 1;break;
-	case CONV_WGTBLK_SFC_N_4: kbufgrpn >>= 2;break;
-	case CONV_WGTBLK_SFC_N_8: kbufgrpn >>= 3;break;
-	case CONV_WGTBLK_SFC_N_16: kbufgrpn >>= 4;break;
-	case CONV_WGTBLK_SFC_N_32: kbufgrpn >>= 5;break;
-	case CONV_WGTBLK_SFC_N_64: kbufgrpn >>= 6;break;
-	case CONV_WGTBLK_SFC_N_128: kbufgrpn >>= 7;break;
-	}
-
-	if(kbufgrpn > 256){
-		kbufgrpn = 256;
-	}
+		axi_generic_conv_cal_kbufgrpn(&handler->property, cfg->buffer_cfg.fmbufbankn, kernal_len, cfg->buffer_cfg.sfc_n_each_wgtblk);
 
 	if((ext_fmap_w - dilated_kernal_len) % cfg->cal_cfg.conv_horizontal_stride){
 		return -2;
@@ -574,71 +838,165 @@ int axi_generic_conv_cfg(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
 	}
 
 	uint32_t mid_res_item_n_foreach_row = ((uint32_t)cfg->cal_cfg.cal_round_n) * ofmap_width;
-	uint32_t bank_n_foreach_mid_res_row =
-		(mid_res_item_n_foreach_row * ((uint32_t)handler->property.mid_res_buf_clk_rate)) / handler->property.mid_res_buf_bank_depth +
-		((mid_res_item_n_foreach_row * ((uint32_t)handler->property.mid_res_buf_clk_rate)) % handler->property.mid_res_buf_bank_depth ? 1:0);
-	uint32_t mid_res_buf_row_n_bufferable = handler->property.mid_res_buf_bank_n / bank_n_foreach_mid_res_row;
+	uint32_t mid_res_buf_row_n_bufferable = axi_generic_conv_cal_mid_res_buf_row_n(&handler->property, mid_res_item_n_foreach_row);
 
 	if(mid_res_buf_row_n_bufferable == 0){
 		return -2;
 	}
 
-	if(mid_res_buf_row_n_bufferable > 16){
-		mid_res_buf_row_n_bufferable = 16;
+	// 融合2x2最大池化的行缓存须存下1个表面行的全部子表面行(每个子表面行有ATOMIC_K个通道)的水平池化结果
+	if(cfg->fmap_cfg.en_fused_max_pool){
+		uint32_t set_w = (cfg->group_n > 1) ? n_foreach_group:((uint32_t)cfg->max_wgtblk_w);
+		uint32_t sub_row_n = (set_w / handler->property.atomic_k) + (set_w % handler->property.atomic_k ? 1:0);
+
+		if((!handler->property.fused_max_pool_supported) || ofmap_width < 2 || ofmap_height < 2 ||
+			(sub_row_n * (ofmap_width / 2)) > handler->property.fused_max_pool_buf_depth){
+			return -2;
+		}
+	}
+
+	// 融合残差相加按完整的子表面行(ATOMIC_K个通道)取残差, 且不能与融合2x2最大池化同时使能
+	if(cfg->bn_act_cfg.en_residual_add){
+		uint32_t set_w = (cfg->group_n > 1) ? n_foreach_group:((uint32_t)cfg->max_wgtblk_w);
+
+		if((!handler->property.residual_add_supported) || cfg->fmap_cfg.en_fused_max_pool ||
+			(cfg->kernal_cfg.kernal_n % handler->property.atomic_k) || (set_w % handler->property.atomic_k) ||
+			(cfg->cal_cfg.cal_fmt == CONV_FP16 && cfg->fmap_cfg.ofmap_data_type == CONV_O_1_BYTE) ||
+			cfg->bn_act_cfg.residual_scale_exp < -32 || cfg->bn_act_cfg.residual_scale_exp > 31){
+			return -2;
+		}
+	}
+
+	// INT8逐通道重量化占用BN参数, 且输出为带零点的s8, 故不能再叠加激活函数、参数A/B的简化标志和残差相加
+	// 输出的s8按通道对合并(1字节输出特征图), 需要偶数的核并行数; 1字节输出特征图仅用于重量化的输出
+	if(cfg->bn_act_cfg.en_int8_requant){
+		if((!handler->property.int8_requant_supported) || cfg->cal_cfg.cal_fmt != CONV_INT8 ||
+			(!cfg->bn_act_cfg.use_bn_unit) || cfg->bn_act_cfg.act_func_type != ACT_FUNC_NONE ||
+			cfg->bn_act_cfg.bn_is_a_eq_1 || cfg->bn_act_cfg.bn_is_b_eq_0 || cfg->bn_act_cfg.en_residual_add ||
+			cfg->fmap_cfg.ofmap_data_type != CONV_O_1_BYTE || (handler->property.atomic_k % 2)){
+			return -2;
+		}
+	}else if(cfg->fmap_cfg.ofmap_data_type == CONV_O_1_BYTE){
+		return -2;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg =
+	// 输出特征图跨距: 通道偏移折算到输出特征图基地址, 跨距为0时按紧密存储写出
+	uint32_t ofmap_row_pitch = 0;
+	uint32_t ofmap_cgrp_pitch = 0;
+	uint32_t ofmap_chn_ofs_byte_n = 0;
+
+	if(cfg->fmap_cfg.ofmap_chn_ofs || cfg->fmap_cfg.ofmap_row_pitch || cfg->fmap_cfg.ofmap_cgrp_pitch){
+		uint32_t set_w = (cfg->group_n > 1) ? n_foreach_group:((uint32_t)cfg->max_wgtblk_w);
+		uint32_t wt_ofmap_w = cfg->fmap_cfg.en_fused_max_pool ? (ofmap_width / 2):ofmap_width;
+		uint32_t wt_ofmap_h = cfg->fmap_cfg.en_fused_max_pool ? (ofmap_height / 2):ofmap_height;
+		uint32_t dense_row_pitch =
+			wt_ofmap_w * axi_generic_conv_get_ofmap_pt_byte_n(cfg->fmap_cfg.ofmap_data_type, handler->property.atomic_k);
+
+		ofmap_row_pitch = cfg->fmap_cfg.ofmap_row_pitch ? cfg->fmap_cfg.ofmap_row_pitch:dense_row_pitch;
+		ofmap_cgrp_pitch = cfg->fmap_cfg.ofmap_cgrp_pitch ? cfg->fmap_cfg.ofmap_cgrp_pitch:(ofmap_row_pitch * wt_ofmap_h);
+
+		if((!handler->property.ofmap_pitch_supported) ||
+			(cfg->fmap_cfg.ofmap_chn_ofs % handler->property.atomic_k) || (set_w % handler->property.atomic_k) ||
+			ofmap_row_pitch < dense_row_pitch || ofmap_row_pitch > 0x00FFFFFF ||
+			(((uint64_t)ofmap_cgrp_pitch) < ((uint64_t)ofmap_row_pitch) * wt_ofmap_h)){
+			return -2;
+		}
+
+		ofmap_chn_ofs_byte_n = ((uint32_t)(cfg->fmap_cfg.ofmap_chn_ofs / handler->property.atomic_k)) * ofmap_cgrp_pitch;
+	}
+
+	// 输入特征图跨距: 起始通道组折算到输入特征图基地址, 组卷积时每组的数据量按通道组跨距计算
+	uint32_t ifmap_row_pitch = 0;
+	uint32_t ifmap_cgrp_pitch = 0;
+	uint32_t ifmap_cgrp_ofs_byte_n = 0;
+
+	if(cfg->fmap_cfg.ifmap_start_cgrp || cfg->fmap_cfg.ifmap_row_pitch || cfg->fmap_cfg.ifmap_cgrp_pitch){
+		uint32_t dense_row_pitch = ((uint32_t)cfg->fmap_cfg.ifmap_width) * ((uint32_t)handler->property.atomic_c) * 2;
+
+		ifmap_row_pitch = cfg->fmap_cfg.ifmap_row_pitch ? cfg->fmap_cfg.ifmap_row_pitch:dense_row_pitch;
+		ifmap_cgrp_pitch =
+			cfg->fmap_cfg.ifmap_cgrp_pitch ?
+				cfg->fmap_cfg.ifmap_cgrp_pitch:
+				(ifmap_row_pitch * ((uint32_t)cfg->fmap_cfg.ifmap_height));
+
+		if((!handler->property.ifmap_pitch_supported) ||
+			(n_foreach_group % handler->property.atomic_c) ||
+			ifmap_row_pitch < dense_row_pitch || ifmap_row_pitch > 0x00FFFFFF ||
+			(((uint64_t)ifmap_cgrp_pitch) < ((uint64_t)ifmap_row_pitch) * cfg->fmap_cfg.ifmap_height) ||
+			(((uint64_t)(n_foreach_group / handler->property.atomic_c)) * ifmap_cgrp_pitch > 0x7FFFFFFF)){
+			return -2;
+		}
+
+		ifmap_cgrp_ofs_byte_n = ((uint32_t)cfg->fmap_cfg.ifmap_start_cgrp) * ifmap_cgrp_pitch;
+		data_size_foreach_group = (n_foreach_group / handler->property.atomic_c) * ifmap_cgrp_pitch;
+	}
+
+	desc->cal_cfg.cal_cfg =
 		((uint32_t)cfg->cal_cfg.cal_fmt) |
 		(((uint32_t)(cfg->cal_cfg.conv_vertical_stride - 1)) << 8) |
 		(((uint32_t)(cfg->cal_cfg.conv_horizontal_stride - 1)) << 11) |
 		(((uint32_t)(cfg->cal_cfg.cal_round_n - 1)) << 16);
 
-	handler->reg_region_grp_conv_cfg->grp_conv0 = (cfg->group_n > 1 ? 0x00000001:0x00000000) | (data_size_foreach_group << 1);
+	desc->grp_conv_cfg.grp_conv0 = (cfg->group_n > 1 ? 0x00000001:0x00000000) | (data_size_foreach_group << 1);
 
-	if(cfg->group_n > 1){
-		handler->reg_region_grp_conv_cfg->grp_conv1 = (n_foreach_group - 1) | (((uint32_t)cfg->group_n - 1) << 16);
-	}
+	desc->grp_conv_cfg.grp_conv1 = (n_foreach_group - 1) | (((uint32_t)cfg->group_n - 1) << 16);
 
-	handler->reg_region_fmap_cfg->fmap_cfg0 = (uint32_t)cfg->ifmap_baseaddr;
-	handler->reg_region_fmap_cfg->fmap_cfg1 = (uint32_t)cfg->ofmap_baseaddr;
-	handler->reg_region_fmap_cfg->fmap_cfg2 = ((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) | (((uint32_t)(cfg->fmap_cfg.ifmap_chn_n - 1)) << 16);
-	handler->reg_region_fmap_cfg->fmap_cfg3 = ifmap_size - 1;
-	handler->reg_region_fmap_cfg->fmap_cfg4 =
+	desc->fmap_cfg.fmap_cfg0 = axi_generic_conv_bus_addr(handler, cfg->ifmap_baseaddr) + ifmap_cgrp_ofs_byte_n;
+	desc->fmap_cfg.fmap_cfg1 = axi_generic_conv_bus_addr(handler, cfg->ofmap_baseaddr) + ofmap_chn_ofs_byte_n;
+	desc->fmap_cfg.fmap_cfg2 = ((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) | ((hw_chn_n - 1) << 16);
+	desc->fmap_cfg.fmap_cfg3 = ifmap_size - 1;
+	desc->fmap_cfg.fmap_cfg4 =
 		((uint32_t)cfg->fmap_cfg.external_padding_left) |
 		(((uint32_t)cfg->fmap_cfg.external_padding_top) << 3) |
 		(((uint32_t)cfg->fmap_cfg.inner_padding_left_right) << 6) |
 		(((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom) << 9) |
+		(cfg->fmap_cfg.en_fused_max_pool ? 0x00001000:0x00000000) |
 		(fmap_ext_i_bottom << 16);
-	handler->reg_region_fmap_cfg->fmap_cfg5 = ((uint32_t)cfg->fmap_cfg.ofmap_data_type) | ((ofmap_width - 1) << 2) | ((ofmap_height - 1) << 17);
+	desc->fmap_cfg.fmap_cfg5 = ((uint32_t)cfg->fmap_cfg.ofmap_data_type) | ((ofmap_width - 1) << 2) | ((ofmap_height - 1) << 17);
 
-	handler->reg_region_kernal_cfg->krn_cfg0 = (uint32_t)cfg->kernal_wgt_baseaddr;
-	handler->reg_region_kernal_cfg->krn_cfg1 =
+	desc->kernal_cfg.krn_cfg0 = axi_generic_conv_bus_addr(handler, cfg->kernal_wgt_baseaddr);
+	desc->kernal_cfg.krn_cfg1 =
 		((uint32_t)cfg->kernal_cfg.kernal_shape) |
 		(((uint32_t)cfg->kernal_cfg.dilation_n) << 4) |
 		((dilated_kernal_len - 1) << 8) |
 		((cgrpn_foreach_kernal_set - 1) << 16);
-	handler->reg_region_kernal_cfg->krn_cfg2 = ((uint32_t)(cfg->kernal_cfg.kernal_n - 1)) | ((kernal_set_n - 1) << 16);
-	handler->reg_region_kernal_cfg->krn_cfg3 = cfg->max_wgtblk_w;
+	desc->kernal_cfg.krn_cfg2 = ((uint32_t)(cfg->kernal_cfg.kernal_n - 1)) | ((kernal_set_n - 1) << 16);
+	desc->kernal_cfg.krn_cfg3 = cfg->max_wgtblk_w;
 
-	handler->reg_region_buffer_cfg->buf_cfg0 = (uint32_t)cfg->buffer_cfg.fmbufbankn;
-	handler->reg_region_buffer_cfg->buf_cfg1 = ((uint32_t)cfg->buffer_cfg.fmbufcoln) | ((fmbufrown - 1) << 16);
-	handler->reg_region_buffer_cfg->buf_cfg2 = ((uint32_t)cfg->buffer_cfg.sfc_n_each_wgtblk) | ((kbufgrpn - 1) << 8);
-	handler->reg_region_buffer_cfg->buf_cfg3 = (mid_res_item_n_foreach_row - 1) | ((mid_res_buf_row_n_bufferable - 1) << 16);
+	desc->buffer_cfg.buf_cfg0 = (uint32_t)cfg->buffer_cfg.fmbufbankn;
+	desc->buffer_cfg.buf_cfg1 = ((uint32_t)cfg->buffer_cfg.fmbufcoln) | ((fmbufrown - 1) << 16);
+	desc->buffer_cfg.buf_cfg2 = ((uint32_t)cfg->buffer_cfg.sfc_n_each_wgtblk) | ((kbufgrpn - 1) << 8);
+	desc->buffer_cfg.buf_cfg3 = (mid_res_item_n_foreach_row - 1) | ((mid_res_buf_row_n_bufferable - 1) << 16);
 
-	handler->reg_region_bn_act_cfg->bn_cfg =
+	desc->bn_act_cfg.bn_cfg =
 		((uint32_t)cfg->bn_act_cfg.use_bn_unit) |
 		(((uint32_t)cfg->bn_act_cfg.bn_fixed_point_quat_accrc) << 8) |
 		(((uint32_t)cfg->bn_act_cfg.bn_is_a_eq_1) << 16) |
-		(((uint32_t)cfg->bn_act_cfg.bn_is_b_eq_0) << 17);
+		(((uint32_t)cfg->bn_act_cfg.bn_is_b_eq_0) << 17) |
+		(((uint32_t)cfg->bn_act_cfg.en_int8_requant) << 18) |
+		((cfg->cal_cfg.cal_fmt == CONV_FP16) ? 0x00000000:((((uint32_t)cfg->bn_act_cfg.out_fixed_point_quat_accrc) & 0x0000000F) << 24));
 
-	handler->reg_region_bn_act_cfg->act_cfg0 =
+	desc->bn_act_cfg.act_cfg0 =
 		((uint32_t)cfg->bn_act_cfg.act_func_type) |
 		(((uint32_t)cfg->bn_act_cfg.leaky_relu_point_quat_accrc) << 8) |
 		(((uint32_t)cfg->bn_act_cfg.sigmoid_point_quat_accrc) << 16);
 
-	if(cfg->bn_act_cfg.act_func_type == ACT_FUNC_LEAKY_RELU){
-		handler->reg_region_bn_act_cfg->act_cfg1 = (*((uint32_t*)(&cfg->bn_act_cfg.leaky_relu_param_alpha)));
-	}
+	memcpy((void*)&desc->bn_act_cfg.act_cfg1, (const void*)&cfg->bn_act_cfg.leaky_relu_param_alpha, 4);
+
+	desc->bn_act_cfg.res_cfg0 =
+		(cfg->bn_act_cfg.en_residual_add ? 0x00000001:0x00000000) |
+		(cfg->bn_act_cfg.residual_relu ? 0x00000002:0x00000000) |
+		((((uint32_t)cfg->bn_act_cfg.residual_scale_exp) & 0x0000003F) << 8);
+	desc->bn_act_cfg.res_cfg1 =
+		cfg->bn_act_cfg.en_residual_add ?
+			axi_generic_conv_bus_addr(handler, cfg->bn_act_cfg.residual_baseaddr):
+			0x00000000;
+
+	desc->ofmap_pitch_cfg.fmap_cfg6 = ofmap_row_pitch;
+	desc->ofmap_pitch_cfg.fmap_cfg7 = ofmap_cgrp_pitch;
+
+	desc->ifmap_pitch_cfg.fmap_cfg8 = ifmap_row_pitch;
+	desc->ifmap_pitch_cfg.fmap_cfg9 = ifmap_cgrp_pitch;
 
 	return 0;
 }
@@ -646,78 +1004,625 @@ int axi_generic_conv_cfg(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
 /*************************
 @cfg
 @public
-@brief  写BN参数存储器
-@param  handler 通用卷积处理单元(加速器句柄)
-        bn_param_buf BN参数缓存区(指针)
-        num 参数总量
-@return none
+@brief  规划缓存划分
+        给定除缓存配置以外的卷积层参数, 枚举特征图/卷积核缓存的Bank划分、表面行长度、权重块宽度与计算轮次,
+        选择预计DDR访问字节数最少的方案, 并将其写回配置参数的缓存配置、权重块最大宽度与计算轮次字段
+        预计访问量按照卷积计算流程估计:
+            每个核组都会重新加载特征图, 若特征图缓存存不下"通道组数 * 扩展卷积核高度"个表面行则每个输出行都要重新加载特征图表面行
+            若卷积核缓存存不下整个核组, 则交换区的通道组在每个输出行都要重新加载
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        plan 缓存划分规划结果(句柄)
+@return 是否成功
 *************************/
-void axi_generic_conv_wr_bn_param_mem(AxiGnrConvHandler* handler, BNParam* bn_param_buf, uint32_t num){
-	memcpy((void*)handler->bn_params_mem, (void*)bn_param_buf, num * 2 * 4);
+int axi_generic_conv_plan_buffer(const AxiGnrConvProp* prop, AxiGnrConvCfg* cfg, AxiGnrConvBufPlan* plan){
+	return axi_generic_conv_plan_buffer_by_cost(prop, cfg, plan, NULL, NULL);
 }
 
 /*************************
 @cfg
 @public
-@brief  写Sigmoid函数值查找表存储器
-@param  handler 通用卷积处理单元(加速器句柄)
-        sigmoid_lut_buf Sigmoid函数值查找表缓存区(指针)
-        depth 查找表深度
-@return none
-*************************/
-void axi_generic_conv_wr_sigmoid_lut_mem(AxiGnrConvHandler* handler, uint16_t* sigmoid_lut_buf, uint32_t depth){
-	memcpy((void*)handler->sigmoid_lut_mem, (void*)sigmoid_lut_buf, depth * 2);
-}
-
-/*************************
-@sts
-@public
-@brief  查询DMA命令完成数
-@param  handler 通用卷积处理单元(加速器句柄)
-        query_type 查询类型
-@return 命令完成数
+@brief  按给定的代价规划缓存划分
+        候选方案和预计访问量与axi_generic_conv_plan_buffer相同, 选择代价最小的方案,
+        代价相同时选择预计DDR访问字节数更少的方案, 两者都相同时优先把Bank分给特征图缓存
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        plan 缓存划分规划结果(句柄)
+        cost 候选方案的代价(为NULL时以预计DDR访问字节数作为代价)
+        cost_arg 传给cost的参数
+@return 是否成功
 *************************/
-uint32_t axi_generic_conv_get_cmd_fns_n(AxiGnrConvHandler* handler, AxiGnrConvCmdFnsNQueryType query_type){
-	switch(query_type){
-	case CONV_Q_CMD_FNS_N_MM2S_0:
-		return handler->reg_region_sts->sts1;
-	case CONV_Q_CMD_FNS_N_MM2S_1:
-		return handler->reg_region_sts->sts2;
-	case CONV_Q_CMD_FNS_N_S2MM:
-		return handler->reg_region_sts->sts3;
+int axi_generic_conv_plan_buffer_by_cost(const AxiGnrConvProp* prop, AxiGnrConvCfg* cfg, AxiGnrConvBufPlan* plan,
+	AxiGnrConvBufPlanCost cost, void* cost_arg){
+	if(cfg->group_n == 0 ||
+		(cfg->fmap_cfg.ifmap_chn_n % cfg->group_n) ||
+		(cfg->fmap_cfg.ifmap_chn_n != cfg->kernal_cfg.kernal_chn_n) ||
+		(cfg->group_n > 1 && (cfg->kernal_cfg.kernal_chn_n != cfg->kernal_cfg.kernal_n)) ||
+		(cfg->group_n > 1 && cfg->cal_cfg.cal_fmt == CONV_INT8)){
+		return -1;
 	}
 
-	return 0xFFFFFFFF;
-}
+	if(cfg->fmap_cfg.ifmap_width == 0 || cfg->fmap_cfg.ifmap_height == 0 || cfg->kernal_cfg.kernal_n == 0 ||
+		cfg->cal_cfg.conv_vertical_stride == 0 || cfg->cal_cfg.conv_horizontal_stride == 0){
+		return -1;
+	}
 
-/*************************
-@ctrl
-@public
-@brief  清除DMA命令完成数计数器
-@param  handler 通用卷积处理单元(加速器句柄)
-        clr_type 待清除的命令完成数计数器类型
-@return 是否成功
-*************************/
-int axi_generic_conv_clr_cmd_fns_n(AxiGnrConvHandler* handler, AxiGnrConvCmdFnsNClrType clr_type){
-	if(clr_type == CONV_C_CMD_FNS_N_MM2S_0 || clr_type == CONV_C_ALL){
-		handler->reg_region_sts->sts1 = 0;
+	// 特征图缓存与卷积核缓存各至少需要1个Bank, 否则下面递减的Bank数会回绕
+	if(prop->phy_buf_bank_n < 2 || prop->atomic_c == 0 || prop->atomic_k == 0){
+		return -1;
 	}
 
-	if(clr_type == CONV_C_CMD_FNS_N_MM2S_1 || clr_type == CONV_C_ALL){
-		handler->reg_region_sts->sts2 = 0;
+	uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+	uint32_t dilated_kernal_len = kernal_len + (kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
+	uint32_t n_foreach_group = cfg->fmap_cfg.ifmap_chn_n / cfg->group_n;
+	uint32_t c_foreach_set =
+		(cfg->group_n > 1) ? n_foreach_group:axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->kernal_cfg.kernal_chn_n);
+	uint32_t cgrpn_foreach_kernal_set =
+		(c_foreach_set / prop->atomic_c) +
+		(c_foreach_set % prop->atomic_c ? 1:0);
+
+	uint32_t ext_fmap_w =
+		((uint32_t)cfg->fmap_cfg.ifmap_width) +
+		((uint32_t)cfg->fmap_cfg.external_padding_left) + ((uint32_t)cfg->fmap_cfg.external_padding_right) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_left_right);
+	uint32_t ext_fmap_h =
+		((uint32_t)cfg->fmap_cfg.ifmap_height) +
+		((uint32_t)cfg->fmap_cfg.external_padding_top) + ((uint32_t)cfg->fmap_cfg.external_padding_bottom) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_height - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom);
+
+	if(ext_fmap_w < dilated_kernal_len || ((ext_fmap_w - dilated_kernal_len) % cfg->cal_cfg.conv_horizontal_stride) ||
+		ext_fmap_h < dilated_kernal_len || ((ext_fmap_h - dilated_kernal_len) % cfg->cal_cfg.conv_vertical_stride)){
+		return -1;
 	}
 
-	if(clr_type == CONV_C_CMD_FNS_N_S2MM || clr_type == CONV_C_ALL){
-		handler->reg_region_sts->sts3 = 0;
+	uint32_t ofmap_width = (ext_fmap_w - dilated_kernal_len) / cfg->cal_cfg.conv_horizontal_stride + 1;
+	uint32_t ofmap_height = (ext_fmap_h - dilated_kernal_len) / cfg->cal_cfg.conv_vertical_stride + 1;
+
+	uint32_t data_byte_n = 2; // 每个硬件通道的字节数(INT8时为1对通道)
+	uint32_t ofmap_pt_byte_n = // 每个输出特征点的字节数
+		axi_generic_conv_get_ofmap_pt_byte_n(cfg->fmap_cfg.ofmap_data_type, cfg->kernal_cfg.kernal_n);
+
+	// 表面行长度取不小于输入特征图宽度的最小值, 更长的表面行只会减少可缓存的表面行数
+	AxiGnrConvFmbufColnType fmbufcoln = CONV_COLN_4;
+
+	while((((uint32_t)4) << ((uint32_t)fmbufcoln)) < ((uint32_t)cfg->fmap_cfg.ifmap_width)){
+		if(fmbufcoln == CONV_COLN_4096){
+			return -2;
+		}
+
+		fmbufcoln = (AxiGnrConvFmbufColnType)(fmbufcoln + 1);
 	}
 
-	return 0;
-}
+	// 计算轮次的枚举范围(组卷积时权重块宽度必须能容纳每组的核数)
+	uint32_t cal_round_n_min;
+	uint32_t cal_round_n_max;
 
-/*************************
-@sts
+	if(cfg->group_n > 1){
+		cal_round_n_min = (n_foreach_group / prop->atomic_k) + (n_foreach_group % prop->atomic_k ? 1:0);
+		cal_round_n_max = cal_round_n_min;
+	}else{
+		cal_round_n_min = 1;
+		cal_round_n_max =
+			(((uint32_t)cfg->kernal_cfg.kernal_n) / prop->atomic_k) +
+			(((uint32_t)cfg->kernal_cfg.kernal_n) % prop->atomic_k ? 1:0);
+	}
+
+	if(cal_round_n_max > prop->max_cal_round_n){
+		cal_round_n_max = prop->max_cal_round_n;
+	}
+
+	if(cal_round_n_max > 16){
+		cal_round_n_max = 16;
+	}
+
+	uint64_t fmap_row_byte_n = ((uint64_t)cfg->fmap_cfg.ifmap_width) * c_foreach_set * data_byte_n; // 每个核组的输入特征图行字节数
+	uint64_t kernal_wgt_byte_n = // 卷积核权重总字节数
+		((uint64_t)cfg->kernal_cfg.kernal_n) * kernal_len * kernal_len * c_foreach_set * data_byte_n;
+	uint64_t ofmap_traffic = // 融合2x2最大池化时只写出池化后的输出特征图
+		cfg->fmap_cfg.en_fused_max_pool ?
+			(((uint64_t)(ofmap_width / 2)) * (ofmap_height / 2) * ofmap_pt_byte_n):
+			(((uint64_t)ofmap_width) * ofmap_height * ofmap_pt_byte_n);
+
+	AxiGnrConvCfg cand = *cfg;
+	AxiGnrConvBufPlan cand_plan;
+	uint64_t best_cost = 0;
+	uint8_t found = 0;
+
+	for(uint32_t cal_round_n = cal_round_n_min;cal_round_n <= cal_round_n_max;cal_round_n++){
+		uint32_t max_wgtblk_w = cal_round_n * prop->atomic_k;
+
+		if(max_wgtblk_w > 32){
+			break;
+		}
+
+		// 每个权重块的表面个数取不小于权重块最大宽度的最小值
+		AxiGnrConvWgtblkSfcNType sfc_n_each_wgtblk = CONV_WGTBLK_SFC_N_1;
+
+		while((((uint32_t)1) << ((uint32_t)sfc_n_each_wgtblk)) < max_wgtblk_w){
+			sfc_n_each_wgtblk = (AxiGnrConvWgtblkSfcNType)(sfc_n_each_wgtblk + 1);
+		}
+
+		uint32_t mid_res_buf_row_n_bufferable = axi_generic_conv_cal_mid_res_buf_row_n(prop, cal_round_n * ofmap_width);
+
+		if(mid_res_buf_row_n_bufferable == 0){
+			continue;
+		}
+
+		uint32_t kernal_set_n =
+			(cfg->group_n > 1) ?
+				cfg->group_n:
+				(
+					(((uint32_t)cfg->kernal_cfg.kernal_n) / max_wgtblk_w) +
+					(((uint32_t)cfg->kernal_cfg.kernal_n) % max_wgtblk_w ? 1:0)
+				);
+
+		// 预计访问量相同时优先把Bank分给特征图缓存, 以便提前加载后续表面行
+		for(uint32_t fmbufbankn = prop->phy_buf_bank_n - 1;fmbufbankn >= 1;fmbufbankn--){
+			uint32_t fmbufrown = axi_generic_conv_cal_fmbufrown(prop, (uint16_t)fmbufbankn, fmbufcoln);
+			uint32_t kbufgrpn = axi_generic_conv_cal_kbufgrpn(prop, (uint16_t)fmbufbankn, kernal_len, sfc_n_each_wgtblk);
+
+			if(fmbufrown < dilated_kernal_len || kbufgrpn < 3){
+				continue;
+			}
+
+			uint8_t fmap_row_reload = fmbufrown < (cgrpn_foreach_kernal_set * dilated_kernal_len);
+			uint8_t kernal_wgt_swap = kbufgrpn < cgrpn_foreach_kernal_set;
+
+			uint64_t fmap_traffic =
+				fmap_row_reload ?
+					(((uint64_t)kernal_set_n) * ofmap_height * kernal_len * fmap_row_byte_n):
+					(((uint64_t)kernal_set_n) * cfg->fmap_cfg.ifmap_height * fmap_row_byte_n);
+			uint64_t kernal_traffic =
+				kernal_wgt_swap ?
+					(
+						kernal_wgt_byte_n *
+						(((uint64_t)(kbufgrpn - 2)) + ((uint64_t)(cgrpn_foreach_kernal_set - (kbufgrpn - 2))) * ofmap_height) /
+						cgrpn_foreach_kernal_set
+					):
+					kernal_wgt_byte_n;
+			uint64_t total_traffic = fmap_traffic + kernal_traffic + ofmap_traffic;
+
+			cand_plan.buffer_cfg.fmbufbankn = (uint16_t)fmbufbankn;
+			cand_plan.buffer_cfg.fmbufcoln = fmbufcoln;
+			cand_plan.buffer_cfg.sfc_n_each_wgtblk = sfc_n_each_wgtblk;
+			cand_plan.max_wgtblk_w = (uint8_t)max_wgtblk_w;
+			cand_plan.cal_round_n = (uint8_t)cal_round_n;
+
+			cand_plan.fmbufrown = (uint16_t)fmbufrown;
+			cand_plan.kbufgrpn = (uint16_t)kbufgrpn;
+			cand_plan.mid_res_buf_row_n_bufferable = (uint8_t)mid_res_buf_row_n_bufferable;
+			cand_plan.fmap_row_reload = fmap_row_reload;
+			cand_plan.kernal_wgt_swap = kernal_wgt_swap;
+
+			cand_plan.fmap_traffic = fmap_traffic;
+			cand_plan.kernal_traffic = kernal_traffic;
+			cand_plan.ofmap_traffic = ofmap_traffic;
+			cand_plan.total_traffic = total_traffic;
+
+			uint64_t cand_cost = total_traffic;
+
+			if(cost != NULL){
+				cand.buffer_cfg = cand_plan.buffer_cfg;
+				cand.max_wgtblk_w = cand_plan.max_wgtblk_w;
+				cand.cal_cfg.cal_round_n = cand_plan.cal_round_n;
+
+				if(cost(cost_arg, &cand, &cand_plan, &cand_cost)){
+					continue;
+				}
+			}
+
+			if(found &&
+				(cand_cost > best_cost || (cand_cost == best_cost && total_traffic >= plan->total_traffic))){
+				continue;
+			}
+
+			found = 1;
+			best_cost = cand_cost;
+
+			*plan = cand_plan;
+		}
+	}
+
+	if(!found){
+		return -2;
+	}
+
+	cfg->buffer_cfg = plan->buffer_cfg;
+	cfg->max_wgtblk_w = plan->max_wgtblk_w;
+	cfg->cal_cfg.cal_round_n = plan->cal_round_n;
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  计算硬件通道数
+        INT8时每个16位数据为1对INT8通道, 硬件通道数为通道对数(向上取整), 其他运算数据格式时为通道数
+@param  cal_fmt 运算数据格式
+        chn_n 通道数
+@return 硬件通道数
+*************************/
+uint32_t axi_generic_conv_get_hw_chn_n(AxiGnrConvCalFmt cal_fmt, uint32_t chn_n){
+	return (cal_fmt == CONV_INT8) ? ((chn_n + 1) / 2):chn_n;
+}
+
+/*************************
+@cfg
+@public
+@brief  计算输出特征点的字节数
+        1字节输出特征图按通道对存储(每对通道占1个16位数据), 通道数为奇数时补1个0通道
+@param  ofmap_data_type 输出特征图数据类型
+        chn_n 通道数
+@return 字节数
+*************************/
+uint32_t axi_generic_conv_get_ofmap_pt_byte_n(AxiGnrConvOfmapDataType ofmap_data_type, uint32_t chn_n){
+	switch(ofmap_data_type){
+	case CONV_O_1_BYTE: return (chn_n + 1) & (~((uint32_t)1));
+	case CONV_O_4_BYTE: return chn_n * 4;
+	default: return chn_n * 2;
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  计算非零通道组数
+        仅零通道组位图的前256位有效, 超出卷积核通道组数的位被忽略
+@param  cfg 配置参数(句柄)
+        cgrpn 每个核组的通道组数
+@return 非零通道组数
+*************************/
+static uint32_t axi_generic_conv_cal_vld_cgrpn(const AxiGnrConvCfg* cfg, uint32_t cgrpn){
+	uint32_t vld_cgrpn = cgrpn;
+
+	if(cfg->zero_cgrp_map != NULL){
+		for(uint32_t i = 0;i < cgrpn && i < ZERO_CGRP_MAP_LEN;i++){
+			if(cfg->zero_cgrp_map[i / 32] & (((uint32_t)1) << (i % 32))){
+				vld_cgrpn--;
+			}
+		}
+	}
+
+	return vld_cgrpn;
+}
+
+/*************************
+@cfg
+@public
+@brief  获取卷积核边长
+@param  kernal_shape 卷积核形状
+@return 卷积核边长
+*************************/
+uint32_t axi_generic_conv_get_kernal_len(AxiGnrConvKernalShape kernal_shape){
+	switch(kernal_shape){
+	case CONV_KRN_1x1: return 1;
+	case CONV_KRN_3x3: return 3;
+	case CONV_KRN_5x5: return 5;
+	case CONV_KRN_7x7: return 7;
+	case CONV_KRN_9x9: return 9;
+	case CONV_KRN_11x11: return 11;
+	case CONV_KRN_4x4: return 4;
+	case CONV_KRN_2x2: return 2;
+	}
+
+	return 1;
+}
+
+/*************************
+@cfg
+@private
+@brief  计算特征图缓存可缓存表面行数(fmbufrown)
+@param  prop 加速器属性(句柄)
+        fmbufbankn 分配给特征图缓存的Bank数
+        fmbufcoln 特征图缓存每个表面行的表面个数类型
+@return 可缓存表面行数
+*************************/
+static uint32_t axi_generic_conv_cal_fmbufrown(const AxiGnrConvProp* prop, uint16_t fmbufbankn, AxiGnrConvFmbufColnType fmbufcoln){
+	uint32_t fmbufrown = ((uint32_t)fmbufbankn) * ((uint32_t)prop->phy_buf_bank_depth);
+
+	switch(fmbufcoln){
+	case CONV_COLN_4: fmbufrown >>= 2;break;
+	case CONV_COLN_8: fmbufrown >>= 3;break;
+	case CONV_COLN_16: fmbufrown >>= 4;break;
+	case CONV_COLN_32: fmbufrown >>= 5;break;
+	case CONV_COLN_64: fmbufrown >>= 6;break;
+	case CONV_COLN_128: fmbufrown >>= 7;break;
+	case CONV_COLN_256: fmbufrown >>= 8;break;
+	case CONV_COLN_512: fmbufrown >>= 9;break;
+	case CONV_COLN_1024: fmbufrown >>= 10;break;
+	case CONV_COLN_2048: fmbufrown >>= 11;break;
+	case CONV_COLN_4096: fmbufrown >>= 12;break;
+	}
+
+	if(fmbufrown > prop->max_fmbuf_row_n){
+		fmbufrown = prop->max_fmbuf_row_n;
+	}
+
+	return fmbufrown;
+}
+
+/*************************
+@cfg
+@private
+@brief  计算卷积核缓存可缓存通道组数(kbufgrpn)
+@param  prop 加速器属性(句柄)
+        fmbufbankn 分配给特征图缓存的Bank数
+        kernal_len 卷积核边长
+        sfc_n_each_wgtblk 卷积核缓存每个权重块的表面个数的类型
+@return 可缓存通道组数
+*************************/
+static uint32_t axi_generic_conv_cal_kbufgrpn(const AxiGnrConvProp* prop, uint16_t fmbufbankn, uint32_t kernal_len,
+	AxiGnrConvWgtblkSfcNType sfc_n_each_wgtblk){
+	uint32_t kbufgrpn =
+		((uint32_t)(prop->phy_buf_bank_n - fmbufbankn)) * ((uint32_t)prop->phy_buf_bank_depth) /
+		(kernal_len * kernal_len);
+
+	switch(sfc_n_each_wgtblk){
+	case CONV_WGTBLK_SFC_N_1: break;
+	case CONV_WGTBLK_SFC_N_2: kbufgrpn >>= 1;break;
+	case CONV_WGTBLK_SFC_N_4: kbufgrpn >>= 2;break;
+	case CONV_WGTBLK_SFC_N_8: kbufgrpn >>= 3;break;
+	case CONV_WGTBLK_SFC_N_16: kbufgrpn >>= 4;break;
+	case CONV_WGTBLK_SFC_N_32: kbufgrpn >>= 5;break;
+	case CONV_WGTBLK_SFC_N_64: kbufgrpn >>= 6;break;
+	case CONV_WGTBLK_SFC_N_128: kbufgrpn >>= 7;break;
+	}
+
+	if(kbufgrpn > 256){
+		kbufgrpn = 256;
+	}
+
+	return kbufgrpn;
+}
+
+/*************************
+@cfg
+@private
+@brief  计算中间结果缓存可缓存行数
+@param  prop 加速器属性(句柄)
+        mid_res_item_n_foreach_row 每个输出特征图表面行的中间结果项数
+@return 可缓存行数(为0表示中间结果缓存存不下1行)
+*************************/
+static uint32_t axi_generic_conv_cal_mid_res_buf_row_n(const AxiGnrConvProp* prop, uint32_t mid_res_item_n_foreach_row){
+	uint32_t bank_n_foreach_mid_res_row =
+		(mid_res_item_n_foreach_row * ((uint32_t)prop->mid_res_buf_clk_rate)) / prop->mid_res_buf_bank_depth +
+		((mid_res_item_n_foreach_row * ((uint32_t)prop->mid_res_buf_clk_rate)) % prop->mid_res_buf_bank_depth ? 1:0);
+	uint32_t mid_res_buf_row_n_bufferable = prop->mid_res_buf_bank_n / bank_n_foreach_mid_res_row;
+
+	if(mid_res_buf_row_n_bufferable > 16){
+		mid_res_buf_row_n_bufferable = 16;
+	}
+
+	return mid_res_buf_row_n_bufferable;
+}
+
+/*************************
+@cfg
+@public
+@brief  写BN参数存储器
+@param  handler 通用卷积处理单元(加速器句柄)
+        bn_param_buf BN参数缓存区(指针)
+        num 参数总量
+@return none
+*************************/
+void axi_generic_conv_wr_bn_param_mem(AxiGnrConvHandler* handler, BNParam* bn_param_buf, uint32_t num){
+	volatile uint32_t* mem = (volatile uint32_t*)handler->bn_params_mem;
+
+	for(uint32_t i = 0;i < num;i++){
+		uint32_t a;
+		uint32_t b;
+
+		memcpy((void*)&a, (const void*)&bn_param_buf[i].param_a, 4);
+		memcpy((void*)&b, (const void*)&bn_param_buf[i].param_b, 4);
+
+		axi_generic_conv_wr_reg(handler, mem + i * 2, a);
+		axi_generic_conv_wr_reg(handler, mem + i * 2 + 1, b);
+	}
+}
+
+/*************************
+@cfg
+@public
+@brief  把重量化缩放系数分解为定点乘数与右移位数
+        scale ≈ multiplier * 2 ^ (-shift), 其中multiplier位于[2 ^ 30, 2 ^ 31)
+        缩放系数过小时右移位数限制为63, 乘数相应减小
+@param  scale 重量化缩放系数(输入量化步长 * 权重量化步长 / 输出量化步长)
+        multiplier 定点乘数(指针)
+        shift 右移位数(指针)
+@return 是否成功
+*************************/
+int axi_generic_conv_quantize_requant_scale(float scale, int32_t* multiplier, uint8_t* shift){
+	double m = (double)scale;
+	int32_t sh = 31;
+
+	if(!(m > 0.0) || m >= 2147483648.0){
+		return -1;
+	}
+
+	// 把尾数规格化到[0.5, 1)
+	while(m >= 1.0){
+		m *= 0.5;
+		sh--;
+	}
+	while(m < 0.5){
+		m *= 2.0;
+		sh++;
+	}
+
+	int64_t q = (int64_t)(m * 2147483648.0 + 0.5);
+
+	// 尾数舍入后进位到2 ^ 31
+	if(q == 2147483648LL){
+		q /= 2;
+		sh--;
+	}
+
+	if(sh < 0){
+		return -1;
+	}
+
+	if(sh > 63){
+		q = (sh - 63 > 32) ? 0:((q + (1LL << (sh - 64))) >> (sh - 63));
+		sh = 63;
+	}
+
+	*multiplier = (int32_t)q;
+	*shift = (uint8_t)sh;
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  生成(INT8逐通道重量化)BN参数
+        参数A = 定点乘数, 参数B = {out_max, out_min, zero_point, 2'b00, shift}
+@param  param BN参数(指针)
+        multiplier 定点乘数
+        shift 右移位数(0~63)
+        zero_point 输出零点
+        out_min 输出下限
+        out_max 输出上限
+@return 是否成功
+*************************/
+int axi_generic_conv_set_bn_requant_param(BNParam* param, int32_t multiplier, uint8_t shift,
+	int8_t zero_point, int8_t out_min, int8_t out_max){
+	if(shift > 63 || out_min > out_max){
+		return -1;
+	}
+
+	uint32_t a = (uint32_t)multiplier;
+	uint32_t b =
+		((uint32_t)shift) |
+		(((uint32_t)((uint8_t)zero_point)) << 8) |
+		(((uint32_t)((uint8_t)out_min)) << 16) |
+		(((uint32_t)((uint8_t)out_max)) << 24);
+
+	// BN参数在存储器中按32位原样存放, 通过memcpy写入浮点字段以避免违反严格别名规则
+	memcpy((void*)&param->param_a, (const void*)&a, 4);
+	memcpy((void*)&param->param_b, (const void*)&b, 4);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  按BN参数计算INT8逐通道重量化的结果(与batch_nml_mac_cell逐位一致)
+        结果 = min(max(sat32((A * X) >>> shift) + rnd + zp, out_min), out_max)
+        rnd为(A * X)的第shift-1位(shift = 0时为0)
+@param  param BN参数(由axi_generic_conv_set_bn_requant_param生成)
+        acc 卷积的32位累加结果
+        sat 限制到[out_min, out_max]之前的结果是否超出s8范围(指针, 可为NULL)
+@return 重量化结果(s8)
+*************************/
+int32_t axi_generic_conv_cal_requant(const BNParam* param, int32_t acc, uint8_t* sat){
+	uint32_t a;
+	uint32_t b;
+
+	memcpy((void*)&a, (const void*)&param->param_a, 4);
+	memcpy((void*)&b, (const void*)&param->param_b, 4);
+
+	uint8_t shift = (uint8_t)(b & 0x3F);
+	int64_t zp = (int64_t)((int8_t)((b >> 8) & 0xFF));
+	int64_t out_min = (int64_t)((int8_t)((b >> 16) & 0xFF));
+	int64_t out_max = (int64_t)((int8_t)((b >> 24) & 0xFF));
+
+	int64_t prod = ((int64_t)((int32_t)a)) * ((int64_t)acc);
+	int64_t rnd = (shift != 0) ? ((prod >> (shift - 1)) & 1):0;
+	int64_t amx = prod >> shift;
+
+	if(amx > 2147483647LL){
+		amx = 2147483647LL;
+	}else if(amx < -2147483648LL){
+		amx = -2147483648LL;
+	}
+
+	int64_t v = amx + rnd + zp;
+
+	if(sat){
+		*sat = (v < -128 || v > 127) ? 1:0;
+	}
+
+	return (int32_t)((v < out_min) ? out_min:((v > out_max) ? out_max:v));
+}
+
+/*************************
+@cfg
+@public
+@brief  写Sigmoid函数值查找表存储器
+@param  handler 通用卷积处理单元(加速器句柄)
+        sigmoid_lut_buf Sigmoid函数值查找表缓存区(指针)
+        depth 查找表深度
+@return none
+*************************/
+void axi_generic_conv_wr_sigmoid_lut_mem(AxiGnrConvHandler* handler, uint16_t* sigmoid_lut_buf, uint32_t depth){
+	volatile uint32_t* mem = (volatile uint32_t*)handler->sigmoid_lut_mem;
+
+	// 每个字存放2个表项, 深度为奇数时保留最后1个字的高16位
+	for(uint32_t i = 0;i < depth / 2;i++){
+		axi_generic_conv_wr_reg(handler, mem + i,
+			((uint32_t)sigmoid_lut_buf[i * 2]) | (((uint32_t)sigmoid_lut_buf[i * 2 + 1]) << 16));
+	}
+
+	if(depth % 2){
+		uint32_t pre_word = axi_generic_conv_rd_reg(handler, mem + depth / 2);
+
+		axi_generic_conv_wr_reg(handler, mem + depth / 2, (pre_word & 0xFFFF0000) | ((uint32_t)sigmoid_lut_buf[depth - 1]));
+	}
+}
+
+/*************************
+@sts
+@public
+@brief  查询DMA命令完成数
+@param  handler 通用卷积处理单元(加速器句柄)
+        query_type 查询类型
+@return 命令完成数
+*************************/
+uint32_t axi_generic_conv_get_cmd_fns_n(AxiGnrConvHandler* handler, AxiGnrConvCmdFnsNQueryType query_type){
+	switch(query_type){
+	case CONV_Q_CMD_FNS_N_MM2S_0:
+		return axi_generic_conv_rd_reg(handler, &handler->reg_region_sts->sts1);
+	case CONV_Q_CMD_FNS_N_MM2S_1:
+		return axi_generic_conv_rd_reg(handler, &handler->reg_region_sts->sts2);
+	case CONV_Q_CMD_FNS_N_S2MM:
+		return axi_generic_conv_rd_reg(handler, &handler->reg_region_sts->sts3);
+	}
+
+	return 0xFFFFFFFF;
+}
+
+/*************************
+@ctrl
+@public
+@brief  清除DMA命令完成数计数器
+@param  handler 通用卷积处理单元(加速器句柄)
+        clr_type 待清除的命令完成数计数器类型
+@return 是否成功
+*************************/
+int axi_generic_conv_clr_cmd_fns_n(AxiGnrConvHandler* handler, AxiGnrConvCmdFnsNClrType clr_type){
+	if(clr_type == CONV_C_CMD_FNS_N_MM2S_0 || clr_type == CONV_C_ALL){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts1, 0);
+	}
+
+	if(clr_type == CONV_C_CMD_FNS_N_MM2S_1 || clr_type == CONV_C_ALL){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts2, 0);
+	}
+
+	if(clr_type == CONV_C_CMD_FNS_N_S2MM || clr_type == CONV_C_ALL){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts3, 0);
+	}
+
+	return 0;
+}
+
+/*************************
+@sts
 @public
 @brief  获取性能监测计数器的值
+        先锁存全部性能监测计数器的快照再逐个读出, 因此得到的各个64位值来自同1个周期
 @param  handler 通用卷积处理单元(加速器句柄)
         pm_sts 性能监测状态(句柄)
 @return 是否成功
@@ -727,15 +1632,37 @@ int axi_generic_conv_get_pm_cnt(AxiGnrConvHandler* handler, AxiGnrConvPerfMonsts
 		return -1;
 	}
 
-	pm_sts->cycle_n = handler->reg_region_sts->sts4;
-	pm_sts->mm2s_chn0_tsf_n = handler->reg_region_sts->sts5;
-	pm_sts->mm2s_chn1_tsf_n = handler->reg_region_sts->sts6;
-	pm_sts->s2mm_tsf_n = handler->reg_region_sts->sts7;
-	pm_sts->ftm_sfc_cal_n = handler->reg_region_sts->sts8;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl6, 0x00000001);
+
+	pm_sts->cycle_n = axi_generic_conv_rd_pm_snap(handler, 0);
+	pm_sts->mm2s_chn0_tsf_n = axi_generic_conv_rd_pm_snap(handler, 1);
+	pm_sts->mm2s_chn1_tsf_n = axi_generic_conv_rd_pm_snap(handler, 2);
+	pm_sts->s2mm_tsf_n = axi_generic_conv_rd_pm_snap(handler, 3);
+	pm_sts->ftm_sfc_cal_n = axi_generic_conv_rd_pm_snap(handler, 4);
+	pm_sts->mac_wait_fmap_cycle_n = axi_generic_conv_rd_pm_snap(handler, 5);
+	pm_sts->mac_wait_kernal_cycle_n = axi_generic_conv_rd_pm_snap(handler, 6);
+	pm_sts->mac_stall_mid_res_cycle_n = axi_generic_conv_rd_pm_snap(handler, 7);
+	pm_sts->s2mm_bp_cycle_n = axi_generic_conv_rd_pm_snap(handler, 8);
+	pm_sts->fmap_row_rplc_n = axi_generic_conv_rd_pm_snap(handler, 9);
+	pm_sts->kernal_sw_rgn_reload_n = axi_generic_conv_rd_pm_snap(handler, 10);
 
 	return 0;
 }
 
+/*************************
+@sts
+@private
+@brief  读取性能监测计数器快照
+@param  handler 通用卷积处理单元(加速器句柄)
+        snap_id 快照读索引(0~10依次对应sts4~sts8, pm0~pm5)
+@return 快照中的64位计数值
+*************************/
+static uint64_t axi_generic_conv_rd_pm_snap(AxiGnrConvHandler* handler, uint8_t snap_id){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl6, ((uint32_t)(snap_id & 0x0F)) << 8);
+
+	return (((uint64_t)axi_generic_conv_rd_reg(handler, &handler->reg_region_pm->pm_snap_hi)) << 32) | ((uint64_t)axi_generic_conv_rd_reg(handler, &handler->reg_region_pm->pm_snap_lo));
+}
+
 /*************************
 @ctrl
 @public
@@ -748,10 +1675,262 @@ int axi_generic_conv_clr_pm_cnt(AxiGnrConvHandler* handler){
 		return -1;
 	}
 
-	handler->reg_region_sts->sts4 = 0;
-	handler->reg_region_sts->sts5 = 0;
-	handler->reg_region_sts->sts6 = 0;
-	handler->reg_region_sts->sts7 = 0;
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts4, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts5, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts6, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts7, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_pm->pm0, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_pm->pm1, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_pm->pm2, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_pm->pm3, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_pm->pm4, 0);
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_pm->pm5, 0);
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  使能完成中断
+@param  handler 通用卷积处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_enable_irq(AxiGnrConvHandler* handler){
+	if(handler->done_threshold == 0){
+		return -1;
+	}
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl1, 0x00000001);
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  除能完成中断
+@param  handler 通用卷积处理单元(加速器句柄)
+@return none
+*************************/
+void axi_generic_conv_disable_irq(AxiGnrConvHandler* handler){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl1, 0x00000000);
+}
+
+/*************************
+@cfg
+@public
+@brief  设置完成阈值
+@param  handler 通用卷积处理单元(加速器句柄)
+        s2mm_cmd_n 完成时S2MM通道完成的命令数(通常为输出特征图的表面行数)
+@return 是否成功
+*************************/
+int axi_generic_conv_set_done_threshold(AxiGnrConvHandler* handler, uint32_t s2mm_cmd_n){
+	if(s2mm_cmd_n == 0){
+		return -2;
+	}
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl2, s2mm_cmd_n);
+	handler->done_threshold = s2mm_cmd_n;
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  清除完成中断等待标志
+@param  handler 通用卷积处理单元(加速器句柄)
+@return none
+*************************/
+void axi_generic_conv_clr_irq(AxiGnrConvHandler* handler){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts9, 0x00000001);
+}
+
+/*************************
+@cfg
+@public
+@brief  设置等待完成时的回调函数
+@param  handler 通用卷积处理单元(加速器句柄)
+        hook 回调函数(可以为NULL)
+        arg 回调函数的参数
+@return none
+*************************/
+void axi_generic_conv_set_wait_hook(AxiGnrConvHandler* handler, AxiGnrConvWaitHook hook, void* arg){
+	handler->wait_hook = hook;
+	handler->wait_hook_arg = arg;
+}
+
+/*************************
+@sts
+@public
+@brief  等待通用卷积处理单元完成(S2MM通道完成的命令数达到完成阈值),
+        等待期间反复调用回调函数(如令CPU休眠直到完成中断到来), 未设置回调函数时退化为轮询
+@param  handler 通用卷积处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_wait_done(AxiGnrConvHandler* handler){
+	if(handler->done_threshold == 0){
+		return -1;
+	}
+
+	while(axi_generic_conv_rd_reg(handler, &handler->reg_region_sts->sts3) < handler->done_threshold){
+		if(handler->wait_hook != NULL){
+			handler->wait_hook(handler->wait_hook_arg);
+		}
+	}
+
+	axi_generic_conv_clr_irq(handler);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  生成层描述符
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+        desc 待生成的层描述符(句柄), 须位于加速器可通过DMA访问的存储区
+        s2mm_cmd_n 本层S2MM通道的命令数(通常为输出特征图的表面行数)
+        bn_param_buf BN参数缓存区(指针), 须位于加速器可通过DMA访问的存储区, 不加载BN参数时可以为NULL
+        bn_param_n BN参数个数(为0表示不加载BN参数)
+        en_bn_act 是否使能批归一化与激活处理单元
+        en_pm 是否使能性能监测计数器
+@return 是否成功
+*************************/
+int axi_generic_conv_build_layer_desc(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, AxiGnrConvLayerDesc* desc,
+	uint32_t s2mm_cmd_n, BNParam* bn_param_buf, uint32_t bn_param_n, uint8_t en_bn_act, uint8_t en_pm){
+	if(!handler->property.layer_desc_supported){
+		return -1;
+	}
+
+	if(s2mm_cmd_n == 0 || (bn_param_n > 0 && bn_param_buf == NULL) || bn_param_n > handler->property.max_kernal_n){
+		return -2;
+	}
+
+	if((en_bn_act && (!handler->property.bn_supported)) || (en_pm && (!handler->property.performance_monitor_supported))){
+		return -2;
+	}
+
+	// 层描述符不包含零通道组跳过配置
+	if(cfg->zero_cgrp_map != NULL){
+		return -2;
+	}
+
+	if(axi_generic_conv_cal_cfg_regs(handler, cfg, desc)){
+		return -2;
+	}
+
+	desc->next_desc_addr = 0x00000000;
+	desc->flags = (en_bn_act ? 0x00000001:0x00000000) | (en_pm ? 0x00000002:0x00000000);
+	desc->s2mm_cmd_n = s2mm_cmd_n;
+	desc->bn_param_addr = (bn_param_buf == NULL) ? 0x00000000:axi_generic_conv_bus_addr(handler, bn_param_buf);
+	desc->bn_param_n = bn_param_n;
+
+	memset((void*)desc->reserved, 0, sizeof(desc->reserved));
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  链接层描述符
+@param  handler 通用卷积处理单元(加速器句柄)
+        desc 层描述符(句柄)
+        next_desc 下一层描述符(句柄), 为NULL时表示desc为链尾
+@return none
+*************************/
+void axi_generic_conv_link_layer_desc(AxiGnrConvHandler* handler, AxiGnrConvLayerDesc* desc, AxiGnrConvLayerDesc* next_desc){
+	desc->next_desc_addr = (next_desc == NULL) ? 0x00000000:axi_generic_conv_bus_addr(handler, next_desc);
+}
+
+/*************************
+@ctrl
+@public
+@brief  提交层描述符链
+@param  handler 通用卷积处理单元(加速器句柄)
+        first_desc 首个层描述符(句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_submit_layer_desc_chain(AxiGnrConvHandler* handler, AxiGnrConvLayerDesc* first_desc){
+	if(!handler->property.layer_desc_supported){
+		return -1;
+	}
+
+	if(axi_generic_conv_is_layer_desc_chain_busy(handler) || axi_generic_conv_is_busy(handler)){
+		return -1;
+	}
+
+	if(first_desc == NULL){
+		return -2;
+	}
+
+	// 层描述符不包含零通道组跳过配置, 须除能以免沿用之前直接配置的位图
+	if(handler->property.zero_cgrp_skip_supported){
+		axi_generic_conv_wr_reg(handler, &handler->reg_region_spa_cfg->spa_cfg0, 0x00000000);
+	}
+
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl4, axi_generic_conv_bus_addr(handler, first_desc));
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_ctrl->ctrl3, 0x00000001);
+
+	return 0;
+}
+
+/*************************
+@sts
+@public
+@brief  判断层描述符链是否正在执行
+@param  handler 通用卷积处理单元(加速器句柄)
+@return 是否正在执行
+*************************/
+uint8_t axi_generic_conv_is_layer_desc_chain_busy(AxiGnrConvHandler* handler){
+	return (axi_generic_conv_rd_reg(handler, &handler->reg_region_sts->sts10) & 0x00000001) ? 0x00:0x01;
+}
+
+/*************************
+@sts
+@public
+@brief  查询(层描述符链)已完成的层数
+@param  handler 通用卷积处理单元(加速器句柄)
+@return 已完成的层数
+*************************/
+uint32_t axi_generic_conv_get_layer_fns_n(AxiGnrConvHandler* handler){
+	return axi_generic_conv_rd_reg(handler, &handler->reg_region_sts->sts11);
+}
+
+/*************************
+@ctrl
+@public
+@brief  清除(层描述符链)已完成层数计数器
+@param  handler 通用卷积处理单元(加速器句柄)
+@return none
+*************************/
+void axi_generic_conv_clr_layer_fns_n(AxiGnrConvHandler* handler){
+	axi_generic_conv_wr_reg(handler, &handler->reg_region_sts->sts11, 0);
+}
+
+/*************************
+@sts
+@public
+@brief  等待层描述符链执行完成,
+        等待期间反复调用回调函数(如令CPU休眠直到完成中断到来), 未设置回调函数时退化为轮询
+@param  handler 通用卷积处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_wait_layer_desc_chain_done(AxiGnrConvHandler* handler){
+	if(!handler->property.layer_desc_supported){
+		return -1;
+	}
+
+	while(axi_generic_conv_is_layer_desc_chain_busy(handler)){
+		if(handler->wait_hook != NULL){
+			handler->wait_hook(handler->wait_hook_arg);
+		}
+	}
+
+	axi_generic_conv_clr_irq(handler);
 
 	return 0;
 }
@@ -18,8 +18,31 @@
         2026.01.06 1.32 增加对sigmoid函数值查找表的初始化
         2026.01.11 1.40 增加对tanh激活函数的支持
         2026.04.07 1.50 增加对2x2和4x4卷积核的支持
+        2026.10.16 1.51 增加完成中断(使能/除能中断, 设置完成阈值, 等待完成)
+        2026.10.16 1.52 增加层描述符链(生成层描述符, 链接层描述符, 提交描述符链, 等待描述符链完成)
+        2026.10.16 1.53 增加影子配置寄存器(配置下一层, 提交配置并启动)
+        2026.10.16 1.54 增加缓存划分规划(自动选择缓存Bank划分、表面行长度、权重块宽度与计算轮次)
+        2026.10.16 1.55 增加扩展性能监测计数器组(乘加阵列停顿周期数, S2MM通道反压周期数, 特征图表面行置换次数, 卷积核交换区重新加载次数)
+        2026.10.16 1.56 性能监测计数器扩展为64位, 通过快照一次性读取
+        2026.10.16 1.57 增加可替换的寄存器访问后端(直接访问/Linux UIO映射/回调函数)和总线地址转换
+        2026.10.17 1.58 增加融合2x2最大池化配置
+        2026.10.17 1.59 增加融合残差相加配置
+        2026.10.17 1.60 增加输出特征图跨距配置(直接写入拼接后特征图的通道切片)
+        2026.10.17 1.61 增加输入特征图跨距配置(直接读取更大特征图中的区域或通道切片)
+        2026.10.17 1.63 增加INT8逐通道重量化配置
+        2026.10.17 1.64 增加头文件保护(可与打包/参考模型/量化工具等头文件同时包含)
+        2026.10.17 1.65 增加零通道组跳过配置
+        2026.10.17 1.66 公开获取卷积核边长的函数(供分块执行/数据重排/运行时复用)
+        2026.10.17 1.67 增加输出舍入单元的定点数量化精度配置
+        2026.10.17 1.68 增加INT8逐通道重量化的参考计算
+        2026.10.17 1.69 缓存划分规划支持以回调函数给出候选方案的代价
+        2026.10.17 1.70 INT8输出特征图按通道对存储, 增加计算输出特征点字节数的函数
+        2026.10.17 1.71 统一定义INT8输入/输出特征图的存储格式
 ************************************************************************************************************************/
 
+#ifndef __AXI_GENERIC_CONV_H
+#define __AXI_GENERIC_CONV_H
+
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -41,14 +64,24 @@ typedef enum{
 	CONV_C_ALL
 }AxiGnrConvCmdFnsNClrType;
 
-// 枚举类型: 运算数据格式
+/*
+枚举类型: 运算数据格式
+INT8时每个16位数据为1对INT8通道({通道2i+1, 通道2i}), 每个通道组(表面)存储ATOMIC_C*2个INT8通道,
+    输入特征图与卷积核权重均按此存储, 通道数为奇数时在最后补1个0通道; INT8时不支持组卷积
+*/
 typedef enum{
 	CONV_INT8 = 0,
 	CONV_INT16 = 1,
 	CONV_FP16 = 2
 }AxiGnrConvCalFmt;
 
-// 枚举类型: 输出特征图数据格式
+/*
+枚举类型: 输出特征图数据格式
+INT8特征图的存储格式(输入特征图与1字节输出特征图共用): 每个16位数据为1对s8通道({通道2i+1, 通道2i}), 通道数为奇数时在最后补1个0通道;
+    输入特征图每个通道组(表面)存储ATOMIC_C个通道对, 1字节输出特征图每个通道组(子表面)存储ATOMIC_K / 2个通道对,
+    ATOMIC_K = ATOMIC_C * 2时两者相同, 输出特征图可直接作为下一层INT8卷积的输入特征图
+1字节输出特征图仅用于INT8逐通道重量化的输出
+*/
 typedef enum{
 	CONV_O_1_BYTE = 0,
 	CONV_O_2_BYTE = 1,
@@ -104,6 +137,22 @@ typedef enum{
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// 函数指针类型: 等待完成时的回调函数
+typedef void (*AxiGnrConvWaitHook)(void* arg);
+
+// 寄存器访问后端
+//     默认以指针直接访问寄存器区和存储器区(裸机下为物理地址, Linux下为mmap映射/dev/uioN得到的虚拟地址),
+//     访问函数被内联为单条load/store指令
+//     编译时定义AXI_GNR_CONV_MMIO_CB则通过回调函数访问(用于仿真器/模拟器), 此时基地址只用于区分所访问的字
+// 函数指针类型: 读1个字(addr为基地址 + 偏移地址)
+typedef uint32_t (*AxiGnrConvMmioRd)(void* arg, uintptr_t addr);
+// 函数指针类型: 写1个字(addr为基地址 + 偏移地址)
+typedef void (*AxiGnrConvMmioWr)(void* arg, uintptr_t addr, uint32_t data);
+// 函数指针类型: 把主机指针转换为加速器DMA使用的总线地址
+typedef uint32_t (*AxiGnrConvBusAddr)(void* arg, const void* ptr);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 // 结构体: 加速器属性
 typedef struct{
 	char version[9]; // 版本号
@@ -124,6 +173,13 @@ typedef struct{
 	uint8_t inner_padding_supported; // 是否支持内填充
 	uint8_t kernal_dilation_supported; // 是否支持卷积核膨胀
 	uint8_t performance_monitor_supported; // 是否支持性能监测
+	uint8_t layer_desc_supported; // 是否支持层描述符链
+	uint8_t fused_max_pool_supported; // 是否支持融合2x2最大池化
+	uint8_t residual_add_supported; // 是否支持融合残差相加
+	uint8_t ofmap_pitch_supported; // 是否支持输出特征图跨距
+	uint8_t ifmap_pitch_supported; // 是否支持输入特征图跨距
+	uint8_t int8_requant_supported; // 是否支持INT8逐通道重量化
+	uint8_t zero_cgrp_skip_supported; // 是否支持零通道组跳过
 
 	uint8_t atomic_k; // 核并行数
 	uint8_t atomic_c; // 通道并行数
@@ -140,6 +196,7 @@ typedef struct{
 	uint16_t max_kernal_n; // 最大的卷积核个数
 	uint8_t mid_res_buf_bank_n; // 中间结果缓存BANK数
 	uint16_t mid_res_buf_bank_depth; // 中间结果缓存BANK深度
+	uint32_t fused_max_pool_buf_depth; // 融合2x2最大池化行缓存深度
 }AxiGnrConvProp;
 
 // 结构体: 寄存器域(属性)
@@ -154,9 +211,27 @@ typedef struct{
 	uint32_t info5;
 }AxiGnrConvRegRgnProp;
 
+// 结构体: 寄存器域(扩展性能监测)
+typedef struct{
+	uint32_t pm0;
+	uint32_t pm1;
+	uint32_t pm2;
+	uint32_t pm3;
+	uint32_t pm4;
+	uint32_t pm5;
+	uint32_t pm_snap_lo;
+	uint32_t pm_snap_hi;
+}AxiGnrConvRegRgnPm;
+
 // 结构体: 寄存器域(控制)
 typedef struct{
 	uint32_t ctrl0;
+	uint32_t ctrl1;
+	uint32_t ctrl2;
+	uint32_t ctrl3;
+	uint32_t ctrl4;
+	uint32_t ctrl5;
+	uint32_t ctrl6;
 }AxiGnrConvRegRgnCtrl;
 
 // 结构体: 寄存器域(状态)
@@ -170,6 +245,9 @@ typedef struct{
 	uint32_t sts6;
 	uint32_t sts7;
 	uint32_t sts8;
+	uint32_t sts9;
+	uint32_t sts10;
+	uint32_t sts11;
 }AxiGnrConvRegRgnSts;
 
 // 结构体: 寄存器域(计算配置)
@@ -193,6 +271,18 @@ typedef struct{
 	uint32_t fmap_cfg5;
 }AxiGnrConvRegRgnFmapCfg;
 
+// 结构体: 寄存器域(输出特征图跨距配置)
+typedef struct{
+	uint32_t fmap_cfg6;
+	uint32_t fmap_cfg7;
+}AxiGnrConvRegRgnOfmapPitchCfg;
+
+// 结构体: 寄存器域(输入特征图跨距配置)
+typedef struct{
+	uint32_t fmap_cfg8;
+	uint32_t fmap_cfg9;
+}AxiGnrConvRegRgnIfmapPitchCfg;
+
 // 结构体: 寄存器域(卷积核配置)
 typedef struct{
 	uint32_t krn_cfg0;
@@ -214,8 +304,16 @@ typedef struct{
 	uint32_t bn_cfg;
 	uint32_t act_cfg0;
 	uint32_t act_cfg1;
+	uint32_t res_cfg0;
+	uint32_t res_cfg1;
 }AxiGnrConvRegRgnBNActCfg;
 
+// 结构体: 寄存器域(零通道组跳过配置)
+typedef struct{
+	uint32_t spa_cfg0;
+	uint32_t zero_cgrp_map[8]; // spa_cfg1~8
+}AxiGnrConvRegRgnSpaCfg;
+
 // 结构体: 子配置参数(计算)
 typedef struct{
 	AxiGnrConvCalFmt cal_fmt; // 运算数据格式
@@ -236,6 +334,23 @@ typedef struct{
 	uint8_t inner_padding_left_right; // 左右内填充数
 	uint8_t inner_padding_top_bottom; // 上下内填充数
 	AxiGnrConvOfmapDataType ofmap_data_type; // 输出特征图数据类型
+	uint8_t en_fused_max_pool; // 是否使能融合2x2最大池化(输出特征图的宽高减半, 奇数时向下取整)
+	/*
+	输出特征图跨距: 把输出特征图写入更宽或带填充的目标特征图(如拼接后的特征图), 从而省去拼接时的拷贝
+	输出特征图按通道组(每ATOMIC_K个通道)存储, 每个通道组是1个"高度 * 表面行"的平面
+	3个字段均为0时按紧密存储写出; 非0时要求每个核组的核数是ATOMIC_K的整数倍
+	*/
+	uint16_t ofmap_chn_ofs; // 在目标特征图中的起始通道号(须为ATOMIC_K的整数倍)
+	uint32_t ofmap_row_pitch; // 目标特征图的表面行跨距(字节数, 为0表示与输出特征图的表面行长度相同)
+	uint32_t ofmap_cgrp_pitch; // 目标特征图的通道组跨距(字节数, 为0表示表面行跨距 * 输出特征图高度)
+	/*
+	输入特征图跨距: 直接读取更大的源特征图中的1个区域(裁剪、通道切片或分块), 从而省去切分时的拷贝
+	输入特征图按通道组(每ATOMIC_C个通道)存储, 每个通道组是1个"高度 * 表面行"的平面
+	区域左上角通过输入特征图基地址给出; 3个字段均为0时按紧密存储读取, 非0时要求输入通道数(组卷积时为每组的通道数)是ATOMIC_C的整数倍
+	*/
+	uint16_t ifmap_start_cgrp; // 在源特征图中的起始通道组号
+	uint32_t ifmap_row_pitch; // 源特征图的表面行跨距(字节数, 为0表示与输入特征图的表面行长度相同)
+	uint32_t ifmap_cgrp_pitch; // 源特征图的通道组跨距(字节数, 为0表示表面行跨距 * 输入特征图高度)
 }AxiGnrConvFmapCfg;
 
 // 结构体: 子配置参数(卷积核)
@@ -263,6 +378,27 @@ typedef struct{
 	uint8_t leaky_relu_point_quat_accrc; // (泄露Relu激活参数)定点数量化精度
 	uint8_t sigmoid_point_quat_accrc; // (sigmoid输入参数)定点数量化精度
 	float leaky_relu_param_alpha; // 泄露Relu激活参数
+	/*
+	INT16/INT8运算数据格式时, 输出舍入单元把量化精度为2 * out_fixed_point_quat_accrc的BN与激活结果
+	向最近偶数舍入到量化精度为out_fixed_point_quat_accrc的S16/S8(使能INT8逐通道重量化时不使用)
+	*/
+	uint8_t out_fixed_point_quat_accrc; // 输出舍入单元的定点数量化精度(0~15)
+	/*
+	融合残差相加: 在BN与激活之后把残差特征图逐元素加到输出上, 即 输出 = 激活结果 + 残差 * 2 ^ residual_scale_exp
+	残差特征图与输出特征图的形状、数据格式和存储布局(包括输出特征图跨距)相同
+	需要"先相加后激活"时, 除能激活函数并使能residual_relu
+	*/
+	uint8_t en_residual_add; // 是否使能融合残差相加
+	uint8_t residual_relu; // 残差相加后是否做Relu
+	int8_t residual_scale_exp; // 残差缩放系数的指数(-32~31)
+	uint8_t* residual_baseaddr; // 残差特征图基地址
+	/*
+	INT8逐通道重量化: 由BN单元把INT8卷积的32位累加结果直接重量化为s8, 即
+		输出 = min(max(((A * 累加结果) >> shift) + 舍入位 + zp, out_min), out_max)
+	每个输出通道的BN参数用axi_generic_conv_set_bn_requant_param生成, 不再是浮点数
+	须启用BN单元且激活函数类型为无, Relu/Relu6通过out_min/out_max表示
+	*/
+	uint8_t en_int8_requant; // 是否使能INT8逐通道重量化
 }AxiGnrConvBNActCfg;
 
 // 结构体: 配置参数
@@ -280,6 +416,12 @@ typedef struct{
 	uint16_t group_n; // 分组数
 
 	uint8_t max_wgtblk_w; // 权重块最大宽度
+
+	/*
+	零通道组位图(按32位字存放, 第i位为1表示第i个通道组的权重对所有卷积核均为0), 为NULL时不跳过
+	仅前256个通道组可被跳过, 不支持组卷积, 且不能用于层描述符
+	*/
+	const uint32_t* zero_cgrp_map;
 }AxiGnrConvCfg;
 
 // 结构体: BN参数
@@ -288,39 +430,109 @@ typedef struct{
 	float param_b;
 }BNParam;
 
-// 结构体: 性能监测状态
+// 结构体: 性能监测状态(同1个周期锁存的快照)
 typedef struct{
-	uint32_t cycle_n; // 运行周期数
-	uint32_t mm2s_chn0_tsf_n; // 0号MM2S通道传输字节数
-	uint32_t mm2s_chn1_tsf_n; // 1号MM2S通道传输字节数
-	uint32_t s2mm_tsf_n; // S2MM通道传输字节数
-	uint32_t ftm_sfc_cal_n; // 已计算的特征图表面数
+	uint64_t cycle_n; // 运行周期数
+	uint64_t mm2s_chn0_tsf_n; // 0号MM2S通道传输字节数
+	uint64_t mm2s_chn1_tsf_n; // 1号MM2S通道传输字节数
+	uint64_t s2mm_tsf_n; // S2MM通道传输字节数
+	uint64_t ftm_sfc_cal_n; // 已计算的特征图表面数
+	uint64_t mac_wait_fmap_cycle_n; // 乘加阵列等待特征图表面的周期数
+	uint64_t mac_wait_kernal_cycle_n; // 乘加阵列等待卷积核权重块的周期数
+	uint64_t mac_stall_mid_res_cycle_n; // 乘加阵列受中间结果缓存阻塞的周期数
+	uint64_t s2mm_bp_cycle_n; // S2MM通道反压的周期数
+	uint64_t fmap_row_rplc_n; // 特征图表面行置换次数
+	uint64_t kernal_sw_rgn_reload_n; // 卷积核交换区通道组重新加载次数
 }AxiGnrConvPerfMonsts;
 
+// 结构体: 缓存划分规划结果
+typedef struct{
+	AxiGnrConvBufferCfg buffer_cfg; // 子配置参数(缓存)
+	uint8_t max_wgtblk_w; // 权重块最大宽度
+	uint8_t cal_round_n; // 计算轮次
+
+	uint16_t fmbufrown; // 特征图缓存可缓存表面行数
+	uint16_t kbufgrpn; // 卷积核缓存可缓存通道组数
+	uint8_t mid_res_buf_row_n_bufferable; // 中间结果缓存可缓存行数
+	uint8_t fmap_row_reload; // 是否需要重复加载特征图表面行
+	uint8_t kernal_wgt_swap; // 是否需要置换卷积核权重(存在交换区)
+
+	uint64_t fmap_traffic; // 预计的输入特征图读取字节数
+	uint64_t kernal_traffic; // 预计的卷积核权重读取字节数
+	uint64_t ofmap_traffic; // 预计的输出特征图写入字节数
+	uint64_t total_traffic; // 预计的DDR总访问字节数
+}AxiGnrConvBufPlan;
+
+// 函数指针类型: 缓存划分候选方案的代价(cand为代入候选方案后的配置参数, 返回非0表示跳过该方案)
+typedef int (*AxiGnrConvBufPlanCost)(void* arg, const AxiGnrConvCfg* cand, const AxiGnrConvBufPlan* cand_plan, uint64_t* cost);
+
+// 结构体: 层描述符(共128字节, 基地址须4字节对齐)
+typedef struct{
+	uint32_t next_desc_addr; // 下一描述符地址(为0表示链尾)
+	uint32_t flags; // 标志(bit0: 使能批归一化与激活处理单元, bit1: 使能性能监测计数器)
+	uint32_t s2mm_cmd_n; // 本层S2MM通道的命令数
+	uint32_t bn_param_addr; // BN参数基地址
+	uint32_t bn_param_n; // BN参数个数(为0表示不加载BN参数)
+
+	AxiGnrConvRegRgnCalCfg cal_cfg; // 计算配置
+	AxiGnrConvRegRgnGrpConvCfg grp_conv_cfg; // 组卷积模式配置
+	AxiGnrConvRegRgnFmapCfg fmap_cfg; // 特征图配置
+	AxiGnrConvRegRgnKrnCfg kernal_cfg; // 卷积核配置
+	AxiGnrConvRegRgnBufCfg buffer_cfg; // 缓存配置
+	AxiGnrConvRegRgnBNActCfg bn_act_cfg; // 批归一化与激活配置
+	AxiGnrConvRegRgnOfmapPitchCfg ofmap_pitch_cfg; // 输出特征图跨距配置
+	AxiGnrConvRegRgnIfmapPitchCfg ifmap_pitch_cfg; // 输入特征图跨距配置
+
+	uint32_t reserved[1]; // 保留
+}AxiGnrConvLayerDesc;
+
+// 结构体: 寄存器访问后端
+typedef struct{
+	uintptr_t reg_base; // 寄存器区基地址
+	uintptr_t mem_base; // BN参数与Sigmoid函数值查找表存储器基地址
+
+	AxiGnrConvMmioRd rd; // 读回调函数(仅在定义AXI_GNR_CONV_MMIO_CB时使用)
+	AxiGnrConvMmioWr wr; // 写回调函数(仅在定义AXI_GNR_CONV_MMIO_CB时使用)
+	void* mmio_arg; // 读写回调函数的参数
+
+	AxiGnrConvBusAddr bus_addr; // 总线地址转换函数(为NULL时直接取指针的低32位)
+	void* bus_addr_arg; // 总线地址转换函数的参数
+}AxiGnrConvMmio;
+
 // 结构体: 通用卷积处理单元
 typedef struct{
-	uint32_t* reg_base_ptr; // 寄存器区基地址
+	AxiGnrConvMmio mmio; // 寄存器访问后端
 
 	// 寄存器域
 	AxiGnrConvRegRgnProp* reg_region_prop; // 寄存器域(属性)
+	AxiGnrConvRegRgnPm* reg_region_pm; // 寄存器域(扩展性能监测)
 	AxiGnrConvRegRgnCtrl* reg_region_ctrl; // 寄存器域(控制)
 	AxiGnrConvRegRgnSts* reg_region_sts; // 寄存器域(状态)
 	AxiGnrConvRegRgnCalCfg* reg_region_cal_cfg; // 寄存器域(计算配置)
 	AxiGnrConvRegRgnGrpConvCfg* reg_region_grp_conv_cfg; // 寄存器域(组卷积模式配置)
 	AxiGnrConvRegRgnFmapCfg* reg_region_fmap_cfg; // 寄存器域(特征图配置)
+	AxiGnrConvRegRgnOfmapPitchCfg* reg_region_ofmap_pitch_cfg; // 寄存器域(输出特征图跨距配置)
+	AxiGnrConvRegRgnIfmapPitchCfg* reg_region_ifmap_pitch_cfg; // 寄存器域(输入特征图跨距配置)
 	AxiGnrConvRegRgnKrnCfg* reg_region_kernal_cfg; // 寄存器域(卷积核配置)
 	AxiGnrConvRegRgnBufCfg* reg_region_buffer_cfg; // 寄存器域(缓存配置)
 	AxiGnrConvRegRgnBNActCfg* reg_region_bn_act_cfg; // 寄存器域(批归一化与激活配置)
+	AxiGnrConvRegRgnSpaCfg* reg_region_spa_cfg; // 寄存器域(零通道组跳过配置)
 
 	BNParam* bn_params_mem; // BN参数存储器域
 	uint16_t* sigmoid_lut_mem; // Sigmoid函数值查找表存储器域
 
 	AxiGnrConvProp property; // 加速器属性
+
+	uint32_t done_threshold; // 完成阈值(S2MM通道完成的命令数)
+	AxiGnrConvWaitHook wait_hook; // 等待完成时的回调函数
+	void* wait_hook_arg; // 等待完成时的回调函数的参数
 }AxiGnrConvHandler;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int axi_generic_conv_init(AxiGnrConvHandler* handler, uint32_t baseaddr, uint32_t mem_base); // 初始化通用卷积处理单元
+int axi_generic_conv_init_mmio(AxiGnrConvHandler* handler, const AxiGnrConvMmio* mmio); // 初始化通用卷积处理单元(指定寄存器访问后端)
+uint32_t axi_generic_conv_bus_addr(AxiGnrConvHandler* handler, const void* ptr); // 把主机指针转换为总线地址
 
 int axi_generic_conv_enable(AxiGnrConvHandler* handler); // 使能加速器
 void axi_generic_conv_disable(AxiGnrConvHandler* handler); // 除能加速器
@@ -334,10 +546,41 @@ int axi_generic_conv_start(AxiGnrConvHandler* handler); // 启动通用卷积处
 uint8_t axi_generic_conv_is_busy(AxiGnrConvHandler* handler); // 判断通用卷积处理单元是否忙碌
 
 int axi_generic_conv_cfg(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg); // 配置通用卷积处理单元
+int axi_generic_conv_cfg_next(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg); // 配置下一层(写影子配置寄存器)
+int axi_generic_conv_commit_and_start(AxiGnrConvHandler* handler); // 提交下一层的配置并启动通用卷积处理单元
+uint8_t axi_generic_conv_is_next_cfg_pending(AxiGnrConvHandler* handler); // 判断是否存在待提交的下一层配置
+int axi_generic_conv_plan_buffer(const AxiGnrConvProp* prop, AxiGnrConvCfg* cfg, AxiGnrConvBufPlan* plan); // 规划缓存划分
+int axi_generic_conv_plan_buffer_by_cost(const AxiGnrConvProp* prop, AxiGnrConvCfg* cfg, AxiGnrConvBufPlan* plan,
+	AxiGnrConvBufPlanCost cost, void* cost_arg); // 按给定的代价规划缓存划分
+uint32_t axi_generic_conv_get_hw_chn_n(AxiGnrConvCalFmt cal_fmt, uint32_t chn_n); // 计算硬件通道数(INT8时为通道对数)
+uint32_t axi_generic_conv_get_ofmap_pt_byte_n(AxiGnrConvOfmapDataType ofmap_data_type, uint32_t chn_n); // 计算输出特征点的字节数
+uint32_t axi_generic_conv_get_kernal_len(AxiGnrConvKernalShape kernal_shape); // 获取卷积核边长
 void axi_generic_conv_wr_bn_param_mem(AxiGnrConvHandler* handler, BNParam* bn_param_buf, uint32_t num); // 写BN参数存储器
+int axi_generic_conv_quantize_requant_scale(float scale, int32_t* multiplier, uint8_t* shift); // 把重量化缩放系数分解为定点乘数与右移位数
+int axi_generic_conv_set_bn_requant_param(BNParam* param, int32_t multiplier, uint8_t shift,
+	int8_t zero_point, int8_t out_min, int8_t out_max); // 生成(INT8逐通道重量化)BN参数
+int32_t axi_generic_conv_cal_requant(const BNParam* param, int32_t acc, uint8_t* sat); // 按BN参数计算INT8逐通道重量化的结果
 void axi_generic_conv_wr_sigmoid_lut_mem(AxiGnrConvHandler* handler, uint16_t* sigmoid_lut_buf, uint32_t depth); // 写Sigmoid函数值查找表存储器
 
 uint32_t axi_generic_conv_get_cmd_fns_n(AxiGnrConvHandler* handler, AxiGnrConvCmdFnsNQueryType query_type); // 查询DMA命令完成数
 int axi_generic_conv_clr_cmd_fns_n(AxiGnrConvHandler* handler, AxiGnrConvCmdFnsNClrType clr_type); // 清除DMA命令完成数计数器
 int axi_generic_conv_get_pm_cnt(AxiGnrConvHandler* handler, AxiGnrConvPerfMonsts* pm_sts); // 获取性能监测计数器的值
 int axi_generic_conv_clr_pm_cnt(AxiGnrConvHandler* handler); // 清除性能监测计数器
+
+int axi_generic_conv_enable_irq(AxiGnrConvHandler* handler); // 使能完成中断
+void axi_generic_conv_disable_irq(AxiGnrConvHandler* handler); // 除能完成中断
+int axi_generic_conv_set_done_threshold(AxiGnrConvHandler* handler, uint32_t s2mm_cmd_n); // 设置完成阈值
+void axi_generic_conv_clr_irq(AxiGnrConvHandler* handler); // 清除完成中断等待标志
+void axi_generic_conv_set_wait_hook(AxiGnrConvHandler* handler, AxiGnrConvWaitHook hook, void* arg); // 设置等待完成时的回调函数
+int axi_generic_conv_wait_done(AxiGnrConvHandler* handler); // 等待通用卷积处理单元完成
+
+int axi_generic_conv_build_layer_desc(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, AxiGnrConvLayerDesc* desc,
+	uint32_t s2mm_cmd_n, BNParam* bn_param_buf, uint32_t bn_param_n, uint8_t en_bn_act, uint8_t en_pm); // 生成层描述符
+void axi_generic_conv_link_layer_desc(AxiGnrConvHandler* handler, AxiGnrConvLayerDesc* desc, AxiGnrConvLayerDesc* next_desc); // 链接层描述符
+int axi_generic_conv_submit_layer_desc_chain(AxiGnrConvHandler* handler, AxiGnrConvLayerDesc* first_desc); // 提交层描述符链
+uint8_t axi_generic_conv_is_layer_desc_chain_busy(AxiGnrConvHandler* handler); // 判断层描述符链是否正在执行
+uint32_t axi_generic_conv_get_layer_fns_n(AxiGnrConvHandler* handler); // 查询(层描述符链)已完成的层数
+void axi_generic_conv_clr_layer_fns_n(AxiGnrConvHandler* handler); // 清除(层描述符链)已完成层数计数器
+int axi_generic_conv_wait_layer_desc_chain_done(AxiGnrConvHandler* handler); // 等待层描述符链执行完成
+
+#endif
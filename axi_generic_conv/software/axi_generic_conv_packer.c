@@ -0,0 +1,627 @@
+/************************************************************************************************************************
+通用卷积处理单元数据重排库
+@brief  在标准张量布局(NCHW/NHWC)与加速器的表面/权重块存储格式之间转换特征图和卷积核权重
+        输入特征图按通道组(每组ATOMIC_C个通道, 组卷积时在每组内划分)存储, 每个通道组内按"行 -> 列 -> 通道"存储;
+        卷积核权重按核组 -> 通道组 -> 权重块 -> 卷积核表面存储; 输出特征图按子表面行(每个核组内ATOMIC_K个通道)存储
+        每个通道组/子表面行是1个独立的重排任务, 可由调用者提供的并行执行函数分配到多个核上
+        FP32与FP16之间的转换复用共享浮点转换库(software/common/panda_fp.c, 须同时编译),
+        按IEEE 754向最近偶数舍入并正确处理零、非规则数、无穷大和NaN, 在支持F16C(x86)或NEON FP16(ARM)时向量化
+        INT16/INT8运算数据格式时标准张量为已量化的16位数据, 原样复制, INT8时按通道对数(硬件通道数)重排
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.17 1.01 支持INT16/INT8运算数据格式的输入特征图和卷积核权重
+        2026.10.17 1.02 增加由卷积核权重生成零通道组位图的函数
+        2026.10.17 1.03 FP32与FP16之间的转换改用共享浮点转换库panda_fp, 复用驱动的获取卷积核边长函数
+        2026.10.17 1.04 重排输出特征图时支持融合2x2最大池化(按池化后的宽高)
+        2026.10.17 1.05 重排输出特征图时支持输出特征图跨距(起始通道号、表面行跨距和通道组跨距)
+        2026.10.17 1.06 共享浮点转换库迁移到software/common, 直接在FP32与FP16之间批量转换(恢复NEON FP16向量化)
+        2026.10.17 1.07 重排输出特征图时支持1字节输出特征图(INT8逐通道重量化的输出, 按通道对存储)
+************************************************************************************************************************/
+
+#include "axi_generic_conv_packer.h"
+#include "common/panda_fp.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 转置时每次处理的特征点/权重个数
+#define PACK_BLK_LEN 128
+// 零通道组位图的最大长度
+#define PACK_ZERO_CGRP_MAP_LEN 256
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 重排上下文
+typedef struct{
+	const AxiGnrConvPackOpt* opt; // 重排选项(句柄)
+	const void* src; // 源数据
+	void* dst; // 目的数据
+
+	AxiGnrConvPackDataType acc_data_type; // 加速器侧数据类型
+	uint32_t atomic_n; // 每个通道组/子表面行的通道数
+	uint32_t plane_len; // 每个通道的平面大小(特征图为高 * 宽, 卷积核为R * S)
+	uint32_t chn_n; // 标准张量的通道数(特征图)或每个卷积核的通道数(卷积核)
+	uint32_t grp_w; // 每组的通道数(特征图)或核组宽度(卷积核, 输出特征图)
+	uint32_t total_n; // 总通道数(特征图)或卷积核个数(卷积核, 输出特征图)
+	uint32_t job_n_foreach_grp; // 每组的任务数
+
+	uint32_t fmap_w; // 特征图宽度(仅输出特征图)
+	uint32_t row_pitch; // 表面行跨距(字节数, 仅输出特征图, 为0表示紧密存储)
+	uint32_t cgrp_pitch; // 通道组跨距(字节数, 仅输出特征图, 为0表示紧密存储)
+}AxiGnrConvPackCtx;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void axi_generic_conv_pack_cvt(
+	const void* src, AxiGnrConvPackDataType src_type, void* dst, AxiGnrConvPackDataType dst_type, uint32_t n); // 转换连续的数据
+static int axi_generic_conv_pack_check(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg, const AxiGnrConvPackOpt* opt); // 检查参数
+static void axi_generic_conv_pack_run(AxiGnrConvPackJob job, AxiGnrConvPackCtx* ctx, uint32_t job_n); // 执行重排任务
+static void axi_generic_conv_pack_ifmap_job(void* arg, uint32_t job_id); // 重排任务(输入特征图的1个通道组)
+static void axi_generic_conv_pack_kernal_job(void* arg, uint32_t job_id); // 重排任务(卷积核权重的1个通道组)
+static void axi_generic_conv_unpack_ofmap_job(void* arg, uint32_t job_id); // 重排任务(输出特征图的1个子表面行)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  将标准张量重排为输入特征图
+        结果写到cfg->ifmap_baseaddr, 最后1个通道组的表面只存储有效的通道
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        src 标准张量([C][H][W]或[H][W][C], INT8时C为通道对数)
+        opt 重排选项(句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_pack_ifmap(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const void* src, const AxiGnrConvPackOpt* opt){
+	AxiGnrConvPackCtx ctx;
+
+	if(axi_generic_conv_pack_check(prop, cfg, opt)){
+		return -1;
+	}
+
+	ctx.opt = opt;
+	ctx.src = src;
+	ctx.dst = (void*)cfg->ifmap_baseaddr;
+	ctx.acc_data_type = (cfg->cal_cfg.cal_fmt == CONV_FP16) ? CONV_PACK_FP16:CONV_PACK_INT16;
+	ctx.atomic_n = prop->atomic_c;
+	ctx.plane_len = ((uint32_t)cfg->fmap_cfg.ifmap_width) * ((uint32_t)cfg->fmap_cfg.ifmap_height);
+	ctx.chn_n = axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->fmap_cfg.ifmap_chn_n);
+	ctx.grp_w = ctx.chn_n / cfg->group_n;
+	ctx.total_n = ctx.chn_n;
+	ctx.job_n_foreach_grp = (ctx.grp_w + ctx.atomic_n - 1) / ctx.atomic_n;
+
+	if(ctx.grp_w == 0 || (ctx.chn_n % cfg->group_n)){
+		return -1;
+	}
+
+	axi_generic_conv_pack_run(axi_generic_conv_pack_ifmap_job, &ctx, ((uint32_t)cfg->group_n) * ctx.job_n_foreach_grp);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  将标准张量重排为卷积核权重
+        结果写到cfg->kernal_wgt_baseaddr, 核组宽度为权重块最大宽度(组卷积时为每组核数)
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        src 标准张量([K][C][R][S]或[K][R][S][C], 组卷积时C为每组通道数, INT8时C为通道对数)
+        opt 重排选项(句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_pack_kernal(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const void* src, const AxiGnrConvPackOpt* opt){
+	return axi_generic_conv_compile_kernal(prop, cfg, src, (void*)cfg->kernal_wgt_baseaddr, opt);
+}
+
+/*************************
+@cfg
+@public
+@brief  计算编译后的卷积核权重大小
+        每个卷积核表面只存储有效的通道, 不足ATOMIC_C的通道由硬件在写入卷积核缓存时补0,
+        卷积核膨胀不改变权重的存储格式
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+@return 编译后的卷积核权重字节数(参数不合法时返回0)
+*************************/
+uint32_t axi_generic_conv_get_kernal_packed_size(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg){
+	if(prop->atomic_c == 0 || cfg->group_n == 0 || (cfg->kernal_cfg.kernal_n % cfg->group_n)){
+		return 0;
+	}
+
+	uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+	uint32_t chn_n_foreach_kernal =
+		(cfg->group_n > 1) ?
+			(((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n):
+			axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->kernal_cfg.kernal_chn_n);
+
+	return ((uint32_t)cfg->kernal_cfg.kernal_n) * chn_n_foreach_kernal * kernal_len * kernal_len * 2;
+}
+
+/*************************
+@cfg
+@public
+@brief  编译卷积核权重
+        按配置参数生成硬件读取的卷积核权重字节流(核组 -> 通道组 -> 权重块 -> 卷积核表面),
+        核组宽度为权重块最大宽度(组卷积时为每组核数)
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        src 标准张量([K][C][R][S]或[K][R][S][C], 组卷积时C为每组通道数, INT8时C为通道对数)
+        dst 卷积核权重缓冲区(至少axi_generic_conv_get_kernal_packed_size个字节)
+        opt 重排选项(句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_compile_kernal(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const void* src, void* dst, const AxiGnrConvPackOpt* opt){
+	AxiGnrConvPackCtx ctx;
+
+	if(axi_generic_conv_pack_check(prop, cfg, opt) || (cfg->kernal_cfg.kernal_n % cfg->group_n) ||
+		cfg->max_wgtblk_w > 32){
+		return -1;
+	}
+
+	// 组卷积时每组的通道数与核数相同, 且不能超过权重块最大宽度
+	if(cfg->group_n > 1 &&
+		(cfg->kernal_cfg.kernal_chn_n != cfg->kernal_cfg.kernal_n ||
+		cfg->kernal_cfg.kernal_n / cfg->group_n > cfg->max_wgtblk_w)){
+		return -1;
+	}
+
+	uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+
+	ctx.opt = opt;
+	ctx.src = src;
+	ctx.dst = dst;
+	ctx.acc_data_type = (cfg->cal_cfg.cal_fmt == CONV_FP16) ? CONV_PACK_FP16:CONV_PACK_INT16;
+	ctx.atomic_n = prop->atomic_c;
+	ctx.plane_len = kernal_len * kernal_len;
+	ctx.grp_w = (cfg->group_n > 1) ? (((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n):((uint32_t)cfg->max_wgtblk_w);
+	ctx.chn_n =
+		(cfg->group_n > 1) ?
+			ctx.grp_w:
+			axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->kernal_cfg.kernal_chn_n);
+	ctx.total_n = cfg->kernal_cfg.kernal_n;
+	ctx.job_n_foreach_grp = (ctx.chn_n + ctx.atomic_n - 1) / ctx.atomic_n;
+
+	if(ctx.grp_w == 0 || ctx.chn_n == 0){
+		return -1;
+	}
+
+	axi_generic_conv_pack_run(
+		axi_generic_conv_pack_kernal_job, &ctx,
+		((ctx.total_n + ctx.grp_w - 1) / ctx.grp_w) * ctx.job_n_foreach_grp
+	);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  由卷积核权重生成零通道组位图
+        第i位为1表示第i个通道组(通道[i * ATOMIC_C, (i + 1) * ATOMIC_C))的权重对所有卷积核的所有位置均为0,
+        仅检查前256个通道组, 其余位清零; 卷积核权重的存储格式不变, 被跳过的通道组仍占用存储空间
+        通道剪枝后的网络常含有全0的通道组, 可将结果填入配置参数的零通道组位图
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        src 标准张量([K][C][R][S]或[K][R][S][C], INT8时C为通道对数)
+        map 零通道组位图(8个32位字)
+        opt 重排选项(句柄)
+@return 零通道组数(参数不合法时返回-1)
+*************************/
+int axi_generic_conv_gen_zero_cgrp_map(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const void* src, uint32_t* map, const AxiGnrConvPackOpt* opt){
+	// 零通道组跳过不支持组卷积
+	if(axi_generic_conv_pack_check(prop, cfg, opt) || cfg->group_n > 1){
+		return -1;
+	}
+
+	uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+	uint32_t plane_len = kernal_len * kernal_len;
+	uint32_t chn_n = axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->kernal_cfg.kernal_chn_n);
+	uint32_t cgrpn = (chn_n + prop->atomic_c - 1) / prop->atomic_c;
+	int zero_cgrp_n = 0;
+
+	memset((void*)map, 0, PACK_ZERO_CGRP_MAP_LEN / 8);
+
+	for(uint32_t cgrp_id = 0;cgrp_id < cgrpn && cgrp_id < PACK_ZERO_CGRP_MAP_LEN;cgrp_id++){
+		uint32_t chn_ofs = cgrp_id * prop->atomic_c;
+		uint32_t depth = (chn_n - chn_ofs > prop->atomic_c) ? prop->atomic_c:(chn_n - chn_ofs);
+		uint8_t is_zero = 1;
+
+		for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n && is_zero;k++){
+			for(uint32_t c = chn_ofs;c < chn_ofs + depth && is_zero;c++){
+				for(uint32_t pos = 0;pos < plane_len && is_zero;pos++){
+					uint32_t i =
+						(opt->layout == CONV_PACK_NHWC) ?
+							((k * plane_len + pos) * chn_n + c):
+							((k * chn_n + c) * plane_len + pos);
+
+					if(opt->data_type == CONV_PACK_FP32){
+						// +0与-0均视为0
+						is_zero = (((const uint32_t*)src)[i] & 0x7FFFFFFF) == 0;
+					}else if(opt->data_type == CONV_PACK_FP16){
+						is_zero = (((const uint16_t*)src)[i] & 0x7FFF) == 0;
+					}else{
+						is_zero = ((const uint16_t*)src)[i] == 0;
+					}
+				}
+			}
+		}
+
+		if(is_zero){
+			map[cgrp_id / 32] |= ((uint32_t)1) << (cgrp_id % 32);
+			zero_cgrp_n++;
+		}
+	}
+
+	return zero_cgrp_n;
+}
+
+/*************************
+@cfg
+@public
+@brief  将输出特征图重排为标准张量
+        从cfg->ofmap_baseaddr读取输出特征图(2字节时为FP16, 4字节时为FP32),
+        INT16/INT8运算数据格式时原样复制16位数据: 2字节输出特征图每个16位数据为1个通道,
+        1字节输出特征图(INT8逐通道重量化)每个16位数据为1对通道, 与输入特征图一样标准张量中的C为通道对数
+        使能融合2x2最大池化时按池化后的宽高(奇数时向下取整)重排
+        给出输出特征图跨距(起始通道号/表面行跨距/通道组跨距)时, 按与驱动相同的地址计算从目标特征图中读取本层的输出通道
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        dst 标准张量([K][OH][OW]或[OH][OW][K], 融合池化时OH/OW为池化后的高/宽, 1字节输出特征图时K为通道对数)
+        opt 重排选项(句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_unpack_ofmap(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	void* dst, const AxiGnrConvPackOpt* opt){
+	AxiGnrConvPackCtx ctx;
+
+	uint8_t is_chn_pair = cfg->fmap_cfg.ofmap_data_type == CONV_O_1_BYTE; // 是否按通道对存储
+
+	if(axi_generic_conv_pack_check(prop, cfg, opt) || (cfg->kernal_cfg.kernal_n % cfg->group_n) ||
+		(cfg->cal_cfg.cal_fmt == CONV_FP16 && is_chn_pair) ||
+		(cfg->cal_cfg.cal_fmt == CONV_INT16 && cfg->fmap_cfg.ofmap_data_type != CONV_O_2_BYTE) ||
+		(cfg->cal_cfg.cal_fmt == CONV_INT8 && cfg->fmap_cfg.ofmap_data_type == CONV_O_4_BYTE)){
+		return -1;
+	}
+
+	// 按通道对存储时核组须从偶数通道开始
+	if(is_chn_pair &&
+		((prop->atomic_k % 2) || ((cfg->max_wgtblk_w % 2) && cfg->kernal_cfg.kernal_n > cfg->max_wgtblk_w))){
+		return -1;
+	}
+
+	uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+	uint32_t dilated_kernal_len = kernal_len + (kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
+	uint32_t ext_fmap_w =
+		((uint32_t)cfg->fmap_cfg.ifmap_width) +
+		((uint32_t)cfg->fmap_cfg.external_padding_left) + ((uint32_t)cfg->fmap_cfg.external_padding_right) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_left_right);
+	uint32_t ext_fmap_h =
+		((uint32_t)cfg->fmap_cfg.ifmap_height) +
+		((uint32_t)cfg->fmap_cfg.external_padding_top) + ((uint32_t)cfg->fmap_cfg.external_padding_bottom) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_height - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom);
+
+	if(cfg->cal_cfg.conv_horizontal_stride == 0 || cfg->cal_cfg.conv_vertical_stride == 0 ||
+		ext_fmap_w < dilated_kernal_len || ext_fmap_h < dilated_kernal_len){
+		return -1;
+	}
+
+	ctx.opt = opt;
+	ctx.src = (const void*)cfg->ofmap_baseaddr;
+	ctx.dst = dst;
+	ctx.acc_data_type =
+		(cfg->cal_cfg.cal_fmt != CONV_FP16) ? CONV_PACK_INT16:
+		(cfg->fmap_cfg.ofmap_data_type == CONV_O_2_BYTE) ? CONV_PACK_FP16:
+		                                                    CONV_PACK_FP32;
+	uint32_t ofmap_w = (ext_fmap_w - dilated_kernal_len) / cfg->cal_cfg.conv_horizontal_stride + 1;
+	uint32_t ofmap_h = (ext_fmap_h - dilated_kernal_len) / cfg->cal_cfg.conv_vertical_stride + 1;
+
+	// 融合2x2最大池化时只写出池化后的输出特征图
+	if(cfg->fmap_cfg.en_fused_max_pool){
+		ofmap_w /= 2;
+		ofmap_h /= 2;
+	}
+
+	if(ofmap_w == 0 || ofmap_h == 0){
+		return -1;
+	}
+
+	// 按通道对存储时以通道对为单位重排(每个子表面行有ATOMIC_K / 2个通道对)
+	ctx.atomic_n = is_chn_pair ? (prop->atomic_k / 2):prop->atomic_k;
+	ctx.plane_len = ofmap_w * ofmap_h;
+	ctx.fmap_w = ofmap_w;
+	ctx.row_pitch = 0;
+	ctx.cgrp_pitch = 0;
+	ctx.grp_w = (cfg->group_n > 1) ? (((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n):((uint32_t)cfg->max_wgtblk_w);
+	ctx.chn_n = cfg->kernal_cfg.kernal_n;
+
+	if(is_chn_pair){
+		ctx.grp_w = (ctx.grp_w + 1) / 2;
+		ctx.chn_n = (ctx.chn_n + 1) / 2;
+	}
+
+	ctx.total_n = ctx.chn_n;
+	ctx.job_n_foreach_grp = (ctx.grp_w + ctx.atomic_n - 1) / ctx.atomic_n;
+
+	if(ctx.grp_w == 0){
+		return -1;
+	}
+
+	// 输出特征图跨距: 每个子表面行恰为ATOMIC_K个通道, 起始通道号折算到源数据基地址
+	if(cfg->fmap_cfg.ofmap_chn_ofs || cfg->fmap_cfg.ofmap_row_pitch || cfg->fmap_cfg.ofmap_cgrp_pitch){
+		uint32_t dense_row_pitch = ofmap_w * ctx.atomic_n * ((ctx.acc_data_type == CONV_PACK_FP32) ? 4:2);
+
+		ctx.row_pitch = cfg->fmap_cfg.ofmap_row_pitch ? cfg->fmap_cfg.ofmap_row_pitch:dense_row_pitch;
+		ctx.cgrp_pitch = cfg->fmap_cfg.ofmap_cgrp_pitch ? cfg->fmap_cfg.ofmap_cgrp_pitch:(ctx.row_pitch * ofmap_h);
+
+		if((!prop->ofmap_pitch_supported) ||
+			(cfg->fmap_cfg.ofmap_chn_ofs % prop->atomic_k) || (ctx.grp_w % ctx.atomic_n) ||
+			ctx.row_pitch < dense_row_pitch ||
+			(((uint64_t)ctx.cgrp_pitch) < ((uint64_t)ctx.row_pitch) * ofmap_h)){
+			return -1;
+		}
+
+		ctx.src = (const void*)(cfg->ofmap_baseaddr + (cfg->fmap_cfg.ofmap_chn_ofs / prop->atomic_k) * ctx.cgrp_pitch);
+	}
+
+	axi_generic_conv_pack_run(
+		axi_generic_conv_unpack_ofmap_job, &ctx,
+		((ctx.total_n + ctx.grp_w - 1) / ctx.grp_w) * ctx.job_n_foreach_grp
+	);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  检查参数
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        opt 重排选项(句柄)
+@return 是否合法
+*************************/
+static int axi_generic_conv_pack_check(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg, const AxiGnrConvPackOpt* opt){
+	if(prop->atomic_c == 0 || prop->atomic_k == 0 ||
+		cfg->group_n == 0 || cfg->max_wgtblk_w == 0 ||
+		(opt->layout != CONV_PACK_NCHW && opt->layout != CONV_PACK_NHWC)){
+		return -1;
+	}
+
+	// FP16时标准张量为浮点数, INT16/INT8时为已量化的16位数据
+	if(cfg->cal_cfg.cal_fmt == CONV_FP16){
+		if(opt->data_type != CONV_PACK_FP32 && opt->data_type != CONV_PACK_FP16){
+			return -1;
+		}
+	}else if(cfg->cal_cfg.cal_fmt == CONV_INT16 || cfg->cal_cfg.cal_fmt == CONV_INT8){
+		if(opt->data_type != CONV_PACK_INT16 || (cfg->cal_cfg.cal_fmt == CONV_INT8 && cfg->group_n > 1)){
+			return -1;
+		}
+	}else{
+		return -1;
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  执行重排任务
+@param  job 重排任务
+        ctx 重排上下文(句柄)
+        job_n 任务数
+@return none
+*************************/
+static void axi_generic_conv_pack_run(AxiGnrConvPackJob job, AxiGnrConvPackCtx* ctx, uint32_t job_n){
+	if(ctx->opt->parallel_for != NULL){
+		ctx->opt->parallel_for(job, (void*)ctx, job_n);
+	}else{
+		for(uint32_t i = 0;i < job_n;i++){
+			job((void*)ctx, i);
+		}
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  重排任务(输入特征图的1个通道组)
+@param  arg 重排上下文(AxiGnrConvPackCtx*)
+        job_id 任务号(组号 * 每组的通道组数 + 组内通道组号)
+@return none
+*************************/
+static void axi_generic_conv_pack_ifmap_job(void* arg, uint32_t job_id){
+	const AxiGnrConvPackCtx* ctx = (const AxiGnrConvPackCtx*)arg;
+	AxiGnrConvPackDataType std_type = ctx->opt->data_type;
+	uint32_t std_byte_n = (std_type == CONV_PACK_FP32) ? 4:2;
+	uint32_t chn_ofs = (job_id % ctx->job_n_foreach_grp) * ctx->atomic_n;
+	uint32_t chn_id = (job_id / ctx->job_n_foreach_grp) * ctx->grp_w + chn_ofs;
+	uint32_t depth = (ctx->grp_w - chn_ofs > ctx->atomic_n) ? ctx->atomic_n:(ctx->grp_w - chn_ofs);
+	const uint8_t* src = (const uint8_t*)ctx->src;
+	uint16_t* dst = ((uint16_t*)ctx->dst) + chn_id * ctx->plane_len;
+
+	if(ctx->opt->layout == CONV_PACK_NHWC){
+		// 每个特征点的depth个通道在源和目的中都是连续的
+		for(uint32_t p = 0;p < ctx->plane_len;p++){
+			axi_generic_conv_pack_cvt(
+				(const void*)(src + (p * ctx->chn_n + chn_id) * std_byte_n), std_type,
+				(void*)(dst + p * depth), ctx->acc_data_type, depth
+			);
+		}
+	}else{
+		// 分块转置: 先把每个通道的1段连续特征点转换到暂存区, 再交错写入表面
+		uint16_t blk[PACK_BLK_LEN];
+
+		for(uint32_t p0 = 0;p0 < ctx->plane_len;p0 += PACK_BLK_LEN){
+			uint32_t blk_len = (ctx->plane_len - p0 > PACK_BLK_LEN) ? PACK_BLK_LEN:(ctx->plane_len - p0);
+
+			for(uint32_t c = 0;c < depth;c++){
+				axi_generic_conv_pack_cvt(
+					(const void*)(src + ((chn_id + c) * ctx->plane_len + p0) * std_byte_n), std_type,
+					(void*)blk, ctx->acc_data_type, blk_len
+				);
+
+				for(uint32_t i = 0;i < blk_len;i++){
+					dst[(p0 + i) * depth + c] = blk[i];
+				}
+			}
+		}
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  重排任务(卷积核权重的1个通道组)
+        每个通道组内依次存储R * S个权重块, 每个权重块包含核组内每个卷积核的1个表面
+@param  arg 重排上下文(AxiGnrConvPackCtx*)
+        job_id 任务号(核组号 * 每个核组的通道组数 + 通道组号)
+@return none
+*************************/
+static void axi_generic_conv_pack_kernal_job(void* arg, uint32_t job_id){
+	const AxiGnrConvPackCtx* ctx = (const AxiGnrConvPackCtx*)arg;
+	AxiGnrConvPackDataType std_type = ctx->opt->data_type;
+	uint32_t std_byte_n = (std_type == CONV_PACK_FP32) ? 4:2;
+	uint32_t set_id = job_id / ctx->job_n_foreach_grp;
+	uint32_t chn_ofs = (job_id % ctx->job_n_foreach_grp) * ctx->atomic_n;
+	uint32_t depth = (ctx->chn_n - chn_ofs > ctx->atomic_n) ? ctx->atomic_n:(ctx->chn_n - chn_ofs);
+	uint32_t set_w = (ctx->total_n - set_id * ctx->grp_w > ctx->grp_w) ? ctx->grp_w:(ctx->total_n - set_id * ctx->grp_w);
+	const uint8_t* src = (const uint8_t*)ctx->src;
+	uint16_t* dst =
+		((uint16_t*)ctx->dst) +
+		set_id * ctx->grp_w * ctx->chn_n * ctx->plane_len + // 核组基址
+		chn_ofs * set_w * ctx->plane_len; // 通道组偏移
+
+	for(uint32_t j = 0;j < set_w;j++){
+		uint32_t k = set_id * ctx->grp_w + j;
+
+		if(ctx->opt->layout == CONV_PACK_NHWC){
+			for(uint32_t pos = 0;pos < ctx->plane_len;pos++){
+				axi_generic_conv_pack_cvt(
+					(const void*)(src + ((k * ctx->plane_len + pos) * ctx->chn_n + chn_ofs) * std_byte_n), std_type,
+					(void*)(dst + (pos * set_w + j) * depth), ctx->acc_data_type, depth
+				);
+			}
+		}else{
+			uint16_t blk[PACK_BLK_LEN]; // R * S <= 121
+
+			for(uint32_t c = 0;c < depth;c++){
+				axi_generic_conv_pack_cvt(
+					(const void*)(src + ((k * ctx->chn_n + chn_ofs + c) * ctx->plane_len) * std_byte_n), std_type,
+					(void*)blk, ctx->acc_data_type, ctx->plane_len
+				);
+
+				for(uint32_t pos = 0;pos < ctx->plane_len;pos++){
+					dst[(pos * set_w + j) * depth + c] = blk[pos];
+				}
+			}
+		}
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  重排任务(输出特征图的1个子表面行)
+@param  arg 重排上下文(AxiGnrConvPackCtx*)
+        job_id 任务号(核组号 * 每个核组的子表面行数 + 子表面行号)
+@return none
+*************************/
+static void axi_generic_conv_unpack_ofmap_job(void* arg, uint32_t job_id){
+	const AxiGnrConvPackCtx* ctx = (const AxiGnrConvPackCtx*)arg;
+	AxiGnrConvPackDataType std_type = ctx->opt->data_type;
+	AxiGnrConvPackDataType acc_type = ctx->acc_data_type;
+	uint32_t std_byte_n = (std_type == CONV_PACK_FP32) ? 4:2;
+	uint32_t acc_byte_n = (acc_type == CONV_PACK_FP32) ? 4:2;
+	uint32_t set_id = job_id / ctx->job_n_foreach_grp;
+	uint32_t set_w = (ctx->total_n - set_id * ctx->grp_w > ctx->grp_w) ? ctx->grp_w:(ctx->total_n - set_id * ctx->grp_w);
+	uint32_t chn_ofs = (job_id % ctx->job_n_foreach_grp) * ctx->atomic_n;
+
+	if(chn_ofs >= set_w){
+		// 最后1个核组的子表面行可能更少
+		return;
+	}
+
+	uint32_t chn_id = set_id * ctx->grp_w + chn_ofs;
+	uint32_t depth = (set_w - chn_ofs > ctx->atomic_n) ? ctx->atomic_n:(set_w - chn_ofs);
+	uint32_t fmap_h = ctx->plane_len / ctx->fmap_w;
+	// 紧密存储时各子表面行依次存放, 否则按通道组跨距和表面行跨距定位
+	const uint8_t* src = ((const uint8_t*)ctx->src) +
+		(ctx->cgrp_pitch ? ((chn_id / ctx->atomic_n) * ctx->cgrp_pitch):(chn_id * ctx->plane_len * acc_byte_n));
+	uint32_t row_pitch = ctx->row_pitch ? ctx->row_pitch:(ctx->fmap_w * depth * acc_byte_n);
+	uint8_t* dst = (uint8_t*)ctx->dst;
+
+	for(uint32_t y = 0;y < fmap_h;y++){
+		const uint8_t* row_src = src + y * row_pitch;
+		uint32_t p_base = y * ctx->fmap_w;
+
+		if(ctx->opt->layout == CONV_PACK_NHWC){
+			for(uint32_t x = 0;x < ctx->fmap_w;x++){
+				axi_generic_conv_pack_cvt(
+					(const void*)(row_src + x * depth * acc_byte_n), acc_type,
+					(void*)(dst + ((p_base + x) * ctx->chn_n + chn_id) * std_byte_n), std_type, depth
+				);
+			}
+		}else{
+			// 分块转置: 先从表面行中收集每个通道的1段特征点到暂存区, 再连续转换到目的通道平面
+			uint32_t blk[PACK_BLK_LEN];
+
+			for(uint32_t x0 = 0;x0 < ctx->fmap_w;x0 += PACK_BLK_LEN){
+				uint32_t blk_len = (ctx->fmap_w - x0 > PACK_BLK_LEN) ? PACK_BLK_LEN:(ctx->fmap_w - x0);
+
+				for(uint32_t c = 0;c < depth;c++){
+					if(acc_type == CONV_PACK_FP32){
+						const uint32_t* src32 = (const uint32_t*)row_src;
+
+						for(uint32_t i = 0;i < blk_len;i++){
+							blk[i] = src32[(x0 + i) * depth + c];
+						}
+					}else{
+						const uint16_t* src16 = (const uint16_t*)row_src;
+
+						for(uint32_t i = 0;i < blk_len;i++){
+							((uint16_t*)blk)[i] = src16[(x0 + i) * depth + c];
+						}
+					}
+
+					axi_generic_conv_pack_cvt(
+						(const void*)blk, acc_type,
+						(void*)(dst + ((chn_id + c) * ctx->plane_len + p_base + x0) * std_byte_n), std_type, blk_len
+					);
+				}
+			}
+		}
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  转换连续的数据
+@param  src 源数据
+        src_type 源数据类型
+        dst 目的数据
+        dst_type 目的数据类型
+        n 数据个数
+@return none
+*************************/
+static void axi_generic_conv_pack_cvt(
+	const void* src, AxiGnrConvPackDataType src_type, void* dst, AxiGnrConvPackDataType dst_type, uint32_t n){
+	if(src_type == dst_type){
+		memcpy(dst, src, n * ((src_type == CONV_PACK_FP32) ? 4:2));
+
+		return;
+	}
+
+	if(src_type == CONV_PACK_FP32){
+		panda_fp_fp32_to_fp16_bulk((const float*)src, (uint16_t*)dst, n);
+	}else{
+		panda_fp_fp16_to_fp32_bulk((const uint16_t*)src, (float*)dst, n);
+	}
+}
@@ -0,0 +1,71 @@
+/************************************************************************************************************************
+通用卷积处理单元数据重排库(接口头文件)
+@brief  在标准张量布局(NCHW/NHWC)与加速器的表面/权重块存储格式之间转换特征图和卷积核权重
+        FP16运算数据格式时支持FP32/FP16的标准张量, INT16/INT8运算数据格式时支持已量化的16位标准张量
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.17 1.01 支持INT16/INT8运算数据格式的输入特征图和卷积核权重
+        2026.10.17 1.02 增加由卷积核权重生成零通道组位图的函数
+        2026.10.17 1.03 FP32与FP16之间的转换改用共享浮点转换库panda_fp
+        2026.10.17 1.04 重排输出特征图时支持融合2x2最大池化
+        2026.10.17 1.05 重排输出特征图时支持输出特征图跨距
+        2026.10.17 1.06 共享浮点转换库迁移到software/common
+        2026.10.17 1.07 增加头文件保护
+************************************************************************************************************************/
+
+#ifndef __AXI_GENERIC_CONV_PACKER_H
+#define __AXI_GENERIC_CONV_PACKER_H
+
+#include "axi_generic_conv.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 枚举类型: 标准张量布局
+typedef enum{
+	CONV_PACK_NCHW = 0, // 特征图为[C][H][W], 卷积核权重为[K][C][R][S]
+	CONV_PACK_NHWC = 1 // 特征图为[H][W][C], 卷积核权重为[K][R][S][C]
+}AxiGnrConvPackLayout;
+
+// 枚举类型: 标准张量数据类型
+typedef enum{
+	CONV_PACK_FP32 = 0,
+	CONV_PACK_FP16 = 1,
+	/*
+	已量化的16位定点数, 原样复制, 仅用于INT16/INT8运算数据格式
+	INT8时每个16位数据为1对INT8通道({通道2i+1, 通道2i}), 标准张量的通道数为通道对数
+	*/
+	CONV_PACK_INT16 = 2
+}AxiGnrConvPackDataType;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 函数指针类型: 重排任务
+typedef void (*AxiGnrConvPackJob)(void* arg, uint32_t job_id);
+// 函数指针类型: 并行执行重排任务(对job_id = 0~job_n-1调用job, 全部完成后返回)
+typedef void (*AxiGnrConvPackParallelFor)(AxiGnrConvPackJob job, void* arg, uint32_t job_n);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 重排选项
+typedef struct{
+	AxiGnrConvPackLayout layout; // 标准张量布局
+	AxiGnrConvPackDataType data_type; // 标准张量数据类型
+	AxiGnrConvPackParallelFor parallel_for; // 并行执行重排任务(为NULL时在调用者线程中依次执行)
+}AxiGnrConvPackOpt;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int axi_generic_conv_pack_ifmap(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const void* src, const AxiGnrConvPackOpt* opt); // 将标准张量重排为输入特征图
+int axi_generic_conv_pack_kernal(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const void* src, const AxiGnrConvPackOpt* opt); // 将标准张量重排为卷积核权重
+uint32_t axi_generic_conv_get_kernal_packed_size(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg); // 计算编译后的卷积核权重大小
+int axi_generic_conv_compile_kernal(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const void* src, void* dst, const AxiGnrConvPackOpt* opt); // 编译卷积核权重
+int axi_generic_conv_gen_zero_cgrp_map(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const void* src, uint32_t* map, const AxiGnrConvPackOpt* opt); // 由卷积核权重生成零通道组位图
+int axi_generic_conv_unpack_ofmap(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	void* dst, const AxiGnrConvPackOpt* opt); // 将输出特征图重排为标准张量
+
+#endif
@@ -0,0 +1,814 @@
+/************************************************************************************************************************
+通用卷积处理单元性能模型
+@brief  在主机上估计通用卷积处理单元的性能监测计数器(运行周期数, 各DMA通道的传输字节数, 已计算的特征图表面数等)
+        传输字节数按硬件的缓存管理方式逐个请求地模拟得到:
+            特征图缓存: 每个核组开始时重置, 请求按"卷积核行 -> 通道组 -> 输出行 -> 核组"的顺序产生,
+                        未命中时加载1个表面行, 缓存满后按FIFO置换最旧的表面行;
+                        实际表面行号中物理y坐标的编码超过范围时, 缓存也会被重置(与fmap_sfc_row_access_req_gen相同)
+            卷积核缓存: 每个核组开始时加载驻留区, 交换区的通道组在每个输出行都要重新加载
+        运行周期数按输出行估计, 每行取乘加阵列、特征图加载、权重加载和结果写出中最慢的一项(中间结果缓存只能存1行时,
+        结果写出不能与计算重叠), 再加上每层、每个核组和每行的固定开销; 这7个平台相关的常数可用实测值标定
+        注意: 未考虑层描述符链和BN参数经0号MM2S通道的传输, 停顿周期数是按主导项近似得到的
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.17 1.01 融合2x2最大池化时只在奇数输出行写出池化后的结果
+        2026.10.17 1.02 INT8时按硬件通道数(通道对数)计算通道组数与访问字节数
+        2026.10.17 1.03 按估计的运行周期数规划缓存划分时复用驱动的缓存划分规划(不再重复枚举候选方案)
+        2026.10.17 1.04 1字节输出特征图按通道对计算写出的字节数
+************************************************************************************************************************/
+
+#include "axi_generic_conv_perf_model.h"
+
+#include <math.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 性能模型参数个数
+#define PERF_PARAM_N 7
+
+// 实际表面行号的位数
+#define PERF_ACTUAL_RID_WIDTH 12
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 卷积层几何参数
+typedef struct{
+	uint32_t atomic_k; // 核并行数
+	uint32_t atomic_c; // 通道并行数
+
+	uint32_t kernal_len; // 卷积核边长
+	uint32_t dilated_kernal_len; // 扩展卷积核边长
+	uint32_t ofmap_w; // 输出特征图宽度
+	uint32_t ofmap_h; // 输出特征图高度
+	uint32_t data_byte_n; // 每个输入特征点/权重的字节数
+	AxiGnrConvOfmapDataType ofmap_data_type; // 输出特征图数据类型
+
+	uint32_t set_n; // 核组数
+	uint32_t set_w; // 核组宽度(非组卷积时为权重块最大宽度, 组卷积时为每组核数)
+	uint32_t chn_n_foreach_set; // 每个核组的通道数
+	uint32_t cgrpn; // 每个核组的通道组数
+
+	uint32_t fmbufrown; // 特征图缓存可缓存表面行数
+	uint32_t kbufgrpn; // 卷积核缓存可缓存通道组数
+	uint32_t mid_res_buf_row_n; // 中间结果缓存可缓存行数
+}AxiGnrConvPerfLayer;
+
+// 结构体: 按估计的运行周期数规划缓存划分的上下文
+typedef struct{
+	const AxiGnrConvProp* prop; // 加速器属性(句柄)
+	const double* p; // 性能模型参数向量
+}AxiGnrConvPerfPlanCtx;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int axi_generic_conv_perf_get_layer(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	AxiGnrConvPerfLayer* layer); // 计算卷积层几何参数
+static int axi_generic_conv_perf_run(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const double* p, AxiGnrConvPerfMonsts* est, double* feature); // 运行性能模型
+static int axi_generic_conv_perf_plan_cost(void* arg, const AxiGnrConvCfg* cand,
+	const AxiGnrConvBufPlan* cand_plan, uint64_t* cost); // 缓存划分候选方案的代价(估计的运行周期数)
+static void axi_generic_conv_perf_pack_param(const AxiGnrConvPerfParam* param, double* p); // 把性能模型参数转换为向量
+static void axi_generic_conv_perf_unpack_param(const double* p, AxiGnrConvPerfParam* param); // 把向量转换为性能模型参数
+static int axi_generic_conv_perf_solve(double* a, double* b, uint32_t n); // 求解线性方程组
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  获取默认的性能模型参数
+        DMA通道每个周期传输1个数据流位宽的数据, 乘加阵列每个周期计算1个特征图表面, 固定开销按经验值给出
+@param  prop 加速器属性(句柄)
+        param 性能模型参数(句柄)
+@return none
+*************************/
+void axi_generic_conv_perf_default_param(const AxiGnrConvProp* prop, AxiGnrConvPerfParam* param){
+	uint32_t mm2s_byte_n_foreach_clk = (prop->mm2s_stream_data_width >= 8) ? (prop->mm2s_stream_data_width / 8):4;
+	uint32_t s2mm_byte_n_foreach_clk = (prop->s2mm_stream_data_width >= 8) ? (prop->s2mm_stream_data_width / 8):4;
+
+	param->layer_cycle_n = 200.0;
+	param->kernal_set_cycle_n = 50.0;
+	param->row_cycle_n = 10.0;
+	param->mac_cycle_foreach_sfc = 1.0;
+	param->fmap_cycle_foreach_byte = 1.0 / mm2s_byte_n_foreach_clk;
+	param->kernal_cycle_foreach_byte = 1.0 / mm2s_byte_n_foreach_clk;
+	param->ofmap_cycle_foreach_byte = 1.0 / s2mm_byte_n_foreach_clk;
+}
+
+/*************************
+@cfg
+@public
+@brief  估计卷积层的性能监测计数器
+        cycle_n、mm2s_chn0_tsf_n、mm2s_chn1_tsf_n、s2mm_tsf_n、ftm_sfc_cal_n、fmap_row_rplc_n和kernal_sw_rgn_reload_n
+        按硬件的缓存管理方式得到; mac_wait_fmap_cycle_n、mac_wait_kernal_cycle_n和mac_stall_mid_res_cycle_n是
+        各输出行中主导项与乘加阵列计算周期数之差的总和; s2mm_bp_cycle_n恒为0
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄, 须已确定缓存配置、权重块最大宽度和计算轮次)
+        param 性能模型参数(句柄)
+        est 估计的性能监测状态(句柄)
+@return 是否成功(-1表示配置参数非法, -2表示缓存配置不可行)
+*************************/
+int axi_generic_conv_perf_predict(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const AxiGnrConvPerfParam* param, AxiGnrConvPerfMonsts* est){
+	double p[PERF_PARAM_N];
+
+	axi_generic_conv_perf_pack_param(param, p);
+
+	return axi_generic_conv_perf_run(prop, cfg, p, est, NULL);
+}
+
+/*************************
+@cfg
+@public
+@brief  估计网络的运行周期数
+        各层依次执行, 层与层之间的开销已计入每层的固定开销
+@param  prop 加速器属性(句柄)
+        cfg_arr 各层的配置参数(数组)
+        layer_n 层数
+        param 性能模型参数(句柄)
+        layer_cycle_n 各层的运行周期数(数组, 可为NULL)
+        total_cycle_n 总运行周期数(指针)
+@return 是否成功(失败时返回第1个失败的层的错误码, 见axi_generic_conv_perf_predict)
+*************************/
+int axi_generic_conv_perf_predict_net(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg_arr, uint32_t layer_n,
+	const AxiGnrConvPerfParam* param, uint64_t* layer_cycle_n, uint64_t* total_cycle_n){
+	double p[PERF_PARAM_N];
+	AxiGnrConvPerfMonsts est;
+
+	axi_generic_conv_perf_pack_param(param, p);
+
+	*total_cycle_n = 0;
+
+	for(uint32_t i = 0;i < layer_n;i++){
+		int res = axi_generic_conv_perf_run(prop, &cfg_arr[i], p, &est, NULL);
+
+		if(res){
+			return res;
+		}
+
+		if(layer_cycle_n != NULL){
+			layer_cycle_n[i] = est.cycle_n;
+		}
+
+		*total_cycle_n += est.cycle_n;
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  标定性能模型参数
+        每个样本的运行周期数可写成7个参数与7个特征(层数, 核组数, 输出行数, 以及各行主导项的计算量/传输量之和)的内积,
+        固定主导项后即为线性最小二乘问题; 交替地更新主导项和求解最小二乘, 直到参数不再变化
+        为了在样本较少时保持稳定, 参数向param给出的初始值收缩, 且不小于0
+@param  prop 加速器属性(句柄)
+        cfg_arr 各样本的配置参数(数组)
+        meas_arr 各样本实测的性能监测状态(数组, 只使用cycle_n)
+        sample_n 样本数
+        param 性能模型参数(句柄, 输入初始值, 输出标定结果)
+        mean_rel_err 标定后运行周期数的平均相对误差(指针, 可为NULL)
+@return 是否成功
+*************************/
+int axi_generic_conv_perf_calibrate(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg_arr,
+	const AxiGnrConvPerfMonsts* meas_arr, uint32_t sample_n, AxiGnrConvPerfParam* param, double* mean_rel_err){
+	if(sample_n == 0){
+		return -1;
+	}
+
+	double p0[PERF_PARAM_N];
+	double p[PERF_PARAM_N];
+	double* feature = (double*)malloc(sizeof(double) * PERF_PARAM_N * sample_n);
+	AxiGnrConvPerfMonsts est;
+
+	if(feature == NULL){
+		return -1;
+	}
+
+	axi_generic_conv_perf_pack_param(param, p0);
+	memcpy(p, p0, sizeof(p));
+
+	for(uint32_t itr = 0;itr < AXI_GNR_CONV_PERF_CALI_MAX_ITR_N;itr++){
+		// 用当前参数确定各行的主导项, 得到每个样本的特征
+		for(uint32_t i = 0;i < sample_n;i++){
+			if(axi_generic_conv_perf_run(prop, &cfg_arr[i], p, &est, &feature[i * PERF_PARAM_N])){
+				free(feature);
+
+				return -1;
+			}
+		}
+
+		// 岭回归: (X'X + diag(lambda)) * p = X'y + lambda * p0
+		double a[PERF_PARAM_N * PERF_PARAM_N];
+		double b[PERF_PARAM_N];
+
+		memset(a, 0, sizeof(a));
+		memset(b, 0, sizeof(b));
+
+		for(uint32_t i = 0;i < sample_n;i++){
+			const double* x = &feature[i * PERF_PARAM_N];
+			double y = (double)meas_arr[i].cycle_n;
+
+			for(uint32_t j = 0;j < PERF_PARAM_N;j++){
+				for(uint32_t k = 0;k < PERF_PARAM_N;k++){
+					a[j * PERF_PARAM_N + k] += x[j] * x[k];
+				}
+
+				b[j] += x[j] * y;
+			}
+		}
+
+		for(uint32_t j = 0;j < PERF_PARAM_N;j++){
+			double lambda = AXI_GNR_CONV_PERF_CALI_RIDGE * (a[j * PERF_PARAM_N + j] + 1.0);
+
+			a[j * PERF_PARAM_N + j] += lambda;
+			b[j] += lambda * p0[j];
+		}
+
+		if(axi_generic_conv_perf_solve(a, b, PERF_PARAM_N)){
+			break;
+		}
+
+		// 参数不再变化时, 主导项也不再变化
+		uint8_t changed = 0;
+
+		for(uint32_t j = 0;j < PERF_PARAM_N;j++){
+			double new_p = (b[j] > 0.0) ? b[j]:0.0;
+
+			if(fabs(new_p - p[j]) > 1e-9 * (fabs(p[j]) + 1e-9)){
+				changed = 1;
+			}
+
+			p[j] = new_p;
+		}
+
+		if(!changed){
+			break;
+		}
+	}
+
+	if(mean_rel_err != NULL){
+		double err_sum = 0.0;
+
+		for(uint32_t i = 0;i < sample_n;i++){
+			axi_generic_conv_perf_run(prop, &cfg_arr[i], p, &est, NULL);
+
+			if(meas_arr[i].cycle_n){
+				err_sum += fabs(((double)est.cycle_n) - ((double)meas_arr[i].cycle_n)) / ((double)meas_arr[i].cycle_n);
+			}
+		}
+
+		*mean_rel_err = err_sum / sample_n;
+	}
+
+	axi_generic_conv_perf_unpack_param(p, param);
+
+	free(feature);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  按估计的运行周期数规划缓存划分
+        由驱动的缓存划分规划(axi_generic_conv_plan_buffer_by_cost)枚举候选方案, 以估计的运行周期数作为代价,
+        周期数相同时选择DDR访问量更小的方案, 两者都相同时优先把Bank分给特征图缓存
+        成功时会更新cfg中的缓存配置、权重块最大宽度和计算轮次
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        param 性能模型参数(句柄)
+        plan 缓存划分规划结果(句柄, 访问量为模型估计值)
+        cycle_n 所选方案的估计运行周期数(指针, 可为NULL)
+@return 是否成功(-1表示配置参数非法, -2表示找不到可行的方案)
+*************************/
+int axi_generic_conv_perf_plan_buffer(const AxiGnrConvProp* prop, AxiGnrConvCfg* cfg,
+	const AxiGnrConvPerfParam* param, AxiGnrConvBufPlan* plan, uint64_t* cycle_n){
+	double p[PERF_PARAM_N];
+	AxiGnrConvPerfPlanCtx ctx;
+	AxiGnrConvPerfMonsts est;
+
+	axi_generic_conv_perf_pack_param(param, p);
+
+	ctx.prop = prop;
+	ctx.p = p;
+
+	int res = axi_generic_conv_plan_buffer_by_cost(prop, cfg, plan, axi_generic_conv_perf_plan_cost, (void*)&ctx);
+
+	if(res){
+		return res;
+	}
+
+	// 所选方案的访问量改为模型估计值
+	if(axi_generic_conv_perf_run(prop, cfg, p, &est, NULL)){
+		return -2;
+	}
+
+	plan->fmap_row_reload = est.fmap_row_rplc_n > 0;
+	plan->fmap_traffic = est.mm2s_chn0_tsf_n;
+	plan->kernal_traffic = est.mm2s_chn1_tsf_n;
+	plan->ofmap_traffic = est.s2mm_tsf_n;
+	plan->total_traffic = est.mm2s_chn0_tsf_n + est.mm2s_chn1_tsf_n + est.s2mm_tsf_n;
+
+	if(cycle_n != NULL){
+		*cycle_n = est.cycle_n;
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  缓存划分候选方案的代价
+        以估计的运行周期数作为代价, 模型认为不可行的方案被跳过
+@param  arg 规划上下文(AxiGnrConvPerfPlanCtx*)
+        cand 代入候选方案后的配置参数(句柄)
+        cand_plan 候选方案(句柄)
+        cost 代价(指针)
+@return 是否跳过该方案
+*************************/
+static int axi_generic_conv_perf_plan_cost(void* arg, const AxiGnrConvCfg* cand,
+	const AxiGnrConvBufPlan* cand_plan, uint64_t* cost){
+	const AxiGnrConvPerfPlanCtx* ctx = (const AxiGnrConvPerfPlanCtx*)arg;
+	AxiGnrConvPerfMonsts est;
+
+	(void)cand_plan;
+
+	if(axi_generic_conv_perf_run(ctx->prop, cand, ctx->p, &est, NULL)){
+		return -1;
+	}
+
+	*cost = est.cycle_n;
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  计算卷积层几何参数
+        特征图缓存可缓存表面行数、卷积核缓存可缓存通道组数和中间结果缓存可缓存行数的计算方法与驱动相同
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        layer 卷积层几何参数(句柄)
+@return 是否成功(-1表示配置参数非法, -2表示缓存配置不可行)
+*************************/
+static int axi_generic_conv_perf_get_layer(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	AxiGnrConvPerfLayer* layer){
+	if(prop->atomic_k == 0 || prop->atomic_c == 0 || cfg->group_n == 0 || cfg->max_wgtblk_w == 0 ||
+		cfg->cal_cfg.cal_round_n == 0 ||
+		cfg->cal_cfg.conv_horizontal_stride == 0 || cfg->cal_cfg.conv_vertical_stride == 0 ||
+		cfg->fmap_cfg.ifmap_width == 0 || cfg->fmap_cfg.ifmap_height == 0 || cfg->fmap_cfg.ifmap_chn_n == 0 ||
+		cfg->kernal_cfg.kernal_n == 0 || (cfg->kernal_cfg.kernal_n % cfg->group_n)){
+		return -1;
+	}
+
+	if(cfg->group_n > 1 &&
+		(cfg->fmap_cfg.ifmap_chn_n != cfg->kernal_cfg.kernal_n || cfg->kernal_cfg.kernal_chn_n != cfg->kernal_cfg.kernal_n ||
+		cfg->cal_cfg.cal_fmt == CONV_INT8)){
+		return -1;
+	}
+
+	if(cfg->group_n == 1 && cfg->fmap_cfg.ifmap_chn_n != cfg->kernal_cfg.kernal_chn_n){
+		return -1;
+	}
+
+	switch(cfg->kernal_cfg.kernal_shape){
+	case CONV_KRN_1x1: layer->kernal_len = 1;break;
+	case CONV_KRN_3x3: layer->kernal_len = 3;break;
+	case CONV_KRN_5x5: layer->kernal_len = 5;break;
+	case CONV_KRN_7x7: layer->kernal_len = 7;break;
+	case CONV_KRN_9x9: layer->kernal_len = 9;break;
+	case CONV_KRN_11x11: layer->kernal_len = 11;break;
+	case CONV_KRN_4x4: layer->kernal_len = 4;break;
+	case CONV_KRN_2x2: layer->kernal_len = 2;break;
+	default: return -1;
+	}
+
+	layer->dilated_kernal_len = layer->kernal_len + (layer->kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
+
+	uint32_t ext_fmap_w =
+		((uint32_t)cfg->fmap_cfg.ifmap_width) +
+		((uint32_t)cfg->fmap_cfg.external_padding_left) + ((uint32_t)cfg->fmap_cfg.external_padding_right) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_left_right);
+	uint32_t ext_fmap_h =
+		((uint32_t)cfg->fmap_cfg.ifmap_height) +
+		((uint32_t)cfg->fmap_cfg.external_padding_top) + ((uint32_t)cfg->fmap_cfg.external_padding_bottom) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_height - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom);
+
+	if(ext_fmap_w < layer->dilated_kernal_len || ext_fmap_h < layer->dilated_kernal_len ||
+		((ext_fmap_w - layer->dilated_kernal_len) % cfg->cal_cfg.conv_horizontal_stride) ||
+		((ext_fmap_h - layer->dilated_kernal_len) % cfg->cal_cfg.conv_vertical_stride)){
+		return -1;
+	}
+
+	layer->atomic_k = prop->atomic_k;
+	layer->atomic_c = prop->atomic_c;
+	layer->ofmap_w = (ext_fmap_w - layer->dilated_kernal_len) / cfg->cal_cfg.conv_horizontal_stride + 1;
+	layer->ofmap_h = (ext_fmap_h - layer->dilated_kernal_len) / cfg->cal_cfg.conv_vertical_stride + 1;
+	layer->data_byte_n = 2; // 每个硬件通道的字节数(INT8时为1对通道)
+	layer->ofmap_data_type = cfg->fmap_cfg.ofmap_data_type;
+
+	layer->set_w =
+		(cfg->group_n > 1) ?
+			(((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n):
+			((uint32_t)cfg->max_wgtblk_w);
+	layer->set_n = (((uint32_t)cfg->kernal_cfg.kernal_n) + layer->set_w - 1) / layer->set_w;
+	layer->chn_n_foreach_set =
+		(cfg->group_n > 1) ? layer->set_w:axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->kernal_cfg.kernal_chn_n);
+	layer->cgrpn = (layer->chn_n_foreach_set + layer->atomic_c - 1) / layer->atomic_c;
+
+	// 特征图缓存可缓存表面行数
+	uint32_t fmbufcoln = ((uint32_t)4) << ((uint32_t)cfg->buffer_cfg.fmbufcoln);
+
+	if(cfg->buffer_cfg.fmbufbankn == 0 || cfg->buffer_cfg.fmbufbankn >= prop->phy_buf_bank_n ||
+		fmbufcoln < cfg->fmap_cfg.ifmap_width){
+		return -2;
+	}
+
+	layer->fmbufrown = ((uint32_t)cfg->buffer_cfg.fmbufbankn) * ((uint32_t)prop->phy_buf_bank_depth) / fmbufcoln;
+
+	if(layer->fmbufrown > prop->max_fmbuf_row_n){
+		layer->fmbufrown = prop->max_fmbuf_row_n;
+	}
+
+	// 卷积核缓存可缓存通道组数
+	layer->kbufgrpn =
+		(((uint32_t)(prop->phy_buf_bank_n - cfg->buffer_cfg.fmbufbankn)) * ((uint32_t)prop->phy_buf_bank_depth) /
+		(layer->kernal_len * layer->kernal_len)) >> ((uint32_t)cfg->buffer_cfg.sfc_n_each_wgtblk);
+
+	if(layer->kbufgrpn > 256){
+		layer->kbufgrpn = 256;
+	}
+
+	// 中间结果缓存可缓存行数
+	uint32_t mid_res_item_n_foreach_row =
+		((uint32_t)cfg->cal_cfg.cal_round_n) * layer->ofmap_w * ((uint32_t)prop->mid_res_buf_clk_rate);
+	uint32_t bank_n_foreach_mid_res_row =
+		(prop->mid_res_buf_bank_depth == 0) ?
+			0:
+			((mid_res_item_n_foreach_row + prop->mid_res_buf_bank_depth - 1) / prop->mid_res_buf_bank_depth);
+
+	layer->mid_res_buf_row_n = (bank_n_foreach_mid_res_row == 0) ? 0:(prop->mid_res_buf_bank_n / bank_n_foreach_mid_res_row);
+
+	if(layer->mid_res_buf_row_n > 16){
+		layer->mid_res_buf_row_n = 16;
+	}
+
+	if(layer->fmbufrown < layer->dilated_kernal_len || layer->kbufgrpn < 3 || layer->mid_res_buf_row_n == 0 ||
+		((uint32_t)(1 << ((uint32_t)cfg->buffer_cfg.sfc_n_each_wgtblk))) < cfg->max_wgtblk_w){
+		return -2;
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  运行性能模型
+        运行周期数 = p[0] * x[0] + p[1] * x[1] + ... + p[6] * x[6], 其中
+            x[0] = 1(层数), x[1] = 核组数, x[2] = 输出行数,
+            x[3] = 乘加阵列主导的各行的特征图表面数(已乘计算轮次)之和,
+            x[4] = 特征图加载主导的各行的0号MM2S通道字节数之和,
+            x[5] = 权重加载主导的各行的1号MM2S通道字节数之和,
+            x[6] = 结果写出主导的各行的S2MM通道字节数之和(中间结果缓存只能存1行时为所有行的S2MM通道字节数之和)
+@param  prop 加速器属性(句柄)
+        cfg 配置参数(句柄)
+        p 性能模型参数(向量)
+        est 估计的性能监测状态(句柄)
+        feature 特征(向量, 可为NULL)
+@return 是否成功(-1表示配置参数非法, -2表示缓存配置不可行)
+*************************/
+static int axi_generic_conv_perf_run(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const double* p, AxiGnrConvPerfMonsts* est, double* feature){
+	AxiGnrConvPerfLayer layer;
+	int res = axi_generic_conv_perf_get_layer(prop, cfg, &layer);
+
+	if(res){
+		return res;
+	}
+
+	uint32_t ifmap_h = cfg->fmap_cfg.ifmap_height;
+	uint32_t ext_pad_top = cfg->fmap_cfg.external_padding_top;
+	uint32_t inner_pad_tb = cfg->fmap_cfg.inner_padding_top_bottom;
+	uint32_t dilation_n = cfg->kernal_cfg.dilation_n;
+	uint32_t v_stride = cfg->cal_cfg.conv_vertical_stride;
+
+	// 实际表面行号 = {物理y坐标的编码, 通道组号}, 通道组号占用的位数由每个核组的通道组数决定
+	uint32_t cgrpid_width = 0;
+
+	while((((uint32_t)1) << cgrpid_width) < layer.cgrpn){
+		cgrpid_width++;
+	}
+
+	uint32_t phy_y_encoding_range = (cgrpid_width >= PERF_ACTUAL_RID_WIDTH) ? 1:(((uint32_t)1) << (PERF_ACTUAL_RID_WIDTH - cgrpid_width));
+
+	// 特征图缓存(FIFO): 缓存域 -> 表面行编号, 表面行编号 -> 缓存域编号 + 1(为0表示未缓存)
+	uint32_t* fmbuf_row = (uint32_t*)malloc(sizeof(uint32_t) * layer.fmbufrown);
+	uint32_t* fmbuf_rid = (uint32_t*)calloc((size_t)layer.cgrpn * ifmap_h, sizeof(uint32_t));
+	uint32_t* row_phy_y = (uint32_t*)malloc(sizeof(uint32_t) * layer.kernal_len);
+
+	if(fmbuf_row == NULL || fmbuf_rid == NULL || row_phy_y == NULL){
+		free(fmbuf_row);
+		free(fmbuf_rid);
+		free(row_phy_y);
+
+		return -1;
+	}
+
+	double x[PERF_PARAM_N];
+	double cycle_n = 0.0;
+	uint64_t sfc_cal_n = 0;
+	uint64_t fmap_tsf_n = 0;
+	uint64_t kernal_tsf_n = 0;
+	uint64_t ofmap_tsf_n = 0;
+	uint64_t fmap_row_rplc_n = 0;
+	uint64_t kernal_sw_rgn_reload_n = 0;
+	double wait_fmap_n = 0.0;
+	double wait_kernal_n = 0.0;
+	double stall_mid_res_n = 0.0;
+
+	memset(x, 0, sizeof(x));
+
+	x[0] = 1.0;
+	x[1] = (double)layer.set_n;
+	x[2] = ((double)layer.set_n) * layer.ofmap_h;
+
+	uint32_t resident_cgrpn = (layer.kbufgrpn >= layer.cgrpn) ? layer.cgrpn:(layer.kbufgrpn - 2);
+
+	for(uint32_t set_id = 0;set_id < layer.set_n;set_id++){
+		uint32_t kernal_n_of_set =
+			(set_id == layer.set_n - 1) ?
+				(((uint32_t)cfg->kernal_cfg.kernal_n) - set_id * layer.set_w):
+				layer.set_w;
+
+		// 每个核组开始时重置特征图缓存
+		uint32_t fmbuf_vld_n = 0;
+		uint32_t fmbuf_wptr = 0;
+		uint32_t phy_y_encoding_ofs = 0;
+
+		for(uint32_t i = 0;i < layer.fmbufrown;i++){
+			fmbuf_row[i] = 0xFFFFFFFF;
+		}
+
+		memset(fmbuf_rid, 0, sizeof(uint32_t) * layer.cgrpn * ifmap_h);
+
+		// 驻留区和交换区的权重字节数
+		uint64_t resident_byte_n = 0;
+		uint64_t swap_byte_n = 0;
+
+		for(uint32_t cgrp_id = 0;cgrp_id < layer.cgrpn;cgrp_id++){
+			uint32_t depth =
+				(cgrp_id == layer.cgrpn - 1) ?
+					(layer.chn_n_foreach_set - cgrp_id * layer.atomic_c):
+					layer.atomic_c;
+			uint64_t byte_n = ((uint64_t)kernal_n_of_set) * layer.kernal_len * layer.kernal_len * depth * layer.data_byte_n;
+
+			if(cgrp_id < resident_cgrpn){
+				resident_byte_n += byte_n;
+			}else{
+				swap_byte_n += byte_n;
+			}
+		}
+
+		if(resident_cgrpn < layer.cgrpn && cfg->group_n == 1){
+			uint64_t swap_load_n = ((uint64_t)(layer.cgrpn - resident_cgrpn)) * layer.ofmap_h;
+
+			kernal_sw_rgn_reload_n += (swap_load_n > 2) ? (swap_load_n - 2):0;
+		}
+
+		for(uint32_t oy = 0;oy < layer.ofmap_h;oy++){
+			// 本输出行用到的有效卷积核行
+			uint32_t vld_row_n = 0;
+
+			for(uint32_t r = 0;r < layer.kernal_len;r++){
+				uint32_t logic_y = oy * v_stride + r * (dilation_n + 1);
+
+				if(logic_y < ext_pad_top || ((logic_y - ext_pad_top) % (inner_pad_tb + 1))){
+					continue;
+				}
+
+				uint32_t phy_y = (logic_y - ext_pad_top) / (inner_pad_tb + 1);
+
+				if(phy_y >= ifmap_h){
+					continue;
+				}
+
+				row_phy_y[vld_row_n++] = phy_y;
+			}
+
+			// 物理y坐标的编码超过范围时, 以本行的最小物理y坐标作为新的编码偏移并重置特征图缓存
+			if(vld_row_n && (row_phy_y[vld_row_n - 1] - phy_y_encoding_ofs) >= phy_y_encoding_range){
+				for(uint32_t i = 0;i < layer.fmbufrown;i++){
+					if(fmbuf_row[i] != 0xFFFFFFFF){
+						fmbuf_rid[fmbuf_row[i]] = 0;
+						fmbuf_row[i] = 0xFFFFFFFF;
+					}
+				}
+
+				fmbuf_vld_n = 0;
+				fmbuf_wptr = 0;
+				phy_y_encoding_ofs = row_phy_y[0];
+			}
+
+			// 特征图表面行请求
+			uint64_t row_fmap_byte_n = 0;
+
+			for(uint32_t cgrp_id = 0;cgrp_id < layer.cgrpn;cgrp_id++){
+				uint32_t depth =
+					(cgrp_id == layer.cgrpn - 1) ?
+						(layer.chn_n_foreach_set - cgrp_id * layer.atomic_c):
+						layer.atomic_c;
+
+				for(uint32_t i = 0;i < vld_row_n;i++){
+					uint32_t rid = cgrp_id * ifmap_h + row_phy_y[i];
+
+					if(fmbuf_rid[rid]){
+						continue;
+					}
+
+					if(fmbuf_vld_n == layer.fmbufrown){
+						fmbuf_rid[fmbuf_row[fmbuf_wptr]] = 0;
+						fmap_row_rplc_n++;
+					}else{
+						fmbuf_vld_n++;
+					}
+
+					fmbuf_row[fmbuf_wptr] = rid;
+					fmbuf_rid[rid] = fmbuf_wptr + 1;
+					fmbuf_wptr = (fmbuf_wptr == layer.fmbufrown - 1) ? 0:(fmbuf_wptr + 1);
+
+					row_fmap_byte_n += ((uint64_t)cfg->fmap_cfg.ifmap_width) * depth * layer.data_byte_n;
+				}
+			}
+
+			uint64_t row_kernal_byte_n = swap_byte_n + ((oy == 0) ? resident_byte_n:0);
+			uint64_t row_ofmap_byte_n = // 融合2x2最大池化时只在奇数行写出池化后的1行
+				cfg->fmap_cfg.en_fused_max_pool ?
+					(((oy & 1) && (oy < ((layer.ofmap_h / 2) * 2))) ?
+						(((uint64_t)(layer.ofmap_w / 2)) * axi_generic_conv_get_ofmap_pt_byte_n(layer.ofmap_data_type, kernal_n_of_set)):0):
+					(((uint64_t)layer.ofmap_w) * axi_generic_conv_get_ofmap_pt_byte_n(layer.ofmap_data_type, kernal_n_of_set));
+			uint64_t row_sfc_n =
+				((uint64_t)layer.ofmap_w) * layer.kernal_len * vld_row_n * layer.cgrpn * cfg->cal_cfg.cal_round_n;
+
+			// 取最慢的一项(中间结果缓存只能存1行时, 结果写出不能与计算重叠)
+			double term[4] = {
+				p[3] * row_sfc_n,
+				p[4] * row_fmap_byte_n,
+				p[5] * row_kernal_byte_n,
+				(layer.mid_res_buf_row_n >= 2) ? (p[6] * row_ofmap_byte_n):0.0
+			};
+			double qty[4] = {(double)row_sfc_n, (double)row_fmap_byte_n, (double)row_kernal_byte_n, (double)row_ofmap_byte_n};
+			uint32_t dom_id = 0;
+
+			for(uint32_t i = 1;i < 4;i++){
+				if(term[i] > term[dom_id]){
+					dom_id = i;
+				}
+			}
+
+			x[3 + dom_id] += qty[dom_id];
+			cycle_n += term[dom_id];
+
+			if(layer.mid_res_buf_row_n < 2){
+				x[6] += qty[3];
+				cycle_n += p[6] * row_ofmap_byte_n;
+			}
+
+			switch(dom_id){
+			case 1: wait_fmap_n += term[1] - term[0];break;
+			case 2: wait_kernal_n += term[2] - term[0];break;
+			case 3: stall_mid_res_n += term[3] - term[0];break;
+			default: break;
+			}
+
+			sfc_cal_n += row_sfc_n;
+			fmap_tsf_n += row_fmap_byte_n;
+			kernal_tsf_n += row_kernal_byte_n;
+			ofmap_tsf_n += row_ofmap_byte_n;
+		}
+	}
+
+	free(fmbuf_row);
+	free(fmbuf_rid);
+	free(row_phy_y);
+
+	cycle_n += p[0] * x[0] + p[1] * x[1] + p[2] * x[2];
+
+	est->cycle_n = (uint64_t)(cycle_n + 0.5);
+	est->mm2s_chn0_tsf_n = fmap_tsf_n;
+	est->mm2s_chn1_tsf_n = kernal_tsf_n;
+	est->s2mm_tsf_n = ofmap_tsf_n;
+	est->ftm_sfc_cal_n = sfc_cal_n;
+	est->mac_wait_fmap_cycle_n = (uint64_t)(wait_fmap_n + 0.5);
+	est->mac_wait_kernal_cycle_n = (uint64_t)(wait_kernal_n + 0.5);
+	est->mac_stall_mid_res_cycle_n = (uint64_t)(stall_mid_res_n + 0.5);
+	est->s2mm_bp_cycle_n = 0;
+	est->fmap_row_rplc_n = fmap_row_rplc_n;
+	est->kernal_sw_rgn_reload_n = kernal_sw_rgn_reload_n;
+
+	if(feature != NULL){
+		memcpy(feature, x, sizeof(x));
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  把性能模型参数转换为向量
+@param  param 性能模型参数(句柄)
+        p 性能模型参数(向量)
+@return none
+*************************/
+static void axi_generic_conv_perf_pack_param(const AxiGnrConvPerfParam* param, double* p){
+	p[0] = param->layer_cycle_n;
+	p[1] = param->kernal_set_cycle_n;
+	p[2] = param->row_cycle_n;
+	p[3] = param->mac_cycle_foreach_sfc;
+	p[4] = param->fmap_cycle_foreach_byte;
+	p[5] = param->kernal_cycle_foreach_byte;
+	p[6] = param->ofmap_cycle_foreach_byte;
+}
+
+/*************************
+@cfg
+@private
+@brief  把向量转换为性能模型参数
+@param  p 性能模型参数(向量)
+        param 性能模型参数(句柄)
+@return none
+*************************/
+static void axi_generic_conv_perf_unpack_param(const double* p, AxiGnrConvPerfParam* param){
+	param->layer_cycle_n = p[0];
+	param->kernal_set_cycle_n = p[1];
+	param->row_cycle_n = p[2];
+	param->mac_cycle_foreach_sfc = p[3];
+	param->fmap_cycle_foreach_byte = p[4];
+	param->kernal_cycle_foreach_byte = p[5];
+	param->ofmap_cycle_foreach_byte = p[6];
+}
+
+/*************************
+@cfg
+@private
+@brief  求解线性方程组(列主元高斯消元)
+@param  a 系数矩阵(n * n, 按行存储, 会被改写)
+        b 右端向量(n, 输出解)
+        n 未知数个数
+@return 是否成功
+*************************/
+static int axi_generic_conv_perf_solve(double* a, double* b, uint32_t n){
+	for(uint32_t col = 0;col < n;col++){
+		uint32_t pivot = col;
+
+		for(uint32_t row = col + 1;row < n;row++){
+			if(fabs(a[row * n + col]) > fabs(a[pivot * n + col])){
+				pivot = row;
+			}
+		}
+
+		if(fabs(a[pivot * n + col]) < 1e-300){
+			return -1;
+		}
+
+		if(pivot != col){
+			for(uint32_t k = 0;k < n;k++){
+				double t = a[col * n + k];
+
+				a[col * n + k] = a[pivot * n + k];
+				a[pivot * n + k] = t;
+			}
+
+			double t = b[col];
+
+			b[col] = b[pivot];
+			b[pivot] = t;
+		}
+
+		for(uint32_t row = col + 1;row < n;row++){
+			double f = a[row * n + col] / a[col * n + col];
+
+			for(uint32_t k = col;k < n;k++){
+				a[row * n + k] -= f * a[col * n + k];
+			}
+
+			b[row] -= f * b[col];
+		}
+	}
+
+	for(uint32_t col = n;col-- > 0;){
+		for(uint32_t k = col + 1;k < n;k++){
+			b[col] -= a[col * n + k] * b[k];
+		}
+
+		b[col] /= a[col * n + col];
+	}
+
+	return 0;
+}
@@ -0,0 +1,42 @@
+/************************************************************************************************************************
+通用卷积处理单元性能模型(接口头文件)
+@brief  在主机上按卷积计算过程(核组 -> 输出行 -> 通道组 -> 卷积核行 -> 卷积核列 -> 输出列)逐行估计通用卷积处理单元的
+        运行周期数和各DMA通道的传输字节数, 并可用实测的性能监测计数器标定平台相关的常数
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include "axi_generic_conv.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 标定时的最大迭代次数
+#define AXI_GNR_CONV_PERF_CALI_MAX_ITR_N 16
+// 标定时向先验参数收缩的强度(相对于各特征的平方和)
+#define AXI_GNR_CONV_PERF_CALI_RIDGE 1e-3
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 性能模型参数(平台相关的常数)
+typedef struct{
+	double layer_cycle_n; // 每层的固定开销(周期数)
+	double kernal_set_cycle_n; // 每个核组的固定开销(周期数)
+	double row_cycle_n; // 每个输出行的固定开销(周期数)
+	double mac_cycle_foreach_sfc; // 乘加阵列计算1个特征图表面(1个计算轮次)的周期数
+	double fmap_cycle_foreach_byte; // 0号MM2S通道(输入特征图)每字节的周期数
+	double kernal_cycle_foreach_byte; // 1号MM2S通道(卷积核权重)每字节的周期数
+	double ofmap_cycle_foreach_byte; // S2MM通道(输出特征图)每字节的周期数
+}AxiGnrConvPerfParam;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void axi_generic_conv_perf_default_param(const AxiGnrConvProp* prop, AxiGnrConvPerfParam* param); // 获取默认的性能模型参数
+int axi_generic_conv_perf_predict(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const AxiGnrConvPerfParam* param, AxiGnrConvPerfMonsts* est); // 估计卷积层的性能监测计数器
+int axi_generic_conv_perf_predict_net(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg_arr, uint32_t layer_n,
+	const AxiGnrConvPerfParam* param, uint64_t* layer_cycle_n, uint64_t* total_cycle_n); // 估计网络的运行周期数
+int axi_generic_conv_perf_calibrate(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg_arr,
+	const AxiGnrConvPerfMonsts* meas_arr, uint32_t sample_n, AxiGnrConvPerfParam* param, double* mean_rel_err); // 标定性能模型参数
+int axi_generic_conv_perf_plan_buffer(const AxiGnrConvProp* prop, AxiGnrConvCfg* cfg,
+	const AxiGnrConvPerfParam* param, AxiGnrConvBufPlan* plan, uint64_t* cycle_n); // 按估计的运行周期数规划缓存划分
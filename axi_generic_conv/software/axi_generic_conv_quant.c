@@ -0,0 +1,922 @@
+/************************************************************************************************************************
+通用卷积处理单元离线量化校准工具
+@brief  对每个卷积层:
+            1.用FP16参考模型计算校准集的期望输出, 统计输入/输出特征图的最大绝对值,
+              并统计每个卷积核的Σ|x| * |w|(32位中间结果的上界)
+            2.按统计结果选择量化参数, 使量化后的数据尽量用满位宽而卷积的32位中间结果不溢出
+            3.按硬件的定点数据通路计算量化后的结果:
+                卷积(INT16/INT8乘加, 按硬件的累加顺序逐步作32位饱和累加) ->
+                INT16: batch_nml_mac_cell(INT32) -> leaky_relu_cell(INT32) -> out_round_cell(S33转S16, 向最近偶数舍入)
+                INT8:  batch_nml_mac_cell(INT8逐通道重量化)
+              若有卷积核的中间结果溢出, 则降低该卷积核的权重精度后重新计算
+            4.与期望输出比较, 给出信噪比和最大绝对误差
+        每个通道组的部分和(不超过64个乘积)用双精度浮点数精确表示, 通道组之间的累加与硬件一样每一步都饱和到32位,
+        累加顺序与conv_middle_res_info_packer相同(依次遍历通道组、卷积核行、卷积核列)
+@date   2026/10/17
+@author 陈家耀
+@eidt   2026.10.17 1.00 创建了第1个正式版本
+        2026.10.17 1.01 卷积按硬件的累加顺序逐步饱和, 给出输出舍入单元的定点数量化精度, 以memcpy代替指针类型双关
+        2026.10.17 1.02 INT8时输出1字节输出特征图(按通道对存储, 可直接作为下一层INT8卷积的输入特征图), 反量化时拆分通道对
+************************************************************************************************************************/
+
+#include "axi_generic_conv_quant.h"
+#include "axi_generic_conv_packer.h"
+#include "axi_generic_conv_ref_model.h"
+
+#include <math.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 32位有符号数的上限
+#define QUANT_S32_MAX 2147483647.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 卷积层几何参数
+typedef struct{
+	const AxiGnrConvCfg* cfg; // 配置参数(句柄)
+
+	uint32_t kernal_len; // 卷积核边长
+	uint32_t ifmap_plane_len; // 输入特征图每个通道的平面大小
+	uint32_t ofmap_w; // 输出特征图宽度
+	uint32_t ofmap_h; // 输出特征图高度
+	uint32_t ofmap_plane_len; // 输出特征图每个通道的平面大小
+	uint32_t chn_n_foreach_kernal; // 每个卷积核的通道数
+	uint32_t kernal_n_foreach_group; // 每组的卷积核个数
+	uint32_t wgt_n_foreach_kernal; // 每个卷积核的权重个数
+}AxiGnrConvQuantGeo;
+
+// 结构体: 逐通道量化参数
+typedef struct{
+	double wgt_max_abs; // 权重的最大绝对值
+	double acc_bound; // Σ|x| * |w|的最大值(实数)
+	double bn_a; // 浮点BN参数A
+	double bn_b; // 浮点BN参数B
+	double wgt_scale; // 权重的量化步长
+	uint8_t acc_ovf; // 32位中间结果溢出(标志)
+
+	int32_t param_a; // 定点BN参数A(INT16)或定点乘数(INT8)
+	int32_t param_b; // 定点BN参数B(INT16)
+	uint8_t shift; // 右移位数(INT8)
+	int8_t zero_point; // 输出偏置(INT8)
+	int8_t out_min; // 输出下限(INT8, Relu时为0)
+}AxiGnrConvQuantChn;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int axi_generic_conv_quant_get_geo(const AxiGnrConvCfg* cfg, AxiGnrConvQuantGeo* geo); // 获取卷积层几何参数
+static int axi_generic_conv_quant_logic_to_phy(
+	uint32_t logic, uint32_t ext_padding, uint32_t inner_padding, uint32_t len, uint32_t* phy); // 扩展特征图坐标转原始坐标
+static void axi_generic_conv_quant_conv(const AxiGnrConvQuantGeo* geo, const double* x, const double* w,
+	uint32_t cgrp_chn_n, double* y, uint8_t* ovf); // 卷积
+static int32_t axi_generic_conv_quant_round_sat(double v, int32_t min, int32_t max); // 四舍五入并饱和化
+static int64_t axi_generic_conv_quant_sat32(int64_t v); // 限制到32位有符号数
+static uint8_t axi_generic_conv_quant_sel_quat_accrc(double max_abs, double lmt, uint8_t max_q); // 选择定点数量化精度
+static int axi_generic_conv_quant_run_fp16(const AxiGnrConvProp* prop, const AxiGnrConvQuantLayer* layer,
+	const AxiGnrConvQuantGeo* geo, const float* const* calib_ifmap, uint32_t calib_n,
+	uint32_t thread_n, float* const* ref_ofmap); // 用FP16参考模型计算期望输出
+static int axi_generic_conv_quant_derive(const AxiGnrConvQuantGeo* geo, AxiGnrConvQuantRes* res,
+	AxiGnrConvQuantChn* chn, const float* kernal, double* wgt_q); // 由量化步长/精度生成量化后的权重和BN参数
+static int32_t axi_generic_conv_quant_post_proc(const AxiGnrConvQuantRes* res, const AxiGnrConvQuantChn* chn,
+	int64_t acc, uint8_t* sat); // 计算量化后的最终结果(BN, 激活, 输出舍入)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  量化校准卷积层
+        用校准集选择量化参数, 生成INT16/INT8运算数据格式的配置参数、编译后的卷积核权重和BN参数,
+        并报告量化结果相对FP16参考模型的误差
+        INT8时要求加速器支持INT8逐通道重量化
+@param  prop 加速器属性(句柄)
+        layer 待量化的卷积层(句柄)
+        calib_ifmap 校准集的输入特征图(共calib_n个, 每个为FP32的[C][H][W])
+        calib_n 校准集大小
+        opt 量化选项(句柄)
+        res 量化结果(句柄)
+        kernal_packed 编译后的卷积核权重(至少axi_generic_conv_get_kernal_packed_size(prop, &res->cfg)个字节)
+        bn_param 生成的BN参数(共kernal_n个)
+        ref_ofmap FP16参考模型的输出特征图(共calib_n个, 每个为FP32的[K][OH][OW], 可作为下一层的校准集; 可为NULL)
+@return 是否成功
+*************************/
+int axi_generic_conv_quant_calibrate(const AxiGnrConvProp* prop, const AxiGnrConvQuantLayer* layer,
+	const float* const* calib_ifmap, uint32_t calib_n, const AxiGnrConvQuantOpt* opt,
+	AxiGnrConvQuantRes* res, void* kernal_packed, BNParam* bn_param, float* const* ref_ofmap){
+	const AxiGnrConvCfg* cfg = &layer->cfg;
+	AxiGnrConvQuantGeo geo;
+
+	if(calib_n == 0 || layer->kernal == NULL || (cfg->bn_act_cfg.use_bn_unit && layer->bn_param == NULL)){
+		return -1;
+	}
+
+	if(cfg->fmap_cfg.ofmap_data_type == CONV_O_1_BYTE || cfg->fmap_cfg.en_fused_max_pool || cfg->bn_act_cfg.en_residual_add ||
+		cfg->fmap_cfg.ofmap_chn_ofs || cfg->fmap_cfg.ofmap_row_pitch || cfg->fmap_cfg.ofmap_cgrp_pitch ||
+		cfg->fmap_cfg.ifmap_start_cgrp || cfg->fmap_cfg.ifmap_row_pitch || cfg->fmap_cfg.ifmap_cgrp_pitch){
+		return -1;
+	}
+
+	if(cfg->bn_act_cfg.act_func_type != ACT_FUNC_NONE && cfg->bn_act_cfg.act_func_type != ACT_FUNC_LEAKY_RELU){
+		return -1;
+	}
+
+	// 量化后的缩放与偏置均由BN单元完成
+	if(!prop->bn_supported){
+		return -1;
+	}
+
+	if(opt->cal_fmt == CONV_INT16){
+		if(!prop->int16_supported){
+			return -1;
+		}
+	}else if(opt->cal_fmt == CONV_INT8){
+		if((!prop->int8_supported) || (!prop->int8_requant_supported) || cfg->group_n > 1 ||
+			(cfg->bn_act_cfg.act_func_type == ACT_FUNC_LEAKY_RELU && cfg->bn_act_cfg.leaky_relu_param_alpha != 0.0f)){
+			return -1;
+		}
+	}else{
+		return -1;
+	}
+
+	if(axi_generic_conv_quant_get_geo(cfg, &geo)){
+		return -1;
+	}
+
+	uint32_t in_len = ((uint32_t)cfg->fmap_cfg.ifmap_chn_n) * geo.ifmap_plane_len;
+	uint32_t out_len = ((uint32_t)cfg->kernal_cfg.kernal_n) * geo.ofmap_plane_len;
+	uint32_t wgt_len = ((uint32_t)cfg->kernal_cfg.kernal_n) * geo.wgt_n_foreach_kernal;
+
+	AxiGnrConvQuantChn* chn = (AxiGnrConvQuantChn*)malloc(sizeof(AxiGnrConvQuantChn) * cfg->kernal_cfg.kernal_n);
+	double* x = (double*)malloc(sizeof(double) * in_len);
+	double* w = (double*)malloc(sizeof(double) * wgt_len);
+	double* y = (double*)malloc(sizeof(double) * out_len);
+	uint8_t* ovf = (uint8_t*)malloc(sizeof(uint8_t) * out_len);
+	float* ref_buf = (ref_ofmap == NULL) ? (float*)malloc(sizeof(float) * out_len * calib_n):NULL;
+	float** ref = (float**)malloc(sizeof(float*) * calib_n);
+	int ret = -1;
+
+	if(chn == NULL || x == NULL || w == NULL || y == NULL || ovf == NULL || ref == NULL || (ref_ofmap == NULL && ref_buf == NULL)){
+		goto quant_end;
+	}
+
+	for(uint32_t i = 0;i < calib_n;i++){
+		ref[i] = (ref_ofmap == NULL) ? (ref_buf + i * out_len):ref_ofmap[i];
+	}
+
+	// 用FP16参考模型计算期望输出
+	if(axi_generic_conv_quant_run_fp16(prop, layer, &geo, calib_ifmap, calib_n, opt->thread_n, ref)){
+		goto quant_end;
+	}
+
+	// 统计输入/输出特征图的最大绝对值, 以及每个卷积核的权重最大绝对值和Σ|x| * |w|
+	double in_max_abs = 0.0;
+	double out_max_abs = 0.0;
+
+	for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+		chn[k].wgt_max_abs = 0.0;
+		chn[k].acc_bound = 0.0;
+		chn[k].bn_a = cfg->bn_act_cfg.use_bn_unit ? (double)layer->bn_param[k].param_a:1.0;
+		chn[k].bn_b = cfg->bn_act_cfg.use_bn_unit ? (double)layer->bn_param[k].param_b:0.0;
+		chn[k].acc_ovf = 0;
+		chn[k].out_min = (cfg->bn_act_cfg.act_func_type == ACT_FUNC_LEAKY_RELU) ? 0:-128;
+
+		for(uint32_t i = 0;i < geo.wgt_n_foreach_kernal;i++){
+			double v = fabs((double)layer->kernal[k * geo.wgt_n_foreach_kernal + i]);
+
+			w[k * geo.wgt_n_foreach_kernal + i] = v;
+
+			if(v > chn[k].wgt_max_abs){
+				chn[k].wgt_max_abs = v;
+			}
+		}
+	}
+
+	for(uint32_t s = 0;s < calib_n;s++){
+		for(uint32_t i = 0;i < in_len;i++){
+			x[i] = fabs((double)calib_ifmap[s][i]);
+
+			if(x[i] > in_max_abs){
+				in_max_abs = x[i];
+			}
+		}
+
+		for(uint32_t i = 0;i < out_len;i++){
+			double v = fabs((double)ref[s][i]);
+
+			if(v > out_max_abs){
+				out_max_abs = v;
+			}
+		}
+
+		axi_generic_conv_quant_conv(&geo, x, w, 0, y, NULL);
+
+		for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+			for(uint32_t i = 0;i < geo.ofmap_plane_len;i++){
+				if(y[k * geo.ofmap_plane_len + i] > chn[k].acc_bound){
+					chn[k].acc_bound = y[k * geo.ofmap_plane_len + i];
+				}
+			}
+		}
+	}
+
+	// 选择输入/输出特征图的量化参数
+	memcpy((void*)&res->cfg, (const void*)cfg, sizeof(AxiGnrConvCfg));
+
+	res->cfg.cal_cfg.cal_fmt = opt->cal_fmt;
+	res->cfg.fmap_cfg.ofmap_data_type = (opt->cal_fmt == CONV_INT8) ? CONV_O_1_BYTE:CONV_O_2_BYTE;
+	res->cfg.bn_act_cfg.use_bn_unit = 1;
+	res->cfg.bn_act_cfg.bn_is_a_eq_1 = 0;
+	res->cfg.bn_act_cfg.bn_is_b_eq_0 = 0;
+	res->retry_n = 0;
+
+	if(opt->cal_fmt == CONV_INT16){
+		res->in_quat_accrc =
+			(opt->in_quat_accrc >= 0) ?
+				(uint8_t)opt->in_quat_accrc:
+				axi_generic_conv_quant_sel_quat_accrc(in_max_abs, 32767.0, AXI_GNR_CONV_QUANT_MAX_FMAP_QUAT_ACCRC);
+
+		// 输出在BN与激活时的量化精度为2倍的输出精度, 须同时满足16位输出和32位BN结果不溢出
+		res->out_quat_accrc = axi_generic_conv_quant_sel_quat_accrc(out_max_abs, 32767.0, AXI_GNR_CONV_QUANT_MAX_FMAP_QUAT_ACCRC);
+
+		while(res->out_quat_accrc > 0 && out_max_abs * ldexp(1.0, 2 * res->out_quat_accrc) > QUANT_S32_MAX){
+			res->out_quat_accrc--;
+		}
+
+		res->in_scale = (float)ldexp(1.0, -((int)res->in_quat_accrc));
+		res->out_scale = (float)ldexp(1.0, -((int)res->out_quat_accrc));
+
+		res->cfg.bn_act_cfg.en_int8_requant = 0;
+		// BN与激活的结果的量化精度为2倍的输出精度, 由输出舍入单元舍去输出精度位
+		res->cfg.bn_act_cfg.out_fixed_point_quat_accrc = res->out_quat_accrc;
+
+		if(res->cfg.bn_act_cfg.act_func_type == ACT_FUNC_LEAKY_RELU){
+			int32_t alpha = axi_generic_conv_quant_round_sat(
+				ldexp((double)cfg->bn_act_cfg.leaky_relu_param_alpha, AXI_GNR_CONV_QUANT_LEAKY_RELU_QUAT_ACCRC),
+				(int32_t)0x80000000, 0x7FFFFFFF);
+
+			// INT16时泄露Relu激活参数按位存放定点数
+			res->cfg.bn_act_cfg.leaky_relu_point_quat_accrc = AXI_GNR_CONV_QUANT_LEAKY_RELU_QUAT_ACCRC;
+			memcpy((void*)&res->cfg.bn_act_cfg.leaky_relu_param_alpha, (const void*)&alpha, 4);
+		}
+
+		// 初始的权重精度: 用满16位且Σ|x| * |w|不超过32位
+		for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+			uint8_t q = axi_generic_conv_quant_sel_quat_accrc(chn[k].wgt_max_abs, 32767.0, AXI_GNR_CONV_QUANT_MAX_WGT_QUAT_ACCRC);
+
+			while(q > 0 && chn[k].acc_bound * ldexp(1.0, (int)res->in_quat_accrc + (int)q) > QUANT_S32_MAX){
+				q--;
+			}
+
+			chn[k].wgt_scale = ldexp(1.0, -((int)q));
+		}
+	}else{
+		res->in_quat_accrc = 0;
+		res->out_quat_accrc = 0;
+		res->in_scale = (opt->in_scale > 0.0f) ? opt->in_scale:((in_max_abs > 0.0) ? (float)(in_max_abs / 127.0):1.0f);
+		res->out_scale = (out_max_abs > 0.0) ? (float)(out_max_abs / 127.0):1.0f;
+
+		// Relu由重量化的输出下限表示
+		res->cfg.bn_act_cfg.act_func_type = ACT_FUNC_NONE;
+		res->cfg.bn_act_cfg.bn_fixed_point_quat_accrc = 0;
+		res->cfg.bn_act_cfg.en_int8_requant = 1;
+		res->cfg.bn_act_cfg.out_fixed_point_quat_accrc = 0;
+
+		for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+			double s = (chn[k].wgt_max_abs > 0.0) ? (chn[k].wgt_max_abs / 127.0):1.0;
+			double s_min = chn[k].acc_bound / ((double)res->in_scale * QUANT_S32_MAX);
+
+			chn[k].wgt_scale = (s_min > s) ? s_min:s;
+		}
+	}
+
+	// 生成量化后的权重与BN参数, 按硬件的定点数据通路计算, 中间结果溢出时降低该卷积核的权重精度
+	// 每个通道组的通道数(INT8时每个硬件通道为1对INT8通道)
+	uint32_t cgrp_chn_n = (opt->cal_fmt == CONV_INT8) ? (((uint32_t)prop->atomic_c) * 2):((uint32_t)prop->atomic_c);
+	double sig_pwr;
+	double err_pwr;
+
+	while(1){
+		uint8_t retry = 0;
+
+		if(axi_generic_conv_quant_derive(&geo, res, chn, layer->kernal, w)){
+			goto quant_end;
+		}
+
+		sig_pwr = 0.0;
+		err_pwr = 0.0;
+		res->acc_ovf_n = 0;
+		res->out_sat_n = 0;
+		res->max_abs_err = 0.0;
+
+		for(uint32_t s = 0;s < calib_n;s++){
+			if(opt->cal_fmt == CONV_INT16){
+				double in_mul = ldexp(1.0, (int)res->in_quat_accrc);
+
+				for(uint32_t i = 0;i < in_len;i++){
+					x[i] = (double)axi_generic_conv_quant_round_sat((double)calib_ifmap[s][i] * in_mul, -32768, 32767);
+				}
+			}else{
+				for(uint32_t i = 0;i < in_len;i++){
+					x[i] = (double)axi_generic_conv_quant_round_sat((double)calib_ifmap[s][i] / (double)res->in_scale, -128, 127);
+				}
+			}
+
+			axi_generic_conv_quant_conv(&geo, x, w, cgrp_chn_n, y, ovf);
+
+			for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+				for(uint32_t i = 0;i < geo.ofmap_plane_len;i++){
+					int64_t acc = (int64_t)y[k * geo.ofmap_plane_len + i];
+					uint8_t sat = 0;
+
+					if(ovf[k * geo.ofmap_plane_len + i]){
+						res->acc_ovf_n++;
+
+						if(!chn[k].acc_ovf){
+							chn[k].acc_ovf = 1;
+							retry = 1;
+						}
+					}
+
+					int32_t o = axi_generic_conv_quant_post_proc(res, &chn[k], acc, &sat);
+					double v = (opt->cal_fmt == CONV_INT16) ? ldexp((double)o, -((int)res->out_quat_accrc)):((double)o * (double)res->out_scale);
+					double r = (double)ref[s][k * geo.ofmap_plane_len + i];
+					double e = fabs(v - r);
+
+					res->out_sat_n += sat;
+					sig_pwr += r * r;
+					err_pwr += e * e;
+
+					if(e > res->max_abs_err){
+						res->max_abs_err = e;
+					}
+				}
+			}
+		}
+
+		if((!retry) || res->retry_n >= AXI_GNR_CONV_QUANT_MAX_RETRY_N){
+			break;
+		}
+
+		// 降低溢出卷积核的权重精度后重新计算
+		for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+			if(chn[k].acc_ovf){
+				chn[k].wgt_scale *= 2.0;
+				chn[k].acc_ovf = 0;
+			}
+		}
+
+		res->retry_n++;
+	}
+
+	res->snr_db = (err_pwr > 0.0) ? (10.0 * log10(sig_pwr / err_pwr)):INFINITY;
+
+	// 生成BN参数
+	for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+		if(opt->cal_fmt == CONV_INT16){
+			// INT16时BN参数按位存放定点数
+			memcpy((void*)&bn_param[k].param_a, (const void*)&chn[k].param_a, 4);
+			memcpy((void*)&bn_param[k].param_b, (const void*)&chn[k].param_b, 4);
+		}else{
+			axi_generic_conv_set_bn_requant_param(&bn_param[k], chn[k].param_a, chn[k].shift, chn[k].zero_point,
+				chn[k].out_min, 127);
+		}
+	}
+
+	// 编译卷积核权重(INT8时每个16位数据为1对通道)
+	uint32_t pair_n = axi_generic_conv_get_hw_chn_n(opt->cal_fmt, geo.chn_n_foreach_kernal);
+	uint32_t kernal_plane_len = geo.kernal_len * geo.kernal_len;
+	uint16_t* wgt16 = (uint16_t*)malloc(sizeof(uint16_t) * cfg->kernal_cfg.kernal_n * pair_n * kernal_plane_len);
+	AxiGnrConvPackOpt pack_opt = {CONV_PACK_NCHW, CONV_PACK_INT16, NULL};
+
+	if(wgt16 == NULL){
+		goto quant_end;
+	}
+
+	for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+		for(uint32_t c = 0;c < pair_n;c++){
+			for(uint32_t p = 0;p < kernal_plane_len;p++){
+				const double* wk = w + k * geo.wgt_n_foreach_kernal;
+				uint16_t d;
+
+				if(opt->cal_fmt == CONV_INT16){
+					d = (uint16_t)((int16_t)wk[c * kernal_plane_len + p]);
+				}else{
+					uint8_t lo = (uint8_t)((int8_t)wk[(c * 2) * kernal_plane_len + p]);
+					uint8_t hi =
+						((c * 2 + 1) < geo.chn_n_foreach_kernal) ?
+							(uint8_t)((int8_t)wk[(c * 2 + 1) * kernal_plane_len + p]):
+							0x00;
+
+					d = ((uint16_t)lo) | (((uint16_t)hi) << 8);
+				}
+
+				wgt16[(k * pair_n + c) * kernal_plane_len + p] = d;
+			}
+		}
+	}
+
+	ret = axi_generic_conv_compile_kernal(prop, &res->cfg, (const void*)wgt16, kernal_packed, &pack_opt);
+
+	free(wgt16);
+
+quant_end:
+	free(chn);
+	free(x);
+	free(w);
+	free(y);
+	free(ovf);
+	free(ref_buf);
+	free(ref);
+
+	return ret;
+}
+
+/*************************
+@cfg
+@public
+@brief  量化输入特征图
+        结果可用axi_generic_conv_pack_ifmap(数据类型为CONV_PACK_INT16)重排到加速器
+@param  res 量化结果(句柄)
+        src FP32的输入特征图([C][H][W])
+        dst 量化后的输入特征图(INT16时为[C][H][W], INT8时为[(C + 1) / 2][H][W], 每个16位数据为1对通道)
+        chn_n 通道数
+        plane_len 每个通道的平面大小(高 * 宽)
+@return 是否成功
+*************************/
+int axi_generic_conv_quant_ifmap(const AxiGnrConvQuantRes* res, const float* src, uint16_t* dst,
+	uint32_t chn_n, uint32_t plane_len){
+	if(res->cfg.cal_cfg.cal_fmt == CONV_INT16){
+		double in_mul = ldexp(1.0, (int)res->in_quat_accrc);
+
+		for(uint32_t i = 0;i < chn_n * plane_len;i++){
+			dst[i] = (uint16_t)((int16_t)axi_generic_conv_quant_round_sat((double)src[i] * in_mul, -32768, 32767));
+		}
+	}else if(res->cfg.cal_cfg.cal_fmt == CONV_INT8){
+		for(uint32_t c = 0;c < chn_n;c += 2){
+			for(uint32_t p = 0;p < plane_len;p++){
+				uint8_t lo = (uint8_t)((int8_t)axi_generic_conv_quant_round_sat(
+					(double)src[c * plane_len + p] / (double)res->in_scale, -128, 127));
+				uint8_t hi =
+					((c + 1) < chn_n) ?
+						(uint8_t)((int8_t)axi_generic_conv_quant_round_sat(
+							(double)src[(c + 1) * plane_len + p] / (double)res->in_scale, -128, 127)):
+						0x00;
+
+				dst[(c / 2) * plane_len + p] = ((uint16_t)lo) | (((uint16_t)hi) << 8);
+			}
+		}
+	}else{
+		return -1;
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  反量化输出特征图
+@param  res 量化结果(句柄)
+        src 加速器的输出特征图(经axi_generic_conv_unpack_ofmap重排为标准张量,
+            INT16时为[C][H][W], INT8时为[(C + 1) / 2][H][W], 每个16位数据为1对通道)
+        dst FP32的输出特征图([C][H][W])
+        chn_n 通道数
+        plane_len 每个通道的平面大小(高 * 宽)
+@return none
+*************************/
+void axi_generic_conv_quant_dequant_ofmap(const AxiGnrConvQuantRes* res, const uint16_t* src, float* dst,
+	uint32_t chn_n, uint32_t plane_len){
+	for(uint32_t c = 0;c < chn_n;c++){
+		for(uint32_t p = 0;p < plane_len;p++){
+			if(res->cfg.cal_cfg.cal_fmt == CONV_INT16){
+				dst[c * plane_len + p] = (float)ldexp((double)((int16_t)src[c * plane_len + p]), -((int)res->out_quat_accrc));
+			}else{
+				dst[c * plane_len + p] =
+					(float)((double)((int8_t)(src[(c / 2) * plane_len + p] >> ((c % 2) * 8))) * (double)res->out_scale);
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@private
+@brief  获取卷积层几何参数
+@param  cfg 配置参数(句柄)
+        geo 卷积层几何参数(句柄)
+@return 是否成功
+*************************/
+static int axi_generic_conv_quant_get_geo(const AxiGnrConvCfg* cfg, AxiGnrConvQuantGeo* geo){
+	if(cfg->group_n == 0 || cfg->kernal_cfg.kernal_n == 0 || (cfg->kernal_cfg.kernal_n % cfg->group_n) ||
+		(cfg->fmap_cfg.ifmap_chn_n % cfg->group_n) || cfg->fmap_cfg.ifmap_width == 0 || cfg->fmap_cfg.ifmap_height == 0 ||
+		cfg->cal_cfg.conv_horizontal_stride == 0 || cfg->cal_cfg.conv_vertical_stride == 0){
+		return -1;
+	}
+
+	switch(cfg->kernal_cfg.kernal_shape){
+	case CONV_KRN_1x1: geo->kernal_len = 1;break;
+	case CONV_KRN_3x3: geo->kernal_len = 3;break;
+	case CONV_KRN_5x5: geo->kernal_len = 5;break;
+	case CONV_KRN_7x7: geo->kernal_len = 7;break;
+	case CONV_KRN_9x9: geo->kernal_len = 9;break;
+	case CONV_KRN_11x11: geo->kernal_len = 11;break;
+	case CONV_KRN_4x4: geo->kernal_len = 4;break;
+	case CONV_KRN_2x2: geo->kernal_len = 2;break;
+	default: return -1;
+	}
+
+	uint32_t dilated_kernal_len = geo->kernal_len + (geo->kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
+	uint32_t ext_fmap_w =
+		((uint32_t)cfg->fmap_cfg.ifmap_width) +
+		((uint32_t)cfg->fmap_cfg.external_padding_left) + ((uint32_t)cfg->fmap_cfg.external_padding_right) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_left_right);
+	uint32_t ext_fmap_h =
+		((uint32_t)cfg->fmap_cfg.ifmap_height) +
+		((uint32_t)cfg->fmap_cfg.external_padding_top) + ((uint32_t)cfg->fmap_cfg.external_padding_bottom) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_height - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom);
+
+	if(ext_fmap_w < dilated_kernal_len || ext_fmap_h < dilated_kernal_len){
+		return -1;
+	}
+
+	geo->cfg = cfg;
+	geo->ifmap_plane_len = ((uint32_t)cfg->fmap_cfg.ifmap_width) * ((uint32_t)cfg->fmap_cfg.ifmap_height);
+	geo->ofmap_w = (ext_fmap_w - dilated_kernal_len) / cfg->cal_cfg.conv_horizontal_stride + 1;
+	geo->ofmap_h = (ext_fmap_h - dilated_kernal_len) / cfg->cal_cfg.conv_vertical_stride + 1;
+	geo->ofmap_plane_len = geo->ofmap_w * geo->ofmap_h;
+	geo->chn_n_foreach_kernal = ((uint32_t)cfg->fmap_cfg.ifmap_chn_n) / cfg->group_n;
+	geo->kernal_n_foreach_group = ((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n;
+	geo->wgt_n_foreach_kernal = geo->chn_n_foreach_kernal * geo->kernal_len * geo->kernal_len;
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  扩展特征图坐标转原始坐标
+@param  logic 扩展特征图坐标
+        ext_padding 前端外填充数
+        inner_padding 内填充数
+        len 原始特征图边长
+        phy 原始坐标(指针)
+@return 是否位于填充区
+*************************/
+static int axi_generic_conv_quant_logic_to_phy(
+	uint32_t logic, uint32_t ext_padding, uint32_t inner_padding, uint32_t len, uint32_t* phy){
+	if(logic < ext_padding){
+		return -1;
+	}
+
+	uint32_t ofs = logic - ext_padding;
+
+	if(ofs % (inner_padding + 1)){
+		return -1;
+	}
+
+	if(ofs / (inner_padding + 1) >= len){
+		return -1;
+	}
+
+	*phy = ofs / (inner_padding + 1);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  卷积
+        填充区按0参与计算
+        cgrp_chn_n为0时不作饱和化处理;
+        否则按硬件的累加顺序(依次遍历通道组、卷积核行、卷积核列)把每个通道组的部分和逐步累加并饱和到32位
+@param  geo 卷积层几何参数(句柄)
+        x 输入特征图([C][H][W])
+        w 卷积核权重([K][C][R][S], 组卷积时C为每组通道数)
+        cgrp_chn_n 每个通道组的通道数(0表示不作饱和化处理)
+        y 输出特征图([K][OH][OW])
+        ovf 累加过程中是否发生过饱和(标志数组[K][OH][OW], cgrp_chn_n为0时可为NULL)
+@return none
+*************************/
+static void axi_generic_conv_quant_conv(const AxiGnrConvQuantGeo* geo, const double* x, const double* w,
+	uint32_t cgrp_chn_n, double* y, uint8_t* ovf){
+	const AxiGnrConvCfg* cfg = geo->cfg;
+	uint32_t kernal_step = ((uint32_t)cfg->kernal_cfg.dilation_n) + 1;
+	int32_t row_tap[11]; // 每个卷积核行对应的输入行号(-1表示位于填充区)
+	int32_t col_tap[11]; // 每个卷积核列对应的输入列号(-1表示位于填充区)
+
+	for(uint32_t oy = 0;oy < geo->ofmap_h;oy++){
+		for(uint32_t r = 0;r < geo->kernal_len;r++){
+			uint32_t phy;
+
+			row_tap[r] =
+				axi_generic_conv_quant_logic_to_phy(
+					oy * cfg->cal_cfg.conv_vertical_stride + r * kernal_step,
+					cfg->fmap_cfg.external_padding_top, cfg->fmap_cfg.inner_padding_top_bottom, cfg->fmap_cfg.ifmap_height, &phy) ?
+					-1:(int32_t)phy;
+		}
+
+		for(uint32_t ox = 0;ox < geo->ofmap_w;ox++){
+			for(uint32_t s = 0;s < geo->kernal_len;s++){
+				uint32_t phy;
+
+				col_tap[s] =
+					axi_generic_conv_quant_logic_to_phy(
+						ox * cfg->cal_cfg.conv_horizontal_stride + s * kernal_step,
+						cfg->fmap_cfg.external_padding_left, cfg->fmap_cfg.inner_padding_left_right, cfg->fmap_cfg.ifmap_width, &phy) ?
+						-1:(int32_t)phy;
+			}
+
+			for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+				uint32_t chn_base = (k / geo->kernal_n_foreach_group) * geo->chn_n_foreach_kernal;
+				uint32_t chn_step = (cgrp_chn_n == 0) ? geo->chn_n_foreach_kernal:cgrp_chn_n;
+				uint32_t out_id = k * geo->ofmap_plane_len + oy * geo->ofmap_w + ox;
+				double sum = 0.0;
+				int64_t acc = 0;
+				uint8_t acc_ovf = 0;
+
+				for(uint32_t c0 = 0;c0 < geo->chn_n_foreach_kernal;c0 += chn_step){
+					uint32_t c1 = (c0 + chn_step > geo->chn_n_foreach_kernal) ? geo->chn_n_foreach_kernal:(c0 + chn_step);
+
+					for(uint32_t r = 0;r < geo->kernal_len;r++){
+						if(row_tap[r] < 0){
+							continue;
+						}
+
+						for(uint32_t s = 0;s < geo->kernal_len;s++){
+							if(col_tap[s] < 0){
+								continue;
+							}
+
+							// 通道组的部分和
+							double part = 0.0;
+
+							for(uint32_t c = c0;c < c1;c++){
+								part += x[(chn_base + c) * geo->ifmap_plane_len +
+									((uint32_t)row_tap[r]) * cfg->fmap_cfg.ifmap_width + ((uint32_t)col_tap[s])] *
+									w[((k * geo->chn_n_foreach_kernal + c) * geo->kernal_len + r) * geo->kernal_len + s];
+							}
+
+							if(cgrp_chn_n == 0){
+								sum += part;
+							}else{
+								int64_t t = acc + (int64_t)part;
+
+								acc = axi_generic_conv_quant_sat32(t);
+								acc_ovf |= (acc != t) ? 1:0;
+							}
+						}
+					}
+				}
+
+				if(cgrp_chn_n == 0){
+					y[out_id] = sum;
+				}else{
+					y[out_id] = (double)acc;
+					ovf[out_id] = acc_ovf;
+				}
+			}
+		}
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  四舍五入并饱和化
+@param  v 待量化的值
+        min 下限
+        max 上限
+@return 量化后的值
+*************************/
+static int32_t axi_generic_conv_quant_round_sat(double v, int32_t min, int32_t max){
+	double r = floor(v + 0.5);
+
+	if(r < (double)min){
+		return min;
+	}else if(r > (double)max){
+		return max;
+	}else{
+		return (int32_t)r;
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  限制到32位有符号数
+@param  v 待限制的值
+@return 限制后的值
+*************************/
+static int64_t axi_generic_conv_quant_sat32(int64_t v){
+	if(v > (int64_t)0x7FFFFFFF){
+		return (int64_t)0x7FFFFFFF;
+	}else if(v < -((int64_t)0x80000000)){
+		return -((int64_t)0x80000000);
+	}else{
+		return v;
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  选择定点数量化精度
+@param  max_abs 最大绝对值
+        lmt 量化后的上限
+        max_q 量化精度的上限
+@return 满足max_abs * 2 ^ q <= lmt的最大量化精度q
+*************************/
+static uint8_t axi_generic_conv_quant_sel_quat_accrc(double max_abs, double lmt, uint8_t max_q){
+	uint8_t q = 0;
+
+	while(q < max_q && max_abs * ldexp(1.0, (int)q + 1) <= lmt){
+		q++;
+	}
+
+	return q;
+}
+
+/*************************
+@cfg
+@private
+@brief  用FP16参考模型计算期望输出
+@param  prop 加速器属性(句柄)
+        layer 待量化的卷积层(句柄)
+        geo 卷积层几何参数(句柄)
+        calib_ifmap 校准集的输入特征图
+        calib_n 校准集大小
+        thread_n 计算线程数
+        ref_ofmap 期望的输出特征图(FP32的[K][OH][OW])
+@return 是否成功
+*************************/
+static int axi_generic_conv_quant_run_fp16(const AxiGnrConvProp* prop, const AxiGnrConvQuantLayer* layer,
+	const AxiGnrConvQuantGeo* geo, const float* const* calib_ifmap, uint32_t calib_n,
+	uint32_t thread_n, float* const* ref_ofmap){
+	AxiGnrConvCfg cfg;
+	AxiGnrConvPackOpt pack_opt = {CONV_PACK_NCHW, CONV_PACK_FP32, NULL};
+
+	memcpy((void*)&cfg, (const void*)&layer->cfg, sizeof(AxiGnrConvCfg));
+	cfg.cal_cfg.cal_fmt = CONV_FP16;
+
+	uint32_t ofmap_byte_n = ((uint32_t)cfg.kernal_cfg.kernal_n) * geo->ofmap_plane_len *
+		((cfg.fmap_cfg.ofmap_data_type == CONV_O_2_BYTE) ? 2:4);
+	uint32_t kernal_byte_n = axi_generic_conv_get_kernal_packed_size(prop, &cfg);
+
+	cfg.ifmap_baseaddr = (uint8_t*)malloc(((uint32_t)cfg.fmap_cfg.ifmap_chn_n) * geo->ifmap_plane_len * 2);
+	cfg.kernal_wgt_baseaddr = (uint8_t*)malloc(kernal_byte_n);
+	cfg.ofmap_baseaddr = (uint8_t*)malloc(ofmap_byte_n);
+
+	int ret = -1;
+
+	if(cfg.ifmap_baseaddr == NULL || cfg.kernal_wgt_baseaddr == NULL || cfg.ofmap_baseaddr == NULL || kernal_byte_n == 0){
+		goto run_fp16_end;
+	}
+
+	if(axi_generic_conv_pack_kernal(prop, &cfg, (const void*)layer->kernal, &pack_opt)){
+		goto run_fp16_end;
+	}
+
+	for(uint32_t s = 0;s < calib_n;s++){
+		if(axi_generic_conv_pack_ifmap(prop, &cfg, (const void*)calib_ifmap[s], &pack_opt) ||
+			axi_generic_conv_ref_run(prop, &cfg, layer->bn_param, NULL, thread_n) ||
+			axi_generic_conv_unpack_ofmap(prop, &cfg, (void*)ref_ofmap[s], &pack_opt)){
+			goto run_fp16_end;
+		}
+	}
+
+	ret = 0;
+
+run_fp16_end:
+	free(cfg.ifmap_baseaddr);
+	free(cfg.kernal_wgt_baseaddr);
+	free(cfg.ofmap_baseaddr);
+
+	return ret;
+}
+
+/*************************
+@cfg
+@private
+@brief  由量化步长/精度生成量化后的权重和BN参数
+        INT16: 权重精度为q_w时, 卷积结果的精度为q_in + q_w, 而BN与激活的结果须为2倍的输出精度,
+               故A' = A * 2 ^ (2 * q_out - q_in - q_w), B' = B * 2 ^ (2 * q_out), A'的精度对所有卷积核相同
+        INT8:  重量化的缩放系数为A * 输入步长 * 权重步长 / 输出步长, B折算为输出偏置
+@param  geo 卷积层几何参数(句柄)
+        res 量化结果(句柄)
+        chn 逐通道量化参数(数组)
+        kernal FP32的卷积核权重
+        wgt_q 量化后的卷积核权重
+@return 是否成功
+*************************/
+static int axi_generic_conv_quant_derive(const AxiGnrConvQuantGeo* geo, AxiGnrConvQuantRes* res,
+	AxiGnrConvQuantChn* chn, const float* kernal, double* wgt_q){
+	uint32_t kernal_n = res->cfg.kernal_cfg.kernal_n;
+	int32_t wgt_max = (res->cfg.cal_cfg.cal_fmt == CONV_INT16) ? 32767:127;
+
+	for(uint32_t k = 0;k < kernal_n;k++){
+		for(uint32_t i = 0;i < geo->wgt_n_foreach_kernal;i++){
+			wgt_q[k * geo->wgt_n_foreach_kernal + i] = (double)axi_generic_conv_quant_round_sat(
+				(double)kernal[k * geo->wgt_n_foreach_kernal + i] / chn[k].wgt_scale, -wgt_max - 1, wgt_max);
+		}
+	}
+
+	if(res->cfg.cal_cfg.cal_fmt == CONV_INT16){
+		double a_max_abs = 0.0;
+
+		for(uint32_t k = 0;k < kernal_n;k++){
+			double a = fabs(chn[k].bn_a * chn[k].wgt_scale * ldexp(1.0, 2 * (int)res->out_quat_accrc - (int)res->in_quat_accrc));
+
+			if(a > a_max_abs){
+				a_max_abs = a;
+			}
+		}
+
+		uint8_t qa = axi_generic_conv_quant_sel_quat_accrc(a_max_abs, QUANT_S32_MAX, 31);
+
+		res->cfg.bn_act_cfg.bn_fixed_point_quat_accrc = qa;
+
+		for(uint32_t k = 0;k < kernal_n;k++){
+			chn[k].param_a = axi_generic_conv_quant_round_sat(
+				chn[k].bn_a * chn[k].wgt_scale * ldexp(1.0, 2 * (int)res->out_quat_accrc - (int)res->in_quat_accrc + (int)qa),
+				(int32_t)0x80000000, 0x7FFFFFFF);
+			chn[k].param_b = axi_generic_conv_quant_round_sat(
+				chn[k].bn_b * ldexp(1.0, 2 * (int)res->out_quat_accrc), (int32_t)0x80000000, 0x7FFFFFFF);
+		}
+	}else{
+		for(uint32_t k = 0;k < kernal_n;k++){
+			double scale = chn[k].bn_a * (double)res->in_scale * chn[k].wgt_scale / (double)res->out_scale;
+			int32_t multiplier = 0;
+			uint8_t shift = 0;
+
+			if(scale != 0.0 && axi_generic_conv_quantize_requant_scale((float)fabs(scale), &multiplier, &shift)){
+				return -1;
+			}
+
+			chn[k].param_a = (scale < 0.0) ? -multiplier:multiplier;
+			chn[k].shift = shift;
+			chn[k].zero_point = (int8_t)axi_generic_conv_quant_round_sat(chn[k].bn_b / (double)res->out_scale, -128, 127);
+		}
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  计算量化后的最终结果(BN, 激活, 输出舍入)
+        与batch_nml_mac_cell、leaky_relu_cell和out_round_cell的定点数据通路逐位一致
+@param  res 量化结果(句柄)
+        chn 逐通道量化参数(句柄)
+        acc 卷积的32位累加结果
+        sat 是否饱和(指针)
+@return 量化后的最终结果(INT16时为s16, INT8时为s8)
+*************************/
+static int32_t axi_generic_conv_quant_post_proc(const AxiGnrConvQuantRes* res, const AxiGnrConvQuantChn* chn,
+	int64_t acc, uint8_t* sat){
+	if(res->cfg.cal_cfg.cal_fmt == CONV_INT8){
+		// INT8逐通道重量化: 与驱动的参考计算共用同一实现
+		BNParam param;
+
+		axi_generic_conv_set_bn_requant_param(&param, chn->param_a, chn->shift, chn->zero_point, chn->out_min, 127);
+
+		return axi_generic_conv_cal_requant(&param, (int32_t)acc, sat);
+	}
+
+	// 批归一化(INT32): sat32(sat32((A * X) >>> qa) + B)
+	int64_t bn =
+		axi_generic_conv_quant_sat32(
+			axi_generic_conv_quant_sat32((((int64_t)chn->param_a) * acc) >> res->cfg.bn_act_cfg.bn_fixed_point_quat_accrc) +
+			(int64_t)chn->param_b
+		);
+
+	// 泄露Relu激活(INT32)
+	if(res->cfg.bn_act_cfg.act_func_type == ACT_FUNC_LEAKY_RELU && bn < 0){
+		int32_t alpha_fixed;
+
+		memcpy((void*)&alpha_fixed, (const void*)&res->cfg.bn_act_cfg.leaky_relu_param_alpha, 4);
+
+		int64_t alpha = (int64_t)alpha_fixed;
+
+		bn = axi_generic_conv_quant_sat32((alpha * bn) >> res->cfg.bn_act_cfg.leaky_relu_point_quat_accrc);
+	}
+
+	// 输出舍入(S33转S16): 舍入位数为输出舍入单元的定点数量化精度(即输出精度), 向最近偶数舍入
+	uint32_t digits = res->cfg.bn_act_cfg.out_fixed_point_quat_accrc;
+	int64_t v = bn;
+
+	if(digits != 0){
+		uint8_t carry =
+			((bn >> (digits - 1)) & 1) &&
+			((bn & ((((int64_t)1) << (digits - 1)) - 1)) || ((bn >> digits) & 1));
+
+		v = (bn >> digits) + carry;
+	}
+
+	*sat = (v < -32768 || v > 32767) ? 1:0;
+
+	return (int32_t)((v < -32768) ? -32768:((v > 32767) ? 32767:v));
+}
@@ -0,0 +1,75 @@
+/************************************************************************************************************************
+通用卷积处理单元离线量化校准工具(接口头文件)
+@brief  在主机上用校准集为INT16/INT8运算数据格式选择量化参数, 生成加速器可直接使用的卷积核权重、BN参数和配置参数:
+            INT16: 逐层选择输入/输出特征图的定点数量化精度, 逐通道选择卷积核权重的定点数量化精度,
+                   并把权重的逐通道缩放与浮点BN参数折算为INT32批归一化的参数A/B
+            INT8:  逐层选择输入/输出特征图的量化步长(对称量化), 逐通道选择卷积核权重的量化步长,
+                   并通过INT8逐通道重量化把缩放、BN与Relu折算为每个通道的定点乘数/右移位数/偏置/上下限
+        选择精度时保证卷积的32位中间结果不溢出; 量化后的结果按硬件的定点数据通路(包括按累加顺序逐步饱和的32位累加)逐位精确地计算,
+        并与FP16参考模型的结果比较, 报告每层的信噪比和最大绝对误差
+        标准张量均为NCHW布局
+        注意: 不支持Sigmoid/Tanh激活、融合2x2最大池化、融合残差相加和输入/输出特征图跨距, INT8时仅支持alpha为0的Leaky-Relu(即Relu)
+@date   2026/10/17
+@author 陈家耀
+@eidt   2026.10.17 1.00 创建了第1个正式版本
+        2026.10.17 1.01 卷积按硬件的累加顺序逐步饱和, 量化结果给出输出舍入单元的定点数量化精度
+        2026.10.17 1.02 INT8时输出1字节输出特征图(按通道对存储), 反量化输出特征图时给出通道数和平面大小
+************************************************************************************************************************/
+
+#include "axi_generic_conv.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 特征图定点数量化精度的上限(输出舍入单元的定点数量化精度为4位)
+#define AXI_GNR_CONV_QUANT_MAX_FMAP_QUAT_ACCRC 15
+// 卷积核权重定点数量化精度的上限
+#define AXI_GNR_CONV_QUANT_MAX_WGT_QUAT_ACCRC 30
+// (INT16时)泄露Relu激活参数的定点数量化精度
+#define AXI_GNR_CONV_QUANT_LEAKY_RELU_QUAT_ACCRC 16
+// 因32位中间结果溢出而重新选择权重精度的最大次数
+#define AXI_GNR_CONV_QUANT_MAX_RETRY_N 8
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 待量化的卷积层
+typedef struct{
+	/*
+	浮点卷积层的配置参数: 几何形状、缓存划分、BN与激活字段与FP16运算数据格式时相同(cal_cfg.cal_fmt被忽略),
+	输出特征图数据类型须为2字节或4字节, 基地址字段不使用
+	*/
+	AxiGnrConvCfg cfg;
+	const float* kernal; // 卷积核权重([K][C][R][S], 组卷积时C为每组通道数)
+	const BNParam* bn_param; // 浮点BN参数(共kernal_n个, 不使用BN单元时可为NULL)
+}AxiGnrConvQuantLayer;
+
+// 结构体: 量化选项
+typedef struct{
+	AxiGnrConvCalFmt cal_fmt; // 目标运算数据格式(CONV_INT16或CONV_INT8)
+	int8_t in_quat_accrc; // INT16: 输入特征图的定点数量化精度(为负数时由校准集统计, 逐层量化时应取上一层的输出精度)
+	float in_scale; // INT8: 输入特征图的量化步长(为0时由校准集统计, 逐层量化时应取上一层的输出步长)
+	uint32_t thread_n; // FP16参考模型的计算线程数
+}AxiGnrConvQuantOpt;
+
+// 结构体: 量化结果
+typedef struct{
+	AxiGnrConvCfg cfg; // 配置参数(已填好运算数据格式、BN与激活字段, 其余字段沿用浮点配置)
+	uint8_t in_quat_accrc; // INT16: 输入特征图的定点数量化精度
+	uint8_t out_quat_accrc; // INT16: 输出特征图的定点数量化精度(即输出舍入单元的定点数量化精度)
+	float in_scale; // INT8: 输入特征图的量化步长
+	float out_scale; // INT8: 输出特征图的量化步长
+	uint32_t retry_n; // 因32位中间结果溢出而重新选择权重精度的次数
+	uint32_t acc_ovf_n; // 32位中间结果溢出的特征点数(累加过程中的任一步发生饱和)
+	uint32_t out_sat_n; // 输出饱和的特征点数
+	double snr_db; // 相对FP16参考模型的信噪比(dB)
+	double max_abs_err; // 相对FP16参考模型的最大绝对误差
+}AxiGnrConvQuantRes;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int axi_generic_conv_quant_calibrate(const AxiGnrConvProp* prop, const AxiGnrConvQuantLayer* layer,
+	const float* const* calib_ifmap, uint32_t calib_n, const AxiGnrConvQuantOpt* opt,
+	AxiGnrConvQuantRes* res, void* kernal_packed, BNParam* bn_param, float* const* ref_ofmap); // 量化校准卷积层
+int axi_generic_conv_quant_ifmap(const AxiGnrConvQuantRes* res, const float* src, uint16_t* dst,
+	uint32_t chn_n, uint32_t plane_len); // 量化输入特征图
+void axi_generic_conv_quant_dequant_ofmap(const AxiGnrConvQuantRes* res, const uint16_t* src, float* dst,
+	uint32_t chn_n, uint32_t plane_len); // 反量化输出特征图
@@ -0,0 +1,776 @@
+/************************************************************************************************************************
+通用卷积处理单元参考模型
+@brief  在主机上按位精确地复现通用卷积处理单元的运算数据通路, 用于快速生成期望输出
+        各运算环节与硬件子模块一一对应:
+            conv_mac_cell(FP16) -> conv_middle_res_accumulate(FP43 + FP32) -> batch_nml_mac_cell(FP32) ->
+            leaky_relu_cell/sigmoid_tanh_cell(FP32) -> out_round_cell(FP32转FP16)
+        累加顺序与conv_middle_res_info_packer相同: 对每个输出点, 依次遍历通道组 -> 有效卷积核行 -> 卷积核列,
+        位于填充区的卷积核行被整行跳过, 位于填充区的卷积核列作为被掩码的表面参与累加
+        按输出特征图的行划分给多个线程并行计算
+        注意: 仅支持FP16运算数据格式(默认硬件配置下INT8/INT16均未使能), 不支持融合2x2最大池化、融合残差相加和输入/输出特征图跨距
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.17 1.01 不支持融合2x2最大池化
+        2026.10.17 1.02 不支持融合残差相加
+        2026.10.17 1.03 不支持输出特征图跨距
+        2026.10.17 1.04 不支持输入特征图跨距
+************************************************************************************************************************/
+
+#include "axi_generic_conv_ref_model.h"
+
+#include <pthread.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 卷积层几何参数
+typedef struct{
+	const AxiGnrConvCfg* cfg; // 配置参数(句柄)
+	const BNParam* bn_param_buf; // BN参数(不使用BN单元时可为NULL)
+	const uint16_t* sigmoid_lut; // Sigmoid函数值查找表(不使用Sigmoid/Tanh激活时可为NULL)
+
+	uint32_t atomic_k; // 核并行数
+	uint32_t atomic_c; // 通道并行数
+
+	uint32_t kernal_len; // 卷积核边长
+	uint32_t ofmap_w; // 输出特征图宽度
+	uint32_t ofmap_h; // 输出特征图高度
+	uint32_t ofmap_data_byte_n; // 每个输出特征点的字节数
+
+	uint32_t set_w; // 核组宽度(非组卷积时为权重块最大宽度, 组卷积时为每组核数)
+	uint32_t chn_n_foreach_set; // 每个核组的通道数
+}AxiGnrConvRefLayer;
+
+// 结构体: 计算线程参数
+typedef struct{
+	const AxiGnrConvRefLayer* layer; // 卷积层几何参数(句柄)
+	uint32_t ofmap_y_start; // 起始输出行号
+	uint32_t ofmap_y_end; // 结束输出行号(不含)
+}AxiGnrConvRefThreadArg;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int64_t axi_generic_conv_ref_sext(uint64_t v, uint32_t bit_n); // 符号扩展
+static int32_t axi_generic_conv_ref_fp32_exp(uint32_t x); // 获取FP32的绝对指数
+static int64_t axi_generic_conv_ref_fp32_frac(uint32_t x); // 获取FP32的补码尾数(Q23)
+static uint32_t axi_generic_conv_ref_pack_fp32(uint32_t frac, int32_t exp); // 将已标准化的补码尾数打包为FP32
+static void axi_generic_conv_ref_mac_fp16(
+	const uint16_t* ftm, const uint16_t* wgt, uint32_t depth, int64_t* frac, uint32_t* exp); // 乘加阵列(FP16)
+static uint32_t axi_generic_conv_ref_acmlt_fp16(uint32_t org, int64_t in_frac, uint32_t in_exp, uint8_t first); // 中间结果累加(FP16)
+static uint32_t axi_generic_conv_ref_bn_fp32(uint32_t x, uint32_t a, uint32_t b, uint8_t a_eq_1, uint8_t b_eq_0); // 批归一化(FP32)
+static uint32_t axi_generic_conv_ref_leaky_relu_fp32(uint32_t x, uint32_t alpha); // Leaky-Relu激活(FP32)
+static uint32_t axi_generic_conv_ref_sigmoid_tanh_fp32(uint32_t x, const uint16_t* lut, uint8_t is_tanh); // Sigmoid/Tanh激活(FP32)
+static uint16_t axi_generic_conv_ref_round_fp16(uint32_t x); // 输出舍入(FP32转FP16)
+static int axi_generic_conv_ref_logic_to_phy(
+	uint32_t logic, uint32_t ext_padding, uint32_t inner_padding, uint32_t len, uint32_t* phy); // 扩展特征图坐标转原始坐标
+static void* axi_generic_conv_ref_thread(void* arg); // 计算线程
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  运行参考模型
+        从cfg->ifmap_baseaddr和cfg->kernal_wgt_baseaddr读取输入特征图和卷积核权重(存储格式与硬件相同),
+        将输出特征图写到cfg->ofmap_baseaddr
+        注意: 激活函数为Leaky-Relu且输入为-0时, 硬件会使用上一次的乘法结果, 本模型视为+0
+@param  prop 加速器属性(句柄, 仅使用核并行数和通道并行数)
+        cfg 配置参数(句柄)
+        bn_param_buf 整个卷积层的BN参数(共kernal_n个, 不使用BN单元时可为NULL)
+        sigmoid_lut Sigmoid函数值查找表(共4096项, 不使用Sigmoid/Tanh激活时可为NULL)
+        thread_n 计算线程数(0或1表示在调用者线程中计算)
+@return 是否成功
+*************************/
+int axi_generic_conv_ref_run(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const BNParam* bn_param_buf, const uint16_t* sigmoid_lut, uint32_t thread_n){
+	AxiGnrConvRefLayer layer;
+
+	if(cfg->cal_cfg.cal_fmt != CONV_FP16 || cfg->fmap_cfg.ofmap_data_type == CONV_O_1_BYTE || cfg->fmap_cfg.en_fused_max_pool ||
+		cfg->bn_act_cfg.en_residual_add || cfg->fmap_cfg.ofmap_chn_ofs || cfg->fmap_cfg.ofmap_row_pitch || cfg->fmap_cfg.ofmap_cgrp_pitch ||
+		cfg->fmap_cfg.ifmap_start_cgrp || cfg->fmap_cfg.ifmap_row_pitch || cfg->fmap_cfg.ifmap_cgrp_pitch){
+		return -1;
+	}
+
+	if(prop->atomic_k == 0 || prop->atomic_c == 0 || cfg->group_n == 0 || cfg->max_wgtblk_w == 0 ||
+		cfg->cal_cfg.conv_horizontal_stride == 0 || cfg->cal_cfg.conv_vertical_stride == 0 ||
+		cfg->fmap_cfg.ifmap_width == 0 || cfg->fmap_cfg.ifmap_height == 0 ||
+		cfg->kernal_cfg.kernal_n == 0 || (cfg->kernal_cfg.kernal_n % cfg->group_n)){
+		return -1;
+	}
+
+	if(cfg->group_n > 1 &&
+		(cfg->fmap_cfg.ifmap_chn_n != cfg->kernal_cfg.kernal_n || cfg->kernal_cfg.kernal_chn_n != cfg->kernal_cfg.kernal_n)){
+		return -1;
+	}
+
+	if(cfg->group_n == 1 && cfg->fmap_cfg.ifmap_chn_n != cfg->kernal_cfg.kernal_chn_n){
+		return -1;
+	}
+
+	if(cfg->bn_act_cfg.use_bn_unit && bn_param_buf == NULL){
+		return -1;
+	}
+
+	if((cfg->bn_act_cfg.act_func_type == ACT_FUNC_SIGMOID || cfg->bn_act_cfg.act_func_type == ACT_FUNC_TANH) &&
+		sigmoid_lut == NULL){
+		return -1;
+	}
+
+	switch(cfg->kernal_cfg.kernal_shape){
+	case CONV_KRN_1x1: layer.kernal_len = 1;break;
+	case CONV_KRN_3x3: layer.kernal_len = 3;break;
+	case CONV_KRN_5x5: layer.kernal_len = 5;break;
+	case CONV_KRN_7x7: layer.kernal_len = 7;break;
+	case CONV_KRN_9x9: layer.kernal_len = 9;break;
+	case CONV_KRN_11x11: layer.kernal_len = 11;break;
+	case CONV_KRN_4x4: layer.kernal_len = 4;break;
+	case CONV_KRN_2x2: layer.kernal_len = 2;break;
+	default: return -1;
+	}
+
+	uint32_t dilated_kernal_len = layer.kernal_len + (layer.kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
+	uint32_t ext_fmap_w =
+		((uint32_t)cfg->fmap_cfg.ifmap_width) +
+		((uint32_t)cfg->fmap_cfg.external_padding_left) + ((uint32_t)cfg->fmap_cfg.external_padding_right) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_left_right);
+	uint32_t ext_fmap_h =
+		((uint32_t)cfg->fmap_cfg.ifmap_height) +
+		((uint32_t)cfg->fmap_cfg.external_padding_top) + ((uint32_t)cfg->fmap_cfg.external_padding_bottom) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_height - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom);
+
+	if(ext_fmap_w < dilated_kernal_len || ext_fmap_h < dilated_kernal_len ||
+		((ext_fmap_w - dilated_kernal_len) % cfg->cal_cfg.conv_horizontal_stride) ||
+		((ext_fmap_h - dilated_kernal_len) % cfg->cal_cfg.conv_vertical_stride)){
+		return -1;
+	}
+
+	layer.cfg = cfg;
+	layer.bn_param_buf = bn_param_buf;
+	layer.sigmoid_lut = sigmoid_lut;
+	layer.atomic_k = prop->atomic_k;
+	layer.atomic_c = prop->atomic_c;
+	layer.ofmap_w = (ext_fmap_w - dilated_kernal_len) / cfg->cal_cfg.conv_horizontal_stride + 1;
+	layer.ofmap_h = (ext_fmap_h - dilated_kernal_len) / cfg->cal_cfg.conv_vertical_stride + 1;
+	layer.ofmap_data_byte_n = (cfg->fmap_cfg.ofmap_data_type == CONV_O_2_BYTE) ? 2:4;
+	layer.set_w =
+		(cfg->group_n > 1) ?
+			(((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n):
+			((uint32_t)cfg->max_wgtblk_w);
+	layer.chn_n_foreach_set = (cfg->group_n > 1) ? layer.set_w:((uint32_t)cfg->kernal_cfg.kernal_chn_n);
+
+	if(thread_n > AXI_GNR_CONV_REF_MAX_THREAD_N){
+		thread_n = AXI_GNR_CONV_REF_MAX_THREAD_N;
+	}
+
+	if(thread_n > layer.ofmap_h){
+		thread_n = layer.ofmap_h;
+	}
+
+	if(thread_n <= 1){
+		AxiGnrConvRefThreadArg thread_arg = {&layer, 0, layer.ofmap_h};
+
+		axi_generic_conv_ref_thread((void*)&thread_arg);
+
+		return 0;
+	}
+
+	pthread_t thread_id[AXI_GNR_CONV_REF_MAX_THREAD_N];
+	AxiGnrConvRefThreadArg thread_arg[AXI_GNR_CONV_REF_MAX_THREAD_N];
+	uint32_t created_n = 0;
+
+	for(uint32_t i = 0;i < thread_n;i++){
+		thread_arg[i].layer = &layer;
+		thread_arg[i].ofmap_y_start = layer.ofmap_h * i / thread_n;
+		thread_arg[i].ofmap_y_end = layer.ofmap_h * (i + 1) / thread_n;
+
+		if(pthread_create(&thread_id[i], NULL, axi_generic_conv_ref_thread, (void*)&thread_arg[i])){
+			// 线程创建失败时, 在调用者线程中计算剩下的输出行
+			thread_arg[i].ofmap_y_end = layer.ofmap_h;
+			axi_generic_conv_ref_thread((void*)&thread_arg[i]);
+
+			break;
+		}
+
+		created_n++;
+	}
+
+	for(uint32_t i = 0;i < created_n;i++){
+		pthread_join(thread_id[i], NULL);
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  计算线程
+        对给定范围内的每个输出点和每个卷积核, 按硬件的累加顺序得到中间结果, 再依次经过BN、激活和输出舍入
+@param  arg 计算线程参数(AxiGnrConvRefThreadArg*)
+@return NULL
+*************************/
+static void* axi_generic_conv_ref_thread(void* arg){
+	const AxiGnrConvRefThreadArg* thread_arg = (const AxiGnrConvRefThreadArg*)arg;
+	const AxiGnrConvRefLayer* layer = thread_arg->layer;
+	const AxiGnrConvCfg* cfg = layer->cfg;
+
+	uint32_t ifmap_w = cfg->fmap_cfg.ifmap_width;
+	uint32_t ifmap_h = cfg->fmap_cfg.ifmap_height;
+	uint32_t kernal_len = layer->kernal_len;
+	uint32_t dilation_step = ((uint32_t)cfg->kernal_cfg.dilation_n) + 1;
+	uint32_t cgrpn = (layer->chn_n_foreach_set + layer->atomic_c - 1) / layer->atomic_c;
+	uint8_t act_func_type = (uint8_t)cfg->bn_act_cfg.act_func_type;
+	uint32_t alpha;
+
+	memcpy((void*)&alpha, (const void*)&cfg->bn_act_cfg.leaky_relu_param_alpha, 4);
+
+	const uint16_t* ifmap = (const uint16_t*)cfg->ifmap_baseaddr;
+	const uint16_t* kwgt = (const uint16_t*)cfg->kernal_wgt_baseaddr;
+
+	for(uint32_t oy = thread_arg->ofmap_y_start;oy < thread_arg->ofmap_y_end;oy++){
+		// 本输出行的有效卷积核行(位于填充区的卷积核行被整行跳过)
+		uint32_t vld_ky[11];
+		uint32_t vld_phy_y[11];
+		uint32_t vld_row_n = 0;
+
+		for(uint32_t ky = 0;ky < kernal_len;ky++){
+			uint32_t phy_y;
+
+			if(axi_generic_conv_ref_logic_to_phy(
+				oy * cfg->cal_cfg.conv_vertical_stride + ky * dilation_step,
+				cfg->fmap_cfg.external_padding_top, cfg->fmap_cfg.inner_padding_top_bottom, ifmap_h, &phy_y) == 0){
+				vld_ky[vld_row_n] = ky;
+				vld_phy_y[vld_row_n] = phy_y;
+				vld_row_n++;
+			}
+		}
+
+		for(uint32_t ox = 0;ox < layer->ofmap_w;ox++){
+			// 各卷积核列对应的原始列号(位于填充区时为-1)
+			int32_t phy_x[11];
+
+			for(uint32_t kx = 0;kx < kernal_len;kx++){
+				uint32_t x;
+
+				phy_x[kx] =
+					axi_generic_conv_ref_logic_to_phy(
+						ox * cfg->cal_cfg.conv_horizontal_stride + kx * dilation_step,
+						cfg->fmap_cfg.external_padding_left, cfg->fmap_cfg.inner_padding_left_right, ifmap_w, &x) ?
+						-1:
+						((int32_t)x);
+			}
+
+			for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+				uint32_t set_id = k / layer->set_w;
+				uint32_t k_in_set = k % layer->set_w;
+				uint32_t set_w_now =
+					(((uint32_t)cfg->kernal_cfg.kernal_n) - set_id * layer->set_w > layer->set_w) ?
+						layer->set_w:
+						(((uint32_t)cfg->kernal_cfg.kernal_n) - set_id * layer->set_w);
+				const uint16_t* kwgt_set =
+					kwgt + set_id * layer->set_w * layer->chn_n_foreach_set * kernal_len * kernal_len;
+				uint32_t chn_base = (cfg->group_n > 1) ? (set_id * layer->set_w):0; // 本核组的起始输入通道号
+				uint32_t mid_res = 0;
+				uint8_t first = 1;
+
+				// 中间结果累加
+				for(uint32_t c = 0;c < cgrpn;c++){
+					uint32_t depth =
+						(layer->chn_n_foreach_set - c * layer->atomic_c > layer->atomic_c) ?
+							layer->atomic_c:
+							(layer->chn_n_foreach_set - c * layer->atomic_c);
+					const uint16_t* ifmap_cgrp = ifmap + (chn_base + c * layer->atomic_c) * ifmap_h * ifmap_w;
+					const uint16_t* kwgt_cgrp =
+						kwgt_set + c * layer->atomic_c * kernal_len * kernal_len * set_w_now;
+
+					for(uint32_t r = 0;r < vld_row_n;r++){
+						for(uint32_t kx = 0;kx < kernal_len;kx++){
+							int64_t frac;
+							uint32_t exp;
+
+							if(phy_x[kx] < 0){
+								// 被掩码的表面
+								frac = 0;
+								exp = 24;
+							}else{
+								axi_generic_conv_ref_mac_fp16(
+									ifmap_cgrp + (vld_phy_y[r] * ifmap_w + ((uint32_t)phy_x[kx])) * depth,
+									kwgt_cgrp + ((vld_ky[r] * kernal_len + kx) * set_w_now + k_in_set) * depth,
+									depth, &frac, &exp
+								);
+							}
+
+							mid_res = axi_generic_conv_ref_acmlt_fp16(mid_res, frac, exp, first);
+							first = 0;
+						}
+					}
+				}
+
+				// BN与激活
+				uint32_t res = mid_res;
+
+				if(cfg->bn_act_cfg.use_bn_unit){
+					uint32_t param_a;
+					uint32_t param_b;
+
+					memcpy((void*)&param_a, (const void*)&layer->bn_param_buf[k].param_a, 4);
+					memcpy((void*)&param_b, (const void*)&layer->bn_param_buf[k].param_b, 4);
+
+					res = axi_generic_conv_ref_bn_fp32(
+						res, param_a, param_b, cfg->bn_act_cfg.bn_is_a_eq_1, cfg->bn_act_cfg.bn_is_b_eq_0);
+				}
+
+				if(act_func_type == ACT_FUNC_LEAKY_RELU){
+					res = axi_generic_conv_ref_leaky_relu_fp32(res, alpha);
+				}else if(act_func_type == ACT_FUNC_SIGMOID || act_func_type == ACT_FUNC_TANH){
+					res = axi_generic_conv_ref_sigmoid_tanh_fp32(res, layer->sigmoid_lut, act_func_type == ACT_FUNC_TANH);
+				}
+
+				// 写输出特征图(按ATOMIC_K个通道划分子表面行)
+				uint32_t sub_row_id = k_in_set / layer->atomic_k;
+				uint32_t sub_row_depth =
+					(set_w_now - sub_row_id * layer->atomic_k > layer->atomic_k) ?
+						layer->atomic_k:
+						(set_w_now - sub_row_id * layer->atomic_k);
+				uint32_t ofmap_ofs =
+					(set_id * layer->set_w + sub_row_id * layer->atomic_k) * layer->ofmap_h * layer->ofmap_w +
+					(oy * layer->ofmap_w + ox) * sub_row_depth + k_in_set % layer->atomic_k;
+
+				if(layer->ofmap_data_byte_n == 2){
+					((uint16_t*)cfg->ofmap_baseaddr)[ofmap_ofs] = axi_generic_conv_ref_round_fp16(res);
+				}else{
+					((uint32_t*)cfg->ofmap_baseaddr)[ofmap_ofs] = res;
+				}
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/*************************
+@cfg
+@private
+@brief  扩展特征图坐标转原始坐标
+@param  logic 扩展特征图坐标
+        ext_padding 前端外填充数
+        inner_padding 内填充数
+        len 原始特征图边长
+        phy 原始坐标(指针)
+@return 是否位于填充区
+*************************/
+static int axi_generic_conv_ref_logic_to_phy(
+	uint32_t logic, uint32_t ext_padding, uint32_t inner_padding, uint32_t len, uint32_t* phy){
+	if(logic < ext_padding){
+		return -1;
+	}
+
+	uint32_t ofs = logic - ext_padding;
+
+	if(ofs % (inner_padding + 1)){
+		return -1;
+	}
+
+	if(ofs / (inner_padding + 1) >= len){
+		return -1;
+	}
+
+	*phy = ofs / (inner_padding + 1);
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  符号扩展
+@param  v 待扩展的数
+        bit_n 有效位数
+@return 扩展后的有符号数
+*************************/
+static int64_t axi_generic_conv_ref_sext(uint64_t v, uint32_t bit_n){
+	uint64_t mask = (((uint64_t)1) << bit_n) - 1;
+
+	v &= mask;
+
+	return (v >> (bit_n - 1)) ? ((int64_t)(v | (~mask))):((int64_t)v);
+}
+
+/*************************
+@cfg
+@private
+@brief  获取FP32的绝对指数(非规则数的指数视为-126)
+@param  x FP32
+@return 绝对指数
+*************************/
+static int32_t axi_generic_conv_ref_fp32_exp(uint32_t x){
+	uint32_t ec = (x >> 23) & 0xFF;
+
+	return (ec == 0) ? -126:(((int32_t)ec) - 127);
+}
+
+/*************************
+@cfg
+@private
+@brief  获取FP32的补码尾数(Q23)
+@param  x FP32
+@return 补码尾数
+*************************/
+static int64_t axi_generic_conv_ref_fp32_frac(uint32_t x){
+	int64_t frac = (int64_t)(((((x >> 23) & 0xFF) != 0) ? 0x800000:0) | (x & 0x7FFFFF));
+
+	return (x >> 31) ? (-frac):frac;
+}
+
+/*************************
+@cfg
+@private
+@brief  将已标准化的补码尾数打包为FP32
+        尾数在(-1.0, 1.0)内或指数下溢时阶码和尾数置0, 尾数为-2.0时阶码加1
+@param  frac 25位补码尾数(Q23)
+        exp 绝对指数
+@return FP32
+*************************/
+static uint32_t axi_generic_conv_ref_pack_fp32(uint32_t frac, int32_t exp){
+	uint32_t sign = (frac >> 24) & 1;
+	uint32_t high2 = (frac >> 23) & 3;
+	uint32_t low23 = frac & 0x7FFFFF;
+	uint8_t to_set_0 = (exp < -126) || (high2 == 0) || (high2 == 3 && low23 != 0);
+	uint8_t is_neg_2 = (frac & 0x1FFFFFF) == 0x1000000;
+	uint32_t ec = to_set_0 ? 0:(((uint32_t)(exp + (is_neg_2 ? 128:127))) & 0xFF);
+	uint32_t mts = (to_set_0 || is_neg_2) ? 0:low23;
+
+	return (sign << 31) | (ec << 23) | (((sign ? (~mts):mts) + sign) & 0x7FFFFF);
+}
+
+/*************************
+@cfg
+@private
+@brief  乘加阵列(FP16)
+        每个乘积的阶码按高3位对齐到ATOMIC_C个乘积中的最大值, 相差超过7(即右移>=32位)的乘积被舍弃,
+        填0的通道不影响结果
+@param  ftm 特征图表面
+        wgt 卷积核表面
+        depth 表面深度
+        frac 37位补码尾数(指针)
+        exp 阶码(指针, 绝对指数 = 阶码 - 50)
+@return none
+*************************/
+static void axi_generic_conv_ref_mac_fp16(
+	const uint16_t* ftm, const uint16_t* wgt, uint32_t depth, int64_t* frac, uint32_t* exp){
+	int64_t signed_mtso[256];
+	uint32_t e_h3[256];
+	uint32_t func = 0;
+
+	for(uint32_t i = 0;i < depth;i++){
+		uint32_t e_f = (ftm[i] >> 10) & 0x1F;
+		uint32_t e_w = (wgt[i] >> 10) & 0x1F;
+		uint32_t mts_f = (e_f != 0) ? ((0x400 | (ftm[i] & 0x3FF)) << (e_f & 3)):((ftm[i] & 0x3FF) << 1);
+		uint32_t mts_w = (e_w != 0) ? ((0x400 | (wgt[i] & 0x3FF)) << (e_w & 3)):((wgt[i] & 0x3FF) << 1);
+		int64_t mtso = (int64_t)(((uint64_t)mts_f) * ((uint64_t)mts_w));
+
+		signed_mtso[i] = ((ftm[i] ^ wgt[i]) & 0x8000) ? (-mtso):mtso;
+		e_h3[i] = (e_f >> 2) + (e_w >> 2);
+
+		if(e_h3[i] > func){
+			func = e_h3[i];
+		}
+	}
+
+	int64_t sum = 0;
+
+	for(uint32_t i = 0;i < depth;i++){
+		uint32_t set = (func - e_h3[i]) * 4;
+
+		if(set < 32){
+			sum += signed_mtso[i] >> set;
+		}
+	}
+
+	*frac = sum;
+	*exp = func * 4;
+}
+
+/*************************
+@cfg
+@private
+@brief  中间结果累加(FP16)
+        待累加数(37位补码尾数, 6位阶码)与原中间结果(FP32)对阶后相加,
+        对阶时移出的最多23位尾数参与标准化, 标准化后截断为FP32
+@param  org 原中间结果(FP32)
+        in_frac 待累加数的补码尾数
+        in_exp 待累加数的阶码
+        first 是否第1项
+@return 新的中间结果(FP32)
+*************************/
+static uint32_t axi_generic_conv_ref_acmlt_fp16(uint32_t org, int64_t in_frac, uint32_t in_exp, uint8_t first){
+	int32_t exp_larger;
+	int64_t high38;
+	uint64_t guard23;
+
+	if(first){
+		exp_larger = ((int32_t)in_exp) - 50;
+		high38 = in_frac;
+		guard23 = 0;
+	}else{
+		uint32_t org_ec = (org >> 23) & 0xFF;
+		int32_t org_exp = (org_ec == 0) ? 1:((int32_t)org_ec);
+		int64_t org_frac = axi_generic_conv_ref_fp32_frac(org);
+		int32_t diff = org_exp - ((int32_t)in_exp) - 100;
+		uint8_t lth = diff < 0;
+		uint32_t abs_diff = (uint32_t)(lth ? (-diff):diff);
+		int64_t ars_op = lth ? org_frac:in_frac; // 对绝对指数更小的数作算术右移
+		int64_t ars_high;
+		uint64_t ars_low40;
+
+		if(abs_diff > 63){
+			ars_high = 0;
+			ars_low40 = 0;
+		}else{
+			ars_high = ars_op >> abs_diff;
+			ars_low40 =
+				(abs_diff <= 40) ?
+					((((uint64_t)ars_op) << (40 - abs_diff)) & 0xFFFFFFFFFFULL):
+					(((uint64_t)(ars_op >> (abs_diff - 40))) & 0xFFFFFFFFFFULL);
+		}
+
+		if(lth){
+			exp_larger = ((int32_t)in_exp) - 50;
+			high38 = in_frac + axi_generic_conv_ref_sext((uint64_t)ars_high, 25);
+		}else{
+			exp_larger = org_exp - 150;
+			high38 = axi_generic_conv_ref_sext((uint64_t)ars_high, 37) + org_frac;
+		}
+
+		guard23 = ars_low40 >> 17;
+	}
+
+	// 标准化阶段0: 在高38位的[36:5]中从MSB开始找第1个与符号位不同的位
+	uint32_t arsh_n = 0;
+	uint64_t sign = (high38 < 0) ? 1:0;
+
+	for(int32_t p = 36;p >= 5;p--){
+		if(((((uint64_t)high38) >> p) & 1) != sign){
+			arsh_n = (uint32_t)p;
+
+			break;
+		}
+	}
+
+	// 标准化阶段1
+	int64_t frac_sum = (int64_t)((((uint64_t)high38) << 23) | guard23);
+	uint32_t frac_s1 = (uint32_t)(((uint64_t)(frac_sum >> arsh_n)) & 0x1FFFFFFF);
+	int32_t exp_s1 = exp_larger + ((int32_t)arsh_n);
+
+	// 标准化阶段2
+	uint32_t s28 = (frac_s1 >> 28) & 1;
+	uint32_t frac_s2;
+	int32_t exp_s2;
+
+	if(s28 ^ ((frac_s1 >> 27) & 1)){
+		frac_s2 = frac_s1 >> 4;
+		exp_s2 = exp_s1 + 4;
+	}else if(s28 ^ ((frac_s1 >> 26) & 1)){
+		frac_s2 = frac_s1 >> 3;
+		exp_s2 = exp_s1 + 3;
+	}else if(s28 ^ ((frac_s1 >> 25) & 1)){
+		frac_s2 = frac_s1 >> 2;
+		exp_s2 = exp_s1 + 2;
+	}else if(s28 ^ ((frac_s1 >> 24) & 1)){
+		frac_s2 = frac_s1 >> 1;
+		exp_s2 = exp_s1 + 1;
+	}else{
+		frac_s2 = frac_s1;
+		exp_s2 = exp_s1;
+	}
+
+	return axi_generic_conv_ref_pack_fp32(frac_s2 & 0x1FFFFFF, exp_s2);
+}
+
+/*************************
+@cfg
+@private
+@brief  批归一化(FP32)
+        计算a * x + b, 乘积精确保留, 对阶后截断到Q29相加, 标准化后截断为FP32
+@param  x 操作数X
+        a 参数A
+        b 参数B
+        a_eq_1 参数A的实际值是否为1
+        b_eq_0 参数B的实际值是否为0
+@return 计算结果(FP32)
+*************************/
+static uint32_t axi_generic_conv_ref_bn_fp32(uint32_t x, uint32_t a, uint32_t b, uint8_t a_eq_1, uint8_t b_eq_0){
+	int32_t x_exp = axi_generic_conv_ref_fp32_exp(x);
+	int32_t b_exp = axi_generic_conv_ref_fp32_exp(b);
+	int32_t ax_exp = a_eq_1 ? x_exp:(axi_generic_conv_ref_fp32_exp(a) + x_exp);
+	int64_t ax_frac =
+		a_eq_1 ?
+			(axi_generic_conv_ref_fp32_frac(x) * (((int64_t)1) << 23)):
+			(axi_generic_conv_ref_fp32_frac(a) * axi_generic_conv_ref_fp32_frac(x)); // Q46
+	uint8_t ax_exp_gt = b_eq_0 || (ax_exp > b_exp);
+	int32_t exp_al = ax_exp_gt ? ax_exp:b_exp;
+	uint32_t diff = (uint32_t)((ax_exp > b_exp) ? (ax_exp - b_exp):(b_exp - ax_exp));
+	int64_t ax_q29 = ax_frac >> 17;
+	int64_t b_q29 = axi_generic_conv_ref_fp32_frac(b) * 64;
+
+	if(ax_exp_gt){
+		b_q29 = (diff >= 32) ? 0:(b_q29 >> diff);
+	}else{
+		ax_q29 = (diff >= 32) ? 0:(ax_q29 >> diff);
+	}
+
+	int64_t f = ax_q29 + (b_eq_0 ? 0:b_q29); // 33位
+	int64_t nml;
+	int32_t var;
+
+	if(a_eq_1 && b_eq_0){
+		nml = f;
+		var = 0;
+	}else{
+		uint64_t sign = (f < 0) ? 1:0;
+		int32_t k = -1;
+
+		for(int32_t p = 31;p >= 0;p--){
+			if(((((uint64_t)f) >> p) & 1) != sign){
+				k = p;
+
+				break;
+			}
+		}
+
+		if(k == 31){
+			nml = f >> 2;
+			var = 2;
+		}else if(k == 30){
+			nml = f >> 1;
+			var = 1;
+		}else if(k == 29){
+			nml = f;
+			var = 0;
+		}else if(k > 0){
+			nml = axi_generic_conv_ref_sext(((uint64_t)f) << (29 - k), 33);
+			var = k - 29;
+		}else{
+			nml = axi_generic_conv_ref_sext(((uint64_t)f) << 29, 33);
+			var = -29;
+		}
+	}
+
+	return axi_generic_conv_ref_pack_fp32((uint32_t)((((uint64_t)nml) >> 6) & 0x1FFFFFF), exp_al + var);
+}
+
+/*************************
+@cfg
+@private
+@brief  Leaky-Relu激活(FP32)
+        x >= 0时输出x, 否则输出alpha * x(乘积向最近偶数舍入到Q23)
+@param  x 操作数X
+        alpha 泄露Relu激活参数
+@return 计算结果(FP32)
+*************************/
+static uint32_t axi_generic_conv_ref_leaky_relu_fp32(uint32_t x, uint32_t alpha){
+	if(!(x >> 31)){
+		return x;
+	}
+
+	int32_t exp = axi_generic_conv_ref_fp32_exp(alpha) + axi_generic_conv_ref_fp32_exp(x);
+	uint64_t mul = (uint64_t)(axi_generic_conv_ref_fp32_frac(alpha) * axi_generic_conv_ref_fp32_frac(x)); // Q46
+	uint32_t carry = ((mul >> 22) & 1) && ((mul & 0x3FFFFF) || ((mul >> 23) & 1));
+	uint32_t r = (uint32_t)(((mul >> 23) + carry) & 0x3FFFFFF); // Q23
+	uint32_t high3 = (r >> 23) & 7;
+	uint32_t low23 = r & 0x7FFFFF;
+	uint8_t arsh1 = (high3 == 2) || (high3 == 3) || (high3 == 4) || (high3 == 5) || (high3 == 6 && low23 == 0);
+	int32_t ec = exp + (arsh1 ? 1:0);
+	uint8_t to_set_0 = (ec < -126) || (high3 == 0) || (high3 == 7 && low23 != 0);
+	uint32_t sign = r >> 25;
+	uint32_t mts = arsh1 ? ((r >> 1) & 0x7FFFFF):low23;
+
+	return
+		(sign << 31) |
+		((to_set_0 ? 0:(((uint32_t)(ec + 127)) & 0xFF)) << 23) |
+		(to_set_0 ? 0:(((sign ? (~mts):mts) + sign) & 0x7FFFFF));
+}
+
+/*************************
+@cfg
+@private
+@brief  Sigmoid/Tanh激活(FP32)
+        取abs(x)的定点数(Q10, 向最近偶数舍入)查Sigmoid函数值表, |x| >= 12时函数值取1;
+        Tanh(x) = 2 * Sigmoid(2x) - 1
+@param  x 操作数X
+        lut Sigmoid函数值查找表
+        is_tanh 是否Tanh激活
+@return 计算结果(FP32)
+*************************/
+static uint32_t axi_generic_conv_ref_sigmoid_tanh_fp32(uint32_t x, const uint16_t* lut, uint8_t is_tanh){
+	uint32_t ec = (x >> 23) & 0xFF;
+	uint32_t is_neg = x >> 31;
+	uint64_t fixed_to_be_shifted = ((uint64_t)(0x800000 | (x & 0x7FFFFF))) << 9; // Q32
+	uint32_t shift_mode = (ec >= 131) ? 6:((ec > 115) ? ((137 - ec) & 31):22);
+	uint64_t shifted =
+		(shift_mode >= 10) ?
+			(fixed_to_be_shifted >> (shift_mode - 10)):
+			(fixed_to_be_shifted << (10 - shift_mode));
+	uint64_t fixed_to_query = is_tanh ? (shifted << 1):shifted;
+	uint32_t fixed_op = (uint32_t)((fixed_to_query >> 18) & 0x3FFFF); // 整数位 = 4, 小数位 = 10, 保护位 = 4
+	uint32_t carry = ((fixed_op >> 3) & 1) && ((fixed_op & 7) || ((fixed_op >> 4) & 1));
+	uint8_t ovf =
+		((fixed_to_query >> 32) >= 12) ||
+		((((fixed_to_query >> 22) & 0x3FFF) == ((11 << 10) | 0x3FF)) && carry);
+	uint32_t func_value; // Q17
+
+	if(ovf){
+		func_value = 1 << 17;
+	}else{
+		uint32_t rounded = ((fixed_op >> 4) + carry) & 0x3FFF; // Q10
+		uint32_t addr =
+			((rounded >> 12) & 3) ?
+				(3072 + ((((rounded >> 13) & 1) << 9) | ((rounded >> 3) & 0x1FF))):
+				(((rounded >> 11) & 1) ? (2048 + ((rounded >> 1) & 0x3FF)):(rounded & 0x7FF));
+
+		func_value = (1 << 16) | ((uint32_t)lut[addr]);
+	}
+
+	uint32_t fixed =
+		(is_tanh ?
+			(2 * func_value - (1 << 17)):
+			(is_neg ? ((1 << 17) - func_value):func_value)) & 0x3FFFF;
+
+	if(fixed == 0){
+		return (is_tanh && is_neg) ? 0x80000000:0;
+	}
+
+	uint32_t i = 0;
+
+	while(!((fixed >> (17 - i)) & 1)){
+		i++;
+	}
+
+	return
+		(((uint32_t)(is_tanh && is_neg)) << 31) |
+		((127 - i) << 23) |
+		(((fixed << 6) << i) & 0x7FFFFF);
+}
+
+/*************************
+@cfg
+@private
+@brief  输出舍入(FP32转FP16)
+        尾数向最近偶数舍入, 指数 < -14时置0, 指数 > 15时取最大值
+@param  x FP32
+@return FP16
+*************************/
+static uint16_t axi_generic_conv_ref_round_fp16(uint32_t x){
+	uint32_t ec = (x >> 23) & 0xFF;
+	uint32_t mts = ((ec != 0) ? 0x800000:0) | (x & 0x7FFFFF);
+	uint32_t carry = ((mts >> 12) & 1) && ((mts & 0xFFF) || ((mts >> 13) & 1));
+	uint32_t r = ((mts >> 13) + carry) & 0xFFF;
+	uint32_t to_arsh = ((r >> 10) & 3) != 1;
+	uint32_t ec_cps = (ec + to_arsh) & 0xFF;
+	uint8_t to_set_0 = (ec < 113) || (((r >> 10) & 3) == 0);
+	uint8_t to_set_max = ec_cps > 142;
+	uint32_t e5 = to_set_0 ? 0:(to_set_max ? 30:(ec_cps - 112));
+	uint32_t m10 = to_set_0 ? 0:(to_set_max ? 0x3FF:(to_arsh ? ((r >> 1) & 0x3FF):(r & 0x3FF)));
+
+	return (uint16_t)(((x >> 31) << 15) | (e5 << 10) | m10);
+}
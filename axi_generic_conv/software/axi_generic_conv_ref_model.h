@@ -0,0 +1,20 @@
+/************************************************************************************************************************
+通用卷积处理单元参考模型(接口头文件)
+@brief  在主机上按位精确地复现通用卷积处理单元的运算数据通路(FP16乘加阵列, 中间结果累加, BN, 激活, 输出舍入),
+        用于快速生成期望输出
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include "axi_generic_conv.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 最大的计算线程数
+#define AXI_GNR_CONV_REF_MAX_THREAD_N 64
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int axi_generic_conv_ref_run(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg,
+	const BNParam* bn_param_buf, const uint16_t* sigmoid_lut, uint32_t thread_n); // 运行参考模型
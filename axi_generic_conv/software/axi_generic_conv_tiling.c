@@ -0,0 +1,537 @@
+/************************************************************************************************************************
+通用卷积处理单元分块执行库
+@brief  当卷积层超出片上限制(卷积核个数 > 最大的卷积核个数, 输出特征图过宽导致中间结果缓存存不下1行,
+        输入特征图宽度超过特征图缓存表面行长度)时, 将其拆分为卷积核分块和带重叠的列条带, 分多次启动通用卷积处理单元
+        卷积核分块的输出直接写到最终输出特征图的对应通道处;
+        由于输出特征图的表面行是连续存储的, 列条带须经暂存区中转: 先由CPU把输入列条带拷贝到暂存区, 计算完成后再把输出列条带拷贝到最终输出特征图;
+        支持输入特征图跨距且每组的输入通道数是ATOMIC_C的整数倍时, 输入列条带(含重叠部分)按跨距直接从原输入特征图读取, 无需拷贝;
+        支持输出特征图跨距且输出通道数和核组宽度都是ATOMIC_K的整数倍时, 输出列条带按跨距直接写到最终输出特征图的对应列, 无需拷贝
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.17 1.01 不支持融合2x2最大池化的卷积层
+        2026.10.17 1.02 不支持融合残差相加的卷积层
+        2026.10.17 1.03 不支持带输出特征图跨距的卷积层
+        2026.10.17 1.04 支持按输入特征图跨距原位读取输入列条带, 不支持带输入特征图跨距的卷积层
+        2026.10.17 1.05 INT8时按硬件通道数(通道对数)计算列条带与卷积核分块的字节数
+        2026.10.17 1.06 存在多个卷积核分块时也检查权重块最大宽度, 检查组卷积的通道数, 复用驱动的获取卷积核边长函数
+        2026.10.17 1.07 支持按输出特征图跨距把输出列条带直接写到最终输出特征图
+        2026.10.17 1.08 1字节输出特征图按通道对计算输出的字节数
+************************************************************************************************************************/
+
+#include "axi_generic_conv_tiling.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 特征图缓存表面行的最大长度
+#define TILE_MAX_FMBUF_COLN 4096
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint8_t axi_generic_conv_tile_is_ifmap_strip_in_place(const AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg); // 判断能否原位读取输入列条带
+static uint8_t axi_generic_conv_tile_is_ofmap_strip_in_place(const AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg); // 判断能否原位写出输出列条带
+static uint32_t axi_generic_conv_tile_cal_s2mm_cmd_n(
+	const AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, uint32_t kernal_n, uint32_t ofmap_h); // 计算S2MM通道命令数
+static void axi_generic_conv_tile_copy_cols(
+	const uint8_t* src, uint32_t src_w, uint32_t src_x, uint8_t* dst, uint32_t dst_w, uint32_t dst_x,
+	uint32_t copy_w, uint32_t h, uint32_t group_n, uint32_t n_foreach_group, uint32_t atomic_n, uint32_t data_byte_n); // 拷贝特征图的若干列
+static int axi_generic_conv_tile_run_once(
+	AxiGnrConvHandler* handler, const AxiGnrConvCfg* tile_cfg, BNParam* bn_param_buf, uint32_t s2mm_cmd_n); // 启动1次通用卷积处理单元并等待完成
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  生成分块方案
+        卷积核分块的核数是权重块最大宽度(组卷积时为每组核数)的整数倍, 以保证每个分块的权重和输出在内存中连续
+        列条带的宽度取能放进中间结果缓存和特征图缓存表面行的最大值, 相邻列条带的输入有(扩展卷积核宽度 - 水平步长)列重叠
+        注意: 分列条带时不支持左右内填充, 不支持融合2x2最大池化、融合残差相加和输入/输出特征图跨距,
+              存在多个卷积核分块或列条带时权重块最大宽度须是ATOMIC_K的整数倍, 组卷积时输入通道数须与核数相同
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+        plan 分块方案(句柄)
+@return 是否成功
+*************************/
+int axi_generic_conv_tile_plan(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, AxiGnrConvTilePlan* plan){
+	const AxiGnrConvProp* prop = &handler->property;
+
+	if(cfg->group_n == 0 || cfg->max_wgtblk_w == 0 || cfg->cal_cfg.cal_round_n == 0 ||
+		cfg->cal_cfg.conv_horizontal_stride == 0 || cfg->cal_cfg.conv_vertical_stride == 0 ||
+		cfg->fmap_cfg.ifmap_width == 0 || cfg->fmap_cfg.ifmap_height == 0 || cfg->kernal_cfg.kernal_n == 0 ||
+		(cfg->kernal_cfg.kernal_n % cfg->group_n) || cfg->fmap_cfg.en_fused_max_pool || cfg->bn_act_cfg.en_residual_add ||
+		cfg->fmap_cfg.ofmap_chn_ofs || cfg->fmap_cfg.ofmap_row_pitch || cfg->fmap_cfg.ofmap_cgrp_pitch ||
+		cfg->fmap_cfg.ifmap_start_cgrp || cfg->fmap_cfg.ifmap_row_pitch || cfg->fmap_cfg.ifmap_cgrp_pitch){
+		return -1;
+	}
+
+	// 组卷积的分块按核号截取输入通道, 要求每组的输入通道数与核数相同
+	if(cfg->group_n > 1 &&
+		(cfg->fmap_cfg.ifmap_chn_n != cfg->kernal_cfg.kernal_n || cfg->kernal_cfg.kernal_chn_n != cfg->kernal_cfg.kernal_n)){
+		return -1;
+	}
+
+	uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+	uint32_t dilated_kernal_len = kernal_len + (kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
+	uint32_t ext_fmap_w =
+		((uint32_t)cfg->fmap_cfg.ifmap_width) +
+		((uint32_t)cfg->fmap_cfg.external_padding_left) + ((uint32_t)cfg->fmap_cfg.external_padding_right) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_left_right);
+	uint32_t ext_fmap_h =
+		((uint32_t)cfg->fmap_cfg.ifmap_height) +
+		((uint32_t)cfg->fmap_cfg.external_padding_top) + ((uint32_t)cfg->fmap_cfg.external_padding_bottom) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_height - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom);
+
+	if(ext_fmap_w < dilated_kernal_len || ext_fmap_h < dilated_kernal_len ||
+		((ext_fmap_w - dilated_kernal_len) % cfg->cal_cfg.conv_horizontal_stride) ||
+		((ext_fmap_h - dilated_kernal_len) % cfg->cal_cfg.conv_vertical_stride)){
+		return -1;
+	}
+
+	uint32_t ofmap_width = (ext_fmap_w - dilated_kernal_len) / cfg->cal_cfg.conv_horizontal_stride + 1;
+	uint32_t ofmap_height = (ext_fmap_h - dilated_kernal_len) / cfg->cal_cfg.conv_vertical_stride + 1;
+	uint32_t hw_chn_n = axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->fmap_cfg.ifmap_chn_n);
+	uint32_t data_byte_n = 2; // 每个硬件通道的字节数(INT8时为1对通道)
+
+	// 卷积核分块
+	uint32_t kernal_n_foreach_chunk;
+
+	if(cfg->group_n > 1){
+		uint32_t n_foreach_group = ((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n;
+
+		if(n_foreach_group > prop->max_kernal_n){
+			return -2;
+		}
+
+		kernal_n_foreach_chunk = (((uint32_t)prop->max_kernal_n) / n_foreach_group) * n_foreach_group;
+	}else{
+		kernal_n_foreach_chunk = (((uint32_t)prop->max_kernal_n) / cfg->max_wgtblk_w) * cfg->max_wgtblk_w;
+	}
+
+	if(kernal_n_foreach_chunk == 0){
+		return -2;
+	}
+
+	if(kernal_n_foreach_chunk > cfg->kernal_cfg.kernal_n){
+		kernal_n_foreach_chunk = cfg->kernal_cfg.kernal_n;
+	}
+
+	// 列条带(从整个输出特征图宽度开始逐次收窄)
+	uint32_t fmbufcoln = ((uint32_t)4) << ((uint32_t)cfg->buffer_cfg.fmbufcoln);
+	uint32_t ofmap_w_foreach_strip = ofmap_width;
+	uint32_t ifmap_w_foreach_strip;
+
+	if(fmbufcoln > TILE_MAX_FMBUF_COLN){
+		fmbufcoln = TILE_MAX_FMBUF_COLN;
+	}
+
+	while(1){
+		uint32_t mid_res_item_n_foreach_row = ((uint32_t)cfg->cal_cfg.cal_round_n) * ofmap_w_foreach_strip;
+		uint32_t bank_n_foreach_mid_res_row =
+			(mid_res_item_n_foreach_row * ((uint32_t)prop->mid_res_buf_clk_rate)) / prop->mid_res_buf_bank_depth +
+			((mid_res_item_n_foreach_row * ((uint32_t)prop->mid_res_buf_clk_rate)) % prop->mid_res_buf_bank_depth ? 1:0);
+
+		ifmap_w_foreach_strip =
+			(ofmap_w_foreach_strip == ofmap_width) ?
+				((uint32_t)cfg->fmap_cfg.ifmap_width):
+				((ofmap_w_foreach_strip - 1) * cfg->cal_cfg.conv_horizontal_stride + dilated_kernal_len);
+
+		if(ifmap_w_foreach_strip > cfg->fmap_cfg.ifmap_width){
+			ifmap_w_foreach_strip = cfg->fmap_cfg.ifmap_width;
+		}
+
+		if((prop->mid_res_buf_bank_n / bank_n_foreach_mid_res_row) >= 1 && ifmap_w_foreach_strip <= fmbufcoln){
+			break;
+		}
+
+		if(ofmap_w_foreach_strip == 1){
+			return -2;
+		}
+
+		ofmap_w_foreach_strip--;
+	}
+
+	uint32_t strip_n = (ofmap_width + ofmap_w_foreach_strip - 1) / ofmap_w_foreach_strip;
+
+	uint32_t kernal_chunk_n = (((uint32_t)cfg->kernal_cfg.kernal_n) + kernal_n_foreach_chunk - 1) / kernal_n_foreach_chunk;
+
+	/*
+	列条带须逐个输出子表面行拷贝, 卷积核分块的输出按"核号 * 输出特征图大小"偏移,
+	二者都要求每个输出子表面行都是完整的ATOMIC_K个通道(最后1个除外)
+	*/
+	if((strip_n > 1 || kernal_chunk_n > 1) && cfg->group_n == 1 && (cfg->max_wgtblk_w % prop->atomic_k)){
+		return -1;
+	}
+
+	if(strip_n > 1 && cfg->fmap_cfg.inner_padding_left_right){
+		return -1;
+	}
+
+	plan->kernal_chunk_n = (uint16_t)kernal_chunk_n;
+	plan->kernal_n_foreach_chunk = (uint16_t)kernal_n_foreach_chunk;
+	plan->strip_n = (uint16_t)strip_n;
+	plan->ofmap_w_foreach_strip = (uint16_t)ofmap_w_foreach_strip;
+	plan->ifmap_w_foreach_strip = (uint16_t)ifmap_w_foreach_strip;
+	plan->s2mm_cmd_n_foreach_chunk = axi_generic_conv_tile_cal_s2mm_cmd_n(handler, cfg, kernal_n_foreach_chunk, ofmap_height);
+	plan->ifmap_strip_buf_len =
+		(strip_n > 1 && (!axi_generic_conv_tile_is_ifmap_strip_in_place(handler, cfg))) ?
+			(ifmap_w_foreach_strip * ((uint32_t)cfg->fmap_cfg.ifmap_height) * hw_chn_n * data_byte_n):
+			0;
+	plan->ofmap_strip_buf_len =
+		(strip_n > 1 && (!axi_generic_conv_tile_is_ofmap_strip_in_place(handler, cfg))) ?
+			(ofmap_w_foreach_strip * ofmap_height *
+				axi_generic_conv_get_ofmap_pt_byte_n(cfg->fmap_cfg.ofmap_data_type, kernal_n_foreach_chunk)):
+			0;
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  按分块方案执行卷积层
+        依次处理每个列条带, 在每个列条带内依次处理每个卷积核分块; 每个分块都会重新配置并启动通用卷积处理单元,
+        并使能计算子系统(支持批归一化时还会使能批归一化与激活处理单元), 完成后除能
+        注意: 须已使能加速器; 调用期间不能使用层描述符链
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+        plan 分块方案(句柄)
+        bn_param_buf 整个卷积层的BN参数(共kernal_n个, 不使用BN单元时可为NULL)
+        tile_buf 分块执行暂存区(句柄, 无需分列条带时暂存区可为NULL,
+                 可原位读取输入列条带时输入列条带暂存区可为NULL, 可原位写出输出列条带时输出列条带暂存区可为NULL)
+@return 是否成功
+*************************/
+int axi_generic_conv_tile_run(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, const AxiGnrConvTilePlan* plan,
+	BNParam* bn_param_buf, const AxiGnrConvTileBuf* tile_buf){
+	if(cfg->bn_act_cfg.use_bn_unit && bn_param_buf == NULL){
+		return -1;
+	}
+
+	uint8_t ifmap_strip_in_place = (plan->strip_n > 1) && axi_generic_conv_tile_is_ifmap_strip_in_place(handler, cfg);
+	uint8_t ofmap_strip_in_place = (plan->strip_n > 1) && axi_generic_conv_tile_is_ofmap_strip_in_place(handler, cfg);
+	uint8_t ofmap_strip_buffered = (plan->strip_n > 1) && (!ofmap_strip_in_place);
+
+	if(plan->strip_n > 1 &&
+		(tile_buf == NULL ||
+			((!ifmap_strip_in_place) && tile_buf->ifmap_strip_buf == NULL) ||
+			((!ofmap_strip_in_place) && tile_buf->ofmap_strip_buf == NULL))){
+		return -1;
+	}
+
+	uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+	uint32_t dilated_kernal_len = kernal_len + (kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
+	uint32_t ext_fmap_w =
+		((uint32_t)cfg->fmap_cfg.ifmap_width) +
+		((uint32_t)cfg->fmap_cfg.external_padding_left) + ((uint32_t)cfg->fmap_cfg.external_padding_right) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_width - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_left_right);
+	uint32_t ext_fmap_h =
+		((uint32_t)cfg->fmap_cfg.ifmap_height) +
+		((uint32_t)cfg->fmap_cfg.external_padding_top) + ((uint32_t)cfg->fmap_cfg.external_padding_bottom) +
+		((uint32_t)(cfg->fmap_cfg.ifmap_height - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom);
+	uint32_t ofmap_width = (ext_fmap_w - dilated_kernal_len) / cfg->cal_cfg.conv_horizontal_stride + 1;
+	uint32_t ofmap_height = (ext_fmap_h - dilated_kernal_len) / cfg->cal_cfg.conv_vertical_stride + 1;
+	uint32_t hw_chn_n = axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->fmap_cfg.ifmap_chn_n);
+	uint32_t data_byte_n = 2; // 每个硬件通道的字节数(INT8时为1对通道)
+	uint32_t ofmap_data_byte_n =
+		(cfg->fmap_cfg.ofmap_data_type == CONV_O_1_BYTE) ? 1:
+		(cfg->fmap_cfg.ofmap_data_type == CONV_O_2_BYTE) ? 2:
+		                                                   4;
+	uint32_t n_foreach_group = ((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n;
+	uint32_t c_foreach_set =
+		(cfg->group_n > 1) ? n_foreach_group:axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->kernal_cfg.kernal_chn_n);
+	uint32_t wgt_byte_n_foreach_kernal = kernal_len * kernal_len * c_foreach_set * data_byte_n; // 每个卷积核的权重字节数
+	uint32_t atomic_c = handler->property.atomic_c;
+	uint32_t ifmap_row_pitch = ((uint32_t)cfg->fmap_cfg.ifmap_width) * atomic_c * data_byte_n; // 原输入特征图的表面行跨距
+	uint32_t ifmap_cgrp_pitch = ifmap_row_pitch * ((uint32_t)cfg->fmap_cfg.ifmap_height); // 原输入特征图的通道组跨距
+	uint32_t atomic_k = handler->property.atomic_k;
+	uint32_t ofmap_row_pitch = ofmap_width * atomic_k * ofmap_data_byte_n; // 最终输出特征图的表面行跨距
+	uint32_t ofmap_cgrp_pitch = ofmap_row_pitch * ofmap_height; // 最终输出特征图的通道组跨距
+
+	for(uint32_t strip_id = 0;strip_id < plan->strip_n;strip_id++){
+		AxiGnrConvCfg tile_cfg = *cfg;
+		uint32_t ofmap_x = strip_id * plan->ofmap_w_foreach_strip;
+		uint32_t ofmap_w_of_strip = ofmap_width - ofmap_x;
+		uint32_t ifmap_w_of_strip = cfg->fmap_cfg.ifmap_width;
+		uint8_t* ifmap_baseaddr = cfg->ifmap_baseaddr;
+
+		if(ofmap_w_of_strip > plan->ofmap_w_foreach_strip){
+			ofmap_w_of_strip = plan->ofmap_w_foreach_strip;
+		}
+
+		if(plan->strip_n > 1){
+			// 列条带在扩展特征图中的列范围[ext_x_start, ext_x_end), 不支持左右内填充, 故扩展列号 - 左部外填充数即原始列号
+			uint32_t ext_x_start = ofmap_x * cfg->cal_cfg.conv_horizontal_stride;
+			uint32_t ext_x_end = ext_x_start + (ofmap_w_of_strip - 1) * cfg->cal_cfg.conv_horizontal_stride + dilated_kernal_len;
+			uint32_t padding_left = cfg->fmap_cfg.external_padding_left;
+			uint32_t ifmap_x_start = (ext_x_start > padding_left) ? (ext_x_start - padding_left):0;
+			uint32_t ifmap_x_end =
+				(ext_x_end > padding_left + cfg->fmap_cfg.ifmap_width) ?
+					((uint32_t)cfg->fmap_cfg.ifmap_width):
+					(ext_x_end - padding_left);
+
+			if(ifmap_x_end <= ifmap_x_start){
+				return -2;
+			}
+
+			ifmap_w_of_strip = ifmap_x_end - ifmap_x_start;
+
+			tile_cfg.fmap_cfg.ifmap_width = (uint16_t)ifmap_w_of_strip;
+			tile_cfg.fmap_cfg.external_padding_left = (uint8_t)((ext_x_start < padding_left) ? (padding_left - ext_x_start):0);
+			tile_cfg.fmap_cfg.external_padding_right =
+				(uint8_t)((ext_x_end > padding_left + cfg->fmap_cfg.ifmap_width) ? (ext_x_end - padding_left - cfg->fmap_cfg.ifmap_width):0);
+
+			if(ifmap_strip_in_place){
+				// 按原输入特征图的跨距读取列条带, 列条带的起始列折算到输入特征图基地址
+				ifmap_baseaddr = cfg->ifmap_baseaddr + ifmap_x_start * atomic_c * data_byte_n;
+
+				tile_cfg.fmap_cfg.ifmap_row_pitch = ifmap_row_pitch;
+				tile_cfg.fmap_cfg.ifmap_cgrp_pitch = ifmap_cgrp_pitch;
+			}else{
+				ifmap_baseaddr = tile_buf->ifmap_strip_buf;
+
+				axi_generic_conv_tile_copy_cols(
+					cfg->ifmap_baseaddr, cfg->fmap_cfg.ifmap_width, ifmap_x_start,
+					tile_buf->ifmap_strip_buf, ifmap_w_of_strip, 0,
+					ifmap_w_of_strip, cfg->fmap_cfg.ifmap_height,
+					cfg->group_n, hw_chn_n / cfg->group_n, handler->property.atomic_c, data_byte_n
+				);
+
+				if(tile_buf->flush_dcache != NULL){
+					tile_buf->flush_dcache(
+						(void*)tile_buf->ifmap_strip_buf,
+						ifmap_w_of_strip * ((uint32_t)cfg->fmap_cfg.ifmap_height) * hw_chn_n * data_byte_n
+					);
+				}
+			}
+		}
+
+		for(uint32_t kernal_id = 0;kernal_id < cfg->kernal_cfg.kernal_n;kernal_id += plan->kernal_n_foreach_chunk){
+			uint32_t kernal_n_of_chunk = ((uint32_t)cfg->kernal_cfg.kernal_n) - kernal_id;
+
+			if(kernal_n_of_chunk > plan->kernal_n_foreach_chunk){
+				kernal_n_of_chunk = plan->kernal_n_foreach_chunk;
+			}
+
+			// 组卷积时每个分块包含若干个完整的组, 输入特征图也只取这几个组的通道
+			tile_cfg.kernal_cfg.kernal_n = (uint16_t)kernal_n_of_chunk;
+
+			if(cfg->group_n > 1){
+				tile_cfg.group_n = (uint16_t)(kernal_n_of_chunk / n_foreach_group);
+				tile_cfg.fmap_cfg.ifmap_chn_n = (uint16_t)kernal_n_of_chunk;
+				tile_cfg.kernal_cfg.kernal_chn_n = (uint16_t)kernal_n_of_chunk;
+
+				if(ifmap_strip_in_place){
+					// 每组的通道数是ATOMIC_C的整数倍, 故分块的起始通道也是通道组的边界
+					tile_cfg.fmap_cfg.ifmap_start_cgrp = (uint16_t)(kernal_id / atomic_c);
+					tile_cfg.ifmap_baseaddr = ifmap_baseaddr;
+				}else{
+					tile_cfg.ifmap_baseaddr =
+						ifmap_baseaddr + kernal_id * ifmap_w_of_strip * ((uint32_t)cfg->fmap_cfg.ifmap_height) * data_byte_n;
+				}
+			}else{
+				tile_cfg.ifmap_baseaddr = ifmap_baseaddr;
+			}
+
+			tile_cfg.kernal_wgt_baseaddr = cfg->kernal_wgt_baseaddr + kernal_id * wgt_byte_n_foreach_kernal;
+
+			if(ofmap_strip_in_place){
+				// 按最终输出特征图的跨距写出列条带, 列条带的起始列折算到输出特征图基地址, 分块的起始核号作为通道偏移
+				tile_cfg.ofmap_baseaddr = cfg->ofmap_baseaddr + ofmap_x * atomic_k * ofmap_data_byte_n;
+				tile_cfg.fmap_cfg.ofmap_chn_ofs = (uint16_t)kernal_id;
+				tile_cfg.fmap_cfg.ofmap_row_pitch = ofmap_row_pitch;
+				tile_cfg.fmap_cfg.ofmap_cgrp_pitch = ofmap_cgrp_pitch;
+			}else{
+				tile_cfg.ofmap_baseaddr =
+					ofmap_strip_buffered ?
+						tile_buf->ofmap_strip_buf:
+						(cfg->ofmap_baseaddr + kernal_id * ofmap_width * ofmap_height * ofmap_data_byte_n);
+			}
+
+			int run_res = axi_generic_conv_tile_run_once(
+				handler, &tile_cfg,
+				cfg->bn_act_cfg.use_bn_unit ? (bn_param_buf + kernal_id):NULL,
+				axi_generic_conv_tile_cal_s2mm_cmd_n(handler, cfg, kernal_n_of_chunk, ofmap_height)
+			);
+
+			if(run_res){
+				return run_res;
+			}
+
+			if(ofmap_strip_buffered){
+				if(tile_buf->invalidate_dcache != NULL){
+					tile_buf->invalidate_dcache(
+						(void*)tile_buf->ofmap_strip_buf,
+						ofmap_w_of_strip * ofmap_height *
+							axi_generic_conv_get_ofmap_pt_byte_n(cfg->fmap_cfg.ofmap_data_type, kernal_n_of_chunk)
+					);
+				}
+
+				axi_generic_conv_tile_copy_cols(
+					tile_buf->ofmap_strip_buf, ofmap_w_of_strip, 0,
+					cfg->ofmap_baseaddr + kernal_id * ofmap_width * ofmap_height * ofmap_data_byte_n, ofmap_width, ofmap_x,
+					ofmap_w_of_strip, ofmap_height,
+					(cfg->group_n > 1) ? (kernal_n_of_chunk / n_foreach_group):1,
+					(cfg->group_n > 1) ? n_foreach_group:kernal_n_of_chunk,
+					handler->property.atomic_k, ofmap_data_byte_n
+				);
+			}
+		}
+	}
+
+	if(ofmap_strip_buffered && tile_buf->flush_dcache != NULL){
+		tile_buf->flush_dcache(
+			(void*)cfg->ofmap_baseaddr,
+			ofmap_width * ofmap_height *
+				axi_generic_conv_get_ofmap_pt_byte_n(cfg->fmap_cfg.ofmap_data_type, cfg->kernal_cfg.kernal_n)
+		);
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  判断能否原位读取输入列条带
+        须支持输入特征图跨距, 且每组的输入通道数是ATOMIC_C的整数倍(每个通道组都是完整的)
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+@return 能否原位读取
+*************************/
+static uint8_t axi_generic_conv_tile_is_ifmap_strip_in_place(const AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
+	return
+		handler->property.ifmap_pitch_supported &&
+		(((axi_generic_conv_get_hw_chn_n(cfg->cal_cfg.cal_fmt, cfg->fmap_cfg.ifmap_chn_n) / cfg->group_n) % handler->property.atomic_c) == 0);
+}
+
+/*************************
+@cfg
+@private
+@brief  判断能否原位写出输出列条带
+        须支持输出特征图跨距, 且核组宽度和输出通道数都是ATOMIC_K的整数倍(每个输出通道组都是完整的),
+        这样列条带的每个输出子表面行都能按最终输出特征图的跨距落到对应位置
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+@return 能否原位写出
+*************************/
+static uint8_t axi_generic_conv_tile_is_ofmap_strip_in_place(const AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg){
+	uint32_t set_w = (cfg->group_n > 1) ? (((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n):((uint32_t)cfg->max_wgtblk_w);
+
+	return
+		handler->property.ofmap_pitch_supported &&
+		((set_w % handler->property.atomic_k) == 0) &&
+		((((uint32_t)cfg->kernal_cfg.kernal_n) % handler->property.atomic_k) == 0);
+}
+
+/*************************
+@cfg
+@private
+@brief  计算S2MM通道命令数(即输出子表面行数)
+        每个核组的输出按ATOMIC_K个通道划分子表面行, 非组卷积时核组宽度为权重块最大宽度, 组卷积时为每组核数
+@param  handler 通用卷积处理单元(加速器句柄)
+        cfg 配置参数(句柄)
+        kernal_n 本次计算的卷积核个数
+        ofmap_h 输出特征图高度
+@return S2MM通道命令数
+*************************/
+static uint32_t axi_generic_conv_tile_cal_s2mm_cmd_n(
+	const AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, uint32_t kernal_n, uint32_t ofmap_h){
+	uint32_t atomic_k = handler->property.atomic_k;
+	uint32_t set_w = (cfg->group_n > 1) ? (((uint32_t)cfg->kernal_cfg.kernal_n) / cfg->group_n):((uint32_t)cfg->max_wgtblk_w);
+	uint32_t full_set_n = kernal_n / set_w;
+	uint32_t last_set_w = kernal_n % set_w;
+
+	return (
+		full_set_n * ((set_w + atomic_k - 1) / atomic_k) +
+		((last_set_w + atomic_k - 1) / atomic_k)
+	) * ofmap_h;
+}
+
+/*************************
+@cfg
+@private
+@brief  拷贝特征图的若干列
+        特征图按通道组(每组atomic_n个通道, 组卷积时在每组内划分)存储, 每个通道组内按"行 -> 列 -> 通道"存储
+@param  src 源特征图基地址
+        src_w 源特征图宽度
+        src_x 源特征图起始列号
+        dst 目的特征图基地址
+        dst_w 目的特征图宽度
+        dst_x 目的特征图起始列号
+        copy_w 待拷贝的列数
+        h 特征图高度
+        group_n 分组数
+        n_foreach_group 每组的通道数
+        atomic_n 每个通道组的通道数
+        data_byte_n 每个数据的字节数(为1时按通道对存储)
+@return none
+*************************/
+static void axi_generic_conv_tile_copy_cols(
+	const uint8_t* src, uint32_t src_w, uint32_t src_x, uint8_t* dst, uint32_t dst_w, uint32_t dst_x,
+	uint32_t copy_w, uint32_t h, uint32_t group_n, uint32_t n_foreach_group, uint32_t atomic_n, uint32_t data_byte_n){
+	for(uint32_t grp_id = 0;grp_id < group_n;grp_id++){
+		for(uint32_t chn_ofs = 0;chn_ofs < n_foreach_group;chn_ofs += atomic_n){
+			uint32_t chn_id = grp_id * n_foreach_group + chn_ofs;
+			uint32_t sfc_depth = (n_foreach_group - chn_ofs > atomic_n) ? atomic_n:(n_foreach_group - chn_ofs);
+			uint32_t sfc_byte_n = (data_byte_n == 1) ? ((sfc_depth + 1) & (~((uint32_t)1))):(sfc_depth * data_byte_n);
+			const uint8_t* src_cgrp = src + chn_id * h * src_w * data_byte_n;
+			uint8_t* dst_cgrp = dst + chn_id * h * dst_w * data_byte_n;
+
+			for(uint32_t y = 0;y < h;y++){
+				memcpy(
+					(void*)(dst_cgrp + (y * dst_w + dst_x) * sfc_byte_n),
+					(const void*)(src_cgrp + (y * src_w + src_x) * sfc_byte_n),
+					copy_w * sfc_byte_n
+				);
+			}
+		}
+	}
+}
+
+/*************************
+@ctrl
+@private
+@brief  启动1次通用卷积处理单元并等待完成
+@param  handler 通用卷积处理单元(加速器句柄)
+        tile_cfg 本次计算的配置参数(句柄)
+        bn_param_buf 本次计算的BN参数(不使用BN单元时为NULL)
+        s2mm_cmd_n 本次计算的S2MM通道命令数
+@return 是否成功
+*************************/
+static int axi_generic_conv_tile_run_once(
+	AxiGnrConvHandler* handler, const AxiGnrConvCfg* tile_cfg, BNParam* bn_param_buf, uint32_t s2mm_cmd_n){
+	axi_generic_conv_clr_cmd_fns_n(handler, CONV_C_ALL);
+
+	if(axi_generic_conv_cfg(handler, tile_cfg)){
+		return -2;
+	}
+
+	if(bn_param_buf != NULL){
+		axi_generic_conv_wr_bn_param_mem(handler, bn_param_buf, (uint32_t)tile_cfg->kernal_cfg.kernal_n);
+	}
+
+	if(axi_generic_conv_set_done_threshold(handler, s2mm_cmd_n)){
+		return -2;
+	}
+
+	axi_generic_conv_enable_cal_sub_sys(handler);
+
+	if(handler->property.bn_supported){
+		axi_generic_conv_enable_bn_act_proc(handler);
+	}
+
+	if(axi_generic_conv_start(handler)){
+		axi_generic_conv_disable_cal_sub_sys(handler);
+		axi_generic_conv_disable_bn_act_proc(handler);
+
+		return -3;
+	}
+
+	int wait_res = axi_generic_conv_wait_done(handler);
+
+	axi_generic_conv_disable_cal_sub_sys(handler);
+	axi_generic_conv_disable_bn_act_proc(handler);
+	axi_generic_conv_clr_cmd_fns_n(handler, CONV_C_ALL);
+
+	return wait_res ? -3:0;
+}
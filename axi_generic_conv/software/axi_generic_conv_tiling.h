@@ -0,0 +1,45 @@
+/************************************************************************************************************************
+通用卷积处理单元分块执行库(接口头文件)
+@brief  当卷积层超出片上限制(卷积核个数 > 最大的卷积核个数, 输出特征图过宽导致中间结果缓存存不下1行,
+        输入特征图宽度超过特征图缓存表面行长度)时, 将其拆分为卷积核分块和带重叠的列条带, 分多次启动通用卷积处理单元
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.17 1.01 支持按输入特征图跨距原位读取输入列条带
+        2026.10.17 1.02 支持按输出特征图跨距原位写出输出列条带
+************************************************************************************************************************/
+
+#include "axi_generic_conv.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 函数指针类型: DCache维护(刷新/无效化)
+typedef void (*AxiGnrConvTileCacheHook)(void* addr, uint32_t len);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 分块方案
+typedef struct{
+	uint16_t kernal_chunk_n; // 卷积核分块数
+	uint16_t kernal_n_foreach_chunk; // 每个卷积核分块的核数(最后1个分块可能更少)
+	uint16_t strip_n; // 列条带数
+	uint16_t ofmap_w_foreach_strip; // 每个列条带的输出特征图宽度(最后1个条带可能更窄)
+	uint16_t ifmap_w_foreach_strip; // 每个列条带的最大输入特征图宽度(含重叠部分)
+	uint32_t s2mm_cmd_n_foreach_chunk; // 每个卷积核分块(未分列条带时)的S2MM通道命令数
+	uint32_t ifmap_strip_buf_len; // 列条带输入特征图暂存区的字节数(无需分列条带或可原位读取输入列条带时为0)
+	uint32_t ofmap_strip_buf_len; // 列条带输出特征图暂存区的字节数(无需分列条带或可原位写出输出列条带时为0)
+}AxiGnrConvTilePlan;
+
+// 结构体: 分块执行暂存区
+typedef struct{
+	uint8_t* ifmap_strip_buf; // 列条带输入特征图暂存区(至少ifmap_strip_buf_len字节, 为0字节时可为NULL)
+	uint8_t* ofmap_strip_buf; // 列条带输出特征图暂存区(至少ofmap_strip_buf_len字节, 为0字节时可为NULL)
+	AxiGnrConvTileCacheHook flush_dcache; // 刷新DCache(可为NULL)
+	AxiGnrConvTileCacheHook invalidate_dcache; // 无效化DCache(可为NULL)
+}AxiGnrConvTileBuf;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int axi_generic_conv_tile_plan(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, AxiGnrConvTilePlan* plan); // 生成分块方案
+int axi_generic_conv_tile_run(AxiGnrConvHandler* handler, const AxiGnrConvCfg* cfg, const AxiGnrConvTilePlan* plan,
+	BNParam* bn_param_buf, const AxiGnrConvTileBuf* tile_buf); // 按分块方案执行卷积层
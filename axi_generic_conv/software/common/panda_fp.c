@@ -0,0 +1,330 @@
+/************************************************************************************************************************
+共享浮点转换库
+@brief  提供FP16与FP32/双精度浮点数之间的逐值转换和批量转换, 供驱动侧的重排库和各测试平台共用
+        转FP16时按IEEE 754向最近偶数舍入, 支持非规则数, 上溢时得到无穷大, NaN保持符号并静默化;
+        从FP16转换时正确处理零、非规则数、无穷大和NaN(NaN同样被静默化)
+        批量转换在支持F16C(x86, 编译时加-mavx -mf16c)或NEON FP16(ARM)时向量化, 结果与逐值转换逐位相同;
+        双精度浮点数先转为FP32再转FP16, 与逐值转换的舍入过程一致
+        测试平台的DPI函数在tb/panda_fp/panda_fp.c中, 驱动侧只需编译本文件
+@date   2026/10/17
+@author 陈家耀
+@eidt   2026.10.17 1.00 创建了第1个正式版本(由测试平台共享浮点转换库迁移而来)
+************************************************************************************************************************/
+
+#include "panda_fp.h"
+
+#if defined(__F16C__) && defined(__AVX__)
+#include <immintrin.h>
+#define PANDA_FP_USE_F16C
+#elif defined(__ARM_NEON) && defined(__ARM_FP16_FORMAT_IEEE)
+#include <arm_neon.h>
+#define PANDA_FP_USE_NEON_FP16
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 双精度浮点数批量转换的分段长度
+#define PANDA_FP_BLK_LEN 64
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  FP32转FP16
+        向最近偶数舍入, 支持非规则数, 上溢时得到无穷大, NaN保持符号并静默化
+@param  f FP32
+@return FP16
+*************************/
+uint16_t panda_fp_fp32_to_fp16(float f){
+	uint32_t x;
+
+	memcpy((void*)&x, (const void*)&f, 4);
+
+	uint32_t sign = (x >> 16) & 0x8000;
+	uint32_t ec = (x >> 23) & 0xFF;
+	uint32_t mts = x & 0x7FFFFF;
+	int32_t exp = ((int32_t)ec) - 127 + 15;
+
+	if(ec == 0xFF){
+		return (uint16_t)(sign | 0x7C00 | (mts ? (0x200 | (mts >> 13)):0));
+	}
+
+	if(exp >= 31){
+		return (uint16_t)(sign | 0x7C00);
+	}
+
+	if(exp <= 0){
+		// 非规则数, 舍入位和粘滞位须在移位前从完整的尾数中取出
+		if(exp < -10){
+			return (uint16_t)sign;
+		}
+
+		uint32_t shift = (uint32_t)(14 - exp);
+		uint32_t m = (mts | 0x800000) >> shift;
+		uint32_t rem = (mts | 0x800000) & ((((uint32_t)1) << shift) - 1);
+		uint32_t half = ((uint32_t)1) << (shift - 1);
+
+		if(rem > half || (rem == half && (m & 1))){
+			m++; // 进位到最小的规则数时编码自然正确
+		}
+
+		return (uint16_t)(sign | m);
+	}
+
+	uint32_t h = (((uint32_t)exp) << 10) | (mts >> 13);
+	uint32_t rem = mts & 0x1FFF;
+
+	if(rem > 0x1000 || (rem == 0x1000 && (h & 1))){
+		h++; // 进位到阶码时编码自然正确(含上溢到无穷大)
+	}
+
+	return (uint16_t)(sign | h);
+}
+
+/*************************
+@cfg
+@public
+@brief  FP16转FP32
+        零保持符号, 非规则数标准化尾数, 无穷大保持符号, NaN保持符号和高位载荷并静默化
+@param  h FP16
+@return FP32
+*************************/
+float panda_fp_fp16_to_fp32(uint16_t h){
+	uint32_t sign = ((uint32_t)(h & 0x8000)) << 16;
+	int32_t exp = (h >> 10) & 0x1F;
+	uint32_t mts = h & 0x3FF;
+	uint32_t x;
+	float f;
+
+	if(exp == 0x1F){
+		x = sign | 0x7F800000 | (mts ? ((mts | 0x200) << 13):0);
+	}else if(exp == 0 && mts == 0){
+		x = sign;
+	}else{
+		if(exp == 0){
+			// 非规则数, 标准化尾数
+			exp = 1;
+
+			while(!(mts & 0x400)){
+				mts <<= 1;
+				exp--;
+			}
+
+			mts &= 0x3FF;
+		}
+
+		x = sign | (((uint32_t)(exp + 112)) << 23) | (mts << 13);
+	}
+
+	memcpy((void*)&f, (const void*)&x, 4);
+
+	return f;
+}
+
+/*************************
+@cfg
+@public
+@brief  双精度浮点数转FP16
+        先转为FP32(向最近偶数舍入), 再转FP16
+@param  d 双精度浮点数
+@return FP16
+*************************/
+unsigned int encode_fp16(double d){
+	return panda_fp_fp32_to_fp16((float)d);
+}
+
+/*************************
+@cfg
+@public
+@brief  FP16转双精度浮点数
+@param  fp16 FP16(只使用低16位)
+@return 双精度浮点数
+*************************/
+double decode_fp16(unsigned int fp16){
+	return (double)panda_fp_fp16_to_fp32((uint16_t)fp16);
+}
+
+/*************************
+@cfg
+@public
+@brief  双精度浮点数转FP32
+@param  d 双精度浮点数
+@return FP32
+*************************/
+unsigned int encode_fp32(double d){
+	float f = (float)d;
+	uint32_t f_int;
+
+	memcpy((void*)&f_int, (const void*)&f, 4);
+
+	return f_int;
+}
+
+/*************************
+@cfg
+@public
+@brief  FP32转双精度浮点数
+@param  fp32 FP32
+@return 双精度浮点数
+*************************/
+double decode_fp32(unsigned int fp32){
+	float f;
+
+	memcpy((void*)&f, (const void*)&fp32, 4);
+
+	return (double)f;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  批量从FP32转FP16
+@param  src FP32数组
+        dst FP16数组
+        n 数据个数
+@return none
+*************************/
+void panda_fp_fp32_to_fp16_bulk(const float* src, uint16_t* dst, uint32_t n){
+	uint32_t i = 0;
+
+#if defined(PANDA_FP_USE_F16C)
+	for(;i + 8 <= n;i += 8){
+		_mm_storeu_si128(
+			(__m128i*)(dst + i),
+			_mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+		);
+	}
+#elif defined(PANDA_FP_USE_NEON_FP16)
+	for(;i + 4 <= n;i += 4){
+		vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32((const float32_t*)(src + i)))));
+	}
+#endif
+
+	for(;i < n;i++){
+		dst[i] = panda_fp_fp32_to_fp16(src[i]);
+	}
+}
+
+/*************************
+@cfg
+@public
+@brief  批量从FP16转FP32
+@param  src FP16数组
+        dst FP32数组
+        n 数据个数
+@return none
+*************************/
+void panda_fp_fp16_to_fp32_bulk(const uint16_t* src, float* dst, uint32_t n){
+	uint32_t i = 0;
+
+#if defined(PANDA_FP_USE_F16C)
+	for(;i + 8 <= n;i += 8){
+		_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+	}
+#elif defined(PANDA_FP_USE_NEON_FP16)
+	for(;i + 4 <= n;i += 4){
+		vst1q_f32((float32_t*)(dst + i), vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+	}
+#endif
+
+	for(;i < n;i++){
+		dst[i] = panda_fp_fp16_to_fp32(src[i]);
+	}
+}
+
+/*************************
+@cfg
+@public
+@brief  批量转FP16
+        分段转为FP32后批量转FP16
+@param  src 双精度浮点数数组
+        dst FP16数组
+        n 数据个数
+@return none
+*************************/
+void panda_fp_encode_fp16_bulk(const double* src, uint16_t* dst, uint32_t n){
+	float blk[PANDA_FP_BLK_LEN];
+
+	for(uint32_t i = 0;i < n;i += PANDA_FP_BLK_LEN){
+		uint32_t blk_len = (n - i > PANDA_FP_BLK_LEN) ? PANDA_FP_BLK_LEN:(n - i);
+
+		for(uint32_t j = 0;j < blk_len;j++){
+			blk[j] = (float)src[i + j];
+		}
+
+		panda_fp_fp32_to_fp16_bulk(blk, dst + i, blk_len);
+	}
+}
+
+/*************************
+@cfg
+@public
+@brief  批量从FP16转换
+        分段批量转为FP32后再转为双精度浮点数
+@param  src FP16数组
+        dst 双精度浮点数数组
+        n 数据个数
+@return none
+*************************/
+void panda_fp_decode_fp16_bulk(const uint16_t* src, double* dst, uint32_t n){
+	float blk[PANDA_FP_BLK_LEN];
+
+	for(uint32_t i = 0;i < n;i += PANDA_FP_BLK_LEN){
+		uint32_t blk_len = (n - i > PANDA_FP_BLK_LEN) ? PANDA_FP_BLK_LEN:(n - i);
+
+		panda_fp_fp16_to_fp32_bulk(src + i, blk, blk_len);
+
+		for(uint32_t j = 0;j < blk_len;j++){
+			dst[i + j] = (double)blk[j];
+		}
+	}
+}
+
+/*************************
+@cfg
+@public
+@brief  批量转FP32
+@param  src 双精度浮点数数组
+        dst FP32数组
+        n 数据个数
+@return none
+*************************/
+void panda_fp_encode_fp32_bulk(const double* src, uint32_t* dst, uint32_t n){
+	uint32_t i = 0;
+
+#if defined(PANDA_FP_USE_F16C)
+	for(;i + 4 <= n;i += 4){
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_castps_si128(_mm256_cvtpd_ps(_mm256_loadu_pd(src + i))));
+	}
+#endif
+
+	for(;i < n;i++){
+		dst[i] = encode_fp32(src[i]);
+	}
+}
+
+/*************************
+@cfg
+@public
+@brief  批量从FP32转换
+@param  src FP32数组
+        dst 双精度浮点数数组
+        n 数据个数
+@return none
+*************************/
+void panda_fp_decode_fp32_bulk(const uint32_t* src, double* dst, uint32_t n){
+	uint32_t i = 0;
+
+#if defined(PANDA_FP_USE_F16C)
+	for(;i + 4 <= n;i += 4){
+		_mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(src + i)))));
+	}
+#endif
+
+	for(;i < n;i++){
+		dst[i] = decode_fp32(src[i]);
+	}
+}
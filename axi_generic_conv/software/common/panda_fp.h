@@ -0,0 +1,36 @@
+/************************************************************************************************************************
+共享浮点转换库(接口头文件)
+@brief  提供FP16与FP32/双精度浮点数之间的逐值转换和批量转换, 供驱动侧的重排库和各测试平台共用
+        转FP16时按IEEE 754向最近偶数舍入, 支持非规则数, 上溢时得到无穷大, NaN保持符号并静默化;
+        从FP16转换时正确处理零、非规则数、无穷大和NaN
+        批量转换在支持F16C(x86)或NEON FP16(ARM)时向量化, 结果与逐值转换逐位相同
+@date   2026/10/17
+@author 陈家耀
+@eidt   2026.10.17 1.00 创建了第1个正式版本(由测试平台共享浮点转换库迁移而来)
+************************************************************************************************************************/
+
+#ifndef __PANDA_FP_H
+#define __PANDA_FP_H
+
+#include <stdint.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 逐值转换
+uint16_t panda_fp_fp32_to_fp16(float f); // FP32转FP16
+float panda_fp_fp16_to_fp32(uint16_t h); // FP16转FP32
+unsigned int encode_fp16(double d); // 双精度浮点数转FP16
+double decode_fp16(unsigned int fp16); // FP16转双精度浮点数
+unsigned int encode_fp32(double d); // 双精度浮点数转FP32
+double decode_fp32(unsigned int fp32); // FP32转双精度浮点数
+
+// 批量转换
+void panda_fp_fp32_to_fp16_bulk(const float* src, uint16_t* dst, uint32_t n); // 批量从FP32转FP16
+void panda_fp_fp16_to_fp32_bulk(const uint16_t* src, float* dst, uint32_t n); // 批量从FP16转FP32
+void panda_fp_encode_fp16_bulk(const double* src, uint16_t* dst, uint32_t n); // 批量转FP16
+void panda_fp_decode_fp16_bulk(const uint16_t* src, double* dst, uint32_t n); // 批量从FP16转换
+void panda_fp_encode_fp32_bulk(const double* src, uint32_t* dst, uint32_t n); // 批量转FP32
+void panda_fp_decode_fp32_bulk(const uint32_t* src, double* dst, uint32_t n); // 批量从FP32转换
+
+#endif
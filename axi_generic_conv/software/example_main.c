@@ -39,6 +39,7 @@
 
 #include "xparameters.h"
 #include "xil_cache.h"
+#include "sleep.h"
 
 #include <stdio.h>
 
@@ -55,6 +56,7 @@ static int test_conv_layer(
 	int out_fmap_len, uint32_t out_fmap_sfc_row_n,
 	const AxiGnrConvCfg* conv_cfg
 );
+static void wait_done_hook(void* arg);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -63,6 +65,7 @@ static FIL file_handler; // 文件描述符
 
 static AxiGnrConvHandler axi_generic_conv; // 通用卷积处理单元
 static AxiGnrConvPerfMonsts pm_sts; // 性能监测状态
+static AxiGnrConvBufPlan buf_plan; // 缓存划分规划结果
 
 // 输入特征图(数组)
 static uint16_t in_fmap_0[640 * 640 * 3];
@@ -98,15 +101,18 @@ int main(){
 		return -1;
 	}
 
+	// 设置等待完成时的回调函数
+	axi_generic_conv_set_wait_hook(&axi_generic_conv, wait_done_hook, NULL);
+
 	AxiGnrConvCfg conv_cfg;
 
+	memset(&conv_cfg, 0, sizeof(AxiGnrConvCfg));
+
 	conv_cfg.ifmap_baseaddr = (uint8_t*)in_fmap_0;
 	conv_cfg.ofmap_baseaddr = (uint8_t*)out_fmap_0;
 	conv_cfg.kernal_wgt_baseaddr = (uint8_t*)kwgt_0;
 	conv_cfg.group_n = 1;
-	conv_cfg.max_wgtblk_w = 16;
 	conv_cfg.cal_cfg.cal_fmt = CONV_FP16;
-	conv_cfg.cal_cfg.cal_round_n = 2;
 	conv_cfg.cal_cfg.conv_horizontal_stride = 1;
 	conv_cfg.cal_cfg.conv_vertical_stride = 1;
 	conv_cfg.fmap_cfg.external_padding_bottom = 1;
@@ -123,15 +129,18 @@ int main(){
 	conv_cfg.kernal_cfg.kernal_chn_n = 3;
 	conv_cfg.kernal_cfg.kernal_n = 16;
 	conv_cfg.kernal_cfg.kernal_shape = CONV_KRN_3x3;
-	conv_cfg.buffer_cfg.fmbufbankn = 14;
-	conv_cfg.buffer_cfg.fmbufcoln = CONV_COLN_1024;
-	conv_cfg.buffer_cfg.sfc_n_each_wgtblk = CONV_WGTBLK_SFC_N_16;
 	conv_cfg.bn_act_cfg.use_bn_unit = 1;
 	conv_cfg.bn_act_cfg.act_func_type = ACT_FUNC_NONE;
 	conv_cfg.bn_act_cfg.bn_is_a_eq_1 = 1;
 	conv_cfg.bn_act_cfg.bn_is_b_eq_0 = 0;
 	conv_cfg.bn_act_cfg.leaky_relu_param_alpha = 0.01f;
 
+	// 规划缓存划分
+	if(axi_generic_conv_plan_buffer(&axi_generic_conv.property, &conv_cfg, &buf_plan)){
+		return -1;
+	}
+	printf("planned ddr traffic = %d\r\n", (int)buf_plan.total_traffic);
+
 	if(test_conv_layer(
 		"in_fmap_0.bin", "kernal_0.bin", "bn_0.bin", "out_fmap_0.bin",
 		(void*)bn_params_0,
@@ -145,9 +154,7 @@ int main(){
 	conv_cfg.ofmap_baseaddr = (uint8_t*)out_fmap_1;
 	conv_cfg.kernal_wgt_baseaddr = (uint8_t*)kwgt_1;
 	conv_cfg.group_n = 1;
-	conv_cfg.max_wgtblk_w = 16;
 	conv_cfg.cal_cfg.cal_fmt = CONV_FP16;
-	conv_cfg.cal_cfg.cal_round_n = 2;
 	conv_cfg.cal_cfg.conv_horizontal_stride = 1;
 	conv_cfg.cal_cfg.conv_vertical_stride = 1;
 	conv_cfg.fmap_cfg.external_padding_bottom = 1;
@@ -164,15 +171,18 @@ int main(){
 	conv_cfg.kernal_cfg.kernal_chn_n = 16;
 	conv_cfg.kernal_cfg.kernal_n = 32;
 	conv_cfg.kernal_cfg.kernal_shape = CONV_KRN_3x3;
-	conv_cfg.buffer_cfg.fmbufbankn = 14;
-	conv_cfg.buffer_cfg.fmbufcoln = CONV_COLN_512;
-	conv_cfg.buffer_cfg.sfc_n_each_wgtblk = CONV_WGTBLK_SFC_N_16;
 	conv_cfg.bn_act_cfg.use_bn_unit = 1;
 	conv_cfg.bn_act_cfg.act_func_type = ACT_FUNC_NONE;
 	conv_cfg.bn_act_cfg.bn_is_a_eq_1 = 1;
 	conv_cfg.bn_act_cfg.bn_is_b_eq_0 = 0;
 	conv_cfg.bn_act_cfg.leaky_relu_param_alpha = 0.1f;
 
+	// 规划缓存划分
+	if(axi_generic_conv_plan_buffer(&axi_generic_conv.property, &conv_cfg, &buf_plan)){
+		return -1;
+	}
+	printf("planned ddr traffic = %d\r\n", (int)buf_plan.total_traffic);
+
 	if(test_conv_layer(
 		"in_fmap_1.bin", "kernal_1.bin", "bn_1.bin", "out_fmap_1.bin",
 		(void*)bn_params_1,
@@ -258,6 +268,14 @@ static int test_conv_layer(
 	Xil_DCacheFlushRange((INTPTR)conv_cfg->kernal_wgt_baseaddr, kernal_len);
 #endif
 
+	// 设置完成阈值并使能完成中断
+	if(axi_generic_conv_set_done_threshold(&axi_generic_conv, out_fmap_sfc_row_n)){
+		return -1;
+	}
+	if(axi_generic_conv_enable_irq(&axi_generic_conv)){
+		return -1;
+	}
+
 	// 启动通用卷积处理单元
 	if(axi_generic_conv_enable_cal_sub_sys(&axi_generic_conv)){
 		return -1;
@@ -277,7 +295,9 @@ static int test_conv_layer(
 	}
 
 	// 等待通用卷积处理单元的数据输出完成
-	while(axi_generic_conv_get_cmd_fns_n(&axi_generic_conv, CONV_Q_CMD_FNS_N_S2MM) < out_fmap_sfc_row_n);
+	if(axi_generic_conv_wait_done(&axi_generic_conv)){
+		return -1;
+	}
 
 	// 获取性能监测计数器的值
 	axi_generic_conv_get_pm_cnt(&axi_generic_conv, &pm_sts);
@@ -321,3 +341,8 @@ static int test_conv_layer(
 
 	return 0;
 }
+
+// 等待完成时的回调函数: 可在此处执行CPU侧的预处理/后处理, 或令CPU休眠直到完成中断到来
+static void wait_done_hook(void* arg){
+	usleep(50);
+}
@@ -27,7 +27,7 @@ SOFTWARE.
 本模块: AXI-通用卷积处理单元(顶层)
 
 描述:
-包括寄存器配置接口、BN参数MEM控制器、控制子系统、数据枢纽、计算子系统
+包括寄存器配置接口、层描述符读取与执行单元、BN参数MEM控制器、控制子系统、数据枢纽、计算子系统
 
 支持普通卷积(包括全连接层)、组卷积(包括深度可分离卷积)、转置卷积(转换为合适的特征图填充与卷积步长来实现)
 支持特征图外填充与内填充
@@ -35,6 +35,7 @@ SOFTWARE.
 支持计算轮次拓展
 支持批归一化处理
 支持Leaky-Relu激活、Sigmoid激活和Tanh激活
+支持层描述符链(逐层读取描述符并执行, 无需CPU逐层配置)
 
 注意：
 需要外接2个DMA(MM2S)通道和1个DMA(S2MM)通道
@@ -208,7 +209,10 @@ module axi_generic_conv #(
 	output wire[S2MM_STREAM_DATA_WIDTH/8-1:0] m_axis_fnl_res_keep,
 	output wire m_axis_fnl_res_last, // 本行最后1个最终结果(标志)
 	output wire m_axis_fnl_res_valid,
-	input wire m_axis_fnl_res_ready
+	input wire m_axis_fnl_res_ready,
+	
+	// 中断
+	output wire irq // 完成中断
 );
 	
 	// 计算bit_depth的最高有效位编号(即位数-1)
@@ -248,6 +252,9 @@ module axi_generic_conv #(
 	wire[2:0] data_hub_sfc_n_each_wgtblk; // 每个权重块的表面个数的类型
 	wire[7:0] data_hub_kbufgrpn; // 可缓存的通道组数 - 1
 	wire[7:0] data_hub_fmbufbankn; // 分配给特征图缓存的Bank数
+	// 性能监测
+	wire data_hub_on_fm_sfc_row_rplc; // 置换1个特征图表面行(指示)
+	wire data_hub_on_kbuf_sw_rgn_rplc; // 置换1个交换区通道组(指示)
 	// [特征图表面行读请求(AXIS主机)]
 	wire[103:0] m_fm_rd_req_axis_data;
 	wire m_fm_rd_req_axis_valid;
@@ -276,6 +283,8 @@ module axi_generic_conv #(
 	wire[5:0] fnl_res_tr_req_gen_max_wgtblk_w; // 权重块最大宽度
 	wire fnl_res_tr_req_gen_is_grp_conv_mode; // 是否处于组卷积模式
 	wire[15:0] fnl_res_tr_req_gen_n_foreach_group; // 每组的通道数/核数 - 1
+	wire[23:0] fnl_res_tr_req_gen_ofmap_row_pitch; // 输出特征图表面行跨距(0表示紧密存储)
+	wire[31:0] fnl_res_tr_req_gen_ofmap_cgrp_pitch; // 输出特征图通道组跨距(0表示紧密存储)
 	// [块级控制]
 	wire fnl_res_trans_blk_start;
 	wire fnl_res_trans_blk_idle;
@@ -312,6 +321,8 @@ module axi_generic_conv #(
 	wire[4:0] bn_act_bn_fixed_point_quat_accrc; // (批归一化操作数A)定点数量化精度
 	wire bn_act_bn_is_a_eq_1; // 批归一化参数A的实际值为1(标志)
 	wire bn_act_bn_is_b_eq_0; // 批归一化参数B的实际值为0(标志)
+	wire bn_act_en_int8_requant; // 使能INT8逐通道重量化
+	wire[3:0] bn_act_out_fixed_point_quat_accrc; // 输出舍入单元的定点数量化精度
 	wire[4:0] bn_act_leaky_relu_fixed_point_quat_accrc; // (泄露Relu激活参数)定点数量化精度
 	wire[31:0] bn_act_leaky_relu_param_alpha; // 泄露Relu激活参数
 	wire[4:0] bn_act_sigmoid_tanh_fixed_point_quat_accrc; // (Sigmoid或Tanh输入)定点数量化精度
@@ -368,6 +379,20 @@ module axi_generic_conv #(
 	wire m_axis_ext_collector_last;
 	wire m_axis_ext_collector_valid;
 	wire m_axis_ext_collector_ready;
+	// 层描述符读取
+	wire desc_dma_sel; // 0号MM2S通道选择(1'b1 -> 层描述符读取与执行单元, 1'b0 -> 数据枢纽)
+	// [DMA命令(AXIS主机)]
+	wire[55:0] m_desc_dma_cmd_axis_data; // {待传输字节数(24bit), 传输首地址(32bit)}
+	wire m_desc_dma_cmd_axis_user; // {固定(1'b1)/递增(1'b0)传输(1bit)}
+	wire m_desc_dma_cmd_axis_last; // 帧尾标志
+	wire m_desc_dma_cmd_axis_valid;
+	wire m_desc_dma_cmd_axis_ready;
+	// [DMA数据流(AXIS从机)]
+	wire[MM2S_STREAM_DATA_WIDTH-1:0] s_desc_dma_strm_axis_data;
+	wire[MM2S_STREAM_DATA_WIDTH/8-1:0] s_desc_dma_strm_axis_keep;
+	wire s_desc_dma_strm_axis_last;
+	wire s_desc_dma_strm_axis_valid;
+	wire s_desc_dma_strm_axis_ready;
 	
 	axi_generic_conv_core #(
 		.MAC_ARRAY_CLK_RATE(MAC_ARRAY_CLK_RATE),
@@ -478,6 +503,8 @@ module axi_generic_conv #(
 		.data_hub_sfc_n_each_wgtblk(data_hub_sfc_n_each_wgtblk),
 		.data_hub_kbufgrpn(data_hub_kbufgrpn),
 		.data_hub_fmbufbankn(data_hub_fmbufbankn),
+		.data_hub_on_fm_sfc_row_rplc(data_hub_on_fm_sfc_row_rplc),
+		.data_hub_on_kbuf_sw_rgn_rplc(data_hub_on_kbuf_sw_rgn_rplc),
 		.m_fm_rd_req_axis_data(m_fm_rd_req_axis_data),
 		.m_fm_rd_req_axis_valid(m_fm_rd_req_axis_valid),
 		.m_fm_rd_req_axis_ready(m_fm_rd_req_axis_ready),
@@ -501,6 +528,9 @@ module axi_generic_conv #(
 		.fnl_res_tr_req_gen_max_wgtblk_w(fnl_res_tr_req_gen_max_wgtblk_w),
 		.fnl_res_tr_req_gen_is_grp_conv_mode(fnl_res_tr_req_gen_is_grp_conv_mode),
 		.fnl_res_tr_req_gen_n_foreach_group(fnl_res_tr_req_gen_n_foreach_group),
+		.fnl_res_tr_req_gen_en_fused_max_pool(),
+		.fnl_res_tr_req_gen_ofmap_row_pitch(fnl_res_tr_req_gen_ofmap_row_pitch),
+		.fnl_res_tr_req_gen_ofmap_cgrp_pitch(fnl_res_tr_req_gen_ofmap_cgrp_pitch),
 		.fnl_res_trans_blk_start(fnl_res_trans_blk_start),
 		.fnl_res_trans_blk_idle(fnl_res_trans_blk_idle),
 		.fnl_res_trans_blk_done(fnl_res_trans_blk_done),
@@ -530,9 +560,15 @@ module axi_generic_conv #(
 		.bn_act_bn_fixed_point_quat_accrc(bn_act_bn_fixed_point_quat_accrc),
 		.bn_act_bn_is_a_eq_1(bn_act_bn_is_a_eq_1),
 		.bn_act_bn_is_b_eq_0(bn_act_bn_is_b_eq_0),
+		.bn_act_en_int8_requant(bn_act_en_int8_requant),
+		.bn_act_out_fixed_point_quat_accrc(bn_act_out_fixed_point_quat_accrc),
 		.bn_act_leaky_relu_fixed_point_quat_accrc(bn_act_leaky_relu_fixed_point_quat_accrc),
 		.bn_act_leaky_relu_param_alpha(bn_act_leaky_relu_param_alpha),
 		.bn_act_sigmoid_tanh_fixed_point_quat_accrc(bn_act_sigmoid_tanh_fixed_point_quat_accrc),
+		.bn_act_en_residual_add(),
+		.bn_act_residual_relu(),
+		.bn_act_residual_scale_exp(),
+		.bn_act_residual_baseaddr(),
 		.m_axis_ext_bn_act_i_data(m_axis_ext_bn_act_i_data),
 		.m_axis_ext_bn_act_i_keep(m_axis_ext_bn_act_i_keep),
 		.m_axis_ext_bn_act_i_user(m_axis_ext_bn_act_i_user),
@@ -579,11 +615,55 @@ module axi_generic_conv #(
 		.m_axis_ext_collector_valid(m_axis_ext_collector_valid),
 		.m_axis_ext_collector_ready(m_axis_ext_collector_ready),
 		
+		.desc_dma_sel(desc_dma_sel),
+		.m_desc_dma_cmd_axis_data(m_desc_dma_cmd_axis_data),
+		.m_desc_dma_cmd_axis_user(m_desc_dma_cmd_axis_user),
+		.m_desc_dma_cmd_axis_last(m_desc_dma_cmd_axis_last),
+		.m_desc_dma_cmd_axis_valid(m_desc_dma_cmd_axis_valid),
+		.m_desc_dma_cmd_axis_ready(m_desc_dma_cmd_axis_ready),
+		.s_desc_dma_strm_axis_data(s_desc_dma_strm_axis_data),
+		.s_desc_dma_strm_axis_keep(s_desc_dma_strm_axis_keep),
+		.s_desc_dma_strm_axis_last(s_desc_dma_strm_axis_last),
+		.s_desc_dma_strm_axis_valid(s_desc_dma_strm_axis_valid),
+		.s_desc_dma_strm_axis_ready(s_desc_dma_strm_axis_ready),
+		
 		.mm2s_0_cmd_done(mm2s_0_cmd_done),
 		.mm2s_1_cmd_done(mm2s_1_cmd_done),
-		.s2mm_cmd_done(s2mm_cmd_done)
+		.s2mm_cmd_done(s2mm_cmd_done),
+		
+		.irq(irq)
 	);
 	
+	/**
+	0号MM2S通道选择
+	
+	读取层描述符或BN参数时, 0号MM2S通道由层描述符读取与执行单元占用, 否则由卷积数据枢纽占用
+	**/
+	// 卷积数据枢纽的0号MM2S通道
+	// [DMA命令(AXIS主机)]
+	wire[55:0] hub_m0_dma_cmd_axis_data;
+	wire hub_m0_dma_cmd_axis_user;
+	wire hub_m0_dma_cmd_axis_last;
+	wire hub_m0_dma_cmd_axis_valid;
+	wire hub_m0_dma_cmd_axis_ready;
+	// [DMA数据流(AXIS从机)]
+	wire hub_s0_dma_strm_axis_valid;
+	wire hub_s0_dma_strm_axis_ready;
+	
+	assign m0_dma_cmd_axis_data = desc_dma_sel ? m_desc_dma_cmd_axis_data:hub_m0_dma_cmd_axis_data;
+	assign m0_dma_cmd_axis_user = desc_dma_sel ? m_desc_dma_cmd_axis_user:hub_m0_dma_cmd_axis_user;
+	assign m0_dma_cmd_axis_last = desc_dma_sel ? m_desc_dma_cmd_axis_last:hub_m0_dma_cmd_axis_last;
+	assign m0_dma_cmd_axis_valid = desc_dma_sel ? m_desc_dma_cmd_axis_valid:hub_m0_dma_cmd_axis_valid;
+	assign m_desc_dma_cmd_axis_ready = desc_dma_sel & m0_dma_cmd_axis_ready;
+	assign hub_m0_dma_cmd_axis_ready = (~desc_dma_sel) & m0_dma_cmd_axis_ready;
+	
+	assign s_desc_dma_strm_axis_data = s0_dma_strm_axis_data;
+	assign s_desc_dma_strm_axis_keep = s0_dma_strm_axis_keep;
+	assign s_desc_dma_strm_axis_last = s0_dma_strm_axis_last;
+	assign s_desc_dma_strm_axis_valid = desc_dma_sel & s0_dma_strm_axis_valid;
+	assign hub_s0_dma_strm_axis_valid = (~desc_dma_sel) & s0_dma_strm_axis_valid;
+	assign s0_dma_strm_axis_ready = desc_dma_sel ? s_desc_dma_strm_axis_ready:hub_s0_dma_strm_axis_ready;
+	
 	/** 卷积数据枢纽 **/
 	// 实际表面行号映射表MEM主接口
 	wire actual_rid_mp_tb_mem_clk;
@@ -642,6 +722,9 @@ module axi_generic_conv #(
 		.kbufgrpn(data_hub_kbufgrpn),
 		.fmbufbankn(data_hub_fmbufbankn),
 		
+		.on_fm_sfc_row_rplc(data_hub_on_fm_sfc_row_rplc),
+		.on_kbuf_sw_rgn_rplc(data_hub_on_kbuf_sw_rgn_rplc),
+		
 		.s_fm_rd_req_axis_data(m_fm_rd_req_axis_data),
 		.s_fm_rd_req_axis_valid(m_fm_rd_req_axis_valid),
 		.s_fm_rd_req_axis_ready(m_fm_rd_req_axis_ready),
@@ -665,17 +748,17 @@ module axi_generic_conv #(
 		.m_kout_wgtblk_axis_valid(s_kernal_wgtblk_axis_valid),
 		.m_kout_wgtblk_axis_ready(s_kernal_wgtblk_axis_ready),
 		
-		.m0_dma_cmd_axis_data(m0_dma_cmd_axis_data),
-		.m0_dma_cmd_axis_user(m0_dma_cmd_axis_user),
-		.m0_dma_cmd_axis_last(m0_dma_cmd_axis_last),
-		.m0_dma_cmd_axis_valid(m0_dma_cmd_axis_valid),
-		.m0_dma_cmd_axis_ready(m0_dma_cmd_axis_ready),
+		.m0_dma_cmd_axis_data(hub_m0_dma_cmd_axis_data),
+		.m0_dma_cmd_axis_user(hub_m0_dma_cmd_axis_user),
+		.m0_dma_cmd_axis_last(hub_m0_dma_cmd_axis_last),
+		.m0_dma_cmd_axis_valid(hub_m0_dma_cmd_axis_valid),
+		.m0_dma_cmd_axis_ready(hub_m0_dma_cmd_axis_ready),
 		
 		.s0_dma_strm_axis_data(s0_dma_strm_axis_data),
 		.s0_dma_strm_axis_keep(s0_dma_strm_axis_keep),
 		.s0_dma_strm_axis_last(s0_dma_strm_axis_last),
-		.s0_dma_strm_axis_valid(s0_dma_strm_axis_valid),
-		.s0_dma_strm_axis_ready(s0_dma_strm_axis_ready),
+		.s0_dma_strm_axis_valid(hub_s0_dma_strm_axis_valid),
+		.s0_dma_strm_axis_ready(hub_s0_dma_strm_axis_ready),
 		
 		.m1_dma_cmd_axis_data(m1_dma_cmd_axis_data),
 		.m1_dma_cmd_axis_user(m1_dma_cmd_axis_user),
@@ -1040,6 +1123,9 @@ module axi_generic_conv #(
 		.is_grp_conv_mode(fnl_res_tr_req_gen_is_grp_conv_mode),
 		.n_foreach_group(fnl_res_tr_req_gen_n_foreach_group),
 		.en_send_sub_row_msg(1'b1),
+		.en_fused_max_pool(1'b0),
+		.ofmap_row_pitch(fnl_res_tr_req_gen_ofmap_row_pitch),
+		.ofmap_cgrp_pitch(fnl_res_tr_req_gen_ofmap_cgrp_pitch),
 		
 		.blk_start(fnl_res_trans_blk_start),
 		.blk_idle(fnl_res_trans_blk_idle),
@@ -1134,6 +1220,8 @@ module axi_generic_conv #(
 		.bn_fixed_point_quat_accrc(bn_act_bn_fixed_point_quat_accrc),
 		.bn_is_a_eq_1(bn_act_bn_is_a_eq_1),
 		.bn_is_b_eq_0(bn_act_bn_is_b_eq_0),
+		.en_int8_requant(bn_act_en_int8_requant),
+		.out_fixed_point_quat_accrc(bn_act_out_fixed_point_quat_accrc),
 		.is_in_const_mac_mode(1'b0),
 		.param_a_in_const_mac_mode(32'hxxxxxxxx),
 		.param_b_in_const_mac_mode(32'hxxxxxxxx),
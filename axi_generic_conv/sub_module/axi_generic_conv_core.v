@@ -27,7 +27,7 @@ SOFTWARE.
 本模块: AXI-通用卷积处理单元(核心)
 
 描述:
-包括寄存器配置接口、BN参数与Sigmoid函数值查找表MEM控制器、控制子系统、(数据枢纽)、计算子系统
+包括寄存器配置接口、层描述符读取与执行单元、BN参数与Sigmoid函数值查找表MEM控制器、控制子系统、(数据枢纽)、计算子系统
 
 已将可共享部分(数据枢纽、最终结果传输请求生成单元、中间结果缓存、BN与激活单元、输出数据舍入单元组、最终结果数据收集器)引出
 
@@ -37,6 +37,7 @@ SOFTWARE.
 支持计算轮次拓展
 支持批归一化处理
 支持Leaky-Relu激活和Sigmoid激活
+支持层描述符链(逐层读取描述符并执行, 无需CPU逐层配置)
 
 注意：
 BN与激活并行数(BN_ACT_PRL_N)必须<=核并行数(ATOMIC_K)
@@ -67,6 +68,9 @@ module axi_generic_conv_core #(
 	parameter integer EXT_PADDING_SUPPORTED = 1, // 是否支持外填充
 	parameter integer INNER_PADDING_SUPPORTED = 0, // 是否支持内填充
 	parameter integer KERNAL_DILATION_SUPPORTED = 0, // 是否支持卷积核膨胀
+	parameter integer FUSED_MAX_POOL_SUPPORTED = 0, // 是否支持融合2x2最大池化(须在外部实现池化单元)
+	parameter integer FUSED_MAX_POOL_BUF_DEPTH = 1024, // 融合2x2最大池化行缓存深度(16~65536)
+	parameter integer RESIDUAL_ADD_SUPPORTED = 0, // 是否支持残差相加(须在外部实现残差相加单元)
 	parameter integer EN_PERF_MON = 1, // 是否支持性能监测
 	parameter integer ACCELERATOR_ID = 0, // 加速器ID(0~3)
 	parameter integer FP32_KEEP = 0, // 是否保持FP32输出
@@ -96,6 +100,9 @@ module axi_generic_conv_core #(
 	// 使能信号
 	output wire en_accelerator, // 使能卷积加速器
 	
+	// 事件(指示)
+	output wire on_kernal_set_start, // 卷积核组开始
+	
 	// 寄存器配置接口(AXI-Lite从机)
     // 读地址通道
     input wire[31:0] s_axi_lite_araddr,
@@ -184,6 +191,9 @@ module axi_generic_conv_core #(
 	output wire[2:0] data_hub_sfc_n_each_wgtblk, // 每个权重块的表面个数的类型
 	output wire[7:0] data_hub_kbufgrpn, // 可缓存的通道组数 - 1
 	output wire[7:0] data_hub_fmbufbankn, // 分配给特征图缓存的Bank数
+	// [性能监测]
+	input wire data_hub_on_fm_sfc_row_rplc, // 置换1个特征图表面行(指示)
+	input wire data_hub_on_kbuf_sw_rgn_rplc, // 置换1个交换区通道组(指示)
 	// [特征图表面行读请求(AXIS主机)]
 	output wire[103:0] m_fm_rd_req_axis_data,
 	output wire m_fm_rd_req_axis_valid,
@@ -213,6 +223,9 @@ module axi_generic_conv_core #(
 	output wire[5:0] fnl_res_tr_req_gen_max_wgtblk_w, // 权重块最大宽度
 	output wire fnl_res_tr_req_gen_is_grp_conv_mode, // 是否处于组卷积模式
 	output wire[15:0] fnl_res_tr_req_gen_n_foreach_group, // 每组的通道数/核数 - 1
+	output wire fnl_res_tr_req_gen_en_fused_max_pool, // 使能融合2x2最大池化
+	output wire[23:0] fnl_res_tr_req_gen_ofmap_row_pitch, // 输出特征图表面行跨距(0表示紧密存储)
+	output wire[31:0] fnl_res_tr_req_gen_ofmap_cgrp_pitch, // 输出特征图通道组跨距(0表示紧密存储)
 	// [块级控制]
 	output wire fnl_res_trans_blk_start,
 	input wire fnl_res_trans_blk_idle,
@@ -251,9 +264,15 @@ module axi_generic_conv_core #(
 	output wire[4:0] bn_act_bn_fixed_point_quat_accrc, // (批归一化操作数A)定点数量化精度
 	output wire bn_act_bn_is_a_eq_1, // 批归一化参数A的实际值为1(标志)
 	output wire bn_act_bn_is_b_eq_0, // 批归一化参数B的实际值为0(标志)
+	output wire bn_act_en_int8_requant, // 使能INT8逐通道重量化
+	output wire[3:0] bn_act_out_fixed_point_quat_accrc, // 输出舍入单元的定点数量化精度
 	output wire[4:0] bn_act_leaky_relu_fixed_point_quat_accrc, // (泄露Relu激活参数)定点数量化精度
 	output wire[31:0] bn_act_leaky_relu_param_alpha, // 泄露Relu激活参数
 	output wire[4:0] bn_act_sigmoid_tanh_fixed_point_quat_accrc, // (Sigmoid或Tanh输入)定点数量化精度
+	output wire bn_act_en_residual_add, // 使能残差相加
+	output wire bn_act_residual_relu, // 残差相加后做Relu
+	output wire[5:0] bn_act_residual_scale_exp, // 残差缩放系数的指数(有符号数)
+	output wire[31:0] bn_act_residual_baseaddr, // 残差特征图基地址
 	// [卷积最终结果(AXIS主机)]
 	output wire[ATOMIC_K*32-1:0] m_axis_ext_bn_act_i_data, // 对于ATOMIC_K个最终结果 -> {单精度浮点数或定点数(32位)}
 	output wire[ATOMIC_K*4-1:0] m_axis_ext_bn_act_i_keep,
@@ -310,10 +329,28 @@ module axi_generic_conv_core #(
 	output wire m_axis_ext_collector_valid,
 	input wire m_axis_ext_collector_ready,
 	
+	// 层描述符读取
+	output wire desc_dma_sel, // 0号MM2S通道选择(1'b1 -> 层描述符读取与执行单元, 1'b0 -> 数据枢纽)
+	// [DMA命令(AXIS主机)]
+	output wire[55:0] m_desc_dma_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
+	output wire m_desc_dma_cmd_axis_user, // {固定(1'b1)/递增(1'b0)传输(1bit)}
+	output wire m_desc_dma_cmd_axis_last, // 帧尾标志
+	output wire m_desc_dma_cmd_axis_valid,
+	input wire m_desc_dma_cmd_axis_ready,
+	// [DMA数据流(AXIS从机)]
+	input wire[MM2S_STREAM_DATA_WIDTH-1:0] s_desc_dma_strm_axis_data,
+	input wire[MM2S_STREAM_DATA_WIDTH/8-1:0] s_desc_dma_strm_axis_keep,
+	input wire s_desc_dma_strm_axis_last,
+	input wire s_desc_dma_strm_axis_valid,
+	output wire s_desc_dma_strm_axis_ready,
+	
 	// DMA命令完成指示
 	input wire mm2s_0_cmd_done, // 0号MM2S通道命令完成(指示)
 	input wire mm2s_1_cmd_done, // 1号MM2S通道命令完成(指示)
-	input wire s2mm_cmd_done // S2MM通道命令完成(指示)
+	input wire s2mm_cmd_done, // S2MM通道命令完成(指示)
+	
+	// 中断
+	output wire irq // 完成中断
 );
 	
 	// 计算bit_depth的最高有效位编号(即位数-1)
@@ -371,6 +408,11 @@ module axi_generic_conv_core #(
 	wire[15:0] ofmap_w; // 输出特征图宽度 - 1
 	wire[15:0] ofmap_h; // 输出特征图高度 - 1
 	wire[1:0] ofmap_data_type; // 输出特征图数据大小类型
+	wire en_fused_max_pool; // 使能融合2x2最大池化
+	wire[23:0] ofmap_row_pitch; // 输出特征图表面行跨距
+	wire[31:0] ofmap_cgrp_pitch; // 输出特征图通道组跨距
+	wire[23:0] ifmap_row_pitch; // 输入特征图表面行跨距
+	wire[31:0] ifmap_cgrp_pitch; // 输入特征图通道组跨距
 	// [卷积核参数]
 	wire[31:0] kernal_wgt_baseaddr; // 卷积核权重基地址
 	wire[2:0] kernal_shape; // 卷积核形状
@@ -397,9 +439,20 @@ module axi_generic_conv_core #(
 	wire[4:0] bn_fixed_point_quat_accrc; // (批归一化操作数A)定点数量化精度
 	wire bn_is_a_eq_1; // 批归一化参数A的实际值为1(标志)
 	wire bn_is_b_eq_0; // 批归一化参数B的实际值为0(标志)
+	wire en_int8_requant; // 使能INT8逐通道重量化
+	wire[3:0] out_fixed_point_quat_accrc; // 输出舍入单元的定点数量化精度
 	wire[4:0] leaky_relu_fixed_point_quat_accrc; // (泄露Relu激活参数)定点数量化精度
 	wire[31:0] leaky_relu_param_alpha; // 泄露Relu激活参数
 	wire[4:0] sigmoid_tanh_fixed_point_quat_accrc; // Sigmoid或Tanh输入定点数量化精度
+	// [残差相加参数]
+	wire en_residual_add; // 使能残差相加
+	wire residual_relu; // 残差相加后做Relu
+	wire[5:0] residual_scale_exp; // 残差缩放系数的指数(有符号数)
+	wire[31:0] residual_baseaddr; // 残差特征图基地址
+	// [零通道组跳过参数]
+	wire en_zero_cgrp_skip; // 使能零通道组跳过
+	wire[9:0] zero_cgrp_skip_vld_cgrpn; // 非零通道组数 - 1
+	wire[255:0] zero_cgrp_map; // 零通道组位图
 	// 块级控制
 	// [卷积核权重访问请求生成单元]
 	wire kernal_access_blk_start;
@@ -409,8 +462,29 @@ module axi_generic_conv_core #(
 	wire fmap_access_blk_start;
 	wire fmap_access_blk_idle;
 	wire fmap_access_blk_done;
+	// [层描述符读取与执行单元]
+	wire desc_chain_blk_start;
+	wire desc_chain_blk_idle;
+	wire desc_chain_blk_done;
+	// 层描述符链
+	wire[31:0] desc_chain_baseaddr; // 层描述符链首地址
+	wire desc_layer_done; // 由层描述符链完成1层(指示)
+	// [寄存器写端口]
+	wire desc_regs_wen;
+	wire[6:0] desc_regs_addr;
+	wire[31:0] desc_regs_din;
+	wire desc_regs_wready;
+	// [BN参数MEM写端口]
+	wire desc_bn_mem_wen;
+	wire[15:0] desc_bn_mem_addr;
+	wire[63:0] desc_bn_mem_din;
 	// 状态信息
-	wire[31:0] ftm_sfc_cal_n; // 已计算的特征图表面数
+	wire[63:0] ftm_sfc_cal_n; // 已计算的特征图表面数
+	wire pm_mac_stall_cnt_en; // 乘加阵列停顿周期计数使能
+	wire[2:0] pm_mac_stall_cnt_clr; // 清零乘加阵列停顿周期计数器(指示)
+	wire[63:0] pm_mac_wait_ftm_cyc_n; // 乘加阵列等待特征图表面的周期数
+	wire[63:0] pm_mac_wait_kernal_cyc_n; // 乘加阵列等待卷积核权重块的周期数
+	wire[63:0] pm_mac_stall_by_res_cyc_n; // 乘加阵列受中间结果缓存阻塞的周期数
 	
 	assign en_bn_act_proc_dup = en_bn_act_proc;
 	
@@ -429,6 +503,9 @@ module axi_generic_conv_core #(
 		.EXT_PADDING_SUPPORTED(EXT_PADDING_SUPPORTED ? 1'b1:1'b0),
 		.INNER_PADDING_SUPPORTED(INNER_PADDING_SUPPORTED ? 1'b1:1'b0),
 		.KERNAL_DILATION_SUPPORTED(KERNAL_DILATION_SUPPORTED ? 1'b1:1'b0),
+		.FUSED_MAX_POOL_SUPPORTED(FUSED_MAX_POOL_SUPPORTED ? 1'b1:1'b0),
+		.FUSED_MAX_POOL_BUF_DEPTH(FUSED_MAX_POOL_BUF_DEPTH),
+		.RESIDUAL_ADD_SUPPORTED(RESIDUAL_ADD_SUPPORTED ? 1'b1:1'b0),
 		.EN_PERF_MON(EN_PERF_MON ? 1'b1:1'b0),
 		.ACCELERATOR_ID(ACCELERATOR_ID),
 		.ATOMIC_K(ATOMIC_K),
@@ -491,6 +568,11 @@ module axi_generic_conv_core #(
 		.ofmap_w(ofmap_w),
 		.ofmap_h(ofmap_h),
 		.ofmap_data_type(ofmap_data_type),
+		.en_fused_max_pool(en_fused_max_pool),
+		.ofmap_row_pitch(ofmap_row_pitch),
+		.ofmap_cgrp_pitch(ofmap_cgrp_pitch),
+		.ifmap_row_pitch(ifmap_row_pitch),
+		.ifmap_cgrp_pitch(ifmap_cgrp_pitch),
 		.kernal_wgt_baseaddr(kernal_wgt_baseaddr),
 		.kernal_shape(kernal_shape),
 		.kernal_dilation_hzt_n(kernal_dilation_hzt_n),
@@ -514,9 +596,18 @@ module axi_generic_conv_core #(
 		.bn_fixed_point_quat_accrc(bn_fixed_point_quat_accrc),
 		.bn_is_a_eq_1(bn_is_a_eq_1),
 		.bn_is_b_eq_0(bn_is_b_eq_0),
+		.en_int8_requant(en_int8_requant),
+		.out_fixed_point_quat_accrc(out_fixed_point_quat_accrc),
 		.leaky_relu_fixed_point_quat_accrc(leaky_relu_fixed_point_quat_accrc),
 		.leaky_relu_param_alpha(leaky_relu_param_alpha),
 		.sigmoid_tanh_fixed_point_quat_accrc(sigmoid_tanh_fixed_point_quat_accrc),
+		.en_residual_add(en_residual_add),
+		.residual_relu(residual_relu),
+		.residual_scale_exp(residual_scale_exp),
+		.residual_baseaddr(residual_baseaddr),
+		.en_zero_cgrp_skip(en_zero_cgrp_skip),
+		.zero_cgrp_skip_vld_cgrpn(zero_cgrp_skip_vld_cgrpn),
+		.zero_cgrp_map(zero_cgrp_map),
 		
 		.kernal_access_blk_start(kernal_access_blk_start),
 		.kernal_access_blk_idle(kernal_access_blk_idle),
@@ -530,7 +621,25 @@ module axi_generic_conv_core #(
 		.fnl_res_trans_blk_idle(fnl_res_trans_blk_idle),
 		.fnl_res_trans_blk_done(fnl_res_trans_blk_done),
 		
+		.desc_chain_blk_start(desc_chain_blk_start),
+		.desc_chain_blk_idle(desc_chain_blk_idle),
+		.desc_chain_blk_done(desc_chain_blk_done),
+		
+		.desc_chain_baseaddr(desc_chain_baseaddr),
+		.desc_layer_done(desc_layer_done),
+		.desc_regs_wen(desc_regs_wen),
+		.desc_regs_addr(desc_regs_addr),
+		.desc_regs_din(desc_regs_din),
+		.desc_regs_wready(desc_regs_wready),
+		
 		.ftm_sfc_cal_n(ftm_sfc_cal_n),
+		.pm_mac_stall_cnt_en(pm_mac_stall_cnt_en),
+		.pm_mac_stall_cnt_clr(pm_mac_stall_cnt_clr),
+		.mac_wait_ftm_cyc_n(pm_mac_wait_ftm_cyc_n),
+		.mac_wait_kernal_cyc_n(pm_mac_wait_kernal_cyc_n),
+		.mac_stall_by_res_cyc_n(pm_mac_stall_by_res_cyc_n),
+		.on_fm_sfc_row_rplc(data_hub_on_fm_sfc_row_rplc),
+		.on_kbuf_sw_rgn_rplc(data_hub_on_kbuf_sw_rgn_rplc),
 		
 		.s0_mm2s_strm_axis_keep(s0_dma_strm_axis_keep),
 		.s0_mm2s_strm_axis_valid(s0_dma_strm_axis_valid),
@@ -546,7 +655,51 @@ module axi_generic_conv_core #(
 		
 		.mm2s_0_cmd_done(mm2s_0_cmd_done),
 		.mm2s_1_cmd_done(mm2s_1_cmd_done),
-		.s2mm_cmd_done(s2mm_cmd_done)
+		.s2mm_cmd_done(s2mm_cmd_done),
+		
+		.irq(irq)
+	);
+	
+	/** 层描述符读取与执行单元 **/
+	conv_layer_desc_fetcher #(
+		.MM2S_STREAM_DATA_WIDTH(MM2S_STREAM_DATA_WIDTH),
+		.SIM_DELAY(SIM_DELAY)
+	)conv_layer_desc_fetcher_u(
+		.aclk(aclk),
+		.aresetn(aresetn),
+		.aclken(aclken),
+		
+		.desc_chain_baseaddr(desc_chain_baseaddr),
+		
+		.blk_start(desc_chain_blk_start),
+		.blk_idle(desc_chain_blk_idle),
+		.blk_done(desc_chain_blk_done),
+		
+		.s2mm_cmd_done(s2mm_cmd_done),
+		.layer_done(desc_layer_done),
+		
+		.dma_sel(desc_dma_sel),
+		
+		.m_dma_cmd_axis_data(m_desc_dma_cmd_axis_data),
+		.m_dma_cmd_axis_user(m_desc_dma_cmd_axis_user),
+		.m_dma_cmd_axis_last(m_desc_dma_cmd_axis_last),
+		.m_dma_cmd_axis_valid(m_desc_dma_cmd_axis_valid),
+		.m_dma_cmd_axis_ready(m_desc_dma_cmd_axis_ready),
+		
+		.s_dma_strm_axis_data(s_desc_dma_strm_axis_data),
+		.s_dma_strm_axis_keep(s_desc_dma_strm_axis_keep),
+		.s_dma_strm_axis_last(s_desc_dma_strm_axis_last),
+		.s_dma_strm_axis_valid(s_desc_dma_strm_axis_valid),
+		.s_dma_strm_axis_ready(s_desc_dma_strm_axis_ready),
+		
+		.regs_wen(desc_regs_wen),
+		.regs_addr(desc_regs_addr),
+		.regs_din(desc_regs_din),
+		.regs_wready(desc_regs_wready),
+		
+		.bn_mem_wen(desc_bn_mem_wen),
+		.bn_mem_addr(desc_bn_mem_addr),
+		.bn_mem_din(desc_bn_mem_din)
 	);
 	
 	/**
@@ -559,6 +712,8 @@ module axi_generic_conv_core #(
 	-----------------------------------------
 	| 0x8000~0xFFFF| Sigmoid函数值查找表MEM |
 	-----------------------------------------
+	
+	层描述符读取与执行单元加载BN参数时, 优先占用BN参数MEM的端口A
 	**/
 	// AXI-SRAM控制器给出的存储器接口
 	wire axi_sram_ctrler_ram_clk;
@@ -582,17 +737,27 @@ module axi_generic_conv_core #(
 			);
 	
 	assign bn_mem_clk_a = axi_sram_ctrler_ram_clk;
-	assign bn_mem_en_a = BN_SUPPORTED & axi_sram_ctrler_ram_en & (~axi_sram_ctrler_ram_addr[13]);
+	assign bn_mem_en_a = BN_SUPPORTED & ((axi_sram_ctrler_ram_en & (~axi_sram_ctrler_ram_addr[13])) | desc_bn_mem_wen);
 	assign bn_mem_wen_a = 
-		axi_sram_ctrler_ram_addr[0] ? 
-			{axi_sram_ctrler_ram_wen, 4'b0000}:
-			{4'b0000, axi_sram_ctrler_ram_wen};
+		desc_bn_mem_wen ? 
+			8'hff:
+			(
+				axi_sram_ctrler_ram_addr[0] ? 
+					{axi_sram_ctrler_ram_wen, 4'b0000}:
+					{4'b0000, axi_sram_ctrler_ram_wen}
+			);
 	assign bn_mem_addr_a = 
-		axi_sram_ctrler_ram_addr[16:1];
+		desc_bn_mem_wen ? 
+			desc_bn_mem_addr:
+			axi_sram_ctrler_ram_addr[16:1];
 	assign bn_mem_din_a = 
-		axi_sram_ctrler_ram_addr[0] ? 
-			{axi_sram_ctrler_ram_din, 32'dx}:
-			{32'dx, axi_sram_ctrler_ram_din};
+		desc_bn_mem_wen ? 
+			desc_bn_mem_din:
+			(
+				axi_sram_ctrler_ram_addr[0] ? 
+					{axi_sram_ctrler_ram_din, 32'dx}:
+					{32'dx, axi_sram_ctrler_ram_din}
+			);
 	
 	assign sigmoid_lut_mem_clk_b = axi_sram_ctrler_ram_clk;
 	assign sigmoid_lut_mem_en_b = SIGMOID_SUPPORTED & axi_sram_ctrler_ram_en & axi_sram_ctrler_ram_addr[13];
@@ -666,6 +831,7 @@ module axi_generic_conv_core #(
 	wire rst_adapter; // 重置适配器(标志)
 	wire on_incr_phy_row_traffic; // 增加1个物理特征图表面行流量(指示)
 	wire[15:0] cgrp_n_of_fmap_region_that_kernal_set_sel; // 核组所选定特征图域的通道组数 - 1
+	wire[15:0] vld_cgrp_n_of_fmap_region_that_kernal_set_sel; // 核组所选定特征图域的非零通道组数 - 1
 	// 特征图切块信息(AXIS主机)
 	wire[7:0] m_fm_cake_info_axis_data; // {保留(4bit), 每个切片里的有效表面行数(4bit)}
 	wire m_fm_cake_info_axis_valid;
@@ -682,6 +848,12 @@ module axi_generic_conv_core #(
 	wire mul1_ce; // 计算使能
 	wire[39:0] mul1_res; // 计算结果
 	
+	// 说明: 使能零通道组跳过时, 每个特征图切块只计算非零通道组, 中间结果信息打包器应按非零通道组数计数
+	assign vld_cgrp_n_of_fmap_region_that_kernal_set_sel = 
+		(en_zero_cgrp_skip & (~is_grp_conv_mode)) ? 
+			(zero_cgrp_skip_vld_cgrpn | 16'h0000):
+			cgrp_n_of_fmap_region_that_kernal_set_sel;
+	
 	conv_ctrl_sub_system #(
 		.ATOMIC_C(ATOMIC_C),
 		.ATOMIC_K(ATOMIC_K),
@@ -705,6 +877,8 @@ module axi_generic_conv_core #(
 		.fmap_ext_i_bottom(fmap_ext_i_bottom),
 		.external_padding_top(external_padding_top),
 		.inner_padding_top_bottom(inner_padding_top_bottom),
+		.ifmap_row_pitch(ifmap_row_pitch),
+		.ifmap_cgrp_pitch(ifmap_cgrp_pitch),
 		.ofmap_w(ofmap_w),
 		.ofmap_h(ofmap_h),
 		.ofmap_data_type(ofmap_data_type),
@@ -717,6 +891,8 @@ module axi_generic_conv_core #(
 		.kernal_num_n(kernal_num_n),
 		.kernal_set_n(kernal_set_n),
 		.max_wgtblk_w(max_wgtblk_w),
+		.en_zero_cgrp_skip(en_zero_cgrp_skip),
+		.zero_cgrp_map(zero_cgrp_map),
 		
 		.kernal_access_blk_start(kernal_access_blk_start),
 		.kernal_access_blk_idle(kernal_access_blk_idle),
@@ -730,6 +906,8 @@ module axi_generic_conv_core #(
 		.fnl_res_trans_blk_idle(),
 		.fnl_res_trans_blk_done(),
 		
+		.on_kernal_set_start(on_kernal_set_start),
+		
 		.rst_adapter(rst_adapter),
 		.on_incr_phy_row_traffic(on_incr_phy_row_traffic),
 		.cgrp_n_of_fmap_region_that_kernal_set_sel(cgrp_n_of_fmap_region_that_kernal_set_sel),
@@ -834,6 +1012,7 @@ module axi_generic_conv_core #(
 		.MAX_CAL_ROUND(MAX_CAL_ROUND),
 		.EN_SMALL_FP16("true"),
 		.EN_SMALL_FP32("true"),
+		.MAC_INT8_SUPPORTED(INT8_SUPPORTED ? 1'b1:1'b0),
 		.BN_ACT_INT16_SUPPORTED(INT8_SUPPORTED ? 1'b1:1'b0),
 		.BN_ACT_INT32_SUPPORTED(INT16_SUPPORTED ? 1'b1:1'b0),
 		.BN_ACT_FP32_SUPPORTED(FP16_SUPPORTED ? 1'b1:1'b0),
@@ -859,6 +1038,11 @@ module axi_generic_conv_core #(
 		.row_n_submitted_to_mac_array(),
 		.en_mac_array(en_mac_array),
 		.ftm_sfc_cal_n(ftm_sfc_cal_n),
+		.pm_mac_stall_cnt_en(pm_mac_stall_cnt_en),
+		.pm_mac_stall_cnt_clr(pm_mac_stall_cnt_clr),
+		.pm_mac_wait_ftm_cyc_n(pm_mac_wait_ftm_cyc_n),
+		.pm_mac_wait_kernal_cyc_n(pm_mac_wait_kernal_cyc_n),
+		.pm_mac_stall_by_res_cyc_n(pm_mac_stall_by_res_cyc_n),
 		.en_packer(en_packer),
 		.en_bn_act_proc(en_bn_act_proc),
 		
@@ -869,7 +1053,7 @@ module axi_generic_conv_core #(
 		.inner_padding_left_right(inner_padding_left_right),
 		.ifmap_w(ifmap_w),
 		.ofmap_w(ofmap_w),
-		.cgrp_n_of_fmap_region_that_kernal_set_sel(cgrp_n_of_fmap_region_that_kernal_set_sel),
+		.cgrp_n_of_fmap_region_that_kernal_set_sel(vld_cgrp_n_of_fmap_region_that_kernal_set_sel),
 		.kernal_shape(kernal_shape),
 		.kernal_dilation_hzt_n(kernal_dilation_hzt_n),
 		.kernal_w_dilated(kernal_w_dilated),
@@ -880,6 +1064,8 @@ module axi_generic_conv_core #(
 		.bn_fixed_point_quat_accrc(bn_fixed_point_quat_accrc),
 		.bn_is_a_eq_1(bn_is_a_eq_1),
 		.bn_is_b_eq_0(bn_is_b_eq_0),
+		.en_int8_requant(en_int8_requant),
+		.out_fixed_point_quat_accrc(out_fixed_point_quat_accrc),
 		.leaky_relu_fixed_point_quat_accrc(leaky_relu_fixed_point_quat_accrc),
 		.leaky_relu_param_alpha(leaky_relu_param_alpha),
 		.sigmoid_tanh_fixed_point_quat_accrc(sigmoid_tanh_fixed_point_quat_accrc),
@@ -1105,6 +1291,9 @@ module axi_generic_conv_core #(
 	assign fnl_res_tr_req_gen_max_wgtblk_w = max_wgtblk_w;
 	assign fnl_res_tr_req_gen_is_grp_conv_mode = is_grp_conv_mode;
 	assign fnl_res_tr_req_gen_n_foreach_group = n_foreach_group;
+	assign fnl_res_tr_req_gen_en_fused_max_pool = en_fused_max_pool;
+	assign fnl_res_tr_req_gen_ofmap_row_pitch = ofmap_row_pitch;
+	assign fnl_res_tr_req_gen_ofmap_cgrp_pitch = ofmap_cgrp_pitch;
 	
 	assign en_mid_res_buf_dup = en_mac_array;
 	assign mid_res_buf_calfmt = calfmt;
@@ -1118,11 +1307,18 @@ module axi_generic_conv_core #(
 	assign bn_act_bn_fixed_point_quat_accrc = bn_fixed_point_quat_accrc;
 	assign bn_act_bn_is_a_eq_1 = bn_is_a_eq_1;
 	assign bn_act_bn_is_b_eq_0 = bn_is_b_eq_0;
+	assign bn_act_en_int8_requant = en_int8_requant;
+	assign bn_act_out_fixed_point_quat_accrc = out_fixed_point_quat_accrc;
 	assign bn_act_leaky_relu_fixed_point_quat_accrc = leaky_relu_fixed_point_quat_accrc;
 	assign bn_act_leaky_relu_param_alpha = leaky_relu_param_alpha;
 	assign bn_act_sigmoid_tanh_fixed_point_quat_accrc = sigmoid_tanh_fixed_point_quat_accrc;
+	assign bn_act_en_residual_add = en_residual_add;
+	assign bn_act_residual_relu = residual_relu;
+	assign bn_act_residual_scale_exp = residual_scale_exp;
+	assign bn_act_residual_baseaddr = residual_baseaddr;
 	
 	assign round_calfmt = calfmt;
-	assign round_fixed_point_quat_accrc = 4'dx; // 警告: 需要给出运行时参数!!!
+	// INT8逐通道重量化时, BN单元已给出s8结果, 舍入单元仅作饱和
+	assign round_fixed_point_quat_accrc = en_int8_requant ? 4'd0:out_fixed_point_quat_accrc;
 	
 endmodule
@@ -66,6 +66,14 @@ SOFTWARE.
 
 当运算数据格式为INT16或INT32时, 操作数A的量化精度为fixed_point_quat_accrc, 操作数B的量化精度 = 操作数X的量化精度
 
+INT8逐通道重量化(仅当支持INT16运算数据格式且运算数据格式为INT16时可用) -> 
+	y = min(max(sat32((A * X) >>> shift) + rnd + zp, out_min), out_max)
+	操作数X为32位定点数(卷积的INT32累加结果), 操作数A为有符号32位定点乘数, 
+	操作数B = {out_max(s8), out_min(s8), zp(s8), 2'b00, shift(0~63)}, 
+	rnd为(A * X)的第shift-1位(shift = 0时为0), 即向正无穷四舍五入, 
+	结果为符号扩展到32位的s8, 使用4个s18乘法器, 时延与INT16/INT32相同
+	此时参数A的实际值为1(标志)和参数B的实际值为0(标志)必须为0
+
 协议:
 无
 
@@ -92,6 +100,7 @@ module batch_nml_mac_cell #(
 	// 运行时参数
 	input wire[1:0] bn_calfmt, // 运算数据格式
 	input wire[4:0] fixed_point_quat_accrc, // 定点数量化精度
+	input wire int8_requant, // INT8逐通道重量化(标志)
 	
 	// 乘加单元计算输入
 	input wire[31:0] mac_cell_i_op_a, // 操作数A
@@ -131,6 +140,13 @@ module batch_nml_mac_cell #(
 		(FP32_SUPPORTED & (bn_calfmt == BN_CAL_FMT_FP32))   ? BN_CAL_FMT_FP32:
 		                                                      BN_CAL_FMT_NONE;
 	
+	/** INT8逐通道重量化 **/
+	wire is_int8_requant; // 处于INT8逐通道重量化模式(标志)
+	wire is_int_s16_mul; // 整型乘法仅计算A[15:0] * X[15:0](标志)
+	
+	assign is_int8_requant = INT16_SUPPORTED & int8_requant & (bn_calfmt_inner == BN_CAL_FMT_INT16);
+	assign is_int_s16_mul = (bn_calfmt_inner == BN_CAL_FMT_INT16) & (~is_int8_requant);
+	
 	/** 共享乘法器 **/
 	// [整型运算给出的乘法器输入]
 	wire[17:0] int_mac_mul_op_a[3:0];
@@ -199,12 +215,14 @@ module batch_nml_mac_cell #(
 	// [整型运算给出的加法器输入]
 	wire signed[31:0] int_mac_add_op_a;
 	wire signed[31:0] int_mac_add_op_b;
+	wire int_mac_add_cin;
 	// [浮点运算给出的加法器输入]
 	wire signed[31:0] fp_mac_add_op_a;
 	wire signed[31:0] fp_mac_add_op_b;
 	// [加法器]
 	wire signed[31:0] shared_adder0_op_a;
 	wire signed[31:0] shared_adder0_op_b;
+	wire shared_adder0_cin;
 	wire signed[32:0] shared_adder0_res;
 	
 	assign shared_adder0_op_a = 
@@ -215,10 +233,13 @@ module batch_nml_mac_cell #(
 		(bn_calfmt_inner == BN_CAL_FMT_FP32) ? 
 			fp_mac_add_op_b:
 			int_mac_add_op_b;
+	assign shared_adder0_cin = 
+		(bn_calfmt_inner != BN_CAL_FMT_FP32) & int_mac_add_cin;
 	
 	assign shared_adder0_res = 
 		{shared_adder0_op_a[31], shared_adder0_op_a} + 
-		{shared_adder0_op_b[31], shared_adder0_op_b};
+		{shared_adder0_op_b[31], shared_adder0_op_b} + 
+		{32'd0, shared_adder0_cin};
 	
 	/** 共享移位器#0 **/
 	wire signed[31:0] shared_sh0_op_a;
@@ -452,8 +473,8 @@ module batch_nml_mac_cell #(
 	assign partial_product_adder_in_vld_d1 = mac_cell_i_vld_delayed[3];
 	assign partial_product_adder_out_vld = mac_cell_i_vld_delayed[4];
 	
-	assign partial_product_adder_in_mask = (bn_calfmt_inner == BN_CAL_FMT_INT16) | mac_cell_i_is_a_eq_1_delayed[2];
-	assign partial_product_adder_in_mask_d1 = (bn_calfmt_inner == BN_CAL_FMT_INT16) | mac_cell_i_is_a_eq_1_delayed[3];
+	assign partial_product_adder_in_mask = is_int_s16_mul | mac_cell_i_is_a_eq_1_delayed[2];
+	assign partial_product_adder_in_mask_d1 = is_int_s16_mul | mac_cell_i_is_a_eq_1_delayed[3];
 	
 	assign partial_product_arr[0] = INT16_SUPPORTED ? mul_res[0*36+31:0*36]:32'dx;
 	assign partial_product_arr[1] = INT16_SUPPORTED ? mul_res[1*36+31:1*36]:32'dx;
@@ -463,7 +484,7 @@ module batch_nml_mac_cell #(
 	assign partial_product_add_res = 
 		INT16_SUPPORTED ? 
 			(
-				(bn_calfmt_inner == BN_CAL_FMT_INT16) ? 
+				is_int_s16_mul ? 
 					{{32{partial_product_d2[0][31]}}, partial_product_d2[0][31:0]}:
 					{partial_product_add_1[47:0], partial_product_d2[0][15:0]}
 			):
@@ -531,11 +552,15 @@ module batch_nml_mac_cell #(
 	-------------------------------------------------| INT16运算数据格式, 则 |
 	|   3~4    | 对部分积作求和                      | 使用外部s32乘法器     |
 	--------------------------------------------------------------------------
-	|    5     | 舍入, 对齐小数点                    |                       |
+	|    5     | 舍入, 对齐小数点                    | INT8逐通道重量化时,   |
+	|          |                                     | 按B给出的shift右移,   |
+	|          |                                     | 并取出舍入位          |
 	--------------------------------------------------------------------------
 	|    6     | 将A * X的结果限制到32位有符号数     |                       |
 	--------------------------------------------------------------------------
-	|    7     | 加上B, 溢出饱和化处理               |                       |
+	|    7     | 加上B, 溢出饱和化处理               | INT8逐通道重量化时,   |
+	|          |                                     | 加上zp与舍入位, 限制  |
+	|          |                                     | 到[out_min, out_max]  |
 	--------------------------------------------------------------------------
 	**/
 	// [A * X的结果]
@@ -544,13 +569,17 @@ module batch_nml_mac_cell #(
 	wire signed[31:0] int_mac_dec_pt_align_in_op_x;
 	wire signed[63:0] int_mac_dec_pt_align_in_mul_res;
 	wire signed[63:0] int_mac_dec_pt_align_in_mul_res_shifted;
+	wire[5:0] int_mac_dec_pt_align_in_requant_shift;
+	wire int_mac_dec_pt_align_in_requant_rnd;
 	reg signed[63:0] int_mac_amx;
+	reg int_mac_amx_requant_rnd; // A * X的舍入位(INT8逐通道重量化)
 	// [将A * X的结果限制到32位有符号数]
 	wire int_mac_amx_lmt_in_vld;
 	wire signed[63:0] int_mac_amx_lmt_in_amx;
 	wire int_mac_amx_lmt_amx_up_ovf;
 	wire int_mac_amx_lmt_amx_down_ovf;
 	reg signed[31:0] int_mac_amx_lmt_res;
+	reg int_mac_amx_lmt_requant_rnd; // 延迟1clk的A * X的舍入位(INT8逐通道重量化)
 	// [加上B的结果, 最终结果]
 	wire int_mac_final_in_vld;
 	wire int_mac_final_in_is_b_eq_0;
@@ -558,11 +587,15 @@ module batch_nml_mac_cell #(
 	wire[INFO_ALONG_WIDTH-1:0] int_mac_final_out_info_along;
 	wire int_mac_final_add_res_up_ovf;
 	wire int_mac_final_add_res_down_ovf;
+	wire[7:0] int_mac_final_requant_out_min; // 重量化输出下限
+	wire[7:0] int_mac_final_requant_out_max; // 重量化输出上限
+	wire int_mac_final_requant_lth_min; // 重量化结果 < 输出下限(标志)
+	wire int_mac_final_requant_gth_max; // 重量化结果 > 输出上限(标志)
 	reg signed[31:0] int_mac_final_res;
 	
 	// 操作数A[15:0] * 操作数X[15:0]
-	assign int_mac_mul_op_a[0] = {{2{(bn_calfmt_inner == BN_CAL_FMT_INT16) & mac_cell_i_op_a[15]}}, mac_cell_i_op_a[15:0]};
-	assign int_mac_mul_op_b[0] = {{2{(bn_calfmt_inner == BN_CAL_FMT_INT16) & mac_cell_i_op_x[15]}}, mac_cell_i_op_x[15:0]};
+	assign int_mac_mul_op_a[0] = {{2{is_int_s16_mul & mac_cell_i_op_a[15]}}, mac_cell_i_op_a[15:0]};
+	assign int_mac_mul_op_b[0] = {{2{is_int_s16_mul & mac_cell_i_op_x[15]}}, mac_cell_i_op_x[15:0]};
 	// 操作数A[15:0] * 操作数X[31:16]
 	assign int_mac_mul_op_a[1] = {2'b00, mac_cell_i_op_a[15:0]};
 	assign int_mac_mul_op_b[1] = {{2{mac_cell_i_op_x[31]}}, mac_cell_i_op_x[31:16]};
@@ -573,7 +606,7 @@ module batch_nml_mac_cell #(
 	assign int_mac_mul_op_a[3] = {{2{mac_cell_i_op_a[31]}}, mac_cell_i_op_a[31:16]};
 	assign int_mac_mul_op_b[3] = {{2{mac_cell_i_op_x[31]}}, mac_cell_i_op_x[31:16]};
 	
-	assign int_mac_mul_ce = {4{mac_cell_i_vld & (~mac_cell_i_is_a_eq_1)}} & {{3{bn_calfmt_inner != BN_CAL_FMT_INT16}}, 1'b1};
+	assign int_mac_mul_ce = {4{mac_cell_i_vld & (~mac_cell_i_is_a_eq_1)}} & {{3{~is_int_s16_mul}}, 1'b1};
 	
 	assign int_mac_add_op_a = 
 		int_mac_final_in_vld ? 
@@ -581,14 +614,25 @@ module batch_nml_mac_cell #(
 			32'h0000_0000;
 	assign int_mac_add_op_b = 
 		(int_mac_final_in_vld & (~int_mac_final_in_is_b_eq_0)) ? 
-			mac_cell_i_op_b_delayed[6]:
+			(
+				is_int8_requant ? 
+					{{24{mac_cell_i_op_b_delayed[6][15]}}, mac_cell_i_op_b_delayed[6][15:8]}:
+					mac_cell_i_op_b_delayed[6]
+			):
 			32'h0000_0000;
+	assign int_mac_add_cin = int_mac_final_in_vld & int_mac_amx_lmt_requant_rnd;
 	
 	assign int_mac_dec_pt_align_in_vld = mac_cell_i_vld_delayed[4];
 	assign int_mac_dec_pt_align_in_is_a_eq_1 = mac_cell_i_is_a_eq_1_delayed[4];
 	assign int_mac_dec_pt_align_in_op_x = mac_cell_i_op_x_delayed[4];
 	assign int_mac_dec_pt_align_in_mul_res = partial_product_add_res;
-	assign int_mac_dec_pt_align_in_mul_res_shifted = $signed(int_mac_dec_pt_align_in_mul_res) >>> fixed_point_quat_accrc;
+	assign int_mac_dec_pt_align_in_mul_res_shifted = 
+		$signed(int_mac_dec_pt_align_in_mul_res) >>> 
+			(is_int8_requant ? int_mac_dec_pt_align_in_requant_shift:{1'b0, fixed_point_quat_accrc});
+	assign int_mac_dec_pt_align_in_requant_shift = mac_cell_i_op_b_delayed[4][5:0];
+	assign int_mac_dec_pt_align_in_requant_rnd = 
+		(int_mac_dec_pt_align_in_requant_shift != 6'd0) & 
+		int_mac_dec_pt_align_in_mul_res[int_mac_dec_pt_align_in_requant_shift - 6'd1];
 	
 	assign int_mac_amx_lmt_in_vld = mac_cell_i_vld_delayed[5];
 	assign int_mac_amx_lmt_in_amx = int_mac_amx;
@@ -607,6 +651,12 @@ module batch_nml_mac_cell #(
 		(bn_calfmt_inner == BN_CAL_FMT_INT16) ? 
 			(shared_adder0_res[32] & (~(&shared_adder0_res[32:15]))):
 			(shared_adder0_res[32] & (~shared_adder0_res[31]));
+	assign int_mac_final_requant_out_min = mac_cell_i_op_b_delayed[6][23:16];
+	assign int_mac_final_requant_out_max = mac_cell_i_op_b_delayed[6][31:24];
+	assign int_mac_final_requant_lth_min = 
+		$signed(shared_adder0_res) < $signed({{25{int_mac_final_requant_out_min[7]}}, int_mac_final_requant_out_min});
+	assign int_mac_final_requant_gth_max = 
+		$signed(shared_adder0_res) > $signed({{25{int_mac_final_requant_out_max[7]}}, int_mac_final_requant_out_max});
 	
 	// A * X的结果
 	always @(posedge aclk)
@@ -618,6 +668,13 @@ module batch_nml_mac_cell #(
 					int_mac_dec_pt_align_in_mul_res_shifted;
 	end
 	
+	// A * X的舍入位(INT8逐通道重量化)
+	always @(posedge aclk)
+	begin
+		if(aclken & int_mac_dec_pt_align_in_vld)
+			int_mac_amx_requant_rnd <= # SIM_DELAY is_int8_requant & int_mac_dec_pt_align_in_requant_rnd;
+	end
+	
 	// (限幅后)A * X的结果
 	always @(posedge aclk)
 	begin
@@ -629,15 +686,30 @@ module batch_nml_mac_cell #(
 				};
 	end
 	
+	// 延迟1clk的A * X的舍入位(INT8逐通道重量化)
+	always @(posedge aclk)
+	begin
+		if(aclken & int_mac_amx_lmt_in_vld)
+			int_mac_amx_lmt_requant_rnd <= # SIM_DELAY int_mac_amx_requant_rnd;
+	end
+	
 	// 最终结果
 	always @(posedge aclk)
 	begin
 		if(aclken & int_mac_final_in_vld)
 			int_mac_final_res <= # SIM_DELAY 
-				{
-					shared_adder0_res[32],
-					{31{~int_mac_final_add_res_down_ovf}} & ({31{int_mac_final_add_res_up_ovf}} | shared_adder0_res[30:0])
-				};
+				is_int8_requant ? 
+					(
+						int_mac_final_requant_lth_min ? 
+							{{24{int_mac_final_requant_out_min[7]}}, int_mac_final_requant_out_min}:
+						int_mac_final_requant_gth_max ? 
+							{{24{int_mac_final_requant_out_max[7]}}, int_mac_final_requant_out_max}:
+							{{24{shared_adder0_res[7]}}, shared_adder0_res[7:0]}
+					):
+					{
+						shared_adder0_res[32],
+						{31{~int_mac_final_add_res_down_ovf}} & ({31{int_mac_final_add_res_up_ovf}} | shared_adder0_res[30:0])
+					};
 	end
 	
 	/**
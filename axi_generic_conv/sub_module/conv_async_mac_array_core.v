@@ -55,6 +55,7 @@ module conv_async_mac_array_core #(
 	parameter integer ATOMIC_C = 4, // 通道并行数(1 | 2 | 4 | 8 | 16 | 32)
 	parameter integer INFO_ALONG_WIDTH = 1, // 随路数据的位宽(必须>=1)
 	parameter EN_SMALL_FP16 = "true", // 是否处理极小FP16
+	parameter INT8_SUPPORTED = 1'b0, // 是否支持INT8运算数据格式
 	parameter real SIM_DELAY = 1 // 仿真延时
 )(
 	// 主时钟和复位
@@ -284,6 +285,7 @@ module conv_async_mac_array_core #(
 				conv_mac_cell #(
 					.ATOMIC_C(ATOMIC_C),
 					.EN_SMALL_FP16(EN_SMALL_FP16),
+					.INT8_SUPPORTED(INT8_SUPPORTED),
 					.INFO_ALONG_WIDTH(INFO_ALONG_WIDTH),
 					.SIM_DELAY(SIM_DELAY)
 				)conv_mac_cell_u(
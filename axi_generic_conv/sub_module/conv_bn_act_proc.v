@@ -44,6 +44,16 @@ SOFTWARE.
 ---------------------------------------
 |       FP32       |       FP16       |
 ---------------------------------------
+定点数舍入时, 待舍入数据的量化精度为2*out_fixed_point_quat_accrc, 舍入后数据的量化精度为out_fixed_point_quat_accrc
+
+INT8逐通道重量化 -> 
+运算数据格式为INT8且使能INT8逐通道重量化(en_int8_requant)时, 
+BN单元直接对32位定点最终结果作逐输出通道的重量化: 
+	y = min(max(sat32((A * X) >>> shift) + rnd + zp, out_min), out_max)
+每个输出通道的BN参数A为有符号32位定点乘数, 
+BN参数B = {out_max(s8), out_min(s8), zp(s8), 2'b00, shift(0~63)}, 
+结果为符号扩展到32位的s8, 舍入到S8时按量化精度0处理
+此时必须启用BN单元, 忽略"参数A的实际值为1"和"参数B的实际值为0"标志, 激活函数类型应为无
 
 批归一化所使用的乘法器 -> 
 ----------------------------------------------------------------------------------------------------------------------
@@ -72,6 +82,7 @@ Leaky Relu所使用的乘法器 ->
 注意：
 BN与激活并行数(BN_ACT_PRL_N)必须<=核并行数(ATOMIC_K)
 BN与激活并行数(BN_ACT_PRL_N)必须能被BN与激活单元的时钟倍率(BN_ACT_CLK_RATE)整除
+运算数据格式为INT16时, 输入的32位定点数先限幅到s16(INT8逐通道重量化时不限幅)
 
 协议:
 AXIS MASTER/SLAVE
@@ -112,6 +123,8 @@ module conv_bn_act_proc #(
 	input wire[4:0] bn_fixed_point_quat_accrc, // (操作数A)定点数量化精度
 	input wire bn_is_a_eq_1, // 参数A的实际值为1(标志)
 	input wire bn_is_b_eq_0, // 参数B的实际值为0(标志)
+	input wire en_int8_requant, // 使能INT8逐通道重量化
+	input wire[3:0] out_fixed_point_quat_accrc, // 输出舍入单元的定点数量化精度
 	input wire is_in_const_mac_mode, // 是否处于常量乘加模式
 	input wire[31:0] param_a_in_const_mac_mode, // 常量乘加模式下的参数A
 	input wire[31:0] param_b_in_const_mac_mode, // 常量乘加模式下的参数B
@@ -228,6 +241,15 @@ module conv_bn_act_proc #(
 	localparam integer MUL1_CE_WIDTH = 2;
 	localparam integer MUL1_RES_WIDTH = INT32_SUPPORTED ? 64:50;
 	
+	/** INT8逐通道重量化 **/
+	wire is_int8_requant; // 处于INT8逐通道重量化模式(标志)
+	wire bn_is_a_eq_1_actual; // 参数A的实际值为1(实际使用的标志)
+	wire bn_is_b_eq_0_actual; // 参数B的实际值为0(实际使用的标志)
+	
+	assign is_int8_requant = INT16_SUPPORTED & en_int8_requant & (calfmt == CAL_FMT_INT8);
+	assign bn_is_a_eq_1_actual = bn_is_a_eq_1 & (~is_int8_requant);
+	assign bn_is_b_eq_0_actual = bn_is_b_eq_0 & (~is_int8_requant);
+	
 	/** 使能信号跨时钟域处理 **/
 	reg en_bn_act_proc_d1;
 	reg en_bn_act_proc_d2;
@@ -576,7 +598,7 @@ module conv_bn_act_proc #(
 					(
 						{3{bn_param_fetch_sts[BN_FTC_STS_READY_ONEHOT]}} & 
 						(
-							(bn_is_a_eq_1 & bn_is_b_eq_0) ? 
+							(bn_is_a_eq_1_actual & bn_is_b_eq_0_actual) ? 
 								(1 << BN_FTC_STS_WAIT_ONEHOT):
 								(1 << BN_FTC_STS_RD_MEM_ONEHOT)
 						)
@@ -604,7 +626,7 @@ module conv_bn_act_proc #(
 					bn_param_fetch_sts[BN_FTC_STS_READY_ONEHOT] & 
 					use_bn_unit & (~is_in_const_mac_mode) & 
 					sub_row_msg_fifo_empty_n & sub_row_msg_fifo_ren & 
-					(~(bn_is_a_eq_1 & bn_is_b_eq_0))
+					(~(bn_is_a_eq_1_actual & bn_is_b_eq_0_actual))
 				) | 
 				bn_param_fetch_sts[BN_FTC_STS_RD_MEM_ONEHOT]
 			)
@@ -671,6 +693,7 @@ module conv_bn_act_proc #(
 	reg[ATOMIC_K-1:0] optional_fnl_data_blk_mask; // 可选的最终结果数据块(掩码)
 	reg[clogb2(MAX_PROC_ROUND_N-1):0] bn_proc_round_id; // BN处理轮次(计数器)
 	wire[BN_ACT_PRL_N/BN_ACT_CLK_RATE*32-1:0] cur_sfc_data; // 当前的最终结果表面数据
+	wire[BN_ACT_PRL_N/BN_ACT_CLK_RATE*32-1:0] cur_sfc_data_amp_lmt; // 限幅后的当前最终结果表面数据
 	wire[BN_ACT_PRL_N-1:0] cur_sfc_mask; // 当前的最终结果表面有效掩码
 	wire[BN_ACT_PRL_N/BN_ACT_CLK_RATE*32-1:0] cur_bn_param_a; // 当前的BN参数A
 	wire[BN_ACT_PRL_N/BN_ACT_CLK_RATE*32-1:0] cur_bn_param_b; // 当前的BN参数B
@@ -756,6 +779,26 @@ module conv_bn_act_proc #(
 		(BN_ACT_CLK_RATE == 1) ? 
 			(s_axis_fnl_res_data >> (BN_ACT_PRL_N*32*bn_proc_round_id)):
 			(bn_act_in_async_fifo_dout_data >> (BN_ACT_PRL_N/BN_ACT_CLK_RATE*32*bn_act_in_round_cnt));
+	
+	// INT8运算数据格式时, 最终结果为32位定点数, 先限幅到s16再作INT16批归一化(INT8逐通道重量化时不限幅)
+	genvar cur_sfc_amp_lmt_i;
+	generate
+		for(cur_sfc_amp_lmt_i = 0;cur_sfc_amp_lmt_i < BN_ACT_PRL_N/BN_ACT_CLK_RATE;cur_sfc_amp_lmt_i = cur_sfc_amp_lmt_i + 1)
+		begin:cur_sfc_amp_lmt_blk
+			assign cur_sfc_data_amp_lmt[cur_sfc_amp_lmt_i*32+31:cur_sfc_amp_lmt_i*32] = 
+				(INT16_SUPPORTED & (calfmt == CAL_FMT_INT8) & (~is_int8_requant)) ? 
+					(
+						// 上溢
+						((~cur_sfc_data[cur_sfc_amp_lmt_i*32+31]) & (cur_sfc_data[cur_sfc_amp_lmt_i*32+30:cur_sfc_amp_lmt_i*32+15] != 16'h0000)) ? 
+							32'h0000_7FFF:
+						// 下溢
+						(cur_sfc_data[cur_sfc_amp_lmt_i*32+31] & (cur_sfc_data[cur_sfc_amp_lmt_i*32+30:cur_sfc_amp_lmt_i*32+15] != 16'hFFFF)) ? 
+							32'hFFFF_8000:
+							cur_sfc_data[cur_sfc_amp_lmt_i*32+31:cur_sfc_amp_lmt_i*32]
+					):
+					cur_sfc_data[cur_sfc_amp_lmt_i*32+31:cur_sfc_amp_lmt_i*32];
+		end
+	endgenerate
 	assign cur_sfc_mask = 
 		(BN_ACT_CLK_RATE == 1) ? 
 			(fnl_sfc_mask >> (BN_ACT_PRL_N*bn_proc_round_id)):
@@ -827,7 +870,7 @@ module conv_bn_act_proc #(
 		begin
 			cur_bn_param_a_d1 <= # SIM_DELAY cur_bn_param_a;
 			cur_bn_param_b_d1 <= # SIM_DELAY cur_bn_param_b;
-			cur_sfc_data_d1 <= # SIM_DELAY cur_sfc_data;
+			cur_sfc_data_d1 <= # SIM_DELAY cur_sfc_data_amp_lmt;
 			cur_info_along_d1 <= # SIM_DELAY 
 				{
 					// 是否最后1个子行(1bit)
@@ -888,12 +931,13 @@ module conv_bn_act_proc #(
 					
 					.bn_calfmt(calfmt),
 					.fixed_point_quat_accrc(bn_fixed_point_quat_accrc),
+					.int8_requant(is_int8_requant),
 					
 					.mac_cell_i_op_a(cur_bn_param_a_d1[bn_cell_i*32+31:bn_cell_i*32]),
 					.mac_cell_i_op_x(cur_sfc_data_d1[bn_cell_i*32+31:bn_cell_i*32]),
 					.mac_cell_i_op_b(cur_bn_param_b_d1[bn_cell_i*32+31:bn_cell_i*32]),
-					.mac_cell_i_is_a_eq_1(bn_is_a_eq_1),
-					.mac_cell_i_is_b_eq_0(bn_is_b_eq_0),
+					.mac_cell_i_is_a_eq_1(bn_is_a_eq_1_actual),
+					.mac_cell_i_is_b_eq_0(bn_is_b_eq_0_actual),
 					.mac_cell_i_info_along(bn_mac_i_info_along[bn_cell_i]),
 					.mac_cell_i_vld(bn_mac_i_vld[bn_cell_i]),
 					
@@ -1086,9 +1130,9 @@ module conv_bn_act_proc #(
 				.aclken((BN_ACT_CLK_RATE == 1) ? aclken:bn_act_aclken),
 				
 				.target_data_fmt(target_data_fmt),
-				.in_fixed_point_quat_accrc(5'dx), // 需要给出运行时参数!!!
-				.out_fixed_point_quat_accrc(5'dx), // 需要给出运行时参数!!!
-				.fixed_point_rounding_digits(5'dx), // 需要给出运行时参数!!!
+				.in_fixed_point_quat_accrc(is_int8_requant ? 5'd0:{out_fixed_point_quat_accrc, 1'b0}),
+				.out_fixed_point_quat_accrc(is_int8_requant ? 5'd0:{1'b0, out_fixed_point_quat_accrc}),
+				.fixed_point_rounding_digits(is_int8_requant ? 5'd0:{1'b0, out_fixed_point_quat_accrc}),
 				
 				.bypass(1'b0),
 				.s0_ce(1'b0),
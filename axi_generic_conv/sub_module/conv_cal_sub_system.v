@@ -29,6 +29,7 @@ SOFTWARE.
 描述:
 包括物理特征图表面行适配器、卷积乘加阵列、卷积中间结果表面行信息打包单元、卷积中间结果累加与缓存、
 	批归一化与激活处理单元、最终结果数据收集器
+INT8逐通道重量化时, 在最终结果数据收集器前把每对输出通道合并为1个16位数据
 
 乘加阵列使用ATOMIC_K*ATOMIC_C个s16*s16乘法器, 时延 = 1clk
 批归一化单元组使用BN_ACT_PRL_N*4个s18*s18乘法器或BN_ACT_PRL_N个s32*s32乘法器或BN_ACT_PRL_N个s25*s25乘法器, 时延 = 1或3clk
@@ -76,6 +77,7 @@ module conv_cal_sub_system #(
 	// [计算配置参数]
 	parameter integer MAX_CAL_ROUND = 1, // 最大的计算轮次(1~16)
 	parameter EN_SMALL_FP16 = "true", // 乘加阵列是否处理极小FP16
+	parameter MAC_INT8_SUPPORTED = 1'b0, // 乘加阵列是否支持INT8运算数据格式
 	parameter EN_SMALL_FP32 = "true", // 中间结果累加是否处理极小FP32
 	parameter BN_ACT_INT16_SUPPORTED = 1'b0, // BN与激活是否支持INT16运算数据格式
 	parameter BN_ACT_INT32_SUPPORTED = 1'b1, // BN与激活是否支持INT32运算数据格式
@@ -110,7 +112,12 @@ module conv_cal_sub_system #(
 	output wire[27:0] row_n_submitted_to_mac_array, // 已向乘加阵列提交的行数
 	// [卷积乘加阵列]
 	input wire en_mac_array, // 使能乘加阵列
-	output wire[31:0] ftm_sfc_cal_n, // 已计算的特征图表面数
+	output wire[63:0] ftm_sfc_cal_n, // 已计算的特征图表面数
+	input wire pm_mac_stall_cnt_en, // 乘加阵列停顿周期计数使能(主时钟域)
+	input wire[2:0] pm_mac_stall_cnt_clr, // 清零乘加阵列停顿周期计数器(指示, 主时钟域, {受中间结果缓存阻塞, 等待卷积核权重块, 等待特征图表面})
+	output wire[63:0] pm_mac_wait_ftm_cyc_n, // 乘加阵列等待特征图表面的周期数(计算核心时钟周期)
+	output wire[63:0] pm_mac_wait_kernal_cyc_n, // 乘加阵列等待卷积核权重块的周期数(计算核心时钟周期)
+	output wire[63:0] pm_mac_stall_by_res_cyc_n, // 乘加阵列受中间结果缓存阻塞的周期数(计算核心时钟周期)
 	// [卷积中间结果表面行信息打包单元]
 	input wire en_packer, // 使能打包器
 	// [批归一化与激活处理单元]
@@ -140,6 +147,8 @@ module conv_cal_sub_system #(
 	input wire[4:0] bn_fixed_point_quat_accrc, // (批归一化操作数A)定点数量化精度
 	input wire bn_is_a_eq_1, // 批归一化参数A的实际值为1(标志)
 	input wire bn_is_b_eq_0, // 批归一化参数B的实际值为0(标志)
+	input wire en_int8_requant, // 使能INT8逐通道重量化
+	input wire[3:0] out_fixed_point_quat_accrc, // 输出舍入单元的定点数量化精度
 	input wire[4:0] leaky_relu_fixed_point_quat_accrc, // (泄露Relu激活参数)定点数量化精度
 	input wire[31:0] leaky_relu_param_alpha, // 泄露Relu激活参数
 	input wire[4:0] sigmoid_tanh_fixed_point_quat_accrc, // Sigmoid或Tanh输入定点数量化精度
@@ -291,6 +300,17 @@ module conv_cal_sub_system #(
 				bit_depth = bit_depth >> 1;
 		end
     end
+    endfunction
+	
+	// 64位格雷码转二进制码
+    function [63:0] gray_to_bin_u64(input[63:0] gray);
+        integer i;
+    begin
+        gray_to_bin_u64[63] = gray[63];
+        
+        for(i = 62;i >= 0;i = i - 1)
+            gray_to_bin_u64[i] = gray_to_bin_u64[i + 1] ^ gray[i];
+    end
     endfunction
 	
 	/** 常量 **/
@@ -413,7 +433,9 @@ module conv_cal_sub_system #(
 	wire array_i_kernal_sfc_vld; // 有效指示
 	wire array_i_kernal_buf_full_n; // 卷积核权重缓存满(标志)
 	// [性能监测]
-	reg[31:0] ftm_sfc_cal_n_cnt; // 已计算的特征图表面数(计数器)
+	reg[63:0] ftm_sfc_cal_n_cnt; // 已计算的特征图表面数(计数器)
+	wire[2:0] mac_array_pm_flag; // 乘加阵列性能监测指示({受计算结果输出阻塞, 等待卷积核权重块, 等待特征图表面})
+	wire[3*64-1:0] mac_array_pm_cyc_n; // 乘加阵列停顿周期数({受计算结果输出阻塞, 等待卷积核权重块, 等待特征图表面})
 	// 乘加阵列输出
 	wire[ATOMIC_K*48-1:0] array_o_res; // 计算结果(数据, {指数部分(8位, 仅当运算数据格式为FP16时有效), 尾数部分或定点数(40位)})
 	wire[3:0] array_o_cal_round_id; // 计算轮次编号
@@ -424,6 +446,139 @@ module conv_cal_sub_system #(
 	
 	assign ftm_sfc_cal_n = ftm_sfc_cal_n_cnt;
 	
+	/*
+	乘加阵列停顿周期计数器
+	
+	停顿指示是计算核心时钟域的电平, 在计算核心时钟域按每个周期计数, 计算核心时钟倍率>1时不会因在主时钟域采样而丢失周期
+	计数使能和清零指示来自主时钟域: 计数使能经2级同步, 清零指示先转换为翻转信号再经2级同步后检测边沿
+	计数器以格雷码同步回主时钟域(每次加1只有1位变化), 再转换为二进制码
+	*/
+	assign {pm_mac_stall_by_res_cyc_n, pm_mac_wait_kernal_cyc_n, pm_mac_wait_ftm_cyc_n} = mac_array_pm_cyc_n;
+	
+	genvar pm_i;
+	generate
+		if(MAC_ARRAY_CLK_RATE == 1)
+		begin
+			for(pm_i = 0;pm_i < 3;pm_i = pm_i + 1)
+			begin:pm_cnt_blk
+				reg[63:0] pm_cyc_n_cnt; // 停顿周期数(计数器)
+				
+				assign mac_array_pm_cyc_n[pm_i*64+63:pm_i*64] = pm_cyc_n_cnt;
+				
+				// 停顿周期数(计数器)
+				always @(posedge aclk or negedge aresetn)
+				begin
+					if(~aresetn)
+						pm_cyc_n_cnt <= 64'd0;
+					else if(pm_mac_stall_cnt_clr[pm_i] | (aclken & pm_mac_stall_cnt_en & mac_array_pm_flag[pm_i]))
+						pm_cyc_n_cnt <= # SIM_DELAY 
+							pm_mac_stall_cnt_clr[pm_i] ? 
+								64'd0:
+								(pm_cyc_n_cnt + 1'b1);
+				end
+			end
+		end
+		else
+		begin
+			reg[2:0] pm_stall_cnt_clr_tgl; // 清零停顿周期计数器(翻转信号)
+			reg pm_stall_cnt_en_d1; // 同步到计算核心时钟域的计数使能(第1级)
+			reg pm_stall_cnt_en_d2; // 同步到计算核心时钟域的计数使能(第2级)
+			reg[2:0] pm_stall_cnt_clr_tgl_d1; // 同步到计算核心时钟域的清零翻转信号(第1级)
+			reg[2:0] pm_stall_cnt_clr_tgl_d2; // 同步到计算核心时钟域的清零翻转信号(第2级)
+			reg[2:0] pm_stall_cnt_clr_tgl_d3; // 同步到计算核心时钟域的清零翻转信号(延迟1clk, 用于检测边沿)
+			wire[2:0] pm_stall_cnt_clr_at_mac; // 位于计算核心时钟域的清零指示
+			
+			assign pm_stall_cnt_clr_at_mac = pm_stall_cnt_clr_tgl_d2 ^ pm_stall_cnt_clr_tgl_d3;
+			
+			// 清零停顿周期计数器(翻转信号)
+			always @(posedge aclk or negedge aresetn)
+			begin
+				if(~aresetn)
+					pm_stall_cnt_clr_tgl <= 3'b000;
+				else
+					pm_stall_cnt_clr_tgl <= # SIM_DELAY pm_stall_cnt_clr_tgl ^ pm_mac_stall_cnt_clr;
+			end
+			
+			// 跨时钟域: ... -> pm_stall_cnt_en_d1, pm_stall_cnt_clr_tgl -> pm_stall_cnt_clr_tgl_d1[*]
+			always @(posedge mac_array_aclk or negedge mac_array_aresetn)
+			begin
+				if(~mac_array_aresetn)
+					{pm_stall_cnt_en_d2, pm_stall_cnt_en_d1} <= 2'b00;
+				else
+					{pm_stall_cnt_en_d2, pm_stall_cnt_en_d1} <= # SIM_DELAY {pm_stall_cnt_en_d1, pm_mac_stall_cnt_en};
+			end
+			
+			// 同步到计算核心时钟域的清零翻转信号
+			always @(posedge mac_array_aclk or negedge mac_array_aresetn)
+			begin
+				if(~mac_array_aresetn)
+					{pm_stall_cnt_clr_tgl_d3, pm_stall_cnt_clr_tgl_d2, pm_stall_cnt_clr_tgl_d1} <= 9'd0;
+				else
+					{pm_stall_cnt_clr_tgl_d3, pm_stall_cnt_clr_tgl_d2, pm_stall_cnt_clr_tgl_d1} <= # SIM_DELAY 
+						{pm_stall_cnt_clr_tgl_d2, pm_stall_cnt_clr_tgl_d1, pm_stall_cnt_clr_tgl};
+			end
+			
+			for(pm_i = 0;pm_i < 3;pm_i = pm_i + 1)
+			begin:pm_cnt_blk
+				reg[63:0] pm_cyc_n_cnt; // 停顿周期数(计数器)
+				wire[63:0] pm_cyc_n_cnt_nxt; // 新的停顿周期数
+				reg[63:0] pm_cyc_n_gray; // 停顿周期数(格雷码)
+				reg[63:0] pm_cyc_n_gray_d1; // 同步到主时钟域的停顿周期数(格雷码, 第1级)
+				reg[63:0] pm_cyc_n_gray_d2; // 同步到主时钟域的停顿周期数(格雷码, 第2级)
+				reg[63:0] pm_cyc_n_bin; // 同步到主时钟域的停顿周期数
+				
+				assign mac_array_pm_cyc_n[pm_i*64+63:pm_i*64] = pm_cyc_n_bin;
+				
+				assign pm_cyc_n_cnt_nxt = 
+					pm_stall_cnt_clr_at_mac[pm_i] ? 
+						64'd0:
+						(pm_cyc_n_cnt + 1'b1);
+				
+				// 停顿周期数(计数器)
+				always @(posedge mac_array_aclk or negedge mac_array_aresetn)
+				begin
+					if(~mac_array_aresetn)
+						pm_cyc_n_cnt <= 64'd0;
+					else if(
+						mac_array_aclken & 
+						(pm_stall_cnt_clr_at_mac[pm_i] | (pm_stall_cnt_en_d2 & mac_array_pm_flag[pm_i]))
+					)
+						pm_cyc_n_cnt <= # SIM_DELAY pm_cyc_n_cnt_nxt;
+				end
+				
+				// 停顿周期数(格雷码)
+				always @(posedge mac_array_aclk or negedge mac_array_aresetn)
+				begin
+					if(~mac_array_aresetn)
+						pm_cyc_n_gray <= 64'd0;
+					else if(
+						mac_array_aclken & 
+						(pm_stall_cnt_clr_at_mac[pm_i] | (pm_stall_cnt_en_d2 & mac_array_pm_flag[pm_i]))
+					)
+						pm_cyc_n_gray <= # SIM_DELAY pm_cyc_n_cnt_nxt ^ (pm_cyc_n_cnt_nxt >> 1);
+				end
+				
+				// 跨时钟域: pm_cnt_blk[*].pm_cyc_n_gray[*] -> pm_cnt_blk[*].pm_cyc_n_gray_d1[*]
+				always @(posedge aclk or negedge aresetn)
+				begin
+					if(~aresetn)
+						{pm_cyc_n_gray_d2, pm_cyc_n_gray_d1} <= 128'd0;
+					else
+						{pm_cyc_n_gray_d2, pm_cyc_n_gray_d1} <= # SIM_DELAY {pm_cyc_n_gray_d1, pm_cyc_n_gray};
+				end
+				
+				// 同步到主时钟域的停顿周期数(格雷码转二进制码)
+				always @(posedge aclk or negedge aresetn)
+				begin
+					if(~aresetn)
+						pm_cyc_n_bin <= 64'd0;
+					else
+						pm_cyc_n_bin <= # SIM_DELAY gray_to_bin_u64(pm_cyc_n_gray_d2);
+				end
+			end
+		end
+	endgenerate
+	
 	// 已计算的特征图表面数(计数器)
 	generate
 		if((MAC_ARRAY_CLK_RATE > 1) & (ASYNC_MAC_ARRAY_OPT_MODE == "performance"))
@@ -438,7 +593,7 @@ module conv_cal_sub_system #(
 					ftm_sfc_cal_n_cnt <= # SIM_DELAY 
 						en_mac_array_d4 ? 
 							(ftm_sfc_cal_n_cnt + 1'b1):
-							32'd0;
+							64'd0;
 			end
 		end
 		else
@@ -452,7 +607,7 @@ module conv_cal_sub_system #(
 					ftm_sfc_cal_n_cnt <= # SIM_DELAY 
 						en_mac_array ? 
 							(ftm_sfc_cal_n_cnt + 1'b1):
-							32'd0;
+							64'd0;
 			end
 		end
 	endgenerate
@@ -576,6 +731,7 @@ module conv_cal_sub_system #(
 		.ATOMIC_K(ATOMIC_K),
 		.ATOMIC_C(ATOMIC_C),
 		.EN_SMALL_FP16(EN_SMALL_FP16),
+		.INT8_SUPPORTED(MAC_INT8_SUPPORTED),
 		.INFO_ALONG_WIDTH(1),
 		.USE_INNER_SFC_CNT("true"),
 		.TO_SKIP_EMPTY_CAL_ROUND("true"),
@@ -617,6 +773,10 @@ module conv_cal_sub_system #(
 		.array_o_res_vld(array_o_res_vld),
 		.array_o_res_rdy(array_o_res_rdy),
 		
+		.pm_wait_ftm(mac_array_pm_flag[0]),
+		.pm_wait_kernal(mac_array_pm_flag[1]),
+		.pm_stall_by_res(mac_array_pm_flag[2]),
+		
 		.mul_clk(mul0_clk),
 		.mul_op_a(mul0_op_a),
 		.mul_op_b(mul0_op_b),
@@ -1099,6 +1259,8 @@ module conv_cal_sub_system #(
 				.bn_fixed_point_quat_accrc(bn_fixed_point_quat_accrc),
 				.bn_is_a_eq_1(bn_is_a_eq_1),
 				.bn_is_b_eq_0(bn_is_b_eq_0),
+				.en_int8_requant(en_int8_requant),
+				.out_fixed_point_quat_accrc(out_fixed_point_quat_accrc),
 				.is_in_const_mac_mode(1'b0),
 				.param_a_in_const_mac_mode(32'hxxxxxxxx),
 				.param_b_in_const_mac_mode(32'hxxxxxxxx),
@@ -1265,7 +1427,7 @@ module conv_cal_sub_system #(
 					.aclken(aclken),
 					
 					.calfmt(calfmt),
-					.fixed_point_quat_accrc(4'dx), // 警告: 需要给出运行时参数!!!
+					.fixed_point_quat_accrc(en_int8_requant ? 4'd0:out_fixed_point_quat_accrc), // INT8逐通道重量化时仅作饱和
 					
 					.s_axis_round_data(s_axis_round_data),
 					.s_axis_round_keep(s_axis_round_keep),
@@ -1338,8 +1500,48 @@ module conv_cal_sub_system #(
 	wire m_axis_collector_valid;
 	wire m_axis_collector_ready;
 	
-	assign s_axis_collector_data = m_axis_round_data;
-	assign s_axis_collector_keep = m_axis_round_keep;
+	/*
+	INT8逐通道重量化时, 把每对输出通道(s8)合并为1个16位数据({通道2i+1, 通道2i}), 与INT8输入特征图的存储格式相同
+	
+	合并后的数据从低位开始放置, 有效的数据个数 = ceil(表面深度 / 2), 表面深度为奇数时高字节补0
+	*/
+	genvar int8_pair_i;
+	generate
+		if((FP32_KEEP == 1'b0) && (ATOMIC_K >= 2))
+		begin
+			wire[ATOMIC_K*16-1:0] int8_pair_data; // 合并通道对后的数据
+			wire[ATOMIC_K*2-1:0] int8_pair_keep; // 合并通道对后的字节使能
+			
+			for(int8_pair_i = 0;int8_pair_i < ATOMIC_K/2;int8_pair_i = int8_pair_i + 1)
+			begin:int8_pair_blk
+				assign int8_pair_data[int8_pair_i*16+15:int8_pair_i*16] = {
+					m_axis_round_data[(int8_pair_i*2+1)*16+7:(int8_pair_i*2+1)*16] & 
+						{8{m_axis_round_keep[(int8_pair_i*2+1)*2]}},
+					m_axis_round_data[(int8_pair_i*2)*16+7:(int8_pair_i*2)*16]
+				};
+				assign int8_pair_keep[int8_pair_i*2+1:int8_pair_i*2] = 
+					{2{m_axis_round_keep[(int8_pair_i*2)*2]}};
+			end
+			
+			assign int8_pair_data[ATOMIC_K*16-1:ATOMIC_K*8] = {(ATOMIC_K*8){1'b0}};
+			assign int8_pair_keep[ATOMIC_K*2-1:ATOMIC_K] = {ATOMIC_K{1'b0}};
+			
+			assign s_axis_collector_data = 
+				en_int8_requant ? 
+					int8_pair_data:
+					m_axis_round_data;
+			assign s_axis_collector_keep = 
+				en_int8_requant ? 
+					int8_pair_keep:
+					m_axis_round_keep;
+		end
+		else
+		begin
+			assign s_axis_collector_data = m_axis_round_data;
+			assign s_axis_collector_keep = m_axis_round_keep;
+		end
+	endgenerate
+	
 	assign s_axis_collector_last = m_axis_round_last;
 	assign s_axis_collector_valid = m_axis_round_valid;
 	assign m_axis_round_ready = s_axis_collector_ready;
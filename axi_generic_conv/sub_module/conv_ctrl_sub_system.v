@@ -32,7 +32,7 @@ SOFTWARE.
 使用1个u16*u16乘法器、2个u16*u24乘法器, 时延 = 1clk
 
 注意：
-目前不支持INT8运算数据格式
+INT8运算数据格式时, 每个16位数据为1对INT8通道, 通道数/每组的通道数以通道对为单位给出
 
 输入特征图大小 = 输入特征图宽度 * 输入特征图高度
 扩展后特征图的垂直边界 = 原始特征图高度 + 上部外填充数 + (原始特征图高度 - 1) * 上下内填充数 - 1
@@ -40,7 +40,7 @@ SOFTWARE.
 当处于组卷积模式时, 每组的通道数/核数必须<=权重块最大宽度(max_wgtblk_w)
 权重块最大宽度(max_wgtblk_w)必须<=32
 
-卷积核权重块和特征图数据在内存中必须是连续存储的
+卷积核权重块在内存中必须是连续存储的, 特征图数据在输入特征图跨距为0时必须是连续存储的
 
 协议:
 BLK CTRL
@@ -79,6 +79,8 @@ module conv_ctrl_sub_system #(
 	input wire[15:0] fmap_ext_i_bottom, // 扩展后特征图的垂直边界
 	input wire[2:0] external_padding_top, // 上部外填充数
 	input wire[2:0] inner_padding_top_bottom, // 上下内填充数
+	input wire[23:0] ifmap_row_pitch, // 输入特征图表面行跨距(0表示紧密存储)
+	input wire[31:0] ifmap_cgrp_pitch, // 输入特征图通道组跨距(0表示紧密存储)
 	input wire[15:0] ofmap_w, // 输出特征图宽度 - 1
 	input wire[15:0] ofmap_h, // 输出特征图高度 - 1
 	input wire[1:0] ofmap_data_type, // 输出特征图数据大小类型
@@ -92,6 +94,9 @@ module conv_ctrl_sub_system #(
 	input wire[15:0] kernal_num_n, // 核数 - 1
 	input wire[15:0] kernal_set_n, // 核组个数 - 1
 	input wire[5:0] max_wgtblk_w, // 权重块最大宽度
+	// [零通道组跳过参数]
+	input wire en_zero_cgrp_skip, // 使能零通道组跳过
+	input wire[255:0] zero_cgrp_map, // 零通道组位图
 	
 	// 块级控制
 	// [卷积核权重访问请求生成单元]
@@ -107,6 +112,9 @@ module conv_ctrl_sub_system #(
 	output wire fnl_res_trans_blk_idle,
 	output wire fnl_res_trans_blk_done,
 	
+	// 事件(指示)
+	output wire on_kernal_set_start, // 卷积核组开始
+	
 	// 后级计算单元控制
 	// [物理特征图表面行适配器控制]
 	output wire rst_adapter, // 重置适配器(标志)
@@ -213,12 +221,12 @@ module conv_ctrl_sub_system #(
 	localparam KBUFGRPSZ_4 = 3'b111; // 2x2
 	
 	/** 补充运行时参数 **/
-	wire is_16bit_wgt; // 是否16位权重数据
-	wire is_16bit_fmap_data; // 是否16位特征图数据
+	wire is_16bit_wgt; // 是否16位权重数据(INT8时为1对通道)
+	wire is_16bit_fmap_data; // 是否16位特征图数据(INT8时为1对通道)
 	wire[3:0] kernal_w; // (膨胀前)卷积核宽度 - 1
 	
-	assign is_16bit_wgt = calfmt != CAL_FMT_INT8;
-	assign is_16bit_fmap_data = calfmt != CAL_FMT_INT8;
+	assign is_16bit_wgt = 1'b1;
+	assign is_16bit_fmap_data = 1'b1;
 	assign kernal_w = 
 		(
 			(kernal_shape == KBUFGRPSZ_1)   ? 4'd1:
@@ -310,11 +318,15 @@ module conv_ctrl_sub_system #(
 		.external_padding_top(external_padding_top),
 		.inner_padding_top_bottom(inner_padding_top_bottom),
 		.kernal_dilation_vtc_n(kernal_dilation_vtc_n),
+		.en_zero_cgrp_skip(en_zero_cgrp_skip),
+		.zero_cgrp_map(zero_cgrp_map),
 		
 		.blk_start(kernal_access_blk_start),
 		.blk_idle(kernal_access_blk_idle),
 		.blk_done(kernal_access_blk_done),
 		
+		.on_kernal_set_start(on_kernal_set_start),
+		
 		.m_kwgtblk_rd_req_axis_data(m_kwgtblk_rd_req_axis_data),
 		.m_kwgtblk_rd_req_axis_valid(m_kwgtblk_rd_req_axis_valid),
 		.m_kwgtblk_rd_req_axis_ready(m_kwgtblk_rd_req_axis_ready),
@@ -433,10 +445,14 @@ module conv_ctrl_sub_system #(
 		.ext_i_bottom(fmap_ext_i_bottom),
 		.external_padding_top(external_padding_top),
 		.inner_padding_top_bottom(inner_padding_top_bottom),
+		.ifmap_row_pitch(ifmap_row_pitch),
+		.ifmap_cgrp_pitch(ifmap_cgrp_pitch),
 		.kernal_set_n(kernal_set_n),
 		.kernal_dilation_vtc_n(kernal_dilation_vtc_n),
 		.kernal_w(kernal_w),
 		.kernal_h_dilated(kernal_h_dilated),
+		.en_zero_cgrp_skip(en_zero_cgrp_skip),
+		.zero_cgrp_map(zero_cgrp_map),
 		
 		.blk_start(fmap_access_blk_start),
 		.blk_idle(fmap_access_blk_idle),
@@ -582,6 +598,9 @@ module conv_ctrl_sub_system #(
 		.is_grp_conv_mode(is_grp_conv_mode),
 		.n_foreach_group(n_foreach_group),
 		.en_send_sub_row_msg(1'b1),
+		.en_fused_max_pool(1'b0),
+		.ofmap_row_pitch(24'h000000),
+		.ofmap_cgrp_pitch(32'h0000_0000),
 		
 		.blk_start(fnl_res_trans_blk_start),
 		.blk_idle(fnl_res_trans_blk_idle),
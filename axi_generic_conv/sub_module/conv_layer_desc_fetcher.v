@@ -0,0 +1,483 @@
+/*
+MIT License
+
+Copyright (c) 2024 Panda, 2257691535@qq.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+`timescale 1ns / 1ps
+/********************************************************************
+本模块: 卷积层描述符读取与执行单元
+
+描述:
+从描述符链首地址开始, 通过0号MM2S通道逐个读取层描述符(128字节),
+将描述符中的配置参数回放到寄存器配置接口, 按需加载BN参数, 启动本层计算,
+等待S2MM通道完成的命令数达到描述符给出的值后结束本层, 再跟随下一描述符地址执行下一层
+
+层描述符(32个字, 小端格式) ->
+	--------------------------------------------------------------------------------------------
+	|  字号   |                   含义                   |              备注                    |
+	--------------------------------------------------------------------------------------------
+	|   0     | 下一描述符地址                           | 为0表示本描述符是链上最后1个         |
+	--------------------------------------------------------------------------------------------
+	|   1     | 0: 使能批归一化与激活处理单元            |                                      |
+	|         | 1: 使能性能监测计数器                    |                                      |
+	--------------------------------------------------------------------------------------------
+	|   2     | 本层S2MM通道的命令数                     | 即本层输出特征图的子表面行数         |
+	--------------------------------------------------------------------------------------------
+	|   3     | BN参数基地址                             |                                      |
+	--------------------------------------------------------------------------------------------
+	|   4     | BN参数个数                               | 为0表示不加载BN参数                  |
+	--------------------------------------------------------------------------------------------
+	|  5~30   | cal_cfg, grp_conv0~1, fmap_cfg0~5,       | 与同名寄存器的格式一致               |
+	|         | krn_cfg0~3, buf_cfg0~3,                  |                                      |
+	|         | bn_cfg, act_cfg0~1, res_cfg0~1,          |                                      |
+	|         | fmap_cfg6~9                              |                                      |
+	--------------------------------------------------------------------------------------------
+	|   31    | 保留                                     |                                      |
+	--------------------------------------------------------------------------------------------
+
+读取描述符和BN参数期间, 0号MM2S通道由本单元占用(dma_sel = 1'b1)
+
+注意：
+描述符链首地址、每个描述符地址、BN参数基地址均须按MM2S通道数据位宽对齐
+BN参数个数须<=65536
+
+协议:
+BLK CTRL
+AXIS MASTER/SLAVE
+MEM MASTER
+
+作者: 陈家耀
+日期: 2026/10/16
+********************************************************************/
+
+
+module conv_layer_desc_fetcher #(
+	parameter integer MM2S_STREAM_DATA_WIDTH = 64, // MM2S通道DMA数据流的位宽(32 | 64 | 128 | 256)
+	parameter real SIM_DELAY = 1 // 仿真延时
+)(
+	// 时钟和复位
+	input wire aclk,
+	input wire aresetn,
+	input wire aclken,
+	
+	// 运行时参数
+	input wire[31:0] desc_chain_baseaddr, // 描述符链首地址
+	
+	// 块级控制
+	input wire blk_start,
+	output wire blk_idle,
+	output wire blk_done,
+	
+	// 层执行状态
+	input wire s2mm_cmd_done, // S2MM通道命令完成(指示)
+	output wire layer_done, // 完成1层(指示)
+	
+	// 0号MM2S通道选择
+	output wire dma_sel, // 1'b1 -> 本单元, 1'b0 -> 数据枢纽
+	
+	// DMA命令(AXIS主机)
+	output wire[55:0] m_dma_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
+	output wire m_dma_cmd_axis_user, // {固定(1'b1)/递增(1'b0)传输(1bit)}
+	output wire m_dma_cmd_axis_last, // 帧尾标志
+	output wire m_dma_cmd_axis_valid,
+	input wire m_dma_cmd_axis_ready,
+	
+	// DMA数据流(AXIS从机)
+	input wire[MM2S_STREAM_DATA_WIDTH-1:0] s_dma_strm_axis_data,
+	input wire[MM2S_STREAM_DATA_WIDTH/8-1:0] s_dma_strm_axis_keep,
+	input wire s_dma_strm_axis_last,
+	input wire s_dma_strm_axis_valid,
+	output wire s_dma_strm_axis_ready,
+	
+	// 寄存器写端口
+	output wire regs_wen,
+	output wire[6:0] regs_addr,
+	output wire[31:0] regs_din,
+	input wire regs_wready,
+	
+	// BN参数MEM写端口
+	output wire bn_mem_wen,
+	output wire[15:0] bn_mem_addr,
+	output wire[63:0] bn_mem_din // {参数B(32bit), 参数A(32bit)}
+);
+	
+	// 计算bit_depth的最高有效位编号(即位数-1)
+    function integer clogb2(input integer bit_depth);
+    begin
+		if(bit_depth == 0)
+			clogb2 = 0;
+		else
+		begin
+			for(clogb2 = -1;bit_depth > 0;clogb2 = clogb2 + 1)
+				bit_depth = bit_depth >> 1;
+		end
+    end
+    endfunction
+	
+	/** 常量 **/
+	// 描述符字数
+	localparam integer DESC_WORD_N = 32;
+	// 每拍数据的字数
+	localparam integer WORD_N_FOREACH_BEAT = MM2S_STREAM_DATA_WIDTH / 32;
+	// 回放的配置寄存器个数
+	localparam integer CFG_REG_N = 26;
+	// 描述符中第1个配置字的字号
+	localparam integer CFG_WORD_BASE = 5;
+	// 每拍数据的BN参数项数
+	localparam integer BN_ITEM_N_FOREACH_BEAT = (MM2S_STREAM_DATA_WIDTH >= 64) ? (MM2S_STREAM_DATA_WIDTH / 64):1;
+	// 描述符执行状态编码
+	localparam integer DESC_EXEC_STS_ONEHOT_IDLE = 0; // 状态: 空闲
+	localparam integer DESC_EXEC_STS_ONEHOT_FETCH_CMD = 1; // 状态: 发送读描述符的DMA命令
+	localparam integer DESC_EXEC_STS_ONEHOT_FETCH_DATA = 2; // 状态: 接收描述符
+	localparam integer DESC_EXEC_STS_ONEHOT_BN_CMD = 3; // 状态: 发送读BN参数的DMA命令
+	localparam integer DESC_EXEC_STS_ONEHOT_BN_DATA = 4; // 状态: 接收BN参数并写BN参数MEM
+	localparam integer DESC_EXEC_STS_ONEHOT_WR_REGS = 5; // 状态: 回放配置寄存器
+	localparam integer DESC_EXEC_STS_ONEHOT_START = 6; // 状态: 启动本层
+	localparam integer DESC_EXEC_STS_ONEHOT_WAIT = 7; // 状态: 等待本层完成
+	localparam integer DESC_EXEC_STS_ONEHOT_STOP = 8; // 状态: 结束本层
+	localparam integer DESC_EXEC_STS_ONEHOT_DONE = 9; // 状态: 完成
+	
+	// 根据配置寄存器序号得到寄存器地址
+	function [6:0] cfg_reg_addr(input integer id);
+	begin
+		case(id)
+			0: cfg_reg_addr = 7'd36; // cal_cfg
+			1: cfg_reg_addr = 7'd40; // grp_conv0
+			2: cfg_reg_addr = 7'd41; // grp_conv1
+			3: cfg_reg_addr = 7'd48; // fmap_cfg0
+			4: cfg_reg_addr = 7'd49; // fmap_cfg1
+			5: cfg_reg_addr = 7'd50; // fmap_cfg2
+			6: cfg_reg_addr = 7'd51; // fmap_cfg3
+			7: cfg_reg_addr = 7'd52; // fmap_cfg4
+			8: cfg_reg_addr = 7'd53; // fmap_cfg5
+			9: cfg_reg_addr = 7'd64; // krn_cfg0
+			10: cfg_reg_addr = 7'd65; // krn_cfg1
+			11: cfg_reg_addr = 7'd66; // krn_cfg2
+			12: cfg_reg_addr = 7'd67; // krn_cfg3
+			13: cfg_reg_addr = 7'd80; // buf_cfg0
+			14: cfg_reg_addr = 7'd81; // buf_cfg1
+			15: cfg_reg_addr = 7'd82; // buf_cfg2
+			16: cfg_reg_addr = 7'd83; // buf_cfg3
+			17: cfg_reg_addr = 7'd96; // bn_cfg
+			18: cfg_reg_addr = 7'd97; // act_cfg0
+			19: cfg_reg_addr = 7'd98; // act_cfg1
+			20: cfg_reg_addr = 7'd99; // res_cfg0
+			21: cfg_reg_addr = 7'd100; // res_cfg1
+			22: cfg_reg_addr = 7'd54; // fmap_cfg6
+			23: cfg_reg_addr = 7'd55; // fmap_cfg7
+			24: cfg_reg_addr = 7'd56; // fmap_cfg8
+			default: cfg_reg_addr = 7'd57; // fmap_cfg9
+		endcase
+	end
+	endfunction
+	
+	/** 描述符执行状态 **/
+	reg[9:0] desc_exec_sts; // 描述符执行状态
+	reg[31:0] desc_word[0:DESC_WORD_N-1]; // 描述符缓存
+	reg[31:0] cur_desc_addr; // 当前描述符地址
+	reg[4:0] desc_beat_id; // 描述符数据拍编号
+	reg[4:0] cfg_reg_id; // 配置寄存器序号
+	reg[31:0] layer_s2mm_cmd_fns_n; // 本层S2MM通道完成的命令数
+	wire[31:0] nxt_desc_addr; // 下一描述符地址
+	wire desc_en_bn_act_proc; // 使能批归一化与激活处理单元
+	wire desc_en_pm_cnt; // 使能性能监测计数器
+	wire[31:0] desc_s2mm_cmd_n; // 本层S2MM通道的命令数
+	wire[31:0] desc_bn_param_baseaddr; // BN参数基地址
+	wire[31:0] desc_bn_param_n; // BN参数个数
+	
+	assign blk_idle = desc_exec_sts[DESC_EXEC_STS_ONEHOT_IDLE];
+	assign blk_done = desc_exec_sts[DESC_EXEC_STS_ONEHOT_DONE];
+	
+	assign layer_done = aclken & desc_exec_sts[DESC_EXEC_STS_ONEHOT_STOP] & regs_wready;
+	
+	assign dma_sel = 
+		desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_CMD] | desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA] | 
+		desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD] | desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA];
+	
+	assign m_dma_cmd_axis_data = 
+		desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD] ? 
+			{desc_bn_param_n[20:0], 3'b000, desc_bn_param_baseaddr}: // 每个BN参数占8字节
+			{24'd128, cur_desc_addr};
+	assign m_dma_cmd_axis_user = 1'b0;
+	assign m_dma_cmd_axis_last = 1'b1;
+	assign m_dma_cmd_axis_valid = 
+		aclken & (desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_CMD] | desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD]);
+	
+	assign regs_wen = 
+		aclken & 
+		(
+			desc_exec_sts[DESC_EXEC_STS_ONEHOT_WR_REGS] | 
+			desc_exec_sts[DESC_EXEC_STS_ONEHOT_START] | 
+			desc_exec_sts[DESC_EXEC_STS_ONEHOT_STOP]
+		);
+	assign regs_addr = 
+		desc_exec_sts[DESC_EXEC_STS_ONEHOT_WR_REGS] ? 
+			cfg_reg_addr(cfg_reg_id):
+			7'd16; // ctrl0
+	/*
+	启动本层时: 使能加速器、计算子系统, 按描述符使能性能监测计数器、批归一化与激活处理单元,
+		启动卷积核权重访问请求生成单元、特征图表面行访问请求生成单元、最终结果传输请求生成单元
+	结束本层时: 仅保持使能加速器
+	*/
+	assign regs_din = 
+		desc_exec_sts[DESC_EXEC_STS_ONEHOT_WR_REGS] ? 
+			desc_word[CFG_WORD_BASE + cfg_reg_id]:
+			(
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_START] ? 
+					{21'd0, 3'b111, 4'd0, desc_en_bn_act_proc, desc_en_pm_cnt, 2'b11}:
+					32'h0000_0001
+			);
+	
+	assign nxt_desc_addr = desc_word[0];
+	assign desc_en_bn_act_proc = desc_word[1][0];
+	assign desc_en_pm_cnt = desc_word[1][1];
+	assign desc_s2mm_cmd_n = desc_word[2];
+	assign desc_bn_param_baseaddr = desc_word[3];
+	assign desc_bn_param_n = desc_word[4];
+	
+	// 描述符缓存
+	genvar desc_word_i;
+	generate
+		for(desc_word_i = 0;desc_word_i < DESC_WORD_N;desc_word_i = desc_word_i + 1)
+		begin:desc_word_blk
+			always @(posedge aclk)
+			begin
+				if(
+					aclken & 
+					desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA] & s_dma_strm_axis_valid & 
+					(desc_beat_id == (desc_word_i / WORD_N_FOREACH_BEAT))
+				)
+					desc_word[desc_word_i] <= # SIM_DELAY
+						s_dma_strm_axis_data[(desc_word_i % WORD_N_FOREACH_BEAT)*32+31:(desc_word_i % WORD_N_FOREACH_BEAT)*32];
+			end
+		end
+	endgenerate
+	
+	// 当前描述符地址
+	always @(posedge aclk)
+	begin
+		if(
+			aclken & 
+			(
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_IDLE] & blk_start) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_STOP] & regs_wready)
+			)
+		)
+			cur_desc_addr <= # SIM_DELAY
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_IDLE] ? 
+					desc_chain_baseaddr:
+					nxt_desc_addr;
+	end
+	
+	// 描述符数据拍编号
+	always @(posedge aclk)
+	begin
+		if(
+			aclken & 
+			(
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_CMD] | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA] & s_dma_strm_axis_valid)
+			)
+		)
+			desc_beat_id <= # SIM_DELAY
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_CMD] ? 
+					5'd0:
+					(desc_beat_id + 1'b1);
+	end
+	
+	// 配置寄存器序号
+	always @(posedge aclk)
+	begin
+		if(
+			aclken & 
+			(
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA] | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_WR_REGS] & regs_wready)
+			)
+		)
+			cfg_reg_id <= # SIM_DELAY
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA] ? 
+					5'd0:
+					(cfg_reg_id + 1'b1);
+	end
+	
+	// 本层S2MM通道完成的命令数
+	always @(posedge aclk)
+	begin
+		if(aclken & (desc_exec_sts[DESC_EXEC_STS_ONEHOT_START] | (desc_exec_sts[DESC_EXEC_STS_ONEHOT_WAIT] & s2mm_cmd_done)))
+			layer_s2mm_cmd_fns_n <= # SIM_DELAY
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_START] ? 
+					32'd0:
+					(layer_s2mm_cmd_fns_n + 1'b1);
+	end
+	
+	/** BN参数加载 **/
+	reg[16:0] bn_param_wr_n; // 已写入的BN参数个数
+	wire bn_param_wr_fns; // BN参数写完成(标志)
+	
+	assign bn_param_wr_fns = bn_param_wr_n == desc_bn_param_n[16:0];
+	
+	assign bn_mem_addr = bn_param_wr_n[15:0];
+	
+	// 已写入的BN参数个数
+	always @(posedge aclk)
+	begin
+		if(aclken & (desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD] | bn_mem_wen))
+			bn_param_wr_n <= # SIM_DELAY
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD] ? 
+					17'd0:
+					(bn_param_wr_n + 1'b1);
+	end
+	
+	generate
+		if(MM2S_STREAM_DATA_WIDTH == 32)
+		begin:bn_load_32b_blk
+			reg bn_param_word_sel; // BN参数字选择(1'b0 -> 参数A, 1'b1 -> 参数B)
+			reg[31:0] bn_param_a_latched; // 锁存的参数A
+	
+			assign s_dma_strm_axis_ready = 
+				aclken & (desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA] | desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA]);
+	
+			assign bn_mem_wen = 
+				aclken & desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA] & s_dma_strm_axis_valid & 
+				bn_param_word_sel & (~bn_param_wr_fns);
+			assign bn_mem_din = {s_dma_strm_axis_data[31:0], bn_param_a_latched};
+	
+			// BN参数字选择
+			always @(posedge aclk)
+			begin
+				if(aclken & (desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD] | (desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA] & s_dma_strm_axis_valid)))
+					bn_param_word_sel <= # SIM_DELAY
+						(~desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD]) & (~bn_param_word_sel);
+			end
+	
+			// 锁存的参数A
+			always @(posedge aclk)
+			begin
+				if(aclken & desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA] & s_dma_strm_axis_valid & (~bn_param_word_sel))
+					bn_param_a_latched <= # SIM_DELAY s_dma_strm_axis_data[31:0];
+			end
+		end
+		else
+		begin:bn_load_wide_blk
+			reg[clogb2(BN_ITEM_N_FOREACH_BEAT):0] bn_item_sel; // 拍内BN参数项选择
+	
+			// 每拍数据含多个BN参数项时, 逐项写BN参数MEM, 写完最后1项才接收下一拍
+			assign s_dma_strm_axis_ready = 
+				aclken & 
+				(
+					desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA] | 
+					(
+						desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA] & 
+						((bn_item_sel == (BN_ITEM_N_FOREACH_BEAT - 1)) | bn_param_wr_fns)
+					)
+				);
+	
+			assign bn_mem_wen = 
+				aclken & desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA] & s_dma_strm_axis_valid & (~bn_param_wr_fns);
+			assign bn_mem_din = s_dma_strm_axis_data[bn_item_sel*64+:64];
+	
+			// 拍内BN参数项选择
+			always @(posedge aclk)
+			begin
+				if(aclken & (desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD] | bn_mem_wen))
+					bn_item_sel <= # SIM_DELAY
+						(desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD] | (bn_item_sel == (BN_ITEM_N_FOREACH_BEAT - 1))) ? 
+							0:
+							(bn_item_sel + 1'b1);
+			end
+		end
+	endgenerate
+	
+	// 描述符执行状态
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			desc_exec_sts <= 1 << DESC_EXEC_STS_ONEHOT_IDLE;
+		else if(
+			aclken & 
+			(
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_IDLE] & blk_start) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_CMD] & m_dma_cmd_axis_ready) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA] & s_dma_strm_axis_valid & s_dma_strm_axis_last) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD] & m_dma_cmd_axis_ready) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA] & s_dma_strm_axis_valid & s_dma_strm_axis_ready & s_dma_strm_axis_last) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_WR_REGS] & regs_wready & (cfg_reg_id == (CFG_REG_N - 1))) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_START] & regs_wready) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_WAIT] & (layer_s2mm_cmd_fns_n >= desc_s2mm_cmd_n)) | 
+				(desc_exec_sts[DESC_EXEC_STS_ONEHOT_STOP] & regs_wready) | 
+				desc_exec_sts[DESC_EXEC_STS_ONEHOT_DONE]
+			)
+		)
+			desc_exec_sts <= # SIM_DELAY
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_IDLE]}} & 
+					(1 << DESC_EXEC_STS_ONEHOT_FETCH_CMD)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_CMD]}} & 
+					(1 << DESC_EXEC_STS_ONEHOT_FETCH_DATA)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_FETCH_DATA]}} & 
+					(
+						(desc_bn_param_n != 32'd0) ? 
+							(1 << DESC_EXEC_STS_ONEHOT_BN_CMD):
+							(1 << DESC_EXEC_STS_ONEHOT_WR_REGS)
+					)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_CMD]}} & 
+					(1 << DESC_EXEC_STS_ONEHOT_BN_DATA)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_BN_DATA]}} & 
+					(1 << DESC_EXEC_STS_ONEHOT_WR_REGS)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_WR_REGS]}} & 
+					(1 << DESC_EXEC_STS_ONEHOT_START)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_START]}} & 
+					(1 << DESC_EXEC_STS_ONEHOT_WAIT)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_WAIT]}} & 
+					(1 << DESC_EXEC_STS_ONEHOT_STOP)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_STOP]}} & 
+					(
+						(nxt_desc_addr == 32'd0) ? 
+							(1 << DESC_EXEC_STS_ONEHOT_DONE):
+							(1 << DESC_EXEC_STS_ONEHOT_FETCH_CMD)
+					)
+				) | 
+				(
+					{10{desc_exec_sts[DESC_EXEC_STS_ONEHOT_DONE]}} & 
+					(1 << DESC_EXEC_STS_ONEHOT_IDLE)
+				);
+	end
+	
+endmodule
@@ -40,12 +40,16 @@ ATOMIC_K个卷积乘加单元
 
 使用ATOMIC_K*ATOMIC_C个s16*s16乘法器实现特征图数据和卷积核权重相乘
 使用ATOMIC_K个ATOMIC_C输入、32位加法器实现通道累加
+INT8模式时, 每个16位数据为1对INT8通道, 每个乘加单元额外使用ATOMIC_C个s8*s8乘法器计算高通道的乘积,
+	因此每clk处理ATOMIC_C*2个INT8通道
+
+给出性能监测指示(等待特征图表面/等待卷积核权重块/受计算结果输出阻塞), 它们处于主时钟域
 
  运算数据格式  |     计算时延
 --------------------------------
+     INT8      | 2 + log2(ATOMIC_C)
      INT16     | 2 + log2(ATOMIC_C)
      FP16      | 4 + log2(ATOMIC_C)
-     INT8      |      暂不支持
 
 FP16模式时, 尾数偏移为-50
 
@@ -68,6 +72,7 @@ module conv_mac_array #(
 	parameter integer ATOMIC_K = 8, // 核并行数(1 | 2 | 4 | 8 | 16 | 32)
 	parameter integer ATOMIC_C = 4, // 通道并行数(1 | 2 | 4 | 8 | 16 | 32)
 	parameter EN_SMALL_FP16 = "true", // 是否处理极小FP16
+	parameter INT8_SUPPORTED = 1'b0, // 是否支持INT8运算数据格式
 	parameter integer INFO_ALONG_WIDTH = 1, // 随路数据的位宽(必须>=1)
 	parameter USE_INNER_SFC_CNT = "true", // 是否使用内部表面计数器
 	parameter TO_SKIP_EMPTY_CAL_ROUND = "true", // 是否跳过空的计算轮次
@@ -118,6 +123,11 @@ module conv_mac_array #(
 	output wire array_o_res_vld, // 有效标志
 	input wire array_o_res_rdy, // 就绪标志
 	
+	// 性能监测
+	output wire pm_wait_ftm, // 等待特征图表面(指示)
+	output wire pm_wait_kernal, // 等待卷积核权重块(指示)
+	output wire pm_stall_by_res, // 受计算结果输出阻塞(指示)
+	
 	// 外部有符号乘法器
 	output wire mul_clk,
 	output wire[ATOMIC_K*ATOMIC_C*16-1:0] mul_op_a, // 操作数A
@@ -153,6 +163,16 @@ module conv_mac_array #(
 	assign kernal_buf_empty_n = (~rst_mac_array) & (kernal_buf_stored[0] | kernal_buf_stored[1]);
 	assign kernal_buf_full_n = (~rst_mac_array) & (~(kernal_buf_stored[0] & kernal_buf_stored[1]));
 	
+	/*
+	性能监测
+	
+	特征图表面已到达而卷积核权重块未就绪时才算等待卷积核权重块,
+	两者都未到达(层与层之间或层尾排空流水线)的周期视为空闲, 不计入任何停顿
+	*/
+	assign pm_wait_kernal = aclken & (~rst_mac_array) & (~kernal_buf_empty_n) & array_i_ftm_sfc_vld;
+	assign pm_wait_ftm = aclken & kernal_buf_empty_n & (~array_i_ftm_sfc_vld);
+	assign pm_stall_by_res = aclken & kernal_buf_empty_n & array_i_ftm_sfc_vld & (~global_array_i_rdy);
+	
 	assign kernal_buf_loaded_sfc_vec_new = 
 		kernal_buf_loaded_sfc_vec | 
 		(
@@ -453,6 +473,7 @@ module conv_mac_array #(
 				conv_mac_cell #(
 					.ATOMIC_C(ATOMIC_C),
 					.EN_SMALL_FP16(EN_SMALL_FP16),
+					.INT8_SUPPORTED(INT8_SUPPORTED),
 					.INFO_ALONG_WIDTH(ATOMIC_K + INFO_ALONG_WIDTH + 4 + 1),
 					.SIM_DELAY(SIM_DELAY)
 				)mac_cell_u(
@@ -496,6 +517,7 @@ module conv_mac_array #(
 				.ATOMIC_C(ATOMIC_C),
 				.INFO_ALONG_WIDTH(ATOMIC_K + INFO_ALONG_WIDTH + 4 + 1),
 				.EN_SMALL_FP16(EN_SMALL_FP16),
+				.INT8_SUPPORTED(INT8_SUPPORTED),
 				.SIM_DELAY(SIM_DELAY)
 			)async_mac_array_core_u(
 				.aclk(aclk),
@@ -30,19 +30,23 @@ SOFTWARE.
 ATOMIC_C个乘法器实现特征图数据和卷积核权重相乘
 ATOMIC_C输入加法器实现通道累加
 
-支持INT16、FP16两种运算数据格式
+支持INT8、INT16、FP16三种运算数据格式
+
+INT8模式时, 每个16位数据为1对INT8通道({高通道, 低通道}) -> 
+	低通道的乘积由外部乘法器计算(操作数从低8位符号扩展)
+	高通道的乘积由内部s8*s8乘法器计算(仅在支持INT8时生成)
+	两者相加后送入通道累加, 因此每个乘法器每clk完成2个INT8乘法
 
 带有全局时钟使能
 
 时延 = 
-	计算INT16时 -> 2 + log2(ATOMIC_C)
+	计算INT8/INT16时 -> 2 + log2(ATOMIC_C)
 	计算FP16时  -> 4 + log2(ATOMIC_C)
 
 FP16模式时, 尾数偏移为-50
 
 注意：
 外部有符号乘法器的计算时延 = 1clk
-暂不支持INT8运算数据格式
 
 协议:
 无
@@ -55,6 +59,7 @@ FP16模式时, 尾数偏移为-50
 module conv_mac_cell #(
 	parameter integer ATOMIC_C = 4, // 通道并行数(1 | 2 | 4 | 8 | 16 | 32)
 	parameter EN_SMALL_FP16 = "true", // 是否处理极小FP16
+	parameter INT8_SUPPORTED = 1'b0, // 是否支持INT8运算数据格式
 	parameter integer INFO_ALONG_WIDTH = 2, // 随路数据的位宽
 	parameter real SIM_DELAY = 1 // 仿真延时
 )(
@@ -298,6 +303,75 @@ module conv_mac_cell #(
 		end
 	endgenerate
 	
+	/**
+	INT8计算
+	
+	每个16位数据为1对INT8通道({高通道, 低通道})
+	低通道的乘积复用外部乘法器, 高通道的乘积由内部乘法器计算, 二者的时延相同
+	**/
+	// 外部有符号乘法器
+	wire signed[15:0] mul_op_a_int8_arr[0:ATOMIC_C-1]; // 操作数A
+	wire signed[15:0] mul_op_b_int8_arr[0:ATOMIC_C-1]; // 操作数B
+	wire mul_ce_int8; // 计算使能
+	// 内部有符号乘法器(高通道)
+	wire signed[15:0] hi_mul_res_arr[0:ATOMIC_C-1]; // 计算结果
+	// 加法树输入
+	wire signed[31:0] add_tree_in_int8_arr[0:ATOMIC_C-1];
+	wire add_tree_in_int8_mask;
+	wire add_tree_in_int8_valid;
+	// 乘加单元结果输出
+	wire mac_out_int8_valid;
+	
+	assign mul_ce_int8 = mac_in_valid & (~mac_in_ftm_masked);
+	
+	assign add_tree_in_int8_mask = mac_in_ftm_masked_d2;
+	assign add_tree_in_int8_valid = mac_in_valid_d2;
+	
+	assign mac_out_int8_valid = add_tree_out_valid;
+	
+	genvar cal_int8_i;
+	generate
+		for(cal_int8_i = 0;cal_int8_i < ATOMIC_C;cal_int8_i = cal_int8_i + 1)
+		begin:cal_int8_blk
+			assign mul_op_a_int8_arr[cal_int8_i] = 
+				{{8{mac_in_ftm_arr[cal_int8_i][7]}}, mac_in_ftm_arr[cal_int8_i][7:0]};
+			assign mul_op_b_int8_arr[cal_int8_i] = 
+				{{8{mac_in_wgt_arr[cal_int8_i][7]}}, mac_in_wgt_arr[cal_int8_i][7:0]};
+			
+			// 低通道的乘积 + 高通道的乘积
+			assign add_tree_in_int8_arr[cal_int8_i] = 
+				mul_res_arr[cal_int8_i] + {{16{hi_mul_res_arr[cal_int8_i][15]}}, hi_mul_res_arr[cal_int8_i]};
+			
+			if(INT8_SUPPORTED)
+			begin
+				reg signed[7:0] hi_mul_op_a_d1; // 延迟1clk的操作数A
+				reg signed[7:0] hi_mul_op_b_d1; // 延迟1clk的操作数B
+				reg signed[15:0] hi_mul_res_d2; // 计算结果
+				
+				assign hi_mul_res_arr[cal_int8_i] = hi_mul_res_d2;
+				
+				always @(posedge aclk)
+				begin
+					if(aclken & (calfmt == CAL_FMT_INT8) & mul_ce_inner)
+					begin
+						hi_mul_op_a_d1 <= # SIM_DELAY mac_in_ftm_arr[cal_int8_i][15:8];
+						hi_mul_op_b_d1 <= # SIM_DELAY mac_in_wgt_arr[cal_int8_i][15:8];
+					end
+				end
+				
+				always @(posedge aclk)
+				begin
+					if(aclken & (calfmt == CAL_FMT_INT8) & mul_ce_inner_d1)
+						hi_mul_res_d2 <= # SIM_DELAY hi_mul_op_a_d1 * hi_mul_op_b_d1;
+				end
+			end
+			else
+			begin
+				assign hi_mul_res_arr[cal_int8_i] = 16'sd0;
+			end
+		end
+	endgenerate
+	
 	/**
 	FP16计算
 	
@@ -625,7 +699,8 @@ module conv_mac_cell #(
 	/** 乘法器复用 **/
 	assign mul_ce_inner = 
 		((calfmt == CAL_FMT_FP16) & mul_ce_fp16) | 
-		((calfmt == CAL_FMT_INT16) & mul_ce_int16);
+		((calfmt == CAL_FMT_INT16) & mul_ce_int16) | 
+		(INT8_SUPPORTED & (calfmt == CAL_FMT_INT8) & mul_ce_int8);
 	
 	genvar mul_reuse_i;
 	generate
@@ -634,11 +709,19 @@ module conv_mac_cell #(
 			assign mul_op_a_arr[mul_reuse_i] = 
 				(calfmt == CAL_FMT_FP16) ? 
 					mul_op_a_fp16_arr[mul_reuse_i]:
-					mul_op_a_int16_arr[mul_reuse_i];
+					(
+						(INT8_SUPPORTED & (calfmt == CAL_FMT_INT8)) ? 
+							mul_op_a_int8_arr[mul_reuse_i]:
+							mul_op_a_int16_arr[mul_reuse_i]
+					);
 			assign mul_op_b_arr[mul_reuse_i] = 
 				(calfmt == CAL_FMT_FP16) ? 
 					mul_op_b_fp16_arr[mul_reuse_i]:
-					mul_op_b_int16_arr[mul_reuse_i];
+					(
+						(INT8_SUPPORTED & (calfmt == CAL_FMT_INT8)) ? 
+							mul_op_b_int8_arr[mul_reuse_i]:
+							mul_op_b_int16_arr[mul_reuse_i]
+					);
 		end
 	endgenerate
 	
@@ -646,12 +729,14 @@ module conv_mac_cell #(
 	assign add_tree_in_mask = 
 		aclken & (
 			((calfmt == CAL_FMT_FP16) & add_tree_in_fp16_mask) | 
-			((calfmt == CAL_FMT_INT16) & add_tree_in_int16_mask)
+			((calfmt == CAL_FMT_INT16) & add_tree_in_int16_mask) | 
+			(INT8_SUPPORTED & (calfmt == CAL_FMT_INT8) & add_tree_in_int8_mask)
 		);
 	assign add_tree_in_valid = 
 		aclken & (
 			((calfmt == CAL_FMT_FP16) & add_tree_in_fp16_valid) | 
-			((calfmt == CAL_FMT_INT16) & add_tree_in_int16_valid)
+			((calfmt == CAL_FMT_INT16) & add_tree_in_int16_valid) | 
+			(INT8_SUPPORTED & (calfmt == CAL_FMT_INT8) & add_tree_in_int8_valid)
 		);
 	
 	genvar add_tree_reuse_i;
@@ -661,13 +746,17 @@ module conv_mac_cell #(
 			assign add_tree_in_arr[add_tree_reuse_i] = 
 				(calfmt == CAL_FMT_FP16) ? 
 					add_tree_in_fp16_arr[add_tree_reuse_i]:
-					add_tree_in_int16_arr[add_tree_reuse_i];
+					(
+						(INT8_SUPPORTED & (calfmt == CAL_FMT_INT8)) ? 
+							add_tree_in_int8_arr[add_tree_reuse_i]:
+							add_tree_in_int16_arr[add_tree_reuse_i]
+					);
 		end
 	endgenerate
 	
 	/** 结果输出 **/
 	wire[INFO_ALONG_WIDTH-1:0] mac_out_info_along_fp16; // 计算FP16时的随路数据输出
-	wire[INFO_ALONG_WIDTH-1:0] mac_out_info_along_int16; // 计算INT16时的随路数据输出
+	wire[INFO_ALONG_WIDTH-1:0] mac_out_info_along_int16; // 计算INT8/INT16时的随路数据输出
 	
 	assign mac_out_exp = 
 		((calfmt == CAL_FMT_FP16) & (~mac_out_fp16_mask)) ? 
@@ -684,7 +773,8 @@ module conv_mac_cell #(
 	assign mac_out_valid = 
 		aclken & (
 			((calfmt == CAL_FMT_FP16) & mac_out_fp16_valid) | 
-			((calfmt == CAL_FMT_INT16) & mac_out_int16_valid)
+			((calfmt == CAL_FMT_INT16) & mac_out_int16_valid) | 
+			(INT8_SUPPORTED & (calfmt == CAL_FMT_INT8) & mac_out_int8_valid)
 		);
 	
 	ram_based_shift_regs #(
@@ -28,15 +28,16 @@ SOFTWARE.
 
 描述:
 计算FP43(有符号尾数37位, 指数6位)与FP32的和
-支持INT16、FP16两种运算数据格式
+支持INT8、INT16、FP16三种运算数据格式
+INT8与INT16共用定点数累加(32位饱和)
 带有全局时钟使能
 
 时延 = 
-	计算INT16时 -> 2
+	计算INT8/INT16时 -> 2
 	计算FP16时  -> 7
 
 注意：
-暂不支持INT8运算数据格式
+无
 
 协议:
 无
@@ -79,6 +80,11 @@ module conv_middle_res_accumulate #(
 	localparam CAL_FMT_INT16 = 2'b01;
 	localparam CAL_FMT_FP16 = 2'b10;
 	
+	/** 运行时参数 **/
+	wire is_fixed_calfmt; // 是否定点数运算数据格式(INT8或INT16)
+	
+	assign is_fixed_calfmt = (calfmt == CAL_FMT_INT8) | (calfmt == CAL_FMT_INT16);
+	
 	/** 复用的有符号加法器 **/
 	wire signed[36:0] adder_0_op1; // 操作数1
 	wire signed[31:0] adder_0_op2; // 操作数2
@@ -244,7 +250,7 @@ module conv_middle_res_accumulate #(
 	end
 	
 	/**
-	INT16累加
+	INT8/INT16累加
 	
 	第1级流水线: 计算(原中间结果 + 定点数)
 	第2级流水线: 判断新的中间结果是否溢出并对其作限幅
@@ -293,20 +299,20 @@ module conv_middle_res_accumulate #(
 	// 延迟1clk的定点数
 	always @(posedge aclk)
 	begin
-		if(aclken & (calfmt == CAL_FMT_INT16) & acmlt_in_valid)
+		if(aclken & is_fixed_calfmt & acmlt_in_valid)
 			acmlt_in_int16_d1 <= # SIM_DELAY acmlt_in_int16;
 	end
 	// 延迟1clk的是否第1项(标志)
 	always @(posedge aclk)
 	begin
-		if(aclken & (calfmt == CAL_FMT_INT16) & acmlt_in_valid)
+		if(aclken & is_fixed_calfmt & acmlt_in_valid)
 			acmlt_in_first_item_int16_d1 <= # SIM_DELAY acmlt_in_first_item_int16;
 	end
 	
 	// 限幅后的新中间结果
 	always @(posedge aclk)
 	begin
-		if(aclken & (calfmt == CAL_FMT_INT16) & acmlt_in_valid_d1)
+		if(aclken & is_fixed_calfmt & acmlt_in_valid_d1)
 			acmlt_new_mid_res_amp_lmt_int16 <= # SIM_DELAY {
 				acmlt_new_mid_res_int16[37], 
 				{31{~acmlt_is_new_mid_res_down_ovf_int16}} & ({31{acmlt_is_new_mid_res_up_ovf_int16}} | acmlt_new_mid_res_int16[30:0])
@@ -750,7 +756,7 @@ module conv_middle_res_accumulate #(
 			adder_0_op2_int16;
 	assign adder_0_ce = 
 		((calfmt == CAL_FMT_FP16) & adder_0_ce_fp16) | 
-		((calfmt == CAL_FMT_INT16) & adder_0_ce_int16);
+		(is_fixed_calfmt & adder_0_ce_int16);
 	
 	/** 中间结果累加输出 **/
 	assign acmlt_out_data = 
@@ -764,7 +770,7 @@ module conv_middle_res_accumulate #(
 	assign acmlt_out_valid = 
 		aclken & (
 			((calfmt == CAL_FMT_FP16) & acmlt_out_valid_fp16) | 
-			((calfmt == CAL_FMT_INT16) & acmlt_out_valid_int16)
+			(is_fixed_calfmt & acmlt_out_valid_int16)
 		);
 	
 endmodule
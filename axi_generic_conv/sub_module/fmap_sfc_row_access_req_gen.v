@@ -36,12 +36,19 @@ SOFTWARE.
 
 支持扩展特征图(内填充、外填充), 支持扩展卷积核(核膨胀)
 
+支持零通道组跳过: 零通道组位图中置位的通道组(权重全为0)按被掩码的表面行处理, 不产生表面行读请求
+
 注意：
 扩展后特征图的垂直边界 = 原始特征图高度 + 上部外填充数 + (原始特征图高度 - 1) * 上下内填充数 - 1
 输入特征图大小 = 输入特征图宽度 * 输入特征图高度
 
 目前仅支持16位特征图数据
-特征图数据在内存中必须是连续存储的
+
+可使能的输入特征图跨距:
+	输入特征图表面行跨距非0时, 第y个表面行的偏移地址 = y * 表面行跨距, 否则为y * 当前特征图切片的行数据量
+	输入特征图通道组跨距非0时, 相邻通道组的地址间隔 = 通道组跨距, 否则为输入特征图大小 * ATOMIC_C * 每个数据的字节数
+	跨距为0时特征图数据在内存中是连续存储的
+	表面行有效字节数总是当前特征图切片的行数据量, 因此可直接读取更大特征图中的1个区域
 
 协议:
 BLK CTRL
@@ -80,11 +87,16 @@ module fmap_sfc_row_access_req_gen #(
 	input wire[15:0] ext_i_bottom, // 扩展后特征图的垂直边界
 	input wire[2:0] external_padding_top, // 上部外填充数
 	input wire[2:0] inner_padding_top_bottom, // 上下内填充数
+	input wire[23:0] ifmap_row_pitch, // 输入特征图表面行跨距(0表示紧密存储)
+	input wire[31:0] ifmap_cgrp_pitch, // 输入特征图通道组跨距(0表示紧密存储)
 	// [卷积核参数]
 	input wire[15:0] kernal_set_n, // 核组个数 - 1
 	input wire[3:0] kernal_dilation_vtc_n, // 垂直膨胀量
 	input wire[3:0] kernal_w, // (膨胀前)卷积核宽度 - 1
 	input wire[4:0] kernal_h_dilated, // (膨胀后)卷积核高度 - 1
+	// [零通道组跳过参数]
+	input wire en_zero_cgrp_skip, // 使能零通道组跳过
+	input wire[255:0] zero_cgrp_map, // 零通道组位图
 	
 	// 块级控制
 	input wire blk_start,
@@ -381,11 +393,15 @@ module fmap_sfc_row_access_req_gen #(
 	wire last_kernal_set; // 处于最后1个核组(标志)
 	wire on_upd_row_access_cnt; // 更新行访问计数器(指示)
 	wire to_skip_row; // 跳过当前行(标志)
+	wire cur_cgrp_is_zero; // 当前通道组的权重全为0(标志)
 	
 	assign last_row_repeat_flag = (row_repeat_cnt == kernal_w) | to_skip_row;
 	assign last_kernal_row_flag = ext_fmap_kernal_dy == kernal_h_dilated;
 	assign last_fmap_cake_cgrp_flag = cgrpn_cnt == cgrp_n_of_fmap_region_that_kernal_set_sel_r;
 	assign arrive_ext_fmap_bottom_flag = ofmap_y == ofmap_h;
+	assign cur_cgrp_is_zero = 
+		en_zero_cgrp_skip & (~is_grp_conv_mode) & 
+		(cgrpn_cnt[15:8] == 8'd0) & zero_cgrp_map[cgrpn_cnt[7:0]];
 	assign last_kernal_set = kernal_set_cnt == kernal_set_n;
 	
 	// 行重复(计数器)
@@ -732,7 +748,11 @@ module fmap_sfc_row_access_req_gen #(
 					32'h0000_0000:
 					(
 						cgrp_ofs_addr + 
-						(actual_ifmap_size * ATOMIC_C * (is_16bit_data ? 2:1)) // 此时不处于最后1个通道组
+						(
+							(ifmap_cgrp_pitch != 32'h0000_0000) ? 
+								ifmap_cgrp_pitch:
+								(actual_ifmap_size * ATOMIC_C * (is_16bit_data ? 2:1))
+						) // 此时不处于最后1个通道组
 					);
 	end
 	
@@ -796,6 +816,12 @@ module fmap_sfc_row_access_req_gen #(
 	assign s_fm_rd_req_reg_axis_data[60:29] = sfc_row_abs_addr; // 表面行基地址
 	assign s_fm_rd_req_reg_axis_data[72:61] = ifmap_w[11:0]; // 待读取的表面个数 - 1
 	assign s_fm_rd_req_reg_axis_data[84:73] = 12'd0; // 起始表面编号
+	/*
+	说明: 使能零通道组跳过时, 实际表面行号仍使用真实的通道组号, 而不像卷积核侧那样只对非零通道组编号,
+		因为实际表面行号只是特征图缓存中"实际表面行号 -> 缓存行号"映射表的检索键, 不对应连续的缓存位置;
+		零通道组的表面行不产生读请求, 其表面行号只是不被使用,
+		而非零通道组的表面行仍按通道组顺序被请求, 与卷积核侧按紧凑通道组号依次写入的通道组一一对应
+	*/
 	assign s_fm_rd_req_reg_axis_data[96:85] = 
 		phy_y_encoding_at_actual_rid_rvs | cgrpn_cnt[11:0]; // 实际表面行号
 	assign s_fm_rd_req_reg_axis_data[97] = req_gen_sts == REQ_GEN_STS_FMBUF_RST; // 是否重置缓存
@@ -810,9 +836,12 @@ module fmap_sfc_row_access_req_gen #(
 	
 	assign m_fm_cake_info_axis_valid = aclken & to_send_fm_cake_info;
 	
-	// 计算: 表面行偏移地址 = 物理y坐标(u16) * 当前特征图切片的行数据量(u24)
+	// 计算: 表面行偏移地址 = 物理y坐标(u16) * 输入特征图表面行跨距或当前特征图切片的行数据量(u24)
 	assign mul1_op_a = cur_sfc_row_phy_y;
-	assign mul1_op_b = row_data_size_of_cur_fmap_slice;
+	assign mul1_op_b = 
+		(ifmap_row_pitch != 24'h000000) ? 
+			ifmap_row_pitch:
+			row_data_size_of_cur_fmap_slice;
 	assign mul1_tid = MUL1_TID_CONST;
 	assign mul1_req = (aclken & on_start_cal_sfc_row_ofs_addr) | req_for_cal_sfc_row_ofs_addr_pending;
 	
@@ -1015,7 +1044,9 @@ module fmap_sfc_row_access_req_gen #(
 			cal_addr_sub_sts[CAL_ADDR_SUB_STS_ONEHOT_GET_CRDNT]
 		)
 		begin
-			cur_sfc_row_mask <= # SIM_DELAY coordinate_buf_mask[(kernal_mixed_zone_cnt > 4'd10) ? 4'd10:kernal_mixed_zone_cnt];
+			// 说明: 零通道组的表面行也被掩码
+			cur_sfc_row_mask <= # SIM_DELAY 
+				coordinate_buf_mask[(kernal_mixed_zone_cnt > 4'd10) ? 4'd10:kernal_mixed_zone_cnt] | cur_cgrp_is_zero;
 			cur_sfc_row_phy_y <= # SIM_DELAY coordinate_buf_phy_y[(kernal_mixed_zone_cnt > 4'd10) ? 4'd10:kernal_mixed_zone_cnt];
 		end
 	end
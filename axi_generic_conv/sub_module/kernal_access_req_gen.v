@@ -33,6 +33,9 @@ SOFTWARE.
 
 支持扩展卷积核(核膨胀)
 
+支持零通道组跳过: 零通道组位图中置位的通道组(权重全为0)不产生权重块读请求, 其卷积核权重既不从内存读取也不存入卷积核缓存,
+此时实际通道组号只对非零通道组编号, 从而保证驻留区仍按实际通道组号顺序写入
+
 注意：
 当处于组卷积模式时, 每组的通道数/核数必须<=权重块最大宽度(max_wgtblk_w)
 权重块最大宽度(max_wgtblk_w)必须<=32
@@ -76,12 +79,17 @@ module kernal_access_req_gen #(
 	input wire[2:0] external_padding_top, // 上部外填充数
 	input wire[2:0] inner_padding_top_bottom, // 上下内填充数
 	input wire[3:0] kernal_dilation_vtc_n, // 垂直膨胀量
+	input wire en_zero_cgrp_skip, // 使能零通道组跳过
+	input wire[255:0] zero_cgrp_map, // 零通道组位图
 	
 	// 块级控制
 	input wire blk_start,
 	output wire blk_idle,
 	output wire blk_done,
 	
+	// 事件(指示)
+	output wire on_kernal_set_start, // 卷积核组开始
+	
 	// 卷积核权重块读请求(AXIS主机)
 	/*
 	请求格式 -> 
@@ -455,6 +463,8 @@ module kernal_access_req_gen #(
 	wire[31:0] incr_addr_of_now_kernal_cgrp; // 通道组递增地址
 	reg[23:0] btt_of_now_kernal_cgrp; // 当前通道组的有效字节数
 	reg[4:0] kernal_cgrp_len_upd_sts; // 通道组长度更新状态
+	reg[9:0] kernal_cgrp_id_cnt; // 核组内通道组号(计数器)
+	reg cur_kernal_cgrp_is_zero; // 当前通道组的权重全为0(标志)
 	// [访问请求]
 	reg[9:0] actual_cgrp_id; // 实际通道组号
 	wire[6:0] wgtblk_id; // 权重块编号
@@ -518,7 +528,8 @@ module kernal_access_req_gen #(
 	assign on_start_gen_kernal_row_mask = 
 		(req_gen_sts == KWGTBLK_ACCESS_STS_GEN_ROW_MASK) & (~ext_fmap_coordinate_cvt_blk_start);
 	
-	assign to_skip_cur_req = |(kernal_wgtblk_y_onehot & kernal_row_mask);
+	// 说明: 跳过处于填充行或零通道组的权重块
+	assign to_skip_cur_req = (|(kernal_wgtblk_y_onehot & kernal_row_mask)) | cur_kernal_cgrp_is_zero;
 	
 	assign cgrpn_of_now_kernal_set = cgrpn_foreach_kernal_set;
 	
@@ -594,6 +605,9 @@ module kernal_access_req_gen #(
 				);
 	end
 	
+	// 卷积核组开始(指示)
+	assign on_kernal_set_start = aclken & on_upd_kernal_set_params;
+	
 	// 初始化核组参数(指示)
 	always @(posedge aclk or negedge aresetn)
 	begin
@@ -733,6 +747,30 @@ module kernal_access_req_gen #(
 			kernal_cgrp_len_upd_sts <= # SIM_DELAY {kernal_cgrp_len_upd_sts[3:0], kernal_cgrp_len_upd_sts[4]};
 	end
 	
+	// 核组内通道组号(计数器)
+	always @(posedge aclk)
+	begin
+		if(aclken & (blk_idle | (on_upd_wgtblk_pos_cnt & is_last_kernal_wgtblk)))
+			kernal_cgrp_id_cnt <= # SIM_DELAY 
+				(blk_idle | is_last_kernal_cgrp) ? 
+					10'd0:
+					(kernal_cgrp_id_cnt + 1'b1);
+	end
+	
+	// 当前通道组的权重全为0(标志)
+	/*
+	说明: 核组内通道组号(计数器)在最后1个权重块的请求被接受或跳过时更新,
+		更新通道组参数(指示)由同一条件寄存得到, 比计数器的更新晚1clk, 因此这里采样到的已经是新的通道组号;
+		"生成请求"状态会等待更新通道组参数(指示)无效后才进入"等待请求被接受"状态, 故本标志总是与当前通道组对齐
+	*/
+	always @(posedge aclk)
+	begin
+		if(aclken & on_upd_kernal_cgrp_params)
+			cur_kernal_cgrp_is_zero <= # SIM_DELAY 
+				en_zero_cgrp_skip & (~is_grp_conv_mode) & 
+				(kernal_cgrp_id_cnt[9:8] == 2'b00) & zero_cgrp_map[kernal_cgrp_id_cnt[7:0]];
+	end
+	
 	// 实际通道组号
 	always @(posedge aclk)
 	begin
@@ -740,7 +778,8 @@ module kernal_access_req_gen #(
 			actual_cgrp_id <= # SIM_DELAY 
 				(blk_idle | is_last_kernal_cgrp) ? 
 					10'd0:
-					(actual_cgrp_id + 1'b1);
+					// 说明: 零通道组不占用实际通道组号
+					(actual_cgrp_id + {9'd0, ~cur_kernal_cgrp_is_zero});
 	end
 	
 	// 块级空闲(标志)
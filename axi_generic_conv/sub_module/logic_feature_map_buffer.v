@@ -41,7 +41,7 @@ SOFTWARE.
 表面行检索具有2clk的时延
 
 注意：
-暂不支持INT8运算数据格式
+INT8运算数据格式时, 每个16位数据为1对INT8通道, 每个表面存储ATOMIC_C*2个INT8通道
 
 在输入特征图表面行数据流中, 应当连续输入1个表面行的表面数据
 写特征图表面行时, 会等待直到这个表面行无效
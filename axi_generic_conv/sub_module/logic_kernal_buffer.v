@@ -40,7 +40,7 @@ SOFTWARE.
 支持的卷积核大小 -> 1x1, 3x3, 5x5, 7x7, 9x9, 11x11, 4x4
 
 注意：
-暂不支持INT8运算数据格式
+INT8运算数据格式时, 每个16位数据为1对INT8通道, 每个表面存储ATOMIC_C*2个INT8通道
 
 在输入通道组数据流中, 应当连续输入1个通道组的权重数据
 在发起权重块读请求前, 应当检查这个权重块是否已缓存, 否则会在输出权重块数据流中给出错误标志
@@ -57,6 +57,39 @@ SOFTWARE.
 	|          |         |31~16: 最大的卷积核个数 - 1    |              |                                  |
 	--------------------------------------------------------------------------------------------------------
 	|  info5   | 0x1C/7  |3~0: 中间结果缓存时钟倍率      |      RO      |                                  |
+	|          |         |8: 是否支持层描述符链          |              |                                  |
+	|          |         |9: 是否支持融合2x2最大池化     |              |                                  |
+	|          |         |10: 是否支持残差相加           |              |                                  |
+	|          |         |11: 是否支持输出特征图跨距     |              |                                  |
+	|          |         |12: 是否支持输入特征图跨距     |              |                                  |
+	|          |         |13: 是否支持INT8逐通道重量化   |              |                                  |
+	|          |         |14: 是否支持零通道组跳过       |              |                                  |
+	|          |         |31~16: 融合2x2最大池化         |              | 仅当支持融合2x2最大池化时,       |
+	|          |         |       行缓存深度 - 1          |              | 该字段可用                       |
+	--------------------------------------------------------------------------------------------------------
+	********************************************************************************************************
+	--------------------------------------------------------------------------------------------------------
+	|   pm0    | 0x20/8  |31~0: 乘加阵列等待特征图表面的 |      WC      | 仅当支持性能监测时, 该字段可用   |
+	|          |         |      周期数                   |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|   pm1    | 0x24/9  |31~0: 乘加阵列等待卷积核权重块 |      WC      | 仅当支持性能监测时, 该字段可用   |
+	|          |         |      的周期数                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|   pm2    | 0x28/10 |31~0: 乘加阵列受中间结果缓存   |      WC      | 仅当支持性能监测时, 该字段可用   |
+	|          |         |      阻塞的周期数             |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|   pm3    | 0x2C/11 |31~0: S2MM通道反压的周期数     |      WC      | 仅当支持性能监测时, 该字段可用   |
+	--------------------------------------------------------------------------------------------------------
+	|   pm4    | 0x30/12 |31~0: 特征图表面行置换次数     |      WC      | 仅当支持性能监测时, 该字段可用   |
+	--------------------------------------------------------------------------------------------------------
+	|   pm5    | 0x34/13 |31~0: 卷积核交换区通道组       |      WC      | 仅当支持性能监测时, 该字段可用   |
+	|          |         |      重新加载次数             |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x38/14 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   lo     |         |      性能监测计数器快照低32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x3C/15 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   hi     |         |      性能监测计数器快照高32位 |              |                                  |
 	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
@@ -71,6 +104,24 @@ SOFTWARE.
 	|          |         |10: 启动最终结果               |      WO      | 向该位写1会向最终结果            |
 	|          |         |    传输请求生成单元           |              | 传输请求生成单元发送start信号    |
 	--------------------------------------------------------------------------------------------------------
+	|  ctrl1   | 0x44/17 | 0: 使能完成中断               |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl2   | 0x48/18 |31~0: 完成中断的               |      RW      | 当S2MM通道完成的命令数           |
+	|          |         |      S2MM命令数阈值           |              | 计至该值时产生完成中断           |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl3   | 0x4C/19 | 0: 启动层描述符链             |      WO      | 向该位写1会向层描述符读取与执行  |
+	|          |         |                               |              | 单元发送start信号                |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl4   | 0x50/20 |31~0: 层描述符链首地址         |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl5   | 0x54/21 | 0: 写影子配置寄存器           |      RW      | 为1时, 经AXI-Lite写配置寄存器    |
+	|          |         |                               |              | 仅写入影子配置寄存器组           |
+	|          |         | 1: 影子配置寄存器待提交标志   |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl6   | 0x58/22 | 0: 锁存性能监测计数器快照     |      WO      | 向该位写1会在同1个周期内锁存     |
+	|          |         |                               |              | 全部性能监测计数器               |
+	|          |         |11~8: 快照读索引               |      RW      | 0~10依次对应sts4~sts8, pm0~pm5   |
+	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
 	|  sts0    | 0x60/24 | 0: 卷积核权重                 |      RO      |                                  |
@@ -96,6 +147,14 @@ SOFTWARE.
 	--------------------------------------------------------------------------------------------------------
 	|  sts8    | 0x80/32 |31~0: 已计算的特征图表面数     |      RO      | 该字段在除能计算子系统时自动清零 |
 	--------------------------------------------------------------------------------------------------------
+	|  sts9    | 0x84/33 | 0: 完成中断等待标志           |      WC      | 写1清零                          |
+	--------------------------------------------------------------------------------------------------------
+	|  sts10   | 0x88/34 | 0: 层描述符读取与执行         |      RO      |                                  |
+	|          |         |    单元空闲标志               |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|  sts11   | 0x8C/35 |31~0: 由层描述符链             |      WC      |                                  |
+	|          |         |      完成的层数               |              |                                  |
+	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
 	| cal_cfg  | 0x90/36 |2~0: 运算数据格式              |      RW      | 在写入时, 仅对支持的             |
@@ -129,12 +188,26 @@ SOFTWARE.
 	|          |         |5~3: 上部外填充数              |      RW      | 仅在支持外填充时, 写非0值生效    |
 	|          |         |8~6: 左右内填充数              |      RW      | 仅在支持内填充时, 写非0值生效    |
 	|          |         |11~9: 上下内填充数             |      RW      | 仅在支持内填充时, 写非0值生效    |
+	|          |         |12: 使能融合2x2最大池化        |      RW      | 仅当支持融合2x2最大池化时,       |
+	|          |         |                               |              | 写1生效                          |
 	|          |         |31~16: 扩展后特征图的垂直边界  |      RW      |                                  |
 	--------------------------------------------------------------------------------------------------------
 	|fmap_cfg5 | 0xD4/53 |1~0: 输出特征图数据大小类型    |      RW      |                                  |
 	|          |         |16~2: 输出特征图宽度 - 1       |      RW      |                                  |
 	|          |         |31~17: 输出特征图高度 - 1      |      RW      |                                  |
 	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg6 | 0xD8/54 |23~0: 输出特征图表面行跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg7 | 0xDC/55 |31~0: 输出特征图通道组跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg8 | 0xE0/56 |23~0: 输入特征图表面行跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg9 | 0xE4/57 |31~0: 输入特征图通道组跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
 	|krn_cfg0  |0x100/64 |31~0: 卷积核权重基地址         |      RW      |                                  |
@@ -172,6 +245,10 @@ SOFTWARE.
 	|          |         |    参数A的实际值是否为1       |              | 该字段可用                       |
 	|          |         |17: 批归一化                   |      RW      | 仅当支持批归一化处理时,          |
 	|          |         |    参数B的实际值是否为0       |              | 该字段可用                       |
+	|          |         |18: 使能INT8逐通道重量化       |      RW      | 仅当支持批归一化处理和INT8时,    |
+	|          |         |                               |              | 写1生效                          |
+	|          |         |27~24: 输出舍入单元的          |      RW      | 仅当运算数据格式为INT16或INT8时, |
+	|          |         |       定点数量化精度          |              | 该字段可用                       |
 	--------------------------------------------------------------------------------------------------------
 	| act_cfg0 |0x184/97 |2~0: 激活函数类型              |      RW      | 设置支持的激活函数类型时生效     |
 	|          |         |12~8:(泄露Relu激活参数)        |      RW      | 仅当支持Leaky-Relu激活时,        |
@@ -182,9 +259,46 @@ SOFTWARE.
 	| act_cfg1 |0x188/98 |31~0: 泄露Relu激活参数         |      RW      | 仅当支持Leaky-Relu激活时,        |
 	|          |         |                               |              | 该字段可用                       |
 	--------------------------------------------------------------------------------------------------------
+	| res_cfg0 |0x18C/99 | 0: 使能残差相加               |      RW      | 仅当支持残差相加时, 写1生效      |
+	|          |         | 1: 残差相加后做Relu           |      RW      | 仅当支持残差相加时,              |
+	|          |         |                               |              | 该字段可用                       |
+	|          |         |13~8: 残差缩放系数的指数       |      RW      | 仅当支持残差相加时,              |
+	|          |         |      (有符号数)               |              | 该字段可用                       |
+	--------------------------------------------------------------------------------------------------------
+	| res_cfg1 |0x190/100|31~0: 残差特征图基地址         |      RW      | 仅当支持残差相加时,              |
+	|          |         |                               |              | 该字段可用                       |
+	--------------------------------------------------------------------------------------------------------
+	| spa_cfg0 |0x1C0/112| 0: 使能零通道组跳过           |      RW      |                                  |
+	|          |         |25~16: 非零通道组数 - 1       |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| spa_cfg1 |0x1C4/113|31~0: 零通道组位图[31:0]       |      RW      | 第i位为1表示通道组i的权重全为0   |
+	--------------------------------------------------------------------------------------------------------
+	|   ...    |   ...   |             ...               |     ...      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| spa_cfg8 |0x1E0/120|31~0: 零通道组位图[255:224]    |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
 
 注意：
-无
+层描述符链运行期间, 层描述符读取与执行单元会通过内部写端口改写配置寄存器和ctrl0,
+此时不应通过AXI-Lite写这些寄存器
+当ctrl5[0]为1时, 经AXI-Lite写配置寄存器只会写入影子配置寄存器组, 这些配置会在下一次启动时被提交,
+因此可在计算当前层期间写入下一层的配置; 层描述符读取与执行单元的写请求不受影子配置寄存器组的影响
+fmap_cfg4[12]为1时, 最终结果在写出前经过步长为2的2x2最大池化, fmap_cfg5仍给出池化前的输出特征图宽度和高度,
+写出的输出特征图宽度和高度分别为池化前的1/2(向下取整), S2MM通道的命令数也相应减少
+fmap_cfg6/fmap_cfg7非0时, 输出特征图按给定的表面行跨距和通道组跨距(每ATOMIC_K个通道为1个通道组)写出,
+从而可直接写入拼接后特征图的1个通道切片; 通道偏移通过输出特征图基地址(fmap_cfg1)给出
+fmap_cfg8/fmap_cfg9非0时, 输入特征图按给定的表面行跨距和通道组跨距(每ATOMIC_C个通道为1个通道组)读取,
+从而可直接读取更大特征图中的1个区域(裁剪、通道切片或分块); 起始通道组和区域左上角通过输入特征图基地址(fmap_cfg0)给出,
+组卷积时每组的数据量(grp_conv0[31:1])应为每组的通道组数 * 通道组跨距
+res_cfg0[0]为1时, 最终结果在BN与激活之后、写出之前与经2号MM2S通道读入的残差特征图逐元素相加:
+结果 = 最终结果 + 残差 * 2 ^ 缩放系数的指数, 残差特征图与输出特征图的形状、数据大小类型和存储布局相同;
+res_cfg0[1]为1时对相加结果再做Relu, 与除能激活函数配合即可实现"先相加后激活"; 残差相加与融合2x2最大池化不能同时使能
+spa_cfg0[0]为1时, 零通道组位图中置位的通道组(权重对所有卷积核均为0)不参与计算, 既不读取其卷积核权重和特征图表面行, 也不占用乘加阵列;
+spa_cfg0[25:16]须给出位图中未置位的通道组数 - 1, 至少保留1个非零通道组; 仅前256个通道组可被跳过, 组卷积模式下不可使能;
+层描述符不包含spa_cfg0~8, 执行层描述符链时它们保持AXI-Lite写入的值
+pm0~pm3在完成中断等待标志(sts9[0])置位后停止计数, 因此层完成后读到的是该层的停顿周期数
+sts4~sts8和pm0~pm5均为64位计数器, 直接读这些寄存器得到的是实时值的低32位;
+向ctrl6[0]写1会把它们同时锁存到快照, 再通过ctrl6[11:8]选择并经pm_snap_lo/pm_snap_hi读出一致的64位值
 
 协议:
 AXI-Lite SLAVE
@@ -210,6 +324,9 @@ module reg_if_for_generic_conv #(
 	parameter EXT_PADDING_SUPPORTED = 1'b1, // 是否支持外填充
 	parameter INNER_PADDING_SUPPORTED = 1'b0, // 是否支持内填充
 	parameter KERNAL_DILATION_SUPPORTED = 1'b0, // 是否支持卷积核膨胀
+	parameter FUSED_MAX_POOL_SUPPORTED = 1'b0, // 是否支持融合2x2最大池化
+	parameter integer FUSED_MAX_POOL_BUF_DEPTH = 1024, // 融合2x2最大池化行缓存深度(16~65536)
+	parameter RESIDUAL_ADD_SUPPORTED = 1'b0, // 是否支持残差相加
 	parameter EN_PERF_MON = 1'b1, // 是否支持性能监测
 	parameter integer ACCELERATOR_ID = 0, // 加速器ID(0~3)
 	parameter integer ATOMIC_K = 8, // 核并行数(1 | 2 | 4 | 8 | 16 | 32)
@@ -284,6 +401,11 @@ module reg_if_for_generic_conv #(
 	output wire[15:0] ofmap_w, // 输出特征图宽度 - 1
 	output wire[15:0] ofmap_h, // 输出特征图高度 - 1
 	output wire[1:0] ofmap_data_type, // 输出特征图数据大小类型
+	output wire en_fused_max_pool, // 使能融合2x2最大池化
+	output wire[23:0] ofmap_row_pitch, // 输出特征图表面行跨距(0表示紧密存储)
+	output wire[31:0] ofmap_cgrp_pitch, // 输出特征图通道组跨距(0表示紧密存储)
+	output wire[23:0] ifmap_row_pitch, // 输入特征图表面行跨距(0表示紧密存储)
+	output wire[31:0] ifmap_cgrp_pitch, // 输入特征图通道组跨距(0表示紧密存储)
 	// [卷积核参数]
 	output wire[31:0] kernal_wgt_baseaddr, // 卷积核权重基地址
 	output wire[2:0] kernal_shape, // 卷积核形状
@@ -310,9 +432,20 @@ module reg_if_for_generic_conv #(
 	output wire[4:0] bn_fixed_point_quat_accrc, // (批归一化操作数A)定点数量化精度
 	output wire bn_is_a_eq_1, // 批归一化参数A的实际值为1(标志)
 	output wire bn_is_b_eq_0, // 批归一化参数B的实际值为0(标志)
+	output wire en_int8_requant, // 使能INT8逐通道重量化
+	output wire[3:0] out_fixed_point_quat_accrc, // 输出舍入单元的定点数量化精度
 	output wire[4:0] leaky_relu_fixed_point_quat_accrc, // (泄露Relu激活参数)定点数量化精度
 	output wire[31:0] leaky_relu_param_alpha, // 泄露Relu激活参数
 	output wire[4:0] sigmoid_tanh_fixed_point_quat_accrc, // Sigmoid或Tanh输入定点数量化精度
+	// [残差相加参数]
+	output wire en_residual_add, // 使能残差相加
+	output wire residual_relu, // 残差相加后做Relu
+	output wire[5:0] residual_scale_exp, // 残差缩放系数的指数(有符号数)
+	output wire[31:0] residual_baseaddr, // 残差特征图基地址
+	// [零通道组跳过参数]
+	output wire en_zero_cgrp_skip, // 使能零通道组跳过
+	output wire[9:0] zero_cgrp_skip_vld_cgrpn, // 非零通道组数 - 1
+	output wire[255:0] zero_cgrp_map, // 零通道组位图
 	
 	// 块级控制
 	// [卷积核权重访问请求生成单元]
@@ -327,9 +460,31 @@ module reg_if_for_generic_conv #(
 	output wire fnl_res_trans_blk_start,
 	input wire fnl_res_trans_blk_idle,
 	input wire fnl_res_trans_blk_done,
+	// [层描述符读取与执行单元]
+	output wire desc_chain_blk_start,
+	input wire desc_chain_blk_idle,
+	input wire desc_chain_blk_done,
+	
+	// 层描述符链
+	output wire[31:0] desc_chain_baseaddr, // 层描述符链首地址
+	input wire desc_layer_done, // 由层描述符链完成1层(指示)
+	// [寄存器写端口]
+	input wire desc_regs_wen,
+	input wire[6:0] desc_regs_addr,
+	input wire[31:0] desc_regs_din,
+	output wire desc_regs_wready,
 	
 	// 状态信息
-	input wire[31:0] ftm_sfc_cal_n, // 已计算的特征图表面数
+	input wire[63:0] ftm_sfc_cal_n, // 已计算的特征图表面数
+	
+	// 扩展性能监测
+	output wire pm_mac_stall_cnt_en, // 乘加阵列停顿周期计数使能
+	output wire[2:0] pm_mac_stall_cnt_clr, // 清零乘加阵列停顿周期计数器(指示, {受中间结果缓存阻塞, 等待卷积核权重块, 等待特征图表面})
+	input wire[63:0] mac_wait_ftm_cyc_n, // 乘加阵列等待特征图表面的周期数
+	input wire[63:0] mac_wait_kernal_cyc_n, // 乘加阵列等待卷积核权重块的周期数
+	input wire[63:0] mac_stall_by_res_cyc_n, // 乘加阵列受中间结果缓存阻塞的周期数
+	input wire on_fm_sfc_row_rplc, // 置换1个特征图表面行(指示)
+	input wire on_kbuf_sw_rgn_rplc, // 置换1个交换区通道组(指示)
 	
 	// 传输字节数监测
 	// [0号MM2S通道]
@@ -348,7 +503,10 @@ module reg_if_for_generic_conv #(
 	// DMA命令完成指示
 	input wire mm2s_0_cmd_done, // 0号MM2S通道命令完成(指示)
 	input wire mm2s_1_cmd_done, // 1号MM2S通道命令完成(指示)
-	input wire s2mm_cmd_done // S2MM通道命令完成(指示)
+	input wire s2mm_cmd_done, // S2MM通道命令完成(指示)
+	
+	// 中断
+	output wire irq // 完成中断
 );
 	
     // 计算bit_depth的最高有效位编号(即位数-1)
@@ -380,6 +538,7 @@ module reg_if_for_generic_conv #(
 	
 	/** 内部配置 **/
 	localparam integer REGS_N = 128; // 寄存器总数
+	localparam integer ZERO_CGRP_MAP_LEN = 256; // 零通道组位图长度
 	
 	/** 常量 **/
 	// 寄存器配置状态独热码编号
@@ -422,10 +581,22 @@ module reg_if_for_generic_conv #(
 	
 	assign rw_grant = {s_axi_lite_awvalid, (~s_axi_lite_awvalid) & s_axi_lite_arvalid}; // 写优先
 	
-	assign regs_en = reg_cfg_sts[REG_CFG_STS_RW_REG] & ((~is_write) | s_axi_lite_wvalid);
-	assign regs_wen = is_write;
-	assign regs_addr = ofs_addr;
-	assign regs_din = s_axi_lite_wdata;
+	/*
+	AXI-Lite读写寄存器优先, 
+	层描述符读取与执行单元的寄存器写请求仅在寄存器配置状态不为"读/写寄存器"时被接受
+	*/
+	assign desc_regs_wready = (~reg_cfg_sts[REG_CFG_STS_RW_REG]) & desc_regs_wen;
+	
+	assign regs_en = (reg_cfg_sts[REG_CFG_STS_RW_REG] & ((~is_write) | s_axi_lite_wvalid)) | desc_regs_wready;
+	assign regs_wen = (~reg_cfg_sts[REG_CFG_STS_RW_REG]) | is_write;
+	assign regs_addr = 
+		reg_cfg_sts[REG_CFG_STS_RW_REG] ? 
+			ofs_addr:
+			desc_regs_addr[clogb2(REGS_N-1):0];
+	assign regs_din = 
+		reg_cfg_sts[REG_CFG_STS_RW_REG] ? 
+			s_axi_lite_wdata:
+			desc_regs_din;
 	
 	// 寄存器配置状态
 	always @(posedge aclk or negedge aresetn)
@@ -522,6 +693,15 @@ module reg_if_for_generic_conv #(
 	|          |         |31~16: 最大的卷积核个数 - 1    |              |                                  |
 	--------------------------------------------------------------------------------------------------------
 	|  info5   | 0x1C/7  |3~0: 中间结果缓存时钟倍率      |      RO      |                                  |
+	|          |         |8: 是否支持层描述符链          |              |                                  |
+	|          |         |9: 是否支持融合2x2最大池化     |              |                                  |
+	|          |         |10: 是否支持残差相加           |              |                                  |
+	|          |         |11: 是否支持输出特征图跨距     |              |                                  |
+	|          |         |12: 是否支持输入特征图跨距     |              |                                  |
+	|          |         |13: 是否支持INT8逐通道重量化   |              |                                  |
+	|          |         |14: 是否支持零通道组跳过       |              |                                  |
+	|          |         |31~16: 融合2x2最大池化         |              | 仅当支持融合2x2最大池化时,       |
+	|          |         |       行缓存深度 - 1          |              | 该字段可用                       |
 	--------------------------------------------------------------------------------------------------------
 	**/
 	wire[31:0] version_r; // 版本号
@@ -540,6 +720,14 @@ module reg_if_for_generic_conv #(
 	wire[7:0] bn_act_prl_n_r; // BN与激活并行数 - 1
 	wire[15:0] max_kernal_n_r; // 最大的卷积核个数 - 1
 	wire[3:0] mid_res_buf_clk_rate_r; // 中间结果缓存时钟倍率
+	wire layer_desc_supported_r; // 是否支持层描述符链
+	wire fused_max_pool_supported_r; // 是否支持融合2x2最大池化
+	wire[15:0] fused_max_pool_buf_depth_r; // 融合最大池化行缓存深度 - 1
+	wire residual_add_supported_r; // 是否支持残差相加
+	wire ofmap_pitch_supported_r; // 是否支持输出特征图跨距
+	wire ifmap_pitch_supported_r; // 是否支持输入特征图跨距
+	wire int8_requant_supported_r; // 是否支持INT8逐通道重量化
+	wire zero_cgrp_skip_supported_r; // 是否支持零通道组跳过
 	
 	assign version_r = {4'd0, 4'd3, 4'd2, 4'd1, 4'd5, 4'd2, 4'd0, 4'd2}; // 2025.12.30
 	assign accelerator_type_r = {5'd26, 5'd26, 5'd21, 5'd13, 5'd14, 5'd2}; // "conv\0\0"
@@ -557,9 +745,17 @@ module reg_if_for_generic_conv #(
 	assign bn_act_prl_n_r = BN_ACT_PRL_N - 1;
 	assign max_kernal_n_r = MAX_KERNAL_N - 1;
 	assign mid_res_buf_clk_rate_r = MID_RES_BUF_CLK_RATE;
+	assign layer_desc_supported_r = 1'b1;
+	assign fused_max_pool_supported_r = FUSED_MAX_POOL_SUPPORTED;
+	assign fused_max_pool_buf_depth_r = FUSED_MAX_POOL_SUPPORTED ? (FUSED_MAX_POOL_BUF_DEPTH - 1):0;
+	assign residual_add_supported_r = RESIDUAL_ADD_SUPPORTED;
+	assign ofmap_pitch_supported_r = 1'b1;
+	assign ifmap_pitch_supported_r = 1'b1;
+	assign int8_requant_supported_r = BN_SUPPORTED & INT8_SUPPORTED;
+	assign zero_cgrp_skip_supported_r = 1'b1;
 	
 	/**
-	寄存器(ctrl0)
+	寄存器(ctrl0, ctrl1, ctrl2, ctrl3, ctrl4, ctrl5, ctrl6)
 	
 	--------------------------------------------------------------------------------------------------------
 	|  ctrl0   | 0x40/16 | 0: 使能加速器                 |      RW      |                                  |
@@ -573,6 +769,24 @@ module reg_if_for_generic_conv #(
 	|          |         |10: 启动最终结果               |      WO      | 向该位写1会向最终结果            |
 	|          |         |    传输请求生成单元           |              | 传输请求生成单元发送start信号    |
 	--------------------------------------------------------------------------------------------------------
+	|  ctrl1   | 0x44/17 | 0: 使能完成中断               |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl2   | 0x48/18 |31~0: 完成中断的               |      RW      | 当S2MM通道完成的命令数           |
+	|          |         |      S2MM命令数阈值           |              | 计至该值时产生完成中断           |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl3   | 0x4C/19 | 0: 启动层描述符链             |      WO      | 向该位写1会向层描述符读取与执行  |
+	|          |         |                               |              | 单元发送start信号                |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl4   | 0x50/20 |31~0: 层描述符链首地址         |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl5   | 0x54/21 | 0: 写影子配置寄存器           |      RW      | 为1时, 经AXI-Lite写配置寄存器    |
+	|          |         |                               |              | 仅写入影子配置寄存器组           |
+	|          |         | 1: 影子配置寄存器待提交标志   |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|  ctrl6   | 0x58/22 | 0: 锁存性能监测计数器快照     |      WO      | 向该位写1会在同1个周期内锁存     |
+	|          |         |                               |              | 全部性能监测计数器               |
+	|          |         |11~8: 快照读索引               |      RW      | 0~10依次对应sts4~sts8, pm0~pm5   |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	reg en_accelerator_r; // 使能加速器
 	reg en_cal_sub_sys_r; // 使能计算子系统
@@ -581,6 +795,13 @@ module reg_if_for_generic_conv #(
 	reg kernal_access_blk_start_r; // 启动卷积核权重访问请求生成单元(指示)
 	reg fmap_access_blk_start_r; // 启动特征图表面行访问请求生成单元(指示)
 	reg fnl_res_trans_blk_start_r; // 启动最终结果传输请求生成单元(指示)
+	reg en_done_irq_r; // 使能完成中断
+	reg[31:0] done_irq_s2mm_cmd_n_th_r; // 完成中断的S2MM命令数阈值
+	reg desc_chain_blk_start_r; // 启动层描述符读取与执行单元(指示)
+	reg[31:0] desc_chain_baseaddr_r; // 层描述符链首地址
+	reg shadow_cfg_wen_r; // 写影子配置寄存器
+	reg pm_snap_r; // 锁存性能监测计数器快照(指示)
+	reg[3:0] pm_snap_sel_r; // 快照读索引
 	
 	assign en_accelerator = en_accelerator_r;
 	assign en_mac_array = en_cal_sub_sys_r;
@@ -590,6 +811,9 @@ module reg_if_for_generic_conv #(
 	assign kernal_access_blk_start = kernal_access_blk_start_r;
 	assign fmap_access_blk_start = fmap_access_blk_start_r;
 	assign fnl_res_trans_blk_start = fnl_res_trans_blk_start_r;
+	assign desc_chain_blk_start = desc_chain_blk_start_r;
+	
+	assign desc_chain_baseaddr = desc_chain_baseaddr_r;
 	
 	// 使能加速器
 	always @(posedge aclk or negedge aresetn)
@@ -637,8 +861,73 @@ module reg_if_for_generic_conv #(
 				{3{regs_en & regs_wen & (regs_addr == 16)}} & regs_din[10:8];
 	end
 	
+	// 使能完成中断
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			en_done_irq_r <= 1'b0;
+		else if(regs_en & regs_wen & (regs_addr == 17))
+			en_done_irq_r <= # SIM_DELAY regs_din[0];
+	end
+	
+	// 完成中断的S2MM命令数阈值
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			done_irq_s2mm_cmd_n_th_r <= 32'd0;
+		else if(regs_en & regs_wen & (regs_addr == 18))
+			done_irq_s2mm_cmd_n_th_r <= # SIM_DELAY regs_din[31:0];
+	end
+	
+	// 启动层描述符读取与执行单元(指示)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			desc_chain_blk_start_r <= 1'b0;
+		else
+			desc_chain_blk_start_r <= # SIM_DELAY 
+				regs_en & regs_wen & (regs_addr == 19) & regs_din[0] & desc_chain_blk_idle;
+	end
+	
+	// 层描述符链首地址
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			desc_chain_baseaddr_r <= 32'd0;
+		else if(regs_en & regs_wen & (regs_addr == 20))
+			desc_chain_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+	end
+	
+	// 写影子配置寄存器
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			shadow_cfg_wen_r <= 1'b0;
+		else if(regs_en & regs_wen & (regs_addr == 21))
+			shadow_cfg_wen_r <= # SIM_DELAY regs_din[0];
+	end
+	
+	// 锁存性能监测计数器快照(指示)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_r <= 1'b0;
+		else
+			pm_snap_r <= # SIM_DELAY 
+				EN_PERF_MON & regs_en & regs_wen & (regs_addr == 22) & regs_din[0];
+	end
+	
+	// 快照读索引
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_sel_r <= 4'd0;
+		else if(regs_en & regs_wen & (regs_addr == 22))
+			pm_snap_sel_r <= # SIM_DELAY regs_din[11:8];
+	end
+	
 	/**
-	寄存器(sts0, sts1, sts2, sts3, sts4, sts5, sts6, sts7, sts8)
+	寄存器(sts0, sts1, sts2, sts3, sts4, sts5, sts6, sts7, sts8, sts9, sts10, sts11)
 	
 	--------------------------------------------------------------------------------------------------------
 	|  sts0    | 0x60/24 | 0: 卷积核权重                 |      RO      |                                  |
@@ -664,6 +953,14 @@ module reg_if_for_generic_conv #(
 	--------------------------------------------------------------------------------------------------------
 	|  sts8    | 0x80/32 |31~0: 已计算的特征图表面数     |      RO      | 该字段在除能计算子系统时自动清零 |
 	--------------------------------------------------------------------------------------------------------
+	|  sts9    | 0x84/33 | 0: 完成中断等待标志           |      WC      | 写1清零                          |
+	--------------------------------------------------------------------------------------------------------
+	|  sts10   | 0x88/34 | 0: 层描述符读取与执行         |      RO      |                                  |
+	|          |         |    单元空闲标志               |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|  sts11   | 0x8C/35 |31~0: 由层描述符链             |      WC      |                                  |
+	|          |         |      完成的层数               |              |                                  |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	wire kernal_access_blk_idle_r; // 卷积核权重访问请求生成单元空闲标志
 	wire fmap_access_blk_idle_r; // 特征图表面行访问请求生成单元空闲标志
@@ -671,13 +968,20 @@ module reg_if_for_generic_conv #(
 	reg[31:0] dma_mm2s_0_fns_cmd_n_r; // 0号MM2S通道完成的命令数
 	reg[31:0] dma_mm2s_1_fns_cmd_n_r; // 1号MM2S通道完成的命令数
 	reg[31:0] dma_s2mm_fns_cmd_n_r; // S2MM通道完成的命令数
-	reg[31:0] pm_cnt_r; // 性能监测计数器
-	reg[31:0] mm2s_ch0_tsf_n_r; // 0号MM2S通道传输字节数
-	reg[31:0] mm2s_ch1_tsf_n_r; // 1号MM2S通道传输字节数
-	reg[31:0] s2mm_tsf_n_r; // S2MM通道传输字节数
-	wire[31:0] ftm_sfc_cal_n_r; // 已计算的特征图表面数
+	reg[63:0] pm_cnt_r; // 性能监测计数器
+	reg[63:0] mm2s_ch0_tsf_n_r; // 0号MM2S通道传输字节数
+	reg[63:0] mm2s_ch1_tsf_n_r; // 1号MM2S通道传输字节数
+	reg[63:0] s2mm_tsf_n_r; // S2MM通道传输字节数
+	wire[63:0] ftm_sfc_cal_n_r; // 已计算的特征图表面数
+	reg done_irq_pending_r; // 完成中断等待标志
+	reg irq_r; // 完成中断
+	wire desc_chain_blk_idle_r; // 层描述符读取与执行单元空闲标志
+	reg[31:0] desc_layer_fns_n_r; // 由层描述符链完成的层数
+	
+	assign irq = irq_r;
 	
 	assign kernal_access_blk_idle_r = kernal_access_blk_idle;
+	assign desc_chain_blk_idle_r = desc_chain_blk_idle;
 	assign fmap_access_blk_idle_r = fmap_access_blk_idle;
 	assign fnl_res_trans_blk_idle_r = fnl_res_trans_blk_idle;
 	
@@ -728,11 +1032,60 @@ module reg_if_for_generic_conv #(
 					(dma_s2mm_fns_cmd_n_r + 1'b1);
 	end
 	
+	/*
+	完成中断等待标志
+	
+	S2MM通道完成的命令数递增至阈值时或层描述符链执行完成时置位, 向sts9[0]写1时清零
+	*/
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			done_irq_pending_r <= 1'b0;
+		else if(
+			(
+				en_accelerator_r & s2mm_cmd_done & (~(regs_en & regs_wen & (regs_addr == 27))) & 
+				(done_irq_s2mm_cmd_n_th_r != 32'd0) & ((dma_s2mm_fns_cmd_n_r + 1'b1) == done_irq_s2mm_cmd_n_th_r)
+			) | 
+			desc_chain_blk_done | 
+			(regs_en & regs_wen & (regs_addr == 33) & regs_din[0])
+		)
+			done_irq_pending_r <= # SIM_DELAY 
+				(
+					en_accelerator_r & s2mm_cmd_done & (~(regs_en & regs_wen & (regs_addr == 27))) & 
+					(done_irq_s2mm_cmd_n_th_r != 32'd0) & ((dma_s2mm_fns_cmd_n_r + 1'b1) == done_irq_s2mm_cmd_n_th_r)
+				) | 
+				desc_chain_blk_done;
+	end
+	
+	// 由层描述符链完成的层数
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			desc_layer_fns_n_r <= 32'd0;
+		else if(
+			desc_layer_done | 
+			(regs_en & regs_wen & (regs_addr == 35))
+		)
+			desc_layer_fns_n_r <= # SIM_DELAY 
+				(regs_en & regs_wen & (regs_addr == 35)) ? 
+					32'd0:
+					(desc_layer_fns_n_r + 1'b1);
+	end
+	
+	// 完成中断
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			irq_r <= 1'b0;
+		else
+			irq_r <= # SIM_DELAY en_done_irq_r & done_irq_pending_r;
+	end
+	
 	// 性能监测计数器
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			pm_cnt_r <= 32'd0;
+			pm_cnt_r <= 64'd0;
 		else if(
 			EN_PERF_MON & 
 			(
@@ -742,7 +1095,7 @@ module reg_if_for_generic_conv #(
 		)
 			pm_cnt_r <= # SIM_DELAY 
 				(regs_en & regs_wen & (regs_addr == 28)) ? 
-					32'd0:
+					64'd0:
 					(pm_cnt_r + 1'b1);
 	end
 	
@@ -750,7 +1103,7 @@ module reg_if_for_generic_conv #(
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			mm2s_ch0_tsf_n_r <= 32'd0;
+			mm2s_ch0_tsf_n_r <= 64'd0;
 		else if(
 			EN_PERF_MON & 
 			(
@@ -760,7 +1113,7 @@ module reg_if_for_generic_conv #(
 		)
 			mm2s_ch0_tsf_n_r <= # SIM_DELAY 
 				(regs_en & regs_wen & (regs_addr == 29)) ? 
-					32'd0:
+					64'd0:
 					(mm2s_ch0_tsf_n_r + count1_of_u32(s0_mm2s_strm_axis_keep | 32'd0));
 	end
 	
@@ -768,7 +1121,7 @@ module reg_if_for_generic_conv #(
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			mm2s_ch1_tsf_n_r <= 32'd0;
+			mm2s_ch1_tsf_n_r <= 64'd0;
 		else if(
 			EN_PERF_MON & 
 			(
@@ -778,7 +1131,7 @@ module reg_if_for_generic_conv #(
 		)
 			mm2s_ch1_tsf_n_r <= # SIM_DELAY 
 				(regs_en & regs_wen & (regs_addr == 30)) ? 
-					32'd0:
+					64'd0:
 					(mm2s_ch1_tsf_n_r + count1_of_u32(s1_mm2s_strm_axis_keep | 32'd0));
 	end
 	
@@ -786,7 +1139,7 @@ module reg_if_for_generic_conv #(
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			s2mm_tsf_n_r <= 32'd0;
+			s2mm_tsf_n_r <= 64'd0;
 		else if(
 			EN_PERF_MON & 
 			(
@@ -796,10 +1149,229 @@ module reg_if_for_generic_conv #(
 		)
 			s2mm_tsf_n_r <= # SIM_DELAY 
 				(regs_en & regs_wen & (regs_addr == 31)) ? 
-					32'd0:
+					64'd0:
 					(s2mm_tsf_n_r + count1_of_u32(s_s2mm_strm_axis_keep | 32'd0));
 	end
 	
+	/**
+	寄存器(pm0, pm1, pm2, pm3, pm4, pm5, pm_snap_lo, pm_snap_hi)
+	
+	--------------------------------------------------------------------------------------------------------
+	|   pm0    | 0x20/8  |31~0: 乘加阵列等待特征图表面的 |      WC      | 仅当支持性能监测时, 该字段可用   |
+	|          |         |      周期数                   |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|   pm1    | 0x24/9  |31~0: 乘加阵列等待卷积核权重块 |      WC      | 仅当支持性能监测时, 该字段可用   |
+	|          |         |      的周期数                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|   pm2    | 0x28/10 |31~0: 乘加阵列受中间结果缓存   |      WC      | 仅当支持性能监测时, 该字段可用   |
+	|          |         |      阻塞的周期数             |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|   pm3    | 0x2C/11 |31~0: S2MM通道反压的周期数     |      WC      | 仅当支持性能监测时, 该字段可用   |
+	--------------------------------------------------------------------------------------------------------
+	|   pm4    | 0x30/12 |31~0: 特征图表面行置换次数     |      WC      | 仅当支持性能监测时, 该字段可用   |
+	--------------------------------------------------------------------------------------------------------
+	|   pm5    | 0x34/13 |31~0: 卷积核交换区通道组       |      WC      | 仅当支持性能监测时, 该字段可用   |
+	|          |         |      重新加载次数             |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x38/14 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   lo     |         |      性能监测计数器快照低32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x3C/15 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   hi     |         |      性能监测计数器快照高32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	**/
+	wire[63:0] mac_wait_ftm_cyc_n_r; // 乘加阵列等待特征图表面的周期数
+	wire[63:0] mac_wait_kernal_cyc_n_r; // 乘加阵列等待卷积核权重块的周期数
+	wire[63:0] mac_stall_by_res_cyc_n_r; // 乘加阵列受中间结果缓存阻塞的周期数
+	reg[63:0] s2mm_bp_cyc_n_r; // S2MM通道反压的周期数
+	reg[63:0] fm_sfc_row_rplc_n_r; // 特征图表面行置换次数
+	reg[63:0] kbuf_sw_rgn_rplc_n_r; // 卷积核交换区通道组重新加载次数
+	reg layer_busy_r; // 层正在执行(标志)
+	wire on_layer_done; // 层完成(指示)
+	wire pm_stall_cnt_en; // 停顿周期计数使能
+	
+	/*
+	停顿周期只在层正在执行(已启动且未完成)时计数, 加速器空闲、等待启动或完成后等待清除中断的周期都不计入
+	层完成与完成中断等待标志的置位条件相同; 完成阈值为0(且不使用层描述符链)时, 计数到除能加速器为止
+	*/
+	assign on_layer_done = 
+		(
+			en_accelerator_r & s2mm_cmd_done & (~(regs_en & regs_wen & (regs_addr == 27))) & 
+			(done_irq_s2mm_cmd_n_th_r != 32'd0) & ((dma_s2mm_fns_cmd_n_r + 1'b1) == done_irq_s2mm_cmd_n_th_r)
+		) | 
+		desc_chain_blk_done;
+	assign pm_stall_cnt_en = EN_PERF_MON & en_accelerator_r & en_pm_cnt_r & layer_busy_r;
+	
+	/*
+	乘加阵列停顿周期计数器位于计算子系统(按计算核心时钟周期计数), 这里只给出计数使能和清零指示
+	计算核心时钟倍率>1时, 计数值经跨时钟域同步, 清零后需数个周期才能读到0
+	*/
+	assign pm_mac_stall_cnt_en = pm_stall_cnt_en;
+	assign pm_mac_stall_cnt_clr = 
+		{3{EN_PERF_MON & regs_en & regs_wen}} & 
+		{regs_addr == 10, regs_addr == 9, regs_addr == 8};
+	
+	assign mac_wait_ftm_cyc_n_r = EN_PERF_MON ? mac_wait_ftm_cyc_n:64'd0;
+	assign mac_wait_kernal_cyc_n_r = EN_PERF_MON ? mac_wait_kernal_cyc_n:64'd0;
+	assign mac_stall_by_res_cyc_n_r = EN_PERF_MON ? mac_stall_by_res_cyc_n:64'd0;
+	
+	// 层正在执行(标志)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			layer_busy_r <= 1'b0;
+		else if(
+			(~en_accelerator_r) | on_layer_done | 
+			kernal_access_blk_start_r | fmap_access_blk_start_r | fnl_res_trans_blk_start_r | desc_chain_blk_start_r
+		)
+			layer_busy_r <= # SIM_DELAY 
+				en_accelerator_r & (~on_layer_done) & 
+				(kernal_access_blk_start_r | fmap_access_blk_start_r | fnl_res_trans_blk_start_r | desc_chain_blk_start_r | layer_busy_r);
+	end
+	
+	// S2MM通道反压的周期数
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			s2mm_bp_cyc_n_r <= 64'd0;
+		else if(
+			EN_PERF_MON & 
+			(
+				(pm_stall_cnt_en & s_s2mm_strm_axis_valid & (~s_s2mm_strm_axis_ready)) | 
+				(regs_en & regs_wen & (regs_addr == 11))
+			)
+		)
+			s2mm_bp_cyc_n_r <= # SIM_DELAY 
+				(regs_en & regs_wen & (regs_addr == 11)) ? 
+					64'd0:
+					(s2mm_bp_cyc_n_r + 1'b1);
+	end
+	
+	// 特征图表面行置换次数
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			fm_sfc_row_rplc_n_r <= 64'd0;
+		else if(
+			EN_PERF_MON & 
+			(
+				(en_accelerator_r & en_pm_cnt_r & on_fm_sfc_row_rplc) | 
+				(regs_en & regs_wen & (regs_addr == 12))
+			)
+		)
+			fm_sfc_row_rplc_n_r <= # SIM_DELAY 
+				(regs_en & regs_wen & (regs_addr == 12)) ? 
+					64'd0:
+					(fm_sfc_row_rplc_n_r + 1'b1);
+	end
+	
+	// 卷积核交换区通道组重新加载次数
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			kbuf_sw_rgn_rplc_n_r <= 64'd0;
+		else if(
+			EN_PERF_MON & 
+			(
+				(en_accelerator_r & en_pm_cnt_r & on_kbuf_sw_rgn_rplc) | 
+				(regs_en & regs_wen & (regs_addr == 13))
+			)
+		)
+			kbuf_sw_rgn_rplc_n_r <= # SIM_DELAY 
+				(regs_en & regs_wen & (regs_addr == 13)) ? 
+					64'd0:
+					(kbuf_sw_rgn_rplc_n_r + 1'b1);
+	end
+	
+	/*
+	性能监测计数器快照
+	
+	向ctrl6[0]写1的下1个周期锁存全部性能监测计数器, 此后经pm_snap_lo/pm_snap_hi读取到的64位值来自同1个周期
+	快照读索引 -> 
+		0: 性能监测计数器(sts4)
+		1: 0号MM2S通道传输字节数(sts5)
+		2: 1号MM2S通道传输字节数(sts6)
+		3: S2MM通道传输字节数(sts7)
+		4: 已计算的特征图表面数(sts8)
+		5~10: pm0~pm5
+	*/
+	localparam integer PM_SNAP_N = 11; // 快照中的计数器个数
+	
+	wire[PM_SNAP_N*64-1:0] pm_snap_din; // 待锁存的性能监测计数器
+	reg[PM_SNAP_N*64-1:0] pm_snap_regs; // 性能监测计数器快照
+	wire[63:0] pm_snap_sel_dout; // 快照读索引所选的性能监测计数器快照
+	
+	assign pm_snap_din = {
+		kbuf_sw_rgn_rplc_n_r, fm_sfc_row_rplc_n_r, s2mm_bp_cyc_n_r, 
+		mac_stall_by_res_cyc_n_r, mac_wait_kernal_cyc_n_r, mac_wait_ftm_cyc_n_r, 
+		ftm_sfc_cal_n_r, s2mm_tsf_n_r, mm2s_ch1_tsf_n_r, mm2s_ch0_tsf_n_r, pm_cnt_r
+	};
+	assign pm_snap_sel_dout = 
+		(pm_snap_sel_r < PM_SNAP_N) ? 
+			pm_snap_regs[pm_snap_sel_r*64+:64]:
+			64'd0;
+	
+	// 性能监测计数器快照
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_regs <= {(PM_SNAP_N*64){1'b0}};
+		else if(EN_PERF_MON & pm_snap_r)
+			pm_snap_regs <= # SIM_DELAY pm_snap_din;
+	end
+	
+	/**
+	影子配置寄存器
+	
+	当ctrl5[0]为1时, 经AXI-Lite写配置寄存器(偏移地址>=0x90)只会写入影子配置寄存器组并置位对应的待提交标志, 
+	不影响正在运行的计算; 在3个请求生成单元与层描述符读取与执行单元均空闲时经AXI-Lite启动(向ctrl0[10:8]写非0值)时, 所有待提交的影子配置寄存器在同1个周期内被提交到配置寄存器
+	**/
+	localparam integer CFG_REGS_BASEADDR = 36; // 配置寄存器的起始偏移地址
+	
+	reg[31:0] shadow_cfg_regs[CFG_REGS_BASEADDR:REGS_N-1]; // 影子配置寄存器组
+	reg[REGS_N-1:CFG_REGS_BASEADDR] shadow_cfg_pending; // 影子配置寄存器待提交标志
+	wire shadow_cfg_wen; // 影子配置寄存器写使能
+	wire shadow_cfg_commit; // 提交影子配置寄存器(指示)
+	wire[REGS_N-1:CFG_REGS_BASEADDR] cfg_regs_upd; // 配置寄存器更新使能
+	wire[31:0] cfg_regs_upd_din[CFG_REGS_BASEADDR:REGS_N-1]; // 配置寄存器更新数据
+	
+	assign shadow_cfg_wen = 
+		regs_en & regs_wen & reg_cfg_sts[REG_CFG_STS_RW_REG] & shadow_cfg_wen_r & (regs_addr >= CFG_REGS_BASEADDR);
+	assign shadow_cfg_commit = 
+		regs_en & regs_wen & reg_cfg_sts[REG_CFG_STS_RW_REG] & (regs_addr == 16) & (|regs_din[10:8]) & 
+		kernal_access_blk_idle & fmap_access_blk_idle & fnl_res_trans_blk_idle & desc_chain_blk_idle;
+	
+	// 影子配置寄存器组
+	always @(posedge aclk)
+	begin
+		if(shadow_cfg_wen)
+			shadow_cfg_regs[regs_addr] <= # SIM_DELAY regs_din;
+	end
+	
+	genvar cfg_regs_i;
+	generate
+		for(cfg_regs_i = CFG_REGS_BASEADDR;cfg_regs_i < REGS_N;cfg_regs_i = cfg_regs_i + 1)
+		begin:shadow_cfg_blk
+			// 写配置寄存器时直接更新, 或在提交时由影子配置寄存器更新
+			assign cfg_regs_upd[cfg_regs_i] = 
+				(regs_en & regs_wen & (~shadow_cfg_wen) & (regs_addr == cfg_regs_i)) | 
+				(shadow_cfg_commit & shadow_cfg_pending[cfg_regs_i]);
+			assign cfg_regs_upd_din[cfg_regs_i] = 
+				shadow_cfg_commit ? 
+					shadow_cfg_regs[cfg_regs_i]:
+					regs_din;
+			
+			// 影子配置寄存器待提交标志
+			always @(posedge aclk or negedge aresetn)
+			begin
+				if(~aresetn)
+					shadow_cfg_pending[cfg_regs_i] <= 1'b0;
+				else if(shadow_cfg_commit | (shadow_cfg_wen & (regs_addr == cfg_regs_i)))
+					shadow_cfg_pending[cfg_regs_i] <= # SIM_DELAY ~shadow_cfg_commit;
+			end
+		end
+	endgenerate
+	
 	/**
 	寄存器(cal_cfg)
 	
@@ -839,14 +1411,14 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			calfmt_r <= 3'b111;
 		else if(
-			regs_en & regs_wen & (regs_addr == 36) & 
+			cfg_regs_upd[36] & 
 			(
-				((regs_din[2:0] == (CAL_FMT_INT8 | 3'b000)) & INT8_SUPPORTED) | 
-				((regs_din[2:0] == (CAL_FMT_INT16 | 3'b000)) & INT16_SUPPORTED) | 
-				((regs_din[2:0] == (CAL_FMT_FP16 | 3'b000)) & FP16_SUPPORTED)
+				((cfg_regs_upd_din[36][2:0] == (CAL_FMT_INT8 | 3'b000)) & INT8_SUPPORTED) | 
+				((cfg_regs_upd_din[36][2:0] == (CAL_FMT_INT16 | 3'b000)) & INT16_SUPPORTED) | 
+				((cfg_regs_upd_din[36][2:0] == (CAL_FMT_FP16 | 3'b000)) & FP16_SUPPORTED)
 			)
 		)
-			calfmt_r <= # SIM_DELAY regs_din[2:0];
+			calfmt_r <= # SIM_DELAY cfg_regs_upd_din[36][2:0];
 	end
 	
 	// 卷积垂直步长 - 1
@@ -855,10 +1427,10 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			conv_vertical_stride_r <= 3'd0;
 		else if(
-			regs_en & regs_wen & (regs_addr == 36) & 
-			((regs_din[10:8] == 3'd0) | LARGE_V_STRD_SUPPORTED)
+			cfg_regs_upd[36] & 
+			((cfg_regs_upd_din[36][10:8] == 3'd0) | LARGE_V_STRD_SUPPORTED)
 		)
-			conv_vertical_stride_r <= # SIM_DELAY regs_din[10:8];
+			conv_vertical_stride_r <= # SIM_DELAY cfg_regs_upd_din[36][10:8];
 	end
 	
 	// 卷积水平步长 - 1
@@ -867,17 +1439,17 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			conv_horizontal_stride_r <= 3'd0;
 		else if(
-			regs_en & regs_wen & (regs_addr == 36) & 
-			((regs_din[13:11] == 3'd0) | LARGE_H_STRD_SUPPORTED)
+			cfg_regs_upd[36] & 
+			((cfg_regs_upd_din[36][13:11] == 3'd0) | LARGE_H_STRD_SUPPORTED)
 		)
-			conv_horizontal_stride_r <= # SIM_DELAY regs_din[13:11];
+			conv_horizontal_stride_r <= # SIM_DELAY cfg_regs_upd_din[36][13:11];
 	end
 	
 	// 计算轮次 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 36))
-			cal_round_r <= # SIM_DELAY regs_din[19:16];
+		if(cfg_regs_upd[36])
+			cal_round_r <= # SIM_DELAY cfg_regs_upd_din[36][19:16];
 	end
 	
 	/**
@@ -907,35 +1479,35 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			is_grp_conv_mode_r <= 1'b0;
 		else if(
-			regs_en & regs_wen & (regs_addr == 40) & 
-			((~regs_din[0]) | GRP_CONV_SUPPORTED)
+			cfg_regs_upd[40] & 
+			((~cfg_regs_upd_din[40][0]) | GRP_CONV_SUPPORTED)
 		)
-			is_grp_conv_mode_r <= # SIM_DELAY regs_din[0];
+			is_grp_conv_mode_r <= # SIM_DELAY cfg_regs_upd_din[40][0];
 	end
 	
 	// (特征图)每组的数据量
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 40) & GRP_CONV_SUPPORTED)
-			data_size_foreach_group_r <= # SIM_DELAY regs_din[31:1];
+		if(cfg_regs_upd[40] & GRP_CONV_SUPPORTED)
+			data_size_foreach_group_r <= # SIM_DELAY cfg_regs_upd_din[40][31:1];
 	end
 	
 	// 每组的通道数/核数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 41) & GRP_CONV_SUPPORTED)
-			n_foreach_group_r <= # SIM_DELAY regs_din[15:0];
+		if(cfg_regs_upd[41] & GRP_CONV_SUPPORTED)
+			n_foreach_group_r <= # SIM_DELAY cfg_regs_upd_din[41][15:0];
 	end
 	
 	// 分组数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 41) & GRP_CONV_SUPPORTED)
-			group_n_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[41] & GRP_CONV_SUPPORTED)
+			group_n_r <= # SIM_DELAY cfg_regs_upd_din[41][31:16];
 	end
 	
 	/**
-	寄存器(fmap_cfg0, fmap_cfg1, fmap_cfg2, fmap_cfg3, fmap_cfg4, fmap_cfg5)
+	寄存器(fmap_cfg0, fmap_cfg1, fmap_cfg2, fmap_cfg3, fmap_cfg4, fmap_cfg5, fmap_cfg6, fmap_cfg7, fmap_cfg8, fmap_cfg9)
 	
 	--------------------------------------------------------------------------------------------------------
 	|fmap_cfg0 | 0xC0/48 |31~0: 输入特征图基地址         |      RW      |                                  |
@@ -951,12 +1523,26 @@ module reg_if_for_generic_conv #(
 	|          |         |5~3: 上部外填充数              |      RW      | 仅在支持外填充时, 写非0值生效    |
 	|          |         |8~6: 左右内填充数              |      RW      | 仅在支持内填充时, 写非0值生效    |
 	|          |         |11~9: 上下内填充数             |      RW      | 仅在支持内填充时, 写非0值生效    |
+	|          |         |12: 使能融合2x2最大池化        |      RW      | 仅当支持融合2x2最大池化时,       |
+	|          |         |                               |              | 写1生效                          |
 	|          |         |31~16: 扩展后特征图的垂直边界  |      RW      |                                  |
 	--------------------------------------------------------------------------------------------------------
 	|fmap_cfg5 | 0xD4/53 |1~0: 输出特征图数据大小类型    |      RW      |                                  |
 	|          |         |16~2: 输出特征图宽度 - 1       |      RW      |                                  |
 	|          |         |31~17: 输出特征图高度 - 1      |      RW      |                                  |
 	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg6 | 0xD8/54 |23~0: 输出特征图表面行跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg7 | 0xDC/55 |31~0: 输出特征图通道组跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg8 | 0xE0/56 |23~0: 输入特征图表面行跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg9 | 0xE4/57 |31~0: 输入特征图通道组跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	reg[31:0] ifmap_baseaddr_r; // 输入特征图基地址
 	reg[31:0] ofmap_baseaddr_r; // 输出特征图基地址
@@ -968,9 +1554,14 @@ module reg_if_for_generic_conv #(
 	reg[2:0] inner_padding_left_right_r; // 左右内填充数
 	reg[2:0] inner_padding_top_bottom_r; // 上下内填充数
 	reg[15:0] fmap_ext_i_bottom_r; // 扩展后特征图的垂直边界
+	reg en_fused_max_pool_r; // 使能融合2x2最大池化
 	reg[1:0] ofmap_data_type_r; // 输出特征图数据大小类型
 	reg[14:0] ofmap_w_r; // 输出特征图宽度 - 1
 	reg[14:0] ofmap_h_r; // 输出特征图高度 - 1
+	reg[23:0] ofmap_row_pitch_r; // 输出特征图表面行跨距
+	reg[31:0] ofmap_cgrp_pitch_r; // 输出特征图通道组跨距
+	reg[23:0] ifmap_row_pitch_r; // 输入特征图表面行跨距
+	reg[31:0] ifmap_cgrp_pitch_r; // 输入特征图通道组跨距
 	
 	assign ifmap_baseaddr = ifmap_baseaddr_r;
 	assign ofmap_baseaddr = ofmap_baseaddr_r;
@@ -997,40 +1588,46 @@ module reg_if_for_generic_conv #(
 	assign ofmap_w = ofmap_w_r | 16'h0000;
 	assign ofmap_h = ofmap_h_r | 16'h0000;
 	assign ofmap_data_type = ofmap_data_type_r;
+	assign en_fused_max_pool = 
+		FUSED_MAX_POOL_SUPPORTED & en_fused_max_pool_r;
+	assign ofmap_row_pitch = ofmap_row_pitch_r;
+	assign ofmap_cgrp_pitch = ofmap_cgrp_pitch_r;
+	assign ifmap_row_pitch = ifmap_row_pitch_r;
+	assign ifmap_cgrp_pitch = ifmap_cgrp_pitch_r;
 	
 	// 输入特征图基地址
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 48))
-			ifmap_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[48])
+			ifmap_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[48][31:0];
 	end
 	
 	// 输出特征图基地址
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 49))
-			ofmap_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[49])
+			ofmap_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[49][31:0];
 	end
 	
 	// 输入特征图宽度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 50))
-			ifmap_w_r <= # SIM_DELAY regs_din[15:0];
+		if(cfg_regs_upd[50])
+			ifmap_w_r <= # SIM_DELAY cfg_regs_upd_din[50][15:0];
 	end
 	
 	// 特征图通道数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 50))
-			fmap_chn_n_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[50])
+			fmap_chn_n_r <= # SIM_DELAY cfg_regs_upd_din[50][31:16];
 	end
 	
 	// 输入特征图大小 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 51))
-			ifmap_size_r <= # SIM_DELAY regs_din[23:0];
+		if(cfg_regs_upd[51])
+			ifmap_size_r <= # SIM_DELAY cfg_regs_upd_din[51][23:0];
 	end
 	
 	// 左部外填充数
@@ -1039,10 +1636,10 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			external_padding_left_r <= 3'd0;
 		else if(
-			regs_en & regs_wen & (regs_addr == 52) & 
-			((regs_din[2:0] == 3'd0) | EXT_PADDING_SUPPORTED)
+			cfg_regs_upd[52] & 
+			((cfg_regs_upd_din[52][2:0] == 3'd0) | EXT_PADDING_SUPPORTED)
 		)
-			external_padding_left_r <= # SIM_DELAY regs_din[2:0];
+			external_padding_left_r <= # SIM_DELAY cfg_regs_upd_din[52][2:0];
 	end
 	
 	// 上部外填充数
@@ -1051,10 +1648,10 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			external_padding_top_r <= 3'd0;
 		else if(
-			regs_en & regs_wen & (regs_addr == 52) & 
-			((regs_din[5:3] == 3'd0) | EXT_PADDING_SUPPORTED)
+			cfg_regs_upd[52] & 
+			((cfg_regs_upd_din[52][5:3] == 3'd0) | EXT_PADDING_SUPPORTED)
 		)
-			external_padding_top_r <= # SIM_DELAY regs_din[5:3];
+			external_padding_top_r <= # SIM_DELAY cfg_regs_upd_din[52][5:3];
 	end
 	
 	// 左右内填充数
@@ -1063,10 +1660,10 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			inner_padding_left_right_r <= 3'd0;
 		else if(
-			regs_en & regs_wen & (regs_addr == 52) & 
-			((regs_din[8:6] == 3'd0) | INNER_PADDING_SUPPORTED)
+			cfg_regs_upd[52] & 
+			((cfg_regs_upd_din[52][8:6] == 3'd0) | INNER_PADDING_SUPPORTED)
 		)
-			inner_padding_left_right_r <= # SIM_DELAY regs_din[8:6];
+			inner_padding_left_right_r <= # SIM_DELAY cfg_regs_upd_din[52][8:6];
 	end
 	
 	// 上下内填充数
@@ -1075,38 +1672,83 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			inner_padding_top_bottom_r <= 3'd0;
 		else if(
-			regs_en & regs_wen & (regs_addr == 52) & 
-			((regs_din[11:9] == 3'd0) | INNER_PADDING_SUPPORTED)
+			cfg_regs_upd[52] & 
+			((cfg_regs_upd_din[52][11:9] == 3'd0) | INNER_PADDING_SUPPORTED)
 		)
-			inner_padding_top_bottom_r <= # SIM_DELAY regs_din[11:9];
+			inner_padding_top_bottom_r <= # SIM_DELAY cfg_regs_upd_din[52][11:9];
 	end
 	
 	// 扩展后特征图的垂直边界
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 52))
-			fmap_ext_i_bottom_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[52])
+			fmap_ext_i_bottom_r <= # SIM_DELAY cfg_regs_upd_din[52][31:16];
+	end
+	
+	// 使能融合2x2最大池化
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			en_fused_max_pool_r <= 1'b0;
+		else if(cfg_regs_upd[52])
+			en_fused_max_pool_r <= # SIM_DELAY FUSED_MAX_POOL_SUPPORTED & cfg_regs_upd_din[52][12];
 	end
 	
 	// 输出特征图数据大小类型
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 53))
-			ofmap_data_type_r <= # SIM_DELAY regs_din[1:0];
+		if(cfg_regs_upd[53])
+			ofmap_data_type_r <= # SIM_DELAY cfg_regs_upd_din[53][1:0];
 	end
 	
 	// 输出特征图宽度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 53))
-			ofmap_w_r <= # SIM_DELAY regs_din[16:2];
+		if(cfg_regs_upd[53])
+			ofmap_w_r <= # SIM_DELAY cfg_regs_upd_din[53][16:2];
 	end
 	
 	// 输出特征图高度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 53))
-			ofmap_h_r <= # SIM_DELAY regs_din[31:17];
+		if(cfg_regs_upd[53])
+			ofmap_h_r <= # SIM_DELAY cfg_regs_upd_din[53][31:17];
+	end
+	
+	// 输出特征图表面行跨距
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ofmap_row_pitch_r <= 24'h000000;
+		else if(cfg_regs_upd[54])
+			ofmap_row_pitch_r <= # SIM_DELAY cfg_regs_upd_din[54][23:0];
+	end
+	
+	// 输出特征图通道组跨距
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ofmap_cgrp_pitch_r <= 32'h0000_0000;
+		else if(cfg_regs_upd[55])
+			ofmap_cgrp_pitch_r <= # SIM_DELAY cfg_regs_upd_din[55][31:0];
+	end
+	
+	// 输入特征图表面行跨距
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ifmap_row_pitch_r <= 24'h000000;
+		else if(cfg_regs_upd[56])
+			ifmap_row_pitch_r <= # SIM_DELAY cfg_regs_upd_din[56][23:0];
+	end
+	
+	// 输入特征图通道组跨距
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ifmap_cgrp_pitch_r <= 32'h0000_0000;
+		else if(cfg_regs_upd[57])
+			ifmap_cgrp_pitch_r <= # SIM_DELAY cfg_regs_upd_din[57][31:0];
 	end
 	
 	/**
@@ -1156,15 +1798,15 @@ module reg_if_for_generic_conv #(
 	// 卷积核权重基地址
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 64))
-			kernal_wgt_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[64])
+			kernal_wgt_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[64][31:0];
 	end
 	
 	// 卷积核形状
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 65))
-			kernal_shape_r <= # SIM_DELAY regs_din[3:0];
+		if(cfg_regs_upd[65])
+			kernal_shape_r <= # SIM_DELAY cfg_regs_upd_din[65][3:0];
 	end
 	
 	// 膨胀量
@@ -1173,45 +1815,45 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			kernal_dilation_n_r <= 4'd0;
 		else if(
-			regs_en & regs_wen & (regs_addr == 65) & 
-			((regs_din[7:4] == 4'd0) | KERNAL_DILATION_SUPPORTED)
+			cfg_regs_upd[65] & 
+			((cfg_regs_upd_din[65][7:4] == 4'd0) | KERNAL_DILATION_SUPPORTED)
 		)
-			kernal_dilation_n_r <= # SIM_DELAY regs_din[7:4];
+			kernal_dilation_n_r <= # SIM_DELAY cfg_regs_upd_din[65][7:4];
 	end
 	
 	// (膨胀后)卷积核边长 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 65))
-			kernal_len_dilated_r <= # SIM_DELAY regs_din[15:8];
+		if(cfg_regs_upd[65])
+			kernal_len_dilated_r <= # SIM_DELAY cfg_regs_upd_din[65][15:8];
 	end
 	
 	// 每个核组的通道组数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 65))
-			cgrpn_foreach_kernal_set_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[65])
+			cgrpn_foreach_kernal_set_r <= # SIM_DELAY cfg_regs_upd_din[65][31:16];
 	end
 	
 	// 核数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 66))
-			kernal_num_n_r <= # SIM_DELAY regs_din[15:0];
+		if(cfg_regs_upd[66])
+			kernal_num_n_r <= # SIM_DELAY cfg_regs_upd_din[66][15:0];
 	end
 	
 	// 核组个数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 66))
-			kernal_set_n_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[66])
+			kernal_set_n_r <= # SIM_DELAY cfg_regs_upd_din[66][31:16];
 	end
 	
 	// 权重块最大宽度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 67))
-			max_wgtblk_w_r <= # SIM_DELAY regs_din[7:0];
+		if(cfg_regs_upd[67])
+			max_wgtblk_w_r <= # SIM_DELAY cfg_regs_upd_din[67][7:0];
 	end
 	
 	/**
@@ -1250,54 +1892,54 @@ module reg_if_for_generic_conv #(
 	// 分配给特征图缓存的Bank数
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 80))
-			fmbufbankn_r <= # SIM_DELAY regs_din[15:0];
+		if(cfg_regs_upd[80])
+			fmbufbankn_r <= # SIM_DELAY cfg_regs_upd_din[80][15:0];
 	end
 	
 	// 每个表面行的表面个数类型
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 81))
-			fmbufcoln_r <= # SIM_DELAY regs_din[3:0];
+		if(cfg_regs_upd[81])
+			fmbufcoln_r <= # SIM_DELAY cfg_regs_upd_din[81][3:0];
 	end
 	
 	// 可缓存的表面行数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 81))
-			fmbufrown_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[81])
+			fmbufrown_r <= # SIM_DELAY cfg_regs_upd_din[81][31:16];
 	end
 	
 	// 每个权重块的表面个数的类型
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 82))
-			sfc_n_each_wgtblk_r <= # SIM_DELAY regs_din[3:0];
+		if(cfg_regs_upd[82])
+			sfc_n_each_wgtblk_r <= # SIM_DELAY cfg_regs_upd_din[82][3:0];
 	end
 	
 	// 可缓存的通道组数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 82))
-			kbufgrpn_r <= # SIM_DELAY regs_din[23:8];
+		if(cfg_regs_upd[82])
+			kbufgrpn_r <= # SIM_DELAY cfg_regs_upd_din[82][23:8];
 	end
 	
 	// 每个输出特征图表面行的中间结果项数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 83))
-			mid_res_item_n_foreach_row_r <= # SIM_DELAY regs_din[15:0];
+		if(cfg_regs_upd[83])
+			mid_res_item_n_foreach_row_r <= # SIM_DELAY cfg_regs_upd_din[83][15:0];
 	end
 	
 	// 可缓存行数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 83))
-			mid_res_buf_row_n_bufferable_r <= # SIM_DELAY regs_din[23:16];
+		if(cfg_regs_upd[83])
+			mid_res_buf_row_n_bufferable_r <= # SIM_DELAY cfg_regs_upd_din[83][23:16];
 	end
 	
 	/**
-	寄存器(bn_cfg, act_cfg0, act_cfg1)
+	寄存器(bn_cfg, act_cfg0, act_cfg1, res_cfg0, res_cfg1)
 	
 	--------------------------------------------------------------------------------------------------------
 	| bn_cfg   |0x180/96 |0: 启用BN单元                  |      RW      | 仅当支持批归一化处理时, 写1生效  |
@@ -1307,6 +1949,10 @@ module reg_if_for_generic_conv #(
 	|          |         |    参数A的实际值是否为1       |              | 该字段可用                       |
 	|          |         |17: 批归一化                   |      RW      | 仅当支持批归一化处理时,          |
 	|          |         |    参数B的实际值是否为0       |              | 该字段可用                       |
+	|          |         |18: 使能INT8逐通道重量化       |      RW      | 仅当支持批归一化处理和INT8时,    |
+	|          |         |                               |              | 写1生效                          |
+	|          |         |27~24: 输出舍入单元的          |      RW      | 仅当运算数据格式为INT16或INT8时, |
+	|          |         |       定点数量化精度          |              | 该字段可用                       |
 	--------------------------------------------------------------------------------------------------------
 	| act_cfg0 |0x184/97 |2~0: 激活函数类型              |      RW      | 设置支持的激活函数类型时生效     |
 	|          |         |12~8:(泄露Relu激活参数)        |      RW      | 仅当支持Leaky-Relu激活时,        |
@@ -1317,21 +1963,38 @@ module reg_if_for_generic_conv #(
 	| act_cfg1 |0x188/98 |31~0: 泄露Relu激活参数         |      RW      | 仅当支持Leaky-Relu激活时,        |
 	|          |         |                               |              | 该字段可用                       |
 	--------------------------------------------------------------------------------------------------------
+	| res_cfg0 |0x18C/99 | 0: 使能残差相加               |      RW      | 仅当支持残差相加时, 写1生效      |
+	|          |         | 1: 残差相加后做Relu           |      RW      | 仅当支持残差相加时,              |
+	|          |         |                               |              | 该字段可用                       |
+	|          |         |13~8: 残差缩放系数的指数       |      RW      | 仅当支持残差相加时,              |
+	|          |         |      (有符号数)               |              | 该字段可用                       |
+	--------------------------------------------------------------------------------------------------------
+	| res_cfg1 |0x190/100|31~0: 残差特征图基地址         |      RW      | 仅当支持残差相加时,              |
+	|          |         |                               |              | 该字段可用                       |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	reg use_bn_unit_r; // 启用BN单元
 	reg[4:0] bn_fixed_point_quat_accrc_r; // (批归一化操作数A)定点数量化精度
 	reg bn_is_a_eq_1_r; // 批归一化参数A的实际值为1(标志)
 	reg bn_is_b_eq_0_r; // 批归一化参数B的实际值为0(标志)
+	reg en_int8_requant_r; // 使能INT8逐通道重量化
+	reg[3:0] out_fixed_point_quat_accrc_r; // 输出舍入单元的定点数量化精度
 	reg[2:0] act_func_type_r; // 激活函数类型
 	reg[4:0] leaky_relu_fixed_point_quat_accrc_r; // (泄露Relu激活参数)定点数量化精度
 	reg[4:0] sigmoid_tanh_fixed_point_quat_accrc_r; // (Sigmoid或Tanh输入)定点数量化精度
 	reg[31:0] leaky_relu_param_alpha_r; // 泄露Relu激活参数
+	reg en_residual_add_r; // 使能残差相加
+	reg residual_relu_r; // 残差相加后做Relu
+	reg[5:0] residual_scale_exp_r; // 残差缩放系数的指数(有符号数)
+	reg[31:0] residual_baseaddr_r; // 残差特征图基地址
 	
 	assign use_bn_unit = BN_SUPPORTED & use_bn_unit_r;
 	
 	assign bn_fixed_point_quat_accrc = bn_fixed_point_quat_accrc_r;
 	assign bn_is_a_eq_1 = bn_is_a_eq_1_r;
 	assign bn_is_b_eq_0 = bn_is_b_eq_0_r;
+	assign en_int8_requant = BN_SUPPORTED & INT8_SUPPORTED & en_int8_requant_r;
+	assign out_fixed_point_quat_accrc = out_fixed_point_quat_accrc_r;
 	
 	assign act_func_type = 
 		(LEAKY_RELU_SUPPORTED & (act_func_type_r == ACT_FUNC_TYPE_LEAKY_RELU)) ? ACT_FUNC_TYPE_LEAKY_RELU:
@@ -1342,32 +2005,53 @@ module reg_if_for_generic_conv #(
 	assign sigmoid_tanh_fixed_point_quat_accrc = sigmoid_tanh_fixed_point_quat_accrc_r;
 	assign leaky_relu_param_alpha = leaky_relu_param_alpha_r;
 	
+	assign en_residual_add = RESIDUAL_ADD_SUPPORTED & en_residual_add_r;
+	assign residual_relu = residual_relu_r;
+	assign residual_scale_exp = residual_scale_exp_r;
+	assign residual_baseaddr = residual_baseaddr_r;
+	
 	// 启用BN单元
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 96))
-			use_bn_unit_r <= # SIM_DELAY BN_SUPPORTED & regs_din[0];
+		if(cfg_regs_upd[96])
+			use_bn_unit_r <= # SIM_DELAY BN_SUPPORTED & cfg_regs_upd_din[96][0];
 	end
 	
 	// (批归一化操作数A)定点数量化精度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 96) & BN_SUPPORTED)
-			bn_fixed_point_quat_accrc_r <= # SIM_DELAY regs_din[12:8];
+		if(cfg_regs_upd[96] & BN_SUPPORTED)
+			bn_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[96][12:8];
 	end
 	
 	// 批归一化参数A的实际值为1(标志)
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 96) & BN_SUPPORTED)
-			bn_is_a_eq_1_r <= # SIM_DELAY regs_din[16];
+		if(cfg_regs_upd[96] & BN_SUPPORTED)
+			bn_is_a_eq_1_r <= # SIM_DELAY cfg_regs_upd_din[96][16];
 	end
 	
 	// 批归一化参数B的实际值为0(标志)
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 96) & BN_SUPPORTED)
-			bn_is_b_eq_0_r <= # SIM_DELAY regs_din[17];
+		if(cfg_regs_upd[96] & BN_SUPPORTED)
+			bn_is_b_eq_0_r <= # SIM_DELAY cfg_regs_upd_din[96][17];
+	end
+	
+	// 使能INT8逐通道重量化
+	always @(posedge aclk)
+	begin
+		if(cfg_regs_upd[96])
+			en_int8_requant_r <= # SIM_DELAY BN_SUPPORTED & INT8_SUPPORTED & cfg_regs_upd_din[96][18];
+	end
+	
+	// 输出舍入单元的定点数量化精度
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			out_fixed_point_quat_accrc_r <= 4'd0;
+		else if(cfg_regs_upd[96])
+			out_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[96][27:24];
 	end
 	
 	// 激活函数类型
@@ -1376,42 +2060,124 @@ module reg_if_for_generic_conv #(
 		if(~aresetn)
 			act_func_type_r <= ACT_FUNC_TYPE_NONE;
 		else if(
-			regs_en & regs_wen & (regs_addr == 97) & 
+			cfg_regs_upd[97] & 
 			(
-				(regs_din[2:0] == ACT_FUNC_TYPE_NONE) | 
-				((regs_din[2:0] == ACT_FUNC_TYPE_LEAKY_RELU) & LEAKY_RELU_SUPPORTED) | 
-				((regs_din[2:0] == ACT_FUNC_TYPE_SIGMOID) & SIGMOID_SUPPORTED) | 
-				((regs_din[2:0] == ACT_FUNC_TYPE_TANH) & TANH_SUPPORTED)
+				(cfg_regs_upd_din[97][2:0] == ACT_FUNC_TYPE_NONE) | 
+				((cfg_regs_upd_din[97][2:0] == ACT_FUNC_TYPE_LEAKY_RELU) & LEAKY_RELU_SUPPORTED) | 
+				((cfg_regs_upd_din[97][2:0] == ACT_FUNC_TYPE_SIGMOID) & SIGMOID_SUPPORTED) | 
+				((cfg_regs_upd_din[97][2:0] == ACT_FUNC_TYPE_TANH) & TANH_SUPPORTED)
 			)
 		)
-			act_func_type_r <= # SIM_DELAY regs_din[2:0];
+			act_func_type_r <= # SIM_DELAY cfg_regs_upd_din[97][2:0];
 	end
 	
 	// (泄露Relu激活参数)定点数量化精度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 97) & LEAKY_RELU_SUPPORTED)
-			leaky_relu_fixed_point_quat_accrc_r <= # SIM_DELAY regs_din[12:8];
+		if(cfg_regs_upd[97] & LEAKY_RELU_SUPPORTED)
+			leaky_relu_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[97][12:8];
 	end
 	
 	// (Sigmoid或Tanh输入)定点数量化精度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 97) & (SIGMOID_SUPPORTED | TANH_SUPPORTED))
-			sigmoid_tanh_fixed_point_quat_accrc_r <= # SIM_DELAY regs_din[20:16];
+		if(cfg_regs_upd[97] & (SIGMOID_SUPPORTED | TANH_SUPPORTED))
+			sigmoid_tanh_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[97][20:16];
 	end
 	
 	// 泄露Relu激活参数
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 98) & LEAKY_RELU_SUPPORTED)
-			leaky_relu_param_alpha_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[98] & LEAKY_RELU_SUPPORTED)
+			leaky_relu_param_alpha_r <= # SIM_DELAY cfg_regs_upd_din[98][31:0];
 	end
 	
+	// 使能残差相加
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			en_residual_add_r <= 1'b0;
+		else if(cfg_regs_upd[99])
+			en_residual_add_r <= # SIM_DELAY RESIDUAL_ADD_SUPPORTED & cfg_regs_upd_din[99][0];
+	end
+	
+	// 残差相加后做Relu
+	always @(posedge aclk)
+	begin
+		if(cfg_regs_upd[99] & RESIDUAL_ADD_SUPPORTED)
+			residual_relu_r <= # SIM_DELAY cfg_regs_upd_din[99][1];
+	end
+	
+	// 残差缩放系数的指数
+	always @(posedge aclk)
+	begin
+		if(cfg_regs_upd[99] & RESIDUAL_ADD_SUPPORTED)
+			residual_scale_exp_r <= # SIM_DELAY cfg_regs_upd_din[99][13:8];
+	end
+	
+	// 残差特征图基地址
+	always @(posedge aclk)
+	begin
+		if(cfg_regs_upd[100] & RESIDUAL_ADD_SUPPORTED)
+			residual_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[100][31:0];
+	end
+	
+	/**
+	寄存器(spa_cfg0, spa_cfg1~8)
+	
+	--------------------------------------------------------------------------------------------------------
+	| spa_cfg0 |0x1C0/112| 0: 使能零通道组跳过           |      RW      |                                  |
+	|          |         |25~16: 非零通道组数 - 1       |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| spa_cfg1 |0x1C4/113|31~0: 零通道组位图[31:0]       |      RW      | 第i位为1表示通道组i的权重全为0   |
+	--------------------------------------------------------------------------------------------------------
+	|   ...    |   ...   |             ...               |     ...      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| spa_cfg8 |0x1E0/120|31~0: 零通道组位图[255:224]    |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	**/
+	reg en_zero_cgrp_skip_r; // 使能零通道组跳过
+	reg[9:0] zero_cgrp_skip_vld_cgrpn_r; // 非零通道组数 - 1
+	reg[ZERO_CGRP_MAP_LEN-1:0] zero_cgrp_map_r; // 零通道组位图
+	
+	assign en_zero_cgrp_skip = en_zero_cgrp_skip_r;
+	assign zero_cgrp_skip_vld_cgrpn = zero_cgrp_skip_vld_cgrpn_r;
+	assign zero_cgrp_map = zero_cgrp_map_r;
+	
+	// 使能零通道组跳过
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			en_zero_cgrp_skip_r <= 1'b0;
+		else if(cfg_regs_upd[112])
+			en_zero_cgrp_skip_r <= # SIM_DELAY cfg_regs_upd_din[112][0];
+	end
+	
+	// 非零通道组数 - 1
+	always @(posedge aclk)
+	begin
+		if(cfg_regs_upd[112])
+			zero_cgrp_skip_vld_cgrpn_r <= # SIM_DELAY cfg_regs_upd_din[112][25:16];
+	end
+	
+	// 零通道组位图
+	genvar zero_cgrp_map_i;
+	generate
+		for(zero_cgrp_map_i = 0;zero_cgrp_map_i < ZERO_CGRP_MAP_LEN/32;zero_cgrp_map_i = zero_cgrp_map_i + 1)
+		begin:zero_cgrp_map_blk
+			always @(posedge aclk)
+			begin
+				if(cfg_regs_upd[113+zero_cgrp_map_i])
+					zero_cgrp_map_r[zero_cgrp_map_i*32+31:zero_cgrp_map_i*32] <= # SIM_DELAY 
+						cfg_regs_upd_din[113+zero_cgrp_map_i][31:0];
+			end
+		end
+	endgenerate
+	
 	/** 寄存器读结果 **/
 	always @(posedge aclk)
 	begin
-		if(regs_en & (~is_write))
+		if(regs_en & (~regs_wen))
 		begin
 			case(regs_addr)
 				0: regs_dout <= # SIM_DELAY {version_r[31:0]};
@@ -1421,9 +2187,23 @@ module reg_if_for_generic_conv #(
 				4: regs_dout <= # SIM_DELAY {max_fmbuf_rown_r[15:0], phy_buf_bank_depth_r[15:0]};
 				5: regs_dout <= # SIM_DELAY {mid_res_buf_bank_depth_r[15:0], mid_res_buf_bank_n_r[15:0]};
 				6: regs_dout <= # SIM_DELAY {max_kernal_n_r[15:0], 8'd0, bn_act_prl_n_r[7:0]};
-				7: regs_dout <= # SIM_DELAY {8'd0, 8'd0, 8'd0, 4'd0, mid_res_buf_clk_rate_r[3:0]};
+				7: regs_dout <= # SIM_DELAY {fused_max_pool_buf_depth_r[15:0], 1'b0, zero_cgrp_skip_supported_r, int8_requant_supported_r, ifmap_pitch_supported_r, ofmap_pitch_supported_r, residual_add_supported_r, fused_max_pool_supported_r, layer_desc_supported_r, 4'd0, mid_res_buf_clk_rate_r[3:0]};
+				
+				8: regs_dout <= # SIM_DELAY {mac_wait_ftm_cyc_n_r[31:0]};
+				9: regs_dout <= # SIM_DELAY {mac_wait_kernal_cyc_n_r[31:0]};
+				10: regs_dout <= # SIM_DELAY {mac_stall_by_res_cyc_n_r[31:0]};
+				11: regs_dout <= # SIM_DELAY {s2mm_bp_cyc_n_r[31:0]};
+				12: regs_dout <= # SIM_DELAY {fm_sfc_row_rplc_n_r[31:0]};
+				13: regs_dout <= # SIM_DELAY {kbuf_sw_rgn_rplc_n_r[31:0]};
+				14: regs_dout <= # SIM_DELAY {pm_snap_sel_dout[31:0]};
+				15: regs_dout <= # SIM_DELAY {pm_snap_sel_dout[63:32]};
 				
 				16: regs_dout <= # SIM_DELAY {28'd0, en_bn_act_proc_r, en_pm_cnt_r, en_cal_sub_sys_r, en_accelerator_r};
+				17: regs_dout <= # SIM_DELAY {31'd0, en_done_irq_r};
+				18: regs_dout <= # SIM_DELAY {done_irq_s2mm_cmd_n_th_r[31:0]};
+				20: regs_dout <= # SIM_DELAY {desc_chain_baseaddr_r[31:0]};
+				21: regs_dout <= # SIM_DELAY {30'd0, |shadow_cfg_pending, shadow_cfg_wen_r};
+				22: regs_dout <= # SIM_DELAY {20'd0, pm_snap_sel_r[3:0], 8'd0};
 				
 				24: regs_dout <= # SIM_DELAY {29'd0, fnl_res_trans_blk_idle_r, fmap_access_blk_idle_r, kernal_access_blk_idle_r};
 				25: regs_dout <= # SIM_DELAY {dma_mm2s_0_fns_cmd_n_r[31:0]};
@@ -1434,6 +2214,9 @@ module reg_if_for_generic_conv #(
 				30: regs_dout <= # SIM_DELAY {mm2s_ch1_tsf_n_r[31:0]};
 				31: regs_dout <= # SIM_DELAY {s2mm_tsf_n_r[31:0]};
 				32: regs_dout <= # SIM_DELAY {ftm_sfc_cal_n_r[31:0]};
+				33: regs_dout <= # SIM_DELAY {31'd0, done_irq_pending_r};
+				34: regs_dout <= # SIM_DELAY {31'd0, desc_chain_blk_idle_r};
+				35: regs_dout <= # SIM_DELAY {desc_layer_fns_n_r[31:0]};
 				
 				36: regs_dout <= # SIM_DELAY {
 					12'd0, cal_round_r[3:0], 2'b00, conv_horizontal_stride_r[2:0], conv_vertical_stride_r[2:0], 5'd0, calfmt_r[2:0]
@@ -1452,6 +2235,10 @@ module reg_if_for_generic_conv #(
 					external_padding_top_r[2:0], external_padding_left_r[2:0]
 				};
 				53: regs_dout <= # SIM_DELAY {ofmap_h_r[14:0], ofmap_w_r[14:0], ofmap_data_type_r[1:0]};
+				54: regs_dout <= # SIM_DELAY {8'h00, ofmap_row_pitch_r[23:0]};
+				55: regs_dout <= # SIM_DELAY {ofmap_cgrp_pitch_r[31:0]};
+				56: regs_dout <= # SIM_DELAY {8'h00, ifmap_row_pitch_r[23:0]};
+				57: regs_dout <= # SIM_DELAY {ifmap_cgrp_pitch_r[31:0]};
 				
 				64: regs_dout <= # SIM_DELAY {kernal_wgt_baseaddr_r[31:0]};
 				65: regs_dout <= # SIM_DELAY {
@@ -1467,7 +2254,7 @@ module reg_if_for_generic_conv #(
 				83: regs_dout <= # SIM_DELAY {8'h00, mid_res_buf_row_n_bufferable_r[7:0], mid_res_item_n_foreach_row_r[15:0]};
 				
 				96: regs_dout <= # SIM_DELAY 
-					{8'h00, 6'd0, bn_is_b_eq_0_r, bn_is_a_eq_1_r, 3'b000, bn_fixed_point_quat_accrc_r[4:0], 7'd0, use_bn_unit_r};
+					{4'h0, out_fixed_point_quat_accrc_r[3:0], 5'd0, en_int8_requant_r, bn_is_b_eq_0_r, bn_is_a_eq_1_r, 3'b000, bn_fixed_point_quat_accrc_r[4:0], 7'd0, use_bn_unit_r};
 				97: regs_dout <= # SIM_DELAY {
 					8'h00,
 					3'b000, sigmoid_tanh_fixed_point_quat_accrc_r[4:0],
@@ -1475,6 +2262,18 @@ module reg_if_for_generic_conv #(
 					5'd0, act_func_type_r[2:0]
 				};
 				98: regs_dout <= # SIM_DELAY {leaky_relu_param_alpha_r[31:0]};
+				99: regs_dout <= # SIM_DELAY {18'd0, residual_scale_exp_r[5:0], 6'd0, residual_relu_r, en_residual_add_r};
+				100: regs_dout <= # SIM_DELAY {residual_baseaddr_r[31:0]};
+				
+				112: regs_dout <= # SIM_DELAY {6'd0, zero_cgrp_skip_vld_cgrpn_r[9:0], 15'd0, en_zero_cgrp_skip_r};
+				113: regs_dout <= # SIM_DELAY {zero_cgrp_map_r[31:0]};
+				114: regs_dout <= # SIM_DELAY {zero_cgrp_map_r[63:32]};
+				115: regs_dout <= # SIM_DELAY {zero_cgrp_map_r[95:64]};
+				116: regs_dout <= # SIM_DELAY {zero_cgrp_map_r[127:96]};
+				117: regs_dout <= # SIM_DELAY {zero_cgrp_map_r[159:128]};
+				118: regs_dout <= # SIM_DELAY {zero_cgrp_map_r[191:160]};
+				119: regs_dout <= # SIM_DELAY {zero_cgrp_map_r[223:192]};
+				120: regs_dout <= # SIM_DELAY {zero_cgrp_map_r[255:224]};
 				
 				default: regs_dout <= # SIM_DELAY 32'h0000_0000;
 			endcase
@@ -0,0 +1,125 @@
+/************************************************************************************************************************
+测试平台共享浮点转换库(DPI函数)
+@brief  供SV记分板一次转换整个数组的DPI函数; 逐值转换和批量转换由共享浮点转换库(software/common/panda_fp.c)提供,
+        逐值转换函数(encode_fp16/decode_fp16/encode_fp32/decode_fp32)也可直接作为DPI函数导入
+        各测试平台的fp.c直接包含本文件, 不再各自复制转换函数
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.17 1.01 用memcpy代替指针类型双关(开启优化时违反严格别名规则)
+        2026.10.17 1.02 逐值转换和批量转换迁移到software/common/panda_fp.c, 本文件只保留DPI函数
+************************************************************************************************************************/
+
+#include "svdpi.h"
+
+#include "../../software/common/panda_fp.c"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// DPI批量转换的分段长度
+#define PANDA_FP_DPI_CHUNK_LEN 256
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+在SV中导入:
+	import "DPI-C" function void encode_fp16_arr(input real d[], output int unsigned fp16[]);
+	import "DPI-C" function void decode_fp16_arr(input int unsigned fp16[], output real d[]);
+	import "DPI-C" function void encode_fp32_arr(input real d[], output int unsigned fp32[]);
+	import "DPI-C" function void decode_fp32_arr(input int unsigned fp32[], output real d[]);
+
+转换长度取两个数组长度的较小值; 仿真器不提供连续存储的数组指针时逐元素访问
+*/
+
+static uint32_t panda_fp_dpi_len(const svOpenArrayHandle a, const svOpenArrayHandle b) {
+	int len_a = svSize(a, 1);
+	int len_b = svSize(b, 1);
+
+	return (uint32_t)((len_a < len_b) ? len_a:len_b);
+}
+
+static void* panda_fp_dpi_elem(const svOpenArrayHandle h, uint32_t i) {
+	return svGetArrElemPtr1(h, svLow(h, 1) + (int)i);
+}
+
+void encode_fp16_arr(const svOpenArrayHandle d, const svOpenArrayHandle fp16) {
+	uint32_t n = panda_fp_dpi_len(d, fp16);
+	const double* src = (const double*)svGetArrayPtr(d);
+	uint32_t* dst = (uint32_t*)svGetArrayPtr(fp16);
+	uint16_t buf[PANDA_FP_DPI_CHUNK_LEN];
+
+	if(src == NULL || dst == NULL){
+		for(uint32_t i = 0;i < n;i++){
+			*((uint32_t*)panda_fp_dpi_elem(fp16, i)) = encode_fp16(*((const double*)panda_fp_dpi_elem(d, i)));
+		}
+
+		return;
+	}
+
+	for(uint32_t i = 0;i < n;i += PANDA_FP_DPI_CHUNK_LEN){
+		uint32_t len = ((n - i) > PANDA_FP_DPI_CHUNK_LEN) ? PANDA_FP_DPI_CHUNK_LEN:(n - i);
+
+		panda_fp_encode_fp16_bulk(src + i, buf, len);
+
+		for(uint32_t j = 0;j < len;j++){
+			dst[i + j] = buf[j];
+		}
+	}
+}
+
+void decode_fp16_arr(const svOpenArrayHandle fp16, const svOpenArrayHandle d) {
+	uint32_t n = panda_fp_dpi_len(fp16, d);
+	const uint32_t* src = (const uint32_t*)svGetArrayPtr(fp16);
+	double* dst = (double*)svGetArrayPtr(d);
+	uint16_t buf[PANDA_FP_DPI_CHUNK_LEN];
+
+	if(src == NULL || dst == NULL){
+		for(uint32_t i = 0;i < n;i++){
+			*((double*)panda_fp_dpi_elem(d, i)) = decode_fp16(*((const uint32_t*)panda_fp_dpi_elem(fp16, i)));
+		}
+
+		return;
+	}
+
+	for(uint32_t i = 0;i < n;i += PANDA_FP_DPI_CHUNK_LEN){
+		uint32_t len = ((n - i) > PANDA_FP_DPI_CHUNK_LEN) ? PANDA_FP_DPI_CHUNK_LEN:(n - i);
+
+		for(uint32_t j = 0;j < len;j++){
+			buf[j] = (uint16_t)src[i + j];
+		}
+
+		panda_fp_decode_fp16_bulk(buf, dst + i, len);
+	}
+}
+
+void encode_fp32_arr(const svOpenArrayHandle d, const svOpenArrayHandle fp32) {
+	uint32_t n = panda_fp_dpi_len(d, fp32);
+	const double* src = (const double*)svGetArrayPtr(d);
+	uint32_t* dst = (uint32_t*)svGetArrayPtr(fp32);
+
+	if(src == NULL || dst == NULL){
+		for(uint32_t i = 0;i < n;i++){
+			*((uint32_t*)panda_fp_dpi_elem(fp32, i)) = encode_fp32(*((const double*)panda_fp_dpi_elem(d, i)));
+		}
+
+		return;
+	}
+
+	panda_fp_encode_fp32_bulk(src, dst, n);
+}
+
+void decode_fp32_arr(const svOpenArrayHandle fp32, const svOpenArrayHandle d) {
+	uint32_t n = panda_fp_dpi_len(fp32, d);
+	const uint32_t* src = (const uint32_t*)svGetArrayPtr(fp32);
+	double* dst = (double*)svGetArrayPtr(d);
+
+	if(src == NULL || dst == NULL){
+		for(uint32_t i = 0;i < n;i++){
+			*((double*)panda_fp_dpi_elem(d, i)) = decode_fp32(*((const uint32_t*)panda_fp_dpi_elem(fp32, i)));
+		}
+
+		return;
+	}
+
+	panda_fp_decode_fp32_bulk(src, dst, n);
+}
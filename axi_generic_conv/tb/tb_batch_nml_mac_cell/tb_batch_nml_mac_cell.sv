@@ -9,6 +9,8 @@ module tb_batch_nml_mac_cell();
 	import "DPI-C" function real decode_fp16(input int unsigned fp16);
 	import "DPI-C" function real decode_fp32(input int unsigned fp32);
 	import "DPI-C" function real get_fixed36_exp(input longint frac, input int exp);
+	import "DPI-C" function int unsigned int8_requant_param_b(input int shift, input int zp, input int out_min, input int out_max);
+	import "DPI-C" function int int8_requant(input int a, input int x, input int unsigned b);
 	
 	/** 常量 **/
 	// 运算数据格式的编码
@@ -17,12 +19,14 @@ module tb_batch_nml_mac_cell();
 	localparam BN_CAL_FMT_FP32 = 2'b10;
 	
 	/** 配置参数 **/
-	localparam INT16_SUPPORTED = 1'b0; // 是否支持INT16运算数据格式
+	localparam INT16_SUPPORTED = 1'b1; // 是否支持INT16运算数据格式
 	localparam INT32_SUPPORTED = 1'b1; // 是否支持INT32运算数据格式
 	localparam FP32_SUPPORTED = 1'b1; // 是否支持FP32运算数据格式
 	localparam integer INFO_ALONG_WIDTH = 2; // 随路数据的位宽
 	localparam logic[1:0] bn_calfmt = BN_CAL_FMT_FP32; // 运算数据格式
 	localparam logic[4:0] fixed_point_quat_accrc = 5'd1; // 定点数量化精度
+	localparam bit en_int8_requant = 1'b0; // 是否测试INT8逐通道重量化(运算数据格式须为INT16)
+	localparam int unsigned REQUANT_RAND_N = 1000; // INT8逐通道重量化的随机测试数据个数
 	localparam real clk_p = 10.0; // 时钟周期
 	localparam real simulation_delay = 1.0; // 仿真延时
 	
@@ -139,6 +143,109 @@ module tb_batch_nml_mac_cell();
 			@(posedge clk);
 	endtask
 	
+	/**
+	INT8逐通道重量化的激励与检查
+	
+	操作数B由驱动的axi_generic_conv_set_bn_requant_param生成,
+	期望结果由驱动的axi_generic_conv_cal_requant(离线量化工具使用的同一实现)计算,
+	覆盖舍入位(正负数的0.5, shift = 0, shift = 63)、32位饱和、零点和[out_min, out_max]限制
+	**/
+	int requant_exp_q[$]; // 期望的重量化结果
+	int unsigned requant_in_n; // 重量化输入数
+	int unsigned requant_err_n; // 重量化错误数
+	
+	task drive_in_bus_requant(
+		input int a, input int x, input int shift, input int zp, input int out_min, input int out_max, input int unsigned delay
+	);
+		int unsigned b;
+		
+		b = int8_requant_param_b(shift, zp, out_min, out_max);
+		
+		requant_exp_q.push_back(int8_requant(a, x, b));
+		requant_in_n++;
+		
+		mac_cell_i_op_a <= # simulation_delay a;
+		mac_cell_i_op_x <= # simulation_delay x;
+		mac_cell_i_op_b <= # simulation_delay b;
+		mac_cell_i_is_a_eq_1 <= # simulation_delay 1'b0;
+		mac_cell_i_is_b_eq_0 <= # simulation_delay 1'b0;
+		mac_cell_i_vld <= # simulation_delay 1'b1;
+		
+		@(posedge clk);
+		
+		rst_in_bus();
+		
+		repeat(delay)
+			@(posedge clk);
+	endtask
+	
+	task test_int8_requant();
+		rst_in_bus();
+		
+		requant_in_n = 0;
+		
+		@(posedge clk iff rst_n);
+		
+		// 舍入位: 缩放系数为0.5时, ±0.5和±1.5向正无穷舍入
+		drive_in_bus_requant(32'h4000_0000, 1, 31, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, -1, 31, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, 3, 31, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, -3, 31, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, 4, 31, 0, -128, 127, 0);
+		// 舍入位: shift = 0时无舍入, shift = 63时取A * X的第62位
+		drive_in_bus_requant(3, 5, 0, 0, -128, 127, 0);
+		drive_in_bus_requant(-3, 5, 0, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h7FFF_FFFF, 32'h7FFF_FFFF, 63, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h8000_0000, 32'h8000_0000, 63, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h8000_0000, 32'h7FFF_FFFF, 63, 0, -128, 127, 0);
+		// 32位饱和: 若不饱和则截断后的低位会得到错误的符号
+		drive_in_bus_requant(32'h7FFF_FFFF, 2, 0, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h7FFF_FFFF, -2, 0, 0, -128, 127, 0);
+		drive_in_bus_requant(32'h8000_0000, 32'h8000_0000, 1, -128, -128, 127, 0);
+		drive_in_bus_requant(32'h8000_0000, 32'h7FFF_FFFF, 1, 127, -128, 127, 0);
+		// 零点: 缩放系数为1
+		drive_in_bus_requant(32'h4000_0000, 10, 30, -5, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, 10, 30, 127, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, -10, 30, -128, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, -10, 30, 20, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, 0, 30, -1, -128, 127, 0);
+		// [out_min, out_max]限制: Relu6(缩放系数为1, 零点为0)
+		for(int i = -10;i <= 10;i++)
+			drive_in_bus_requant(32'h4000_0000, i, 30, 0, 0, 6, 0);
+		// [out_min, out_max]限制: 零点使结果越过上下限
+		drive_in_bus_requant(32'h4000_0000, 5, 30, 3, -4, 7, 0);
+		drive_in_bus_requant(32'h4000_0000, -5, 30, -3, -7, 4, 0);
+		drive_in_bus_requant(32'h4000_0000, 100, 30, 100, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, -100, 30, -100, -128, 127, 0);
+		drive_in_bus_requant(32'h4000_0000, 9, 30, 0, 9, 9, 0);
+		
+		// 随机激励(连续输入与随机间隔)
+		repeat(REQUANT_RAND_N)
+		begin
+			automatic int out_min = $urandom_range(0, 255) - 128;
+			automatic int out_max = $urandom_range(out_min + 128, 255) - 128;
+			
+			drive_in_bus_requant(
+				$urandom(), 
+				($urandom_range(0, 1) == 0) ? $urandom():($urandom_range(0, 1 << 16) - (1 << 15)), 
+				$urandom_range(0, 63), $urandom_range(0, 255) - 128, out_min, out_max, 
+				($urandom_range(0, 1) == 0) ? 0:$urandom_range(1, 3)
+			);
+		end
+		
+		repeat(20)
+			@(posedge clk);
+		
+		$display("共检查%0d个重量化结果", requant_in_n - requant_exp_q.size());
+		
+		if(requant_err_n == 0 && requant_exp_q.size() == 0)
+			$display("检查通过");
+		else
+			$display("检查失败: 错误数 = %0d, 未输出数 = %0d", requant_err_n, requant_exp_q.size());
+		
+		$finish;
+	endtask
+	
 	task test_fp32();
 		rst_in_bus();
 		
@@ -208,6 +315,8 @@ module tb_batch_nml_mac_cell();
 			test_fp32();
 		else if(bn_calfmt == BN_CAL_FMT_INT32)
 			test_int32();
+		else if(bn_calfmt == BN_CAL_FMT_INT16 && en_int8_requant)
+			test_int8_requant();
 	end
 	
 	/** 待测模块 **/
@@ -236,6 +345,7 @@ module tb_batch_nml_mac_cell();
 		
 		.bn_calfmt(bn_calfmt),
 		.fixed_point_quat_accrc((bn_calfmt == BN_CAL_FMT_FP32) ? 5'dx:fixed_point_quat_accrc),
+		.int8_requant(en_int8_requant),
 		
 		.mac_cell_i_op_a(mac_cell_i_op_a),
 		.mac_cell_i_op_x(mac_cell_i_op_x),
@@ -255,6 +365,41 @@ module tb_batch_nml_mac_cell();
 		.mul_res(mul_res)
 	);
 	
+	// 检查INT8逐通道重量化的结果
+	initial
+	begin
+		int unsigned out_n;
+		
+		requant_err_n = 0;
+		out_n = 0;
+		
+		forever
+		begin
+			@(posedge clk iff rst_n);
+			
+			if(en_int8_requant && mac_cell_o_vld)
+			begin
+				if(requant_exp_q.size() == 0)
+				begin
+					$error("多余的输出");
+					requant_err_n++;
+				end
+				else
+				begin
+					automatic int e = requant_exp_q.pop_front();
+					
+					if(mac_cell_o_res != e)
+					begin
+						$error("重量化结果#%0d不一致: res = %0d/%0d", out_n, $signed(mac_cell_o_res), e);
+						requant_err_n++;
+					end
+				end
+				
+				out_n++;
+			end
+		end
+	end
+	
 	genvar mul_i;
 	generate
 		if(INT16_SUPPORTED)
@@ -0,0 +1,300 @@
+`timescale 1ns / 1ps
+
+module tb_conv_layer_desc_fetcher();
+	
+	/** 配置参数 **/
+	// 待测模块配置
+	localparam integer MM2S_STREAM_DATA_WIDTH = 64; // MM2S通道DMA数据流的位宽(32 | 64 | 128 | 256)
+	// 描述符链配置
+	localparam integer LAYER_N = 2; // 层数
+	localparam integer DESC_BASEADDR = 32'h0000_0100; // 描述符链首地址
+	localparam integer DESC_STRIDE = 128; // 描述符间距
+	localparam integer BN_PARAM_BASEADDR = 32'h0000_0400; // BN参数基地址
+	localparam integer BN_PARAM_N = 5; // (第0层的)BN参数个数
+	// 时钟和复位配置
+	localparam real clk_p = 10.0; // 时钟周期
+	localparam real simulation_delay = 1.0; // 仿真延时
+	
+	/** 常量 **/
+	localparam integer WORD_N_FOREACH_BEAT = MM2S_STREAM_DATA_WIDTH / 32; // 每拍数据的字数
+	
+	/** 时钟和复位 **/
+	reg clk;
+	reg rst_n;
+	
+	initial
+	begin
+		clk <= 1'b1;
+	
+		forever
+		begin
+			# (clk_p / 2) clk <= ~clk;
+		end
+	end
+	
+	initial begin
+		rst_n <= 1'b0;
+	
+		# (clk_p * 10 + simulation_delay);
+	
+		rst_n <= 1'b1;
+	end
+	
+	/** 存储器模型 **/
+	reg[31:0] ddr[0:1023]; // DDR(按字寻址)
+	reg[31:0] regs[0:127]; // 寄存器区
+	reg[63:0] bn_mem[0:4095]; // BN参数MEM
+	
+	initial
+	begin
+		for(int i = 0;i < 1024;i++)
+			ddr[i] = $urandom();
+	
+		for(int l = 0;l < LAYER_N;l++)
+		begin
+			automatic int desc_wid = (DESC_BASEADDR + l * DESC_STRIDE) / 4;
+	
+			ddr[desc_wid + 0] = (l == (LAYER_N - 1)) ? 32'd0:(DESC_BASEADDR + (l + 1) * DESC_STRIDE); // 下一描述符地址
+			ddr[desc_wid + 1] = (l == 0) ? 32'h0000_0001:32'h0000_0002; // 标志
+			ddr[desc_wid + 2] = 3 + l; // 本层S2MM通道的命令数
+			ddr[desc_wid + 3] = BN_PARAM_BASEADDR; // BN参数基地址
+			ddr[desc_wid + 4] = (l == 0) ? BN_PARAM_N:0; // BN参数个数
+		end
+	end
+	
+	/** 待测模块 **/
+	// 块级控制
+	reg blk_start;
+	wire blk_idle;
+	wire blk_done;
+	// 层执行状态
+	reg s2mm_cmd_done;
+	wire layer_done;
+	// 0号MM2S通道选择
+	wire dma_sel;
+	// DMA命令(AXIS主机)
+	wire[55:0] m_dma_cmd_axis_data;
+	wire m_dma_cmd_axis_user;
+	wire m_dma_cmd_axis_last;
+	wire m_dma_cmd_axis_valid;
+	wire m_dma_cmd_axis_ready;
+	// DMA数据流(AXIS从机)
+	reg[MM2S_STREAM_DATA_WIDTH-1:0] s_dma_strm_axis_data;
+	reg[MM2S_STREAM_DATA_WIDTH/8-1:0] s_dma_strm_axis_keep;
+	reg s_dma_strm_axis_last;
+	reg s_dma_strm_axis_valid;
+	wire s_dma_strm_axis_ready;
+	// 寄存器写端口
+	wire regs_wen;
+	wire[6:0] regs_addr;
+	wire[31:0] regs_din;
+	reg regs_wready;
+	// BN参数MEM写端口
+	wire bn_mem_wen;
+	wire[15:0] bn_mem_addr;
+	wire[63:0] bn_mem_din;
+	
+	conv_layer_desc_fetcher #(
+		.MM2S_STREAM_DATA_WIDTH(MM2S_STREAM_DATA_WIDTH),
+		.SIM_DELAY(simulation_delay)
+	)dut(
+		.aclk(clk),
+		.aresetn(rst_n),
+		.aclken(1'b1),
+	
+		.desc_chain_baseaddr(DESC_BASEADDR),
+	
+		.blk_start(blk_start),
+		.blk_idle(blk_idle),
+		.blk_done(blk_done),
+	
+		.s2mm_cmd_done(s2mm_cmd_done),
+		.layer_done(layer_done),
+	
+		.dma_sel(dma_sel),
+	
+		.m_dma_cmd_axis_data(m_dma_cmd_axis_data),
+		.m_dma_cmd_axis_user(m_dma_cmd_axis_user),
+		.m_dma_cmd_axis_last(m_dma_cmd_axis_last),
+		.m_dma_cmd_axis_valid(m_dma_cmd_axis_valid),
+		.m_dma_cmd_axis_ready(m_dma_cmd_axis_ready),
+	
+		.s_dma_strm_axis_data(s_dma_strm_axis_data),
+		.s_dma_strm_axis_keep(s_dma_strm_axis_keep),
+		.s_dma_strm_axis_last(s_dma_strm_axis_last),
+		.s_dma_strm_axis_valid(s_dma_strm_axis_valid),
+		.s_dma_strm_axis_ready(s_dma_strm_axis_ready),
+	
+		.regs_wen(regs_wen),
+		.regs_addr(regs_addr),
+		.regs_din(regs_din),
+		.regs_wready(regs_wready),
+	
+		.bn_mem_wen(bn_mem_wen),
+		.bn_mem_addr(bn_mem_addr),
+		.bn_mem_din(bn_mem_din)
+	);
+	
+	/** 块级控制 **/
+	initial
+	begin
+		blk_start <= 1'b0;
+	
+		repeat(20)
+		begin
+			@(posedge clk iff rst_n);
+		end
+	
+		blk_start <= # simulation_delay 1'b1;
+	
+		@(posedge clk iff rst_n);
+	
+		blk_start <= # simulation_delay 1'b0;
+	end
+	
+	/** DMA(MM2S通道)模型 **/
+	assign m_dma_cmd_axis_ready = 1'b1;
+	
+	initial
+	begin
+		s_dma_strm_axis_data <= {MM2S_STREAM_DATA_WIDTH{1'bx}};
+		s_dma_strm_axis_keep <= {(MM2S_STREAM_DATA_WIDTH/8){1'bx}};
+		s_dma_strm_axis_last <= 1'bx;
+		s_dma_strm_axis_valid <= 1'b0;
+	
+		forever
+		begin
+			automatic int baseaddr;
+			automatic int btt;
+			automatic int beat_n;
+	
+			@(posedge clk iff (rst_n & m_dma_cmd_axis_valid & m_dma_cmd_axis_ready));
+	
+			baseaddr = m_dma_cmd_axis_data[31:0];
+			btt = m_dma_cmd_axis_data[55:32];
+			beat_n = (btt + MM2S_STREAM_DATA_WIDTH/8 - 1) / (MM2S_STREAM_DATA_WIDTH/8);
+	
+			repeat(4)
+			begin
+				@(posedge clk iff rst_n);
+			end
+	
+			for(int i = 0;i < beat_n;i++)
+			begin
+				for(int j = 0;j < WORD_N_FOREACH_BEAT;j++)
+					s_dma_strm_axis_data[j*32+:32] <= # simulation_delay ddr[baseaddr / 4 + i * WORD_N_FOREACH_BEAT + j];
+	
+				s_dma_strm_axis_keep <= # simulation_delay {(MM2S_STREAM_DATA_WIDTH/8){1'b1}};
+				s_dma_strm_axis_last <= # simulation_delay i == (beat_n - 1);
+				s_dma_strm_axis_valid <= # simulation_delay 1'b1;
+	
+				@(posedge clk iff (rst_n & s_dma_strm_axis_ready));
+			end
+	
+			s_dma_strm_axis_data <= # simulation_delay {MM2S_STREAM_DATA_WIDTH{1'bx}};
+			s_dma_strm_axis_keep <= # simulation_delay {(MM2S_STREAM_DATA_WIDTH/8){1'bx}};
+			s_dma_strm_axis_last <= # simulation_delay 1'bx;
+			s_dma_strm_axis_valid <= # simulation_delay 1'b0;
+		end
+	end
+	
+	/** 寄存器区模型 **/
+	initial
+	begin
+		regs_wready <= 1'b0;
+	
+		forever
+		begin
+			@(posedge clk iff rst_n);
+	
+			// 模拟AXI-Lite写寄存器时的冲突
+			regs_wready <= # simulation_delay ($urandom_range(0, 3) != 0);
+		end
+	end
+	
+	always @(posedge clk)
+	begin
+		if(regs_wen & regs_wready)
+			regs[regs_addr] <= regs_din;
+	end
+	
+	/** BN参数MEM模型 **/
+	always @(posedge clk)
+	begin
+		if(bn_mem_wen)
+			bn_mem[bn_mem_addr] <= bn_mem_din;
+	end
+	
+	/** S2MM通道模型 **/
+	initial
+	begin
+		s2mm_cmd_done <= 1'b0;
+	
+		forever
+		begin
+			automatic int cmd_n;
+	
+			// 等待启动本层
+			@(posedge clk iff (rst_n & regs_wen & regs_wready & (regs_addr == 16) & regs_din[8]));
+	
+			cmd_n = dut.desc_s2mm_cmd_n;
+	
+			repeat(cmd_n)
+			begin
+				repeat($urandom_range(5, 20))
+				begin
+					@(posedge clk iff rst_n);
+				end
+	
+				s2mm_cmd_done <= # simulation_delay 1'b1;
+	
+				@(posedge clk iff rst_n);
+	
+				s2mm_cmd_done <= # simulation_delay 1'b0;
+			end
+		end
+	end
+	
+	/** 检查 **/
+	initial
+	begin
+		automatic int err_n = 0;
+		automatic int last_desc_wid = (DESC_BASEADDR + (LAYER_N - 1) * DESC_STRIDE) / 4;
+		automatic int cfg_reg_addr[20] = '{36, 40, 41, 48, 49, 50, 51, 52, 53, 64, 65, 66, 67, 80, 81, 82, 83, 96, 97, 98};
+	
+		@(posedge clk iff (rst_n & blk_done));
+	
+		// 最后1层的配置寄存器
+		for(int i = 0;i < 20;i++)
+		begin
+			if(regs[cfg_reg_addr[i]] != ddr[last_desc_wid + 5 + i])
+			begin
+				$error("配置寄存器#%0d不一致: %08x != %08x", cfg_reg_addr[i], regs[cfg_reg_addr[i]], ddr[last_desc_wid + 5 + i]);
+				err_n++;
+			end
+		end
+	
+		// ctrl0
+		if(regs[16] != 32'h0000_0001)
+		begin
+			$error("ctrl0不一致: %08x", regs[16]);
+			err_n++;
+		end
+	
+		// BN参数
+		for(int i = 0;i < BN_PARAM_N;i++)
+		begin
+			if(bn_mem[i] != {ddr[BN_PARAM_BASEADDR / 4 + i * 2 + 1], ddr[BN_PARAM_BASEADDR / 4 + i * 2]})
+			begin
+				$error("BN参数#%0d不一致", i);
+				err_n++;
+			end
+		end
+	
+		if(err_n == 0)
+			$display("检查通过");
+	
+		$stop();
+	end
+	
+endmodule
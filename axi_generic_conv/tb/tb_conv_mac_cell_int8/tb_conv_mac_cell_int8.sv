@@ -0,0 +1,287 @@
+`timescale 1ns / 1ps
+
+module tb_conv_mac_cell_int8();
+	
+	/** 常量 **/
+	// 运算数据格式
+	localparam CAL_FMT_INT8 = 2'b00;
+	
+	/** 配置参数 **/
+	// 待测模块配置
+	localparam integer ATOMIC_C = 4; // 通道并行数(1 | 2 | 4 | 8 | 16 | 32)
+	// 测试配置
+	localparam int unsigned TEST_N = 500; // 随机测试数据个数
+	// 时钟和复位配置
+	localparam real clk_p = 10.0; // 时钟周期
+	localparam real simulation_delay = 1.0; // 仿真延时
+	
+	/** 时钟和复位 **/
+	reg clk;
+	reg rst_n;
+	
+	initial
+	begin
+		clk <= 1'b1;
+		
+		forever
+		begin
+			# (clk_p / 2) clk <= ~clk;
+		end
+	end
+	
+	initial begin
+		rst_n <= 1'b0;
+		
+		# (clk_p * 10 + simulation_delay);
+		
+		rst_n <= 1'b1;
+	end
+	
+	/**
+	激励与检查
+	
+	每个16位数据为1对INT8通道({高通道, 低通道}),
+	低通道的乘积由外部乘法器计算, 高通道的乘积由待测模块内部的s8*s8乘法器计算
+	先输入定向激励(两个通道各自的极值、只有高通道/只有低通道非0), 再输入随机激励(连续输入、随机间隔和特征图无效),
+	每个输出与按"低通道乘积 + 高通道乘积"逐通道累加的期望值比较, 并检查随路数据
+	**/
+	// 期望的输出
+	typedef struct{
+		int res; // 计算结果
+		bit[1:0] info_along; // 随路数据
+	}ExpOut;
+	
+	// 乘加单元计算输入
+	reg[15:0] mac_in_ftm_arr[0:ATOMIC_C-1]; // 特征图数据(数组)
+	reg[15:0] mac_in_wgt_arr[0:ATOMIC_C-1]; // 卷积核权重(数组)
+	reg mac_in_ftm_masked; // 特征图数据(无效标志)
+	reg[1:0] mac_in_info_along; // 随路数据
+	reg mac_in_valid; // 输入有效指示
+	// 乘加单元结果输出
+	wire[7:0] mac_out_exp; // 指数部分(仅当运算数据格式为FP16时有效)
+	wire signed[39:0] mac_out_frac; // 尾数部分或定点数
+	wire[1:0] mac_out_info_along; // 随路数据
+	wire mac_out_valid;
+	// 期望的输出
+	ExpOut exp_q[$];
+	// 输入数和错误数
+	int unsigned in_n;
+	int unsigned err_n;
+	
+	// 输入1组数据(ftm/wgt的每个元素为{高通道, 低通道})
+	task automatic drive(input bit[15:0] ftm[0:ATOMIC_C-1], input bit[15:0] wgt[0:ATOMIC_C-1], input bit masked);
+		ExpOut e;
+		
+		e.res = 0;
+		e.info_along = $urandom_range(0, 3);
+		
+		for(int i = 0;i < ATOMIC_C;i++)
+		begin
+			mac_in_ftm_arr[i] <= # simulation_delay ftm[i];
+			mac_in_wgt_arr[i] <= # simulation_delay wgt[i];
+			
+			if(!masked)
+				e.res +=
+					($signed(ftm[i][7:0]) * $signed(wgt[i][7:0])) +
+					($signed(ftm[i][15:8]) * $signed(wgt[i][15:8]));
+		end
+		
+		mac_in_ftm_masked <= # simulation_delay masked;
+		mac_in_info_along <= # simulation_delay e.info_along;
+		mac_in_valid <= # simulation_delay 1'b1;
+		
+		exp_q.push_back(e);
+		in_n++;
+		
+		@(posedge clk iff rst_n);
+		
+		mac_in_valid <= # simulation_delay 1'b0;
+	endtask
+	
+	initial
+	begin
+		bit[15:0] ftm[0:ATOMIC_C-1];
+		bit[15:0] wgt[0:ATOMIC_C-1];
+		bit[7:0] corner[0:4] = '{8'h80, 8'h7F, 8'hFF, 8'h01, 8'h00};
+		
+		mac_in_ftm_masked <= 1'b0;
+		mac_in_info_along <= 2'b00;
+		mac_in_valid <= 1'b0;
+		in_n = 0;
+		
+		@(posedge clk iff rst_n);
+		
+		// 定向激励: 两个通道取遍极值组合(连续输入)
+		foreach(corner[a])
+		begin
+			foreach(corner[b])
+			begin
+				for(int i = 0;i < ATOMIC_C;i++)
+				begin
+					ftm[i] = {corner[a], corner[b]};
+					wgt[i] = {corner[b], corner[a]};
+				end
+				
+				drive(ftm, wgt, 1'b0);
+			end
+		end
+		
+		// 定向激励: 只有高通道/只有低通道非0
+		for(int i = 0;i < ATOMIC_C;i++)
+		begin
+			ftm[i] = {8'h80, 8'h00};
+			wgt[i] = {8'h80, 8'h7F};
+		end
+		drive(ftm, wgt, 1'b0);
+		
+		for(int i = 0;i < ATOMIC_C;i++)
+		begin
+			ftm[i] = {8'h00, 8'h80};
+			wgt[i] = {8'h7F, 8'h80};
+		end
+		drive(ftm, wgt, 1'b0);
+		
+		// 随机激励
+		repeat(TEST_N)
+		begin
+			automatic int unsigned wait_n = ($urandom_range(0, 1) == 0) ? 0:$urandom_range(1, 4);
+			
+			repeat(wait_n)
+			begin
+				@(posedge clk iff rst_n);
+			end
+			
+			for(int i = 0;i < ATOMIC_C;i++)
+			begin
+				ftm[i] = $urandom();
+				wgt[i] = $urandom();
+			end
+			
+			drive(ftm, wgt, $urandom_range(0, 7) == 0);
+		end
+	end
+	
+	initial
+	begin
+		int unsigned out_n;
+		
+		err_n = 0;
+		out_n = 0;
+		
+		forever
+		begin
+			@(posedge clk iff rst_n);
+			
+			if(mac_out_valid)
+			begin
+				if(exp_q.size() == 0)
+				begin
+					$error("多余的输出");
+					err_n++;
+				end
+				else
+				begin
+					automatic ExpOut e = exp_q.pop_front();
+					
+					if((mac_out_frac != 40'(signed'(e.res))) || (mac_out_info_along != e.info_along))
+					begin
+						$error("输出#%0d不一致: res = %0d/%0d, info_along = %b/%b",
+							out_n, $signed(mac_out_frac), e.res, mac_out_info_along, e.info_along);
+						err_n++;
+					end
+				end
+				
+				out_n++;
+				
+				if(out_n == (5 * 5 + 2 + TEST_N))
+				begin
+					repeat(10)
+					begin
+						@(posedge clk iff rst_n);
+					end
+					
+					$display("共检查%0d个输出", out_n);
+					
+					if(err_n == 0 && exp_q.size() == 0)
+						$display("检查通过");
+					else
+						$display("检查失败: 错误数 = %0d, 未输出数 = %0d", err_n, exp_q.size());
+					
+					$finish;
+				end
+			end
+		end
+	end
+	
+	/** 待测模块 **/
+	// 外部有符号乘法器
+	wire[ATOMIC_C*16-1:0] mul_op_a; // 操作数A
+	wire[ATOMIC_C*16-1:0] mul_op_b; // 操作数B
+	wire mul_ce; // 计算使能
+	wire[ATOMIC_C*32-1:0] mul_res; // 计算结果
+	// 乘加单元计算输入
+	wire[ATOMIC_C*16-1:0] mac_in_ftm; // 特征图数据
+	wire[ATOMIC_C*16-1:0] mac_in_wgt; // 卷积核权重
+	
+	genvar mul_i;
+	generate
+		for(mul_i = 0;mul_i < ATOMIC_C;mul_i = mul_i + 1)
+		begin:mul_blk
+			signed_mul #(
+				.op_a_width(16),
+				.op_b_width(16),
+				.output_width(32),
+				.simulation_delay(simulation_delay)
+			)mul_u(
+				.clk(clk),
+				
+				.ce_s0_mul(mul_ce),
+				
+				.op_a(mul_op_a[16*mul_i+15:16*mul_i]),
+				.op_b(mul_op_b[16*mul_i+15:16*mul_i]),
+				
+				.res(mul_res[32*mul_i+31:32*mul_i])
+			);
+		end
+	endgenerate
+	
+	genvar mac_in_i;
+	generate
+		for(mac_in_i = 0;mac_in_i < ATOMIC_C;mac_in_i = mac_in_i + 1)
+		begin:mac_in_blk
+			assign mac_in_ftm[16*mac_in_i+15:16*mac_in_i] = mac_in_ftm_arr[mac_in_i];
+			assign mac_in_wgt[16*mac_in_i+15:16*mac_in_i] = mac_in_wgt_arr[mac_in_i];
+		end
+	endgenerate
+	
+	conv_mac_cell #(
+		.ATOMIC_C(ATOMIC_C),
+		.EN_SMALL_FP16("true"),
+		.INT8_SUPPORTED(1'b1),
+		.INFO_ALONG_WIDTH(2),
+		.SIM_DELAY(simulation_delay)
+	)dut(
+		.aclk(clk),
+		.aresetn(rst_n),
+		.aclken(1'b1),
+		
+		.calfmt(CAL_FMT_INT8),
+		
+		.mac_in_ftm(mac_in_ftm),
+		.mac_in_wgt(mac_in_wgt),
+		.mac_in_ftm_masked(mac_in_ftm_masked),
+		.mac_in_info_along(mac_in_info_along),
+		.mac_in_valid(mac_in_valid),
+		
+		.mac_out_exp(mac_out_exp),
+		.mac_out_frac(mac_out_frac),
+		.mac_out_info_along(mac_out_info_along),
+		.mac_out_valid(mac_out_valid),
+		
+		.mul_op_a(mul_op_a),
+		.mul_op_b(mul_op_b),
+		.mul_ce(mul_ce),
+		.mul_res(mul_res)
+	);
+
+endmodule
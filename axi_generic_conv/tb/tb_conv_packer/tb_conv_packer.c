@@ -0,0 +1,202 @@
+/*
+通用卷积处理单元数据重排库的往返测试(主机程序)
+
+编译运行(在本目录下, 加-mavx -mf16c时测试向量化路径, 不加时测试逐值转换路径):
+	gcc -std=gnu99 -O2 -mavx -mf16c -I../../software tb_conv_packer.c \
+		../../software/axi_generic_conv.c ../../software/axi_generic_conv_packer.c ../../software/common/panda_fp.c \
+		-o tb_conv_packer && ./tb_conv_packer
+
+1x1卷积、步长为1且ATOMIC_C = ATOMIC_K时, 输入特征图与紧密存储的输出特征图格式相同,
+因此把FP32标准张量重排为输入特征图(转FP16)后, 可直接作为输出特征图重排回FP32标准张量(从FP16转换)
+测试数据覆盖±0、FP16/FP32非规则数、舍入到最小规则数、上溢、±无穷大和NaN
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "axi_generic_conv_packer.h"
+#include "common/panda_fp.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 测试配置
+#define ATOMIC_N 4 // 核并行数/通道并行数
+#define FMAP_W 13 // 特征图宽度
+#define FMAP_H 3 // 特征图高度
+#define CHN_N 6 // 通道数(最后1个通道组只有2个通道)
+
+#define PLANE_LEN (FMAP_W * FMAP_H)
+#define ELM_N (PLANE_LEN * CHN_N)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 测试向量: {FP32, 期望的FP16, FP16转回的FP32}
+static const uint32_t test_vec[][3] = {
+	{0x00000000, 0x0000, 0x00000000}, // +0
+	{0x80000000, 0x8000, 0x80000000}, // -0
+	{0x3F800000, 0x3C00, 0x3F800000}, // 1.0
+	{0xC0200000, 0xC100, 0xC0200000}, // -2.5
+	{0x3EAAAAAB, 0x3555, 0x3EAAA000}, // 1/3
+	{0x477FE000, 0x7BFF, 0x477FE000}, // 65504(FP16最大值)
+	{0x477FF000, 0x7C00, 0x7F800000}, // 65520(向偶数舍入后上溢)
+	{0xD01502F9, 0xFC00, 0xFF800000}, // -1e10(上溢)
+	{0x33800000, 0x0001, 0x33800000}, // 2^-24(FP16最小非规则数)
+	{0x34400000, 0x0003, 0x34400000}, // 3 * 2^-24
+	{0xB87FC000, 0x83FF, 0xB87FC000}, // -1023 * 2^-24(FP16最大非规则数)
+	{0x33000000, 0x0000, 0x00000000}, // 2^-25(向偶数舍入到0)
+	{0x33000001, 0x0001, 0x33800000}, // 2^-25 + 1ulp(粘滞位使其舍入到最小非规则数)
+	{0x33C00000, 0x0002, 0x34000000}, // 1.5 * 2^-24(向偶数舍入)
+	{0x387FF000, 0x0400, 0x38800000}, // 1023.5 * 2^-24(舍入到FP16最小规则数)
+	{0x00000001, 0x0000, 0x00000000}, // FP32最小非规则数
+	{0x80000001, 0x8000, 0x80000000}, // -FP32最小非规则数
+	{0x7F800000, 0x7C00, 0x7F800000}, // +inf
+	{0xFF800000, 0xFC00, 0xFF800000}, // -inf
+	{0x7FC00000, 0x7E00, 0x7FC00000}, // 静默NaN
+	{0xFFC00000, 0xFE00, 0xFFC00000}, // 负的静默NaN
+	{0x7F800001, 0x7E00, 0x7FC00000}, // 信号NaN(静默化)
+	{0xFFA00000, 0xFF00, 0xFFE00000} // 带载荷的负的信号NaN(保持符号和高位载荷)
+};
+
+#define TEST_VEC_N (sizeof(test_vec) / sizeof(test_vec[0]))
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t src_fp32[ELM_N]; // FP32标准张量
+static uint16_t src_fp16[ELM_N]; // FP16标准张量
+static uint16_t fmap[ELM_N]; // 输入/输出特征图
+static uint32_t dst_fp32[ELM_N]; // 重排回的FP32标准张量
+static uint16_t dst_fp16[ELM_N]; // 重排回的FP16标准张量
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 特征点(c, p)的测试向量编号
+static uint32_t get_vec_id(uint32_t c, uint32_t p){
+	return (c * 7 + p) % TEST_VEC_N;
+}
+
+// 特征点(c, p)在标准张量中的位置
+static uint32_t get_std_ofs(AxiGnrConvPackLayout layout, uint32_t c, uint32_t p){
+	return (layout == CONV_PACK_NCHW) ? (c * PLANE_LEN + p):(p * CHN_N + c);
+}
+
+// 特征点(c, p)在特征图中的位置(每个通道组为PLANE_LEN个表面, 最后1个通道组的表面只存储有效的通道)
+static uint32_t get_fmap_ofs(uint32_t c, uint32_t p){
+	uint32_t cgrp_id = c / ATOMIC_N;
+	uint32_t depth = (CHN_N - cgrp_id * ATOMIC_N > ATOMIC_N) ? ATOMIC_N:(CHN_N - cgrp_id * ATOMIC_N);
+
+	return cgrp_id * ATOMIC_N * PLANE_LEN + p * depth + (c % ATOMIC_N);
+}
+
+static void init_cfg(AxiGnrConvProp* prop, AxiGnrConvCfg* cfg){
+	memset((void*)prop, 0, sizeof(AxiGnrConvProp));
+	memset((void*)cfg, 0, sizeof(AxiGnrConvCfg));
+
+	prop->atomic_c = ATOMIC_N;
+	prop->atomic_k = ATOMIC_N;
+
+	cfg->cal_cfg.cal_fmt = CONV_FP16;
+	cfg->cal_cfg.conv_vertical_stride = 1;
+	cfg->cal_cfg.conv_horizontal_stride = 1;
+	cfg->fmap_cfg.ifmap_width = FMAP_W;
+	cfg->fmap_cfg.ifmap_height = FMAP_H;
+	cfg->fmap_cfg.ifmap_chn_n = CHN_N;
+	cfg->fmap_cfg.ofmap_data_type = CONV_O_2_BYTE;
+	cfg->kernal_cfg.kernal_shape = CONV_KRN_1x1;
+	cfg->kernal_cfg.kernal_chn_n = CHN_N;
+	cfg->kernal_cfg.kernal_n = CHN_N;
+	cfg->ifmap_baseaddr = (uint8_t*)fmap;
+	cfg->ofmap_baseaddr = (uint8_t*)fmap;
+	cfg->group_n = 1;
+	cfg->max_wgtblk_w = ATOMIC_N;
+}
+
+// 往返测试, 返回错误数
+static int run_case(const AxiGnrConvProp* prop, const AxiGnrConvCfg* cfg, AxiGnrConvPackLayout layout, AxiGnrConvPackDataType data_type){
+	AxiGnrConvPackOpt opt;
+	int err_n = 0;
+
+	opt.layout = layout;
+	opt.data_type = data_type;
+	opt.parallel_for = NULL;
+
+	for(uint32_t c = 0;c < CHN_N;c++){
+		for(uint32_t p = 0;p < PLANE_LEN;p++){
+			src_fp32[get_std_ofs(layout, c, p)] = test_vec[get_vec_id(c, p)][0];
+			src_fp16[get_std_ofs(layout, c, p)] = (uint16_t)test_vec[get_vec_id(c, p)][1];
+		}
+	}
+
+	memset((void*)fmap, 0xA5, sizeof(fmap));
+	memset((void*)dst_fp32, 0xA5, sizeof(dst_fp32));
+	memset((void*)dst_fp16, 0xA5, sizeof(dst_fp16));
+
+	if(axi_generic_conv_pack_ifmap(prop, cfg, (data_type == CONV_PACK_FP32) ? (const void*)src_fp32:(const void*)src_fp16, &opt) ||
+		axi_generic_conv_unpack_ofmap(prop, cfg, (data_type == CONV_PACK_FP32) ? (void*)dst_fp32:(void*)dst_fp16, &opt)){
+		printf("重排失败\n");
+
+		return 1;
+	}
+
+	for(uint32_t c = 0;c < CHN_N;c++){
+		for(uint32_t p = 0;p < PLANE_LEN;p++){
+			uint32_t vec_id = get_vec_id(c, p);
+			uint16_t fmap_v = fmap[get_fmap_ofs(c, p)];
+			uint32_t dst_v = (data_type == CONV_PACK_FP32) ? dst_fp32[get_std_ofs(layout, c, p)]:dst_fp16[get_std_ofs(layout, c, p)];
+			uint32_t exp_dst_v = (data_type == CONV_PACK_FP32) ? test_vec[vec_id][2]:test_vec[vec_id][1];
+
+			if(fmap_v != test_vec[vec_id][1] || dst_v != exp_dst_v){
+				if(err_n < 8){
+					printf("  错误: c = %u, p = %u, 源 = 0x%08x, 特征图 = 0x%04x(期望0x%04x), 重排回 = 0x%08x(期望0x%08x)\n",
+						c, p, test_vec[vec_id][0], fmap_v, test_vec[vec_id][1], dst_v, exp_dst_v);
+				}
+
+				err_n++;
+			}
+		}
+	}
+
+	return err_n;
+}
+
+int main(){
+	AxiGnrConvProp prop;
+	AxiGnrConvCfg cfg;
+	int err_n = 0;
+
+	init_cfg(&prop, &cfg);
+
+	// 逐值转换
+	for(uint32_t i = 0;i < TEST_VEC_N;i++){
+		float f;
+		uint32_t f_int;
+
+		memcpy((void*)&f, (const void*)&test_vec[i][0], 4);
+
+		uint16_t h = panda_fp_fp32_to_fp16(f);
+
+		f = panda_fp_fp16_to_fp32((uint16_t)test_vec[i][1]);
+		memcpy((void*)&f_int, (const void*)&f, 4);
+
+		if(h != test_vec[i][1] || f_int != test_vec[i][2]){
+			printf("  逐值转换错误: 源 = 0x%08x, FP16 = 0x%04x(期望0x%04x), FP32 = 0x%08x(期望0x%08x)\n",
+				test_vec[i][0], h, test_vec[i][1], f_int, test_vec[i][2]);
+
+			err_n++;
+		}
+	}
+
+	err_n += run_case(&prop, &cfg, CONV_PACK_NCHW, CONV_PACK_FP32);
+	err_n += run_case(&prop, &cfg, CONV_PACK_NHWC, CONV_PACK_FP32);
+	err_n += run_case(&prop, &cfg, CONV_PACK_NCHW, CONV_PACK_FP16);
+	err_n += run_case(&prop, &cfg, CONV_PACK_NHWC, CONV_PACK_FP16);
+
+	if(err_n){
+		printf("检查失败: 错误数 = %d\n", err_n);
+	}else{
+		printf("检查通过\n");
+	}
+
+	return err_n ? 1:0;
+}
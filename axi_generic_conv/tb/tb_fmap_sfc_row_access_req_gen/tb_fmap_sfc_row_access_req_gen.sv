@@ -173,10 +173,14 @@ module tb_fmap_sfc_row_access_req_gen();
 		.ext_i_bottom(ext_i_bottom),
 		.external_padding_top(external_padding_top),
 		.inner_padding_top_bottom(inner_padding_top_bottom),
+		.ifmap_row_pitch(24'h000000),
+		.ifmap_cgrp_pitch(32'h0000_0000),
 		.kernal_set_n(kernal_set_n),
 		.kernal_dilation_vtc_n(kernal_dilation_vtc_n),
 		.kernal_w(kernal_w),
 		.kernal_h_dilated(kernal_h_dilated),
+		.en_zero_cgrp_skip(1'b0),
+		.zero_cgrp_map(256'd0),
 		
 		.blk_start(blk_start),
 		.blk_idle(blk_idle),
@@ -262,6 +262,8 @@ module generic_conv_sim #(
 		.fmap_ext_i_bottom(fmap_ext_i_bottom),
 		.external_padding_top(external_padding_top),
 		.inner_padding_top_bottom(inner_padding_top_bottom),
+		.ifmap_row_pitch(24'h000000),
+		.ifmap_cgrp_pitch(32'h0000_0000),
 		.ofmap_w(ofmap_w),
 		.ofmap_h(ofmap_h),
 		.ofmap_data_type(ofmap_data_type),
@@ -274,6 +276,8 @@ module generic_conv_sim #(
 		.kernal_num_n(kernal_num_n),
 		.kernal_set_n(kernal_set_n),
 		.max_wgtblk_w(max_wgtblk_w),
+		.en_zero_cgrp_skip(1'b0),
+		.zero_cgrp_map(256'd0),
 		
 		.kernal_access_blk_start(kernal_access_blk_start),
 		.kernal_access_blk_idle(kernal_access_blk_idle),
@@ -662,6 +666,8 @@ module generic_conv_sim #(
 		.bn_fixed_point_quat_accrc(bn_fixed_point_quat_accrc),
 		.bn_is_a_eq_1(bn_is_a_eq_1),
 		.bn_is_b_eq_0(bn_is_b_eq_0),
+		.en_int8_requant(1'b0),
+		.out_fixed_point_quat_accrc(4'd0),
 		.leaky_relu_fixed_point_quat_accrc(), // 后续开展激活测试时需要!!!
 		.leaky_relu_param_alpha(), // 后续开展激活测试时需要!!!
 		.sigmoid_fixed_point_quat_accrc(), // 后续开展激活测试时需要!!!
@@ -0,0 +1,382 @@
+/*
+通用卷积处理单元INT8两层级联测试(主机程序)
+
+编译运行(在本目录下):
+	gcc -std=gnu99 -O2 -I../../software tb_int8_chain.c \
+		../../software/axi_generic_conv.c ../../software/axi_generic_conv_packer.c ../../software/common/panda_fp.c \
+		-lm -o tb_int8_chain && ./tb_int8_chain
+
+第1层(3x3卷积, 5个输入通道, 11个核)使能INT8逐通道重量化, 输出1字节输出特征图,
+第2层(1x1卷积, 6个核)直接以第1层的输出特征图作为输入特征图, 同样使能INT8逐通道重量化
+ATOMIC_K = ATOMIC_C * 2, 输入通道数和核数均含奇数, 覆盖输入/输出最后1个通道组补0通道的情况
+
+加速器侧按RTL的行为模拟:
+	读取输入特征图: 每个16位数据为1对通道, 每个通道组ATOMIC_C对通道, 最后1个通道组只存储有效的通道对
+	写出输出特征图: conv_cal_sub_system在收集器前把每对s8通道合并为16位数据,
+		fnl_res_trans_req_gen按表面深度(奇数时补齐为偶数)计算每个子表面行的字节数和地址
+检查:
+	1.写出的字节数与驱动计算的输出特征点字节数、缓存划分规划的输出特征图传输字节数一致
+	2.重排库把第1层的输出特征图重排回标准张量(通道对)后与期望值相同
+	3.重排库把第1层的期望值(通道对)重排为输入特征图后与第1层的输出特征图逐字节相同
+	4.第2层读取第1层的输出特征图得到的结果与期望值相同
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "axi_generic_conv.h"
+#include "axi_generic_conv_packer.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 测试配置
+#define ATOMIC_C 4 // 通道并行数
+#define ATOMIC_K 8 // 核并行数
+#define FMAP_W 6 // 特征图宽度
+#define FMAP_H 5 // 特征图高度
+#define L0_CHN_N 5 // 第1层输入通道数
+#define L0_KERNAL_N 11 // 第1层核数
+#define L1_KERNAL_N 6 // 第2层核数
+
+#define PLANE_LEN (FMAP_W * FMAP_H)
+#define MAX_CHN_N 16 // 最大通道数
+#define FMAP_BUF_LEN (PLANE_LEN * MAX_CHN_N + 64) // 特征图缓存字节数(末尾留出越界检查区)
+#define GUARD_BYTE 0xA5 // 未写出字节的填充值
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 卷积层
+typedef struct{
+	AxiGnrConvCfg cfg; // 配置参数
+	int8_t kernal[MAX_CHN_N * MAX_CHN_N * 9]; // 卷积核权重([K][C][R][S])
+	BNParam bn[MAX_CHN_N]; // BN参数(逐通道重量化)
+}Int8Layer;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint8_t ifmap0[FMAP_BUF_LEN]; // 第1层输入特征图
+static uint8_t ofmap0[FMAP_BUF_LEN]; // 第1层输出特征图(第2层输入特征图)
+static uint8_t ofmap1[FMAP_BUF_LEN]; // 第2层输出特征图
+static uint8_t repack[FMAP_BUF_LEN]; // 由第1层期望值重排得到的输入特征图
+
+static int8_t std_in[MAX_CHN_N * PLANE_LEN]; // 第1层输入([C][H][W])
+static int8_t exp0[MAX_CHN_N * PLANE_LEN]; // 第1层期望输出([K][H][W])
+static int8_t exp1[MAX_CHN_N * PLANE_LEN]; // 第2层期望输出([K][H][W])
+static uint16_t pair_buf[MAX_CHN_N * PLANE_LEN]; // 通道对标准张量([C/2][H][W])
+
+static uint32_t rand_state = 1;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int32_t rand_int(int32_t lo, int32_t hi){
+	rand_state = rand_state * 1103515245 + 12345;
+
+	return lo + (int32_t)((rand_state >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+// 把[C][H][W]的s8张量合并为通道对标准张量(奇数通道数时补0通道)
+static void to_pair(const int8_t* src, uint32_t chn_n, uint16_t* dst){
+	for(uint32_t hc = 0;hc < (chn_n + 1) / 2;hc++){
+		for(uint32_t p = 0;p < PLANE_LEN;p++){
+			uint8_t lo = (uint8_t)src[(hc * 2) * PLANE_LEN + p];
+			uint8_t hi = (hc * 2 + 1 < chn_n) ? ((uint8_t)src[(hc * 2 + 1) * PLANE_LEN + p]):0;
+
+			dst[hc * PLANE_LEN + p] = (uint16_t)(lo | (((uint16_t)hi) << 8));
+		}
+	}
+}
+
+// 期望值: 按[C][H][W]直接计算卷积与重量化
+static void cal_exp(const Int8Layer* layer, const int8_t* in, int8_t* out){
+	const AxiGnrConvCfg* cfg = &layer->cfg;
+	uint32_t c_n = cfg->fmap_cfg.ifmap_chn_n;
+	uint32_t k_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+	int32_t pad = (int32_t)cfg->fmap_cfg.external_padding_left;
+
+	for(uint32_t k = 0;k < cfg->kernal_cfg.kernal_n;k++){
+		for(int32_t y = 0;y < FMAP_H;y++){
+			for(int32_t x = 0;x < FMAP_W;x++){
+				int32_t acc = 0;
+
+				for(uint32_t c = 0;c < c_n;c++){
+					for(int32_t r = 0;r < (int32_t)k_len;r++){
+						for(int32_t s = 0;s < (int32_t)k_len;s++){
+							int32_t iy = y + r - pad;
+							int32_t ix = x + s - pad;
+
+							if(iy >= 0 && iy < FMAP_H && ix >= 0 && ix < FMAP_W){
+								acc += ((int32_t)in[c * PLANE_LEN + iy * FMAP_W + ix]) *
+									((int32_t)layer->kernal[((k * c_n + c) * k_len + r) * k_len + s]);
+							}
+						}
+					}
+				}
+
+				out[k * PLANE_LEN + y * FMAP_W + x] = (int8_t)axi_generic_conv_cal_requant(&layer->bn[k], acc, NULL);
+			}
+		}
+	}
+}
+
+// 加速器模拟: 从输入特征图(通道对, 每个通道组ATOMIC_C对)读取通道c在特征点p的值
+static int32_t emu_rd_ifmap(const AxiGnrConvCfg* cfg, uint32_t c, uint32_t p){
+	uint32_t hw_chn_n = axi_generic_conv_get_hw_chn_n(CONV_INT8, cfg->fmap_cfg.ifmap_chn_n);
+	uint32_t hc = c / 2;
+	uint32_t cgrp_id = hc / ATOMIC_C;
+	uint32_t depth = (hw_chn_n - cgrp_id * ATOMIC_C > ATOMIC_C) ? ATOMIC_C:(hw_chn_n - cgrp_id * ATOMIC_C);
+	const uint8_t* item = cfg->ifmap_baseaddr + (cgrp_id * ATOMIC_C * PLANE_LEN + p * depth + hc % ATOMIC_C) * 2;
+
+	return (int32_t)((int8_t)item[c % 2]);
+}
+
+// 加速器模拟: 计算1层, 按RTL写出输出特征图, 返回写出区域的末尾偏移
+static uint32_t emu_run(const Int8Layer* layer){
+	const AxiGnrConvCfg* cfg = &layer->cfg;
+	uint32_t c_n = cfg->fmap_cfg.ifmap_chn_n;
+	uint32_t k_n = cfg->kernal_cfg.kernal_n;
+	uint32_t k_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+	int32_t pad = (int32_t)cfg->fmap_cfg.external_padding_left;
+	uint32_t set_w_max = cfg->max_wgtblk_w;
+	uint32_t ogrp_byte_n = ((set_w_max + 1) & (~1U)) * PLANE_LEN; // 输出组字节数(fnl_res_trans_req_gen)
+	uint32_t end_ofs = 0;
+
+	for(uint32_t set_id = 0;set_id * set_w_max < k_n;set_id++){
+		uint32_t set_w = (k_n - set_id * set_w_max > set_w_max) ? set_w_max:(k_n - set_id * set_w_max);
+
+		for(uint32_t k_ofs = 0;k_ofs < set_w;k_ofs += ATOMIC_K){
+			uint32_t depth = (set_w - k_ofs > ATOMIC_K) ? ATOMIC_K:(set_w - k_ofs);
+			uint32_t pt_byte_n = (depth + 1) & (~1U); // 合并通道对后每个特征点的字节数
+			uint32_t sub_row_base = set_id * ogrp_byte_n + (k_ofs / ATOMIC_K) * PLANE_LEN * ATOMIC_K;
+
+			for(int32_t y = 0;y < FMAP_H;y++){
+				for(int32_t x = 0;x < FMAP_W;x++){
+					uint8_t* pt = cfg->ofmap_baseaddr + sub_row_base + (y * FMAP_W + x) * pt_byte_n;
+
+					for(uint32_t i = 0;i < pt_byte_n;i++){
+						uint32_t k = set_id * set_w_max + k_ofs + i;
+						int32_t acc = 0;
+
+						if(i >= depth){
+							pt[i] = 0; // 奇数表面深度时高字节补0
+							continue;
+						}
+
+						for(uint32_t c = 0;c < c_n;c++){
+							for(int32_t r = 0;r < (int32_t)k_len;r++){
+								for(int32_t s = 0;s < (int32_t)k_len;s++){
+									int32_t iy = y + r - pad;
+									int32_t ix = x + s - pad;
+
+									if(iy >= 0 && iy < FMAP_H && ix >= 0 && ix < FMAP_W){
+										acc += emu_rd_ifmap(cfg, c, (uint32_t)(iy * FMAP_W + ix)) *
+											((int32_t)layer->kernal[((k * c_n + c) * k_len + r) * k_len + s]);
+									}
+								}
+							}
+						}
+
+						pt[i] = (uint8_t)axi_generic_conv_cal_requant(&layer->bn[k], acc, NULL);
+					}
+
+					if(sub_row_base + (y * FMAP_W + x + 1) * pt_byte_n > end_ofs){
+						end_ofs = sub_row_base + (y * FMAP_W + x + 1) * pt_byte_n;
+					}
+				}
+			}
+		}
+	}
+
+	return end_ofs;
+}
+
+static void init_prop(AxiGnrConvProp* prop){
+	memset((void*)prop, 0, sizeof(AxiGnrConvProp));
+
+	prop->int8_supported = 1;
+	prop->int8_requant_supported = 1;
+	prop->bn_supported = 1;
+	prop->atomic_c = ATOMIC_C;
+	prop->atomic_k = ATOMIC_K;
+	prop->max_cal_round_n = 4;
+	prop->phy_buf_bank_n = 16;
+	prop->phy_buf_bank_depth = 512;
+	prop->max_fmbuf_row_n = 512;
+	prop->max_kernal_n = 1024;
+	prop->mid_res_buf_bank_n = 8;
+	prop->mid_res_buf_bank_depth = 512;
+	prop->mid_res_buf_clk_rate = 1;
+	prop->mm2s_stream_data_width = 64;
+	prop->s2mm_stream_data_width = 64;
+}
+
+static void init_layer(Int8Layer* layer, uint32_t chn_n, uint32_t kernal_n, AxiGnrConvKernalShape shape, uint8_t pad,
+	uint8_t* ifmap, uint8_t* ofmap){
+	AxiGnrConvCfg* cfg = &layer->cfg;
+	uint32_t k_len = axi_generic_conv_get_kernal_len(shape);
+
+	memset((void*)layer, 0, sizeof(Int8Layer));
+
+	cfg->cal_cfg.cal_fmt = CONV_INT8;
+	cfg->cal_cfg.conv_vertical_stride = 1;
+	cfg->cal_cfg.conv_horizontal_stride = 1;
+	cfg->cal_cfg.cal_round_n = 1;
+	cfg->fmap_cfg.ifmap_width = FMAP_W;
+	cfg->fmap_cfg.ifmap_height = FMAP_H;
+	cfg->fmap_cfg.ifmap_chn_n = chn_n;
+	cfg->fmap_cfg.external_padding_left = pad;
+	cfg->fmap_cfg.external_padding_right = pad;
+	cfg->fmap_cfg.external_padding_top = pad;
+	cfg->fmap_cfg.external_padding_bottom = pad;
+	cfg->fmap_cfg.ofmap_data_type = CONV_O_1_BYTE;
+	cfg->kernal_cfg.kernal_shape = shape;
+	cfg->kernal_cfg.kernal_chn_n = chn_n;
+	cfg->kernal_cfg.kernal_n = kernal_n;
+	cfg->bn_act_cfg.use_bn_unit = 1;
+	cfg->bn_act_cfg.en_int8_requant = 1;
+	cfg->bn_act_cfg.act_func_type = ACT_FUNC_NONE;
+	cfg->ifmap_baseaddr = ifmap;
+	cfg->ofmap_baseaddr = ofmap;
+	cfg->group_n = 1;
+	cfg->max_wgtblk_w = ATOMIC_K;
+
+	for(uint32_t i = 0;i < kernal_n * chn_n * k_len * k_len;i++){
+		layer->kernal[i] = (int8_t)rand_int(-8, 7);
+	}
+
+	for(uint32_t k = 0;k < kernal_n;k++){
+		int32_t multiplier;
+		uint8_t shift;
+
+		axi_generic_conv_quantize_requant_scale(1.0f / (float)(48 + k * 5), &multiplier, &shift);
+		axi_generic_conv_set_bn_requant_param(&layer->bn[k], multiplier, shift, (int8_t)rand_int(-4, 4), -128, 127);
+	}
+}
+
+// 检查1层的输出特征图, 返回错误数
+static int chk_layer(const char* name, const AxiGnrConvProp* prop, Int8Layer* layer, const int8_t* exp){
+	AxiGnrConvCfg* cfg = &layer->cfg;
+	AxiGnrConvPackOpt opt = {CONV_PACK_NCHW, CONV_PACK_INT16, NULL};
+	AxiGnrConvCfg plan_cfg = *cfg;
+	AxiGnrConvBufPlan plan;
+	uint32_t k_n = cfg->kernal_cfg.kernal_n;
+	uint32_t exp_byte_n = PLANE_LEN * axi_generic_conv_get_ofmap_pt_byte_n(cfg->fmap_cfg.ofmap_data_type, k_n);
+	int err_n = 0;
+
+	memset((void*)cfg->ofmap_baseaddr, GUARD_BYTE, FMAP_BUF_LEN);
+
+	uint32_t byte_n = emu_run(layer);
+
+	// 1.写出的字节数
+	if(byte_n != exp_byte_n){
+		printf("  %s: 写出%u字节, 驱动计算为%u字节\n", name, byte_n, exp_byte_n);
+		err_n++;
+	}
+
+	for(uint32_t i = byte_n;i < FMAP_BUF_LEN;i++){
+		if(cfg->ofmap_baseaddr[i] != GUARD_BYTE){
+			printf("  %s: 越界写出, 偏移 = %u\n", name, i);
+			err_n++;
+			break;
+		}
+	}
+
+	if(axi_generic_conv_plan_buffer(prop, &plan_cfg, &plan)){
+		printf("  %s: 缓存划分规划失败\n", name);
+		err_n++;
+	}else if(plan.ofmap_traffic != exp_byte_n){
+		printf("  %s: 规划的输出特征图传输字节数 = %u, 期望%u\n", name, (uint32_t)plan.ofmap_traffic, exp_byte_n);
+		err_n++;
+	}
+
+	// 2.重排回标准张量(通道对)
+	memset((void*)pair_buf, 0x5A, sizeof(pair_buf));
+
+	if(axi_generic_conv_unpack_ofmap(prop, cfg, (void*)pair_buf, &opt)){
+		printf("  %s: 重排输出特征图失败\n", name);
+
+		return err_n + 1;
+	}
+
+	for(uint32_t k = 0;k < k_n;k++){
+		for(uint32_t p = 0;p < PLANE_LEN;p++){
+			int8_t v = (int8_t)(pair_buf[(k / 2) * PLANE_LEN + p] >> ((k % 2) * 8));
+
+			if(v != exp[k * PLANE_LEN + p]){
+				if(err_n < 8){
+					printf("  %s: 错误: k = %u, p = %u, 结果 = %d, 期望 = %d\n", name, k, p, v, exp[k * PLANE_LEN + p]);
+				}
+
+				err_n++;
+			}
+		}
+	}
+
+	if(k_n % 2){
+		for(uint32_t p = 0;p < PLANE_LEN;p++){
+			if((pair_buf[(k_n / 2) * PLANE_LEN + p] >> 8) != 0){
+				printf("  %s: 补齐的通道不为0, p = %u\n", name, p);
+				err_n++;
+				break;
+			}
+		}
+	}
+
+	return err_n;
+}
+
+int main(){
+	AxiGnrConvProp prop;
+	static Int8Layer layer0;
+	static Int8Layer layer1;
+	int err_n = 0;
+
+	init_prop(&prop);
+	init_layer(&layer0, L0_CHN_N, L0_KERNAL_N, CONV_KRN_3x3, 1, ifmap0, ofmap0);
+	init_layer(&layer1, L0_KERNAL_N, L1_KERNAL_N, CONV_KRN_1x1, 0, ofmap0, ofmap1);
+
+	for(uint32_t i = 0;i < L0_CHN_N * PLANE_LEN;i++){
+		std_in[i] = (int8_t)rand_int(-128, 127);
+	}
+
+	cal_exp(&layer0, std_in, exp0);
+	cal_exp(&layer1, exp0, exp1);
+
+	// 第1层的输入特征图由重排库生成
+	AxiGnrConvPackOpt opt = {CONV_PACK_NCHW, CONV_PACK_INT16, NULL};
+
+	to_pair(std_in, L0_CHN_N, pair_buf);
+
+	if(axi_generic_conv_pack_ifmap(&prop, &layer0.cfg, (const void*)pair_buf, &opt)){
+		printf("重排输入特征图失败\n");
+
+		return 1;
+	}
+
+	err_n += chk_layer("第1层", &prop, &layer0, exp0);
+
+	// 3.第1层的期望值按输入特征图重排, 应与第1层的输出特征图逐字节相同
+	AxiGnrConvCfg repack_cfg = layer1.cfg;
+	uint32_t ofmap0_byte_n = PLANE_LEN * axi_generic_conv_get_ofmap_pt_byte_n(CONV_O_1_BYTE, L0_KERNAL_N);
+
+	repack_cfg.ifmap_baseaddr = repack;
+	to_pair(exp0, L0_KERNAL_N, pair_buf);
+
+	if(axi_generic_conv_pack_ifmap(&prop, &repack_cfg, (const void*)pair_buf, &opt) ||
+		memcmp((const void*)repack, (const void*)ofmap0, ofmap0_byte_n)){
+		printf("  第1层的输出特征图与按输入特征图重排的期望值不同\n");
+		err_n++;
+	}
+
+	// 4.第2层直接读取第1层的输出特征图
+	err_n += chk_layer("第2层", &prop, &layer1, exp1);
+
+	if(err_n){
+		printf("检查失败: 错误数 = %d\n", err_n);
+	}else{
+		printf("检查通过\n");
+	}
+
+	return err_n ? 1:0;
+}
@@ -133,6 +133,8 @@ module tb_kernal_access_req_gen();
 		.external_padding_top(external_padding_top),
 		.inner_padding_top_bottom(inner_padding_top_bottom),
 		.kernal_dilation_vtc_n(kernal_dilation_vtc_n),
+		.en_zero_cgrp_skip(1'b0),
+		.zero_cgrp_map(256'd0),
 		
 		.blk_start(blk_start),
 		.blk_idle(blk_idle),
@@ -0,0 +1,472 @@
+`timescale 1ns / 1ps
+
+module tb_zero_cgrp_skip();
+	
+	/** 配置参数 **/
+	// 待测模块配置
+	localparam integer ATOMIC_C = 4; // 通道并行数(1 | 2 | 4 | 8 | 16 | 32)
+	// 卷积参数配置
+	localparam int unsigned IFMAP_W = 8; // 输入特征图宽度
+	localparam int unsigned IFMAP_H = 4; // 输入特征图高度
+	localparam int unsigned CGRP_N = 8; // 通道组数
+	localparam int unsigned CGRP_ID_BITS = 3; // 实际表面行号中通道组号的位数
+	localparam int unsigned KERNAL_NUM = 8; // 核数
+	localparam int unsigned MAX_WGTBLK_W = 4; // 权重块最大宽度
+	localparam int unsigned PADDING_TOP = 1; // 上部外填充数
+	localparam int unsigned PADDING_BOTTOM = 1; // 下部外填充数
+	localparam int unsigned KERNAL_W_H = 3; // 卷积核宽度/高度
+	// 测试配置
+	localparam int unsigned TIMEOUT_CLK_N = 200000; // 每个场景的超时周期数
+	// 时钟和复位配置
+	localparam real clk_p = 10.0; // 时钟周期
+	localparam real simulation_delay = 1.0; // 仿真延时
+	
+	/** 常量 **/
+	// 由卷积参数得到的运行时参数
+	localparam int unsigned EXT_I_BOTTOM = IFMAP_H + PADDING_TOP - 1; // 扩展后特征图的垂直边界
+	localparam int unsigned OFMAP_H = (EXT_I_BOTTOM + 1 + PADDING_BOTTOM - KERNAL_W_H) + 1; // 输出特征图高度
+	localparam int unsigned KERNAL_SET_N = (KERNAL_NUM + MAX_WGTBLK_W - 1) / MAX_WGTBLK_W; // 核组个数
+	// 卷积核形状的类型编码
+	localparam KBUFGRPSZ_9 = 3'b001; // 3x3
+	
+	/** 时钟和复位 **/
+	reg clk;
+	reg rst_n;
+	
+	initial
+	begin
+		clk <= 1'b1;
+		
+		forever
+		begin
+			# (clk_p / 2) clk <= ~clk;
+		end
+	end
+	
+	initial begin
+		rst_n <= 1'b0;
+		
+		# (clk_p * 10 + simulation_delay);
+		
+		rst_n <= 1'b1;
+	end
+	
+	/**
+	激励与检查
+	
+	各例化2个特征图表面行访问请求生成单元和卷积核权重访问请求生成单元,
+	#0不使能零通道组跳过(稠密执行), #1使能零通道组跳过(稀疏执行), 两者使用相同的卷积参数和零通道组位图,
+	所有请求流和切块信息流的ready都随机拉低
+	
+	对每个零通道组位图场景, 同时启动4个待测模块, 全部完成后比较:
+		稀疏的特征图表面行读请求 = 去掉零通道组表面行后的稠密请求(实际表面行号仍为真实通道组号)
+		稀疏的卷积核权重块读请求 = 去掉零通道组权重块后的稠密请求, 且实际通道组号被压缩为此前非零通道组的个数
+		重置缓存请求和特征图切块信息不受影响
+	
+	本测试只比较请求流(读请求的个数和内容), 不测量整层卷积的运行周期数; 周期和带宽的实际节省须在完整的卷积仿真中测得
+	**/
+	// 零通道组位图场景
+	bit[CGRP_N-1:0] zero_cgrp_map_scenes[] = '{
+		8'b1001_1001, // 两端和中间均为零通道组
+		8'b1101_1111, // 只有1个非零通道组
+		8'b0000_0000  // 无零通道组
+	};
+	
+	// 零通道组位图
+	reg[255:0] zero_cgrp_map;
+	// 块级控制
+	reg blk_start;
+	wire[1:0] fmap_blk_done;
+	wire[1:0] kernal_blk_done;
+	// 请求流和切块信息流的ready
+	reg[1:0] fm_rd_req_ready;
+	reg[1:0] fm_cake_info_ready;
+	reg[1:0] kwgtblk_rd_req_ready;
+	// 捕获到的请求和切块信息(#0为稠密执行, #1为稀疏执行)
+	bit[103:0] fm_rd_req_q[0:1][$];
+	bit[7:0] fm_cake_info_q[0:1][$];
+	bit[103:0] kwgtblk_rd_req_q[0:1][$];
+	// 错误数
+	int unsigned err_n;
+	
+	// 得到压缩后的实际通道组号(即此前非零通道组的个数)
+	function automatic int unsigned compact_cgrp_id(input bit[CGRP_N-1:0] map, input int unsigned cgrp_id);
+		compact_cgrp_id = 0;
+		
+		for(int i = 0;i < cgrp_id;i++)
+		begin
+			if(!map[i])
+				compact_cgrp_id++;
+		end
+	endfunction
+	
+	// 比较1个场景下稠密执行与稀疏执行的请求流
+	function automatic void check_scene(input int unsigned scene_i, input bit[CGRP_N-1:0] map);
+		bit[103:0] exp_fm_q[$];
+		bit[103:0] exp_kwgtblk_q[$];
+		
+		if((fm_rd_req_q[0].size() == 0) || (kwgtblk_rd_req_q[0].size() == 0))
+		begin
+			$error("场景#%0d: 稠密执行没有产生请求", scene_i);
+			err_n++;
+		end
+		
+		// 特征图表面行读请求
+		foreach(fm_rd_req_q[0][i])
+		begin
+			// 重置缓存请求总是保留, 零通道组的表面行被去掉
+			if(fm_rd_req_q[0][i][97] || (!map[fm_rd_req_q[0][i][85+:CGRP_ID_BITS]]))
+				exp_fm_q.push_back(fm_rd_req_q[0][i]);
+		end
+		
+		if(fm_rd_req_q[1].size() != exp_fm_q.size())
+		begin
+			$error("场景#%0d: 特征图表面行读请求数不一致: %0d/%0d", scene_i, fm_rd_req_q[1].size(), exp_fm_q.size());
+			err_n++;
+		end
+		
+		foreach(exp_fm_q[i])
+		begin
+			if(i >= fm_rd_req_q[1].size())
+				break;
+			
+			if(fm_rd_req_q[1][i] != exp_fm_q[i])
+			begin
+				$error("场景#%0d: 特征图表面行读请求#%0d不一致: %h/%h", scene_i, i, fm_rd_req_q[1][i], exp_fm_q[i]);
+				err_n++;
+			end
+		end
+		
+		// 卷积核权重块读请求
+		foreach(kwgtblk_rd_req_q[0][i])
+		begin
+			automatic bit[103:0] req = kwgtblk_rd_req_q[0][i];
+			
+			if(req[97])
+				exp_kwgtblk_q.push_back(req);
+			else if(!map[req[96:87]])
+			begin
+				req[96:87] = compact_cgrp_id(map, req[96:87]);
+				exp_kwgtblk_q.push_back(req);
+			end
+		end
+		
+		if(kwgtblk_rd_req_q[1].size() != exp_kwgtblk_q.size())
+		begin
+			$error("场景#%0d: 卷积核权重块读请求数不一致: %0d/%0d", scene_i, kwgtblk_rd_req_q[1].size(), exp_kwgtblk_q.size());
+			err_n++;
+		end
+		
+		foreach(exp_kwgtblk_q[i])
+		begin
+			if(i >= kwgtblk_rd_req_q[1].size())
+				break;
+			
+			if(kwgtblk_rd_req_q[1][i] != exp_kwgtblk_q[i])
+			begin
+				$error("场景#%0d: 卷积核权重块读请求#%0d不一致: %h/%h", scene_i, i, kwgtblk_rd_req_q[1][i], exp_kwgtblk_q[i]);
+				err_n++;
+			end
+		end
+		
+		// 特征图切块信息
+		if(fm_cake_info_q[1] != fm_cake_info_q[0])
+		begin
+			$error("场景#%0d: 特征图切块信息不一致", scene_i);
+			err_n++;
+		end
+		
+		$display("场景#%0d(零通道组位图 = %b): 特征图表面行读请求%0d -> %0d, 卷积核权重块读请求%0d -> %0d",
+			scene_i, map, fm_rd_req_q[0].size(), fm_rd_req_q[1].size(), kwgtblk_rd_req_q[0].size(), kwgtblk_rd_req_q[1].size());
+	endfunction
+	
+	initial
+	begin
+		zero_cgrp_map <= 256'd0;
+		blk_start <= 1'b0;
+		err_n = 0;
+		
+		@(posedge clk iff rst_n);
+		
+		foreach(zero_cgrp_map_scenes[scene_i])
+		begin
+			bit[1:0] fmap_done;
+			bit[1:0] kernal_done;
+			int unsigned clk_n;
+			
+			for(int i = 0;i < 2;i++)
+			begin
+				fm_rd_req_q[i].delete();
+				fm_cake_info_q[i].delete();
+				kwgtblk_rd_req_q[i].delete();
+			end
+			
+			zero_cgrp_map <= # simulation_delay (zero_cgrp_map_scenes[scene_i] | 256'd0);
+			
+			@(posedge clk iff rst_n);
+			
+			blk_start <= # simulation_delay 1'b1;
+			
+			@(posedge clk iff rst_n);
+			
+			blk_start <= # simulation_delay 1'b0;
+			
+			fmap_done = 2'b00;
+			kernal_done = 2'b00;
+			clk_n = 0;
+			
+			while(!((&fmap_done) && (&kernal_done)))
+			begin
+				@(posedge clk iff rst_n);
+				
+				fmap_done |= fmap_blk_done;
+				kernal_done |= kernal_blk_done;
+				clk_n++;
+				
+				if(clk_n == TIMEOUT_CLK_N)
+				begin
+					$error("场景#%0d: 超时(特征图侧完成 = %b, 卷积核侧完成 = %b)", scene_i, fmap_done, kernal_done);
+					err_n++;
+					
+					break;
+				end
+			end
+			
+			repeat(10)
+			begin
+				@(posedge clk iff rst_n);
+			end
+			
+			check_scene(scene_i, zero_cgrp_map_scenes[scene_i]);
+		end
+		
+		if(err_n == 0)
+			$display("检查通过");
+		else
+			$display("检查失败: 错误数 = %0d", err_n);
+		
+		$finish;
+	end
+	
+	// 随机拉低ready
+	always @(posedge clk)
+	begin
+		for(int i = 0;i < 2;i++)
+		begin
+			fm_rd_req_ready[i] <= # simulation_delay $urandom_range(0, 3) != 0;
+			fm_cake_info_ready[i] <= # simulation_delay $urandom_range(0, 3) != 0;
+			kwgtblk_rd_req_ready[i] <= # simulation_delay $urandom_range(0, 3) != 0;
+		end
+	end
+	
+	/** 待测模块 **/
+	genvar dut_i;
+	generate
+		for(dut_i = 0;dut_i < 2;dut_i = dut_i + 1)
+		begin:dut_blk
+			// 特征图表面行读请求
+			wire[103:0] m_fm_rd_req_axis_data;
+			wire m_fm_rd_req_axis_valid;
+			// 特征图切块信息
+			wire[7:0] m_fm_cake_info_axis_data;
+			wire m_fm_cake_info_axis_valid;
+			// 卷积核权重块读请求
+			wire[103:0] m_kwgtblk_rd_req_axis_data;
+			wire m_kwgtblk_rd_req_axis_valid;
+			// (共享)无符号乘法器#0
+			wire[15:0] mul0_op_a; // 操作数A
+			wire[15:0] mul0_op_b; // 操作数B
+			wire[3:0] mul0_tid; // 操作ID
+			wire mul0_req;
+			wire mul0_grant;
+			reg[31:0] mul0_res;
+			reg[3:0] mul0_oid;
+			reg mul0_ovld;
+			// (共享)无符号乘法器#1
+			wire[15:0] mul1_op_a; // 操作数A
+			wire[23:0] mul1_op_b; // 操作数B
+			wire[3:0] mul1_tid; // 操作ID
+			wire mul1_req;
+			wire mul1_grant;
+			reg[39:0] mul1_res;
+			reg[3:0] mul1_oid;
+			reg mul1_ovld;
+			// 共享无符号乘法器
+			wire[15:0] shared_mul_c0_op_a; // 操作数A
+			wire[15:0] shared_mul_c0_op_b; // 操作数B
+			wire[3:0] shared_mul_c0_tid; // 操作ID
+			wire shared_mul_c0_req;
+			wire shared_mul_c0_grant;
+			reg[31:0] shared_mul_res;
+			reg[3:0] shared_mul_oid;
+			reg shared_mul_ovld;
+			
+			assign mul0_grant = mul0_req;
+			assign mul1_grant = mul1_req;
+			assign shared_mul_c0_grant = shared_mul_c0_req;
+			
+			always @(posedge clk or negedge rst_n)
+			begin
+				if(~rst_n)
+					{shared_mul_ovld, mul1_ovld, mul0_ovld} <= 3'b000;
+				else
+					{shared_mul_ovld, mul1_ovld, mul0_ovld} <= # simulation_delay {shared_mul_c0_req, mul1_req, mul0_req};
+			end
+			
+			always @(posedge clk)
+			begin
+				if(mul0_req)
+				begin
+					mul0_res <= # simulation_delay mul0_op_a * mul0_op_b;
+					mul0_oid <= # simulation_delay mul0_tid;
+				end
+			end
+			
+			always @(posedge clk)
+			begin
+				if(mul1_req)
+				begin
+					mul1_res <= # simulation_delay mul1_op_a * mul1_op_b;
+					mul1_oid <= # simulation_delay mul1_tid;
+				end
+			end
+			
+			always @(posedge clk)
+			begin
+				if(shared_mul_c0_req)
+				begin
+					shared_mul_res <= # simulation_delay shared_mul_c0_op_a * shared_mul_c0_op_b;
+					shared_mul_oid <= # simulation_delay shared_mul_c0_tid;
+				end
+			end
+			
+			// 捕获请求和切块信息
+			always @(posedge clk)
+			begin
+				if(rst_n & m_fm_rd_req_axis_valid & fm_rd_req_ready[dut_i])
+					fm_rd_req_q[dut_i].push_back(m_fm_rd_req_axis_data);
+				
+				if(rst_n & m_fm_cake_info_axis_valid & fm_cake_info_ready[dut_i])
+					fm_cake_info_q[dut_i].push_back(m_fm_cake_info_axis_data);
+				
+				if(rst_n & m_kwgtblk_rd_req_axis_valid & kwgtblk_rd_req_ready[dut_i])
+					kwgtblk_rd_req_q[dut_i].push_back(m_kwgtblk_rd_req_axis_data);
+			end
+			
+			fmap_sfc_row_access_req_gen #(
+				.ATOMIC_C(ATOMIC_C),
+				.EN_REG_SLICE_IN_RD_REQ("true"),
+				.SIM_DELAY(simulation_delay)
+			)fmap_dut(
+				.aclk(clk),
+				.aresetn(rst_n),
+				.aclken(1'b1),
+				
+				.conv_vertical_stride(3'd0),
+				.is_grp_conv_mode(1'b0),
+				.n_foreach_group(16'd0),
+				.data_size_foreach_group(32'd0),
+				.fmap_baseaddr(32'd1024),
+				.is_16bit_data(1'b1),
+				.ifmap_w(IFMAP_W - 1),
+				.ifmap_size(IFMAP_W * IFMAP_H - 1),
+				.ofmap_h(OFMAP_H - 1),
+				.fmap_chn_n(CGRP_N * ATOMIC_C - 1),
+				.ext_i_bottom(EXT_I_BOTTOM),
+				.external_padding_top(PADDING_TOP),
+				.inner_padding_top_bottom(3'd0),
+				.ifmap_row_pitch(24'd0),
+				.ifmap_cgrp_pitch(32'd0),
+				.kernal_set_n(KERNAL_SET_N - 1),
+				.kernal_dilation_vtc_n(4'd0),
+				.kernal_w(KERNAL_W_H - 1),
+				.kernal_h_dilated(KERNAL_W_H - 1),
+				.en_zero_cgrp_skip(dut_i == 1),
+				.zero_cgrp_map(zero_cgrp_map),
+				
+				.blk_start(blk_start),
+				.blk_idle(),
+				.blk_done(fmap_blk_done[dut_i]),
+				
+				.rst_adapter(),
+				.on_incr_phy_row_traffic(),
+				.cgrp_n_of_fmap_region_that_kernal_set_sel(),
+				
+				.m_fm_rd_req_axis_data(m_fm_rd_req_axis_data),
+				.m_fm_rd_req_axis_valid(m_fm_rd_req_axis_valid),
+				.m_fm_rd_req_axis_ready(fm_rd_req_ready[dut_i]),
+				
+				.m_fm_cake_info_axis_data(m_fm_cake_info_axis_data),
+				.m_fm_cake_info_axis_valid(m_fm_cake_info_axis_valid),
+				.m_fm_cake_info_axis_ready(fm_cake_info_ready[dut_i]),
+				
+				.mul0_op_a(mul0_op_a),
+				.mul0_op_b(mul0_op_b),
+				.mul0_tid(mul0_tid),
+				.mul0_req(mul0_req),
+				.mul0_grant(mul0_grant),
+				.mul0_res(mul0_res),
+				.mul0_oid(mul0_oid),
+				.mul0_ovld(mul0_ovld),
+				
+				.mul1_op_a(mul1_op_a),
+				.mul1_op_b(mul1_op_b),
+				.mul1_tid(mul1_tid),
+				.mul1_req(mul1_req),
+				.mul1_grant(mul1_grant),
+				.mul1_res(mul1_res),
+				.mul1_oid(mul1_oid),
+				.mul1_ovld(mul1_ovld)
+			);
+			
+			kernal_access_req_gen #(
+				.ATOMIC_C(ATOMIC_C),
+				.EN_REG_SLICE_IN_RD_REQ("true"),
+				.SIM_DELAY(simulation_delay)
+			)kernal_dut(
+				.aclk(clk),
+				.aresetn(rst_n),
+				.aclken(1'b1),
+				
+				.is_16bit_wgt(1'b1),
+				.kernal_wgt_baseaddr(32'd2048),
+				.kernal_chn_n(CGRP_N * ATOMIC_C - 1),
+				.kernal_num_n(KERNAL_NUM - 1),
+				.kernal_shape(KBUFGRPSZ_9),
+				.ofmap_h(OFMAP_H - 1),
+				.is_grp_conv_mode(1'b0),
+				.n_foreach_group(16'd0),
+				.group_n(16'd0),
+				.cgrpn_foreach_kernal_set(CGRP_N - 1),
+				.max_wgtblk_w(MAX_WGTBLK_W),
+				.conv_vertical_stride(3'd0),
+				.ext_i_bottom(EXT_I_BOTTOM),
+				.external_padding_top(PADDING_TOP),
+				.inner_padding_top_bottom(3'd0),
+				.kernal_dilation_vtc_n(4'd0),
+				.en_zero_cgrp_skip(dut_i == 1),
+				.zero_cgrp_map(zero_cgrp_map),
+				
+				.blk_start(blk_start),
+				.blk_idle(),
+				.blk_done(kernal_blk_done[dut_i]),
+				
+				.on_kernal_set_start(),
+				
+				.m_kwgtblk_rd_req_axis_data(m_kwgtblk_rd_req_axis_data),
+				.m_kwgtblk_rd_req_axis_valid(m_kwgtblk_rd_req_axis_valid),
+				.m_kwgtblk_rd_req_axis_ready(kwgtblk_rd_req_ready[dut_i]),
+				
+				.shared_mul_c0_op_a(shared_mul_c0_op_a),
+				.shared_mul_c0_op_b(shared_mul_c0_op_b),
+				.shared_mul_c0_tid(shared_mul_c0_tid),
+				.shared_mul_c0_req(shared_mul_c0_req),
+				.shared_mul_c0_grant(shared_mul_c0_grant),
+				.shared_mul_res(shared_mul_res),
+				.shared_mul_oid(shared_mul_oid),
+				.shared_mul_ovld(shared_mul_ovld)
+			);
+		end
+	endgenerate
+	
+endmodule
@@ -10,6 +10,12 @@
         2025.12.22 1.10 为最大池化增加非0常量填充模式
         2025.12.26 1.11 修改ctrl0寄存器
         2026.01.05 1.12 支持中间结果缓存时钟倍率
+        2026.10.16 1.13 增加完成中断(使能/除能中断, 设置完成阈值, 等待完成)
+        2026.10.16 1.14 增加影子配置寄存器(配置下一次处理, 提交配置并启动)
+        2026.10.16 1.15 性能监测计数器扩展为64位, 通过快照一次性读取
+        2026.10.16 1.16 通过可替换的寄存器访问后端读写寄存器区, DMA地址经总线地址转换
+        2026.10.17 1.17 增加输出特征图跨距配置(直接写入拼接后特征图的通道切片)
+        2026.10.17 1.18 增加输入特征图跨距配置(直接读取更大特征图中的区域或通道切片)
 ************************************************************************************************************************/
 
 #include "axi_generic_pool.h"
@@ -21,6 +27,7 @@
 
 // 各寄存器域的偏移地址
 #define REG_REGION_PROP_OFS 0x0000
+#define REG_REGION_PM_SNAP_OFS 0x0038
 #define REG_REGION_CTRL_OFS 0x0040
 #define REG_REGION_STS_OFS 0x0060
 #define REG_REGION_CAL_CFG_OFS 0x0080
@@ -29,37 +36,112 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static void axi_generic_pool_set_use_post_mac(AxiGnrPoolHandler* handler, uint8_t use_post_mac); // 设置是否启用后乘加处理
+static uint64_t axi_generic_pool_rd_pm_snap(AxiGnrPoolHandler* handler, uint8_t snap_id); // 读取性能监测计数器快照
+static int axi_generic_pool_wr_ofmap_cfg(AxiGnrPoolHandler* handler, const AxiGnrPoolFmapCfg* fmap_cfg,
+	uint16_t ofmap_w, uint16_t ofmap_h); // 检查输出特征图跨距并写输出特征图基地址和跨距
+static int axi_generic_pool_wr_ifmap_cfg(AxiGnrPoolHandler* handler, const AxiGnrPoolFmapCfg* fmap_cfg,
+	AxiGnrPoolCalFmt cal_fmt); // 检查输入特征图跨距并写输入特征图基地址和跨距
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@private
+@brief  读寄存器
+@param  handler 通用池化处理单元(加速器句柄)
+        reg 寄存器地址(由寄存器域指针得到)
+@return 读到的值
+*************************/
+static inline uint32_t axi_generic_pool_rd_reg(const AxiGnrPoolHandler* handler, const volatile uint32_t* reg){
+#ifdef AXI_GNR_POOL_MMIO_CB
+	return handler->mmio.rd(handler->mmio.mmio_arg, (uintptr_t)reg);
+#else
+	(void)handler;
+
+	return *reg;
+#endif
+}
+
+/*************************
+@private
+@brief  写寄存器
+@param  handler 通用池化处理单元(加速器句柄)
+        reg 寄存器地址(由寄存器域指针得到)
+        data 待写的值
+@return none
+*************************/
+static inline void axi_generic_pool_wr_reg(const AxiGnrPoolHandler* handler, volatile uint32_t* reg, uint32_t data){
+#ifdef AXI_GNR_POOL_MMIO_CB
+	handler->mmio.wr(handler->mmio.mmio_arg, (uintptr_t)reg, data);
+#else
+	(void)handler;
+
+	*reg = data;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 /*************************
 @init
 @public
-@brief  初始化通用池化处理单元
+@brief  初始化通用池化处理单元(以指针直接访问寄存器区)
 @param  handler 通用池化处理单元(加速器句柄)
         baseaddr 加速器基地址
 @return 是否成功
 *************************/
 int axi_generic_pool_init(AxiGnrPoolHandler* handler, uint32_t baseaddr){
-	uint32_t* test_ptr = (uint32_t*)baseaddr;
+	AxiGnrPoolMmio mmio;
+
+	memset((void*)&mmio, 0, sizeof(mmio));
+
+	mmio.reg_base = (uintptr_t)baseaddr;
+
+	return axi_generic_pool_init_mmio(handler, &mmio);
+}
+
+/*************************
+@init
+@public
+@brief  初始化通用池化处理单元(指定寄存器访问后端)
+@param  handler 通用池化处理单元(加速器句柄)
+        mmio 寄存器访问后端
+@return 是否成功
+*************************/
+int axi_generic_pool_init_mmio(AxiGnrPoolHandler* handler, const AxiGnrPoolMmio* mmio){
+#ifdef AXI_GNR_POOL_MMIO_CB
+	if(mmio->rd == NULL || mmio->wr == NULL){
+		return -1;
+	}
+#endif
+
+	handler->mmio = *mmio;
+
+	handler->reg_region_prop = (AxiGnrPoolRegRgnProp*)(mmio->reg_base + REG_REGION_PROP_OFS);
+	handler->reg_region_pm_snap = (AxiGnrPoolRegRgnPmSnap*)(mmio->reg_base + REG_REGION_PM_SNAP_OFS);
+	handler->reg_region_ctrl = (AxiGnrPoolRegRgnCtrl*)(mmio->reg_base + REG_REGION_CTRL_OFS);
+	handler->reg_region_sts = (AxiGnrPoolRegRgnSts*)(mmio->reg_base + REG_REGION_STS_OFS);
+	handler->reg_region_cal_cfg = (AxiGnrPoolRegRgnCalCfg*)(mmio->reg_base + REG_REGION_CAL_CFG_OFS);
+	handler->reg_region_fmap_cfg = (AxiGnrPoolRegRgnFmapCfg*)(mmio->reg_base + REG_REGION_FMAP_CFG_OFS);
+	handler->reg_region_buffer_cfg = (AxiGnrPoolRegRgnBufCfg*)(mmio->reg_base + REG_REGION_BUF_CFG_OFS);
 
-	if((test_ptr[1] & 0x3FFFFFFF) != POOL_ACC_TYPE){
+	if((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->acc_name) & 0x3FFFFFFF) != POOL_ACC_TYPE){
 		return -1;
 	}
 
-	handler->reg_base_ptr = (uint32_t*)baseaddr;
-	handler->reg_region_prop = (AxiGnrPoolRegRgnProp*)(baseaddr + REG_REGION_PROP_OFS);
-	handler->reg_region_ctrl = (AxiGnrPoolRegRgnCtrl*)(baseaddr + REG_REGION_CTRL_OFS);
-	handler->reg_region_sts = (AxiGnrPoolRegRgnSts*)(baseaddr + REG_REGION_STS_OFS);
-	handler->reg_region_cal_cfg = (AxiGnrPoolRegRgnCalCfg*)(baseaddr + REG_REGION_CAL_CFG_OFS);
-	handler->reg_region_fmap_cfg = (AxiGnrPoolRegRgnFmapCfg*)(baseaddr + REG_REGION_FMAP_CFG_OFS);
-	handler->reg_region_buffer_cfg = (AxiGnrPoolRegRgnBufCfg*)(baseaddr + REG_REGION_BUF_CFG_OFS);
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl3, 0x00000000);
+	handler->shadow_cfg_wen = 0;
+	handler->next_cfg_valid = 0;
+	handler->next_use_post_mac = 0;
 
-	uint32_t version_encoded = handler->reg_region_prop->version;
+	uint32_t version_encoded = axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->version);
 	handler->property.version[8] = '\0';
 	for(int i = 0;i < 8;i++){
 		handler->property.version[i] = '0' + (version_encoded & 0x0000000F);
 		version_encoded >>= 4;
 	}
 
-	uint32_t accelerator_type_encoded = handler->reg_region_prop->acc_name;
+	uint32_t accelerator_type_encoded = axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->acc_name);
 	handler->property.accelerator_type[6] = '\0';
 	for(int i = 0;i < 6;i++){
 		uint8_t now_c = (uint8_t)(accelerator_type_encoded & 0x0000001F);
@@ -70,91 +152,116 @@ int axi_generic_pool_init(AxiGnrPoolHandler* handler, uint32_t baseaddr){
 
 	handler->property.accelerator_id = (uint8_t)(accelerator_type_encoded >> 30);
 
-	handler->property.atomic_c = (uint8_t)(handler->reg_region_prop->info0 & 0x000000FF);
-	handler->property.post_mac_prl_n = (uint8_t)((handler->reg_region_prop->info0 >> 8) & 0x000000FF);
-	handler->property.max_fmbuf_row_n = (uint16_t)((handler->reg_region_prop->info0 >> 16) & 0x0000FFFF);
-	handler->property.mm2s_stream_data_width = (uint16_t)(handler->reg_region_prop->info1 & 0x0000FFFF);
-	handler->property.s2mm_stream_data_width = (uint16_t)((handler->reg_region_prop->info1 >> 16) & 0x0000FFFF);
-	handler->property.phy_buf_bank_n = (uint16_t)(handler->reg_region_prop->info2 & 0x0000FFFF);
-	handler->property.phy_buf_bank_depth = (uint16_t)((handler->reg_region_prop->info2 >> 16) & 0x0000FFFF);
-	handler->property.mid_res_buf_bank_n = (uint16_t)(handler->reg_region_prop->info3 & 0x0000FFFF);
-	handler->property.mid_res_buf_bank_depth = (uint16_t)((handler->reg_region_prop->info3 >> 16) & 0x0000FFFF);
-
-	handler->reg_region_cal_cfg->cal_cfg0 = (uint32_t)PROC_MODE_AVG;
-	if((handler->reg_region_cal_cfg->cal_cfg0 & 0x0000000F) == PROC_MODE_AVG){
+	handler->property.atomic_c = (uint8_t)(axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info0) & 0x000000FF);
+	handler->property.post_mac_prl_n = (uint8_t)((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info0) >> 8) & 0x000000FF);
+	handler->property.max_fmbuf_row_n = (uint16_t)((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info0) >> 16) & 0x0000FFFF);
+	handler->property.mm2s_stream_data_width = (uint16_t)(axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info1) & 0x0000FFFF);
+	handler->property.s2mm_stream_data_width = (uint16_t)((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info1) >> 16) & 0x0000FFFF);
+	handler->property.phy_buf_bank_n = (uint16_t)(axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info2) & 0x0000FFFF);
+	handler->property.phy_buf_bank_depth = (uint16_t)((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info2) >> 16) & 0x0000FFFF);
+	handler->property.mid_res_buf_bank_n = (uint16_t)(axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info3) & 0x0000FFFF);
+	handler->property.mid_res_buf_bank_depth = (uint16_t)((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info3) >> 16) & 0x0000FFFF);
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0, (uint32_t)PROC_MODE_AVG);
+	if((axi_generic_pool_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0) & 0x0000000F) == PROC_MODE_AVG){
 		handler->property.avg_pool_supported = 1;
 	}else{
 		handler->property.avg_pool_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg0 = (uint32_t)PROC_MODE_MAX;
-	if((handler->reg_region_cal_cfg->cal_cfg0 & 0x0000000F) == PROC_MODE_MAX){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0, (uint32_t)PROC_MODE_MAX);
+	if((axi_generic_pool_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0) & 0x0000000F) == PROC_MODE_MAX){
 		handler->property.max_pool_supported = 1;
 	}else{
 		handler->property.max_pool_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg0 = (uint32_t)PROC_MODE_UPSP;
-	if((handler->reg_region_cal_cfg->cal_cfg0 & 0x0000000F) == PROC_MODE_UPSP){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0, (uint32_t)PROC_MODE_UPSP);
+	if((axi_generic_pool_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0) & 0x0000000F) == PROC_MODE_UPSP){
 		handler->property.up_sample_supported = 1;
 	}else{
 		handler->property.up_sample_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg0 = (((uint32_t)POOL_INT8) << 4);
-	if(((handler->reg_region_cal_cfg->cal_cfg0 >> 4) & 0x0000000F) == POOL_INT8){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0, (((uint32_t)POOL_INT8) << 4));
+	if(((axi_generic_pool_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0) >> 4) & 0x0000000F) == POOL_INT8){
 		handler->property.int8_supported = 1;
 	}else{
 		handler->property.int8_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg0 = (((uint32_t)POOL_INT16) << 4);
-	if(((handler->reg_region_cal_cfg->cal_cfg0 >> 4) & 0x0000000F) == POOL_INT16){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0, (((uint32_t)POOL_INT16) << 4));
+	if(((axi_generic_pool_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0) >> 4) & 0x0000000F) == POOL_INT16){
 		handler->property.int16_supported = 1;
 	}else{
 		handler->property.int16_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg0 = (((uint32_t)POOL_FP16) << 4);
-	if(((handler->reg_region_cal_cfg->cal_cfg0 >> 4) & 0x0000000F) == POOL_FP16){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0, (((uint32_t)POOL_FP16) << 4));
+	if(((axi_generic_pool_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0) >> 4) & 0x0000000F) == POOL_FP16){
 		handler->property.fp16_supported = 1;
 	}else{
 		handler->property.fp16_supported = 0;
 	}
 
-	if(((handler->reg_region_prop->info0 >> 8) & 0x000000FF) != 0x00){
+	if(((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info0) >> 8) & 0x000000FF) != 0x00){
 		handler->property.post_mac_supported = 1;
 	}else{
 		handler->property.post_mac_supported = 0;
 	}
 
-	handler->reg_region_fmap_cfg->fmap_cfg4 = 0x01010000;
-	if(handler->reg_region_fmap_cfg->fmap_cfg4 == 0x01010000){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4, 0x01010000);
+	if(axi_generic_pool_rd_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4) == 0x01010000){
 		handler->property.ext_padding_supported = 1;
 	}else{
 		handler->property.ext_padding_supported = 0;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg2 = 0x00000001;
-	if(handler->reg_region_cal_cfg->cal_cfg2 == 0x00000001){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg2, 0x00000001);
+	if(axi_generic_pool_rd_reg(handler, &handler->reg_region_cal_cfg->cal_cfg2) == 0x00000001){
 		handler->property.non_zero_const_padding_supported = 1;
 	}else{
 		handler->property.non_zero_const_padding_supported = 0;
 	}
 
-	handler->reg_region_ctrl->ctrl0 = (0x00000001 << 11);
-	if(handler->reg_region_ctrl->ctrl0 & (0x00000001 << 11)){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, (0x00000001 << 11));
+	if(axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0) & (0x00000001 << 11)){
 		handler->property.performance_monitor_supported = 1;
 	}else{
 		handler->property.performance_monitor_supported = 0;
 	}
-	handler->reg_region_ctrl->ctrl0 = 0x00000000;
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, 0x00000000);
 
-	handler->property.mid_res_buf_clk_rate = (uint8_t)(handler->reg_region_prop->info4 & 0x0000000F);
+	handler->property.mid_res_buf_clk_rate = (uint8_t)(axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info4) & 0x0000000F);
+	handler->property.ofmap_pitch_supported = (uint8_t)((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info4) >> 8) & 0x00000001);
+	handler->property.ifmap_pitch_supported = (uint8_t)((axi_generic_pool_rd_reg(handler, &handler->reg_region_prop->info4) >> 9) & 0x00000001);
+
+	handler->done_threshold = 0;
+	handler->wait_hook = NULL;
+	handler->wait_hook_arg = NULL;
+
+	axi_generic_pool_disable_irq(handler);
+	axi_generic_pool_clr_irq(handler);
 
 	return 0;
 }
 
+/*************************
+@cfg
+@public
+@brief  把主机指针转换为加速器DMA使用的总线地址
+@param  handler 通用池化处理单元(加速器句柄)
+        ptr 主机指针
+@return 总线地址
+*************************/
+uint32_t axi_generic_pool_bus_addr(AxiGnrPoolHandler* handler, const void* ptr){
+	if(handler->mmio.bus_addr == NULL){
+		return (uint32_t)((uintptr_t)ptr);
+	}else{
+		return handler->mmio.bus_addr(handler->mmio.bus_addr_arg, ptr);
+	}
+}
+
 /*************************
 @ctrl
 @public
@@ -163,9 +270,9 @@ int axi_generic_pool_init(AxiGnrPoolHandler* handler, uint32_t baseaddr){
 @return 是否成功
 *************************/
 int axi_generic_pool_enable(AxiGnrPoolHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | (0x00000001 << 8);
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | (0x00000001 << 8));
 
 	return 0;
 }
@@ -178,9 +285,9 @@ int axi_generic_pool_enable(AxiGnrPoolHandler* handler){
 @return none
 *************************/
 void axi_generic_pool_disable(AxiGnrPoolHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~(0x00000001 << 8));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~(0x00000001 << 8)));
 }
 
 /*************************
@@ -191,9 +298,9 @@ void axi_generic_pool_disable(AxiGnrPoolHandler* handler){
 @return 是否成功
 *************************/
 int axi_generic_pool_enable_cal_sub_sys(AxiGnrPoolHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | (0x00000001 << 9);
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | (0x00000001 << 9));
 
 	return 0;
 }
@@ -206,9 +313,9 @@ int axi_generic_pool_enable_cal_sub_sys(AxiGnrPoolHandler* handler){
 @return none
 *************************/
 void axi_generic_pool_disable_cal_sub_sys(AxiGnrPoolHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~(0x00000001 << 9));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~(0x00000001 << 9)));
 }
 
 /*************************
@@ -223,9 +330,9 @@ int axi_generic_pool_enable_pm_cnt(AxiGnrPoolHandler* handler){
 		return -1;
 	}
 
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | (0x00000001 << 11);
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | (0x00000001 << 11));
 
 	return 0;
 }
@@ -238,9 +345,9 @@ int axi_generic_pool_enable_pm_cnt(AxiGnrPoolHandler* handler){
 @return none
 *************************/
 void axi_generic_pool_disable_pm_cnt(AxiGnrPoolHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~(0x00000001 << 11));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~(0x00000001 << 11)));
 }
 
 /*************************
@@ -251,7 +358,7 @@ void axi_generic_pool_disable_pm_cnt(AxiGnrPoolHandler* handler){
 @return 是否成功
 *************************/
 int axi_generic_pool_start(AxiGnrPoolHandler* handler){
-	uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+	uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
 
 	if(!(pre_ctrl0 & (0x00000001 << 9))){
 		return -1;
@@ -261,7 +368,7 @@ int axi_generic_pool_start(AxiGnrPoolHandler* handler){
 		return -2;
 	}
 
-	handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | 0x00000003;
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | 0x00000003);
 
 	return 0;
 }
@@ -275,7 +382,7 @@ int axi_generic_pool_start(AxiGnrPoolHandler* handler){
 *************************/
 uint8_t axi_generic_pool_is_busy(AxiGnrPoolHandler* handler){
 	// 注意: 仅仅检查"请求生成单元是否空闲"是不够的!
-	if((handler->reg_region_sts->sts0 & 0x00000003) != 0x00000003){
+	if((axi_generic_pool_rd_reg(handler, &handler->reg_region_sts->sts0) & 0x00000003) != 0x00000003){
 		return 1;
 	}
 
@@ -398,63 +505,61 @@ int axi_generic_pool_cfg_in_pool_mode(
 		return -2;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg0 =
+	if(axi_generic_pool_wr_ofmap_cfg(handler, fmap_cfg, ofmap_w, ofmap_h)){
+		return -2;
+	}
+
+	if(axi_generic_pool_wr_ifmap_cfg(handler, fmap_cfg, cal_cfg->cal_fmt)){
+		return -2;
+	}
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0,
 		(((uint32_t)mode) << 0) |
 		(((uint32_t)cal_cfg->cal_fmt) << 4) |
 		(((uint32_t)(cal_cfg->horizontal_stride - 1)) << 8) |
-		(((uint32_t)(cal_cfg->vertical_stride - 1)) << 16);
-	handler->reg_region_cal_cfg->cal_cfg1 =
+		(((uint32_t)(cal_cfg->vertical_stride - 1)) << 16));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg1,
 		(((uint32_t)(cal_cfg->pool_window_w - 1)) << 0) |
-		(((uint32_t)(cal_cfg->pool_window_h - 1)) << 8);
-	handler->reg_region_cal_cfg->cal_cfg2 =
+		(((uint32_t)(cal_cfg->pool_window_h - 1)) << 8));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg2,
 		(((uint32_t)cal_cfg->non_zero_const_padding_mode) << 0) |
-		(((uint32_t)cal_cfg->const_to_fill) << 16);
-
-	if(cal_cfg->use_post_mac){
-		uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
+		(((uint32_t)cal_cfg->const_to_fill) << 16));
 
-		handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | (0x00000001 << 10);
+	axi_generic_pool_set_use_post_mac(handler, cal_cfg->use_post_mac);
 
-		handler->reg_region_cal_cfg->cal_cfg3 =
+	if(cal_cfg->use_post_mac){
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg3,
 			(((uint32_t)cal_cfg->post_mac_is_a_eq_1) << 0) |
 			(((uint32_t)cal_cfg->post_mac_is_b_eq_0) << 1) |
-			(((uint32_t)cal_cfg->post_mac_fixed_point_quat_accrc) << 8);
-		handler->reg_region_cal_cfg->cal_cfg4 =
-			(uint32_t)cal_cfg->post_mac_param_a;
-		handler->reg_region_cal_cfg->cal_cfg5 =
-			(uint32_t)cal_cfg->post_mac_param_b;
-	}else{
-		uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
-
-		handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~(0x00000001 << 10));
+			(((uint32_t)cal_cfg->post_mac_fixed_point_quat_accrc) << 8));
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg4,
+			(uint32_t)cal_cfg->post_mac_param_a);
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg5,
+			(uint32_t)cal_cfg->post_mac_param_b);
 	}
 
-	handler->reg_region_fmap_cfg->fmap_cfg0 =
-		(uint32_t)fmap_cfg->ifmap_baseaddr;
-	handler->reg_region_fmap_cfg->fmap_cfg1 =
-		(uint32_t)fmap_cfg->ofmap_baseaddr;
-	handler->reg_region_fmap_cfg->fmap_cfg2 =
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg2,
 		(((uint32_t)(fmap_cfg->ifmap_w - 1)) << 0) |
-		(((uint32_t)(fmap_cfg->ifmap_h - 1)) << 16);
-	handler->reg_region_fmap_cfg->fmap_cfg3 =
-		ifmap_size - 1;
-	handler->reg_region_fmap_cfg->fmap_cfg4 =
+		(((uint32_t)(fmap_cfg->ifmap_h - 1)) << 16));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg3,
+		ifmap_size - 1);
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4,
 		(((uint32_t)(fmap_cfg->ifmap_c - 1)) << 0) |
 		(((uint32_t)fmap_cfg->external_padding_left) << 16) |
-		(((uint32_t)fmap_cfg->external_padding_top) << 24);
-	handler->reg_region_fmap_cfg->fmap_cfg5 =
+		(((uint32_t)fmap_cfg->external_padding_top) << 24));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg5,
 		(((uint32_t)(ext_fmap_w - 1)) << 0) |
-		(((uint32_t)(ext_fmap_h - 1)) << 16);
-	handler->reg_region_fmap_cfg->fmap_cfg6 =
+		(((uint32_t)(ext_fmap_h - 1)) << 16));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg6,
 		(((uint32_t)(ofmap_w - 1)) << 0) |
 		(((uint32_t)(ofmap_h - 1)) << 15) |
-		(((uint32_t)fmap_cfg->ofmap_data_type) << 30);
+		(((uint32_t)fmap_cfg->ofmap_data_type) << 30));
 
-	handler->reg_region_buffer_cfg->buf_cfg0 =
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_buffer_cfg->buf_cfg0,
 		(((uint32_t)(buffer_cfg->fmbufcoln)) << 0) |
-		(((uint32_t)(fmbuf_row_n - 1)) << 16);
-	handler->reg_region_buffer_cfg->buf_cfg1 =
-		(uint32_t)(mid_res_buf_row_n_bufferable - 1);
+		(((uint32_t)(fmbuf_row_n - 1)) << 16));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_buffer_cfg->buf_cfg1,
+		(uint32_t)(mid_res_buf_row_n_bufferable - 1));
 
 	return 0;
 }
@@ -545,61 +650,278 @@ int axi_generic_pool_cfg_in_up_sample_mode(
 		return -2;
 	}
 
-	handler->reg_region_cal_cfg->cal_cfg0 =
+	if(axi_generic_pool_wr_ofmap_cfg(handler, fmap_cfg, ofmap_w, ofmap_h)){
+		return -2;
+	}
+
+	if(axi_generic_pool_wr_ifmap_cfg(handler, fmap_cfg, cal_cfg->cal_fmt)){
+		return -2;
+	}
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg0,
 		(((uint32_t)PROC_MODE_UPSP) << 0) |
-		(((uint32_t)cal_cfg->cal_fmt) << 4);
-	handler->reg_region_cal_cfg->cal_cfg1 =
+		(((uint32_t)cal_cfg->cal_fmt) << 4));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg1,
 		(((uint32_t)(cal_cfg->upsample_horizontal_n - 1)) << 0) |
-		(((uint32_t)(cal_cfg->upsample_vertical_n - 1)) << 8);
-	handler->reg_region_cal_cfg->cal_cfg2 =
+		(((uint32_t)(cal_cfg->upsample_vertical_n - 1)) << 8));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg2,
 		(((uint32_t)cal_cfg->non_zero_const_padding_mode) << 0) |
-		(((uint32_t)cal_cfg->const_to_fill) << 16);
+		(((uint32_t)cal_cfg->const_to_fill) << 16));
 
-	if(cal_cfg->use_post_mac){
-		uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
-
-		handler->reg_region_ctrl->ctrl0 = pre_ctrl0 | (0x00000001 << 10);
+	axi_generic_pool_set_use_post_mac(handler, cal_cfg->use_post_mac);
 
-		handler->reg_region_cal_cfg->cal_cfg3 =
+	if(cal_cfg->use_post_mac){
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg3,
 			(((uint32_t)cal_cfg->post_mac_is_a_eq_1) << 0) |
 			(((uint32_t)cal_cfg->post_mac_is_b_eq_0) << 1) |
-			(((uint32_t)cal_cfg->post_mac_fixed_point_quat_accrc) << 8);
-		handler->reg_region_cal_cfg->cal_cfg4 =
-			(uint32_t)cal_cfg->post_mac_param_a;
-		handler->reg_region_cal_cfg->cal_cfg5 =
-			(uint32_t)cal_cfg->post_mac_param_b;
-	}else{
-		uint32_t pre_ctrl0 = handler->reg_region_ctrl->ctrl0;
-
-		handler->reg_region_ctrl->ctrl0 = pre_ctrl0 & (~(0x00000001 << 10));
+			(((uint32_t)cal_cfg->post_mac_fixed_point_quat_accrc) << 8));
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg4,
+			(uint32_t)cal_cfg->post_mac_param_a);
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_cal_cfg->cal_cfg5,
+			(uint32_t)cal_cfg->post_mac_param_b);
 	}
 
-	handler->reg_region_fmap_cfg->fmap_cfg0 =
-		(uint32_t)fmap_cfg->ifmap_baseaddr;
-	handler->reg_region_fmap_cfg->fmap_cfg1 =
-		(uint32_t)fmap_cfg->ofmap_baseaddr;
-	handler->reg_region_fmap_cfg->fmap_cfg2 =
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg2,
 		(((uint32_t)(fmap_cfg->ifmap_w - 1)) << 0) |
-		(((uint32_t)(fmap_cfg->ifmap_h - 1)) << 16);
-	handler->reg_region_fmap_cfg->fmap_cfg3 =
-		ifmap_size - 1;
-	handler->reg_region_fmap_cfg->fmap_cfg4 =
+		(((uint32_t)(fmap_cfg->ifmap_h - 1)) << 16));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg3,
+		ifmap_size - 1);
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg4,
 		(((uint32_t)(fmap_cfg->ifmap_c - 1)) << 0) |
 		(((uint32_t)fmap_cfg->external_padding_left) << 16) |
-		(((uint32_t)fmap_cfg->external_padding_top) << 24);
-	handler->reg_region_fmap_cfg->fmap_cfg5 =
+		(((uint32_t)fmap_cfg->external_padding_top) << 24));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg5,
 		(((uint32_t)(ext_fmap_w - 1)) << 0) |
-		(((uint32_t)(ext_fmap_h - 1)) << 16);
-	handler->reg_region_fmap_cfg->fmap_cfg6 =
+		(((uint32_t)(ext_fmap_h - 1)) << 16));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg6,
 		(((uint32_t)(ofmap_w - 1)) << 0) |
 		(((uint32_t)(ofmap_h - 1)) << 15) |
-		(((uint32_t)fmap_cfg->ofmap_data_type) << 30);
+		(((uint32_t)fmap_cfg->ofmap_data_type) << 30));
 
-	handler->reg_region_buffer_cfg->buf_cfg0 =
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_buffer_cfg->buf_cfg0,
 		(((uint32_t)(buffer_cfg->fmbufcoln)) << 0) |
-		(((uint32_t)(fmbuf_row_n - 1)) << 16);
-	handler->reg_region_buffer_cfg->buf_cfg1 =
-		(uint32_t)(mid_res_buf_row_n_bufferable - 1);
+		(((uint32_t)(fmbuf_row_n - 1)) << 16));
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_buffer_cfg->buf_cfg1,
+		(uint32_t)(mid_res_buf_row_n_bufferable - 1));
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  以池化模式配置下一次处理(写影子配置寄存器)
+        可在通用池化处理单元忙碌时调用, 配置会在下一次调用axi_generic_pool_commit_and_start时被提交
+@param  handler 通用池化处理单元(加速器句柄)
+		mode 池化模式
+        fmap_cfg 特征图配置参数(句柄)
+        buffer_cfg 缓存配置参数(句柄)
+        cal_cfg 池化处理配置参数(句柄)
+@return 是否成功
+*************************/
+int axi_generic_pool_cfg_next_in_pool_mode(
+	AxiGnrPoolHandler* handler,
+	AxiGnrPoolProcMode mode,
+	const AxiGnrPoolFmapCfg* fmap_cfg, const AxiGnrPoolBufferCfg* buffer_cfg, const AxiGnrPoolPoolModeCfg* cal_cfg
+){
+	int res;
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl3, 0x00000001);
+	handler->shadow_cfg_wen = 1;
+
+	res = axi_generic_pool_cfg_in_pool_mode(handler, mode, fmap_cfg, buffer_cfg, cal_cfg);
+
+	handler->shadow_cfg_wen = 0;
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl3, 0x00000000);
+
+	if(res == 0){
+		handler->next_cfg_valid = 1;
+	}
+
+	return res;
+}
+
+/*************************
+@cfg
+@public
+@brief  以上采样模式配置下一次处理(写影子配置寄存器)
+        可在通用池化处理单元忙碌时调用, 配置会在下一次调用axi_generic_pool_commit_and_start时被提交
+@param  handler 通用池化处理单元(加速器句柄)
+        fmap_cfg 特征图配置参数(句柄)
+        buffer_cfg 缓存配置参数(句柄)
+        cal_cfg 上采样处理配置参数(句柄)
+@return 是否成功
+*************************/
+int axi_generic_pool_cfg_next_in_up_sample_mode(
+	AxiGnrPoolHandler* handler,
+	const AxiGnrPoolFmapCfg* fmap_cfg, const AxiGnrPoolBufferCfg* buffer_cfg, const AxiGnrPoolUpsModeCfg* cal_cfg
+){
+	int res;
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl3, 0x00000001);
+	handler->shadow_cfg_wen = 1;
+
+	res = axi_generic_pool_cfg_in_up_sample_mode(handler, fmap_cfg, buffer_cfg, cal_cfg);
+
+	handler->shadow_cfg_wen = 0;
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl3, 0x00000000);
+
+	if(res == 0){
+		handler->next_cfg_valid = 1;
+	}
+
+	return res;
+}
+
+/*************************
+@ctrl
+@public
+@brief  提交下一次处理的配置并启动通用池化处理单元
+        待提交的影子配置寄存器与"是否启用后乘加处理"会在启动的同时生效
+@param  handler 通用池化处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_generic_pool_commit_and_start(AxiGnrPoolHandler* handler){
+	uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
+
+	if(!(pre_ctrl0 & (0x00000001 << 9))){
+		return -1;
+	}
+
+	if(axi_generic_pool_is_busy(handler)){
+		return -2;
+	}
+
+	if(handler->next_cfg_valid){
+		pre_ctrl0 = (pre_ctrl0 & (~(0x00000001 << 10))) | (handler->next_use_post_mac ? (0x00000001 << 10):0x00000000);
+		handler->next_cfg_valid = 0;
+	}
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | 0x00000003);
+
+	return 0;
+}
+
+/*************************
+@sts
+@public
+@brief  判断是否存在待提交的下一次配置
+@param  handler 通用池化处理单元(加速器句柄)
+@return 是否存在待提交的配置
+*************************/
+uint8_t axi_generic_pool_is_next_cfg_pending(AxiGnrPoolHandler* handler){
+	return (handler->next_cfg_valid || (axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl3) & 0x00000002)) ? 0x01:0x00;
+}
+
+/*************************
+@ctrl
+@private
+@brief  设置是否启用后乘加处理
+        正在写影子配置寄存器时仅作记录, 在提交配置时生效
+@param  handler 通用池化处理单元(加速器句柄)
+        use_post_mac 是否启用后乘加处理
+@return none
+*************************/
+static void axi_generic_pool_set_use_post_mac(AxiGnrPoolHandler* handler, uint8_t use_post_mac){
+	if(handler->shadow_cfg_wen){
+		handler->next_use_post_mac = use_post_mac;
+	}else{
+		uint32_t pre_ctrl0 = axi_generic_pool_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
+
+		if(use_post_mac){
+			axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 | (0x00000001 << 10));
+		}else{
+			axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, pre_ctrl0 & (~(0x00000001 << 10)));
+		}
+	}
+}
+
+/*************************
+@cfg
+@private
+@brief  检查输出特征图跨距并写输出特征图基地址和跨距
+        通道偏移折算到输出特征图基地址, 跨距均为0时按紧密存储写出
+@param  handler 通用池化处理单元(加速器句柄)
+        fmap_cfg 特征图配置参数(句柄)
+        ofmap_w 输出特征图宽度
+        ofmap_h 输出特征图高度
+@return 是否成功
+*************************/
+static int axi_generic_pool_wr_ofmap_cfg(AxiGnrPoolHandler* handler, const AxiGnrPoolFmapCfg* fmap_cfg,
+	uint16_t ofmap_w, uint16_t ofmap_h){
+	uint32_t row_pitch = 0; // 表面行跨距
+	uint32_t cgrp_pitch = 0; // 通道组跨距
+	uint32_t chn_ofs_byte_n = 0; // 通道偏移对应的字节数
+
+	if(fmap_cfg->ofmap_chn_ofs || fmap_cfg->ofmap_row_pitch || fmap_cfg->ofmap_cgrp_pitch){
+		uint32_t ofmap_data_byte_n =
+			(fmap_cfg->ofmap_data_type == POOL_O_1_BYTE) ? 1:
+			(fmap_cfg->ofmap_data_type == POOL_O_2_BYTE) ? 2:4;
+		uint32_t dense_row_pitch = ((uint32_t)ofmap_w) * ((uint32_t)handler->property.atomic_c) * ofmap_data_byte_n;
+
+		row_pitch = fmap_cfg->ofmap_row_pitch ? fmap_cfg->ofmap_row_pitch:dense_row_pitch;
+		cgrp_pitch = fmap_cfg->ofmap_cgrp_pitch ? fmap_cfg->ofmap_cgrp_pitch:(row_pitch * ofmap_h);
+
+		if((!handler->property.ofmap_pitch_supported) ||
+			(fmap_cfg->ofmap_chn_ofs % handler->property.atomic_c) || (fmap_cfg->ifmap_c % handler->property.atomic_c) ||
+			row_pitch < dense_row_pitch || row_pitch > 0x00FFFFFF ||
+			(((uint64_t)cgrp_pitch) < ((uint64_t)row_pitch) * ofmap_h)){
+			return -1;
+		}
+
+		chn_ofs_byte_n = ((uint32_t)(fmap_cfg->ofmap_chn_ofs / handler->property.atomic_c)) * cgrp_pitch;
+	}
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg1,
+		axi_generic_pool_bus_addr(handler, fmap_cfg->ofmap_baseaddr) + chn_ofs_byte_n);
+
+	if(handler->property.ofmap_pitch_supported){
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg7, row_pitch);
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg8, cgrp_pitch);
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  检查输入特征图跨距并写输入特征图基地址和跨距
+        起始通道组折算到输入特征图基地址, 跨距均为0时按紧密存储读取
+@param  handler 通用池化处理单元(加速器句柄)
+        fmap_cfg 特征图配置参数(句柄)
+        cal_fmt 运算数据格式
+@return 是否成功
+*************************/
+static int axi_generic_pool_wr_ifmap_cfg(AxiGnrPoolHandler* handler, const AxiGnrPoolFmapCfg* fmap_cfg,
+	AxiGnrPoolCalFmt cal_fmt){
+	uint32_t row_pitch = 0; // 表面行跨距
+	uint32_t cgrp_pitch = 0; // 通道组跨距
+	uint32_t cgrp_ofs_byte_n = 0; // 起始通道组对应的字节数
+
+	if(fmap_cfg->ifmap_start_cgrp || fmap_cfg->ifmap_row_pitch || fmap_cfg->ifmap_cgrp_pitch){
+		uint32_t dense_row_pitch =
+			((uint32_t)fmap_cfg->ifmap_w) * ((uint32_t)handler->property.atomic_c) * (cal_fmt == POOL_INT8 ? 1:2);
+
+		row_pitch = fmap_cfg->ifmap_row_pitch ? fmap_cfg->ifmap_row_pitch:dense_row_pitch;
+		cgrp_pitch = fmap_cfg->ifmap_cgrp_pitch ? fmap_cfg->ifmap_cgrp_pitch:(row_pitch * fmap_cfg->ifmap_h);
+
+		if((!handler->property.ifmap_pitch_supported) || (fmap_cfg->ifmap_c % handler->property.atomic_c) ||
+			row_pitch < dense_row_pitch || row_pitch > 0x00FFFFFF ||
+			(((uint64_t)cgrp_pitch) < ((uint64_t)row_pitch) * fmap_cfg->ifmap_h)){
+			return -1;
+		}
+
+		cgrp_ofs_byte_n = ((uint32_t)fmap_cfg->ifmap_start_cgrp) * cgrp_pitch;
+	}
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg0,
+		axi_generic_pool_bus_addr(handler, fmap_cfg->ifmap_baseaddr) + cgrp_ofs_byte_n);
+
+	if(handler->property.ifmap_pitch_supported){
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg9, row_pitch);
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_fmap_cfg->fmap_cfg10, cgrp_pitch);
+	}
 
 	return 0;
 }
@@ -615,9 +937,9 @@ int axi_generic_pool_cfg_in_up_sample_mode(
 uint32_t axi_generic_pool_get_cmd_fns_n(AxiGnrPoolHandler* handler, AxiGnrPoolCmdFnsNQueryType query_type){
 	switch(query_type){
 	case POOL_Q_CMD_FNS_N_MM2S:
-		return handler->reg_region_sts->sts1;
+		return axi_generic_pool_rd_reg(handler, &handler->reg_region_sts->sts1);
 	case POOL_Q_CMD_FNS_N_S2MM:
-		return handler->reg_region_sts->sts2;
+		return axi_generic_pool_rd_reg(handler, &handler->reg_region_sts->sts2);
 	}
 
 	return 0xFFFFFFFF;
@@ -633,11 +955,11 @@ uint32_t axi_generic_pool_get_cmd_fns_n(AxiGnrPoolHandler* handler, AxiGnrPoolCm
 *************************/
 int axi_generic_pool_clr_cmd_fns_n(AxiGnrPoolHandler* handler, AxiGnrPoolCmdFnsNClrType clr_type){
 	if(clr_type == POOL_C_CMD_FNS_N_MM2S || clr_type == POOL_C_ALL){
-		handler->reg_region_sts->sts1 = 0;
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_sts->sts1, 0);
 	}
 
 	if(clr_type == POOL_C_CMD_FNS_N_S2MM || clr_type == POOL_C_ALL){
-		handler->reg_region_sts->sts2 = 0;
+		axi_generic_pool_wr_reg(handler, &handler->reg_region_sts->sts2, 0);
 	}
 
 	return 0;
@@ -656,10 +978,13 @@ int axi_generic_pool_get_pm_cnt(AxiGnrPoolHandler* handler, AxiGnrPoolPerfMonsts
 		return -1;
 	}
 
-	pm_sts->cycle_n = handler->reg_region_sts->sts3;
-	pm_sts->mm2s_tsf_n = handler->reg_region_sts->sts4;
-	pm_sts->s2mm_tsf_n = handler->reg_region_sts->sts5;
-	pm_sts->upd_grp_run_n = handler->reg_region_sts->sts6;
+	// 在同1个周期锁存所有计数器
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl4, 0x00000001);
+
+	pm_sts->cycle_n = axi_generic_pool_rd_pm_snap(handler, 0);
+	pm_sts->mm2s_tsf_n = axi_generic_pool_rd_pm_snap(handler, 1);
+	pm_sts->s2mm_tsf_n = axi_generic_pool_rd_pm_snap(handler, 2);
+	pm_sts->upd_grp_run_n = axi_generic_pool_rd_pm_snap(handler, 3);
 
 	return 0;
 }
@@ -676,9 +1001,119 @@ int axi_generic_pool_clr_pm_cnt(AxiGnrPoolHandler* handler){
 		return -1;
 	}
 
-	handler->reg_region_sts->sts3 = 0;
-	handler->reg_region_sts->sts4 = 0;
-	handler->reg_region_sts->sts5 = 0;
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_sts->sts3, 0);
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_sts->sts4, 0);
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_sts->sts5, 0);
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  使能完成中断
+@param  handler 通用池化处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_generic_pool_enable_irq(AxiGnrPoolHandler* handler){
+	if(handler->done_threshold == 0){
+		return -1;
+	}
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl1, 0x00000001);
 
 	return 0;
 }
+
+/*************************
+@ctrl
+@public
+@brief  除能完成中断
+@param  handler 通用池化处理单元(加速器句柄)
+@return none
+*************************/
+void axi_generic_pool_disable_irq(AxiGnrPoolHandler* handler){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl1, 0x00000000);
+}
+
+/*************************
+@cfg
+@public
+@brief  设置完成阈值
+@param  handler 通用池化处理单元(加速器句柄)
+        s2mm_cmd_n 完成时S2MM通道完成的命令数
+@return 是否成功
+*************************/
+int axi_generic_pool_set_done_threshold(AxiGnrPoolHandler* handler, uint32_t s2mm_cmd_n){
+	if(s2mm_cmd_n == 0){
+		return -2;
+	}
+
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl2, s2mm_cmd_n);
+	handler->done_threshold = s2mm_cmd_n;
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  清除完成中断等待标志
+@param  handler 通用池化处理单元(加速器句柄)
+@return none
+*************************/
+void axi_generic_pool_clr_irq(AxiGnrPoolHandler* handler){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_sts->sts7, 0x00000001);
+}
+
+/*************************
+@cfg
+@public
+@brief  设置等待完成时的回调函数
+@param  handler 通用池化处理单元(加速器句柄)
+        hook 回调函数(可以为NULL)
+        arg 回调函数的参数
+@return none
+*************************/
+void axi_generic_pool_set_wait_hook(AxiGnrPoolHandler* handler, AxiGnrPoolWaitHook hook, void* arg){
+	handler->wait_hook = hook;
+	handler->wait_hook_arg = arg;
+}
+
+/*************************
+@sts
+@public
+@brief  等待通用池化处理单元完成(S2MM通道完成的命令数达到完成阈值),
+        等待期间反复调用回调函数(如令CPU休眠直到完成中断到来), 未设置回调函数时退化为轮询
+@param  handler 通用池化处理单元(加速器句柄)
+@return 是否成功
+*************************/
+int axi_generic_pool_wait_done(AxiGnrPoolHandler* handler){
+	if(handler->done_threshold == 0){
+		return -1;
+	}
+
+	while(axi_generic_pool_rd_reg(handler, &handler->reg_region_sts->sts2) < handler->done_threshold){
+		if(handler->wait_hook != NULL){
+			handler->wait_hook(handler->wait_hook_arg);
+		}
+	}
+
+	axi_generic_pool_clr_irq(handler);
+
+	return 0;
+}
+
+/*************************
+@sts
+@private
+@brief  读取性能监测计数器快照
+@param  handler 通用池化处理单元(加速器句柄)
+        snap_id 快照编号
+@return 快照值
+*************************/
+static uint64_t axi_generic_pool_rd_pm_snap(AxiGnrPoolHandler* handler, uint8_t snap_id){
+	axi_generic_pool_wr_reg(handler, &handler->reg_region_ctrl->ctrl4, ((uint32_t)(snap_id & 0x0F)) << 8);
+
+	return (((uint64_t)axi_generic_pool_rd_reg(handler, &handler->reg_region_pm_snap->pm_snap_hi)) << 32) | ((uint64_t)axi_generic_pool_rd_reg(handler, &handler->reg_region_pm_snap->pm_snap_lo));
+}
@@ -10,6 +10,12 @@
         2025.12.22 1.10 为最大池化增加非0常量填充模式
         2025.12.26 1.11 修改ctrl0寄存器
         2026.01.05 1.12 支持中间结果缓存时钟倍率
+        2026.10.16 1.13 增加完成中断(使能/除能中断, 设置完成阈值, 等待完成)
+        2026.10.16 1.14 增加影子配置寄存器(配置下一次处理, 提交配置并启动)
+        2026.10.16 1.15 性能监测计数器扩展为64位, 通过快照一次性读取
+        2026.10.16 1.16 增加可替换的寄存器访问后端(直接访问/Linux UIO映射/回调函数)和总线地址转换
+        2026.10.17 1.17 增加输出特征图跨距配置(直接写入拼接后特征图的通道切片)
+        2026.10.17 1.18 增加输入特征图跨距配置(直接读取更大特征图中的区域或通道切片)
 ************************************************************************************************************************/
 
 #include <stdint.h>
@@ -69,6 +75,21 @@ typedef enum{
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// 函数指针类型: 等待完成时的回调函数
+typedef void (*AxiGnrPoolWaitHook)(void* arg);
+
+// 寄存器访问后端
+//     默认以指针直接访问寄存器区(裸机下为物理地址, Linux下为mmap映射/dev/uioN得到的虚拟地址), 访问函数被内联为单条load/store指令
+//     编译时定义AXI_GNR_POOL_MMIO_CB则通过回调函数访问(用于仿真器/模拟器), 此时基地址只用于区分所访问的寄存器
+// 函数指针类型: 读1个字(addr为基地址 + 偏移地址)
+typedef uint32_t (*AxiGnrPoolMmioRd)(void* arg, uintptr_t addr);
+// 函数指针类型: 写1个字(addr为基地址 + 偏移地址)
+typedef void (*AxiGnrPoolMmioWr)(void* arg, uintptr_t addr, uint32_t data);
+// 函数指针类型: 把主机指针转换为加速器DMA使用的总线地址
+typedef uint32_t (*AxiGnrPoolBusAddr)(void* arg, const void* ptr);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 // 结构体: 加速器属性
 typedef struct{
 	char version[9]; // 版本号
@@ -85,6 +106,8 @@ typedef struct{
 	uint8_t ext_padding_supported; // 是否支持外填充
 	uint8_t non_zero_const_padding_supported; // 是否支持非零常量填充
 	uint8_t performance_monitor_supported; // 是否支持性能监测
+	uint8_t ofmap_pitch_supported; // 是否支持输出特征图跨距
+	uint8_t ifmap_pitch_supported; // 是否支持输入特征图跨距
 
 	uint8_t atomic_c; // 通道并行数
 	uint8_t post_mac_prl_n; // 后乘加并行数
@@ -111,9 +134,19 @@ typedef struct{
 	uint32_t info4;
 }AxiGnrPoolRegRgnProp;
 
+// 结构体: 寄存器域(性能监测快照)
+typedef struct{
+	uint32_t pm_snap_lo;
+	uint32_t pm_snap_hi;
+}AxiGnrPoolRegRgnPmSnap;
+
 // 结构体: 寄存器域(控制)
 typedef struct{
 	uint32_t ctrl0;
+	uint32_t ctrl1;
+	uint32_t ctrl2;
+	uint32_t ctrl3;
+	uint32_t ctrl4;
 }AxiGnrPoolRegRgnCtrl;
 
 // 结构体: 寄存器域(状态)
@@ -125,6 +158,7 @@ typedef struct{
 	uint32_t sts4;
 	uint32_t sts5;
 	uint32_t sts6;
+	uint32_t sts7;
 }AxiGnrPoolRegRgnSts;
 
 // 结构体: 寄存器域(计算配置)
@@ -146,6 +180,10 @@ typedef struct{
 	uint32_t fmap_cfg4;
 	uint32_t fmap_cfg5;
 	uint32_t fmap_cfg6;
+	uint32_t fmap_cfg7;
+	uint32_t fmap_cfg8;
+	uint32_t fmap_cfg9;
+	uint32_t fmap_cfg10;
 }AxiGnrPoolRegRgnFmapCfg;
 
 // 结构体: 寄存器域(缓存配置)
@@ -169,6 +207,23 @@ typedef struct{
 	uint8_t external_padding_bottom; // 特征图下部外填充数
 
 	AxiGnrPoolOfmapDataType ofmap_data_type; // 输出特征图数据大小类型
+
+	/*
+	输出特征图跨距: 把输出特征图写入更宽或带填充的目标特征图(如拼接后的特征图), 从而省去拼接时的拷贝
+	输出特征图按通道组(每ATOMIC_C个通道)存储, 每个通道组是1个"高度 * 表面行"的平面
+	3个字段均为0时按紧密存储写出; 非0时要求特征图通道数是ATOMIC_C的整数倍
+	*/
+	uint16_t ofmap_chn_ofs; // 在目标特征图中的起始通道号(须为ATOMIC_C的整数倍)
+	uint32_t ofmap_row_pitch; // 目标特征图的表面行跨距(字节数, 为0表示与输出特征图的表面行长度相同)
+	uint32_t ofmap_cgrp_pitch; // 目标特征图的通道组跨距(字节数, 为0表示表面行跨距 * 输出特征图高度)
+	/*
+	输入特征图跨距: 直接读取更大的源特征图中的1个区域(裁剪、通道切片或分块), 从而省去切分时的拷贝
+	输入特征图按通道组(每ATOMIC_C个通道)存储, 每个通道组是1个"高度 * 表面行"的平面
+	区域左上角通过输入特征图基地址给出; 3个字段均为0时按紧密存储读取, 非0时要求特征图通道数是ATOMIC_C的整数倍
+	*/
+	uint16_t ifmap_start_cgrp; // 在源特征图中的起始通道组号
+	uint32_t ifmap_row_pitch; // 源特征图的表面行跨距(字节数, 为0表示与输入特征图的表面行长度相同)
+	uint32_t ifmap_cgrp_pitch; // 源特征图的通道组跨距(字节数, 为0表示表面行跨距 * 输入特征图高度)
 }AxiGnrPoolFmapCfg;
 
 // 结构体: 缓存参数配置
@@ -214,20 +269,33 @@ typedef struct{
 	uint32_t post_mac_param_b; // 后乘加处理的参数B
 }AxiGnrPoolUpsModeCfg;
 
-// 结构体: 性能监测状态
+// 结构体: 性能监测状态(同1个周期锁存的快照)
 typedef struct{
-	uint32_t cycle_n; // 运行周期数
-	uint32_t mm2s_tsf_n; // MM2S通道传输字节数
-	uint32_t s2mm_tsf_n; // S2MM通道传输字节数
-	uint32_t upd_grp_run_n; // 更新单元组运行周期数
+	uint64_t cycle_n; // 运行周期数
+	uint64_t mm2s_tsf_n; // MM2S通道传输字节数
+	uint64_t s2mm_tsf_n; // S2MM通道传输字节数
+	uint64_t upd_grp_run_n; // 更新单元组运行周期数
 }AxiGnrPoolPerfMonsts;
 
+// 结构体: 寄存器访问后端
+typedef struct{
+	uintptr_t reg_base; // 寄存器区基地址
+
+	AxiGnrPoolMmioRd rd; // 读回调函数(仅在定义AXI_GNR_POOL_MMIO_CB时使用)
+	AxiGnrPoolMmioWr wr; // 写回调函数(仅在定义AXI_GNR_POOL_MMIO_CB时使用)
+	void* mmio_arg; // 读写回调函数的参数
+
+	AxiGnrPoolBusAddr bus_addr; // 总线地址转换函数(为NULL时直接取指针的低32位)
+	void* bus_addr_arg; // 总线地址转换函数的参数
+}AxiGnrPoolMmio;
+
 // 结构体: 通用池化处理单元
 typedef struct{
-	uint32_t* reg_base_ptr; // 寄存器区基地址
+	AxiGnrPoolMmio mmio; // 寄存器访问后端
 
 	// 寄存器域
 	AxiGnrPoolRegRgnProp* reg_region_prop; // 寄存器域(属性)
+	AxiGnrPoolRegRgnPmSnap* reg_region_pm_snap; // 寄存器域(性能监测快照)
 	AxiGnrPoolRegRgnCtrl* reg_region_ctrl; // 寄存器域(控制)
 	AxiGnrPoolRegRgnSts* reg_region_sts; // 寄存器域(状态)
 	AxiGnrPoolRegRgnCalCfg* reg_region_cal_cfg; // 寄存器域(计算配置)
@@ -235,11 +303,21 @@ typedef struct{
 	AxiGnrPoolRegRgnBufCfg* reg_region_buffer_cfg; // 寄存器域(缓存配置)
 
 	AxiGnrPoolProp property; // 加速器属性
+
+	uint32_t done_threshold; // 完成阈值(S2MM通道完成的命令数)
+	AxiGnrPoolWaitHook wait_hook; // 等待完成时的回调函数
+	void* wait_hook_arg; // 等待完成时的回调函数的参数
+
+	uint8_t shadow_cfg_wen; // 是否正在写影子配置寄存器
+	uint8_t next_cfg_valid; // 是否存在待提交的下一次配置
+	uint8_t next_use_post_mac; // 下一次处理是否启用后乘加处理
 }AxiGnrPoolHandler;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int axi_generic_pool_init(AxiGnrPoolHandler* handler, uint32_t baseaddr); // 初始化通用池化处理单元
+int axi_generic_pool_init_mmio(AxiGnrPoolHandler* handler, const AxiGnrPoolMmio* mmio); // 初始化通用池化处理单元(指定寄存器访问后端)
+uint32_t axi_generic_pool_bus_addr(AxiGnrPoolHandler* handler, const void* ptr); // 把主机指针转换为总线地址
 
 int axi_generic_pool_enable(AxiGnrPoolHandler* handler); // 使能加速器
 void axi_generic_pool_disable(AxiGnrPoolHandler* handler); // 除能加速器
@@ -263,7 +341,30 @@ int axi_generic_pool_cfg_in_up_sample_mode(
 	const AxiGnrPoolFmapCfg* fmap_cfg, const AxiGnrPoolBufferCfg* buffer_cfg, const AxiGnrPoolUpsModeCfg* cal_cfg
 );
 
+// 以池化模式配置下一次处理(写影子配置寄存器)
+int axi_generic_pool_cfg_next_in_pool_mode(
+	AxiGnrPoolHandler* handler,
+	AxiGnrPoolProcMode mode,
+	const AxiGnrPoolFmapCfg* fmap_cfg, const AxiGnrPoolBufferCfg* buffer_cfg, const AxiGnrPoolPoolModeCfg* cal_cfg
+);
+
+// 以上采样模式配置下一次处理(写影子配置寄存器)
+int axi_generic_pool_cfg_next_in_up_sample_mode(
+	AxiGnrPoolHandler* handler,
+	const AxiGnrPoolFmapCfg* fmap_cfg, const AxiGnrPoolBufferCfg* buffer_cfg, const AxiGnrPoolUpsModeCfg* cal_cfg
+);
+
+int axi_generic_pool_commit_and_start(AxiGnrPoolHandler* handler); // 提交下一次处理的配置并启动通用池化处理单元
+uint8_t axi_generic_pool_is_next_cfg_pending(AxiGnrPoolHandler* handler); // 判断是否存在待提交的下一次配置
+
 uint32_t axi_generic_pool_get_cmd_fns_n(AxiGnrPoolHandler* handler, AxiGnrPoolCmdFnsNQueryType query_type); // 查询DMA命令完成数
 int axi_generic_pool_clr_cmd_fns_n(AxiGnrPoolHandler* handler, AxiGnrPoolCmdFnsNClrType clr_type); // 清除DMA命令完成数计数器
 int axi_generic_pool_get_pm_cnt(AxiGnrPoolHandler* handler, AxiGnrPoolPerfMonsts* pm_sts); // 获取性能监测计数器的值
 int axi_generic_pool_clr_pm_cnt(AxiGnrPoolHandler* handler); // 清除性能监测计数器
+
+int axi_generic_pool_enable_irq(AxiGnrPoolHandler* handler); // 使能完成中断
+void axi_generic_pool_disable_irq(AxiGnrPoolHandler* handler); // 除能完成中断
+int axi_generic_pool_set_done_threshold(AxiGnrPoolHandler* handler, uint32_t s2mm_cmd_n); // 设置完成阈值
+void axi_generic_pool_clr_irq(AxiGnrPoolHandler* handler); // 清除完成中断等待标志
+void axi_generic_pool_set_wait_hook(AxiGnrPoolHandler* handler, AxiGnrPoolWaitHook hook, void* arg); // 设置等待完成时的回调函数
+int axi_generic_pool_wait_done(AxiGnrPoolHandler* handler); // 等待通用池化处理单元完成
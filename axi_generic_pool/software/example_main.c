@@ -32,11 +32,16 @@
 
 #include "xparameters.h"
 #include "xil_cache.h"
+#include "sleep.h"
 
 #include <stdio.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static void wait_done_hook(void* arg);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #define IN_FMAP_FILENAME "in_fmap_max_0.bin" // 输入特征图文件名
 #define OUT_FMAP_FILENAME "out_fmap_max_0.bin" // 输出特征图文件名
 
@@ -91,11 +96,16 @@ int main(){
 		return -1;
 	}
 
+	// 设置等待完成时的回调函数
+	axi_generic_pool_set_wait_hook(&axi_generic_pool, wait_done_hook, NULL);
+
 	// 配置上采样层参数
 	AxiGnrPoolFmapCfg fmap_cfg;
 	AxiGnrPoolBufferCfg buffer_cfg;
 	AxiGnrPoolPoolModeCfg cal_cfg;
 
+	memset(&fmap_cfg, 0, sizeof(AxiGnrPoolFmapCfg));
+
 	fmap_cfg.ifmap_baseaddr = (uint8_t*)in_fmap;
 	fmap_cfg.ofmap_baseaddr = (uint8_t*)out_fmap;
 	fmap_cfg.ifmap_w = 640;
@@ -132,6 +142,14 @@ int main(){
 	Xil_DCacheFlushRange((INTPTR)in_fmap, IN_FMAP_LEN * IN_DATA_LEN);
 #endif
 
+	// 设置完成阈值并使能完成中断
+	if(axi_generic_pool_set_done_threshold(&axi_generic_pool, OUT_FMAP_ROW_N)){
+		return -1;
+	}
+	if(axi_generic_pool_enable_irq(&axi_generic_pool)){
+		return -1;
+	}
+
 	// 启动通用池化处理单元
 	if(axi_generic_pool_enable_cal_sub_sys(&axi_generic_pool)){
 		return -1;
@@ -147,7 +165,9 @@ int main(){
 	}
 
 	// 等待通用池化处理单元的数据输出完成
-	while(axi_generic_pool_get_cmd_fns_n(&axi_generic_pool, POOL_Q_CMD_FNS_N_S2MM) < OUT_FMAP_ROW_N);
+	if(axi_generic_pool_wait_done(&axi_generic_pool)){
+		return -1;
+	}
 
 	// 获取性能监测计数器的值
 	if(axi_generic_pool_get_pm_cnt(&axi_generic_pool, &pm_sts)){
@@ -189,3 +209,8 @@ int main(){
 
 	while(1);
 }
+
+// 等待完成时的回调函数: 可在此处执行CPU侧的预处理/后处理, 或令CPU休眠直到完成中断到来
+static void wait_done_hook(void* arg){
+	usleep(50);
+}
@@ -138,7 +138,10 @@ module axi_generic_pool #(
 	
 	// DMA命令完成指示
 	input wire mm2s_cmd_done, // MM2S通道命令完成(指示)
-	input wire s2mm_cmd_done // S2MM通道命令完成(指示)
+	input wire s2mm_cmd_done, // S2MM通道命令完成(指示)
+	
+	// 中断
+	output wire irq // 完成中断
 );
 	
 	/** 函数 **/
@@ -213,6 +216,8 @@ module axi_generic_pool #(
 	wire[5:0] fnl_res_tr_req_gen_max_wgtblk_w; // 权重块最大宽度
 	wire fnl_res_tr_req_gen_is_grp_conv_mode; // 是否处于组卷积模式
 	wire fnl_res_tr_req_gen_en_send_sub_row_msg; // 是否输出子表面行信息
+	wire[23:0] fnl_res_tr_req_gen_ofmap_row_pitch; // 输出特征图表面行跨距(0表示紧密存储)
+	wire[31:0] fnl_res_tr_req_gen_ofmap_cgrp_pitch; // 输出特征图通道组跨距(0表示紧密存储)
 	// [块级控制]
 	wire fnl_res_tr_req_gen_blk_start;
 	wire fnl_res_tr_req_gen_blk_idle;
@@ -230,7 +235,7 @@ module axi_generic_pool #(
 	wire[1:0] mid_res_buf_pool_mode; // 池化模式
 	// [性能监测]
 	wire en_upd_grp_run_cnt; // 使能更新单元组运行周期数计数器
-	wire[31:0] upd_grp_run_n; // 更新单元组运行周期数
+	wire[63:0] upd_grp_run_n; // 更新单元组运行周期数
 	// [中间结果(AXIS主机)]
 	wire[ATOMIC_C*48-1:0] m_axis_ext_mid_res_data;
 	wire[ATOMIC_C*6-1:0] m_axis_ext_mid_res_keep;
@@ -354,6 +359,8 @@ module axi_generic_pool #(
 		.mm2s_cmd_done(mm2s_cmd_done),
 		.s2mm_cmd_done(s2mm_cmd_done),
 		
+		.irq(irq),
+		
 		.data_hub_fmbufcoln(data_hub_fmbufcoln),
 		.data_hub_fmbufrown(data_hub_fmbufrown),
 		.data_hub_fmrow_random_rd_mode(data_hub_fmrow_random_rd_mode),
@@ -379,6 +386,8 @@ module axi_generic_pool #(
 		.fnl_res_tr_req_gen_max_wgtblk_w(fnl_res_tr_req_gen_max_wgtblk_w),
 		.fnl_res_tr_req_gen_is_grp_conv_mode(fnl_res_tr_req_gen_is_grp_conv_mode),
 		.fnl_res_tr_req_gen_en_send_sub_row_msg(fnl_res_tr_req_gen_en_send_sub_row_msg),
+		.fnl_res_tr_req_gen_ofmap_row_pitch(fnl_res_tr_req_gen_ofmap_row_pitch),
+		.fnl_res_tr_req_gen_ofmap_cgrp_pitch(fnl_res_tr_req_gen_ofmap_cgrp_pitch),
 		.fnl_res_tr_req_gen_blk_start(fnl_res_tr_req_gen_blk_start),
 		.fnl_res_tr_req_gen_blk_idle(fnl_res_tr_req_gen_blk_idle),
 		.fnl_res_tr_req_gen_blk_done(fnl_res_tr_req_gen_blk_done),
@@ -691,6 +700,9 @@ module axi_generic_pool #(
 		.is_grp_conv_mode(fnl_res_tr_req_gen_is_grp_conv_mode),
 		.n_foreach_group(16'dx),
 		.en_send_sub_row_msg(fnl_res_tr_req_gen_en_send_sub_row_msg),
+		.en_fused_max_pool(1'b0),
+		.ofmap_row_pitch(fnl_res_tr_req_gen_ofmap_row_pitch),
+		.ofmap_cgrp_pitch(fnl_res_tr_req_gen_ofmap_cgrp_pitch),
 		
 		.blk_start(fnl_res_tr_req_gen_blk_start),
 		.blk_idle(fnl_res_tr_req_gen_blk_idle),
@@ -758,7 +770,7 @@ module axi_generic_pool #(
 	wire pool_upd_o_to_upd_mem; // 更新缓存MEM(标志)
 	wire[ATOMIC_C/MID_RES_BUF_CLK_RATE-1:0] pool_upd_o_valid; // 输出有效指示
 	// [性能监测]
-	reg[31:0] upd_grp_run_cnt; // 更新单元组运行周期数(计数器)
+	reg[63:0] upd_grp_run_cnt; // 更新单元组运行周期数(计数器)
 	
 	assign {pool_upd_o_to_upd_mem, pool_upd_o_last_grp, pool_upd_o_last_res, pool_upd_o_mask} = 
 		pool_upd_o_info_along[0];
@@ -769,14 +781,14 @@ module axi_generic_pool #(
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			upd_grp_run_cnt <= 32'd0;
+			upd_grp_run_cnt <= 64'd0;
 		else if(
 			(~en_upd_grp_run_cnt) | pool_upd_o_valid[0]
 		)
 			upd_grp_run_cnt <= # SIM_DELAY 
 				en_upd_grp_run_cnt ? 
 					(upd_grp_run_cnt + 1'b1):
-					32'd0;
+					64'd0;
 	end
 	
 	genvar mid_res_i;
@@ -119,6 +119,9 @@ module axi_generic_pool_core #(
 	input wire mm2s_cmd_done, // MM2S通道命令完成(指示)
 	input wire s2mm_cmd_done, // S2MM通道命令完成(指示)
 	
+	// 中断
+	output wire irq, // 完成中断
+	
 	// (共享)数据枢纽
 	// [运行时参数]
 	output wire[3:0] data_hub_fmbufcoln, // 每个表面行的表面个数类型
@@ -151,6 +154,8 @@ module axi_generic_pool_core #(
 	output wire[5:0] fnl_res_tr_req_gen_max_wgtblk_w, // 权重块最大宽度
 	output wire fnl_res_tr_req_gen_is_grp_conv_mode, // 是否处于组卷积模式
 	output wire fnl_res_tr_req_gen_en_send_sub_row_msg, // 是否输出子表面行信息
+	output wire[23:0] fnl_res_tr_req_gen_ofmap_row_pitch, // 输出特征图表面行跨距(0表示紧密存储)
+	output wire[31:0] fnl_res_tr_req_gen_ofmap_cgrp_pitch, // 输出特征图通道组跨距(0表示紧密存储)
 	// [块级控制]
 	output wire fnl_res_tr_req_gen_blk_start,
 	input wire fnl_res_tr_req_gen_blk_idle,
@@ -169,7 +174,7 @@ module axi_generic_pool_core #(
 	output wire[1:0] mid_res_buf_pool_mode, // 池化模式
 	// [性能监测]
 	output wire en_upd_grp_run_cnt, // 使能更新单元组运行周期数计数器
-	input wire[31:0] upd_grp_run_n, // 更新单元组运行周期数
+	input wire[63:0] upd_grp_run_n, // 更新单元组运行周期数
 	// [中间结果(AXIS主机)]
 	output wire[ATOMIC_C*48-1:0] m_axis_ext_mid_res_data,
 	output wire[ATOMIC_C*6-1:0] m_axis_ext_mid_res_keep,
@@ -314,6 +319,10 @@ module axi_generic_pool_core #(
 	wire[15:0] ofmap_w; // 输出特征图宽度 - 1
 	wire[15:0] ofmap_h; // 输出特征图高度 - 1
 	wire[1:0] ofmap_data_type; // 输出特征图数据大小类型
+	wire[23:0] ofmap_row_pitch; // 输出特征图表面行跨距
+	wire[31:0] ofmap_cgrp_pitch; // 输出特征图通道组跨距
+	wire[23:0] ifmap_row_pitch; // 输入特征图表面行跨距
+	wire[31:0] ifmap_cgrp_pitch; // 输入特征图通道组跨距
 	// [特征图缓存参数]
 	wire[3:0] fmbufcoln; // 每个表面行的表面个数类型
 	wire[9:0] fmbufrown; // 可缓存的表面行数 - 1
@@ -393,6 +402,8 @@ module axi_generic_pool_core #(
 		.mm2s_cmd_done(mm2s_cmd_done),
 		.s2mm_cmd_done(s2mm_cmd_done),
 		
+		.irq(irq),
+		
 		.sfc_row_access_blk_start(sfc_row_access_blk_start),
 		.sfc_row_access_blk_idle(sfc_row_access_blk_idle),
 		.sfc_row_access_blk_done(sfc_row_access_blk_done),
@@ -429,6 +440,10 @@ module axi_generic_pool_core #(
 		.ofmap_w(ofmap_w),
 		.ofmap_h(ofmap_h),
 		.ofmap_data_type(ofmap_data_type),
+		.ofmap_row_pitch(ofmap_row_pitch),
+		.ofmap_cgrp_pitch(ofmap_cgrp_pitch),
+		.ifmap_row_pitch(ifmap_row_pitch),
+		.ifmap_cgrp_pitch(ifmap_cgrp_pitch),
 		.fmbufcoln(fmbufcoln),
 		.fmbufrown(fmbufrown),
 		.mid_res_buf_row_n_bufferable(mid_res_buf_row_n_bufferable)
@@ -563,6 +578,8 @@ module axi_generic_pool_core #(
 		.fmap_chn_n(fmap_chn_n),
 		.external_padding_top(external_padding_top),
 		.ofmap_h(ofmap_h_for_sfc_row_access),
+		.ifmap_row_pitch(ifmap_row_pitch),
+		.ifmap_cgrp_pitch(ifmap_cgrp_pitch),
 		
 		.blk_start(sfc_row_access_blk_start),
 		.blk_idle(sfc_row_access_blk_idle),
@@ -821,6 +838,8 @@ module axi_generic_pool_core #(
 	assign fnl_res_tr_req_gen_max_wgtblk_w = ATOMIC_C;
 	assign fnl_res_tr_req_gen_is_grp_conv_mode = 1'b0;
 	assign fnl_res_tr_req_gen_en_send_sub_row_msg = 1'b0;
+	assign fnl_res_tr_req_gen_ofmap_row_pitch = ofmap_row_pitch;
+	assign fnl_res_tr_req_gen_ofmap_cgrp_pitch = ofmap_cgrp_pitch;
 	
 	assign en_mid_res_buf_dup = en_adapter;
 	assign mid_res_buf_calfmt = calfmt;
@@ -88,6 +88,10 @@ module conv_data_hub #(
 	// [物理缓存]
 	input wire[7:0] fmbufbankn, // 分配给特征图缓存的Bank数
 	
+	// 性能监测
+	output wire on_fm_sfc_row_rplc, // 置换1个特征图表面行(指示)
+	output wire on_kbuf_sw_rgn_rplc, // 置换1个交换区通道组(指示)
+	
 	// 特征图表面行读请求(AXIS从机)
 	/*
 	请求格式 -> 
@@ -625,6 +629,8 @@ module conv_data_hub #(
 	assign sfc_rid_to_rplc = 
 		fm_rd_req_buf_sfc_rid[fm_rplc_sel];
 	
+	assign on_fm_sfc_row_rplc = sfc_row_rplc_req;
+	
 	assign s_fm_fin_axis_data = m0_dma_sfc_axis_data;
 	assign s_fm_fin_axis_keep = m0_dma_sfc_axis_keep;
 	assign s_fm_fin_axis_user = m0_dma_sfc_axis_user;
@@ -1295,6 +1301,8 @@ module conv_data_hub #(
 		(kwgtblk_rd_req_sts[sw_rgn_rplc_op_msg_fifo_dout[clogb2(KWGTBLK_RD_REQ_PRE_ACPT_N-1):0]] == KWGTBLK_RD_STS_RPLC) & 
 		((|kwgtblk_rd_req_sw_region_occupied_flag[0]) & (~(|kwgtblk_rd_req_sw_region_occupied_flag[1])));
 	
+	assign on_kbuf_sw_rgn_rplc = (~grp_conv_buf_mode) & (|sw_rgn_rplc);
+	
 	assign s_kbuf_in_cgrp_axis_data = m_kbuf_in_cgrp_axis_data;
 	assign s_kbuf_in_cgrp_axis_keep = m_kbuf_in_cgrp_axis_keep;
 	assign s_kbuf_in_cgrp_axis_user = m_kbuf_in_cgrp_axis_user;
@@ -31,6 +31,17 @@ SOFTWARE.
 
 可使能的"输出子表面行信息"
 
+可使能的融合2x2最大池化模式:
+	输出特征图参数仍为池化前的宽度和高度, 按池化前的表面行发送"输出子表面行信息",
+	但仅在奇数行(y % 2 == 1)上发送DMA命令, 并按池化后的宽度(w / 2)和高度(h / 2)计算表面行字节数和地址
+	奇数宽度的最后1列和奇数高度的最后1行被丢弃
+
+可使能的输出特征图跨距:
+	表面行跨距非0时, 组内第y个表面行的偏移地址 = y * 表面行跨距, 否则按表面行字节数紧密存储
+	通道组跨距非0时, 每ATOMIC_K个输出通道(1个子表面行)占用1个通道组跨距, 下一输出组紧接在本组最后1个通道组之后,
+	否则按输出特征图大小紧密存储
+	从而可将输出特征图直接写入拼接后特征图的1个通道切片(通道偏移由输出特征图基地址给出)
+
 当不处于组卷积模式时, 输出通道域的最大深度 = 权重块最大宽度(max_wgtblk_w), 按核并行数(ATOMIC_K)划分子表面行
 当处于组卷积模式时, 输出通道域的深度 = 每组的核数(n_foreach_group + 1), 按核并行数(ATOMIC_K)划分子表面行
 
@@ -67,6 +78,9 @@ module fnl_res_trans_req_gen #(
 	input wire is_grp_conv_mode, // 是否处于组卷积模式
 	input wire[15:0] n_foreach_group, // 每组的通道数/核数 - 1
 	input wire en_send_sub_row_msg, // 是否输出子表面行信息
+	input wire en_fused_max_pool, // 是否处于融合2x2最大池化模式
+	input wire[23:0] ofmap_row_pitch, // 输出特征图表面行跨距(0表示紧密存储)
+	input wire[31:0] ofmap_cgrp_pitch, // 输出特征图通道组跨距(0表示紧密存储)
 	
 	// 块级控制
 	input wire blk_start,
@@ -173,6 +187,7 @@ module fnl_res_trans_req_gen #(
 		"输出组基地址" + "组内子表面行基地址"
 		"表面行地址" + "组内子表面行偏移地址"
 		"输出组基地址" + "输出组字节数"
+		"输出组基地址" + "组内子表面行基地址(下一值)"
 	**/
 	wire[31:0] shared_add0_op1;
 	wire[31:0] shared_add0_op2;
@@ -182,8 +197,8 @@ module fnl_res_trans_req_gen #(
 	
 	/** 输出特征图额外参数 **/
 	wire[1:0] ofmap_data_size_lshn; // 输出特征图数据大小导致的左移量
-	reg[15:0] ofmap_w_actual; // 输出特征图宽度
-	reg[15:0] ofmap_h_actual; // 输出特征图高度
+	reg[15:0] ofmap_w_actual; // 输出特征图宽度(融合2x2最大池化模式下为池化后的宽度)
+	reg[15:0] ofmap_h_actual; // 输出特征图高度(融合2x2最大池化模式下为池化后的高度)
 	reg[15:0] ogrp_chn_n; // 输出组通道数
 	reg[23:0] ofmap_size; // 输出特征图大小
 	reg[31:0] ogrp_byte_n; // 输出组字节数
@@ -231,7 +246,10 @@ module fnl_res_trans_req_gen #(
 			aclken & 
 			ofmap_extra_params_cal_sts[OFMAP_EXTRA_PARS_CAL_STS_ONEHOT_W] & blk_idle & blk_start
 		)
-			ofmap_w_actual <= # SIM_DELAY shared_incr0_res;
+			ofmap_w_actual <= # SIM_DELAY 
+				en_fused_max_pool ? 
+					(shared_incr0_res >> 1):
+					shared_incr0_res;
 	end
 	
 	// 输出特征图高度
@@ -241,7 +259,10 @@ module fnl_res_trans_req_gen #(
 			aclken & 
 			ofmap_extra_params_cal_sts[OFMAP_EXTRA_PARS_CAL_STS_ONEHOT_H]
 		)
-			ofmap_h_actual <= # SIM_DELAY shared_incr0_res;
+			ofmap_h_actual <= # SIM_DELAY 
+				en_fused_max_pool ? 
+					(shared_incr0_res >> 1):
+					shared_incr0_res;
 	end
 	
 	// 输出组通道数
@@ -346,6 +367,7 @@ module fnl_res_trans_req_gen #(
 	wire[15:0] ochn_id_base_nxt; // 输出通道号基准(下一计数值)
 	wire[5:0] ochn_id_ofs_nxt; // 输出通道号偏移(下一计数值)
 	wire[15:0] ochn_id_nxt; // 输出通道号(下一计数值)
+	wire[31:0] sub_sfc_row_baseaddr_in_grp_nxt; // 组内子表面行基地址(下一值)
 	reg is_last_ochn_rgn; // 最后1个输出通道域(标志)
 	reg is_last_sub_sfc_row; // 最后1个子表面行(标志)
 	reg is_arrive_oh_end; // 抵达输出特征图高度方向末尾(标志)
@@ -368,6 +390,13 @@ module fnl_res_trans_req_gen #(
 	assign ochn_id_base_nxt = ochn_id_base + ogrp_chn_n;
 	assign ochn_id_ofs_nxt = ochn_id_ofs + ATOMIC_K;
 	assign ochn_id_nxt = ochn_id + ATOMIC_K;
+	assign sub_sfc_row_baseaddr_in_grp_nxt = 
+		sub_sfc_row_baseaddr_in_grp + 
+		(
+			(ofmap_cgrp_pitch != 32'h0000_0000) ? 
+				ofmap_cgrp_pitch:
+				(({2'b00, ofmap_size} << ofmap_data_size_lshn) * ATOMIC_K)
+		);
 	
 	assign on_move_to_nxt_ochn_rgn = on_move_to_nxt_sub_sfc_row & is_last_sub_sfc_row & is_arrive_oh_end;
 	assign on_move_in_oh = on_move_to_nxt_sub_sfc_row & is_last_sub_sfc_row;
@@ -440,7 +469,7 @@ module fnl_res_trans_req_gen #(
 			sub_sfc_row_baseaddr_in_grp <= # SIM_DELAY 
 				(blk_idle | is_last_sub_sfc_row) ? 
 					32'h0000_0000:
-					(sub_sfc_row_baseaddr_in_grp + (({2'b00, ofmap_size} << ofmap_data_size_lshn) * ATOMIC_K));
+					sub_sfc_row_baseaddr_in_grp_nxt;
 	end
 	
 	// 最后1个输出通道域(标志), 最后1个子表面行(标志), 抵达输出特征图高度方向末尾(标志), 整个输出特征图的最后1个子表面行(标志)
@@ -509,15 +538,25 @@ module fnl_res_trans_req_gen #(
 	/*
 	计算:
 		表面行字节数[23:0] = 输出特征图宽度[15:0] * 表面深度[5:0] * 每个特征图数据的字节数[1:0]
-		组内子表面行偏移地址[31:0] = 表面行y坐标[15:0] * 表面行字节数[23:0]
+		组内子表面行偏移地址[31:0] = 表面行y坐标[15:0] * 表面行跨距[23:0](为0时取表面行字节数)
+	
+	融合2x2最大池化模式下, 用池化后的表面行y坐标(表面行y坐标 / 2)计算组内子表面行偏移地址
 	*/
 	assign mul1_op_a = 
 		sub_sfc_row_ofsaddr_upd_sts[SUB_SFC_ROW_OFSADDR_UPD_STS_ONEHOT_MUL1_REQ_2] ? 
-			sfc_row_y:
+			(
+				en_fused_max_pool ? 
+					(sfc_row_y >> 1):
+					sfc_row_y
+			):
 			ofmap_w_actual;
 	assign mul1_op_b = 
 		sub_sfc_row_ofsaddr_upd_sts[SUB_SFC_ROW_OFSADDR_UPD_STS_ONEHOT_MUL1_REQ_2] ? 
-			sfc_row_len:
+			(
+				(ofmap_row_pitch != 24'h000000) ? 
+					ofmap_row_pitch:
+					sfc_row_len
+			):
 			({2'b00, cur_sfc_depth} << ofmap_data_size_lshn) | 24'h000000;
 	assign mul1_tid = 
 		MUL1_TID_CONST;
@@ -543,7 +582,11 @@ module fnl_res_trans_req_gen #(
 					sub_sfc_row_ofsaddr_in_grp:
 					sub_sfc_row_baseaddr_in_grp
 			):
-			ogrp_byte_n;
+			(
+				(ofmap_cgrp_pitch != 32'h0000_0000) ? 
+					sub_sfc_row_baseaddr_in_grp_nxt:
+					ogrp_byte_n
+			);
 	
 	assign sub_sfc_row_ofsaddr_available = 
 		(~blk_idle) & sub_sfc_row_ofsaddr_upd_sts[SUB_SFC_ROW_OFSADDR_UPD_STS_ONEHOT_UTD] & (~on_upd_sub_sfc_row_ofsaddr);
@@ -686,6 +729,10 @@ module fnl_res_trans_req_gen #(
 	/** DMA命令生成 **/
 	reg[23:0] dma_cmd_id; // DMA命令ID
 	reg[9:0] dma_cmd_gen_sts; // DMA命令生成(状态)
+	wire skip_dma_cmd; // 跳过当前子表面行的DMA命令(标志)
+	
+	// 融合2x2最大池化模式下, 偶数行的结果在池化单元内与下1行合并, 不写出
+	assign skip_dma_cmd = en_fused_max_pool & (~sfc_row_y[0]);
 	
 	assign blk_idle = dma_cmd_gen_sts[DMA_CMD_GEN_STS_ONEHOT_IDLE];
 	assign blk_done = dma_cmd_gen_sts[DMA_CMD_GEN_STS_ONEHOT_DONE];
@@ -718,7 +765,7 @@ module fnl_res_trans_req_gen #(
 	// DMA命令ID
 	always @(posedge aclk)
 	begin
-		if(aclken & (blk_idle | on_move_to_nxt_sub_sfc_row))
+		if(aclken & (blk_idle | (on_move_to_nxt_sub_sfc_row & (~skip_dma_cmd))))
 			dma_cmd_id <= # SIM_DELAY 
 				blk_idle ? 
 					24'h000000:
@@ -771,12 +818,20 @@ module fnl_res_trans_req_gen #(
 					(
 						en_send_sub_row_msg ? 
 							(1 << DMA_CMD_GEN_STS_ONEHOT_SEND_MSG):
-							(1 << DMA_CMD_GEN_STS_ONEHOT_SEND_CMD)
+							(
+								skip_dma_cmd ? 
+									(1 << DMA_CMD_GEN_STS_ONEHOT_MOV_TO_NXT_SUB_SFC_ROW):
+									(1 << DMA_CMD_GEN_STS_ONEHOT_SEND_CMD)
+							)
 					)
 				) | 
 				(
 					{10{dma_cmd_gen_sts[DMA_CMD_GEN_STS_ONEHOT_SEND_MSG]}} & 
-					(1 << DMA_CMD_GEN_STS_ONEHOT_SEND_CMD)
+					(
+						skip_dma_cmd ? 
+							(1 << DMA_CMD_GEN_STS_ONEHOT_MOV_TO_NXT_SUB_SFC_ROW):
+							(1 << DMA_CMD_GEN_STS_ONEHOT_SEND_CMD)
+					)
 				) | 
 				(
 					{10{dma_cmd_gen_sts[DMA_CMD_GEN_STS_ONEHOT_SEND_CMD]}} & 
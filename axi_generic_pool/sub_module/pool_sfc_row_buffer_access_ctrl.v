@@ -36,6 +36,11 @@ SOFTWARE.
 注意：
 输入特征图大小 = 输入特征图宽度 * 输入特征图高度
 
+可使能的输入特征图跨距:
+	输入特征图表面行跨距非0时, 相邻表面行的地址间隔为表面行跨距, 否则为当前行字节数
+	输入特征图通道组跨距非0时, 相邻切片(通道组)的地址间隔为通道组跨距, 否则为输入特征图大小 * ATOMIC_C * 特征点数据字节数
+	从而可直接读取更大特征图中的1个区域, 区域起点通过特征图数据基地址给出
+
 "特征图表面行读请求"仅对非填充行产生, 而"池化表面行信息"对每1行都产生
 
 "特征图表面行读请求"里的"起始表面编号"和"待读取的表面个数 - 1"是不可用的
@@ -73,6 +78,8 @@ module pool_sfc_row_buffer_access_ctrl #(
 	input wire[15:0] fmap_chn_n, // 通道数 - 1
 	input wire[2:0] external_padding_top, // 上部外填充数
 	input wire[15:0] ofmap_h, // 输出特征图高度 - 1
+	input wire[23:0] ifmap_row_pitch, // 输入特征图表面行跨距(0表示紧密存储)
+	input wire[31:0] ifmap_cgrp_pitch, // 输入特征图通道组跨距(0表示紧密存储)
 	
 	// 块级控制
 	input wire blk_start,
@@ -197,7 +204,10 @@ module pool_sfc_row_buffer_access_ctrl #(
 	
 	assign row_bytes_n_of_last_slice_available = extra_params_cal_sts[EXTRA_PARAMS_CAL_STS_ONEHOT_FNS];
 	
-	assign slice_addr_stride = ((actual_ifmap_size * ATOMIC_C) | 32'd0) << (is_16bit_data ? 1:0);
+	assign slice_addr_stride = 
+		(ifmap_cgrp_pitch != 32'h0000_0000) ? 
+			ifmap_cgrp_pitch:
+			(((actual_ifmap_size * ATOMIC_C) | 32'd0) << (is_16bit_data ? 1:0));
 	
 	// 最后1个切片的通道数, 最后1个切片的通道数 - 1, 输入特征图宽度, 输入特征图大小
 	always @(posedge aclk)
@@ -287,6 +297,7 @@ module pool_sfc_row_buffer_access_ctrl #(
 	reg[31:0] pool_row_addr; // 池化行地址
 	wire[4:0] cur_row_depth; // 当前行深度
 	wire[23:0] cur_row_bytes_n; // 当前行字节数
+	wire[23:0] row_addr_stride; // 表面行地址跨度
 	reg[3:0] pool_rgn_baseaddr_upd_sts; // 池化域基地址更新状态
 	// [标志组]
 	wire is_first_solid_row_in_pool_rgn; // 是否池化域内的第1个非填充表面行
@@ -301,7 +312,7 @@ module pool_sfc_row_buffer_access_ctrl #(
 	reg on_cal_pool_rgn_baseaddr; // 计算池化域基地址(指示)
 	
 	assign mul1_op_a = {{2{pool_rid[15]}}, pool_rid[15:0]};
-	assign mul1_op_b = {1'b0, cur_row_bytes_n[23:0]};
+	assign mul1_op_b = {1'b0, row_addr_stride[23:0]};
 	assign mul1_tid = MUL1_TID_CONST;
 	assign mul1_req = 
 		aclken & 
@@ -337,6 +348,10 @@ module pool_sfc_row_buffer_access_ctrl #(
 		is_arrive_last_slice ? 
 			row_bytes_n_of_last_slice:
 			(((actual_ifmap_w * ATOMIC_C) | 24'd0) << (is_16bit_data ? 1:0));
+	assign row_addr_stride = 
+		(ifmap_row_pitch != 24'h000000) ? 
+			ifmap_row_pitch:
+			cur_row_bytes_n;
 	
 	assign is_first_solid_row_in_pool_rgn = (pool_rid == 16'd0) | ((~is_pool_row_in_padding_rgn) & is_arrive_first_row_in_pool_rgn);
 	assign is_last_solid_row_in_pool_rgn = (pool_rid == ifmap_h) | ((~is_pool_row_in_padding_rgn) & is_arrive_last_row_in_pool_rgn);
@@ -427,7 +442,7 @@ module pool_sfc_row_buffer_access_ctrl #(
 				(
 					(mul1_ovld & (mul1_oid == MUL1_TID_CONST)) ? 
 						mul1_res[31:0]:
-						(cur_row_bytes_n | 32'd0)
+						(row_addr_stride | 32'd0)
 				);
 	end
 	
@@ -51,6 +51,16 @@ SOFTWARE.
 	|          |         |31~16: 中间结果每个BANK的深度  |      RO      |                                  |
 	--------------------------------------------------------------------------------------------------------
 	| info4    | 0x18/6  |3~0: 中间结果缓存时钟倍率      |      RO      |                                  |
+	|          |         |8: 是否支持输出特征图跨距      |      RO      |                                  |
+	|          |         |9: 是否支持输入特征图跨距      |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	********************************************************************************************************
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x38/14 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   lo     |         |      性能监测计数器快照低32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x3C/15 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   hi     |         |      性能监测计数器快照高32位 |              |                                  |
 	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
@@ -63,6 +73,19 @@ SOFTWARE.
 	|          |         |10: 启用后乘加处理             |      RW      | 仅当支持后乘加处理时可写1        |
 	|          |         |11: 使能性能监测计数器         |      RW      | 仅当支持性能监测时可写1          |
 	--------------------------------------------------------------------------------------------------------
+	| ctrl1    | 0x44/17 |0: 使能完成中断                |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl2    | 0x48/18 |31~0: 完成中断的               |      RW      | 当S2MM通道完成的命令数           |
+	|          |         |      S2MM命令数阈值           |              | 计至该值时产生完成中断           |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl3    | 0x4C/19 | 0: 写影子配置寄存器           |      RW      | 为1时, 经AXI-Lite写配置寄存器    |
+	|          |         |                               |              | 仅写入影子配置寄存器组           |
+	|          |         | 1: 影子配置寄存器待提交标志   |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl4    | 0x50/20 | 0: 锁存性能监测计数器快照     |      WO      | 向该位写1会在同1个周期内锁存     |
+	|          |         |                               |              | 全部性能监测计数器               |
+	|          |         |11~8: 快照读索引               |      RW      | 0~3依次对应sts3~sts6             |
+	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
 	| sts0     | 0x60/24 |0: 表面行访问请求生成单元空闲  |      RO      |                                  |
@@ -81,6 +104,8 @@ SOFTWARE.
 	| sts6     | 0x78/30 |31~0: 更新单元组运行周期数     |      RO      | 仅当支持性能监测时, 该字段可用   |
 	|          |         |                               |              | 除能计算子系统时, 该字段清零     |
 	--------------------------------------------------------------------------------------------------------
+	| sts7     | 0x7C/31 |0: 完成中断等待标志            |      WC      | 写1清零                          |
+	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
 	| cal_cfg0 | 0x80/32 |3~0: 处理模式                  |      RW      | 仅当写入支持的处理模式时生效     |
@@ -128,6 +153,18 @@ SOFTWARE.
 	|          |         |29~15: 输出特征图高度 - 1      |      RW      |                                  |
 	|          |         |31~30: 输出特征图数据大小类型  |      RW      |                                  |
 	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg7 | 0xDC/55 |23~0: 输出特征图表面行跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg8 | 0xE0/56 |31~0: 输出特征图通道组跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg9 | 0xE4/57 |23~0: 输入特征图表面行跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg10| 0xE8/58 |31~0: 输入特征图通道组跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
 	********************************************************************************************************
 	--------------------------------------------------------------------------------------------------------
 	| buf_cfg0 |0x100/64 |3~0: 特征图缓存                |      RW      |                                  |
@@ -140,6 +177,14 @@ SOFTWARE.
 
 注意：
 支持非0常量填充模式的前提是支持外填充
+当ctrl3[0]为1时, 写配置寄存器只会写入影子配置寄存器组, 这些配置会在下一次启动时被提交,
+因此可在处理当前层期间写入下一层的配置
+fmap_cfg7/fmap_cfg8非0时, 输出特征图按给定的表面行跨距和通道组跨距(每ATOMIC_C个通道为1个通道组)写出,
+从而可直接写入拼接后特征图的1个通道切片; 通道偏移通过输出特征图基地址(fmap_cfg1)给出
+fmap_cfg9/fmap_cfg10非0时, 输入特征图按给定的表面行跨距和通道组跨距(每ATOMIC_C个通道为1个通道组)读取,
+从而可直接读取更大特征图中的1个区域(裁剪、通道切片或分块); 起始通道组和区域左上角通过输入特征图基地址(fmap_cfg0)给出
+sts3~sts6均为64位计数器, 直接读这些寄存器得到的是实时值的低32位;
+向ctrl4[0]写1会把它们同时锁存到快照, 再通过ctrl4[11:8]选择并经pm_snap_lo/pm_snap_hi读出一致的64位值
 
 协议:
 AXI-Lite SLAVE
@@ -208,7 +253,7 @@ module reg_if_for_generic_pool #(
 	output wire en_post_mac, // 使能后乘加处理
 	
 	// 状态信息
-	input wire[31:0] upd_grp_run_n, // 更新单元组运行周期数
+	input wire[63:0] upd_grp_run_n, // 更新单元组运行周期数
 	
 	// 传输字节数监测
 	// [MM2S通道]
@@ -224,6 +269,9 @@ module reg_if_for_generic_pool #(
 	input wire mm2s_cmd_done, // MM2S通道命令完成(指示)
 	input wire s2mm_cmd_done, // S2MM通道命令完成(指示)
 	
+	// 中断
+	output wire irq, // 完成中断
+	
 	// 块级控制
 	// [池化表面行缓存访问控制]
 	output wire sfc_row_access_blk_start,
@@ -269,6 +317,10 @@ module reg_if_for_generic_pool #(
 	output wire[15:0] ofmap_w, // 输出特征图宽度 - 1
 	output wire[15:0] ofmap_h, // 输出特征图高度 - 1
 	output wire[1:0] ofmap_data_type, // 输出特征图数据大小类型
+	output wire[23:0] ofmap_row_pitch, // 输出特征图表面行跨距(0表示紧密存储)
+	output wire[31:0] ofmap_cgrp_pitch, // 输出特征图通道组跨距(0表示紧密存储)
+	output wire[23:0] ifmap_row_pitch, // 输入特征图表面行跨距(0表示紧密存储)
+	output wire[31:0] ifmap_cgrp_pitch, // 输入特征图通道组跨距(0表示紧密存储)
 	// [特征图缓存参数]
 	output wire[3:0] fmbufcoln, // 每个表面行的表面个数类型
 	output wire[9:0] fmbufrown, // 可缓存的表面行数 - 1
@@ -442,6 +494,8 @@ module reg_if_for_generic_pool #(
 	|          |         |31~16: 中间结果每个BANK的深度  |      RO      |                                  |
 	--------------------------------------------------------------------------------------------------------
 	| info4    | 0x18/6  |3~0: 中间结果缓存时钟倍率      |      RO      |                                  |
+	|          |         |8: 是否支持输出特征图跨距      |      RO      |                                  |
+	|          |         |9: 是否支持输入特征图跨距      |      RO      |                                  |
 	--------------------------------------------------------------------------------------------------------
 	**/
 	wire[31:0] version_r; // 版本号
@@ -457,6 +511,8 @@ module reg_if_for_generic_pool #(
 	wire[15:0] mid_res_buf_bank_n_r; // 中间结果缓存BANK数
 	wire[15:0] mid_res_buf_bank_depth_r; // 中间结果每个BANK的深度
 	wire[3:0] mid_res_buf_clk_rate_r; // 中间结果缓存时钟倍率
+	wire ofmap_pitch_supported_r; // 是否支持输出特征图跨距
+	wire ifmap_pitch_supported_r; // 是否支持输入特征图跨距
 	
 	assign version_r = {4'd6, 4'd2, 4'd2, 4'd1, 4'd5, 4'd2, 4'd0, 4'd2}; // 2025.12.26
 	assign acc_type_r = {5'd26, 5'd26, 5'd11, 5'd14, 5'd14, 5'd15}; // "pool\0\0"
@@ -471,9 +527,11 @@ module reg_if_for_generic_pool #(
 	assign mid_res_buf_bank_n_r = RBUF_BANK_N;
 	assign mid_res_buf_bank_depth_r = RBUF_DEPTH;
 	assign mid_res_buf_clk_rate_r = MID_RES_BUF_CLK_RATE;
+	assign ofmap_pitch_supported_r = 1'b1;
+	assign ifmap_pitch_supported_r = 1'b1;
 	
 	/**
-	寄存器(ctrl0)
+	寄存器(ctrl0, ctrl1, ctrl2, ctrl3, ctrl4)
 	
 	--------------------------------------------------------------------------------------------------------
 	| ctrl0    | 0x40/16 |0: 启动表面行访问请求生成单元  |      WO      | 向该字段写1以启动                |
@@ -485,6 +543,19 @@ module reg_if_for_generic_pool #(
 	|          |         |10: 启用后乘加处理             |      RW      | 仅当支持后乘加处理时可写1        |
 	|          |         |11: 使能性能监测计数器         |      RW      | 仅当支持性能监测时可写1          |
 	--------------------------------------------------------------------------------------------------------
+	| ctrl1    | 0x44/17 |0: 使能完成中断                |      RW      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl2    | 0x48/18 |31~0: 完成中断的               |      RW      | 当S2MM通道完成的命令数           |
+	|          |         |      S2MM命令数阈值           |              | 计至该值时产生完成中断           |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl3    | 0x4C/19 | 0: 写影子配置寄存器           |      RW      | 为1时, 经AXI-Lite写配置寄存器    |
+	|          |         |                               |              | 仅写入影子配置寄存器组           |
+	|          |         | 1: 影子配置寄存器待提交标志   |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl4    | 0x50/20 | 0: 锁存性能监测计数器快照     |      WO      | 向该位写1会在同1个周期内锁存     |
+	|          |         |                               |              | 全部性能监测计数器               |
+	|          |         |11~8: 快照读索引               |      RW      | 0~3依次对应sts3~sts6             |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	reg sfc_row_access_blk_start_r; // 启动表面行访问请求生成单元(指示)
 	reg fnl_res_tr_req_gen_blk_start_r; // 启动最终结果传输请求生成单元(指示)
@@ -492,6 +563,11 @@ module reg_if_for_generic_pool #(
 	reg en_cal_sub_sys_r; // 使能计算子系统
 	reg to_use_post_mac_r; // 启用后乘加处理
 	reg en_pm_cnt_r; // 使能性能监测计数器
+	reg en_done_irq_r; // 使能完成中断
+	reg[31:0] done_irq_s2mm_cmd_n_th_r; // 完成中断的S2MM命令数阈值
+	reg shadow_cfg_wen_r; // 写影子配置寄存器
+	reg pm_snap_r; // 锁存性能监测计数器快照(指示)
+	reg[3:0] pm_snap_sel_r; // 快照读索引
 	
 	assign en_accelerator = en_accelerator_r;
 	assign en_adapter = en_cal_sub_sys_r;
@@ -526,8 +602,54 @@ module reg_if_for_generic_pool #(
 				};
 	end
 	
+	// 使能完成中断
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			en_done_irq_r <= 1'b0;
+		else if(regs_en & regs_wen & (regs_addr == 17))
+			en_done_irq_r <= # SIM_DELAY regs_din[0];
+	end
+	
+	// 完成中断的S2MM命令数阈值
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			done_irq_s2mm_cmd_n_th_r <= 32'd0;
+		else if(regs_en & regs_wen & (regs_addr == 18))
+			done_irq_s2mm_cmd_n_th_r <= # SIM_DELAY regs_din[31:0];
+	end
+	
+	// 写影子配置寄存器
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			shadow_cfg_wen_r <= 1'b0;
+		else if(regs_en & regs_wen & (regs_addr == 19))
+			shadow_cfg_wen_r <= # SIM_DELAY regs_din[0];
+	end
+	
+	// 锁存性能监测计数器快照(指示)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_r <= 1'b0;
+		else
+			pm_snap_r <= # SIM_DELAY 
+				EN_PERF_MON & regs_en & regs_wen & (regs_addr == 20) & regs_din[0];
+	end
+	
+	// 快照读索引
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_sel_r <= 4'd0;
+		else if(regs_en & regs_wen & (regs_addr == 20))
+			pm_snap_sel_r <= # SIM_DELAY regs_din[11:8];
+	end
+	
 	/**
-	寄存器(sts0, sts1, sts2, sts3, sts4, sts5, sts6)
+	寄存器(sts0, sts1, sts2, sts3, sts4, sts5, sts6, sts7)
 	
 	--------------------------------------------------------------------------------------------------------
 	| sts0     | 0x60/24 |0: 表面行访问请求生成单元空闲  |      RO      |                                  |
@@ -546,15 +668,21 @@ module reg_if_for_generic_pool #(
 	| sts6     | 0x78/30 |31~0: 更新单元组运行周期数     |      RO      | 仅当支持性能监测时, 该字段可用   |
 	|          |         |                               |              | 除能计算子系统时, 该字段清零     |
 	--------------------------------------------------------------------------------------------------------
+	| sts7     | 0x7C/31 |0: 完成中断等待标志            |      WC      | 写1清零                          |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	wire sfc_row_access_blk_idle_r; // 表面行访问请求生成单元空闲
 	wire fnl_res_tr_req_gen_blk_idle_r; // 最终结果传输请求生成单元空闲
 	reg[31:0] dma_mm2s_fns_cmd_n_r; // MM2S通道完成的命令数
 	reg[31:0] dma_s2mm_fns_cmd_n_r; // S2MM通道完成的命令数
-	reg[31:0] pm_cnt_r; // 性能监测计数器
-	reg[31:0] mm2s_tsf_n_r; // MM2S通道传输字节数
-	reg[31:0] s2mm_tsf_n_r; // S2MM通道传输字节数
-	wire[31:0] upd_grp_run_n_r; // 更新单元组运行周期数
+	reg[63:0] pm_cnt_r; // 性能监测计数器
+	reg[63:0] mm2s_tsf_n_r; // MM2S通道传输字节数
+	reg[63:0] s2mm_tsf_n_r; // S2MM通道传输字节数
+	wire[63:0] upd_grp_run_n_r; // 更新单元组运行周期数
+	reg done_irq_pending_r; // 完成中断等待标志
+	reg irq_r; // 完成中断
+	
+	assign irq = irq_r;
 	
 	assign sfc_row_access_blk_idle_r = sfc_row_access_blk_idle;
 	assign fnl_res_tr_req_gen_blk_idle_r = fnl_res_tr_req_gen_blk_idle;
@@ -590,11 +718,37 @@ module reg_if_for_generic_pool #(
 					(dma_s2mm_fns_cmd_n_r + 1'b1);
 	end
 	
+	// 完成中断等待标志(S2MM通道完成的命令数递增至阈值时置位, 向sts7[0]写1时清零)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			done_irq_pending_r <= 1'b0;
+		else if(
+			(
+				en_accelerator_r & s2mm_cmd_done & (~(regs_en & regs_wen & (regs_addr == 26))) & 
+				(done_irq_s2mm_cmd_n_th_r != 32'd0) & ((dma_s2mm_fns_cmd_n_r + 1'b1) == done_irq_s2mm_cmd_n_th_r)
+			) | 
+			(regs_en & regs_wen & (regs_addr == 31) & regs_din[0])
+		)
+			done_irq_pending_r <= # SIM_DELAY 
+				en_accelerator_r & s2mm_cmd_done & (~(regs_en & regs_wen & (regs_addr == 26))) & 
+				(done_irq_s2mm_cmd_n_th_r != 32'd0) & ((dma_s2mm_fns_cmd_n_r + 1'b1) == done_irq_s2mm_cmd_n_th_r);
+	end
+	
+	// 完成中断
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			irq_r <= 1'b0;
+		else
+			irq_r <= # SIM_DELAY en_done_irq_r & done_irq_pending_r;
+	end
+	
 	// 性能监测计数器
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			pm_cnt_r <= 32'd0;
+			pm_cnt_r <= 64'd0;
 		else if(
 			EN_PERF_MON & 
 			(
@@ -604,7 +758,7 @@ module reg_if_for_generic_pool #(
 		)
 			pm_cnt_r <= # SIM_DELAY 
 				(regs_en & regs_wen & (regs_addr == 27)) ? 
-					32'd0:
+					64'd0:
 					(pm_cnt_r + 1'b1);
 	end
 	
@@ -612,7 +766,7 @@ module reg_if_for_generic_pool #(
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			mm2s_tsf_n_r <= 32'd0;
+			mm2s_tsf_n_r <= 64'd0;
 		else if(
 			EN_PERF_MON & 
 			(
@@ -622,7 +776,7 @@ module reg_if_for_generic_pool #(
 		)
 			mm2s_tsf_n_r <= # SIM_DELAY 
 				(regs_en & regs_wen & (regs_addr == 28)) ? 
-					32'd0:
+					64'd0:
 					(mm2s_tsf_n_r + count1_of_u32(s_mm2s_strm_axis_keep | 32'd0));
 	end
 	
@@ -630,7 +784,7 @@ module reg_if_for_generic_pool #(
 	always @(posedge aclk or negedge aresetn)
 	begin
 		if(~aresetn)
-			s2mm_tsf_n_r <= 32'd0;
+			s2mm_tsf_n_r <= 64'd0;
 		else if(
 			EN_PERF_MON & 
 			(
@@ -640,10 +794,101 @@ module reg_if_for_generic_pool #(
 		)
 			s2mm_tsf_n_r <= # SIM_DELAY 
 				(regs_en & regs_wen & (regs_addr == 29)) ? 
-					32'd0:
+					64'd0:
 					(s2mm_tsf_n_r + count1_of_u32(s_s2mm_strm_axis_keep | 32'd0));
 	end
 	
+	/**
+	寄存器(pm_snap_lo, pm_snap_hi)
+	
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x38/14 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   lo     |         |      性能监测计数器快照低32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| pm_snap_ | 0x3C/15 |31~0: 快照读索引所选的         |      RO      | 仅当支持性能监测时, 该字段可用   |
+	|   hi     |         |      性能监测计数器快照高32位 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	
+	向ctrl4[0]写1的下1个周期锁存全部性能监测计数器, 此后经pm_snap_lo/pm_snap_hi读取到的64位值来自同1个周期
+	快照读索引 -> 
+		0: 性能监测计数器(sts3)
+		1: MM2S通道传输字节数(sts4)
+		2: S2MM通道传输字节数(sts5)
+		3: 更新单元组运行周期数(sts6)
+	**/
+	localparam integer PM_SNAP_N = 4; // 快照中的计数器个数
+	
+	wire[PM_SNAP_N*64-1:0] pm_snap_din; // 待锁存的性能监测计数器
+	reg[PM_SNAP_N*64-1:0] pm_snap_regs; // 性能监测计数器快照
+	wire[63:0] pm_snap_sel_dout; // 快照读索引所选的性能监测计数器快照
+	
+	assign pm_snap_din = {upd_grp_run_n_r, s2mm_tsf_n_r, mm2s_tsf_n_r, pm_cnt_r};
+	assign pm_snap_sel_dout = 
+		(pm_snap_sel_r < PM_SNAP_N) ? 
+			pm_snap_regs[pm_snap_sel_r*64+:64]:
+			64'd0;
+	
+	// 性能监测计数器快照
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			pm_snap_regs <= {(PM_SNAP_N*64){1'b0}};
+		else if(EN_PERF_MON & pm_snap_r)
+			pm_snap_regs <= # SIM_DELAY pm_snap_din;
+	end
+	
+	/**
+	影子配置寄存器
+	
+	当ctrl3[0]为1时, 经AXI-Lite写配置寄存器(偏移地址>=0x80)只会写入影子配置寄存器组并置位对应的待提交标志, 
+	不影响正在运行的计算; 在2个请求生成单元均空闲时启动(向ctrl0[1:0]写非0值)时, 所有待提交的影子配置寄存器在同1个周期内被提交到配置寄存器
+	**/
+	localparam integer CFG_REGS_BASEADDR = 32; // 配置寄存器的起始偏移地址
+	
+	reg[31:0] shadow_cfg_regs[CFG_REGS_BASEADDR:REGS_N-1]; // 影子配置寄存器组
+	reg[REGS_N-1:CFG_REGS_BASEADDR] shadow_cfg_pending; // 影子配置寄存器待提交标志
+	wire shadow_cfg_wen; // 影子配置寄存器写使能
+	wire shadow_cfg_commit; // 提交影子配置寄存器(指示)
+	wire[REGS_N-1:CFG_REGS_BASEADDR] cfg_regs_upd; // 配置寄存器更新使能
+	wire[31:0] cfg_regs_upd_din[CFG_REGS_BASEADDR:REGS_N-1]; // 配置寄存器更新数据
+	
+	assign shadow_cfg_wen = 
+		regs_en & regs_wen & shadow_cfg_wen_r & (regs_addr >= CFG_REGS_BASEADDR);
+	assign shadow_cfg_commit = 
+		regs_en & regs_wen & (regs_addr == 16) & (|regs_din[1:0]) & 
+		sfc_row_access_blk_idle & fnl_res_tr_req_gen_blk_idle;
+	
+	// 影子配置寄存器组
+	always @(posedge aclk)
+	begin
+		if(shadow_cfg_wen)
+			shadow_cfg_regs[regs_addr] <= # SIM_DELAY regs_din;
+	end
+	
+	genvar cfg_regs_i;
+	generate
+		for(cfg_regs_i = CFG_REGS_BASEADDR;cfg_regs_i < REGS_N;cfg_regs_i = cfg_regs_i + 1)
+		begin:shadow_cfg_blk
+			// 写配置寄存器时直接更新, 或在提交时由影子配置寄存器更新
+			assign cfg_regs_upd[cfg_regs_i] = 
+				(regs_en & regs_wen & (~shadow_cfg_wen) & (regs_addr == cfg_regs_i)) | 
+				(shadow_cfg_commit & shadow_cfg_pending[cfg_regs_i]);
+			assign cfg_regs_upd_din[cfg_regs_i] = 
+				shadow_cfg_commit ? 
+					shadow_cfg_regs[cfg_regs_i]:
+					regs_din;
+			
+			// 影子配置寄存器待提交标志
+			always @(posedge aclk or negedge aresetn)
+			begin
+				if(~aresetn)
+					shadow_cfg_pending[cfg_regs_i] <= 1'b0;
+				else if(shadow_cfg_commit | (shadow_cfg_wen & (regs_addr == cfg_regs_i)))
+					shadow_cfg_pending[cfg_regs_i] <= # SIM_DELAY ~shadow_cfg_commit;
+			end
+		end
+	endgenerate
+	
 	/**
 	寄存器(cal_cfg0, cal_cfg1, cal_cfg2, cal_cfg3, cal_cfg4, cal_cfg5)
 	
@@ -755,14 +1000,14 @@ module reg_if_for_generic_pool #(
 		if(~aresetn)
 			proc_mode_r <= {2'b11, PROC_MODE_NONE};
 		else if(
-			regs_en & regs_wen & (regs_addr == 32) & 
+			cfg_regs_upd[32] & 
 			(
-				(MAX_POOL_SUPPORTED & (regs_din[3:0] == {2'b00, PROC_MODE_MAX})) | 
-				(AVG_POOL_SUPPORTED & (regs_din[3:0] == {2'b00, PROC_MODE_AVG})) | 
-				(UP_SAMPLE_SUPPORTED & (regs_din[3:0] == {2'b00, PROC_MODE_UPSP}))
+				(MAX_POOL_SUPPORTED & (cfg_regs_upd_din[32][3:0] == {2'b00, PROC_MODE_MAX})) | 
+				(AVG_POOL_SUPPORTED & (cfg_regs_upd_din[32][3:0] == {2'b00, PROC_MODE_AVG})) | 
+				(UP_SAMPLE_SUPPORTED & (cfg_regs_upd_din[32][3:0] == {2'b00, PROC_MODE_UPSP}))
 			)
 		)
-			proc_mode_r <= # SIM_DELAY regs_din[3:0];
+			proc_mode_r <= # SIM_DELAY cfg_regs_upd_din[32][3:0];
 	end
 	
 	// 运算数据格式
@@ -771,42 +1016,42 @@ module reg_if_for_generic_pool #(
 		if(~aresetn)
 			calfmt_r <= {2'b11, CAL_FMT_NONE};
 		else if(
-			regs_en & regs_wen & (regs_addr == 32) & 
+			cfg_regs_upd[32] & 
 			(
-				(INT8_SUPPORTED & (regs_din[7:4] == {2'b00, CAL_FMT_INT8})) | 
-				(INT16_SUPPORTED & (regs_din[7:4] == {2'b00, CAL_FMT_INT16})) | 
-				(FP16_SUPPORTED & (regs_din[7:4] == {2'b00, CAL_FMT_FP16}))
+				(INT8_SUPPORTED & (cfg_regs_upd_din[32][7:4] == {2'b00, CAL_FMT_INT8})) | 
+				(INT16_SUPPORTED & (cfg_regs_upd_din[32][7:4] == {2'b00, CAL_FMT_INT16})) | 
+				(FP16_SUPPORTED & (cfg_regs_upd_din[32][7:4] == {2'b00, CAL_FMT_FP16}))
 			)
 		)
-			calfmt_r <= # SIM_DELAY regs_din[7:4];
+			calfmt_r <= # SIM_DELAY cfg_regs_upd_din[32][7:4];
 	end
 	
 	// 池化水平步长 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 32) & (MAX_POOL_SUPPORTED | AVG_POOL_SUPPORTED))
-			pool_horizontal_stride_r <= # SIM_DELAY regs_din[15:8];
+		if(cfg_regs_upd[32] & (MAX_POOL_SUPPORTED | AVG_POOL_SUPPORTED))
+			pool_horizontal_stride_r <= # SIM_DELAY cfg_regs_upd_din[32][15:8];
 	end
 	
 	// 池化垂直步长 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 32) & (MAX_POOL_SUPPORTED | AVG_POOL_SUPPORTED))
-			pool_vertical_stride_r <= # SIM_DELAY regs_din[23:16];
+		if(cfg_regs_upd[32] & (MAX_POOL_SUPPORTED | AVG_POOL_SUPPORTED))
+			pool_vertical_stride_r <= # SIM_DELAY cfg_regs_upd_din[32][23:16];
 	end
 	
 	// 池化窗口宽度或上采样水平复制量 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 33))
-			pool_window_w_or_upsample_horizontal_n_r <= # SIM_DELAY regs_din[7:0];
+		if(cfg_regs_upd[33])
+			pool_window_w_or_upsample_horizontal_n_r <= # SIM_DELAY cfg_regs_upd_din[33][7:0];
 	end
 	
 	// 池化窗口高度或上采样垂直复制量 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 33))
-			pool_window_h_or_upsample_vertical_n_r <= # SIM_DELAY regs_din[15:8];
+		if(cfg_regs_upd[33])
+			pool_window_h_or_upsample_vertical_n_r <= # SIM_DELAY cfg_regs_upd_din[33][15:8];
 	end
 	
 	// 是否处于非0常量填充模式
@@ -814,15 +1059,15 @@ module reg_if_for_generic_pool #(
 	begin
 		if(~aresetn)
 			is_non_zero_const_padding_mode_r <= 1'b0;
-		else if(regs_en & regs_wen & (regs_addr == 34) & NON_ZERO_CONST_PADDING_SUPPORTED)
-			is_non_zero_const_padding_mode_r <= # SIM_DELAY regs_din[0];
+		else if(cfg_regs_upd[34] & NON_ZERO_CONST_PADDING_SUPPORTED)
+			is_non_zero_const_padding_mode_r <= # SIM_DELAY cfg_regs_upd_din[34][0];
 	end
 	
 	// 待填充的常量
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 34) & NON_ZERO_CONST_PADDING_SUPPORTED)
-			const_to_fill_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[34] & NON_ZERO_CONST_PADDING_SUPPORTED)
+			const_to_fill_r <= # SIM_DELAY cfg_regs_upd_din[34][31:16];
 	end
 	
 	// 后乘加处理的参数A的实际值是否为1
@@ -830,8 +1075,8 @@ module reg_if_for_generic_pool #(
 	begin
 		if(~aresetn)
 			post_mac_is_a_eq_1_r <= 1'b1;
-		else if(regs_en & regs_wen & (regs_addr == 35) & POST_MAC_SUPPORTED)
-			post_mac_is_a_eq_1_r <= # SIM_DELAY regs_din[0];
+		else if(cfg_regs_upd[35] & POST_MAC_SUPPORTED)
+			post_mac_is_a_eq_1_r <= # SIM_DELAY cfg_regs_upd_din[35][0];
 	end
 	
 	// 后乘加处理的参数B的实际值是否为0
@@ -839,33 +1084,33 @@ module reg_if_for_generic_pool #(
 	begin
 		if(~aresetn)
 			post_mac_is_b_eq_0_r <= 1'b1;
-		else if(regs_en & regs_wen & (regs_addr == 35) & POST_MAC_SUPPORTED)
-			post_mac_is_b_eq_0_r <= # SIM_DELAY regs_din[1];
+		else if(cfg_regs_upd[35] & POST_MAC_SUPPORTED)
+			post_mac_is_b_eq_0_r <= # SIM_DELAY cfg_regs_upd_din[35][1];
 	end
 	
 	// 后乘加处理的定点数量化精度
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 35) & POST_MAC_SUPPORTED & (INT8_SUPPORTED | INT16_SUPPORTED))
-			post_mac_fixed_point_quat_accrc_r <= # SIM_DELAY regs_din[12:8];
+		if(cfg_regs_upd[35] & POST_MAC_SUPPORTED & (INT8_SUPPORTED | INT16_SUPPORTED))
+			post_mac_fixed_point_quat_accrc_r <= # SIM_DELAY cfg_regs_upd_din[35][12:8];
 	end
 	
 	// 后乘加处理的参数A
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 36) & POST_MAC_SUPPORTED)
-			post_mac_param_a_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[36] & POST_MAC_SUPPORTED)
+			post_mac_param_a_r <= # SIM_DELAY cfg_regs_upd_din[36][31:0];
 	end
 	
 	// 后乘加处理的参数B
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 37) & POST_MAC_SUPPORTED)
-			post_mac_param_b_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[37] & POST_MAC_SUPPORTED)
+			post_mac_param_b_r <= # SIM_DELAY cfg_regs_upd_din[37][31:0];
 	end
 	
 	/**
-	寄存器(fmap_cfg0, fmap_cfg1, fmap_cfg2, fmap_cfg3, fmap_cfg4, fmap_cfg5, fmap_cfg6)
+	寄存器(fmap_cfg0, fmap_cfg1, fmap_cfg2, fmap_cfg3, fmap_cfg4, fmap_cfg5, fmap_cfg6, fmap_cfg7, fmap_cfg8, fmap_cfg9, fmap_cfg10)
 	
 	--------------------------------------------------------------------------------------------------------
 	|fmap_cfg0 | 0xC0/48 |31~0: 输入特征图基地址         |      RW      |                                  |
@@ -888,6 +1133,18 @@ module reg_if_for_generic_pool #(
 	|          |         |29~15: 输出特征图高度 - 1      |      RW      |                                  |
 	|          |         |31~30: 输出特征图数据大小类型  |      RW      |                                  |
 	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg7 | 0xDC/55 |23~0: 输出特征图表面行跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg8 | 0xE0/56 |31~0: 输出特征图通道组跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg9 | 0xE4/57 |23~0: 输入特征图表面行跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
+	|fmap_cfg10| 0xE8/58 |31~0: 输入特征图通道组跨距     |      RW      | 为0时按紧密存储计算              |
+	|          |         |      (字节数)                 |              |                                  |
+	--------------------------------------------------------------------------------------------------------
 	**/
 	reg[31:0] ifmap_baseaddr_r; // 输入特征图基地址
 	reg[31:0] ofmap_baseaddr_r; // 输出特征图基地址
@@ -902,6 +1159,10 @@ module reg_if_for_generic_pool #(
 	reg[14:0] ofmap_w_r; // 输出特征图宽度 - 1
 	reg[14:0] ofmap_h_r; // 输出特征图高度 - 1
 	reg[1:0] ofmap_data_type_r; // 输出特征图数据大小类型
+	reg[23:0] ofmap_row_pitch_r; // 输出特征图表面行跨距
+	reg[31:0] ofmap_cgrp_pitch_r; // 输出特征图通道组跨距
+	reg[23:0] ifmap_row_pitch_r; // 输入特征图表面行跨距
+	reg[31:0] ifmap_cgrp_pitch_r; // 输入特征图通道组跨距
 	
 	assign ifmap_baseaddr = ifmap_baseaddr_r;
 	assign ofmap_baseaddr = ofmap_baseaddr_r;
@@ -929,102 +1190,142 @@ module reg_if_for_generic_pool #(
 	assign ofmap_w = ofmap_w_r | 16'h0000;
 	assign ofmap_h = ofmap_h_r | 16'h0000;
 	assign ofmap_data_type = ofmap_data_type_r;
+	assign ofmap_row_pitch = ofmap_row_pitch_r;
+	assign ofmap_cgrp_pitch = ofmap_cgrp_pitch_r;
+	assign ifmap_row_pitch = ifmap_row_pitch_r;
+	assign ifmap_cgrp_pitch = ifmap_cgrp_pitch_r;
 	
 	// 输入特征图基地址
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 48))
-			ifmap_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[48])
+			ifmap_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[48][31:0];
 	end
 	
 	// 输出特征图基地址
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 49))
-			ofmap_baseaddr_r <= # SIM_DELAY regs_din[31:0];
+		if(cfg_regs_upd[49])
+			ofmap_baseaddr_r <= # SIM_DELAY cfg_regs_upd_din[49][31:0];
 	end
 	
 	// 输入特征图宽度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 50))
-			ifmap_w_r <= # SIM_DELAY regs_din[15:0];
+		if(cfg_regs_upd[50])
+			ifmap_w_r <= # SIM_DELAY cfg_regs_upd_din[50][15:0];
 	end
 	
 	// 输入特征图高度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 50))
-			ifmap_h_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[50])
+			ifmap_h_r <= # SIM_DELAY cfg_regs_upd_din[50][31:16];
 	end
 	
 	// 输入特征图大小 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 51))
-			ifmap_size_r <= # SIM_DELAY regs_din[23:0];
+		if(cfg_regs_upd[51])
+			ifmap_size_r <= # SIM_DELAY cfg_regs_upd_din[51][23:0];
 	end
 	
 	// 特征图通道数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 52))
-			fmap_chn_n_r <= # SIM_DELAY regs_din[15:0];
+		if(cfg_regs_upd[52])
+			fmap_chn_n_r <= # SIM_DELAY cfg_regs_upd_din[52][15:0];
 	end
 	
 	// 左部外填充数
 	always @(posedge aclk)
 	begin
 		if(
-			regs_en & regs_wen & (regs_addr == 52) & 
-			((regs_din[23:16] == 8'd0) | EXT_PADDING_SUPPORTED)
+			cfg_regs_upd[52] & 
+			((cfg_regs_upd_din[52][23:16] == 8'd0) | EXT_PADDING_SUPPORTED)
 		)
-			external_padding_left_r <= # SIM_DELAY regs_din[23:16];
+			external_padding_left_r <= # SIM_DELAY cfg_regs_upd_din[52][23:16];
 	end
 	
 	// 上部外填充数
 	always @(posedge aclk)
 	begin
 		if(
-			regs_en & regs_wen & (regs_addr == 52) & 
-			((regs_din[31:24] == 8'd0) | EXT_PADDING_SUPPORTED)
+			cfg_regs_upd[52] & 
+			((cfg_regs_upd_din[52][31:24] == 8'd0) | EXT_PADDING_SUPPORTED)
 		)
-			external_padding_top_r <= # SIM_DELAY regs_din[31:24];
+			external_padding_top_r <= # SIM_DELAY cfg_regs_upd_din[52][31:24];
 	end
 	
 	// 扩展输入特征图宽度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 53) & EXT_PADDING_SUPPORTED)
-			ext_ifmap_w_r <= # SIM_DELAY regs_din[15:0];
+		if(cfg_regs_upd[53] & EXT_PADDING_SUPPORTED)
+			ext_ifmap_w_r <= # SIM_DELAY cfg_regs_upd_din[53][15:0];
 	end
 	
 	// 扩展输入特征图高度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 53) & EXT_PADDING_SUPPORTED)
-			ext_ifmap_h_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[53] & EXT_PADDING_SUPPORTED)
+			ext_ifmap_h_r <= # SIM_DELAY cfg_regs_upd_din[53][31:16];
 	end
 	
 	// 输出特征图宽度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 54))
-			ofmap_w_r <= # SIM_DELAY regs_din[14:0];
+		if(cfg_regs_upd[54])
+			ofmap_w_r <= # SIM_DELAY cfg_regs_upd_din[54][14:0];
 	end
 	
 	// 输出特征图高度 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 54))
-			ofmap_h_r <= # SIM_DELAY regs_din[29:15];
+		if(cfg_regs_upd[54])
+			ofmap_h_r <= # SIM_DELAY cfg_regs_upd_din[54][29:15];
 	end
 	
 	// 输出特征图数据大小类型
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 54))
-			ofmap_data_type_r <= # SIM_DELAY regs_din[31:30];
+		if(cfg_regs_upd[54])
+			ofmap_data_type_r <= # SIM_DELAY cfg_regs_upd_din[54][31:30];
+	end
+	
+	// 输出特征图表面行跨距
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ofmap_row_pitch_r <= 24'h000000;
+		else if(cfg_regs_upd[55])
+			ofmap_row_pitch_r <= # SIM_DELAY cfg_regs_upd_din[55][23:0];
+	end
+	
+	// 输出特征图通道组跨距
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ofmap_cgrp_pitch_r <= 32'h0000_0000;
+		else if(cfg_regs_upd[56])
+			ofmap_cgrp_pitch_r <= # SIM_DELAY cfg_regs_upd_din[56][31:0];
+	end
+	
+	// 输入特征图表面行跨距
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ifmap_row_pitch_r <= 24'h000000;
+		else if(cfg_regs_upd[57])
+			ifmap_row_pitch_r <= # SIM_DELAY cfg_regs_upd_din[57][23:0];
+	end
+	
+	// 输入特征图通道组跨距
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ifmap_cgrp_pitch_r <= 32'h0000_0000;
+		else if(cfg_regs_upd[58])
+			ifmap_cgrp_pitch_r <= # SIM_DELAY cfg_regs_upd_din[58][31:0];
 	end
 	
 	/**
@@ -1050,22 +1351,22 @@ module reg_if_for_generic_pool #(
 	// 每个表面行的表面个数类型
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 64))
-			fmbufcoln_r <= # SIM_DELAY regs_din[3:0];
+		if(cfg_regs_upd[64])
+			fmbufcoln_r <= # SIM_DELAY cfg_regs_upd_din[64][3:0];
 	end
 	
 	// 特征图缓存可缓存的表面行数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 64))
-			fmbufrown_r <= # SIM_DELAY regs_din[31:16];
+		if(cfg_regs_upd[64])
+			fmbufrown_r <= # SIM_DELAY cfg_regs_upd_din[64][31:16];
 	end
 	
 	// 中间结果缓存可缓存行数 - 1
 	always @(posedge aclk)
 	begin
-		if(regs_en & regs_wen & (regs_addr == 65))
-			mid_res_buf_row_n_bufferable_r <= # SIM_DELAY regs_din[7:0];
+		if(cfg_regs_upd[65])
+			mid_res_buf_row_n_bufferable_r <= # SIM_DELAY cfg_regs_upd_din[65][7:0];
 	end
 	
 	/** 寄存器读结果 **/
@@ -1080,9 +1381,16 @@ module reg_if_for_generic_pool #(
 				3: regs_dout <= # SIM_DELAY {s2mm_strm_data_width_r[15:0], mm2s_strm_data_width_r[15:0]};
 				4: regs_dout <= # SIM_DELAY {phy_buffer_bank_depth_r[15:0], phy_buffer_bank_n_r[15:0]};
 				5: regs_dout <= # SIM_DELAY {mid_res_buf_bank_depth_r[15:0], mid_res_buf_bank_n_r[15:0]};
-				6: regs_dout <= # SIM_DELAY {8'd0, 8'd0, 8'd0, 4'd0, mid_res_buf_clk_rate_r[3:0]};
+				6: regs_dout <= # SIM_DELAY {8'd0, 8'd0, 6'd0, ifmap_pitch_supported_r, ofmap_pitch_supported_r, 4'd0, mid_res_buf_clk_rate_r[3:0]};
+				
+				14: regs_dout <= # SIM_DELAY {pm_snap_sel_dout[31:0]};
+				15: regs_dout <= # SIM_DELAY {pm_snap_sel_dout[63:32]};
 				
 				16: regs_dout <= # SIM_DELAY {8'd0, 8'd0, 4'd0, en_pm_cnt_r, to_use_post_mac_r, en_cal_sub_sys_r, en_accelerator_r, 8'd0};
+				17: regs_dout <= # SIM_DELAY {8'd0, 8'd0, 8'd0, 7'd0, en_done_irq_r};
+				18: regs_dout <= # SIM_DELAY {done_irq_s2mm_cmd_n_th_r[31:0]};
+				19: regs_dout <= # SIM_DELAY {30'd0, |shadow_cfg_pending, shadow_cfg_wen_r};
+				20: regs_dout <= # SIM_DELAY {20'd0, pm_snap_sel_r[3:0], 8'd0};
 				
 				24: regs_dout <= # SIM_DELAY {8'd0, 8'd0, 8'd0, 6'd0, fnl_res_tr_req_gen_blk_idle_r, sfc_row_access_blk_idle_r};
 				25: regs_dout <= # SIM_DELAY {dma_mm2s_fns_cmd_n_r[31:0]};
@@ -1091,6 +1399,7 @@ module reg_if_for_generic_pool #(
 				28: regs_dout <= # SIM_DELAY {mm2s_tsf_n_r[31:0]};
 				29: regs_dout <= # SIM_DELAY {s2mm_tsf_n_r[31:0]};
 				30: regs_dout <= # SIM_DELAY {upd_grp_run_n_r[31:0]};
+				31: regs_dout <= # SIM_DELAY {8'd0, 8'd0, 8'd0, 7'd0, done_irq_pending_r};
 				
 				32: regs_dout <= # SIM_DELAY 
 					{8'd0, pool_vertical_stride_r[7:0], pool_horizontal_stride_r[7:0], calfmt_r[3:0], proc_mode_r[3:0]};
@@ -1109,6 +1418,10 @@ module reg_if_for_generic_pool #(
 				52: regs_dout <= # SIM_DELAY {external_padding_top_r[7:0], external_padding_left_r[7:0], fmap_chn_n_r[15:0]};
 				53: regs_dout <= # SIM_DELAY {ext_ifmap_h_r[15:0], ext_ifmap_w_r[15:0]};
 				54: regs_dout <= # SIM_DELAY {ofmap_data_type_r[1:0], ofmap_h_r[14:0], ofmap_w_r[14:0]};
+				55: regs_dout <= # SIM_DELAY {8'h00, ofmap_row_pitch_r[23:0]};
+				56: regs_dout <= # SIM_DELAY {ofmap_cgrp_pitch_r[31:0]};
+				57: regs_dout <= # SIM_DELAY {8'h00, ifmap_row_pitch_r[23:0]};
+				58: regs_dout <= # SIM_DELAY {ifmap_cgrp_pitch_r[31:0]};
 				
 				64: regs_dout <= # SIM_DELAY {fmbufrown_r[15:0], 8'd0, 4'd0, fmbufcoln_r[3:0]};
 				65: regs_dout <= # SIM_DELAY {8'd0, 8'd0, 8'd0, mid_res_buf_row_n_bufferable_r[7:0]};
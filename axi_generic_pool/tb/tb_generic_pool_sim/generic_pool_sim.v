@@ -310,6 +310,8 @@ module generic_pool_sim #(
 		.fmap_chn_n(fmap_chn_n),
 		.external_padding_top(external_padding_top),
 		.ofmap_h(ofmap_h_for_sfc_row_access),
+		.ifmap_row_pitch(24'h000000),
+		.ifmap_cgrp_pitch(32'h0000_0000),
 		
 		.blk_start(sfc_row_access_blk_start),
 		.blk_idle(sfc_row_access_blk_idle),
@@ -448,6 +450,9 @@ module generic_pool_sim #(
 		.is_grp_conv_mode(1'b0),
 		.n_foreach_group(16'dx),
 		.en_send_sub_row_msg(1'b0),
+		.en_fused_max_pool(1'b0),
+		.ofmap_row_pitch(24'h000000),
+		.ofmap_cgrp_pitch(32'h0000_0000),
 		
 		.blk_start(fnl_res_tr_req_gen_blk_start),
 		.blk_idle(fnl_res_tr_req_gen_blk_idle),
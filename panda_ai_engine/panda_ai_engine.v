@@ -34,6 +34,8 @@ SOFTWARE.
 	支持计算轮次拓展
 	支持批归一化处理
 	支持Leaky-Relu激活、Sigmoid激活和Tanh激活
+	支持融合2x2最大池化(在舍入前对BN与激活后的结果做池化, 省去1次特征图写回与读取)
+	支持融合残差相加(在BN与激活后加上残差特征图, 省去1次逐元素相加)
 
 通用池化处理单元 -> 
 	支持最大池化、平均池化
@@ -50,8 +52,12 @@ SOFTWARE.
 
 运行时可选的输出数据舍入
 
+可选的事件跟踪单元(记录层开始/结束、卷积核组开始、特征图表面行加载与置换、权重通道组加载、最终结果行写出)
+
 注意：
 需要外接2个DMA(MM2S)通道和1个DMA(S2MM)通道
+启用事件跟踪单元(EN_EVT_TRACE = 1)时, 还需要外接1个DMA(S2MM)通道用于写出事件
+卷积支持残差相加(CONV_RESIDUAL_ADD_SUPPORTED = 1)时, 还需要外接1个DMA(MM2S)通道用于读取残差特征图
 
 可将SRAM和乘法器的接口引出, 在SOC层面再连接, 以实现SRAM和乘法器的共享
 
@@ -99,6 +105,9 @@ module panda_ai_engine #(
 	parameter integer CONV_EXT_PADDING_SUPPORTED = 1, // 是否支持卷积外填充
 	parameter integer CONV_INNER_PADDING_SUPPORTED = 0, // 是否支持卷积内填充
 	parameter integer KERNAL_DILATION_SUPPORTED = 0, // 是否支持卷积核膨胀
+	parameter integer CONV_FUSED_MAX_POOL_SUPPORTED = 1, // 卷积是否支持融合2x2最大池化
+	parameter integer CONV_FUSED_MAX_POOL_BUF_DEPTH = 1024, // 融合2x2最大池化行缓存深度(16~65536)
+	parameter integer CONV_RESIDUAL_ADD_SUPPORTED = 1, // 卷积是否支持融合残差相加
 	parameter integer MAX_POOL_SUPPORTED = 1, // 是否支持最大池化
 	parameter integer AVG_POOL_SUPPORTED = 0, // 是否支持平均池化
 	parameter integer UP_SAMPLE_SUPPORTED = 1, // 是否支持上采样
@@ -148,6 +157,8 @@ module panda_ai_engine #(
 	parameter integer RBUF_DEPTH = 512, // 中间结果缓存MEM深度(16 | ...)
 	// 仿真与调试配置
 	parameter integer EN_PERF_MON = 1, // 是否支持性能监测
+	parameter integer EN_EVT_TRACE = 0, // 是否启用事件跟踪单元
+	parameter integer EVT_TRACE_FIFO_DEPTH = 512, // 事件缓存深度(32 | 64 | 128 | 256 | 512 | 1024 | 2048 | 4096)
 	parameter real SIM_DELAY = 1 // 仿真延时
 )(
 	// 主时钟和复位
@@ -235,6 +246,29 @@ module panda_ai_engine #(
     input wire s_axi_lite_elm_wvalid,
     output wire s_axi_lite_elm_wready,
 	
+	// 寄存器配置接口#3(AXI-Lite从机)
+    // 读地址通道
+    input wire[31:0] s_axi_lite_trace_araddr,
+    input wire s_axi_lite_trace_arvalid,
+    output wire s_axi_lite_trace_arready,
+    // 写地址通道
+    input wire[31:0] s_axi_lite_trace_awaddr,
+    input wire s_axi_lite_trace_awvalid,
+    output wire s_axi_lite_trace_awready,
+    // 写响应通道
+    output wire[1:0] s_axi_lite_trace_bresp, // const -> 2'b00(OKAY)
+    output wire s_axi_lite_trace_bvalid,
+    input wire s_axi_lite_trace_bready,
+    // 读数据通道
+    output wire[31:0] s_axi_lite_trace_rdata,
+    output wire[1:0] s_axi_lite_trace_rresp, // const -> 2'b00(OKAY)
+    output wire s_axi_lite_trace_rvalid,
+    input wire s_axi_lite_trace_rready,
+    // 写数据通道
+    input wire[31:0] s_axi_lite_trace_wdata,
+    input wire s_axi_lite_trace_wvalid,
+    output wire s_axi_lite_trace_wready,
+	
 	// BN参数存储器(AXI从机)
     // 读地址通道
     input wire[31:0] s_axi_conv_araddr, // assumed to be aligned
@@ -308,6 +342,19 @@ module panda_ai_engine #(
 	input wire s1_dma_strm_axis_valid,
 	output wire s1_dma_strm_axis_ready,
 	
+	// 残差DMA(MM2S方向)命令流#2(AXIS主机)
+	output wire[55:0] m2_dma_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
+	output wire m2_dma_cmd_axis_user, // {固定(1'b1)/递增(1'b0)传输(1bit)}
+	output wire m2_dma_cmd_axis_last, // 帧尾标志
+	output wire m2_dma_cmd_axis_valid,
+	input wire m2_dma_cmd_axis_ready,
+	// 残差DMA(MM2S方向)数据流#2(AXIS从机)
+	input wire[MM2S_STREAM_DATA_WIDTH-1:0] s2_dma_strm_axis_data,
+	input wire[MM2S_STREAM_DATA_WIDTH/8-1:0] s2_dma_strm_axis_keep,
+	input wire s2_dma_strm_axis_last,
+	input wire s2_dma_strm_axis_valid,
+	output wire s2_dma_strm_axis_ready,
+	
 	// DMA(S2MM方向)命令流(AXIS主机)
 	output wire[55:0] m_dma_s2mm_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
 	output wire m_dma_s2mm_cmd_axis_user, // 固定(1'b1)/递增(1'b0)传输(1bit)
@@ -318,7 +365,26 @@ module panda_ai_engine #(
 	output wire[S2MM_STREAM_DATA_WIDTH/8-1:0] m_axis_fnl_res_keep,
 	output wire m_axis_fnl_res_last, // 本行最后1个最终结果(标志)
 	output wire m_axis_fnl_res_valid,
-	input wire m_axis_fnl_res_ready
+	input wire m_axis_fnl_res_ready,
+	
+	// 事件跟踪DMA(S2MM方向)命令流(AXIS主机)
+	output wire[55:0] m_trace_dma_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
+	output wire m_trace_dma_cmd_axis_user, // 固定(1'b1)/递增(1'b0)传输(1bit)
+	output wire m_trace_dma_cmd_axis_valid,
+	input wire m_trace_dma_cmd_axis_ready,
+	// 事件数据流(AXIS主机)
+	output wire[63:0] m_axis_trace_data,
+	output wire[7:0] m_axis_trace_keep,
+	output wire m_axis_trace_last,
+	output wire m_axis_trace_valid,
+	input wire m_axis_trace_ready,
+	// 事件跟踪DMA(S2MM方向)命令完成(指示)
+	input wire trace_s2mm_cmd_done,
+	
+	// 中断
+	output wire conv_irq, // 通用卷积处理单元完成中断
+	output wire pool_irq, // 通用池化处理单元完成中断
+	output wire elm_irq // 逐元素操作单元完成中断
 );
 	
 	// 计算bit_depth的最高有效位编号(即位数-1)
@@ -374,6 +440,8 @@ module panda_ai_engine #(
 	/** AXI-通用卷积处理单元(核心) **/
 	// 使能信号
 	wire en_conv_accelerator; // 使能卷积加速器
+	// 事件(指示)
+	wire conv_on_kernal_set_start; // 卷积核组开始
 	// (共享)数据枢纽
 	// [运行时参数]
 	wire[3:0] conv_data_hub_fmbufcoln; // 每个表面行的表面个数类型
@@ -383,6 +451,8 @@ module panda_ai_engine #(
 	wire[2:0] conv_data_hub_sfc_n_each_wgtblk; // 每个权重块的表面个数的类型
 	wire[7:0] conv_data_hub_kbufgrpn; // 可缓存的通道组数 - 1
 	wire[7:0] conv_data_hub_fmbufbankn; // 分配给特征图缓存的Bank数
+	wire conv_data_hub_on_fm_sfc_row_rplc; // 置换1个特征图表面行(指示)
+	wire conv_data_hub_on_kbuf_sw_rgn_rplc; // 置换1个交换区通道组(指示)
 	// [特征图表面行读请求(AXIS主机)]
 	wire[103:0] m_conv_fm_rd_req_axis_data;
 	wire m_conv_fm_rd_req_axis_valid;
@@ -411,6 +481,9 @@ module panda_ai_engine #(
 	wire[5:0] conv_fnl_res_tr_req_gen_max_wgtblk_w; // 权重块最大宽度
 	wire conv_fnl_res_tr_req_gen_is_grp_conv_mode; // 是否处于组卷积模式
 	wire[15:0] conv_fnl_res_tr_req_gen_n_foreach_group; // 每组的通道数/核数 - 1
+	wire conv_fnl_res_tr_req_gen_en_fused_max_pool; // 使能融合2x2最大池化
+	wire[23:0] conv_fnl_res_tr_req_gen_ofmap_row_pitch; // 输出特征图表面行跨距(0表示紧密存储)
+	wire[31:0] conv_fnl_res_tr_req_gen_ofmap_cgrp_pitch; // 输出特征图通道组跨距(0表示紧密存储)
 	// [块级控制]
 	wire conv_fnl_res_trans_blk_start;
 	wire conv_fnl_res_trans_blk_idle;
@@ -447,9 +520,15 @@ module panda_ai_engine #(
 	wire[4:0] conv_bn_act_bn_fixed_point_quat_accrc; // (批归一化操作数A)定点数量化精度
 	wire conv_bn_act_bn_is_a_eq_1; // 批归一化参数A的实际值为1(标志)
 	wire conv_bn_act_bn_is_b_eq_0; // 批归一化参数B的实际值为0(标志)
+	wire conv_bn_act_en_int8_requant; // 使能INT8逐通道重量化
+	wire[3:0] conv_bn_act_out_fixed_point_quat_accrc; // 输出舍入单元的定点数量化精度
 	wire[4:0] conv_bn_act_leaky_relu_fixed_point_quat_accrc; // (泄露Relu激活参数)定点数量化精度
 	wire[31:0] conv_bn_act_leaky_relu_param_alpha; // 泄露Relu激活参数
 	wire[4:0] conv_bn_act_sigmoid_tanh_fixed_point_quat_accrc; // (Sigmoid或Tanh输入)定点数量化精度
+	wire conv_bn_act_en_residual_add; // 使能残差相加
+	wire conv_bn_act_residual_relu; // 残差相加后做Relu
+	wire[5:0] conv_bn_act_residual_scale_exp; // 残差缩放系数的指数(有符号数)
+	wire[31:0] conv_bn_act_residual_baseaddr; // 残差特征图基地址
 	// [卷积最终结果(AXIS主机)]
 	wire[ATOMIC_K*32-1:0] m_axis_conv_ext_bn_act_i_data; // 对于ATOMIC_K个最终结果 -> {单精度浮点数或定点数(32位)}
 	wire[ATOMIC_K*4-1:0] m_axis_conv_ext_bn_act_i_keep;
@@ -482,6 +561,20 @@ module panda_ai_engine #(
 	// [运行时参数]
 	wire[1:0] conv_round_calfmt; // 运算数据格式
 	wire[3:0] conv_round_fixed_point_quat_accrc; // 定点数量化精度
+	// [待残差相加数据(AXIS主机)]
+	wire[ATOMIC_K*32-1:0] m_axis_conv_ext_res_i_data; // ATOMIC_K个定点数或FP32
+	wire[ATOMIC_K*4-1:0] m_axis_conv_ext_res_i_keep;
+	wire[4:0] m_axis_conv_ext_res_i_user;
+	wire m_axis_conv_ext_res_i_last;
+	wire m_axis_conv_ext_res_i_valid;
+	wire m_axis_conv_ext_res_i_ready;
+	// [待池化数据(AXIS主机)]
+	wire[ATOMIC_K*32-1:0] m_axis_conv_ext_fmp_i_data; // ATOMIC_K个定点数或FP32
+	wire[ATOMIC_K*4-1:0] m_axis_conv_ext_fmp_i_keep;
+	wire[4:0] m_axis_conv_ext_fmp_i_user;
+	wire m_axis_conv_ext_fmp_i_last;
+	wire m_axis_conv_ext_fmp_i_valid;
+	wire m_axis_conv_ext_fmp_i_ready;
 	// [待舍入数据(AXIS主机)]
 	wire[ATOMIC_K*32-1:0] m_axis_conv_ext_round_i_data; // ATOMIC_K个定点数或FP32
 	wire[ATOMIC_K*4-1:0] m_axis_conv_ext_round_i_keep;
@@ -503,6 +596,20 @@ module panda_ai_engine #(
 	wire m_axis_conv_ext_collector_last;
 	wire m_axis_conv_ext_collector_valid;
 	wire m_axis_conv_ext_collector_ready;
+	// 层描述符读取
+	wire conv_desc_dma_sel; // 0号MM2S通道选择(1'b1 -> 层描述符读取与执行单元, 1'b0 -> 数据枢纽)
+	// [DMA命令(AXIS主机)]
+	wire[55:0] m_conv_desc_dma_cmd_axis_data; // {待传输字节数(24bit), 传输首地址(32bit)}
+	wire m_conv_desc_dma_cmd_axis_user; // {固定(1'b1)/递增(1'b0)传输(1bit)}
+	wire m_conv_desc_dma_cmd_axis_last; // 帧尾标志
+	wire m_conv_desc_dma_cmd_axis_valid;
+	wire m_conv_desc_dma_cmd_axis_ready;
+	// [DMA数据流(AXIS从机)]
+	wire[MM2S_STREAM_DATA_WIDTH-1:0] s_conv_desc_dma_strm_axis_data;
+	wire[MM2S_STREAM_DATA_WIDTH/8-1:0] s_conv_desc_dma_strm_axis_keep;
+	wire s_conv_desc_dma_strm_axis_last;
+	wire s_conv_desc_dma_strm_axis_valid;
+	wire s_conv_desc_dma_strm_axis_ready;
 	
 	axi_generic_conv_core #(
 		.MAC_ARRAY_CLK_RATE(CONV_MAC_ARRAY_CLK_RATE),
@@ -521,6 +628,9 @@ module panda_ai_engine #(
 		.EXT_PADDING_SUPPORTED(CONV_EXT_PADDING_SUPPORTED),
 		.INNER_PADDING_SUPPORTED(CONV_INNER_PADDING_SUPPORTED),
 		.KERNAL_DILATION_SUPPORTED(KERNAL_DILATION_SUPPORTED),
+		.FUSED_MAX_POOL_SUPPORTED(CONV_FUSED_MAX_POOL_SUPPORTED),
+		.FUSED_MAX_POOL_BUF_DEPTH(CONV_FUSED_MAX_POOL_BUF_DEPTH),
+		.RESIDUAL_ADD_SUPPORTED(CONV_RESIDUAL_ADD_SUPPORTED),
 		.EN_PERF_MON(EN_PERF_MON),
 		.ACCELERATOR_ID(CONV_ACCELERATOR_ID),
 		.FP32_KEEP(FP32_KEEP),
@@ -547,6 +657,8 @@ module panda_ai_engine #(
 		
 		.en_accelerator(en_conv_accelerator),
 		
+		.on_kernal_set_start(conv_on_kernal_set_start),
+		
 		.s_axi_lite_araddr(s_axi_lite_conv_araddr),
 		.s_axi_lite_arvalid(s_axi_lite_conv_arvalid),
 		.s_axi_lite_arready(s_axi_lite_conv_arready),
@@ -615,6 +727,8 @@ module panda_ai_engine #(
 		.data_hub_sfc_n_each_wgtblk(conv_data_hub_sfc_n_each_wgtblk),
 		.data_hub_kbufgrpn(conv_data_hub_kbufgrpn),
 		.data_hub_fmbufbankn(conv_data_hub_fmbufbankn),
+		.data_hub_on_fm_sfc_row_rplc(conv_data_hub_on_fm_sfc_row_rplc),
+		.data_hub_on_kbuf_sw_rgn_rplc(conv_data_hub_on_kbuf_sw_rgn_rplc),
 		.m_fm_rd_req_axis_data(m_conv_fm_rd_req_axis_data),
 		.m_fm_rd_req_axis_valid(m_conv_fm_rd_req_axis_valid),
 		.m_fm_rd_req_axis_ready(m_conv_fm_rd_req_axis_ready),
@@ -638,6 +752,9 @@ module panda_ai_engine #(
 		.fnl_res_tr_req_gen_max_wgtblk_w(conv_fnl_res_tr_req_gen_max_wgtblk_w),
 		.fnl_res_tr_req_gen_is_grp_conv_mode(conv_fnl_res_tr_req_gen_is_grp_conv_mode),
 		.fnl_res_tr_req_gen_n_foreach_group(conv_fnl_res_tr_req_gen_n_foreach_group),
+		.fnl_res_tr_req_gen_en_fused_max_pool(conv_fnl_res_tr_req_gen_en_fused_max_pool),
+		.fnl_res_tr_req_gen_ofmap_row_pitch(conv_fnl_res_tr_req_gen_ofmap_row_pitch),
+		.fnl_res_tr_req_gen_ofmap_cgrp_pitch(conv_fnl_res_tr_req_gen_ofmap_cgrp_pitch),
 		.fnl_res_trans_blk_start(conv_fnl_res_trans_blk_start),
 		.fnl_res_trans_blk_idle(conv_fnl_res_trans_blk_idle),
 		.fnl_res_trans_blk_done(conv_fnl_res_trans_blk_done),
@@ -667,9 +784,15 @@ module panda_ai_engine #(
 		.bn_act_bn_fixed_point_quat_accrc(conv_bn_act_bn_fixed_point_quat_accrc),
 		.bn_act_bn_is_a_eq_1(conv_bn_act_bn_is_a_eq_1),
 		.bn_act_bn_is_b_eq_0(conv_bn_act_bn_is_b_eq_0),
+		.bn_act_en_int8_requant(conv_bn_act_en_int8_requant),
+		.bn_act_out_fixed_point_quat_accrc(conv_bn_act_out_fixed_point_quat_accrc),
 		.bn_act_leaky_relu_fixed_point_quat_accrc(conv_bn_act_leaky_relu_fixed_point_quat_accrc),
 		.bn_act_leaky_relu_param_alpha(conv_bn_act_leaky_relu_param_alpha),
 		.bn_act_sigmoid_tanh_fixed_point_quat_accrc(conv_bn_act_sigmoid_tanh_fixed_point_quat_accrc),
+		.bn_act_en_residual_add(conv_bn_act_en_residual_add),
+		.bn_act_residual_relu(conv_bn_act_residual_relu),
+		.bn_act_residual_scale_exp(conv_bn_act_residual_scale_exp),
+		.bn_act_residual_baseaddr(conv_bn_act_residual_baseaddr),
 		.m_axis_ext_bn_act_i_data(m_axis_conv_ext_bn_act_i_data),
 		.m_axis_ext_bn_act_i_keep(m_axis_conv_ext_bn_act_i_keep),
 		.m_axis_ext_bn_act_i_user(m_axis_conv_ext_bn_act_i_user),
@@ -697,12 +820,12 @@ module panda_ai_engine #(
 		
 		.round_calfmt(conv_round_calfmt),
 		.round_fixed_point_quat_accrc(conv_round_fixed_point_quat_accrc),
-		.m_axis_ext_round_i_data(m_axis_conv_ext_round_i_data),
-		.m_axis_ext_round_i_keep(m_axis_conv_ext_round_i_keep),
-		.m_axis_ext_round_i_user(m_axis_conv_ext_round_i_user),
-		.m_axis_ext_round_i_last(m_axis_conv_ext_round_i_last),
-		.m_axis_ext_round_i_valid(m_axis_conv_ext_round_i_valid),
-		.m_axis_ext_round_i_ready(m_axis_conv_ext_round_i_ready),
+		.m_axis_ext_round_i_data(m_axis_conv_ext_res_i_data),
+		.m_axis_ext_round_i_keep(m_axis_conv_ext_res_i_keep),
+		.m_axis_ext_round_i_user(m_axis_conv_ext_res_i_user),
+		.m_axis_ext_round_i_last(m_axis_conv_ext_res_i_last),
+		.m_axis_ext_round_i_valid(m_axis_conv_ext_res_i_valid),
+		.m_axis_ext_round_i_ready(m_axis_conv_ext_res_i_ready),
 		.s_axis_ext_round_o_data(s_axis_conv_ext_round_o_data),
 		.s_axis_ext_round_o_keep(s_axis_conv_ext_round_o_keep),
 		.s_axis_ext_round_o_user(s_axis_conv_ext_round_o_user),
@@ -716,11 +839,68 @@ module panda_ai_engine #(
 		.m_axis_ext_collector_valid(m_axis_conv_ext_collector_valid),
 		.m_axis_ext_collector_ready(m_axis_conv_ext_collector_ready),
 		
+		.desc_dma_sel(conv_desc_dma_sel),
+		.m_desc_dma_cmd_axis_data(m_conv_desc_dma_cmd_axis_data),
+		.m_desc_dma_cmd_axis_user(m_conv_desc_dma_cmd_axis_user),
+		.m_desc_dma_cmd_axis_last(m_conv_desc_dma_cmd_axis_last),
+		.m_desc_dma_cmd_axis_valid(m_conv_desc_dma_cmd_axis_valid),
+		.m_desc_dma_cmd_axis_ready(m_conv_desc_dma_cmd_axis_ready),
+		.s_desc_dma_strm_axis_data(s_conv_desc_dma_strm_axis_data),
+		.s_desc_dma_strm_axis_keep(s_conv_desc_dma_strm_axis_keep),
+		.s_desc_dma_strm_axis_last(s_conv_desc_dma_strm_axis_last),
+		.s_desc_dma_strm_axis_valid(s_conv_desc_dma_strm_axis_valid),
+		.s_desc_dma_strm_axis_ready(s_conv_desc_dma_strm_axis_ready),
+		
 		.mm2s_0_cmd_done(mm2s_0_cmd_done),
 		.mm2s_1_cmd_done(mm2s_1_cmd_done),
-		.s2mm_cmd_done(s2mm_cmd_done)
+		.s2mm_cmd_done(s2mm_cmd_done),
+		
+		.irq(conv_irq)
 	);
 	
+	/** 卷积最终结果的融合2x2最大池化单元 **/
+	generate
+		if(CONV_FUSED_MAX_POOL_SUPPORTED)
+		begin
+			conv_fused_max_pool #(
+				.ATOMIC_K(ATOMIC_K),
+				.BUF_DEPTH(CONV_FUSED_MAX_POOL_BUF_DEPTH),
+				.SIM_DELAY(SIM_DELAY)
+			)conv_fused_max_pool_u(
+				.aclk(aclk),
+				.aresetn(aresetn),
+				
+				.en_fused_max_pool(en_conv_accelerator & conv_fnl_res_tr_req_gen_en_fused_max_pool),
+				.calfmt(conv_round_calfmt),
+				.ofmap_w(conv_fnl_res_tr_req_gen_ofmap_w),
+				.ofmap_h(conv_fnl_res_tr_req_gen_ofmap_h),
+				
+				.s_axis_data(m_axis_conv_ext_fmp_i_data),
+				.s_axis_keep(m_axis_conv_ext_fmp_i_keep),
+				.s_axis_user(m_axis_conv_ext_fmp_i_user),
+				.s_axis_last(m_axis_conv_ext_fmp_i_last),
+				.s_axis_valid(m_axis_conv_ext_fmp_i_valid),
+				.s_axis_ready(m_axis_conv_ext_fmp_i_ready),
+				
+				.m_axis_data(m_axis_conv_ext_round_i_data),
+				.m_axis_keep(m_axis_conv_ext_round_i_keep),
+				.m_axis_user(m_axis_conv_ext_round_i_user),
+				.m_axis_last(m_axis_conv_ext_round_i_last),
+				.m_axis_valid(m_axis_conv_ext_round_i_valid),
+				.m_axis_ready(m_axis_conv_ext_round_i_ready)
+			);
+		end
+		else
+		begin
+			assign m_axis_conv_ext_round_i_data = m_axis_conv_ext_fmp_i_data;
+			assign m_axis_conv_ext_round_i_keep = m_axis_conv_ext_fmp_i_keep;
+			assign m_axis_conv_ext_round_i_user = m_axis_conv_ext_fmp_i_user;
+			assign m_axis_conv_ext_round_i_last = m_axis_conv_ext_fmp_i_last;
+			assign m_axis_conv_ext_round_i_valid = m_axis_conv_ext_fmp_i_valid;
+			assign m_axis_conv_ext_fmp_i_ready = m_axis_conv_ext_round_i_ready;
+		end
+	endgenerate
+	
 	/** AXI-通用池化处理单元(核心) **/
 	// 使能信号
 	wire en_pool_accelerator; // 使能池化加速器
@@ -755,6 +935,8 @@ module panda_ai_engine #(
 	wire[5:0] pool_fnl_res_tr_req_gen_max_wgtblk_w; // 权重块最大宽度
 	wire pool_fnl_res_tr_req_gen_is_grp_conv_mode; // 是否处于组卷积模式
 	wire pool_fnl_res_tr_req_gen_en_send_sub_row_msg; // 是否输出子表面行信息
+	wire[23:0] pool_fnl_res_tr_req_gen_ofmap_row_pitch; // 输出特征图表面行跨距(0表示紧密存储)
+	wire[31:0] pool_fnl_res_tr_req_gen_ofmap_cgrp_pitch; // 输出特征图通道组跨距(0表示紧密存储)
 	// [块级控制]
 	wire pool_fnl_res_tr_req_gen_blk_start;
 	wire pool_fnl_res_tr_req_gen_blk_idle;
@@ -772,7 +954,7 @@ module panda_ai_engine #(
 	wire[1:0] pool_mid_res_buf_pool_mode; // 池化模式
 	// [性能监测]
 	wire pool_en_upd_grp_run_cnt; // 使能更新单元组运行周期数计数器
-	wire[31:0] pool_upd_grp_run_n; // 更新单元组运行周期数
+	wire[63:0] pool_upd_grp_run_n; // 更新单元组运行周期数
 	// [中间结果(AXIS主机)]
 	wire[ATOMIC_C*48-1:0] m_axis_pool_ext_mid_res_data;
 	wire[ATOMIC_C*6-1:0] m_axis_pool_ext_mid_res_keep;
@@ -898,6 +1080,8 @@ module panda_ai_engine #(
 		.mm2s_cmd_done(mm2s_0_cmd_done),
 		.s2mm_cmd_done(s2mm_cmd_done),
 		
+		.irq(pool_irq),
+		
 		.data_hub_fmbufcoln(pool_data_hub_fmbufcoln),
 		.data_hub_fmbufrown(pool_data_hub_fmbufrown),
 		.data_hub_fmrow_random_rd_mode(pool_data_hub_fmrow_random_rd_mode),
@@ -923,6 +1107,8 @@ module panda_ai_engine #(
 		.fnl_res_tr_req_gen_max_wgtblk_w(pool_fnl_res_tr_req_gen_max_wgtblk_w),
 		.fnl_res_tr_req_gen_is_grp_conv_mode(pool_fnl_res_tr_req_gen_is_grp_conv_mode),
 		.fnl_res_tr_req_gen_en_send_sub_row_msg(pool_fnl_res_tr_req_gen_en_send_sub_row_msg),
+		.fnl_res_tr_req_gen_ofmap_row_pitch(pool_fnl_res_tr_req_gen_ofmap_row_pitch),
+		.fnl_res_tr_req_gen_ofmap_cgrp_pitch(pool_fnl_res_tr_req_gen_ofmap_cgrp_pitch),
 		.fnl_res_tr_req_gen_blk_start(pool_fnl_res_tr_req_gen_blk_start),
 		.fnl_res_tr_req_gen_blk_idle(pool_fnl_res_tr_req_gen_blk_idle),
 		.fnl_res_tr_req_gen_blk_done(pool_fnl_res_tr_req_gen_blk_done),
@@ -1092,6 +1278,8 @@ module panda_ai_engine #(
 		.mm2s_1_cmd_done(mm2s_1_cmd_done),
 		.s2mm_cmd_done(s2mm_cmd_done),
 		
+		.irq(elm_irq),
+		
 		.m0_dma_cmd_axis_data(m0_elm_dma_cmd_axis_data),
 		.m0_dma_cmd_axis_user(m0_elm_dma_cmd_axis_user),
 		.m0_dma_cmd_axis_last(m0_elm_dma_cmd_axis_last),
@@ -1138,6 +1326,9 @@ module panda_ai_engine #(
 	wire[2:0] data_hub_sfc_n_each_wgtblk; // 每个权重块的表面个数的类型
 	wire[7:0] data_hub_kbufgrpn; // 可缓存的通道组数 - 1
 	wire[7:0] data_hub_fmbufbankn; // 分配给特征图缓存的Bank数
+	// 性能监测
+	wire data_hub_on_fm_sfc_row_rplc; // 置换1个特征图表面行(指示)
+	wire data_hub_on_kbuf_sw_rgn_rplc; // 置换1个交换区通道组(指示)
 	// 特征图表面行读请求(AXIS从机)
 	wire[103:0] s_data_hub_fm_rd_req_axis_data;
 	wire s_data_hub_fm_rd_req_axis_valid;
@@ -1173,6 +1364,15 @@ module panda_ai_engine #(
 	wire s0_conv_pool_dma_strm_axis_last;
 	wire s0_conv_pool_dma_strm_axis_valid;
 	wire s0_conv_pool_dma_strm_axis_ready;
+	// 数据枢纽的DMA(MM2S方向)命令流#0(AXIS主机)
+	wire[55:0] m0_data_hub_dma_cmd_axis_data; // {待传输字节数(24bit), 传输首地址(32bit)}
+	wire m0_data_hub_dma_cmd_axis_user; // {固定(1'b1)/递增(1'b0)传输(1bit)}
+	wire m0_data_hub_dma_cmd_axis_last; // 帧尾标志
+	wire m0_data_hub_dma_cmd_axis_valid;
+	wire m0_data_hub_dma_cmd_axis_ready;
+	// 数据枢纽的DMA(MM2S方向)数据流#0(AXIS从机)
+	wire s0_data_hub_dma_strm_axis_valid;
+	wire s0_data_hub_dma_strm_axis_ready;
 	// DMA(MM2S方向)命令流#1(AXIS主机)
 	wire[55:0] m1_conv_pool_dma_cmd_axis_data; // {待传输字节数(24bit), 传输首地址(32bit)}
 	wire m1_conv_pool_dma_cmd_axis_user; // {固定(1'b1)/递增(1'b0)传输(1bit)}
@@ -1236,6 +1436,9 @@ module panda_ai_engine #(
 		({8{en_conv_accelerator}} & conv_data_hub_fmbufbankn) | 
 		({8{en_pool_accelerator}} & pool_data_hub_fmbufbankn);
 	
+	assign conv_data_hub_on_fm_sfc_row_rplc = en_conv_accelerator & data_hub_on_fm_sfc_row_rplc;
+	assign conv_data_hub_on_kbuf_sw_rgn_rplc = en_conv_accelerator & data_hub_on_kbuf_sw_rgn_rplc;
+	
 	assign s_data_hub_fm_rd_req_axis_data = 
 		({104{en_conv_accelerator}} & m_conv_fm_rd_req_axis_data) | 
 		({104{en_pool_accelerator}} & m_pool_fm_rd_req_axis_data);
@@ -1298,6 +1501,9 @@ module panda_ai_engine #(
 		.kbufgrpn(data_hub_kbufgrpn),
 		.fmbufbankn(data_hub_fmbufbankn),
 		
+		.on_fm_sfc_row_rplc(data_hub_on_fm_sfc_row_rplc),
+		.on_kbuf_sw_rgn_rplc(data_hub_on_kbuf_sw_rgn_rplc),
+		
 		.s_fm_rd_req_axis_data(s_data_hub_fm_rd_req_axis_data),
 		.s_fm_rd_req_axis_valid(s_data_hub_fm_rd_req_axis_valid),
 		.s_fm_rd_req_axis_ready(s_data_hub_fm_rd_req_axis_ready),
@@ -1321,17 +1527,17 @@ module panda_ai_engine #(
 		.m_kout_wgtblk_axis_valid(m_data_hub_kout_wgtblk_axis_valid),
 		.m_kout_wgtblk_axis_ready(m_data_hub_kout_wgtblk_axis_ready),
 		
-		.m0_dma_cmd_axis_data(m0_conv_pool_dma_cmd_axis_data),
-		.m0_dma_cmd_axis_user(m0_conv_pool_dma_cmd_axis_user),
-		.m0_dma_cmd_axis_last(m0_conv_pool_dma_cmd_axis_last),
-		.m0_dma_cmd_axis_valid(m0_conv_pool_dma_cmd_axis_valid),
-		.m0_dma_cmd_axis_ready(m0_conv_pool_dma_cmd_axis_ready),
+		.m0_dma_cmd_axis_data(m0_data_hub_dma_cmd_axis_data),
+		.m0_dma_cmd_axis_user(m0_data_hub_dma_cmd_axis_user),
+		.m0_dma_cmd_axis_last(m0_data_hub_dma_cmd_axis_last),
+		.m0_dma_cmd_axis_valid(m0_data_hub_dma_cmd_axis_valid),
+		.m0_dma_cmd_axis_ready(m0_data_hub_dma_cmd_axis_ready),
 		
 		.s0_dma_strm_axis_data(s0_conv_pool_dma_strm_axis_data),
 		.s0_dma_strm_axis_keep(s0_conv_pool_dma_strm_axis_keep),
 		.s0_dma_strm_axis_last(s0_conv_pool_dma_strm_axis_last),
-		.s0_dma_strm_axis_valid(s0_conv_pool_dma_strm_axis_valid),
-		.s0_dma_strm_axis_ready(s0_conv_pool_dma_strm_axis_ready),
+		.s0_dma_strm_axis_valid(s0_data_hub_dma_strm_axis_valid),
+		.s0_dma_strm_axis_ready(s0_data_hub_dma_strm_axis_ready),
 		
 		.m1_dma_cmd_axis_data(m1_conv_pool_dma_cmd_axis_data),
 		.m1_dma_cmd_axis_user(m1_conv_pool_dma_cmd_axis_user),
@@ -1515,7 +1721,7 @@ module panda_ai_engine #(
 	wire acmlt_out_last_res; // 本行最后1个中间结果(标志)
 	wire acmlt_out_to_upd_mem; // 更新缓存MEM(标志)
 	// [性能监测]
-	reg[31:0] upd_grp_run_cnt; // 更新单元组运行周期数(计数器)
+	reg[63:0] upd_grp_run_cnt; // 更新单元组运行周期数(计数器)
 	
 	generate
 		if(SHARED_MID_RES_BUF_ALWAYS_SEL_POOL_ACC)
@@ -1607,14 +1813,14 @@ module panda_ai_engine #(
 	always @(posedge acmlt_aclk or negedge acmlt_aresetn)
 	begin
 		if(~acmlt_aresetn)
-			upd_grp_run_cnt <= 32'd0;
+			upd_grp_run_cnt <= 64'd0;
 		else if(
 			(~pool_en_upd_grp_run_cnt_delayed[2]) | acmlt_out_valid[0]
 		)
 			upd_grp_run_cnt <= # SIM_DELAY 
 				pool_en_upd_grp_run_cnt_delayed[2] ? 
 					(upd_grp_run_cnt + 1'b1):
-					32'd0;
+					64'd0;
 	end
 	
 	genvar acmlt_i;
@@ -1893,6 +2099,9 @@ module panda_ai_engine #(
 	wire fnl_res_tr_req_gen_is_grp_conv_mode; // 是否处于组卷积模式
 	wire[15:0] fnl_res_tr_req_gen_n_foreach_group; // 每组的通道数/核数 - 1
 	wire fnl_res_tr_req_gen_en_send_sub_row_msg; // 是否输出子表面行信息
+	wire fnl_res_tr_req_gen_en_fused_max_pool; // 使能融合2x2最大池化
+	wire[23:0] fnl_res_tr_req_gen_ofmap_row_pitch; // 输出特征图表面行跨距(0表示紧密存储)
+	wire[31:0] fnl_res_tr_req_gen_ofmap_cgrp_pitch; // 输出特征图通道组跨距(0表示紧密存储)
 	// 块级控制
 	wire fnl_res_trans_blk_start;
 	wire fnl_res_trans_blk_idle;
@@ -1969,6 +2178,14 @@ module panda_ai_engine #(
 		conv_fnl_res_tr_req_gen_n_foreach_group;
 	assign fnl_res_tr_req_gen_en_send_sub_row_msg = 
 		en_conv_accelerator;
+	assign fnl_res_tr_req_gen_en_fused_max_pool = 
+		en_conv_accelerator & conv_fnl_res_tr_req_gen_en_fused_max_pool;
+	assign fnl_res_tr_req_gen_ofmap_row_pitch = 
+		({24{en_conv_accelerator}} & conv_fnl_res_tr_req_gen_ofmap_row_pitch) | 
+		({24{en_pool_accelerator}} & pool_fnl_res_tr_req_gen_ofmap_row_pitch);
+	assign fnl_res_tr_req_gen_ofmap_cgrp_pitch = 
+		({32{en_conv_accelerator}} & conv_fnl_res_tr_req_gen_ofmap_cgrp_pitch) | 
+		({32{en_pool_accelerator}} & pool_fnl_res_tr_req_gen_ofmap_cgrp_pitch);
 	
 	assign fnl_res_trans_blk_start = 
 		(en_conv_accelerator & conv_fnl_res_trans_blk_start) | 
@@ -2045,6 +2262,9 @@ module panda_ai_engine #(
 		.is_grp_conv_mode(fnl_res_tr_req_gen_is_grp_conv_mode),
 		.n_foreach_group(fnl_res_tr_req_gen_n_foreach_group),
 		.en_send_sub_row_msg(fnl_res_tr_req_gen_en_send_sub_row_msg),
+		.en_fused_max_pool(fnl_res_tr_req_gen_en_fused_max_pool),
+		.ofmap_row_pitch(fnl_res_tr_req_gen_ofmap_row_pitch),
+		.ofmap_cgrp_pitch(fnl_res_tr_req_gen_ofmap_cgrp_pitch),
 		
 		.blk_start(fnl_res_trans_blk_start),
 		.blk_idle(fnl_res_trans_blk_idle),
@@ -2079,6 +2299,89 @@ module panda_ai_engine #(
 		.mul1_ovld(fnl_res_trans_mul1_ovld)
 	);
 	
+	/** 卷积最终结果的残差相加单元 **/
+	// 最终结果传输请求(AXIS主机)
+	wire[55:0] m_conv_pool_s2mm_cmd_axis_data; // {待传输字节数(24bit), 传输首地址(32bit)}
+	wire[24:0] m_conv_pool_s2mm_cmd_axis_user; // {命令ID(24bit), 固定(1'b1)/递增(1'b0)传输(1bit)}
+	wire m_conv_pool_s2mm_cmd_axis_valid;
+	wire m_conv_pool_s2mm_cmd_axis_ready;
+	
+	generate
+		if(CONV_RESIDUAL_ADD_SUPPORTED)
+		begin
+			conv_residual_add #(
+				.ATOMIC_K(ATOMIC_K),
+				.MM2S_STREAM_DATA_WIDTH(MM2S_STREAM_DATA_WIDTH),
+				.SIM_DELAY(SIM_DELAY)
+			)conv_residual_add_u(
+				.aclk(aclk),
+				.aresetn(aresetn),
+				
+				.en_residual_add(en_conv_accelerator & conv_bn_act_en_residual_add),
+				.residual_relu(conv_bn_act_residual_relu),
+				.residual_scale_exp(conv_bn_act_residual_scale_exp),
+				.calfmt(conv_round_calfmt),
+				.ofmap_data_type(conv_fnl_res_tr_req_gen_ofmap_data_type),
+				.ofmap_baseaddr(conv_fnl_res_tr_req_gen_ofmap_baseaddr),
+				.residual_baseaddr(conv_bn_act_residual_baseaddr),
+				
+				.s_fnl_res_cmd_axis_data(m_conv_pool_dma_cmd_axis_data),
+				.s_fnl_res_cmd_axis_user(m_conv_pool_dma_cmd_axis_user),
+				.s_fnl_res_cmd_axis_valid(m_conv_pool_dma_cmd_axis_valid),
+				.s_fnl_res_cmd_axis_ready(m_conv_pool_dma_cmd_axis_ready),
+				.m_fnl_res_cmd_axis_data(m_conv_pool_s2mm_cmd_axis_data),
+				.m_fnl_res_cmd_axis_user(m_conv_pool_s2mm_cmd_axis_user),
+				.m_fnl_res_cmd_axis_valid(m_conv_pool_s2mm_cmd_axis_valid),
+				.m_fnl_res_cmd_axis_ready(m_conv_pool_s2mm_cmd_axis_ready),
+				
+				.m_res_dma_cmd_axis_data(m2_dma_cmd_axis_data),
+				.m_res_dma_cmd_axis_user(m2_dma_cmd_axis_user),
+				.m_res_dma_cmd_axis_last(m2_dma_cmd_axis_last),
+				.m_res_dma_cmd_axis_valid(m2_dma_cmd_axis_valid),
+				.m_res_dma_cmd_axis_ready(m2_dma_cmd_axis_ready),
+				.s_res_dma_strm_axis_data(s2_dma_strm_axis_data),
+				.s_res_dma_strm_axis_keep(s2_dma_strm_axis_keep),
+				.s_res_dma_strm_axis_last(s2_dma_strm_axis_last),
+				.s_res_dma_strm_axis_valid(s2_dma_strm_axis_valid),
+				.s_res_dma_strm_axis_ready(s2_dma_strm_axis_ready),
+				
+				.s_axis_data(m_axis_conv_ext_res_i_data),
+				.s_axis_keep(m_axis_conv_ext_res_i_keep),
+				.s_axis_user(m_axis_conv_ext_res_i_user),
+				.s_axis_last(m_axis_conv_ext_res_i_last),
+				.s_axis_valid(m_axis_conv_ext_res_i_valid),
+				.s_axis_ready(m_axis_conv_ext_res_i_ready),
+				
+				.m_axis_data(m_axis_conv_ext_fmp_i_data),
+				.m_axis_keep(m_axis_conv_ext_fmp_i_keep),
+				.m_axis_user(m_axis_conv_ext_fmp_i_user),
+				.m_axis_last(m_axis_conv_ext_fmp_i_last),
+				.m_axis_valid(m_axis_conv_ext_fmp_i_valid),
+				.m_axis_ready(m_axis_conv_ext_fmp_i_ready)
+			);
+		end
+		else
+		begin
+			assign m_conv_pool_s2mm_cmd_axis_data = m_conv_pool_dma_cmd_axis_data;
+			assign m_conv_pool_s2mm_cmd_axis_user = m_conv_pool_dma_cmd_axis_user;
+			assign m_conv_pool_s2mm_cmd_axis_valid = m_conv_pool_dma_cmd_axis_valid;
+			assign m_conv_pool_dma_cmd_axis_ready = m_conv_pool_s2mm_cmd_axis_ready;
+			
+			assign m2_dma_cmd_axis_data = 56'd0;
+			assign m2_dma_cmd_axis_user = 1'b0;
+			assign m2_dma_cmd_axis_last = 1'b1;
+			assign m2_dma_cmd_axis_valid = 1'b0;
+			assign s2_dma_strm_axis_ready = 1'b1;
+			
+			assign m_axis_conv_ext_fmp_i_data = m_axis_conv_ext_res_i_data;
+			assign m_axis_conv_ext_fmp_i_keep = m_axis_conv_ext_res_i_keep;
+			assign m_axis_conv_ext_fmp_i_user = m_axis_conv_ext_res_i_user;
+			assign m_axis_conv_ext_fmp_i_last = m_axis_conv_ext_res_i_last;
+			assign m_axis_conv_ext_fmp_i_valid = m_axis_conv_ext_res_i_valid;
+			assign m_axis_conv_ext_res_i_ready = m_axis_conv_ext_fmp_i_ready;
+		end
+	endgenerate
+	
 	/** BN与激活单元 **/
 	// 使能信号
 	wire en_bn_act_proc_dup; // 使能处理单元
@@ -2089,6 +2392,8 @@ module panda_ai_engine #(
 	wire[4:0] bn_act_bn_fixed_point_quat_accrc; // (批归一化操作数A)定点数量化精度
 	wire bn_act_bn_is_a_eq_1; // 批归一化参数A的实际值为1(标志)
 	wire bn_act_bn_is_b_eq_0; // 批归一化参数B的实际值为0(标志)
+	wire bn_act_en_int8_requant; // 使能INT8逐通道重量化
+	wire[3:0] bn_act_out_fixed_point_quat_accrc; // 输出舍入单元的定点数量化精度
 	wire bn_act_is_in_const_mac_mode; // 是否处于常量乘加模式
 	wire[31:0] bn_act_param_a_in_const_mac_mode; // 常量乘加模式下的参数A
 	wire[31:0] bn_act_param_b_in_const_mac_mode; // 常量乘加模式下的参数B
@@ -2165,6 +2470,8 @@ module panda_ai_engine #(
 	assign bn_act_bn_is_b_eq_0 = 
 		(en_conv_accelerator & conv_bn_act_bn_is_b_eq_0) | 
 		(en_pool_accelerator & pool_bn_act_bn_is_b_eq_0);
+	assign bn_act_en_int8_requant = en_conv_accelerator & conv_bn_act_en_int8_requant;
+	assign bn_act_out_fixed_point_quat_accrc = {4{en_conv_accelerator}} & conv_bn_act_out_fixed_point_quat_accrc;
 	assign bn_act_is_in_const_mac_mode = en_pool_accelerator;
 	assign bn_act_param_a_in_const_mac_mode = pool_bn_act_param_a_in_const_mac_mode;
 	assign bn_act_param_b_in_const_mac_mode = pool_bn_act_param_b_in_const_mac_mode;
@@ -2229,6 +2536,8 @@ module panda_ai_engine #(
 		.bn_fixed_point_quat_accrc(bn_act_bn_fixed_point_quat_accrc),
 		.bn_is_a_eq_1(bn_act_bn_is_a_eq_1),
 		.bn_is_b_eq_0(bn_act_bn_is_b_eq_0),
+		.en_int8_requant(bn_act_en_int8_requant),
+		.out_fixed_point_quat_accrc(bn_act_out_fixed_point_quat_accrc),
 		.is_in_const_mac_mode(bn_act_is_in_const_mac_mode),
 		.param_a_in_const_mac_mode(bn_act_param_a_in_const_mac_mode),
 		.param_b_in_const_mac_mode(bn_act_param_b_in_const_mac_mode),
@@ -2466,6 +2775,38 @@ module panda_ai_engine #(
 	);
 	
 	/** DMA通道 **/
+	// 读取卷积层描述符或BN参数时, 0号MM2S通道由卷积层描述符读取与执行单元占用
+	assign m0_conv_pool_dma_cmd_axis_data = 
+		conv_desc_dma_sel ? 
+			m_conv_desc_dma_cmd_axis_data:
+			m0_data_hub_dma_cmd_axis_data;
+	assign m0_conv_pool_dma_cmd_axis_user = 
+		conv_desc_dma_sel ? 
+			m_conv_desc_dma_cmd_axis_user:
+			m0_data_hub_dma_cmd_axis_user;
+	assign m0_conv_pool_dma_cmd_axis_last = 
+		conv_desc_dma_sel ? 
+			m_conv_desc_dma_cmd_axis_last:
+			m0_data_hub_dma_cmd_axis_last;
+	assign m0_conv_pool_dma_cmd_axis_valid = 
+		conv_desc_dma_sel ? 
+			m_conv_desc_dma_cmd_axis_valid:
+			m0_data_hub_dma_cmd_axis_valid;
+	assign m_conv_desc_dma_cmd_axis_ready = 
+		conv_desc_dma_sel & m0_conv_pool_dma_cmd_axis_ready;
+	assign m0_data_hub_dma_cmd_axis_ready = 
+		(~conv_desc_dma_sel) & m0_conv_pool_dma_cmd_axis_ready;
+	
+	assign s_conv_desc_dma_strm_axis_data = s0_conv_pool_dma_strm_axis_data;
+	assign s_conv_desc_dma_strm_axis_keep = s0_conv_pool_dma_strm_axis_keep;
+	assign s_conv_desc_dma_strm_axis_last = s0_conv_pool_dma_strm_axis_last;
+	assign s_conv_desc_dma_strm_axis_valid = conv_desc_dma_sel & s0_conv_pool_dma_strm_axis_valid;
+	assign s0_data_hub_dma_strm_axis_valid = (~conv_desc_dma_sel) & s0_conv_pool_dma_strm_axis_valid;
+	assign s0_conv_pool_dma_strm_axis_ready = 
+		conv_desc_dma_sel ? 
+			s_conv_desc_dma_strm_axis_ready:
+			s0_data_hub_dma_strm_axis_ready;
+	
 	assign m0_dma_cmd_axis_data = 
 		en_elm_proc_accelerator ? 
 			m0_elm_dma_cmd_axis_data:
@@ -2537,18 +2878,18 @@ module panda_ai_engine #(
 	assign m_dma_s2mm_cmd_axis_data = 
 		en_elm_proc_accelerator ? 
 			m_elm_dma_s2mm_cmd_axis_data:
-			m_conv_pool_dma_cmd_axis_data;
+			m_conv_pool_s2mm_cmd_axis_data;
 	assign m_dma_s2mm_cmd_axis_user = 
 		en_elm_proc_accelerator ? 
 			m_elm_dma_s2mm_cmd_axis_user:
-			m_conv_pool_dma_cmd_axis_user[0];
+			m_conv_pool_s2mm_cmd_axis_user[0];
 	assign m_dma_s2mm_cmd_axis_valid = 
 		en_elm_proc_accelerator ? 
 			m_elm_dma_s2mm_cmd_axis_valid:
-			m_conv_pool_dma_cmd_axis_valid;
+			m_conv_pool_s2mm_cmd_axis_valid;
 	assign m_elm_dma_s2mm_cmd_axis_ready = 
 		(~en_elm_proc_accelerator) | m_dma_s2mm_cmd_axis_ready;
-	assign m_conv_pool_dma_cmd_axis_ready = 
+	assign m_conv_pool_s2mm_cmd_axis_ready = 
 		en_elm_proc_accelerator | m_dma_s2mm_cmd_axis_ready;
 	
 	assign m_axis_fnl_res_data = 
@@ -2572,6 +2913,123 @@ module panda_ai_engine #(
 	assign m_axis_collector_ready = 
 		en_elm_proc_accelerator | m_axis_fnl_res_ready;
 	
+	/** 事件跟踪单元 **/
+	generate
+		if(EN_EVT_TRACE)
+		begin
+			// 事件(指示)
+			wire trace_on_conv_start; // 卷积层开始
+			wire trace_on_pool_start; // 池化层开始
+			wire trace_on_elm_start; // 逐元素操作开始
+			wire trace_on_s2mm_issue_fns; // 本层的S2MM命令已全部发送
+			wire trace_on_fmap_row_load; // 特征图表面行加载(发送命令)
+			wire trace_on_fmap_row_load_done; // 特征图表面行加载完成
+			wire trace_on_kernal_cgrp_load; // 权重通道组加载(发送命令)
+			wire trace_on_kernal_cgrp_load_done; // 权重通道组加载完成
+			wire trace_on_fnl_res_row_wr; // 最终结果行写出(发送命令)
+			
+			// 卷积/池化层以启动(共享)最终结果传输请求生成单元作为开始
+			assign trace_on_conv_start = 
+				en_conv_accelerator & conv_fnl_res_trans_blk_start & fnl_res_trans_blk_idle;
+			assign trace_on_pool_start = 
+				en_pool_accelerator & pool_fnl_res_tr_req_gen_blk_start & fnl_res_trans_blk_idle;
+			// 逐元素操作以发送第1个DMA命令作为开始, 且每次只发送1个S2MM命令
+			assign trace_on_elm_start = 
+				en_elm_proc_accelerator & (
+					(m0_elm_dma_cmd_axis_valid & m0_elm_dma_cmd_axis_ready) | 
+					(m1_elm_dma_cmd_axis_valid & m1_elm_dma_cmd_axis_ready) | 
+					(m_elm_dma_s2mm_cmd_axis_valid & m_elm_dma_s2mm_cmd_axis_ready)
+				);
+			assign trace_on_s2mm_issue_fns = 
+				en_elm_proc_accelerator ? 
+					(m_elm_dma_s2mm_cmd_axis_valid & m_elm_dma_s2mm_cmd_axis_ready):
+					fnl_res_trans_blk_done;
+			// 读取卷积层描述符或BN参数时占用的0号MM2S通道命令不计入特征图表面行加载
+			assign trace_on_fmap_row_load = 
+				(~en_elm_proc_accelerator) & m0_data_hub_dma_cmd_axis_valid & m0_data_hub_dma_cmd_axis_ready;
+			assign trace_on_fmap_row_load_done = 
+				(~en_elm_proc_accelerator) & (~conv_desc_dma_sel) & mm2s_0_cmd_done;
+			assign trace_on_kernal_cgrp_load = 
+				en_conv_accelerator & m1_conv_pool_dma_cmd_axis_valid & m1_conv_pool_dma_cmd_axis_ready;
+			assign trace_on_kernal_cgrp_load_done = 
+				en_conv_accelerator & mm2s_1_cmd_done;
+			assign trace_on_fnl_res_row_wr = 
+				m_dma_s2mm_cmd_axis_valid & m_dma_s2mm_cmd_axis_ready;
+			
+			panda_ai_evt_trace #(
+				.EVT_FIFO_DEPTH(EVT_TRACE_FIFO_DEPTH),
+				.BURST_EVT_N(8),
+				.SIM_DELAY(SIM_DELAY)
+			)panda_ai_evt_trace_u(
+				.aclk(aclk),
+				.aresetn(aresetn),
+				
+				.s_axi_lite_araddr(s_axi_lite_trace_araddr),
+				.s_axi_lite_arvalid(s_axi_lite_trace_arvalid),
+				.s_axi_lite_arready(s_axi_lite_trace_arready),
+				.s_axi_lite_awaddr(s_axi_lite_trace_awaddr),
+				.s_axi_lite_awvalid(s_axi_lite_trace_awvalid),
+				.s_axi_lite_awready(s_axi_lite_trace_awready),
+				.s_axi_lite_bresp(s_axi_lite_trace_bresp),
+				.s_axi_lite_bvalid(s_axi_lite_trace_bvalid),
+				.s_axi_lite_bready(s_axi_lite_trace_bready),
+				.s_axi_lite_rdata(s_axi_lite_trace_rdata),
+				.s_axi_lite_rresp(s_axi_lite_trace_rresp),
+				.s_axi_lite_rvalid(s_axi_lite_trace_rvalid),
+				.s_axi_lite_rready(s_axi_lite_trace_rready),
+				.s_axi_lite_wdata(s_axi_lite_trace_wdata),
+				.s_axi_lite_wvalid(s_axi_lite_trace_wvalid),
+				.s_axi_lite_wready(s_axi_lite_trace_wready),
+				
+				.on_conv_start(trace_on_conv_start),
+				.on_pool_start(trace_on_pool_start),
+				.on_elm_start(trace_on_elm_start),
+				.on_s2mm_issue_fns(trace_on_s2mm_issue_fns),
+				.on_kernal_set_start(en_conv_accelerator & conv_on_kernal_set_start),
+				.on_fmap_row_load(trace_on_fmap_row_load),
+				.on_fmap_row_load_done(trace_on_fmap_row_load_done),
+				.on_fmap_row_rplc(conv_data_hub_on_fm_sfc_row_rplc),
+				.on_kernal_cgrp_load(trace_on_kernal_cgrp_load),
+				.on_kernal_cgrp_load_done(trace_on_kernal_cgrp_load_done),
+				.on_fnl_res_row_wr(trace_on_fnl_res_row_wr),
+				.on_fnl_res_row_wr_done(s2mm_cmd_done),
+				
+				.m_trace_dma_cmd_axis_data(m_trace_dma_cmd_axis_data),
+				.m_trace_dma_cmd_axis_user(m_trace_dma_cmd_axis_user),
+				.m_trace_dma_cmd_axis_valid(m_trace_dma_cmd_axis_valid),
+				.m_trace_dma_cmd_axis_ready(m_trace_dma_cmd_axis_ready),
+				
+				.m_axis_trace_data(m_axis_trace_data),
+				.m_axis_trace_keep(m_axis_trace_keep),
+				.m_axis_trace_last(m_axis_trace_last),
+				.m_axis_trace_valid(m_axis_trace_valid),
+				.m_axis_trace_ready(m_axis_trace_ready),
+				
+				.trace_s2mm_cmd_done(trace_s2mm_cmd_done)
+			);
+		end
+		else
+		begin
+			assign s_axi_lite_trace_arready = 1'b0;
+			assign s_axi_lite_trace_awready = 1'b0;
+			assign s_axi_lite_trace_bresp = 2'b00;
+			assign s_axi_lite_trace_bvalid = 1'b0;
+			assign s_axi_lite_trace_rdata = 32'h0000_0000;
+			assign s_axi_lite_trace_rresp = 2'b00;
+			assign s_axi_lite_trace_rvalid = 1'b0;
+			assign s_axi_lite_trace_wready = 1'b0;
+			
+			assign m_trace_dma_cmd_axis_data = 56'd0;
+			assign m_trace_dma_cmd_axis_user = 1'b0;
+			assign m_trace_dma_cmd_axis_valid = 1'b0;
+			
+			assign m_axis_trace_data = 64'd0;
+			assign m_axis_trace_keep = 8'h00;
+			assign m_axis_trace_last = 1'b0;
+			assign m_axis_trace_valid = 1'b0;
+		end
+	endgenerate
+	
 	/** 乘法器 **/
 	unsigned_mul #(
 		.op_a_width(16),
@@ -0,0 +1,159 @@
+/************************************************************************************************************************
+大胖达AI引擎张量存储区规划
+@brief  根据每个缓存区的大小和生存期(首次/最后1次使用的层号), 离线地把缓存区放进同一个存储区,
+        生存期不重叠的缓存区可以复用同一段空间, 并给出存储区的峰值大小
+        按大小从大到小依次放置每个缓存区, 在与其生存期重叠的已放置缓存区之间选择能放下它的最小空隙(最佳适配),
+        没有合适的空隙时放在这些缓存区之后
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include "panda_ai_arena.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint8_t panda_ai_arena_is_lifetime_overlapped(const PandaAiArenaBuf* buf_a, const PandaAiArenaBuf* buf_b); // 判断2个缓存区的生存期是否重叠
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  规划存储区
+        每个缓存区的偏移都对齐到align字节, 生存期重叠的缓存区在存储区中互不重叠
+@param  buf_arr 待放置的缓存区数组(首地址)
+        buf_n 缓存区个数
+        align 对齐字节数(必须是2的幂)
+        peak 存储区的峰值大小(字节数, 指针)
+@return 是否成功
+*************************/
+int panda_ai_arena_plan(PandaAiArenaBuf* buf_arr, uint16_t buf_n, uint32_t align, uint32_t* peak){
+	if(align == 0 || (align & (align - 1))){
+		return -1;
+	}
+
+	for(uint16_t i = 0;i < buf_n;i++){
+		if(buf_arr[i].size > 0 && buf_arr[i].first_use > buf_arr[i].last_use){
+			return -1;
+		}
+
+		buf_arr[i].offset = PANDA_AI_ARENA_UNPLACED;
+	}
+
+	*peak = 0;
+
+	while(1){
+		PandaAiArenaBuf* cur = NULL;
+
+		// 选出最大的未放置缓存区(大小相同时取首次使用较早的)
+		for(uint16_t i = 0;i < buf_n;i++){
+			PandaAiArenaBuf* buf = buf_arr + i;
+
+			if(buf->size > 0 && buf->offset == PANDA_AI_ARENA_UNPLACED &&
+				(cur == NULL || buf->size > cur->size || (buf->size == cur->size && buf->first_use < cur->first_use))){
+				cur = buf;
+			}
+		}
+
+		if(cur == NULL){
+			break;
+		}
+
+		uint64_t best_ofs = 0;
+		uint64_t best_gap = UINT64_MAX;
+		uint8_t found = 0;
+
+		// 候选偏移: 0, 以及每个生存期重叠的已放置缓存区的尾部
+		for(int32_t c = -1;c < (int32_t)buf_n;c++){
+			uint64_t cand;
+			uint64_t gap_end = UINT64_MAX;
+			uint8_t fit = 1;
+
+			if(c < 0){
+				cand = 0;
+			}else{
+				const PandaAiArenaBuf* buf = buf_arr + c;
+
+				if(buf == cur || buf->size == 0 || buf->offset == PANDA_AI_ARENA_UNPLACED ||
+					(!panda_ai_arena_is_lifetime_overlapped(buf, cur))){
+					continue;
+				}
+
+				cand = (((uint64_t)buf->offset) + buf->size + align - 1) & (~((uint64_t)(align - 1)));
+			}
+
+			for(uint16_t j = 0;j < buf_n;j++){
+				const PandaAiArenaBuf* buf = buf_arr + j;
+
+				if(buf == cur || buf->size == 0 || buf->offset == PANDA_AI_ARENA_UNPLACED ||
+					(!panda_ai_arena_is_lifetime_overlapped(buf, cur)) ||
+					((uint64_t)buf->offset) + buf->size <= cand){
+					continue;
+				}
+
+				if(((uint64_t)buf->offset) < cand + cur->size){
+					fit = 0;
+
+					break;
+				}
+
+				if(((uint64_t)buf->offset) < gap_end){
+					gap_end = buf->offset;
+				}
+			}
+
+			if(fit){
+				uint64_t gap = (gap_end == UINT64_MAX) ? UINT64_MAX:(gap_end - cand);
+
+				if((!found) || gap < best_gap || (gap == best_gap && cand < best_ofs)){
+					best_ofs = cand;
+					best_gap = gap;
+					found = 1;
+				}
+			}
+		}
+
+		if(best_ofs + cur->size > ((uint64_t)PANDA_AI_ARENA_UNPLACED)){
+			return -2;
+		}
+
+		cur->offset = (uint32_t)best_ofs;
+
+		if(cur->offset + cur->size > *peak){
+			*peak = cur->offset + cur->size;
+		}
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  判断2个缓存区在存储区中是否重叠
+@param  buf_a 缓存区a(句柄)
+        buf_b 缓存区b(句柄)
+@return 是否重叠
+*************************/
+uint8_t panda_ai_arena_is_overlapped(const PandaAiArenaBuf* buf_a, const PandaAiArenaBuf* buf_b){
+	if(buf_a->size == 0 || buf_b->size == 0 ||
+		buf_a->offset == PANDA_AI_ARENA_UNPLACED || buf_b->offset == PANDA_AI_ARENA_UNPLACED){
+		return 0;
+	}
+
+	return (((uint64_t)buf_a->offset) < ((uint64_t)buf_b->offset) + buf_b->size) &&
+		(((uint64_t)buf_b->offset) < ((uint64_t)buf_a->offset) + buf_a->size);
+}
+
+/*************************
+@cfg
+@private
+@brief  判断2个缓存区的生存期是否重叠
+@param  buf_a 缓存区a(句柄)
+        buf_b 缓存区b(句柄)
+@return 是否重叠
+*************************/
+static uint8_t panda_ai_arena_is_lifetime_overlapped(const PandaAiArenaBuf* buf_a, const PandaAiArenaBuf* buf_b){
+	return !(buf_a->last_use < buf_b->first_use || buf_b->last_use < buf_a->first_use);
+}
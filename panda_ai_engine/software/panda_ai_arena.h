@@ -0,0 +1,33 @@
+/************************************************************************************************************************
+大胖达AI引擎张量存储区规划(接口头文件)
+@brief  根据每个缓存区的大小和生存期(首次/最后1次使用的层号), 离线地把缓存区放进同一个存储区,
+        生存期不重叠的缓存区可以复用同一段空间, 并给出存储区的峰值大小
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 表示未放置的偏移
+#define PANDA_AI_ARENA_UNPLACED 0xFFFFFFFF
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 待放置的缓存区
+typedef struct{
+	uint32_t size; // 字节数(为0表示无需放置)
+	uint16_t first_use; // 首次使用的层号
+	uint16_t last_use; // 最后1次使用的层号(含)
+
+	uint32_t offset; // 在存储区中的偏移(由规划器填写)
+}PandaAiArenaBuf;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int panda_ai_arena_plan(PandaAiArenaBuf* buf_arr, uint16_t buf_n, uint32_t align, uint32_t* peak); // 规划存储区
+uint8_t panda_ai_arena_is_overlapped(const PandaAiArenaBuf* buf_a, const PandaAiArenaBuf* buf_b); // 判断2个缓存区在存储区中是否重叠
@@ -0,0 +1,882 @@
+/************************************************************************************************************************
+大胖达AI引擎网络运行时
+@brief  以层列表描述整个网络(卷积/池化/上采样/逐元素操作, 层之间以张量号相连),
+        编译时推导中间张量的形状, 并按生存期把中间张量放进同一个存储区(生存期不重叠的张量复用空间),
+        运行时按数据依赖把每层派发到对应的处理单元,
+        不同引擎上的相互独立的分支可同时执行
+        同一个引擎内的处理单元共享DMA通道(卷积与池化还共享物理缓存), 运行时在派发时才使能对应的处理单元, 完成后立即除能
+        中间张量只由加速器访问, 网络输入/输出的DCache维护由调用者负责
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 按生存期规划中间张量存储区
+        2026.10.17 1.02 支持融合2x2最大池化的卷积层
+        2026.10.17 1.03 复用卷积驱动的获取卷积核边长函数
+        2026.10.17 1.04 融合残差相加的残差张量作为卷积层的输入张量B参与数据依赖和生存期规划
+        2026.10.17 1.05 张量按紧密存储分配, 拒绝给出输出/输入特征图跨距的卷积、池化和上采样层
+        2026.10.17 1.06 1字节张量按通道对分配, INT8卷积层要求ATOMIC_K = ATOMIC_C * 2(重量化的输出可直接作为下一层的输入)
+************************************************************************************************************************/
+
+#include "panda_ai_rt.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int panda_ai_rt_infer_layer(PandaAiRtNet* net, uint16_t layer_id); // 推导1层的输出张量形状
+static uint8_t panda_ai_rt_is_layer_supported(const PandaAiRtEngine* engine, const PandaAiRtLayer* layer); // 判断引擎是否支持某层
+static int panda_ai_rt_plan_arena(PandaAiRtNet* net); // 规划中间张量存储区
+static uint8_t panda_ai_rt_is_layer_ready(const PandaAiRtNet* net, const PandaAiRtLayer* layer, uint16_t done_prefix); // 判断某层是否可以启动
+static int panda_ai_rt_start_layer(PandaAiRtNet* net, uint8_t engine_id, uint16_t layer_id); // 在引擎上启动1层
+static uint8_t panda_ai_rt_is_layer_done(PandaAiRtNet* net, uint8_t engine_id, uint16_t layer_id); // 判断引擎上运行的层是否完成
+static int panda_ai_rt_finish_layer(PandaAiRtNet* net, uint8_t engine_id, uint16_t layer_id); // 结束引擎上运行的层
+static uint8_t panda_ai_rt_get_elm_data_byte_n(uint32_t fmt); // 获取逐元素操作的数据字节数
+static uint16_t panda_ai_rt_get_in_b_tensor_id(const PandaAiRtLayer* layer); // 获取某层实际读取的输入张量B的张量号
+static uint8_t panda_ai_rt_is_pool_fmap_pitched(const AxiGnrPoolFmapCfg* fmap_cfg); // 判断池化/上采样层是否给出了特征图跨距
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@init
+@public
+@brief  初始化网络
+@param  net 网络(句柄)
+        engine_arr 引擎数组(首地址)
+        engine_n 引擎个数
+        tensor_arr 张量数组(首地址)
+        tensor_n 张量个数
+        layer_arr 层数组(首地址, 须按拓扑顺序给出)
+        layer_n 层数
+@return 是否成功
+*************************/
+int panda_ai_rt_init(PandaAiRtNet* net, const PandaAiRtEngine* engine_arr, uint8_t engine_n,
+	PandaAiRtTensor* tensor_arr, uint16_t tensor_n, PandaAiRtLayer* layer_arr, uint16_t layer_n){
+	if(engine_n == 0 || engine_n > PANDA_AI_RT_MAX_ENGINE_N || tensor_n == 0 || tensor_n == PANDA_AI_RT_NO_TENSOR || layer_n == 0){
+		return -1;
+	}
+
+	memcpy((void*)net->engine_arr, (const void*)engine_arr, sizeof(PandaAiRtEngine) * engine_n);
+	net->engine_n = engine_n;
+
+	net->tensor_arr = tensor_arr;
+	net->tensor_n = tensor_n;
+	net->layer_arr = layer_arr;
+	net->layer_n = layer_n;
+
+	net->arena_buf_arr = NULL;
+	net->arena = NULL;
+	net->arena_len = 0;
+	net->arena_peak = 0;
+
+	net->wait_hook = NULL;
+	net->wait_hook_arg = NULL;
+
+	for(uint8_t i = 0;i < PANDA_AI_RT_MAX_ENGINE_N;i++){
+		net->running_layer[i] = PANDA_AI_RT_NO_TENSOR;
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  设置等待任意1层完成时的回调函数
+        运行网络时, 若所有正在运行的层都未完成, 则调用一次回调函数后再查询
+@param  net 网络(句柄)
+        hook 回调函数(为NULL时忙等待)
+        arg 回调函数的参数
+@return none
+*************************/
+void panda_ai_rt_set_wait_hook(PandaAiRtNet* net, PandaAiRtWaitHook hook, void* arg){
+	net->wait_hook = hook;
+	net->wait_hook_arg = arg;
+}
+
+/*************************
+@cfg
+@public
+@brief  编译网络
+        按层的顺序推导每个输出张量的形状和元素字节数, 再按生存期为基地址为NULL的张量规划存储区,
+        规划得到的存储区峰值大小保存在net->arena_peak
+        网络输入张量(不由任何层生成)须由调用者给出形状、元素字节数和基地址
+        arena为NULL时仅规划存储区(可用于查询所需的存储区大小), 之后须再次编译以分配中间张量
+@param  net 网络(句柄)
+        arena_buf_arr 存储区规划结果(长度为张量个数)
+        arena 中间张量存储区(须位于加速器可通过DMA访问的存储区, 基地址对齐到PANDA_AI_RT_TENSOR_ALIGN字节)
+        arena_len 中间张量存储区的字节数
+@return 是否成功
+*************************/
+int panda_ai_rt_compile(PandaAiRtNet* net, PandaAiArenaBuf* arena_buf_arr,
+	uint8_t* arena, uint32_t arena_len){
+	if(arena_buf_arr == NULL || (((uintptr_t)arena) & (PANDA_AI_RT_TENSOR_ALIGN - 1))){
+		return -1;
+	}
+
+	net->arena_buf_arr = arena_buf_arr;
+	net->arena = arena;
+	net->arena_len = arena_len;
+	net->arena_peak = 0;
+
+	for(uint16_t i = 0;i < net->tensor_n;i++){
+		PandaAiRtTensor* tensor = net->tensor_arr + i;
+
+		// 上次编译时分配的中间张量重新参与规划
+		if(tensor->in_arena){
+			tensor->baseaddr = NULL;
+			tensor->in_arena = 0;
+		}
+
+		tensor->producer = PANDA_AI_RT_NO_TENSOR;
+	}
+
+	// 记录每个张量的生成层
+	for(uint16_t i = 0;i < net->layer_n;i++){
+		PandaAiRtLayer* layer = net->layer_arr + i;
+
+		if(layer->out_tensor_id >= net->tensor_n || net->tensor_arr[layer->out_tensor_id].producer != PANDA_AI_RT_NO_TENSOR){
+			return -1;
+		}
+
+		net->tensor_arr[layer->out_tensor_id].producer = i;
+	}
+
+	for(uint16_t i = 0;i < net->layer_n;i++){
+		PandaAiRtLayer* layer = net->layer_arr + i;
+		uint8_t supported = 0;
+
+		for(uint8_t e = 0;e < net->engine_n;e++){
+			supported |= panda_ai_rt_is_layer_supported(net->engine_arr + e, layer);
+		}
+
+		if(!supported){
+			return -2;
+		}
+
+		if(panda_ai_rt_infer_layer(net, i)){
+			return -3;
+		}
+
+		layer->s2mm_cmd_n = 0;
+		layer->reuse_dep = PANDA_AI_RT_NO_TENSOR;
+		layer->sts = PANDA_AI_LAYER_WAITING;
+		layer->engine_id = 0;
+	}
+
+	if(panda_ai_rt_plan_arena(net)){
+		return -4;
+	}
+
+	if(arena == NULL){
+		return 0;
+	}
+
+	if(net->arena_peak > arena_len){
+		return -4;
+	}
+
+	// 分配中间张量
+	for(uint16_t i = 0;i < net->tensor_n;i++){
+		if(arena_buf_arr[i].size > 0){
+			net->tensor_arr[i].baseaddr = arena + arena_buf_arr[i].offset;
+			net->tensor_arr[i].in_arena = 1;
+		}
+	}
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  运行网络
+        每当有引擎空闲时, 按层的顺序找到第1个可以启动且该引擎支持的层并启动,
+        因此位于不同引擎上的相互独立的分支(如YOLO颈部的上采样与横向卷积)会同时执行
+@param  net 网络(句柄)
+@return 是否成功
+*************************/
+int panda_ai_rt_run(PandaAiRtNet* net){
+	uint16_t done_n = 0;
+	uint16_t done_prefix = 0; // 从第0层起连续完成的层数
+
+	for(uint16_t i = 0;i < net->layer_n;i++){
+		net->layer_arr[i].sts = PANDA_AI_LAYER_WAITING;
+	}
+
+	for(uint8_t e = 0;e < net->engine_n;e++){
+		net->running_layer[e] = PANDA_AI_RT_NO_TENSOR;
+	}
+
+	while(done_n < net->layer_n){
+		uint8_t running_n = 0;
+		uint8_t progress = 0;
+
+		// 派发
+		for(uint8_t e = 0;e < net->engine_n;e++){
+			if(net->running_layer[e] == PANDA_AI_RT_NO_TENSOR){
+				for(uint16_t i = 0;i < net->layer_n;i++){
+					PandaAiRtLayer* layer = net->layer_arr + i;
+
+					if(layer->sts == PANDA_AI_LAYER_WAITING &&
+						panda_ai_rt_is_layer_supported(net->engine_arr + e, layer) &&
+						panda_ai_rt_is_layer_ready(net, layer, done_prefix)){
+						if(panda_ai_rt_start_layer(net, e, i)){
+							return -2;
+						}
+
+						break;
+					}
+				}
+			}
+
+			if(net->running_layer[e] != PANDA_AI_RT_NO_TENSOR){
+				running_n++;
+			}
+		}
+
+		if(running_n == 0){
+			// 没有可执行的层(输入永远无法就绪)
+			return -1;
+		}
+
+		// 查询完成
+		for(uint8_t e = 0;e < net->engine_n;e++){
+			uint16_t layer_id = net->running_layer[e];
+
+			if(layer_id != PANDA_AI_RT_NO_TENSOR && panda_ai_rt_is_layer_done(net, e, layer_id)){
+				if(panda_ai_rt_finish_layer(net, e, layer_id)){
+					return -3;
+				}
+
+				done_n++;
+				progress = 1;
+			}
+		}
+
+		while(done_prefix < net->layer_n && net->layer_arr[done_prefix].sts == PANDA_AI_LAYER_DONE){
+			done_prefix++;
+		}
+
+		if((!progress) && net->wait_hook != NULL){
+			net->wait_hook(net->wait_hook_arg);
+		}
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  推导1层的输出张量形状
+        检查输入张量的合法性, 填写输出张量的宽度、高度、通道数和元素字节数
+@param  net 网络(句柄)
+        layer_id 层号
+@return 是否成功
+*************************/
+static int panda_ai_rt_infer_layer(PandaAiRtNet* net, uint16_t layer_id){
+	PandaAiRtLayer* layer = net->layer_arr + layer_id;
+	PandaAiRtTensor* in_tensor;
+	PandaAiRtTensor* out_tensor = net->tensor_arr + layer->out_tensor_id;
+
+	if(layer->in_tensor_id >= net->tensor_n){
+		return -1;
+	}
+
+	in_tensor = net->tensor_arr + layer->in_tensor_id;
+
+	// 输入张量须由之前的层生成, 或者是给出了基地址的网络输入
+	if(in_tensor->producer == PANDA_AI_RT_NO_TENSOR){
+		if(in_tensor->baseaddr == NULL || in_tensor->w == 0 || in_tensor->h == 0 || in_tensor->c == 0){
+			return -1;
+		}
+	}else if(in_tensor->producer >= layer_id){
+		return -1;
+	}
+
+	if(layer->type == PANDA_AI_LAYER_CONV){
+		AxiGnrConvCfg* cfg = &layer->param.conv.cfg;
+		uint32_t kernal_len = axi_generic_conv_get_kernal_len(cfg->kernal_cfg.kernal_shape);
+		uint32_t dilated_kernal_len = kernal_len + (kernal_len - 1) * ((uint32_t)cfg->kernal_cfg.dilation_n);
+		uint32_t ext_fmap_w =
+			((uint32_t)in_tensor->w) +
+			((uint32_t)cfg->fmap_cfg.external_padding_left) + ((uint32_t)cfg->fmap_cfg.external_padding_right) +
+			((uint32_t)(in_tensor->w - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_left_right);
+		uint32_t ext_fmap_h =
+			((uint32_t)in_tensor->h) +
+			((uint32_t)cfg->fmap_cfg.external_padding_top) + ((uint32_t)cfg->fmap_cfg.external_padding_bottom) +
+			((uint32_t)(in_tensor->h - 1)) * ((uint32_t)cfg->fmap_cfg.inner_padding_top_bottom);
+
+		if(in_tensor->data_byte_n != ((cfg->cal_cfg.cal_fmt == CONV_INT8) ? 1:2) ||
+			cfg->cal_cfg.conv_horizontal_stride == 0 || cfg->cal_cfg.conv_vertical_stride == 0 ||
+			ext_fmap_w < dilated_kernal_len || ext_fmap_h < dilated_kernal_len ||
+			(cfg->group_n <= 1 && cfg->kernal_cfg.kernal_chn_n != in_tensor->c)){
+			return -2;
+		}
+
+		// 张量按紧密存储分配, 不支持输出/输入特征图跨距
+		if(cfg->fmap_cfg.ofmap_chn_ofs || cfg->fmap_cfg.ofmap_row_pitch || cfg->fmap_cfg.ofmap_cgrp_pitch ||
+			cfg->fmap_cfg.ifmap_start_cgrp || cfg->fmap_cfg.ifmap_row_pitch || cfg->fmap_cfg.ifmap_cgrp_pitch){
+			return -2;
+		}
+
+		cfg->fmap_cfg.ifmap_width = in_tensor->w;
+		cfg->fmap_cfg.ifmap_height = in_tensor->h;
+		cfg->fmap_cfg.ifmap_chn_n = in_tensor->c;
+
+		out_tensor->w = (uint16_t)((ext_fmap_w - dilated_kernal_len) / cfg->cal_cfg.conv_horizontal_stride + 1);
+		out_tensor->h = (uint16_t)((ext_fmap_h - dilated_kernal_len) / cfg->cal_cfg.conv_vertical_stride + 1);
+
+		// 融合2x2最大池化时输出池化后的特征图
+		if(cfg->fmap_cfg.en_fused_max_pool){
+			out_tensor->w /= 2;
+			out_tensor->h /= 2;
+		}
+		out_tensor->c = cfg->kernal_cfg.kernal_n;
+		out_tensor->data_byte_n =
+			(cfg->fmap_cfg.ofmap_data_type == CONV_O_1_BYTE) ? 1:
+			(cfg->fmap_cfg.ofmap_data_type == CONV_O_2_BYTE) ? 2:4;
+
+		// 融合残差相加时, 残差张量(输入张量B)须由之前的层生成或者是给出了基地址的网络输入, 且与输出张量的形状和元素字节数相同
+		if(cfg->bn_act_cfg.en_residual_add){
+			PandaAiRtTensor* res_tensor;
+
+			if(layer->in_b_tensor_id >= net->tensor_n || layer->in_b_tensor_id == layer->out_tensor_id){
+				return -1;
+			}
+
+			res_tensor = net->tensor_arr + layer->in_b_tensor_id;
+
+			if(res_tensor->producer == PANDA_AI_RT_NO_TENSOR){
+				if(res_tensor->baseaddr == NULL){
+					return -1;
+				}
+			}else if(res_tensor->producer >= layer_id){
+				return -1;
+			}
+
+			if(res_tensor->w != out_tensor->w || res_tensor->h != out_tensor->h || res_tensor->c != out_tensor->c ||
+				res_tensor->data_byte_n != out_tensor->data_byte_n){
+				return -2;
+			}
+		}
+	}else if((layer->type == PANDA_AI_LAYER_POOL || layer->type == PANDA_AI_LAYER_UPSAMPLE) &&
+		panda_ai_rt_is_pool_fmap_pitched((layer->type == PANDA_AI_LAYER_POOL) ? &layer->param.pool.fmap_cfg:&layer->param.ups.fmap_cfg)){
+		// 张量按紧密存储分配, 不支持输出/输入特征图跨距
+		return -2;
+	}else if(layer->type == PANDA_AI_LAYER_POOL){
+		PandaAiRtPoolParam* param = &layer->param.pool;
+		uint32_t ext_fmap_w =
+			((uint32_t)in_tensor->w) + ((uint32_t)param->fmap_cfg.external_padding_left) + ((uint32_t)param->fmap_cfg.external_padding_right);
+		uint32_t ext_fmap_h =
+			((uint32_t)in_tensor->h) + ((uint32_t)param->fmap_cfg.external_padding_top) + ((uint32_t)param->fmap_cfg.external_padding_bottom);
+
+		if(in_tensor->data_byte_n != ((param->cal_cfg.cal_fmt == POOL_INT8) ? 1:2) ||
+			param->cal_cfg.horizontal_stride == 0 || param->cal_cfg.vertical_stride == 0 ||
+			ext_fmap_w < param->cal_cfg.pool_window_w || ext_fmap_h < param->cal_cfg.pool_window_h ||
+			((ext_fmap_w - param->cal_cfg.pool_window_w) % param->cal_cfg.horizontal_stride) ||
+			((ext_fmap_h - param->cal_cfg.pool_window_h) % param->cal_cfg.vertical_stride)){
+			return -2;
+		}
+
+		param->fmap_cfg.ifmap_w = in_tensor->w;
+		param->fmap_cfg.ifmap_h = in_tensor->h;
+		param->fmap_cfg.ifmap_c = in_tensor->c;
+
+		out_tensor->w = (uint16_t)((ext_fmap_w - param->cal_cfg.pool_window_w) / param->cal_cfg.horizontal_stride + 1);
+		out_tensor->h = (uint16_t)((ext_fmap_h - param->cal_cfg.pool_window_h) / param->cal_cfg.vertical_stride + 1);
+		out_tensor->c = in_tensor->c;
+		out_tensor->data_byte_n =
+			(param->fmap_cfg.ofmap_data_type == POOL_O_1_BYTE) ? 1:
+			(param->fmap_cfg.ofmap_data_type == POOL_O_2_BYTE) ? 2:4;
+	}else if(layer->type == PANDA_AI_LAYER_UPSAMPLE){
+		PandaAiRtUpsParam* param = &layer->param.ups;
+
+		if(in_tensor->data_byte_n != ((param->cal_cfg.cal_fmt == POOL_INT8) ? 1:2) ||
+			param->cal_cfg.upsample_horizontal_n == 0 || param->cal_cfg.upsample_vertical_n == 0){
+			return -2;
+		}
+
+		param->fmap_cfg.ifmap_w = in_tensor->w;
+		param->fmap_cfg.ifmap_h = in_tensor->h;
+		param->fmap_cfg.ifmap_c = in_tensor->c;
+
+		out_tensor->w = (uint16_t)(
+			(((uint32_t)in_tensor->w) + ((uint32_t)param->fmap_cfg.external_padding_left) + ((uint32_t)param->fmap_cfg.external_padding_right)) *
+			param->cal_cfg.upsample_horizontal_n);
+		out_tensor->h = (uint16_t)(
+			(((uint32_t)in_tensor->h) + ((uint32_t)param->fmap_cfg.external_padding_top) + ((uint32_t)param->fmap_cfg.external_padding_bottom)) *
+			param->cal_cfg.upsample_vertical_n);
+		out_tensor->c = in_tensor->c;
+		out_tensor->data_byte_n =
+			(param->fmap_cfg.ofmap_data_type == POOL_O_1_BYTE) ? 1:
+			(param->fmap_cfg.ofmap_data_type == POOL_O_2_BYTE) ? 2:4;
+	}else{
+		PandaAiRtElmParam* param = &layer->param.elm;
+		uint8_t in_data_byte_n = panda_ai_rt_get_elm_data_byte_n((uint32_t)param->fu_cfg.in_data_fmt);
+
+		if(in_tensor->data_byte_n != in_data_byte_n){
+			return -2;
+		}
+
+		if(layer->in_b_tensor_id != PANDA_AI_RT_NO_TENSOR){
+			PandaAiRtTensor* in_b_tensor;
+
+			if(layer->in_b_tensor_id >= net->tensor_n){
+				return -1;
+			}
+
+			in_b_tensor = net->tensor_arr + layer->in_b_tensor_id;
+
+			if(in_b_tensor->producer == PANDA_AI_RT_NO_TENSOR){
+				if(in_b_tensor->baseaddr == NULL){
+					return -1;
+				}
+			}else if(in_b_tensor->producer >= layer_id){
+				return -1;
+			}
+
+			// 操作数A或B与操作数X逐元素对应
+			if(in_b_tensor->w != in_tensor->w || in_b_tensor->h != in_tensor->h || in_b_tensor->c != in_tensor->c ||
+				in_b_tensor->data_byte_n != in_data_byte_n){
+				return -2;
+			}
+		}
+
+		out_tensor->w = in_tensor->w;
+		out_tensor->h = in_tensor->h;
+		out_tensor->c = in_tensor->c;
+		out_tensor->data_byte_n = panda_ai_rt_get_elm_data_byte_n((uint32_t)param->fu_cfg.out_data_fmt);
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  规划中间张量存储区
+        张量的生存期从生成它的层开始, 到最后1个读取它的层结束(没有层读取的网络输出延续到最后1层),
+        由于不同引擎上的层可能不按层的顺序完成, 对于复用了之前张量空间的输出张量,
+        记录被复用的张量中最晚的读取层, 运行时须等到该层及其之前的所有层都完成后才能启动生成该输出张量的层
+@param  net 网络(句柄)
+@return 是否成功
+*************************/
+static int panda_ai_rt_plan_arena(PandaAiRtNet* net){
+	PandaAiArenaBuf* buf_arr = net->arena_buf_arr;
+
+	for(uint16_t i = 0;i < net->tensor_n;i++){
+		const PandaAiRtTensor* tensor = net->tensor_arr + i;
+
+		buf_arr[i].size = 0;
+		buf_arr[i].first_use = tensor->producer;
+		buf_arr[i].last_use = tensor->producer;
+
+		// 仅由运行时分配不由调用者给出基地址的中间张量
+		if(tensor->producer != PANDA_AI_RT_NO_TENSOR && tensor->baseaddr == NULL){
+			// 1字节张量(INT8)按通道对存储, 通道数为奇数时补1个0通道
+			uint64_t len = ((uint64_t)tensor->w) * ((uint64_t)tensor->h) *
+				((tensor->data_byte_n == 1) ? ((((uint64_t)tensor->c) + 1) & (~((uint64_t)1))):(((uint64_t)tensor->c) * tensor->data_byte_n));
+
+			if(len == 0 || len >= PANDA_AI_ARENA_UNPLACED){
+				return -1;
+			}
+
+			buf_arr[i].size = (uint32_t)len;
+		}
+	}
+
+	for(uint16_t i = 0;i < net->layer_n;i++){
+		const PandaAiRtLayer* layer = net->layer_arr + i;
+
+		uint16_t in_b_tensor_id = panda_ai_rt_get_in_b_tensor_id(layer);
+
+		buf_arr[layer->in_tensor_id].last_use = i;
+
+		if(in_b_tensor_id != PANDA_AI_RT_NO_TENSOR){
+			buf_arr[in_b_tensor_id].last_use = i;
+		}
+	}
+
+	// 没有层读取的张量(网络输出)延续到最后1层
+	for(uint16_t i = 0;i < net->tensor_n;i++){
+		if(buf_arr[i].size > 0 && buf_arr[i].last_use == buf_arr[i].first_use){
+			buf_arr[i].last_use = net->layer_n - 1;
+		}
+	}
+
+	if(panda_ai_arena_plan(buf_arr, net->tensor_n, PANDA_AI_RT_TENSOR_ALIGN, &net->arena_peak)){
+		return -1;
+	}
+
+	// 记录复用空间时须等待的层
+	for(uint16_t i = 0;i < net->layer_n;i++){
+		PandaAiRtLayer* layer = net->layer_arr + i;
+		const PandaAiArenaBuf* out_buf = buf_arr + layer->out_tensor_id;
+
+		if(out_buf->size == 0){
+			continue;
+		}
+
+		for(uint16_t j = 0;j < net->tensor_n;j++){
+			const PandaAiArenaBuf* buf = buf_arr + j;
+
+			if(buf != out_buf && buf->last_use < out_buf->first_use && panda_ai_arena_is_overlapped(buf, out_buf) &&
+				(layer->reuse_dep == PANDA_AI_RT_NO_TENSOR || buf->last_use > layer->reuse_dep)){
+				layer->reuse_dep = buf->last_use;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  判断引擎是否支持某层
+@param  engine 引擎(句柄)
+        layer 层(句柄)
+@return 是否支持
+*************************/
+static uint8_t panda_ai_rt_is_layer_supported(const PandaAiRtEngine* engine, const PandaAiRtLayer* layer){
+	switch(layer->type){
+	case PANDA_AI_LAYER_CONV:
+		// INT8时输出通道组(ATOMIC_K个通道)须与输入通道组(ATOMIC_C对通道)相同, 输出才能直接作为下一层的输入
+		return engine->conv != NULL &&
+			(layer->param.conv.cfg.cal_cfg.cal_fmt != CONV_INT8 ||
+				engine->conv->property.atomic_k == engine->conv->property.atomic_c * 2);
+	case PANDA_AI_LAYER_POOL:
+		return engine->pool != NULL &&
+			((layer->param.pool.mode == PROC_MODE_MAX) ? engine->pool->property.max_pool_supported:engine->pool->property.avg_pool_supported);
+	case PANDA_AI_LAYER_UPSAMPLE: return engine->pool != NULL && engine->pool->property.up_sample_supported;
+	case PANDA_AI_LAYER_ELM: return engine->elm != NULL;
+	}
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@private
+@brief  判断某层是否可以启动
+        输入张量须已生成, 且输出张量复用的空间不再被之前的层读取
+@param  net 网络(句柄)
+        layer 层(句柄)
+        done_prefix 从第0层起连续完成的层数
+@return 是否可以启动
+*************************/
+static uint8_t panda_ai_rt_is_layer_ready(const PandaAiRtNet* net, const PandaAiRtLayer* layer, uint16_t done_prefix){
+	uint16_t producer;
+	uint16_t in_b_tensor_id = panda_ai_rt_get_in_b_tensor_id(layer);
+
+	if(layer->reuse_dep != PANDA_AI_RT_NO_TENSOR && layer->reuse_dep >= done_prefix){
+		return 0;
+	}
+
+	producer = net->tensor_arr[layer->in_tensor_id].producer;
+
+	if(producer != PANDA_AI_RT_NO_TENSOR && net->layer_arr[producer].sts != PANDA_AI_LAYER_DONE){
+		return 0;
+	}
+
+	if(in_b_tensor_id != PANDA_AI_RT_NO_TENSOR){
+		producer = net->tensor_arr[in_b_tensor_id].producer;
+
+		if(producer != PANDA_AI_RT_NO_TENSOR && net->layer_arr[producer].sts != PANDA_AI_LAYER_DONE){
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/*************************
+@ctrl
+@private
+@brief  在引擎上启动1层
+        使能对应的处理单元, 配置后设置完成阈值并启动
+@param  net 网络(句柄)
+        engine_id 引擎号
+        layer_id 层号
+@return 是否成功
+*************************/
+static int panda_ai_rt_start_layer(PandaAiRtNet* net, uint8_t engine_id, uint16_t layer_id){
+	PandaAiRtEngine* engine = net->engine_arr + engine_id;
+	PandaAiRtLayer* layer = net->layer_arr + layer_id;
+	const PandaAiRtTensor* in_tensor = net->tensor_arr + layer->in_tensor_id;
+	const PandaAiRtTensor* out_tensor = net->tensor_arr + layer->out_tensor_id;
+
+	if(layer->type == PANDA_AI_LAYER_CONV){
+		AxiGnrConvHandler* handler = engine->conv;
+		AxiGnrConvCfg cfg = layer->param.conv.cfg;
+
+		cfg.ifmap_baseaddr = in_tensor->baseaddr;
+		cfg.ofmap_baseaddr = out_tensor->baseaddr;
+
+		if(cfg.bn_act_cfg.en_residual_add){
+			cfg.bn_act_cfg.residual_baseaddr = net->tensor_arr[layer->in_b_tensor_id].baseaddr;
+		}
+
+		if(layer->param.conv.plan_buffer){
+			AxiGnrConvBufPlan plan;
+
+			if(axi_generic_conv_plan_buffer(&handler->property, &cfg, &plan)){
+				return -1;
+			}
+		}
+
+		// 输出按核组内ATOMIC_K个通道划分子表面行, 每个子表面行的每行对应1个S2MM命令
+		uint32_t atomic_k = handler->property.atomic_k;
+		uint32_t set_w = (cfg.group_n > 1) ? (((uint32_t)cfg.kernal_cfg.kernal_n) / cfg.group_n):((uint32_t)cfg.max_wgtblk_w);
+
+		if(set_w == 0){
+			return -1;
+		}
+
+		layer->s2mm_cmd_n = (
+			(((uint32_t)cfg.kernal_cfg.kernal_n) / set_w) * ((set_w + atomic_k - 1) / atomic_k) +
+			((((uint32_t)cfg.kernal_cfg.kernal_n) % set_w + atomic_k - 1) / atomic_k)
+		) * out_tensor->h;
+
+		if(axi_generic_conv_enable(handler)){
+			return -2;
+		}
+
+		axi_generic_conv_clr_cmd_fns_n(handler, CONV_C_ALL);
+
+		if(axi_generic_conv_cfg(handler, &cfg)){
+			axi_generic_conv_disable(handler);
+
+			return -1;
+		}
+
+		if(layer->param.conv.bn_param_buf != NULL){
+			axi_generic_conv_wr_bn_param_mem(handler, layer->param.conv.bn_param_buf, (uint32_t)cfg.kernal_cfg.kernal_n);
+		}
+
+		if(axi_generic_conv_set_done_threshold(handler, layer->s2mm_cmd_n)){
+			axi_generic_conv_disable(handler);
+
+			return -1;
+		}
+
+		axi_generic_conv_enable_cal_sub_sys(handler);
+
+		if(handler->property.bn_supported){
+			axi_generic_conv_enable_bn_act_proc(handler);
+		}
+
+		if(axi_generic_conv_start(handler)){
+			axi_generic_conv_disable_cal_sub_sys(handler);
+			axi_generic_conv_disable_bn_act_proc(handler);
+			axi_generic_conv_disable(handler);
+
+			return -2;
+		}
+	}else if(layer->type == PANDA_AI_LAYER_POOL || layer->type == PANDA_AI_LAYER_UPSAMPLE){
+		AxiGnrPoolHandler* handler = engine->pool;
+		AxiGnrPoolFmapCfg fmap_cfg = (layer->type == PANDA_AI_LAYER_POOL) ? layer->param.pool.fmap_cfg:layer->param.ups.fmap_cfg;
+		uint32_t atomic_c = handler->property.atomic_c;
+
+		fmap_cfg.ifmap_baseaddr = in_tensor->baseaddr;
+		fmap_cfg.ofmap_baseaddr = out_tensor->baseaddr;
+
+		// 每个通道组的每行对应1个S2MM命令
+		layer->s2mm_cmd_n = ((((uint32_t)out_tensor->c) + atomic_c - 1) / atomic_c) * out_tensor->h;
+
+		if(axi_generic_pool_enable(handler)){
+			return -2;
+		}
+
+		axi_generic_pool_clr_cmd_fns_n(handler, POOL_C_ALL);
+
+		if(
+			(layer->type == PANDA_AI_LAYER_POOL) ?
+				axi_generic_pool_cfg_in_pool_mode(
+					handler, layer->param.pool.mode, &fmap_cfg, &layer->param.pool.buffer_cfg, &layer->param.pool.cal_cfg):
+				axi_generic_pool_cfg_in_up_sample_mode(
+					handler, &fmap_cfg, &layer->param.ups.buffer_cfg, &layer->param.ups.cal_cfg)
+		){
+			axi_generic_pool_disable(handler);
+
+			return -1;
+		}
+
+		if(axi_generic_pool_set_done_threshold(handler, layer->s2mm_cmd_n)){
+			axi_generic_pool_disable(handler);
+
+			return -1;
+		}
+
+		axi_generic_pool_enable_cal_sub_sys(handler);
+
+		if(axi_generic_pool_start(handler)){
+			axi_generic_pool_disable_cal_sub_sys(handler);
+			axi_generic_pool_disable(handler);
+
+			return -2;
+		}
+	}else{
+		AxiElmWiseProcHandler* handler = engine->elm;
+		AxiElmWiseProcBufCfg buf_cfg;
+		uint32_t item_n = ((uint32_t)in_tensor->w) * ((uint32_t)in_tensor->h) * ((uint32_t)in_tensor->c);
+		uint8_t use_op_a_or_b = layer->in_b_tensor_id != PANDA_AI_RT_NO_TENSOR;
+
+		buf_cfg.op_x_buf_baseaddr = in_tensor->baseaddr;
+		buf_cfg.op_a_b_buf_baseaddr = use_op_a_or_b ? net->tensor_arr[layer->in_b_tensor_id].baseaddr:NULL;
+		buf_cfg.res_buf_baseaddr = out_tensor->baseaddr;
+		buf_cfg.op_x_buf_len = item_n * in_tensor->data_byte_n;
+		buf_cfg.op_a_b_buf_len = use_op_a_or_b ? buf_cfg.op_x_buf_len:0;
+		buf_cfg.res_buf_len = item_n * out_tensor->data_byte_n;
+
+		// 整个结果缓存区对应1个S2MM命令
+		layer->s2mm_cmd_n = 1;
+
+		if(axi_element_wise_proc_enable(handler)){
+			return -2;
+		}
+
+		axi_element_wise_proc_clr_cmd_fns_n(handler, ELM_C_ALL);
+
+		if(axi_element_wise_proc_cfg(handler, &layer->param.elm.fu_cfg)){
+			axi_element_wise_proc_disable(handler);
+
+			return -1;
+		}
+
+		axi_element_wise_proc_enable_data_hub_and_proc_core(handler);
+
+		if(axi_element_wise_proc_set_done_threshold(handler, layer->s2mm_cmd_n) ||
+			axi_element_wise_proc_start(handler, &buf_cfg, use_op_a_or_b)){
+			axi_element_wise_proc_disable_data_hub_and_proc_core(handler);
+			axi_element_wise_proc_disable(handler);
+
+			return -2;
+		}
+	}
+
+	layer->sts = PANDA_AI_LAYER_RUNNING;
+	layer->engine_id = engine_id;
+	net->running_layer[engine_id] = layer_id;
+
+	return 0;
+}
+
+/*************************
+@sts
+@private
+@brief  判断引擎上运行的层是否完成
+        S2MM通道完成的命令数达到本层的命令数时认为完成
+@param  net 网络(句柄)
+        engine_id 引擎号
+        layer_id 层号
+@return 是否完成
+*************************/
+static uint8_t panda_ai_rt_is_layer_done(PandaAiRtNet* net, uint8_t engine_id, uint16_t layer_id){
+	PandaAiRtEngine* engine = net->engine_arr + engine_id;
+	PandaAiRtLayer* layer = net->layer_arr + layer_id;
+
+	switch(layer->type){
+	case PANDA_AI_LAYER_CONV:
+		return axi_generic_conv_get_cmd_fns_n(engine->conv, CONV_Q_CMD_FNS_N_S2MM) >= layer->s2mm_cmd_n;
+	case PANDA_AI_LAYER_POOL:
+	case PANDA_AI_LAYER_UPSAMPLE:
+		return axi_generic_pool_get_cmd_fns_n(engine->pool, POOL_Q_CMD_FNS_N_S2MM) >= layer->s2mm_cmd_n;
+	case PANDA_AI_LAYER_ELM:
+		return axi_element_wise_proc_get_cmd_fns_n(engine->elm, ELM_Q_CMD_FNS_N_S2MM) >= layer->s2mm_cmd_n;
+	}
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@private
+@brief  结束引擎上运行的层
+        清除完成中断等待标志, 除能处理单元, 使引擎可以运行下一层
+@param  net 网络(句柄)
+        engine_id 引擎号
+        layer_id 层号
+@return 是否成功
+*************************/
+static int panda_ai_rt_finish_layer(PandaAiRtNet* net, uint8_t engine_id, uint16_t layer_id){
+	PandaAiRtEngine* engine = net->engine_arr + engine_id;
+	PandaAiRtLayer* layer = net->layer_arr + layer_id;
+	int res;
+
+	if(layer->type == PANDA_AI_LAYER_CONV){
+		res = axi_generic_conv_wait_done(engine->conv);
+
+		axi_generic_conv_disable_cal_sub_sys(engine->conv);
+		axi_generic_conv_disable_bn_act_proc(engine->conv);
+		axi_generic_conv_clr_cmd_fns_n(engine->conv, CONV_C_ALL);
+		axi_generic_conv_disable(engine->conv);
+	}else if(layer->type == PANDA_AI_LAYER_POOL || layer->type == PANDA_AI_LAYER_UPSAMPLE){
+		res = axi_generic_pool_wait_done(engine->pool);
+
+		axi_generic_pool_disable_cal_sub_sys(engine->pool);
+		axi_generic_pool_clr_cmd_fns_n(engine->pool, POOL_C_ALL);
+		axi_generic_pool_disable(engine->pool);
+	}else{
+		res = axi_element_wise_proc_wait_done(engine->elm);
+
+		axi_element_wise_proc_disable_data_hub_and_proc_core(engine->elm);
+		axi_element_wise_proc_clr_cmd_fns_n(engine->elm, ELM_C_ALL);
+		axi_element_wise_proc_disable(engine->elm);
+	}
+
+	layer->sts = PANDA_AI_LAYER_DONE;
+	net->running_layer[engine_id] = PANDA_AI_RT_NO_TENSOR;
+
+	return res;
+}
+
+/*************************
+@cfg
+@private
+@brief  获取逐元素操作的数据字节数
+        输入/输出数据格式的编码相同: U8/S8为1字节, U16/S16/FP16为2字节, U32/S32/FP32为4字节
+@param  fmt 输入或输出数据格式
+@return 数据字节数
+*************************/
+static uint8_t panda_ai_rt_get_elm_data_byte_n(uint32_t fmt){
+	switch(fmt){
+	case ELM_INFMT_U8:
+	case ELM_INFMT_S8:
+		return 1;
+	case ELM_INFMT_U16:
+	case ELM_INFMT_S16:
+	case ELM_INFMT_FP16:
+		return 2;
+	}
+
+	return 4;
+}
+
+/*************************
+@cfg
+@private
+@brief  获取某层实际读取的输入张量B的张量号
+        逐元素操作时为操作数A或B, 卷积层使能融合残差相加时为残差张量
+@param  layer 层(句柄)
+@return 张量号(不读取输入张量B时为PANDA_AI_RT_NO_TENSOR)
+*************************/
+static uint16_t panda_ai_rt_get_in_b_tensor_id(const PandaAiRtLayer* layer){
+	if(layer->type == PANDA_AI_LAYER_ELM ||
+		(layer->type == PANDA_AI_LAYER_CONV && layer->param.conv.cfg.bn_act_cfg.en_residual_add)){
+		return layer->in_b_tensor_id;
+	}
+
+	return PANDA_AI_RT_NO_TENSOR;
+}
+
+/*************************
+@cfg
+@private
+@brief  判断池化/上采样层是否给出了特征图跨距
+@param  fmap_cfg 特征图参数(句柄)
+@return 是否给出了输出或输入特征图跨距
+*************************/
+static uint8_t panda_ai_rt_is_pool_fmap_pitched(const AxiGnrPoolFmapCfg* fmap_cfg){
+	return fmap_cfg->ofmap_chn_ofs || fmap_cfg->ofmap_row_pitch || fmap_cfg->ofmap_cgrp_pitch ||
+		fmap_cfg->ifmap_start_cgrp || fmap_cfg->ifmap_row_pitch || fmap_cfg->ifmap_cgrp_pitch;
+}
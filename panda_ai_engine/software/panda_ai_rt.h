@@ -0,0 +1,150 @@
+/************************************************************************************************************************
+大胖达AI引擎网络运行时(接口头文件)
+@brief  以层列表描述整个网络(卷积/池化/上采样/逐元素操作, 层之间以张量号相连),
+        编译时推导中间张量的形状, 并按生存期把中间张量放进同一个存储区(生存期不重叠的张量复用空间),
+        运行时按数据依赖把每层派发到对应的处理单元,
+        不同引擎上的相互独立的分支可同时执行
+        同一个引擎内的卷积、池化和逐元素操作处理单元共享DMA通道(卷积与池化还共享物理缓存), 同一时刻只能运行其中1个
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 按生存期规划中间张量存储区
+        2026.10.17 1.02 融合残差相加的残差张量以输入张量B给出
+        2026.10.17 1.03 张量按紧密存储, 层参数中的特征图跨距须为0
+        2026.10.17 1.04 1字节张量(INT8)按通道对存储
+************************************************************************************************************************/
+
+#include "panda_ai_arena.h"
+#include "../../axi_generic_conv/software/axi_generic_conv.h"
+#include "../../axi_generic_pool/software/axi_generic_pool.h"
+#include "../../axi_element_wise_proc/software/axi_element_wise_proc.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 最大的引擎个数
+#define PANDA_AI_RT_MAX_ENGINE_N 8
+// 表示无张量的张量号
+#define PANDA_AI_RT_NO_TENSOR 0xFFFF
+// 中间张量基地址的对齐字节数(不小于DMA数据流的最大位宽(256位)和DCache行大小)
+#define PANDA_AI_RT_TENSOR_ALIGN 64
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 枚举类型: 层类型
+typedef enum{
+	PANDA_AI_LAYER_CONV = 0, // 卷积
+	PANDA_AI_LAYER_POOL = 1, // 池化(最大/平均)
+	PANDA_AI_LAYER_UPSAMPLE = 2, // 上采样
+	PANDA_AI_LAYER_ELM = 3 // 逐元素操作
+}PandaAiRtLayerType;
+
+// 枚举类型: 层运行状态
+typedef enum{
+	PANDA_AI_LAYER_WAITING = 0, // 等待输入就绪
+	PANDA_AI_LAYER_RUNNING = 1, // 正在运行
+	PANDA_AI_LAYER_DONE = 2 // 已完成
+}PandaAiRtLayerSts;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 函数指针类型: 等待任意1层完成时的回调函数
+typedef void (*PandaAiRtWaitHook)(void* arg);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 引擎(同一时刻只能运行其中1个处理单元)
+typedef struct{
+	AxiGnrConvHandler* conv; // 通用卷积处理单元(不存在时为NULL)
+	AxiGnrPoolHandler* pool; // 通用池化处理单元(不存在时为NULL)
+	AxiElmWiseProcHandler* elm; // 通用逐元素操作处理单元(不存在时为NULL)
+}PandaAiRtEngine;
+
+// 结构体: 张量(按加速器的通道组存储格式存放)
+typedef struct{
+	uint16_t w; // 宽度
+	uint16_t h; // 高度
+	uint16_t c; // 通道数
+	uint8_t data_byte_n; // 每个元素的字节数(为1时按通道对存储, 每对通道占16位)
+	uint8_t* baseaddr; // 紧密存储的基地址(网络输入/输出或需要固定位置的张量由调用者给出, 为NULL时由运行时分配)
+
+	uint16_t producer; // 生成本张量的层号(网络输入为PANDA_AI_RT_NO_TENSOR, 由运行时填写)
+	uint8_t in_arena; // 是否位于中间张量存储区(由运行时填写)
+}PandaAiRtTensor;
+
+// 结构体: 卷积层参数
+typedef struct{
+	AxiGnrConvCfg cfg; // 配置参数(特征图尺寸、通道数、特征图基地址和残差特征图基地址由运行时填写, 特征图跨距须为0)
+	BNParam* bn_param_buf; // BN参数(不使用BN单元时为NULL)
+	uint8_t plan_buffer; // 是否由运行时规划缓存划分
+}PandaAiRtConvParam;
+
+// 结构体: 池化层参数
+typedef struct{
+	AxiGnrPoolProcMode mode; // 处理模式(最大池化/平均池化)
+	AxiGnrPoolFmapCfg fmap_cfg; // 特征图参数(仅使用外填充数和输出特征图数据大小类型, 特征图跨距须为0)
+	AxiGnrPoolBufferCfg buffer_cfg; // 缓存参数
+	AxiGnrPoolPoolModeCfg cal_cfg; // 池化参数
+}PandaAiRtPoolParam;
+
+// 结构体: 上采样层参数
+typedef struct{
+	AxiGnrPoolFmapCfg fmap_cfg; // 特征图参数(仅使用外填充数和输出特征图数据大小类型, 特征图跨距须为0)
+	AxiGnrPoolBufferCfg buffer_cfg; // 缓存参数
+	AxiGnrPoolUpsModeCfg cal_cfg; // 上采样参数
+}PandaAiRtUpsParam;
+
+// 结构体: 逐元素操作层参数
+typedef struct{
+	AxiElmWiseProcFuCfg fu_cfg; // 功能单元配置参数(存在输入张量B时, 其作为非常量的操作数A或B)
+}PandaAiRtElmParam;
+
+// 结构体: 层
+typedef struct{
+	PandaAiRtLayerType type; // 层类型
+	uint16_t in_tensor_id; // 输入张量号(逐元素操作时为操作数X)
+	uint16_t in_b_tensor_id; // 输入张量B的张量号(逐元素操作时为操作数A或B, 卷积层使能融合残差相加时为残差张量, 不存在时为PANDA_AI_RT_NO_TENSOR)
+	uint16_t out_tensor_id; // 输出张量号
+
+	union{
+		PandaAiRtConvParam conv;
+		PandaAiRtPoolParam pool;
+		PandaAiRtUpsParam ups;
+		PandaAiRtElmParam elm;
+	}param; // 层参数
+
+	// 由运行时填写
+	uint32_t s2mm_cmd_n; // S2MM通道命令数
+	uint16_t reuse_dep; // 本层的输出张量复用了之前张量的空间时, 须先完成的最后1层的层号(不存在时为PANDA_AI_RT_NO_TENSOR)
+	PandaAiRtLayerSts sts; // 运行状态
+	uint8_t engine_id; // 执行本层的引擎号
+}PandaAiRtLayer;
+
+// 结构体: 网络
+typedef struct{
+	PandaAiRtEngine engine_arr[PANDA_AI_RT_MAX_ENGINE_N]; // 引擎
+	uint8_t engine_n; // 引擎个数
+
+	PandaAiRtTensor* tensor_arr; // 张量
+	uint16_t tensor_n; // 张量个数
+	PandaAiRtLayer* layer_arr; // 层(须按拓扑顺序给出, 即每层的输入张量由其之前的层生成或者是网络输入)
+	uint16_t layer_n; // 层数
+
+	PandaAiArenaBuf* arena_buf_arr; // 每个张量的存储区规划结果(长度为张量个数)
+	uint8_t* arena; // 中间张量存储区
+	uint32_t arena_len; // 中间张量存储区的字节数
+	uint32_t arena_peak; // 中间张量存储区的峰值大小
+
+	PandaAiRtWaitHook wait_hook; // 等待任意1层完成时的回调函数
+	void* wait_hook_arg; // 等待任意1层完成时的回调函数的参数
+
+	uint16_t running_layer[PANDA_AI_RT_MAX_ENGINE_N]; // 每个引擎正在运行的层号(空闲时为PANDA_AI_RT_NO_TENSOR)
+}PandaAiRtNet;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int panda_ai_rt_init(PandaAiRtNet* net, const PandaAiRtEngine* engine_arr, uint8_t engine_n,
+	PandaAiRtTensor* tensor_arr, uint16_t tensor_n, PandaAiRtLayer* layer_arr, uint16_t layer_n); // 初始化网络
+void panda_ai_rt_set_wait_hook(PandaAiRtNet* net, PandaAiRtWaitHook hook, void* arg); // 设置等待任意1层完成时的回调函数
+int panda_ai_rt_compile(PandaAiRtNet* net, PandaAiArenaBuf* arena_buf_arr,
+	uint8_t* arena, uint32_t arena_len); // 编译网络(推导张量形状, 规划并分配中间张量)
+int panda_ai_rt_run(PandaAiRtNet* net); // 运行网络
@@ -0,0 +1,293 @@
+/************************************************************************************************************************
+大胖达AI引擎事件跟踪单元驱动
+@brief  提供了事件跟踪单元的初始化、环形缓存区配置、使能/除能、事件类型掩码、冲刷与状态获取等API
+        事件由硬件经独立的DMA(S2MM)通道写入环形缓存区, 写指针和回绕次数在每次写入完成后更新,
+        读取环形缓存区前须先冲刷事件缓存, 并在有DCache时使对应区域无效
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 通过可替换的寄存器访问后端读写寄存器区, 环形缓存区地址经总线地址转换
+************************************************************************************************************************/
+
+#include "panda_ai_trace.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 事件跟踪单元的加速器类型编码
+#define PANDA_AI_TRACE_ACC_TYPE 0b110100001010001100111010100100
+
+// 各寄存器域的偏移地址
+#define REG_REGION_PROP_OFS 0x0000
+#define REG_REGION_CTRL_OFS 0x0010
+#define REG_REGION_STS_OFS 0x0020
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@private
+@brief  读寄存器
+@param  handler 事件跟踪单元(加速器句柄)
+        reg 寄存器地址(由寄存器域指针得到)
+@return 读到的值
+*************************/
+static inline uint32_t panda_ai_trace_rd_reg(const PandaAiTraceHandler* handler, const volatile uint32_t* reg){
+#ifdef PANDA_AI_TRACE_MMIO_CB
+	return handler->mmio.rd(handler->mmio.mmio_arg, (uintptr_t)reg);
+#else
+	(void)handler;
+
+	return *reg;
+#endif
+}
+
+/*************************
+@private
+@brief  写寄存器
+@param  handler 事件跟踪单元(加速器句柄)
+        reg 寄存器地址(由寄存器域指针得到)
+        data 待写的值
+@return none
+*************************/
+static inline void panda_ai_trace_wr_reg(const PandaAiTraceHandler* handler, volatile uint32_t* reg, uint32_t data){
+#ifdef PANDA_AI_TRACE_MMIO_CB
+	handler->mmio.wr(handler->mmio.mmio_arg, (uintptr_t)reg, data);
+#else
+	(void)handler;
+
+	*reg = data;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@init
+@public
+@brief  初始化事件跟踪单元(以指针直接访问寄存器区)
+@param  handler 事件跟踪单元(加速器句柄)
+        baseaddr 加速器基地址
+@return 是否成功
+*************************/
+int panda_ai_trace_init(PandaAiTraceHandler* handler, uint32_t baseaddr){
+	PandaAiTraceMmio mmio;
+
+	memset((void*)&mmio, 0, sizeof(mmio));
+
+	mmio.reg_base = (uintptr_t)baseaddr;
+
+	return panda_ai_trace_init_mmio(handler, &mmio);
+}
+
+/*************************
+@init
+@public
+@brief  初始化事件跟踪单元(指定寄存器访问后端)
+@param  handler 事件跟踪单元(加速器句柄)
+        mmio 寄存器访问后端
+@return 是否成功
+*************************/
+int panda_ai_trace_init_mmio(PandaAiTraceHandler* handler, const PandaAiTraceMmio* mmio){
+#ifdef PANDA_AI_TRACE_MMIO_CB
+	if(mmio->rd == NULL || mmio->wr == NULL){
+		return -1;
+	}
+#endif
+
+	handler->mmio = *mmio;
+
+	handler->reg_region_prop = (PandaAiTraceRegRgnProp*)(mmio->reg_base + REG_REGION_PROP_OFS);
+	handler->reg_region_ctrl = (PandaAiTraceRegRgnCtrl*)(mmio->reg_base + REG_REGION_CTRL_OFS);
+	handler->reg_region_sts = (PandaAiTraceRegRgnSts*)(mmio->reg_base + REG_REGION_STS_OFS);
+
+	if((panda_ai_trace_rd_reg(handler, &handler->reg_region_prop->acc_name) & 0x3FFFFFFF) != PANDA_AI_TRACE_ACC_TYPE){
+		return -1;
+	}
+
+	uint32_t version_encoded = panda_ai_trace_rd_reg(handler, &handler->reg_region_prop->version);
+	handler->property.version[8] = '\0';
+	for(int i = 0;i < 8;i++){
+		handler->property.version[i] = '0' + (version_encoded & 0x0000000F);
+		version_encoded >>= 4;
+	}
+
+	uint32_t accelerator_type_encoded = panda_ai_trace_rd_reg(handler, &handler->reg_region_prop->acc_name);
+	handler->property.accelerator_type[6] = '\0';
+	for(int i = 0;i < 6;i++){
+		uint8_t now_c = (uint8_t)(accelerator_type_encoded & 0x0000001F);
+
+		handler->property.accelerator_type[i] = (now_c == 26) ? '\0':('a' + now_c);
+		accelerator_type_encoded >>= 5;
+	}
+
+	handler->property.accelerator_id = (uint8_t)(panda_ai_trace_rd_reg(handler, &handler->reg_region_prop->acc_name) >> 30);
+
+	handler->property.evt_fifo_depth = (uint16_t)(panda_ai_trace_rd_reg(handler, &handler->reg_region_prop->info0) & 0x0000FFFF);
+	handler->property.burst_evt_n = (uint8_t)((panda_ai_trace_rd_reg(handler, &handler->reg_region_prop->info0) >> 16) & 0x000000FF);
+	handler->property.evt_type_n = (uint8_t)((panda_ai_trace_rd_reg(handler, &handler->reg_region_prop->info0) >> 24) & 0x0000000F);
+
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, 0x00000000);
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_ctrl->ctrl1, (1 << PANDA_AI_TRACE_EVT_TYPE_N) - 1);
+
+	handler->ring = NULL;
+	handler->ring_len = 0;
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  把主机指针转换为加速器DMA使用的总线地址
+@param  handler 事件跟踪单元(加速器句柄)
+        ptr 主机指针
+@return 总线地址
+*************************/
+uint32_t panda_ai_trace_bus_addr(PandaAiTraceHandler* handler, const void* ptr){
+	if(handler->mmio.bus_addr == NULL){
+		return (uint32_t)((uintptr_t)ptr);
+	}else{
+		return handler->mmio.bus_addr(handler->mmio.bus_addr_arg, ptr);
+	}
+}
+
+/*************************
+@cfg
+@public
+@brief  设置环形缓存区
+        写指针和回绕次数被清零, 须在除能事件记录并冲刷事件缓存后调用
+@param  handler 事件跟踪单元(加速器句柄)
+        ring 环形缓存区(须8字节对齐)
+        ring_len 环形缓存区的字节数(须为8的倍数)
+@return 是否成功
+*************************/
+int panda_ai_trace_set_ring(PandaAiTraceHandler* handler, uint8_t* ring, uint32_t ring_len){
+	if(ring == NULL || ring_len == 0 || (((uintptr_t)ring) % PANDA_AI_TRACE_EVT_BYTES) || (ring_len % PANDA_AI_TRACE_EVT_BYTES)){
+		return -1;
+	}
+
+	if(panda_ai_trace_rd_reg(handler, &handler->reg_region_ctrl->ctrl0) & 0x00000003){
+		return -1;
+	}
+
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_ctrl->ctrl2, panda_ai_trace_bus_addr(handler, ring));
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_ctrl->ctrl3, ring_len);
+
+	handler->ring = ring;
+	handler->ring_len = ring_len;
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  使能事件记录
+@param  handler 事件跟踪单元(加速器句柄)
+@return 是否成功
+*************************/
+int panda_ai_trace_enable(PandaAiTraceHandler* handler){
+	if(handler->ring_len == 0){
+		return -1;
+	}
+
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, (1 << 0));
+
+	return 0;
+}
+
+/*************************
+@ctrl
+@public
+@brief  除能事件记录
+@param  handler 事件跟踪单元(加速器句柄)
+@return none
+*************************/
+void panda_ai_trace_disable(PandaAiTraceHandler* handler){
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, 0x00000000);
+}
+
+/*************************
+@cfg
+@public
+@brief  设置事件类型掩码
+@param  handler 事件跟踪单元(加速器句柄)
+        evt_mask 事件类型掩码(第i位为1时记录类型为i的事件, 见PandaAiTraceEvtType)
+@return none
+*************************/
+void panda_ai_trace_set_evt_mask(PandaAiTraceHandler* handler, uint32_t evt_mask){
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_ctrl->ctrl1, evt_mask & ((1 << PANDA_AI_TRACE_EVT_TYPE_N) - 1));
+}
+
+/*************************
+@ctrl
+@public
+@brief  冲刷事件缓存并等待写出完成
+        不改变事件记录的使能状态
+@param  handler 事件跟踪单元(加速器句柄)
+@return 是否成功
+*************************/
+int panda_ai_trace_flush(PandaAiTraceHandler* handler){
+	if(handler->ring_len == 0){
+		return -1;
+	}
+
+	uint32_t pre_ctrl0 = panda_ai_trace_rd_reg(handler, &handler->reg_region_ctrl->ctrl0);
+
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_ctrl->ctrl0, (pre_ctrl0 & (1 << 0)) | (1 << 1));
+
+	while(panda_ai_trace_rd_reg(handler, &handler->reg_region_ctrl->ctrl0) & (1 << 1));
+
+	return 0;
+}
+
+/*************************
+@sts
+@public
+@brief  获取事件跟踪状态
+        回绕次数为0时, 有效事件位于[0, wptr); 否则最旧的事件位于wptr处, 最新的事件位于wptr之前
+@param  handler 事件跟踪单元(加速器句柄)
+        sts 事件跟踪状态(指针)
+@return none
+*************************/
+void panda_ai_trace_get_sts(PandaAiTraceHandler* handler, PandaAiTraceSts* sts){
+	uint32_t lap_n;
+
+	// 写指针与回绕次数分别读取, 读到的回绕次数变化时重新读取
+	do{
+		lap_n = panda_ai_trace_rd_reg(handler, &handler->reg_region_sts->sts1);
+		sts->wptr = panda_ai_trace_rd_reg(handler, &handler->reg_region_sts->sts0);
+	}while(panda_ai_trace_rd_reg(handler, &handler->reg_region_sts->sts1) != lap_n);
+
+	sts->lap_n = lap_n;
+	sts->drop_n = panda_ai_trace_rd_reg(handler, &handler->reg_region_sts->sts2);
+}
+
+/*************************
+@ctrl
+@public
+@brief  清除丢弃的事件数
+@param  handler 事件跟踪单元(加速器句柄)
+@return none
+*************************/
+void panda_ai_trace_clr_drop_n(PandaAiTraceHandler* handler){
+	panda_ai_trace_wr_reg(handler, &handler->reg_region_sts->sts2, 0x00000000);
+}
+
+/*************************
+@sts
+@public
+@brief  获取当前时间戳
+@param  handler 事件跟踪单元(加速器句柄)
+@return 当前时间戳(40位, 主时钟周期数)
+*************************/
+uint64_t panda_ai_trace_get_timestamp(PandaAiTraceHandler* handler){
+	uint32_t ts_hi;
+	uint32_t ts_lo;
+
+	do{
+		ts_hi = panda_ai_trace_rd_reg(handler, &handler->reg_region_sts->sts5);
+		ts_lo = panda_ai_trace_rd_reg(handler, &handler->reg_region_sts->sts4);
+	}while(panda_ai_trace_rd_reg(handler, &handler->reg_region_sts->sts5) != ts_hi);
+
+	return (((uint64_t)(ts_hi & 0x000000FF)) << 32) | ts_lo;
+}
@@ -0,0 +1,151 @@
+/************************************************************************************************************************
+大胖达AI引擎事件跟踪单元驱动(接口头文件)
+@brief  提供了事件跟踪单元的初始化、环形缓存区配置、使能/除能、事件类型掩码、冲刷与状态获取等API,
+        以及事件格式的解析宏(供主机端解码工具共用)
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 增加可替换的寄存器访问后端(直接访问/Linux UIO映射/回调函数)和总线地址转换
+************************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 每个事件的字节数
+#define PANDA_AI_TRACE_EVT_BYTES 8
+// 时间戳的位数
+#define PANDA_AI_TRACE_TS_WIDTH 40
+
+// 事件格式: {事件类型(4bit), 事件参数(20bit), 时间戳(40bit)}
+#define PANDA_AI_TRACE_EVT_TS(evt) ((uint64_t)(evt) & 0x000000FFFFFFFFFFULL)
+#define PANDA_AI_TRACE_EVT_ARG(evt) ((uint32_t)(((uint64_t)(evt) >> 40) & 0x000FFFFF))
+#define PANDA_AI_TRACE_EVT_TYPE(evt) ((uint8_t)(((uint64_t)(evt) >> 60) & 0x0F))
+// 层开始/结束事件的参数: {层号(18bit), 处理单元(2bit)}
+#define PANDA_AI_TRACE_LAYER_ID(arg) ((uint32_t)(arg) >> 2)
+#define PANDA_AI_TRACE_LAYER_UNIT(arg) ((uint8_t)((arg) & 0x03))
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 枚举类型: 事件类型
+typedef enum{
+	PANDA_AI_TRACE_LAYER_END = 0, // 层结束
+	PANDA_AI_TRACE_LAYER_START = 1, // 层开始
+	PANDA_AI_TRACE_KERNAL_SET_START = 2, // 卷积核组开始
+	PANDA_AI_TRACE_FMAP_ROW_LOAD = 3, // 特征图表面行加载(发送命令)
+	PANDA_AI_TRACE_FMAP_ROW_LOAD_DONE = 4, // 特征图表面行加载完成
+	PANDA_AI_TRACE_FMAP_ROW_RPLC = 5, // 特征图表面行置换
+	PANDA_AI_TRACE_KERNAL_CGRP_LOAD = 6, // 权重通道组加载(发送命令)
+	PANDA_AI_TRACE_KERNAL_CGRP_LOAD_DONE = 7, // 权重通道组加载完成
+	PANDA_AI_TRACE_FNL_RES_ROW_WR = 8, // 最终结果行写出(发送命令)
+	PANDA_AI_TRACE_FNL_RES_ROW_WR_DONE = 9, // 最终结果行写出完成
+	PANDA_AI_TRACE_EVT_TYPE_N = 10 // 事件类型数
+}PandaAiTraceEvtType;
+
+// 枚举类型: 层开始/结束事件中的处理单元
+typedef enum{
+	PANDA_AI_TRACE_UNIT_CONV = 0, // 通用卷积处理单元
+	PANDA_AI_TRACE_UNIT_POOL = 1, // 通用池化处理单元
+	PANDA_AI_TRACE_UNIT_ELM = 2 // 逐元素操作单元
+}PandaAiTraceUnit;
+
+// 寄存器访问后端
+//     默认以指针直接访问寄存器区(裸机下为物理地址, Linux下为mmap映射/dev/uioN得到的虚拟地址), 访问函数被内联为单条load/store指令
+//     编译时定义PANDA_AI_TRACE_MMIO_CB则通过回调函数访问(用于仿真器/模拟器), 此时基地址只用于区分所访问的寄存器
+// 函数指针类型: 读1个字(addr为基地址 + 偏移地址)
+typedef uint32_t (*PandaAiTraceMmioRd)(void* arg, uintptr_t addr);
+// 函数指针类型: 写1个字(addr为基地址 + 偏移地址)
+typedef void (*PandaAiTraceMmioWr)(void* arg, uintptr_t addr, uint32_t data);
+// 函数指针类型: 把主机指针转换为加速器DMA使用的总线地址
+typedef uint32_t (*PandaAiTraceBusAddr)(void* arg, const void* ptr);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 加速器属性
+typedef struct{
+	char version[9]; // 版本号
+	char accelerator_type[7]; // 加速器类型
+	uint8_t accelerator_id; // 加速器ID
+
+	uint16_t evt_fifo_depth; // 事件缓存深度
+	uint8_t burst_evt_n; // 每次写入的最大事件数
+	uint8_t evt_type_n; // 事件类型数
+}PandaAiTraceProp;
+
+// 结构体: 寄存器域(属性)
+typedef struct{
+	uint32_t version;
+	uint32_t acc_name;
+	uint32_t info0;
+	uint32_t info1;
+}PandaAiTraceRegRgnProp;
+
+// 结构体: 寄存器域(控制)
+typedef struct{
+	uint32_t ctrl0;
+	uint32_t ctrl1;
+	uint32_t ctrl2;
+	uint32_t ctrl3;
+}PandaAiTraceRegRgnCtrl;
+
+// 结构体: 寄存器域(状态)
+typedef struct{
+	uint32_t sts0;
+	uint32_t sts1;
+	uint32_t sts2;
+	uint32_t sts3;
+	uint32_t sts4;
+	uint32_t sts5;
+}PandaAiTraceRegRgnSts;
+
+// 结构体: 事件跟踪状态
+typedef struct{
+	uint32_t wptr; // 写指针(下1个事件在环形缓存区中的字节偏移)
+	uint32_t lap_n; // 回绕次数
+	uint32_t drop_n; // 丢弃的事件数
+}PandaAiTraceSts;
+
+// 结构体: 寄存器访问后端
+typedef struct{
+	uintptr_t reg_base; // 寄存器区基地址
+
+	PandaAiTraceMmioRd rd; // 读回调函数(仅在定义PANDA_AI_TRACE_MMIO_CB时使用)
+	PandaAiTraceMmioWr wr; // 写回调函数(仅在定义PANDA_AI_TRACE_MMIO_CB时使用)
+	void* mmio_arg; // 读写回调函数的参数
+
+	PandaAiTraceBusAddr bus_addr; // 总线地址转换函数(为NULL时直接取指针的低32位)
+	void* bus_addr_arg; // 总线地址转换函数的参数
+}PandaAiTraceMmio;
+
+// 结构体: 事件跟踪单元
+typedef struct{
+	PandaAiTraceMmio mmio; // 寄存器访问后端
+
+	// 寄存器域
+	PandaAiTraceRegRgnProp* reg_region_prop; // 寄存器域(属性)
+	PandaAiTraceRegRgnCtrl* reg_region_ctrl; // 寄存器域(控制)
+	PandaAiTraceRegRgnSts* reg_region_sts; // 寄存器域(状态)
+
+	PandaAiTraceProp property; // 加速器属性
+
+	uint8_t* ring; // 环形缓存区
+	uint32_t ring_len; // 环形缓存区的字节数
+}PandaAiTraceHandler;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int panda_ai_trace_init(PandaAiTraceHandler* handler, uint32_t baseaddr); // 初始化事件跟踪单元
+int panda_ai_trace_init_mmio(PandaAiTraceHandler* handler, const PandaAiTraceMmio* mmio); // 初始化事件跟踪单元(指定寄存器访问后端)
+uint32_t panda_ai_trace_bus_addr(PandaAiTraceHandler* handler, const void* ptr); // 把主机指针转换为总线地址
+
+int panda_ai_trace_set_ring(PandaAiTraceHandler* handler, uint8_t* ring, uint32_t ring_len); // 设置环形缓存区
+int panda_ai_trace_enable(PandaAiTraceHandler* handler); // 使能事件记录
+void panda_ai_trace_disable(PandaAiTraceHandler* handler); // 除能事件记录
+void panda_ai_trace_set_evt_mask(PandaAiTraceHandler* handler, uint32_t evt_mask); // 设置事件类型掩码
+int panda_ai_trace_flush(PandaAiTraceHandler* handler); // 冲刷事件缓存并等待写出完成
+
+void panda_ai_trace_get_sts(PandaAiTraceHandler* handler, PandaAiTraceSts* sts); // 获取事件跟踪状态
+void panda_ai_trace_clr_drop_n(PandaAiTraceHandler* handler); // 清除丢弃的事件数
+uint64_t panda_ai_trace_get_timestamp(PandaAiTraceHandler* handler); // 获取当前时间戳
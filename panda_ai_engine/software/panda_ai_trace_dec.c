@@ -0,0 +1,254 @@
+/************************************************************************************************************************
+大胖达AI引擎事件跟踪解码
+@brief  在主机上把事件跟踪单元写出的环形缓存区解码为Chrome跟踪事件格式(JSON)
+        40位时间戳按相邻事件的有符号差值展开为64位, 同1个周期的多种事件在硬件中按类型编码依次写出,
+        因此展开后再按时间戳稳定排序
+        层 -> 线程0上的B/E事件; 卷积核组 -> 线程1上的X事件(持续到下1个核组开始或层结束);
+        特征图表面行置换 -> 线程2上的瞬时事件;
+        特征图表面行加载、权重通道组加载、最终结果行写出 -> 异步事件(发送命令与完成按顺序配对)
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include "panda_ai_trace_dec.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 时间戳掩码
+#define PANDA_AI_TRACE_TS_MASK ((((uint64_t)1) << PANDA_AI_TRACE_TS_WIDTH) - 1)
+
+// 结构体: 异步事件配对状态
+typedef struct{
+	const char* name; // 事件名称
+	uint8_t start_type; // 开始事件类型
+	uint8_t done_type; // 完成事件类型
+	uint32_t start_n; // 已开始的事件数
+	uint32_t done_n; // 已完成的事件数
+}PandaAiTraceDecAsync;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int panda_ai_trace_dec_cmp_evt(const void* a, const void* b); // 比较2个事件的先后
+static void panda_ai_trace_dec_print_sep(FILE* fp, uint8_t* is_first); // 输出事件之间的分隔符
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 层开始/结束事件中处理单元的名称
+static const char* panda_ai_trace_dec_unit_name[4] = {"conv", "pool", "elm", "unknown"};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  从环形缓存区中按时间顺序取出事件
+        回绕次数为0时, 有效事件位于[0, wptr); 否则整个环形缓存区都有效, 最旧的事件位于wptr处
+@param  ring 环形缓存区(事件按小端格式存储)
+        ring_len 环形缓存区的字节数
+        wptr 写指针
+        lap_n 回绕次数
+        evt_arr 已解码的事件数组(长度须>=ring_len/8)
+        evt_n 已解码的事件数(指针)
+@return 是否成功
+*************************/
+int panda_ai_trace_dec_unpack(const uint8_t* ring, uint32_t ring_len, uint32_t wptr, uint32_t lap_n,
+	PandaAiTraceDecEvt* evt_arr, uint32_t* evt_n){
+	if(ring_len == 0 || (ring_len % PANDA_AI_TRACE_EVT_BYTES) || (wptr % PANDA_AI_TRACE_EVT_BYTES) || wptr >= ring_len){
+		return -1;
+	}
+
+	uint32_t ring_evt_n = ring_len / PANDA_AI_TRACE_EVT_BYTES;
+	uint32_t first = (lap_n == 0) ? 0:(wptr / PANDA_AI_TRACE_EVT_BYTES);
+	uint32_t n = (lap_n == 0) ? (wptr / PANDA_AI_TRACE_EVT_BYTES):ring_evt_n;
+
+	uint64_t pre_ts_raw = 0;
+	uint64_t ts = 0;
+
+	for(uint32_t i = 0;i < n;i++){
+		const uint8_t* p = ring + ((first + i) % ring_evt_n) * PANDA_AI_TRACE_EVT_BYTES;
+		uint64_t evt = 0;
+
+		for(int j = PANDA_AI_TRACE_EVT_BYTES - 1;j >= 0;j--){
+			evt = (evt << 8) | p[j];
+		}
+
+		uint64_t ts_raw = PANDA_AI_TRACE_EVT_TS(evt);
+
+		if(i == 0){
+			ts = ts_raw;
+		}else{
+			// 相邻事件的时间戳之差按40位有符号数解释
+			uint64_t diff = (ts_raw - pre_ts_raw) & PANDA_AI_TRACE_TS_MASK;
+
+			if(diff & (((uint64_t)1) << (PANDA_AI_TRACE_TS_WIDTH - 1))){
+				ts -= ((~diff) & PANDA_AI_TRACE_TS_MASK) + 1;
+			}else{
+				ts += diff;
+			}
+		}
+
+		pre_ts_raw = ts_raw;
+
+		evt_arr[i].ts = ts;
+		evt_arr[i].arg = PANDA_AI_TRACE_EVT_ARG(evt);
+		evt_arr[i].type = PANDA_AI_TRACE_EVT_TYPE(evt);
+		evt_arr[i].seq = i;
+	}
+
+	qsort(evt_arr, n, sizeof(PandaAiTraceDecEvt), panda_ai_trace_dec_cmp_evt);
+
+	*evt_n = n;
+
+	return 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  把事件输出为Chrome跟踪事件格式
+        时间单位为us, 以第1个事件为时间起点, 没有与之配对的开始事件的结束/完成事件(开始事件已被覆盖)被忽略
+@param  evt_arr 已按时间顺序排列的事件数组
+        evt_n 事件数
+        clk_mhz 主时钟频率(MHz)
+        fp 输出文件
+@return 是否成功
+*************************/
+int panda_ai_trace_dec_to_chrome_json(const PandaAiTraceDecEvt* evt_arr, uint32_t evt_n, double clk_mhz, FILE* fp){
+	if(clk_mhz <= 0.0 || fp == NULL){
+		return -1;
+	}
+
+	PandaAiTraceDecAsync async_arr[3] = {
+		{"fmap_row_load", PANDA_AI_TRACE_FMAP_ROW_LOAD, PANDA_AI_TRACE_FMAP_ROW_LOAD_DONE, 0, 0},
+		{"kernal_cgrp_load", PANDA_AI_TRACE_KERNAL_CGRP_LOAD, PANDA_AI_TRACE_KERNAL_CGRP_LOAD_DONE, 0, 0},
+		{"fnl_res_row_wr", PANDA_AI_TRACE_FNL_RES_ROW_WR, PANDA_AI_TRACE_FNL_RES_ROW_WR_DONE, 0, 0}
+	};
+
+	uint64_t ts_origin = (evt_n > 0) ? evt_arr[0].ts:0;
+	uint8_t is_first = 1;
+	uint8_t layer_open = 0;
+	uint8_t kernal_set_open = 0;
+	uint32_t kernal_set_arg = 0;
+	double kernal_set_ts = 0.0;
+
+	fprintf(fp, "{\"traceEvents\":[\n");
+
+	panda_ai_trace_dec_print_sep(fp, &is_first);
+	fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"panda_ai_engine\"}}");
+	panda_ai_trace_dec_print_sep(fp, &is_first);
+	fprintf(fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"layer\"}}");
+	panda_ai_trace_dec_print_sep(fp, &is_first);
+	fprintf(fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,\"args\":{\"name\":\"kernal_set\"}}");
+	panda_ai_trace_dec_print_sep(fp, &is_first);
+	fprintf(fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":2,\"args\":{\"name\":\"fmap_row_rplc\"}}");
+
+	for(uint32_t i = 0;i < evt_n;i++){
+		const PandaAiTraceDecEvt* evt = evt_arr + i;
+		double ts_us = ((double)(evt->ts - ts_origin)) / clk_mhz;
+
+		// 层结束时同时结束当前的卷积核组
+		if(kernal_set_open && (evt->type == PANDA_AI_TRACE_KERNAL_SET_START || evt->type == PANDA_AI_TRACE_LAYER_END)){
+			panda_ai_trace_dec_print_sep(fp, &is_first);
+			fprintf(fp, "{\"name\":\"kernal_set#%u\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+				kernal_set_arg, kernal_set_ts, ts_us - kernal_set_ts);
+
+			kernal_set_open = 0;
+		}
+
+		switch(evt->type){
+			case PANDA_AI_TRACE_LAYER_START:
+				if(layer_open){
+					panda_ai_trace_dec_print_sep(fp, &is_first);
+					fprintf(fp, "{\"ph\":\"E\",\"pid\":0,\"tid\":0,\"ts\":%.3f}", ts_us);
+				}
+
+				panda_ai_trace_dec_print_sep(fp, &is_first);
+				fprintf(fp, "{\"name\":\"%s#%u\",\"ph\":\"B\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"args\":{\"layer_id\":%u}}",
+					panda_ai_trace_dec_unit_name[PANDA_AI_TRACE_LAYER_UNIT(evt->arg)], PANDA_AI_TRACE_LAYER_ID(evt->arg),
+					ts_us, PANDA_AI_TRACE_LAYER_ID(evt->arg));
+
+				layer_open = 1;
+				break;
+			case PANDA_AI_TRACE_LAYER_END:
+				if(layer_open){
+					panda_ai_trace_dec_print_sep(fp, &is_first);
+					fprintf(fp, "{\"ph\":\"E\",\"pid\":0,\"tid\":0,\"ts\":%.3f}", ts_us);
+				}
+
+				layer_open = 0;
+				break;
+			case PANDA_AI_TRACE_KERNAL_SET_START:
+				kernal_set_open = 1;
+				kernal_set_arg = evt->arg;
+				kernal_set_ts = ts_us;
+				break;
+			case PANDA_AI_TRACE_FMAP_ROW_RPLC:
+				panda_ai_trace_dec_print_sep(fp, &is_first);
+				fprintf(fp, "{\"name\":\"fmap_row_rplc\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":2,\"ts\":%.3f,\"args\":{\"seq\":%u}}",
+					ts_us, evt->arg);
+				break;
+			default:
+				for(int j = 0;j < 3;j++){
+					PandaAiTraceDecAsync* async = async_arr + j;
+
+					if(evt->type == async->start_type){
+						panda_ai_trace_dec_print_sep(fp, &is_first);
+						fprintf(fp, "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"b\",\"id\":%u,\"pid\":0,\"tid\":0,\"ts\":%.3f,\"args\":{\"seq\":%u}}",
+							async->name, async->name, async->start_n, ts_us, evt->arg);
+
+						async->start_n++;
+					}else if(evt->type == async->done_type){
+						// 完成事件按顺序与最早的未完成事件配对
+						if(async->done_n < async->start_n){
+							panda_ai_trace_dec_print_sep(fp, &is_first);
+							fprintf(fp, "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"e\",\"id\":%u,\"pid\":0,\"tid\":0,\"ts\":%.3f}",
+								async->name, async->name, async->done_n, ts_us);
+
+							async->done_n++;
+						}
+					}
+				}
+				break;
+		}
+	}
+
+	fprintf(fp, "\n],\"displayTimeUnit\":\"ns\"}\n");
+
+	return 0;
+}
+
+/*************************
+@cfg
+@private
+@brief  比较2个事件的先后(先按时间戳, 再按在环形缓存区中的序号)
+@param  a 事件a(指针)
+        b 事件b(指针)
+@return 比较结果
+*************************/
+static int panda_ai_trace_dec_cmp_evt(const void* a, const void* b){
+	const PandaAiTraceDecEvt* evt_a = (const PandaAiTraceDecEvt*)a;
+	const PandaAiTraceDecEvt* evt_b = (const PandaAiTraceDecEvt*)b;
+
+	if(evt_a->ts != evt_b->ts){
+		return (evt_a->ts < evt_b->ts) ? -1:1;
+	}
+
+	return (evt_a->seq < evt_b->seq) ? -1:((evt_a->seq > evt_b->seq) ? 1:0);
+}
+
+/*************************
+@cfg
+@private
+@brief  输出事件之间的分隔符
+@param  fp 输出文件
+        is_first 是否第1个事件(指针)
+@return none
+*************************/
+static void panda_ai_trace_dec_print_sep(FILE* fp, uint8_t* is_first){
+	if(!(*is_first)){
+		fprintf(fp, ",\n");
+	}
+
+	*is_first = 0;
+}
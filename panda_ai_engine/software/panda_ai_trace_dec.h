@@ -0,0 +1,29 @@
+/************************************************************************************************************************
+大胖达AI引擎事件跟踪解码(接口头文件)
+@brief  在主机上把事件跟踪单元写出的环形缓存区解码为Chrome跟踪事件格式(JSON), 可在chrome://tracing或Perfetto中查看时间线
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include <stdio.h>
+
+#include "panda_ai_trace.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 已解码的事件
+typedef struct{
+	uint64_t ts; // 展开后的时间戳(主时钟周期数)
+	uint32_t arg; // 事件参数
+	uint8_t type; // 事件类型
+	uint32_t seq; // 在环形缓存区中的序号(时间戳相同时用于保持写入顺序)
+}PandaAiTraceDecEvt;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 从环形缓存区中按时间顺序取出事件
+int panda_ai_trace_dec_unpack(const uint8_t* ring, uint32_t ring_len, uint32_t wptr, uint32_t lap_n,
+	PandaAiTraceDecEvt* evt_arr, uint32_t* evt_n);
+// 把事件输出为Chrome跟踪事件格式
+int panda_ai_trace_dec_to_chrome_json(const PandaAiTraceDecEvt* evt_arr, uint32_t evt_n, double clk_mhz, FILE* fp);
@@ -0,0 +1,83 @@
+/************************************************************************************************************************
+大胖达AI引擎事件跟踪解码工具
+@brief  在主机上运行, 读取从板上导出的环形缓存区文件, 输出Chrome跟踪事件格式(JSON)
+        用法: panda_ai_trace_dec <环形缓存区文件> <写指针> <回绕次数> <主时钟频率(MHz)> [输出文件]
+        写指针和回绕次数由panda_ai_trace_get_sts获取(冲刷事件缓存之后), 未给出输出文件时输出到标准输出
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include "panda_ai_trace_dec.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[]){
+	if(argc < 5){
+		fprintf(stderr, "usage: %s <ring.bin> <wptr> <lap_n> <clk_mhz> [out.json]\n", argv[0]);
+
+		return -1;
+	}
+
+	uint32_t wptr = (uint32_t)strtoul(argv[2], NULL, 0);
+	uint32_t lap_n = (uint32_t)strtoul(argv[3], NULL, 0);
+	double clk_mhz = strtod(argv[4], NULL);
+
+	FILE* ring_fp = fopen(argv[1], "rb");
+
+	if(ring_fp == NULL){
+		fprintf(stderr, "cannot open %s\n", argv[1]);
+
+		return -1;
+	}
+
+	fseek(ring_fp, 0, SEEK_END);
+	long ring_len = ftell(ring_fp);
+	fseek(ring_fp, 0, SEEK_SET);
+
+	if(ring_len <= 0){
+		fclose(ring_fp);
+
+		return -1;
+	}
+
+	uint8_t* ring = (uint8_t*)malloc((size_t)ring_len);
+	PandaAiTraceDecEvt* evt_arr = (PandaAiTraceDecEvt*)malloc(
+		sizeof(PandaAiTraceDecEvt) * ((size_t)ring_len / PANDA_AI_TRACE_EVT_BYTES + 1));
+	uint32_t evt_n = 0;
+
+	if(ring == NULL || evt_arr == NULL || fread(ring, 1, (size_t)ring_len, ring_fp) != (size_t)ring_len){
+		fclose(ring_fp);
+		free(ring);
+		free(evt_arr);
+
+		return -1;
+	}
+
+	fclose(ring_fp);
+
+	if(panda_ai_trace_dec_unpack(ring, (uint32_t)ring_len, wptr, lap_n, evt_arr, &evt_n)){
+		fprintf(stderr, "invalid ring length or write pointer\n");
+
+		free(ring);
+		free(evt_arr);
+
+		return -1;
+	}
+
+	FILE* out_fp = (argc >= 6) ? fopen(argv[5], "w"):stdout;
+	int res = -1;
+
+	if(out_fp != NULL){
+		res = panda_ai_trace_dec_to_chrome_json(evt_arr, evt_n, clk_mhz, out_fp);
+
+		if(out_fp != stdout){
+			fclose(out_fp);
+		}
+	}
+
+	free(ring);
+	free(evt_arr);
+
+	return res;
+}
@@ -0,0 +1,372 @@
+/************************************************************************************************************************
+大胖达AI引擎Linux用户态访问
+@brief  提供在Linux用户态运行卷积/池化/逐元素操作/事件跟踪驱动所需的UIO映射、UIO中断和DMA缓存区
+        用法(以卷积单元为例):
+            panda_ai_uio_open(&conv_map, 0, 0); // 寄存器区
+            panda_ai_uio_open(&conv_mem_map, 0, 1); // BN参数与Sigmoid函数值查找表存储器区
+            panda_ai_dma_buf_open(&dma_buf, "udmabuf0", 0);
+            mmio.reg_base = conv_map.base;
+            mmio.mem_base = conv_mem_map.base;
+            mmio.bus_addr = panda_ai_dma_buf_bus_addr;
+            mmio.bus_addr_arg = &dma_buf;
+            axi_generic_conv_init_mmio(&conv, &mmio);
+        传给加速器的缓存区须用panda_ai_dma_buf_alloc分配
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include "panda_ai_uio.h"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __linux__
+static int panda_ai_uio_rd_sysfs(const char* path, uint64_t* value); // 读取sysfs属性(数值)
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@init
+@public
+@brief  映射UIO设备的映射区
+@param  map 映射区(句柄)
+        uio_id UIO设备编号(/dev/uioN中的N)
+        map_id 映射区编号(/sys/class/uio/uioN/maps/mapM中的M)
+@return 是否成功
+*************************/
+int panda_ai_uio_open(PandaAiUioMap* map, uint32_t uio_id, uint32_t map_id){
+#ifdef __linux__
+	char path[96];
+	uint64_t size;
+	uint64_t offset;
+	long page_size = sysconf(_SC_PAGESIZE);
+
+	map->fd = -1;
+	map->map_base = NULL;
+
+	snprintf(path, sizeof(path), "/sys/class/uio/uio%u/maps/map%u/size", uio_id, map_id);
+	if(panda_ai_uio_rd_sysfs(path, &size) || size == 0){
+		return -1;
+	}
+
+	// 映射区起始地址不按页对齐时, 页内偏移由offset属性给出
+	snprintf(path, sizeof(path), "/sys/class/uio/uio%u/maps/map%u/offset", uio_id, map_id);
+	if(panda_ai_uio_rd_sysfs(path, &offset)){
+		offset = 0;
+	}
+
+	snprintf(path, sizeof(path), "/dev/uio%u", uio_id);
+	map->fd = open(path, O_RDWR | O_SYNC);
+	if(map->fd < 0){
+		return -1;
+	}
+
+	// 第M个映射区通过mmap的偏移(M * 页大小)选择
+	map->map_len = (uint32_t)((offset + size + page_size - 1) & (~((uint64_t)page_size - 1)));
+	map->map_base = mmap(NULL, map->map_len, PROT_READ | PROT_WRITE, MAP_SHARED, map->fd, ((off_t)map_id) * page_size);
+	if(map->map_base == MAP_FAILED){
+		map->map_base = NULL;
+		close(map->fd);
+		map->fd = -1;
+
+		return -1;
+	}
+
+	map->base = ((uintptr_t)map->map_base) + (uintptr_t)offset;
+	map->len = (uint32_t)size;
+
+	return 0;
+#else
+	(void)map;
+	(void)uio_id;
+	(void)map_id;
+
+	return -1;
+#endif
+}
+
+/*************************
+@init
+@public
+@brief  解除UIO设备的映射
+@param  map 映射区(句柄)
+@return none
+*************************/
+void panda_ai_uio_close(PandaAiUioMap* map){
+#ifdef __linux__
+	if(map->map_base != NULL){
+		munmap(map->map_base, map->map_len);
+		map->map_base = NULL;
+	}
+
+	if(map->fd >= 0){
+		close(map->fd);
+		map->fd = -1;
+	}
+#else
+	(void)map;
+#endif
+}
+
+/*************************
+@ctrl
+@public
+@brief  使能(重新使能)UIO中断
+        uio_pdrv_genirq在每次中断后除能中断, 须重新使能后才能等到下一次中断
+@param  map 映射区(句柄)
+@return 是否成功
+*************************/
+int panda_ai_uio_enable_irq(PandaAiUioMap* map){
+#ifdef __linux__
+	uint32_t irq_on = 1;
+
+	return (write(map->fd, &irq_on, sizeof(irq_on)) == sizeof(irq_on)) ? 0:-1;
+#else
+	(void)map;
+
+	return -1;
+#endif
+}
+
+/*************************
+@sts
+@public
+@brief  等待UIO中断
+@param  map 映射区(句柄)
+        timeout_ms 超时时间(ms, 负数表示不超时)
+@return 是否等到中断(超时返回1, 失败返回-1)
+*************************/
+int panda_ai_uio_wait_irq(PandaAiUioMap* map, int timeout_ms){
+#ifdef __linux__
+	struct pollfd pfd;
+	uint32_t irq_n;
+
+	pfd.fd = map->fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	int res = poll(&pfd, 1, timeout_ms);
+
+	if(res == 0){
+		return 1;
+	}
+
+	if(res < 0 || read(map->fd, &irq_n, sizeof(irq_n)) != sizeof(irq_n)){
+		return -1;
+	}
+
+	return 0;
+#else
+	(void)map;
+	(void)timeout_ms;
+
+	return -1;
+#endif
+}
+
+/*************************
+@sts
+@public
+@brief  等待完成时的回调函数
+        重新使能UIO中断并等待中断或超时, 由驱动在返回后重新查询状态
+        须先使能处理单元的完成中断(如axi_generic_conv_enable_irq)
+@param  arg 映射区(PandaAiUioMap*)
+@return none
+*************************/
+void panda_ai_uio_wait_hook(void* arg){
+	PandaAiUioMap* map = (PandaAiUioMap*)arg;
+
+	if(panda_ai_uio_enable_irq(map) == 0){
+		panda_ai_uio_wait_irq(map, PANDA_AI_UIO_WAIT_HOOK_TIMEOUT_MS);
+	}
+}
+
+/*************************
+@init
+@public
+@brief  映射u-dma-buf缓存区
+@param  buf DMA缓存区(句柄)
+        name 设备名(如"udmabuf0")
+        cached 是否使用Cache(使用时须自行维护与加速器之间的一致性)
+@return 是否成功
+*************************/
+int panda_ai_dma_buf_open(PandaAiDmaBuf* buf, const char* name, uint8_t cached){
+#ifdef __linux__
+	char path[96];
+	uint64_t phys;
+	uint64_t size;
+
+	buf->fd = -1;
+	buf->virt = NULL;
+	buf->alloc_ofs = 0;
+
+	snprintf(path, sizeof(path), "/sys/class/u-dma-buf/%s/phys_addr", name);
+	if(panda_ai_uio_rd_sysfs(path, &phys)){
+		return -1;
+	}
+
+	snprintf(path, sizeof(path), "/sys/class/u-dma-buf/%s/size", name);
+	if(panda_ai_uio_rd_sysfs(path, &size) || size == 0 || size > 0xFFFFFFFF){
+		return -1;
+	}
+
+	// 加速器的总线地址为32位
+	if((phys + size) > 0x100000000ULL){
+		return -1;
+	}
+
+	snprintf(path, sizeof(path), "/dev/%s", name);
+	buf->fd = open(path, cached ? O_RDWR:(O_RDWR | O_SYNC));
+	if(buf->fd < 0){
+		return -1;
+	}
+
+	void* virt = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, buf->fd, 0);
+
+	if(virt == MAP_FAILED){
+		close(buf->fd);
+		buf->fd = -1;
+
+		return -1;
+	}
+
+	buf->virt = (uint8_t*)virt;
+	buf->phys = phys;
+	buf->len = (uint32_t)size;
+
+	return 0;
+#else
+	(void)buf;
+	(void)name;
+	(void)cached;
+
+	return -1;
+#endif
+}
+
+/*************************
+@init
+@public
+@brief  解除u-dma-buf缓存区的映射
+@param  buf DMA缓存区(句柄)
+@return none
+*************************/
+void panda_ai_dma_buf_close(PandaAiDmaBuf* buf){
+#ifdef __linux__
+	if(buf->virt != NULL){
+		munmap((void*)buf->virt, buf->len);
+		buf->virt = NULL;
+	}
+
+	if(buf->fd >= 0){
+		close(buf->fd);
+		buf->fd = -1;
+	}
+#else
+	(void)buf;
+#endif
+}
+
+/*************************
+@cfg
+@public
+@brief  从DMA缓存区中分配缓存区
+@param  buf DMA缓存区(句柄)
+        len 长度(字节数)
+        align 对齐字节数(须为2的幂, 0表示不对齐)
+@return 缓存区首地址(失败时返回NULL)
+*************************/
+void* panda_ai_dma_buf_alloc(PandaAiDmaBuf* buf, uint32_t len, uint32_t align){
+	uint32_t ofs = buf->alloc_ofs;
+
+	if(buf->virt == NULL){
+		return NULL;
+	}
+
+	if(align > 1){
+		ofs = (ofs + align - 1) & (~(align - 1));
+	}
+
+	if(((uint64_t)ofs + len) > buf->len){
+		return NULL;
+	}
+
+	buf->alloc_ofs = ofs + len;
+
+	return (void*)(buf->virt + ofs);
+}
+
+/*************************
+@cfg
+@public
+@brief  释放DMA缓存区中的全部缓存区
+@param  buf DMA缓存区(句柄)
+@return none
+*************************/
+void panda_ai_dma_buf_free_all(PandaAiDmaBuf* buf){
+	buf->alloc_ofs = 0;
+}
+
+/*************************
+@cfg
+@public
+@brief  总线地址转换函数
+        可作为驱动寄存器访问后端中的bus_addr
+@param  arg DMA缓存区(PandaAiDmaBuf*)
+        ptr 主机指针(须位于DMA缓存区内)
+@return 总线地址(ptr不在DMA缓存区内时返回0)
+*************************/
+uint32_t panda_ai_dma_buf_bus_addr(void* arg, const void* ptr){
+	const PandaAiDmaBuf* buf = (const PandaAiDmaBuf*)arg;
+	const uint8_t* p = (const uint8_t*)ptr;
+
+	if(buf->virt == NULL || p < buf->virt || p >= (buf->virt + buf->len)){
+		return 0x00000000;
+	}
+
+	return (uint32_t)(buf->phys + (uint64_t)(p - buf->virt));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __linux__
+/*************************
+@private
+@brief  读取sysfs属性(数值)
+        支持十进制和0x开头的十六进制
+@param  path 属性文件路径
+        value 读到的值(指针)
+@return 是否成功
+*************************/
+static int panda_ai_uio_rd_sysfs(const char* path, uint64_t* value){
+	FILE* fp = fopen(path, "r");
+	char line[64];
+
+	if(fp == NULL){
+		return -1;
+	}
+
+	if(fgets(line, sizeof(line), fp) == NULL){
+		fclose(fp);
+
+		return -1;
+	}
+
+	fclose(fp);
+
+	char* end;
+
+	*value = (uint64_t)strtoull(line, &end, 0);
+
+	return (end == line) ? -1:0;
+}
+#endif
@@ -0,0 +1,55 @@
+/************************************************************************************************************************
+大胖达AI引擎Linux用户态访问(接口头文件)
+@brief  提供在Linux用户态运行卷积/池化/逐元素操作/事件跟踪驱动所需的:
+            UIO映射: 把/dev/uioN的映射区mmap到用户态, 得到的虚拟地址作为驱动寄存器访问后端的基地址
+            UIO中断: 阻塞等待/dev/uioN上报的中断, 可作为驱动等待完成时的回调函数
+            DMA缓存区: 映射物理连续的u-dma-buf缓存区, 从中分配特征图/权重/描述符等缓存区,
+                       并作为驱动的总线地址转换函数把虚拟地址转换为物理地址
+        仅用于Linux, 其他平台下本文件中的函数均返回失败
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+************************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 等待完成时的回调函数每次等待中断的超时时间(ms), 超时后返回并由驱动重新查询状态
+#define PANDA_AI_UIO_WAIT_HOOK_TIMEOUT_MS 100
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: UIO设备的映射区
+typedef struct{
+	int fd; // 设备文件描述符
+	void* map_base; // mmap得到的虚拟地址(按页对齐)
+	uint32_t map_len; // mmap的长度
+	uintptr_t base; // 映射区的虚拟地址(已加上页内偏移, 作为驱动的基地址)
+	uint32_t len; // 映射区的长度
+}PandaAiUioMap;
+
+// 结构体: 物理连续的DMA缓存区
+typedef struct{
+	int fd; // 设备文件描述符
+	uint8_t* virt; // 虚拟地址
+	uint64_t phys; // 物理地址(即总线地址)
+	uint32_t len; // 长度
+	uint32_t alloc_ofs; // 已分配的字节数
+}PandaAiDmaBuf;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int panda_ai_uio_open(PandaAiUioMap* map, uint32_t uio_id, uint32_t map_id); // 映射UIO设备的映射区
+void panda_ai_uio_close(PandaAiUioMap* map); // 解除UIO设备的映射
+int panda_ai_uio_enable_irq(PandaAiUioMap* map); // 使能(重新使能)UIO中断
+int panda_ai_uio_wait_irq(PandaAiUioMap* map, int timeout_ms); // 等待UIO中断
+void panda_ai_uio_wait_hook(void* arg); // 等待完成时的回调函数(arg为PandaAiUioMap*)
+
+int panda_ai_dma_buf_open(PandaAiDmaBuf* buf, const char* name, uint8_t cached); // 映射u-dma-buf缓存区
+void panda_ai_dma_buf_close(PandaAiDmaBuf* buf); // 解除u-dma-buf缓存区的映射
+void* panda_ai_dma_buf_alloc(PandaAiDmaBuf* buf, uint32_t len, uint32_t align); // 从DMA缓存区中分配缓存区
+void panda_ai_dma_buf_free_all(PandaAiDmaBuf* buf); // 释放DMA缓存区中的全部缓存区
+uint32_t panda_ai_dma_buf_bus_addr(void* arg, const void* ptr); // 总线地址转换函数(arg为PandaAiDmaBuf*)
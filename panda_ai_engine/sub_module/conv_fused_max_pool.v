@@ -0,0 +1,312 @@
+/*
+MIT License
+
+Copyright (c) 2024 Panda, 2257691535@qq.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+`timescale 1ns / 1ps
+/********************************************************************
+本模块: 卷积最终结果的融合2x2最大池化单元
+
+描述:
+在卷积的最终结果(BN与激活之后, 输出数据舍入之前)上做步长为2的2x2最大池化,
+使卷积层后紧跟的最大池化层无需先把池化前的输出特征图写回内存再读出
+
+最终结果按"输出通道域 -> 表面行(y) -> 子表面行"的顺序到达, 每个子表面行包含(ofmap_w + 1)个表面,
+以last标志子表面行的结束, 以user[4]标志表面行内的最后1个子表面行
+
+偶数行: 水平方向两两取最大值, 写入行缓存(地址 = 子表面行基地址 + x / 2)
+奇数行: 水平方向两两取最大值, 再与行缓存中上1行的对应结果取最大值, 输出池化后的子表面行
+
+奇数宽度的最后1列和奇数高度的最后1行被丢弃(与最终结果传输请求生成单元的融合2x2最大池化模式一致)
+
+运算数据格式为FP16时, 最终结果为FP32, 否则为定点数(S32)
+
+除能融合2x2最大池化时, 输入数据流直通到输出
+
+注意：
+每个表面行的子表面行数 * 池化后的宽度((ofmap_w + 1) / 2)必须<=行缓存深度(BUF_DEPTH)
+在处理1个输出特征图期间不能改变运行时参数
+
+协议:
+AXIS MASTER/SLAVE
+
+作者: 陈家耀
+日期: 2026/10/16
+********************************************************************/
+
+
+module conv_fused_max_pool #(
+	parameter integer ATOMIC_K = 8, // 核并行数(1 | 2 | 4 | 8 | 16 | 32)
+	parameter integer BUF_DEPTH = 1024, // 行缓存深度(16~65536)
+	parameter real SIM_DELAY = 1 // 仿真延时
+)(
+	// 时钟和复位
+	input wire aclk,
+	input wire aresetn,
+	
+	// 运行时参数
+	input wire en_fused_max_pool, // 使能融合2x2最大池化
+	input wire[1:0] calfmt, // 运算数据格式
+	input wire[15:0] ofmap_w, // (池化前的)输出特征图宽度 - 1
+	input wire[15:0] ofmap_h, // (池化前的)输出特征图高度 - 1
+	
+	// 池化前的最终结果(AXIS从机)
+	input wire[ATOMIC_K*32-1:0] s_axis_data, // ATOMIC_K个定点数或FP32
+	input wire[ATOMIC_K*4-1:0] s_axis_keep,
+	input wire[4:0] s_axis_user, // {是否最后1个子行(1bit), 子行号(4bit)}
+	input wire s_axis_last, // 子表面行的最后1个表面(标志)
+	input wire s_axis_valid,
+	output wire s_axis_ready,
+	
+	// 池化后的最终结果(AXIS主机)
+	output wire[ATOMIC_K*32-1:0] m_axis_data, // ATOMIC_K个定点数或FP32
+	output wire[ATOMIC_K*4-1:0] m_axis_keep,
+	output wire[4:0] m_axis_user, // {是否最后1个子行(1bit), 子行号(4bit)}
+	output wire m_axis_last, // 子表面行的最后1个表面(标志)
+	output wire m_axis_valid,
+	input wire m_axis_ready
+);
+	
+	// 计算bit_depth的最高有效位编号(即位数-1)
+    function integer clogb2(input integer bit_depth);
+    begin
+		if(bit_depth == 0)
+			clogb2 = 0;
+		else
+		begin
+			for(clogb2 = -1;bit_depth > 0;clogb2 = clogb2 + 1)
+				bit_depth = bit_depth >> 1;
+		end
+    end
+    endfunction
+	
+	/** 常量 **/
+	// 运算数据格式的编码
+	localparam CAL_FMT_INT8 = 2'b00;
+	localparam CAL_FMT_INT16 = 2'b01;
+	localparam CAL_FMT_FP16 = 2'b10;
+	localparam CAL_FMT_NONE = 2'b11;
+	
+	/** 池化位置 **/
+	wire[15:0] pool_ofmap_w; // 池化后的输出特征图宽度
+	reg[15:0] in_x; // 表面x坐标(计数器)
+	reg[15:0] in_y; // 表面行y坐标(计数器)
+	reg[clogb2(BUF_DEPTH-1):0] sub_row_buf_base; // 子表面行在行缓存中的基地址
+	wire on_in_beat; // 输入1个表面(指示)
+	wire is_out_beat; // 当前表面完成1个池化窗口(标志)
+	
+	assign pool_ofmap_w = ({1'b0, ofmap_w} + 1'b1) >> 1;
+	
+	assign on_in_beat = en_fused_max_pool & s_axis_valid & s_axis_ready;
+	// 奇数行的奇数列
+	assign is_out_beat = in_x[0] & in_y[0];
+	
+	// 表面x坐标(计数器)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			in_x <= 16'd0;
+		else if((~en_fused_max_pool) | on_in_beat)
+			in_x <= # SIM_DELAY 
+				((~en_fused_max_pool) | s_axis_last) ? 
+					16'd0:
+					(in_x + 1'b1);
+	end
+	
+	// 表面行y坐标(计数器)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			in_y <= 16'd0;
+		else if((~en_fused_max_pool) | (on_in_beat & s_axis_last & s_axis_user[4]))
+			in_y <= # SIM_DELAY 
+				((~en_fused_max_pool) | (in_y == ofmap_h)) ? 
+					16'd0:
+					(in_y + 1'b1);
+	end
+	
+	// 子表面行在行缓存中的基地址
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			sub_row_buf_base <= 0;
+		else if((~en_fused_max_pool) | (on_in_beat & s_axis_last))
+			sub_row_buf_base <= # SIM_DELAY 
+				((~en_fused_max_pool) | s_axis_user[4]) ? 
+					0:
+					(sub_row_buf_base + pool_ofmap_w);
+	end
+	
+	/** 行缓存 **/
+	wire row_buf_wen;
+	wire[clogb2(BUF_DEPTH-1):0] row_buf_addr;
+	wire[ATOMIC_K*32-1:0] row_buf_din;
+	wire row_buf_ren;
+	wire[ATOMIC_K*32-1:0] row_buf_dout;
+	
+	assign row_buf_addr = sub_row_buf_base + in_x[15:1];
+	
+	// 偶数行的奇数列: 写入水平方向的最大值
+	assign row_buf_wen = on_in_beat & in_x[0] & (~in_y[0]);
+	// 奇数行的偶数列: 预取上1行的对应结果, 在同一池化窗口的奇数列使用
+	assign row_buf_ren = on_in_beat & (~in_x[0]) & in_y[0];
+	
+	bram_simple_dual_port #(
+		.style("LOW_LATENCY"),
+		.mem_width(ATOMIC_K*32),
+		.mem_depth(BUF_DEPTH),
+		.INIT_FILE("no_init"),
+		.simulation_delay(SIM_DELAY)
+	)row_buf_u(
+		.clk(aclk),
+	
+		.wen_a(row_buf_wen),
+		.addr_a(row_buf_addr),
+		.din_a(row_buf_din),
+	
+		.ren_b(row_buf_ren),
+		.addr_b(row_buf_addr),
+		.dout_b(row_buf_dout)
+	);
+	
+	/** 最大值比较 **/
+	reg[ATOMIC_K*32-1:0] first_col_data; // 池化窗口内偶数列的表面
+	wire[ATOMIC_K*32-1:0] hzt_max_data; // 水平方向的最大值
+	wire[ATOMIC_K*32-1:0] win_max_data; // 池化窗口内的最大值
+	wire is_fp; // 最终结果是否为FP32
+	
+	assign row_buf_din = hzt_max_data;
+	
+	assign is_fp = calfmt == CAL_FMT_FP16;
+	
+	// 池化窗口内偶数列的表面
+	always @(posedge aclk)
+	begin
+		if(on_in_beat & (~in_x[0]))
+			first_col_data <= # SIM_DELAY s_axis_data;
+	end
+	
+	/*
+	把FP32或S32转换为可直接按无符号数比较大小的键:
+		FP32: 负数按位取反, 非负数翻转符号位
+		S32: 翻转符号位
+	*/
+	genvar chn_i;
+	generate
+		for(chn_i = 0;chn_i < ATOMIC_K;chn_i = chn_i + 1)
+		begin:max_cmp_blk
+			wire[31:0] first_item;
+			wire[31:0] cur_item;
+			wire[31:0] row_item;
+			wire[31:0] first_key;
+			wire[31:0] cur_key;
+			wire[31:0] row_key;
+			wire[31:0] hzt_max_item;
+			wire[31:0] hzt_max_key;
+	
+			assign first_item = first_col_data[chn_i*32+31:chn_i*32];
+			assign cur_item = s_axis_data[chn_i*32+31:chn_i*32];
+			assign row_item = row_buf_dout[chn_i*32+31:chn_i*32];
+	
+			assign first_key = 
+				(is_fp & first_item[31]) ? 
+					(~first_item):
+					{~first_item[31], first_item[30:0]};
+			assign cur_key = 
+				(is_fp & cur_item[31]) ? 
+					(~cur_item):
+					{~cur_item[31], cur_item[30:0]};
+			assign row_key = 
+				(is_fp & row_item[31]) ? 
+					(~row_item):
+					{~row_item[31], row_item[30:0]};
+	
+			assign hzt_max_item = 
+				(cur_key > first_key) ? 
+					cur_item:
+					first_item;
+			assign hzt_max_key = 
+				(cur_key > first_key) ? 
+					cur_key:
+					first_key;
+	
+			assign hzt_max_data[chn_i*32+31:chn_i*32] = hzt_max_item;
+			assign win_max_data[chn_i*32+31:chn_i*32] = 
+				(row_key > hzt_max_key) ? 
+					row_item:
+					hzt_max_item;
+		end
+	endgenerate
+	
+	/** 输出寄存器 **/
+	reg[ATOMIC_K*32-1:0] out_data;
+	reg[ATOMIC_K*4-1:0] out_keep;
+	reg[4:0] out_user;
+	reg out_last;
+	reg out_valid;
+	
+	assign s_axis_ready = 
+		en_fused_max_pool ? 
+			((~is_out_beat) | (~out_valid) | m_axis_ready):
+			m_axis_ready;
+	
+	assign m_axis_data = 
+		en_fused_max_pool ? 
+			out_data:
+			s_axis_data;
+	assign m_axis_keep = 
+		en_fused_max_pool ? 
+			out_keep:
+			s_axis_keep;
+	assign m_axis_user = 
+		en_fused_max_pool ? 
+			out_user:
+			s_axis_user;
+	assign m_axis_last = 
+		en_fused_max_pool ? 
+			out_last:
+			s_axis_last;
+	assign m_axis_valid = 
+		en_fused_max_pool ? 
+			out_valid:
+			s_axis_valid;
+	
+	always @(posedge aclk)
+	begin
+		if(on_in_beat & is_out_beat)
+		begin
+			out_data <= # SIM_DELAY win_max_data;
+			out_keep <= # SIM_DELAY s_axis_keep;
+			out_user <= # SIM_DELAY s_axis_user;
+			out_last <= # SIM_DELAY in_x[15:1] == (pool_ofmap_w - 1'b1);
+		end
+	end
+	
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			out_valid <= 1'b0;
+		else if((~en_fused_max_pool) | (on_in_beat & is_out_beat) | m_axis_ready)
+			out_valid <= # SIM_DELAY en_fused_max_pool & on_in_beat & is_out_beat;
+	end
+	
+endmodule
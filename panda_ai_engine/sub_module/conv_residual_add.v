@@ -0,0 +1,638 @@
+/*
+MIT License
+
+Copyright (c) 2024 Panda, 2257691535@qq.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+`timescale 1ns / 1ps
+/********************************************************************
+本模块: 卷积最终结果的融合残差相加单元
+
+描述:
+在卷积的最终结果(BN与激活之后, 融合池化与输出数据舍入之前)上逐元素加上残差特征图:
+	结果 = 最终结果 + 残差 * 2 ^ residual_scale_exp
+可选地对相加结果再做Relu(residual_relu), 与除能激活函数配合即可实现"先相加后激活"
+使残差块无需再用逐元素操作单元把卷积结果和残差各读1次、把相加结果写1次
+
+残差DMA命令: 
+	对(共享)最终结果传输请求生成单元给出的每个S2MM命令, 同时发出1个残差读命令,
+	读地址 = S2MM命令地址 - 输出特征图基地址 + 残差特征图基地址, 待传输字节数与S2MM命令相同
+	两路命令都被接受后, 才接受下1个最终结果传输请求
+
+残差数据:
+	残差特征图与输出特征图的形状、数据大小类型(ofmap_data_type)和存储布局相同,
+	把MM2S数据流拼接后每次取出ATOMIC_K个项, 与1个最终结果表面对齐
+	运算数据格式为FP16时, 残差为FP16(2字节)或FP32(4字节), 转换为FP32后按指数加上缩放系数的指数;
+	否则残差为S8/S16/S32, 符号扩展为S32后按缩放系数的指数移位(正数左移, 负数算术右移)
+
+相加:
+	FP32: 对阶 -> 尾数相加 -> 规格化与就近偶数舍入, 共4级流水线; 非规格化数视为0, 上溢为无穷大
+	S32: 饱和相加
+
+除能残差相加时, 最终结果和最终结果传输请求均直通到输出
+
+注意：
+每个子表面行必须包含ATOMIC_K个通道(不支持部分通道的子表面行)
+不能与融合2x2最大池化同时使能
+在处理1个输出特征图期间不能改变运行时参数
+
+协议:
+AXIS MASTER/SLAVE
+
+作者: 陈家耀
+日期: 2026/10/17
+********************************************************************/
+
+
+module conv_residual_add #(
+	parameter integer ATOMIC_K = 8, // 核并行数(1 | 2 | 4 | 8 | 16 | 32)
+	parameter integer MM2S_STREAM_DATA_WIDTH = 64, // MM2S通道DMA数据流的位宽(32 | 64 | 128 | 256)
+	parameter real SIM_DELAY = 1 // 仿真延时
+)(
+	// 时钟和复位
+	input wire aclk,
+	input wire aresetn,
+	
+	// 运行时参数
+	input wire en_residual_add, // 使能残差相加
+	input wire residual_relu, // 残差相加后做Relu
+	input wire[5:0] residual_scale_exp, // 残差缩放系数的指数(有符号数)
+	input wire[1:0] calfmt, // 运算数据格式
+	input wire[1:0] ofmap_data_type, // 输出特征图数据大小类型
+	input wire[31:0] ofmap_baseaddr, // 输出特征图基地址
+	input wire[31:0] residual_baseaddr, // 残差特征图基地址
+	
+	// 最终结果传输请求(AXIS从机)
+	input wire[55:0] s_fnl_res_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
+	input wire[24:0] s_fnl_res_cmd_axis_user, // {命令ID(24bit), 固定(1'b1)/递增(1'b0)传输(1bit)}
+	input wire s_fnl_res_cmd_axis_valid,
+	output wire s_fnl_res_cmd_axis_ready,
+	// 最终结果传输请求(AXIS主机)
+	output wire[55:0] m_fnl_res_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
+	output wire[24:0] m_fnl_res_cmd_axis_user, // {命令ID(24bit), 固定(1'b1)/递增(1'b0)传输(1bit)}
+	output wire m_fnl_res_cmd_axis_valid,
+	input wire m_fnl_res_cmd_axis_ready,
+	
+	// 残差DMA(MM2S方向)命令流(AXIS主机)
+	output wire[55:0] m_res_dma_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
+	output wire m_res_dma_cmd_axis_user, // {固定(1'b1)/递增(1'b0)传输(1bit)}
+	output wire m_res_dma_cmd_axis_last, // 帧尾标志
+	output wire m_res_dma_cmd_axis_valid,
+	input wire m_res_dma_cmd_axis_ready,
+	// 残差DMA(MM2S方向)数据流(AXIS从机)
+	input wire[MM2S_STREAM_DATA_WIDTH-1:0] s_res_dma_strm_axis_data,
+	input wire[MM2S_STREAM_DATA_WIDTH/8-1:0] s_res_dma_strm_axis_keep,
+	input wire s_res_dma_strm_axis_last, // ignored
+	input wire s_res_dma_strm_axis_valid,
+	output wire s_res_dma_strm_axis_ready,
+	
+	// 相加前的最终结果(AXIS从机)
+	input wire[ATOMIC_K*32-1:0] s_axis_data, // ATOMIC_K个定点数或FP32
+	input wire[ATOMIC_K*4-1:0] s_axis_keep,
+	input wire[4:0] s_axis_user, // {是否最后1个子行(1bit), 子行号(4bit)}
+	input wire s_axis_last, // 子表面行的最后1个表面(标志)
+	input wire s_axis_valid,
+	output wire s_axis_ready,
+	
+	// 相加后的最终结果(AXIS主机)
+	output wire[ATOMIC_K*32-1:0] m_axis_data, // ATOMIC_K个定点数或FP32
+	output wire[ATOMIC_K*4-1:0] m_axis_keep,
+	output wire[4:0] m_axis_user, // {是否最后1个子行(1bit), 子行号(4bit)}
+	output wire m_axis_last, // 子表面行的最后1个表面(标志)
+	output wire m_axis_valid,
+	input wire m_axis_ready
+);
+	
+	// 计算bit_depth的最高有效位编号(即位数-1)
+    function integer clogb2(input integer bit_depth);
+    begin
+		if(bit_depth == 0)
+			clogb2 = 0;
+		else
+		begin
+			for(clogb2 = -1;bit_depth > 0;clogb2 = clogb2 + 1)
+				bit_depth = bit_depth >> 1;
+		end
+    end
+    endfunction
+	
+	// 计算u32中"1"的个数
+    function [5:0] count1_of_u32(input[31:0] data);
+        integer i;
+    begin
+        count1_of_u32 = 6'd0;
+        
+        for(i = 0;i < 32;i = i + 1)
+        begin
+            if(data[i])
+                count1_of_u32 = count1_of_u32 + 6'd1;
+        end
+    end
+    endfunction
+	
+	// 计算27位数的前导0个数
+    function [4:0] lzc_of_u27(input[26:0] data);
+        integer i;
+		reg found;
+    begin
+        lzc_of_u27 = 5'd27;
+		found = 1'b0;
+        
+        for(i = 26;i >= 0;i = i - 1)
+        begin
+            if((~found) & data[i])
+			begin
+                lzc_of_u27 = 26 - i;
+				found = 1'b1;
+			end
+        end
+    end
+    endfunction
+	
+	/** 常量 **/
+	// 运算数据格式的编码
+	localparam CAL_FMT_INT8 = 2'b00;
+	localparam CAL_FMT_INT16 = 2'b01;
+	localparam CAL_FMT_FP16 = 2'b10;
+	localparam CAL_FMT_NONE = 2'b11;
+	// 输出特征图数据大小类型的编码
+	localparam OFMAP_DATA_1_BYTE = 2'b00; // 1字节
+	localparam OFMAP_DATA_2_BYTE = 2'b01; // 2字节
+	localparam OFMAP_DATA_4_BYTE = 2'b10; // 4字节
+	// 残差拼接缓存的字节数
+	localparam integer IN_BYTE_N = MM2S_STREAM_DATA_WIDTH / 8; // 每拍MM2S数据的字节数
+	localparam integer SFC_MAX_BYTE_N = ATOMIC_K * 4; // 每个残差表面的最大字节数
+	localparam integer RES_BUF_BYTE_N = SFC_MAX_BYTE_N + IN_BYTE_N; // 拼接缓存的字节数
+	
+	/** 残差DMA命令 **/
+	wire[31:0] res_addr_ofs; // 残差特征图相对于输出特征图的地址偏移
+	reg fnl_res_cmd_sent; // 当前最终结果传输请求已发送到S2MM通道(标志)
+	reg res_cmd_sent; // 当前最终结果传输请求对应的残差读命令已发送(标志)
+	wire on_fnl_res_cmd_in; // 接受1个最终结果传输请求(指示)
+	
+	assign res_addr_ofs = residual_baseaddr - ofmap_baseaddr;
+	
+	assign s_fnl_res_cmd_axis_ready = 
+		en_residual_add ? 
+			((fnl_res_cmd_sent | m_fnl_res_cmd_axis_ready) & (res_cmd_sent | m_res_dma_cmd_axis_ready)):
+			m_fnl_res_cmd_axis_ready;
+	
+	assign m_fnl_res_cmd_axis_data = s_fnl_res_cmd_axis_data;
+	assign m_fnl_res_cmd_axis_user = s_fnl_res_cmd_axis_user;
+	assign m_fnl_res_cmd_axis_valid = s_fnl_res_cmd_axis_valid & ((~en_residual_add) | (~fnl_res_cmd_sent));
+	
+	assign m_res_dma_cmd_axis_data = {
+		s_fnl_res_cmd_axis_data[55:32], // 待传输字节数(24bit)
+		s_fnl_res_cmd_axis_data[31:0] + res_addr_ofs // 传输首地址(32bit)
+	};
+	assign m_res_dma_cmd_axis_user = 1'b0; // 递增传输
+	assign m_res_dma_cmd_axis_last = 1'b1;
+	assign m_res_dma_cmd_axis_valid = en_residual_add & s_fnl_res_cmd_axis_valid & (~res_cmd_sent);
+	
+	assign on_fnl_res_cmd_in = s_fnl_res_cmd_axis_valid & s_fnl_res_cmd_axis_ready;
+	
+	// 当前最终结果传输请求已发送到S2MM通道(标志)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			fnl_res_cmd_sent <= 1'b0;
+		else if((~en_residual_add) | on_fnl_res_cmd_in | (m_fnl_res_cmd_axis_valid & m_fnl_res_cmd_axis_ready))
+			fnl_res_cmd_sent <= # SIM_DELAY en_residual_add & (~on_fnl_res_cmd_in);
+	end
+	
+	// 当前最终结果传输请求对应的残差读命令已发送(标志)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			res_cmd_sent <= 1'b0;
+		else if((~en_residual_add) | on_fnl_res_cmd_in | (m_res_dma_cmd_axis_valid & m_res_dma_cmd_axis_ready))
+			res_cmd_sent <= # SIM_DELAY en_residual_add & (~on_fnl_res_cmd_in);
+	end
+	
+	/** 残差数据拼接 **/
+	reg[RES_BUF_BYTE_N*8-1:0] res_buf; // 拼接缓存
+	reg[clogb2(RES_BUF_BYTE_N):0] res_buf_byte_n; // 拼接缓存中的有效字节数
+	wire[clogb2(SFC_MAX_BYTE_N):0] res_sfc_byte_n; // 每个残差表面的字节数
+	wire res_sfc_vld; // 拼接缓存中有1个完整的残差表面(标志)
+	wire on_res_sfc_take; // 取出1个残差表面(指示)
+	wire[clogb2(RES_BUF_BYTE_N):0] res_buf_byte_n_after_take; // 取出残差表面后的有效字节数
+	wire on_res_in; // 输入1拍残差数据(指示)
+	wire[5:0] res_in_byte_n; // 本拍残差数据的有效字节数
+	wire[MM2S_STREAM_DATA_WIDTH-1:0] res_in_data_masked; // 按keep屏蔽后的残差数据
+	wire[RES_BUF_BYTE_N*8-1:0] res_buf_shifted; // 取出残差表面后的拼接缓存
+	
+	assign s_res_dma_strm_axis_ready = en_residual_add & (res_buf_byte_n_after_take < res_sfc_byte_n);
+	
+	assign res_sfc_byte_n = 
+		(ofmap_data_type == OFMAP_DATA_1_BYTE) ? ATOMIC_K:
+		(ofmap_data_type == OFMAP_DATA_2_BYTE) ? (ATOMIC_K * 2):
+		                                         (ATOMIC_K * 4);
+	assign res_sfc_vld = res_buf_byte_n >= res_sfc_byte_n;
+	assign res_buf_byte_n_after_take = 
+		on_res_sfc_take ? 
+			(res_buf_byte_n - res_sfc_byte_n):
+			res_buf_byte_n;
+	
+	assign on_res_in = s_res_dma_strm_axis_valid & s_res_dma_strm_axis_ready;
+	// 认为keep的有效字节是从低位开始连续的
+	assign res_in_byte_n = count1_of_u32(s_res_dma_strm_axis_keep | 32'h0000_0000);
+	
+	assign res_buf_shifted = 
+		on_res_sfc_take ? 
+			(res_buf >> {res_sfc_byte_n, 3'b000}):
+			res_buf;
+	
+	genvar in_byte_i;
+	generate
+		for(in_byte_i = 0;in_byte_i < IN_BYTE_N;in_byte_i = in_byte_i + 1)
+		begin:res_in_mask_blk
+			assign res_in_data_masked[in_byte_i*8+7:in_byte_i*8] = 
+				s_res_dma_strm_axis_data[in_byte_i*8+7:in_byte_i*8] & {8{s_res_dma_strm_axis_keep[in_byte_i]}};
+		end
+	endgenerate
+	
+	// 拼接缓存
+	always @(posedge aclk)
+	begin
+		// 除能时清零, 保证有效字节之上的部分总是0
+		if((~en_residual_add) | on_res_sfc_take | on_res_in)
+			res_buf <= # SIM_DELAY 
+				({(RES_BUF_BYTE_N*8){en_residual_add}} & res_buf_shifted) | 
+				(
+					on_res_in ? 
+						(({{(SFC_MAX_BYTE_N*8){1'b0}}, res_in_data_masked}) << {res_buf_byte_n_after_take, 3'b000}):
+						{(RES_BUF_BYTE_N*8){1'b0}}
+				);
+	end
+	
+	// 拼接缓存中的有效字节数
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			res_buf_byte_n <= 0;
+		else if((~en_residual_add) | on_res_sfc_take | on_res_in)
+			res_buf_byte_n <= # SIM_DELAY 
+				(~en_residual_add) ? 
+					0:
+					(res_buf_byte_n_after_take + (on_res_in ? res_in_byte_n:6'd0));
+	end
+	
+	/** 残差转换与缩放 **/
+	wire is_fp; // 最终结果是否为FP32
+	wire[ATOMIC_K*32-1:0] res_fp32; // 缩放后的残差(FP32)
+	wire[ATOMIC_K*32-1:0] res_s32; // 缩放后的残差(S32)
+	
+	assign is_fp = calfmt == CAL_FMT_FP16;
+	
+	genvar chn_i;
+	generate
+		for(chn_i = 0;chn_i < ATOMIC_K;chn_i = chn_i + 1)
+		begin:res_cvt_blk
+			wire[7:0] item_8;
+			wire[15:0] item_16;
+			wire[31:0] item_32;
+			wire[31:0] item_fp32; // 转换为FP32的残差
+			wire[9:0] item_fp32_exp_scaled; // 缩放后的指数
+			wire[31:0] item_s32; // 符号扩展为S32的残差
+			wire[5:0] item_s32_rsh_n; // 算术右移位数
+			wire signed[31:0] item_s32_rsh; // 算术右移后的残差
+			
+			assign item_8 = res_buf[chn_i*8+7:chn_i*8];
+			assign item_16 = res_buf[chn_i*16+15:chn_i*16];
+			assign item_32 = res_buf[chn_i*32+31:chn_i*32];
+			
+			// FP16转FP32, 非规格化数视为0
+			assign item_fp32 = 
+				(ofmap_data_type != OFMAP_DATA_2_BYTE) ? item_32:
+				(item_16[14:10] == 5'd0)               ? {item_16[15], 31'd0}:
+				(item_16[14:10] == 5'd31)              ? {item_16[15], 8'hFF, item_16[9:0], 13'd0}:
+				                                         {item_16[15], {3'b000, item_16[14:10]} + 8'd112, item_16[9:0], 13'd0};
+			
+			assign item_fp32_exp_scaled = {2'b00, item_fp32[30:23]} + {{4{residual_scale_exp[5]}}, residual_scale_exp};
+			
+			assign res_fp32[chn_i*32+31:chn_i*32] = 
+				((item_fp32[30:23] == 8'd0) | item_fp32_exp_scaled[9] | (item_fp32_exp_scaled == 10'd0)) ? 
+					{item_fp32[31], 31'd0}: // 0或下溢
+				((item_fp32[30:23] == 8'hFF) | (item_fp32_exp_scaled[8:0] >= 9'd255)) ? 
+					{item_fp32[31], 8'hFF, (item_fp32[30:23] == 8'hFF) ? item_fp32[22:0]:23'd0}: // 无穷大/NaN或上溢
+					{item_fp32[31], item_fp32_exp_scaled[7:0], item_fp32[22:0]};
+			
+			assign item_s32 = 
+				(ofmap_data_type == OFMAP_DATA_1_BYTE) ? {{24{item_8[7]}}, item_8}:
+				(ofmap_data_type == OFMAP_DATA_2_BYTE) ? {{16{item_16[15]}}, item_16}:
+				                                         item_32;
+			assign item_s32_rsh_n = 6'd0 - residual_scale_exp;
+			assign item_s32_rsh = $signed(item_s32) >>> item_s32_rsh_n;
+			
+			assign res_s32[chn_i*32+31:chn_i*32] = 
+				residual_scale_exp[5] ? 
+					item_s32_rsh:
+					(item_s32 << residual_scale_exp[4:0]);
+		end
+	endgenerate
+	
+	/**
+	相加流水线
+	
+	第1级: 最终结果与残差对齐
+	第2级: 对阶(FP32)/饱和相加(S32)
+	第3级: 尾数相加(FP32)
+	第4级: 规格化与舍入(FP32), 可选的Relu
+	**/
+	wire pipe_ce; // 流水线推进使能
+	wire on_in_beat; // 输入1个最终结果表面(指示)
+	// 第1级
+	reg[ATOMIC_K*32-1:0] s1_data; // 最终结果
+	reg[ATOMIC_K*32-1:0] s1_res_fp32; // 残差(FP32)
+	reg[ATOMIC_K*32-1:0] s1_res_s32; // 残差(S32)
+	reg[ATOMIC_K*4-1:0] s1_keep;
+	reg[4:0] s1_user;
+	reg s1_last;
+	reg s1_valid;
+	// 第2级
+	reg[ATOMIC_K-1:0] s2_sign; // 绝对值较大者的符号
+	reg[ATOMIC_K*8-1:0] s2_exp; // 绝对值较大者的指数
+	reg[ATOMIC_K*27-1:0] s2_big_m; // 绝对值较大者的尾数(含隐藏位和3位保护位)
+	reg[ATOMIC_K*27-1:0] s2_small_m; // 对阶后绝对值较小者的尾数(含隐藏位和3位保护位)
+	reg[ATOMIC_K-1:0] s2_eff_sub; // 有效减法(标志)
+	reg[ATOMIC_K-1:0] s2_special; // 有操作数为无穷大或NaN(标志)
+	reg[ATOMIC_K*32-1:0] s2_special_res; // 有操作数为无穷大或NaN时的结果
+	reg[ATOMIC_K*32-1:0] s2_s32_sum; // S32饱和相加结果
+	reg[ATOMIC_K*4-1:0] s2_keep;
+	reg[4:0] s2_user;
+	reg s2_last;
+	reg s2_valid;
+	// 第3级
+	reg[ATOMIC_K-1:0] s3_sign; // 结果的符号
+	reg[ATOMIC_K*8-1:0] s3_exp; // 规格化前的指数
+	reg[ATOMIC_K*28-1:0] s3_sum_m; // 尾数相加结果
+	reg[ATOMIC_K-1:0] s3_special; // 有操作数为无穷大或NaN(标志)
+	reg[ATOMIC_K*32-1:0] s3_special_res; // 有操作数为无穷大或NaN时的结果
+	reg[ATOMIC_K*32-1:0] s3_s32_sum; // S32饱和相加结果
+	reg[ATOMIC_K*4-1:0] s3_keep;
+	reg[4:0] s3_user;
+	reg s3_last;
+	reg s3_valid;
+	// 第4级(输出)
+	reg[ATOMIC_K*32-1:0] out_data;
+	reg[ATOMIC_K*4-1:0] out_keep;
+	reg[4:0] out_user;
+	reg out_last;
+	reg out_valid;
+	// 各通道的组合逻辑结果
+	wire[ATOMIC_K-1:0] s2_sign_nxt;
+	wire[ATOMIC_K*8-1:0] s2_exp_nxt;
+	wire[ATOMIC_K*27-1:0] s2_big_m_nxt;
+	wire[ATOMIC_K*27-1:0] s2_small_m_nxt;
+	wire[ATOMIC_K-1:0] s2_eff_sub_nxt;
+	wire[ATOMIC_K-1:0] s2_special_nxt;
+	wire[ATOMIC_K*32-1:0] s2_special_res_nxt;
+	wire[ATOMIC_K*32-1:0] s2_s32_sum_nxt;
+	wire[ATOMIC_K*28-1:0] s3_sum_m_nxt;
+	wire[ATOMIC_K*32-1:0] out_data_nxt;
+	
+	assign s_axis_ready = 
+		en_residual_add ? 
+			(pipe_ce & res_sfc_vld):
+			m_axis_ready;
+	
+	assign m_axis_data = 
+		en_residual_add ? 
+			out_data:
+			s_axis_data;
+	assign m_axis_keep = 
+		en_residual_add ? 
+			out_keep:
+			s_axis_keep;
+	assign m_axis_user = 
+		en_residual_add ? 
+			out_user:
+			s_axis_user;
+	assign m_axis_last = 
+		en_residual_add ? 
+			out_last:
+			s_axis_last;
+	assign m_axis_valid = 
+		en_residual_add ? 
+			out_valid:
+			s_axis_valid;
+	
+	assign pipe_ce = (~out_valid) | m_axis_ready;
+	assign on_in_beat = en_residual_add & s_axis_valid & s_axis_ready;
+	assign on_res_sfc_take = on_in_beat;
+	
+	generate
+		for(chn_i = 0;chn_i < ATOMIC_K;chn_i = chn_i + 1)
+		begin:add_blk
+			// 第2级的组合逻辑: 对阶
+			wire[31:0] op_a;
+			wire[31:0] op_b;
+			wire[30:0] op_a_abs; // 非规格化数视为0
+			wire[30:0] op_b_abs; // 非规格化数视为0
+			wire op_a_inf_nan;
+			wire op_b_inf_nan;
+			wire a_ge_b;
+			wire[30:0] big_abs;
+			wire[30:0] small_abs;
+			wire[7:0] exp_diff;
+			wire[26:0] small_m_org;
+			wire[26:0] small_m_shifted;
+			wire small_m_sticky;
+			wire[32:0] s32_sum_ext;
+			
+			assign op_a = s1_data[chn_i*32+31:chn_i*32];
+			assign op_b = s1_res_fp32[chn_i*32+31:chn_i*32];
+			
+			assign op_a_abs = (op_a[30:23] == 8'd0) ? 31'd0:op_a[30:0];
+			assign op_b_abs = (op_b[30:23] == 8'd0) ? 31'd0:op_b[30:0];
+			assign op_a_inf_nan = op_a[30:23] == 8'hFF;
+			assign op_b_inf_nan = op_b[30:23] == 8'hFF;
+			
+			assign a_ge_b = op_a_abs >= op_b_abs;
+			assign big_abs = a_ge_b ? op_a_abs:op_b_abs;
+			assign small_abs = a_ge_b ? op_b_abs:op_a_abs;
+			assign exp_diff = big_abs[30:23] - small_abs[30:23];
+			
+			assign small_m_org = {small_abs[30:23] != 8'd0, small_abs[22:0], 3'b000};
+			assign small_m_shifted = 
+				(exp_diff >= 8'd27) ? 
+					27'd0:
+					(small_m_org >> exp_diff);
+			// 被移出的位归入粘滞位
+			assign small_m_sticky = 
+				(exp_diff >= 8'd27) ? 
+					(|small_m_org):
+					(|(small_m_org & ~({27{1'b1}} << exp_diff)));
+			
+			assign s2_sign_nxt[chn_i] = a_ge_b ? op_a[31]:op_b[31];
+			assign s2_exp_nxt[chn_i*8+7:chn_i*8] = big_abs[30:23];
+			assign s2_big_m_nxt[chn_i*27+26:chn_i*27] = {big_abs[30:23] != 8'd0, big_abs[22:0], 3'b000};
+			assign s2_small_m_nxt[chn_i*27+26:chn_i*27] = {small_m_shifted[26:1], small_m_shifted[0] | small_m_sticky};
+			assign s2_eff_sub_nxt[chn_i] = op_a[31] ^ op_b[31];
+			assign s2_special_nxt[chn_i] = op_a_inf_nan | op_b_inf_nan;
+			assign s2_special_res_nxt[chn_i*32+31:chn_i*32] = 
+				(op_a_inf_nan & op_b_inf_nan & (op_a[31] ^ op_b[31])) ? 32'h7FC0_0000: // 无穷大相减得到NaN
+				op_a_inf_nan                                           ? op_a:
+				                                                         op_b;
+			
+			// S32饱和相加
+			assign s32_sum_ext = 
+				{s1_data[chn_i*32+31], s1_data[chn_i*32+31:chn_i*32]} + 
+				{s1_res_s32[chn_i*32+31], s1_res_s32[chn_i*32+31:chn_i*32]};
+			
+			assign s2_s32_sum_nxt[chn_i*32+31:chn_i*32] = 
+				(s32_sum_ext[32] ^ s32_sum_ext[31]) ? 
+					{s32_sum_ext[32], {31{~s32_sum_ext[32]}}}:
+					s32_sum_ext[31:0];
+			
+			// 第3级的组合逻辑: 尾数相加
+			assign s3_sum_m_nxt[chn_i*28+27:chn_i*28] = 
+				s2_eff_sub[chn_i] ? 
+					({1'b0, s2_big_m[chn_i*27+26:chn_i*27]} - {1'b0, s2_small_m[chn_i*27+26:chn_i*27]}):
+					({1'b0, s2_big_m[chn_i*27+26:chn_i*27]} + {1'b0, s2_small_m[chn_i*27+26:chn_i*27]});
+			
+			// 第4级的组合逻辑: 规格化与就近偶数舍入
+			wire[27:0] sum_m;
+			wire[4:0] sum_m_lzc;
+			wire[26:0] norm_m; // 规格化后的尾数(最高位为隐藏位, 低3位为保护位、舍入位和粘滞位)
+			wire[9:0] norm_exp; // 规格化后的指数(有符号数)
+			wire round_up;
+			wire[24:0] rnd_m; // 舍入后的尾数
+			wire[9:0] rnd_exp; // 舍入后的指数(有符号数)
+			wire[31:0] fp32_res;
+			wire[31:0] sel_res;
+			
+			assign sum_m = s3_sum_m[chn_i*28+27:chn_i*28];
+			assign sum_m_lzc = lzc_of_u27(sum_m[26:0]);
+			
+			assign norm_m = 
+				sum_m[27] ? 
+					{sum_m[27:2], sum_m[1] | sum_m[0]}:
+					(sum_m[26:0] << sum_m_lzc);
+			assign norm_exp = 
+				sum_m[27] ? 
+					({2'b00, s3_exp[chn_i*8+7:chn_i*8]} + 10'd1):
+					({2'b00, s3_exp[chn_i*8+7:chn_i*8]} - {5'd0, sum_m_lzc});
+			
+			assign round_up = norm_m[2] & (norm_m[1] | norm_m[0] | norm_m[3]);
+			assign rnd_m = {1'b0, norm_m[26:3]} + round_up;
+			assign rnd_exp = norm_exp + rnd_m[24];
+			
+			assign fp32_res = 
+				s3_special[chn_i]                          ? s3_special_res[chn_i*32+31:chn_i*32]:
+				((sum_m == 28'd0) | rnd_exp[9] | (rnd_exp == 10'd0)) ? {s3_sign[chn_i] & (sum_m != 28'd0), 31'd0}: // 0或下溢
+				(rnd_exp[8:0] >= 9'd255)                   ? {s3_sign[chn_i], 8'hFF, 23'd0}: // 上溢
+				                                             {s3_sign[chn_i], rnd_exp[7:0], rnd_m[24] ? rnd_m[23:1]:rnd_m[22:0]};
+			
+			assign sel_res = 
+				is_fp ? 
+					fp32_res:
+					s3_s32_sum[chn_i*32+31:chn_i*32];
+			
+			assign out_data_nxt[chn_i*32+31:chn_i*32] = 
+				(residual_relu & sel_res[31]) ? 
+					32'd0:
+					sel_res;
+		end
+	endgenerate
+	
+	// 第1级
+	always @(posedge aclk)
+	begin
+		if(pipe_ce & on_in_beat)
+		begin
+			s1_data <= # SIM_DELAY s_axis_data;
+			s1_res_fp32 <= # SIM_DELAY res_fp32;
+			s1_res_s32 <= # SIM_DELAY res_s32;
+			s1_keep <= # SIM_DELAY s_axis_keep;
+			s1_user <= # SIM_DELAY s_axis_user;
+			s1_last <= # SIM_DELAY s_axis_last;
+		end
+	end
+	
+	// 第2级
+	always @(posedge aclk)
+	begin
+		if(pipe_ce & s1_valid)
+		begin
+			s2_sign <= # SIM_DELAY s2_sign_nxt;
+			s2_exp <= # SIM_DELAY s2_exp_nxt;
+			s2_big_m <= # SIM_DELAY s2_big_m_nxt;
+			s2_small_m <= # SIM_DELAY s2_small_m_nxt;
+			s2_eff_sub <= # SIM_DELAY s2_eff_sub_nxt;
+			s2_special <= # SIM_DELAY s2_special_nxt;
+			s2_special_res <= # SIM_DELAY s2_special_res_nxt;
+			s2_s32_sum <= # SIM_DELAY s2_s32_sum_nxt;
+			s2_keep <= # SIM_DELAY s1_keep;
+			s2_user <= # SIM_DELAY s1_user;
+			s2_last <= # SIM_DELAY s1_last;
+		end
+	end
+	
+	// 第3级
+	always @(posedge aclk)
+	begin
+		if(pipe_ce & s2_valid)
+		begin
+			s3_sign <= # SIM_DELAY s2_sign;
+			s3_exp <= # SIM_DELAY s2_exp;
+			s3_sum_m <= # SIM_DELAY s3_sum_m_nxt;
+			s3_special <= # SIM_DELAY s2_special;
+			s3_special_res <= # SIM_DELAY s2_special_res;
+			s3_s32_sum <= # SIM_DELAY s2_s32_sum;
+			s3_keep <= # SIM_DELAY s2_keep;
+			s3_user <= # SIM_DELAY s2_user;
+			s3_last <= # SIM_DELAY s2_last;
+		end
+	end
+	
+	// 第4级(输出)
+	always @(posedge aclk)
+	begin
+		if(pipe_ce & s3_valid)
+		begin
+			out_data <= # SIM_DELAY out_data_nxt;
+			out_keep <= # SIM_DELAY s3_keep;
+			out_user <= # SIM_DELAY s3_user;
+			out_last <= # SIM_DELAY s3_last;
+		end
+	end
+	
+	// 各级的有效标志
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+		begin
+			s1_valid <= 1'b0;
+			s2_valid <= 1'b0;
+			s3_valid <= 1'b0;
+			out_valid <= 1'b0;
+		end
+		else if((~en_residual_add) | pipe_ce)
+		begin
+			s1_valid <= # SIM_DELAY en_residual_add & on_in_beat;
+			s2_valid <= # SIM_DELAY en_residual_add & s1_valid;
+			s3_valid <= # SIM_DELAY en_residual_add & s2_valid;
+			out_valid <= # SIM_DELAY en_residual_add & s3_valid;
+		end
+	end
+	
+endmodule
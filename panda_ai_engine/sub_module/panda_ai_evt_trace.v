@@ -0,0 +1,818 @@
+/*
+MIT License
+
+Copyright (c) 2024 Panda, 2257691535@qq.com
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+`timescale 1ns / 1ps
+/********************************************************************
+本模块: 大胖达AI引擎事件跟踪单元
+
+描述:
+为引擎内的事件打上40位时间戳(主时钟周期数), 暂存到事件缓存,
+再经独立的DMA(S2MM)通道按块写入内存中的环形缓存区, 由主机解码为时间线
+
+事件(64位, 小端格式) ->
+	------------------------------------------------------
+	|  位     |                   含义                   |
+	------------------------------------------------------
+	| 39~0    | 时间戳                                   |
+	------------------------------------------------------
+	| 59~40   | 事件参数                                 |
+	------------------------------------------------------
+	| 63~60   | 事件类型                                 |
+	------------------------------------------------------
+
+事件类型 ->
+	------------------------------------------------------------------------------------------------------
+	| 编码 |            事件            |                           事件参数                             |
+	------------------------------------------------------------------------------------------------------
+	|  0   | 层结束                     | {层号(18bit), 处理单元(2bit)}, 处理单元: 0 -> 卷积, 1 -> 池化, |
+	|      |                            | 2 -> 逐元素操作                                                |
+	------------------------------------------------------------------------------------------------------
+	|  1   | 层开始                     | 同上                                                           |
+	------------------------------------------------------------------------------------------------------
+	|  2   | 卷积核组开始               | 本层内的序号                                                   |
+	------------------------------------------------------------------------------------------------------
+	|  3   | 特征图表面行加载(发送命令) | 本层内的序号                                                   |
+	------------------------------------------------------------------------------------------------------
+	|  4   | 特征图表面行加载完成       | 本层内的序号                                                   |
+	------------------------------------------------------------------------------------------------------
+	|  5   | 特征图表面行置换           | 本层内的序号                                                   |
+	------------------------------------------------------------------------------------------------------
+	|  6   | 权重通道组加载(发送命令)   | 本层内的序号                                                   |
+	------------------------------------------------------------------------------------------------------
+	|  7   | 权重通道组加载完成         | 本层内的序号                                                   |
+	------------------------------------------------------------------------------------------------------
+	|  8   | 最终结果行写出(发送命令)   | 本层内的序号                                                   |
+	------------------------------------------------------------------------------------------------------
+	|  9   | 最终结果行写出完成         | 本层内的序号                                                   |
+	------------------------------------------------------------------------------------------------------
+
+寄存器->
+    --------------------------------------------------------------------------------------------------------
+    |  寄存器  |  偏移量 |             含义              |   读写特性   |               备注               |
+    --------------------------------------------------------------------------------------------------------
+    | version  | 0x00/0  |31~0: 版本号                   |      RO      | 用日期表示的版本号,              |
+	|          |         |                               |              | 每4位取值0~9, 小端格式           |
+	--------------------------------------------------------------------------------------------------------
+	| acc_name | 0x04/1  |29~0: 加速器类型               |      RO      | 用小写字母表示的加速器类型, 每5位|
+	|          |         |                               |              | 取值0~26, 小端格式, 26表示'\0'   |
+	|          |         |31~30: 加速器ID                |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| info0    | 0x08/2  |15~0: 事件缓存深度             |      RO      |                                  |
+	|          |         |23~16: 每次写入的最大事件数    |      RO      |                                  |
+	|          |         |27~24: 事件类型数              |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	********************************************************************************************************
+	--------------------------------------------------------------------------------------------------------
+	| ctrl0    | 0x10/4  |0: 使能事件记录                |      RW      |                                  |
+	|          |         |1: 冲刷事件缓存                |      RW      | 写1把事件缓存中的剩余事件全部写出|
+	|          |         |                               |              | 读该位时得到冲刷等待标志         |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl1    | 0x14/5  |9~0: 事件类型掩码              |      RW      | 第i位为1时记录类型为i的事件      |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl2    | 0x18/6  |31~0: 环形缓存区基地址         |      RW      | 须8字节对齐                      |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl3    | 0x1C/7  |31~0: 环形缓存区大小           |      RW      | 以字节计, 须为8的倍数            |
+	|          |         |                               |              | 写该寄存器时清零写指针和回绕次数 |
+	--------------------------------------------------------------------------------------------------------
+	********************************************************************************************************
+	--------------------------------------------------------------------------------------------------------
+	| sts0     | 0x20/8  |31~0: 写指针                   |      RO      | 下1个事件在环形缓存区中的偏移    |
+	|          |         |                               |              | (以字节计), 在写入完成后更新     |
+	--------------------------------------------------------------------------------------------------------
+	| sts1     | 0x24/9  |31~0: 回绕次数                 |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| sts2     | 0x28/10 |31~0: 丢弃的事件数             |      WC      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| sts3     | 0x2C/11 |0: 事件缓存空标志              |      RO      |                                  |
+	|          |         |1: 写入空闲标志                |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| sts4     | 0x30/12 |31~0: 当前时间戳的低32位       |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| sts5     | 0x34/13 |7~0: 当前时间戳的高8位         |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+
+层的开始与结束 ->
+	卷积/池化: 启动最终结果传输请求生成单元时层开始;
+		最终结果传输请求生成单元完成且已发送的S2MM命令全部完成时层结束
+	逐元素操作: 发送本层的第1个DMA命令时层开始; 发送S2MM命令且该命令完成时层结束
+	若上一层尚未结束时下一层(卷积/池化)已开始, 则在同1个周期记录上一层结束
+
+注意：
+同1种事件在被写入事件缓存前再次发生时, 后1次事件被丢弃并计入丢弃的事件数;
+事件缓存满时新事件同样被丢弃
+同1个周期发生的多种事件按类型编码从小到大依次写入事件缓存, 因此环形缓存区中的事件不严格按时间戳排序
+同一时刻只有1个事件跟踪DMA命令在传输, 每个命令最多写入BURST_EVT_N个事件, 且不会越过环形缓存区末尾
+环形缓存区大小为0时不写出事件, 须在写入空闲时修改环形缓存区基地址和大小
+
+协议:
+AXI-Lite SLAVE
+AXIS MASTER
+
+作者: 陈家耀
+日期: 2026/10/16
+********************************************************************/
+
+
+module panda_ai_evt_trace #(
+	parameter integer EVT_FIFO_DEPTH = 512, // 事件缓存深度(32 | 64 | 128 | 256 | 512 | 1024 | 2048 | 4096)
+	parameter integer BURST_EVT_N = 8, // 每次写入的最大事件数(1~255)
+	parameter real SIM_DELAY = 1 // 仿真延时
+)(
+	// 时钟和复位
+	input wire aclk,
+	input wire aresetn,
+	
+	// 寄存器配置接口(AXI-Lite从机)
+    // 读地址通道
+    input wire[31:0] s_axi_lite_araddr,
+    input wire s_axi_lite_arvalid,
+    output wire s_axi_lite_arready,
+    // 写地址通道
+    input wire[31:0] s_axi_lite_awaddr,
+    input wire s_axi_lite_awvalid,
+    output wire s_axi_lite_awready,
+    // 写响应通道
+    output wire[1:0] s_axi_lite_bresp, // const -> 2'b00(OKAY)
+    output wire s_axi_lite_bvalid,
+    input wire s_axi_lite_bready,
+    // 读数据通道
+    output wire[31:0] s_axi_lite_rdata,
+    output wire[1:0] s_axi_lite_rresp, // const -> 2'b00(OKAY)
+    output wire s_axi_lite_rvalid,
+    input wire s_axi_lite_rready,
+    // 写数据通道
+    input wire[31:0] s_axi_lite_wdata,
+    input wire s_axi_lite_wvalid,
+    output wire s_axi_lite_wready,
+	
+	// 事件(指示)
+	input wire on_conv_start, // 卷积层开始
+	input wire on_pool_start, // 池化层开始
+	input wire on_elm_start, // 逐元素操作开始
+	input wire on_s2mm_issue_fns, // 本层的S2MM命令已全部发送
+	input wire on_kernal_set_start, // 卷积核组开始
+	input wire on_fmap_row_load, // 特征图表面行加载(发送命令)
+	input wire on_fmap_row_load_done, // 特征图表面行加载完成
+	input wire on_fmap_row_rplc, // 特征图表面行置换
+	input wire on_kernal_cgrp_load, // 权重通道组加载(发送命令)
+	input wire on_kernal_cgrp_load_done, // 权重通道组加载完成
+	input wire on_fnl_res_row_wr, // 最终结果行写出(发送命令)
+	input wire on_fnl_res_row_wr_done, // 最终结果行写出完成
+	
+	// 事件跟踪DMA(S2MM方向)命令流(AXIS主机)
+	output wire[55:0] m_trace_dma_cmd_axis_data, // {待传输字节数(24bit), 传输首地址(32bit)}
+	output wire m_trace_dma_cmd_axis_user, // 固定(1'b1)/递增(1'b0)传输(1bit)
+	output wire m_trace_dma_cmd_axis_valid,
+	input wire m_trace_dma_cmd_axis_ready,
+	// 事件数据流(AXIS主机)
+	output wire[63:0] m_axis_trace_data,
+	output wire[7:0] m_axis_trace_keep,
+	output wire m_axis_trace_last,
+	output wire m_axis_trace_valid,
+	input wire m_axis_trace_ready,
+	// 事件跟踪DMA(S2MM方向)命令完成(指示)
+	input wire trace_s2mm_cmd_done
+);
+	
+	// 计算bit_depth的最高有效位编号(即位数-1)
+    function integer clogb2(input integer bit_depth);
+    begin
+		if(bit_depth == 0)
+			clogb2 = 0;
+		else
+		begin
+			for(clogb2 = -1;bit_depth > 0;clogb2 = clogb2 + 1)
+				bit_depth = bit_depth >> 1;
+		end
+    end
+    endfunction
+	
+	/** 内部配置 **/
+	localparam integer REGS_N = 16; // 寄存器总数
+	
+	/** 常量 **/
+	// 寄存器配置状态独热码编号
+	localparam integer REG_CFG_STS_ADDR = 0; // 状态:地址阶段
+	localparam integer REG_CFG_STS_RW_REG = 1; // 状态:读/写寄存器
+	localparam integer REG_CFG_STS_RW_RESP = 2; // 状态:读/写响应
+	// 事件类型
+	localparam integer EVT_TYPE_N = 10; // 事件类型数
+	localparam integer EVT_LAYER_END = 0; // 层结束
+	localparam integer EVT_LAYER_START = 1; // 层开始
+	localparam integer EVT_KERNAL_SET_START = 2; // 卷积核组开始
+	localparam integer EVT_FMAP_ROW_LOAD = 3; // 特征图表面行加载(发送命令)
+	localparam integer EVT_FMAP_ROW_LOAD_DONE = 4; // 特征图表面行加载完成
+	localparam integer EVT_FMAP_ROW_RPLC = 5; // 特征图表面行置换
+	localparam integer EVT_KERNAL_CGRP_LOAD = 6; // 权重通道组加载(发送命令)
+	localparam integer EVT_KERNAL_CGRP_LOAD_DONE = 7; // 权重通道组加载完成
+	localparam integer EVT_FNL_RES_ROW_WR = 8; // 最终结果行写出(发送命令)
+	localparam integer EVT_FNL_RES_ROW_WR_DONE = 9; // 最终结果行写出完成
+	// 处理单元编码
+	localparam UNIT_CONV = 2'd0;
+	localparam UNIT_POOL = 2'd1;
+	localparam UNIT_ELM = 2'd2;
+	// 写入状态独热码编号
+	localparam integer WR_STS_IDLE = 0; // 状态:空闲
+	localparam integer WR_STS_CMD = 1; // 状态:发送DMA命令
+	localparam integer WR_STS_DATA = 2; // 状态:发送事件数据
+	localparam integer WR_STS_WAIT = 3; // 状态:等待DMA命令完成
+	
+	/** 寄存器配置控制 **/
+	reg[2:0] reg_cfg_sts; // 寄存器配置状态
+	wire[1:0] rw_grant; // 读写许可({写许可, 读许可})
+	reg[1:0] addr_ready; // 地址通道的ready信号({aw_ready, ar_ready})
+	reg is_write; // 是否写寄存器
+	reg[clogb2(REGS_N-1):0] ofs_addr; // 读写寄存器的偏移地址
+	reg wready; // 写数据通道的ready信号
+	reg bvalid; // 写响应通道的valid信号
+	reg rvalid; // 读数据通道的valid信号
+	wire regs_en; // 寄存器访问使能
+	wire regs_wen; // 寄存器写使能
+	wire[clogb2(REGS_N-1):0] regs_addr; // 寄存器访问地址
+	wire[31:0] regs_din; // 寄存器写数据
+	reg[31:0] regs_dout; // 寄存器读数据
+	
+	assign {s_axi_lite_awready, s_axi_lite_arready} = addr_ready;
+	assign s_axi_lite_bresp = 2'b00;
+	assign s_axi_lite_bvalid = bvalid;
+	assign s_axi_lite_rdata = regs_dout;
+	assign s_axi_lite_rresp = 2'b00;
+	assign s_axi_lite_rvalid = rvalid;
+	assign s_axi_lite_wready = wready;
+	
+	assign rw_grant = {s_axi_lite_awvalid, (~s_axi_lite_awvalid) & s_axi_lite_arvalid}; // 写优先
+	
+	assign regs_en = reg_cfg_sts[REG_CFG_STS_RW_REG] & ((~is_write) | s_axi_lite_wvalid);
+	assign regs_wen = is_write;
+	assign regs_addr = ofs_addr;
+	assign regs_din = s_axi_lite_wdata;
+	
+	// 寄存器配置状态
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			reg_cfg_sts <= 3'b001;
+		else if((reg_cfg_sts[REG_CFG_STS_ADDR] & (s_axi_lite_awvalid | s_axi_lite_arvalid)) |
+			(reg_cfg_sts[REG_CFG_STS_RW_REG] & ((~is_write) | s_axi_lite_wvalid)) |
+			(reg_cfg_sts[REG_CFG_STS_RW_RESP] & (is_write ? s_axi_lite_bready:s_axi_lite_rready)))
+			reg_cfg_sts <= # SIM_DELAY {reg_cfg_sts[1:0], reg_cfg_sts[2]};
+	end
+	
+	// 地址通道的ready信号
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			addr_ready <= 2'b00;
+		else
+			addr_ready <= # SIM_DELAY {2{reg_cfg_sts[REG_CFG_STS_ADDR]}} & rw_grant;
+	end
+	
+	// 是否写寄存器
+	always @(posedge aclk)
+	begin
+		if(reg_cfg_sts[REG_CFG_STS_ADDR] & (s_axi_lite_awvalid | s_axi_lite_arvalid))
+			is_write <= # SIM_DELAY s_axi_lite_awvalid;
+	end
+	
+	// 读写寄存器的偏移地址
+	always @(posedge aclk)
+	begin
+		if(reg_cfg_sts[REG_CFG_STS_ADDR] & (s_axi_lite_awvalid | s_axi_lite_arvalid))
+			ofs_addr <= # SIM_DELAY s_axi_lite_awvalid ?
+				s_axi_lite_awaddr[2+clogb2(REGS_N-1):2]:s_axi_lite_araddr[2+clogb2(REGS_N-1):2];
+	end
+	
+	// 写数据通道的ready信号
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			wready <= 1'b0;
+		else
+			wready <= # SIM_DELAY wready ?
+				(~s_axi_lite_wvalid):(reg_cfg_sts[REG_CFG_STS_ADDR] & s_axi_lite_awvalid);
+	end
+	
+	// 写响应通道的valid信号
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			bvalid <= 1'b0;
+		else
+			bvalid <= # SIM_DELAY bvalid ?
+				(~s_axi_lite_bready):(s_axi_lite_wvalid & s_axi_lite_wready);
+	end
+	
+	// 读数据通道的valid信号
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			rvalid <= 1'b0;
+		else
+			rvalid <= # SIM_DELAY rvalid ?
+				(~s_axi_lite_rready):(reg_cfg_sts[REG_CFG_STS_RW_REG] & (~is_write));
+	end
+	
+	/**
+	寄存器(version, acc_name, info0)
+	
+	--------------------------------------------------------------------------------------------------------
+    | version  | 0x00/0  |31~0: 版本号                   |      RO      | 用日期表示的版本号,              |
+	|          |         |                               |              | 每4位取值0~9, 小端格式           |
+	--------------------------------------------------------------------------------------------------------
+	| acc_name | 0x04/1  |29~0: 加速器类型               |      RO      | 用小写字母表示的加速器类型, 每5位|
+	|          |         |                               |              | 取值0~26, 小端格式, 26表示'\0'   |
+	|          |         |31~30: 加速器ID                |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| info0    | 0x08/2  |15~0: 事件缓存深度             |      RO      |                                  |
+	|          |         |23~16: 每次写入的最大事件数    |      RO      |                                  |
+	|          |         |27~24: 事件类型数              |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	**/
+	wire[31:0] version_r; // 版本号
+	wire[29:0] acc_type_r; // 加速器类型
+	wire[1:0] acc_id_r; // 加速器ID
+	wire[15:0] evt_fifo_depth_r; // 事件缓存深度
+	wire[7:0] burst_evt_n_r; // 每次写入的最大事件数
+	wire[3:0] evt_type_n_r; // 事件类型数
+	
+	assign version_r = {4'd6, 4'd1, 4'd0, 4'd1, 4'd6, 4'd2, 4'd0, 4'd2}; // 2026.10.16
+	assign acc_type_r = {5'd26, 5'd2, 5'd17, 5'd19, 5'd21, 5'd4}; // "evtrc\0"
+	assign acc_id_r = 2'd0;
+	
+	assign evt_fifo_depth_r = EVT_FIFO_DEPTH;
+	assign burst_evt_n_r = BURST_EVT_N;
+	assign evt_type_n_r = EVT_TYPE_N;
+	
+	/**
+	寄存器(ctrl0, ctrl1, ctrl2, ctrl3)
+	
+	--------------------------------------------------------------------------------------------------------
+	| ctrl0    | 0x10/4  |0: 使能事件记录                |      RW      |                                  |
+	|          |         |1: 冲刷事件缓存                |      RW      | 写1把事件缓存中的剩余事件全部写出|
+	|          |         |                               |              | 读该位时得到冲刷等待标志         |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl1    | 0x14/5  |9~0: 事件类型掩码              |      RW      | 第i位为1时记录类型为i的事件      |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl2    | 0x18/6  |31~0: 环形缓存区基地址         |      RW      | 须8字节对齐                      |
+	--------------------------------------------------------------------------------------------------------
+	| ctrl3    | 0x1C/7  |31~0: 环形缓存区大小           |      RW      | 以字节计, 须为8的倍数            |
+	|          |         |                               |              | 写该寄存器时清零写指针和回绕次数 |
+	--------------------------------------------------------------------------------------------------------
+	**/
+	reg en_trace_r; // 使能事件记录
+	reg flush_pending_r; // 冲刷等待标志
+	wire flush_fns; // 冲刷完成(指示)
+	reg[EVT_TYPE_N-1:0] evt_mask_r; // 事件类型掩码
+	reg[31:0] ring_baseaddr_r; // 环形缓存区基地址
+	reg[31:0] ring_len_r; // 环形缓存区大小
+	
+	// 使能事件记录
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			en_trace_r <= 1'b0;
+		else if(regs_en & regs_wen & (regs_addr == 4))
+			en_trace_r <= # SIM_DELAY regs_din[0];
+	end
+	
+	// 冲刷等待标志
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			flush_pending_r <= 1'b0;
+		else if(
+			(regs_en & regs_wen & (regs_addr == 4) & regs_din[1]) |
+			flush_fns
+		)
+			flush_pending_r <= # SIM_DELAY regs_en & regs_wen & (regs_addr == 4) & regs_din[1];
+	end
+	
+	// 事件类型掩码
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			evt_mask_r <= {EVT_TYPE_N{1'b1}};
+		else if(regs_en & regs_wen & (regs_addr == 5))
+			evt_mask_r <= # SIM_DELAY regs_din[EVT_TYPE_N-1:0];
+	end
+	
+	// 环形缓存区基地址
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ring_baseaddr_r <= 32'd0;
+		else if(regs_en & regs_wen & (regs_addr == 6))
+			ring_baseaddr_r <= # SIM_DELAY {regs_din[31:3], 3'b000};
+	end
+	
+	// 环形缓存区大小
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ring_len_r <= 32'd0;
+		else if(regs_en & regs_wen & (regs_addr == 7))
+			ring_len_r <= # SIM_DELAY {regs_din[31:3], 3'b000};
+	end
+	
+	/**
+	寄存器(sts0, sts1, sts2, sts3, sts4, sts5)
+	
+	--------------------------------------------------------------------------------------------------------
+	| sts0     | 0x20/8  |31~0: 写指针                   |      RO      | 下1个事件在环形缓存区中的偏移    |
+	|          |         |                               |              | (以字节计), 在写入完成后更新     |
+	--------------------------------------------------------------------------------------------------------
+	| sts1     | 0x24/9  |31~0: 回绕次数                 |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| sts2     | 0x28/10 |31~0: 丢弃的事件数             |      WC      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| sts3     | 0x2C/11 |0: 事件缓存空标志              |      RO      |                                  |
+	|          |         |1: 写入空闲标志                |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| sts4     | 0x30/12 |31~0: 当前时间戳的低32位       |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	| sts5     | 0x34/13 |7~0: 当前时间戳的高8位         |      RO      |                                  |
+	--------------------------------------------------------------------------------------------------------
+	**/
+	reg[31:0] ring_wptr_r; // 写指针
+	reg[31:0] ring_lap_n_r; // 回绕次数
+	reg[31:0] evt_drop_n_r; // 丢弃的事件数
+	wire evt_fifo_empty_r; // 事件缓存空标志
+	wire wr_idle_r; // 写入空闲标志
+	reg[39:0] timestamp_r; // 时间戳
+	
+	/** 时间戳 **/
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			timestamp_r <= 40'd0;
+		else
+			timestamp_r <= # SIM_DELAY timestamp_r + 1'b1;
+	end
+	
+	/** 层状态 **/
+	reg layer_active; // 层进行中(标志)
+	reg[1:0] layer_unit; // 当前层的处理单元
+	reg[17:0] layer_id; // 当前层的层号
+	reg layer_s2mm_issue_fns; // 本层的S2MM命令已全部发送(标志)
+	reg[15:0] s2mm_outstanding_n; // 已发送但未完成的S2MM命令数
+	wire on_conv_pool_start; // 卷积/池化层开始(指示)
+	wire on_layer_start; // 层开始(指示)
+	wire on_layer_end; // 层结束(指示)
+	wire[1:0] start_unit; // 新开始层的处理单元
+	
+	assign on_conv_pool_start = on_conv_start | on_pool_start;
+	// 逐元素操作在层进行中时不会再次开始
+	assign on_layer_start = on_conv_pool_start | (on_elm_start & (~layer_active));
+	assign on_layer_end =
+		layer_active &
+		(
+			on_conv_pool_start |
+			(layer_s2mm_issue_fns & (s2mm_outstanding_n == 16'd0))
+		);
+	assign start_unit =
+		on_conv_start ? UNIT_CONV:
+		on_pool_start ? UNIT_POOL:
+		                UNIT_ELM;
+	
+	// 层进行中(标志)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			layer_active <= 1'b0;
+		else if(on_layer_start | on_layer_end)
+			layer_active <= # SIM_DELAY on_layer_start;
+	end
+	
+	// 当前层的处理单元
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			layer_unit <= UNIT_CONV;
+		else if(on_layer_start)
+			layer_unit <= # SIM_DELAY start_unit;
+	end
+	
+	// 当前层的层号
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			layer_id <= 18'd0;
+		else if(on_layer_end)
+			layer_id <= # SIM_DELAY layer_id + 1'b1;
+	end
+	
+	// 本层的S2MM命令已全部发送(标志)
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			layer_s2mm_issue_fns <= 1'b0;
+		else if(on_layer_start | on_layer_end | on_s2mm_issue_fns)
+			layer_s2mm_issue_fns <= # SIM_DELAY
+				on_s2mm_issue_fns & ((~on_layer_start) | (on_elm_start & (~on_conv_pool_start)));
+	end
+	
+	// 已发送但未完成的S2MM命令数
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			s2mm_outstanding_n <= 16'd0;
+		else if(on_fnl_res_row_wr ^ on_fnl_res_row_wr_done)
+			s2mm_outstanding_n <= # SIM_DELAY
+				on_fnl_res_row_wr ?
+					(s2mm_outstanding_n + 1'b1):
+					(s2mm_outstanding_n - 1'b1);
+	end
+	
+	/**
+	事件捕获
+	
+	每种事件各有1个待写入标志, 在事件发生时锁存时间戳和事件参数,
+	每个周期把待写入的编码最小的事件写入事件缓存
+	**/
+	wire[EVT_TYPE_N-1:0] evt_trigger; // 事件触发(指示)
+	wire[EVT_TYPE_N*20-1:0] evt_arg; // 事件参数
+	reg[EVT_TYPE_N*20-1:0] evt_seq_id; // 本层内的事件序号
+	reg[EVT_TYPE_N-1:0] evt_pending; // 事件待写入(标志)
+	reg[EVT_TYPE_N*40-1:0] evt_pending_ts; // 待写入事件的时间戳
+	reg[EVT_TYPE_N*20-1:0] evt_pending_arg; // 待写入事件的参数
+	wire[EVT_TYPE_N-1:0] evt_pop_onehot; // 本周期写入事件缓存的事件(独热码)
+	wire[EVT_TYPE_N-1:0] evt_accept; // 接受新事件(指示)
+	wire[EVT_TYPE_N-1:0] evt_drop; // 丢弃新事件(指示)
+	wire evt_fifo_wen; // 事件缓存写使能
+	wire[63:0] evt_fifo_din; // 事件缓存写数据
+	wire evt_fifo_full_n; // 事件缓存满标志
+	
+	assign evt_trigger =
+		{EVT_TYPE_N{en_trace_r}} & evt_mask_r &
+		{
+			on_fnl_res_row_wr_done,
+			on_fnl_res_row_wr,
+			on_kernal_cgrp_load_done,
+			on_kernal_cgrp_load,
+			on_fmap_row_rplc,
+			on_fmap_row_load_done,
+			on_fmap_row_load,
+			on_kernal_set_start,
+			on_layer_start,
+			on_layer_end
+		};
+	
+	// 层开始与层结束事件的参数是{层号, 处理单元}, 其余事件的参数是本层内的序号
+	assign evt_arg[EVT_LAYER_END*20+:20] = {layer_id, layer_unit};
+	assign evt_arg[EVT_LAYER_START*20+:20] = {on_layer_end ? (layer_id + 1'b1):layer_id, start_unit};
+	
+	assign evt_pop_onehot = evt_pending & ((~evt_pending) + 1'b1) & {EVT_TYPE_N{evt_fifo_full_n}};
+	assign evt_accept = evt_trigger & ((~evt_pending) | evt_pop_onehot);
+	assign evt_drop = evt_trigger & evt_pending & (~evt_pop_onehot);
+	
+	assign evt_fifo_wen = |evt_pop_onehot;
+	
+	genvar evt_i;
+	generate
+		for(evt_i = 0;evt_i < EVT_TYPE_N;evt_i = evt_i + 1)
+		begin:evt_capture_blk
+			if((evt_i != EVT_LAYER_END) && (evt_i != EVT_LAYER_START))
+			begin
+				// 与层开始同时发生的事件属于新开始的层
+				assign evt_arg[evt_i*20+:20] = on_layer_start ? 20'd0:evt_seq_id[evt_i*20+:20];
+	
+				// 本层内的事件序号
+				always @(posedge aclk or negedge aresetn)
+				begin
+					if(~aresetn)
+						evt_seq_id[evt_i*20+:20] <= 20'd0;
+					else if(on_layer_start | evt_trigger[evt_i])
+						evt_seq_id[evt_i*20+:20] <= # SIM_DELAY evt_arg[evt_i*20+:20] + evt_trigger[evt_i];
+				end
+			end
+	
+			// 事件待写入(标志)
+			always @(posedge aclk or negedge aresetn)
+			begin
+				if(~aresetn)
+					evt_pending[evt_i] <= 1'b0;
+				else if(evt_trigger[evt_i] | evt_pop_onehot[evt_i])
+					evt_pending[evt_i] <= # SIM_DELAY evt_trigger[evt_i];
+			end
+	
+			// 待写入事件的时间戳, 待写入事件的参数
+			always @(posedge aclk)
+			begin
+				if(evt_accept[evt_i])
+					{evt_pending_arg[evt_i*20+:20], evt_pending_ts[evt_i*40+:40]} <= # SIM_DELAY
+						{evt_arg[evt_i*20+:20], timestamp_r};
+			end
+		end
+	endgenerate
+	
+	// 丢弃的事件数
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			evt_drop_n_r <= 32'd0;
+		else if((|evt_drop) | (regs_en & regs_wen & (regs_addr == 10)))
+			evt_drop_n_r <= # SIM_DELAY
+				(regs_en & regs_wen & (regs_addr == 10)) ?
+					32'd0:
+					(evt_drop_n_r + 1'b1);
+	end
+	
+	/** 事件缓存写数据 **/
+	reg[63:0] evt_fifo_din_mux; // 选出的待写入事件
+	
+	assign evt_fifo_din = evt_fifo_din_mux;
+	
+	always @(*)
+	begin:evt_fifo_din_mux_blk
+		integer i;
+	
+		evt_fifo_din_mux = 64'd0;
+	
+		for(i = 0;i < EVT_TYPE_N;i = i + 1)
+		begin
+			if(evt_pop_onehot[i])
+				evt_fifo_din_mux = evt_fifo_din_mux | {i[3:0], evt_pending_arg[i*20+:20], evt_pending_ts[i*40+:40]};
+		end
+	end
+	
+	/** 事件缓存 **/
+	wire evt_fifo_ren; // 事件缓存读使能
+	wire[63:0] evt_fifo_dout; // 事件缓存读数据
+	wire evt_fifo_empty_n; // 事件缓存空标志
+	wire[clogb2(EVT_FIFO_DEPTH):0] evt_fifo_data_cnt; // 事件缓存存储计数
+	
+	assign evt_fifo_empty_r = ~evt_fifo_empty_n;
+	
+	ram_fifo_wrapper #(
+		.fwft_mode("true"),
+		.ram_type("bram"),
+		.en_bram_reg("false"),
+		.fifo_depth(EVT_FIFO_DEPTH),
+		.fifo_data_width(64),
+		.full_assert_polarity("low"),
+		.empty_assert_polarity("low"),
+		.almost_full_assert_polarity("no"),
+		.almost_empty_assert_polarity("no"),
+		.en_data_cnt("true"),
+		.almost_full_th(),
+		.almost_empty_th(),
+		.simulation_delay(SIM_DELAY)
+	)evt_fifo_u(
+		.clk(aclk),
+		.rst_n(aresetn),
+	
+		.fifo_wen(evt_fifo_wen),
+		.fifo_din(evt_fifo_din),
+		.fifo_full_n(evt_fifo_full_n),
+	
+		.fifo_ren(evt_fifo_ren),
+		.fifo_dout(evt_fifo_dout),
+		.fifo_empty_n(evt_fifo_empty_n),
+	
+		.data_cnt(evt_fifo_data_cnt)
+	);
+	
+	/** 事件写出 **/
+	reg[3:0] wr_sts; // 写入状态
+	reg[7:0] wr_evt_n; // 本次写入的事件数
+	reg[7:0] wr_evt_id; // 本次写入的事件编号
+	wire[31:0] ring_space_evt_n; // 写指针到环形缓存区末尾可容纳的事件数
+	wire wr_start; // 开始写入(指示)
+	wire[31:0] ring_wptr_nxt; // 本次写入完成后的写指针
+	
+	assign m_trace_dma_cmd_axis_data = {13'd0, wr_evt_n, 3'b000, ring_baseaddr_r + ring_wptr_r};
+	assign m_trace_dma_cmd_axis_user = 1'b0;
+	assign m_trace_dma_cmd_axis_valid = wr_sts[WR_STS_CMD];
+	
+	assign m_axis_trace_data = evt_fifo_dout;
+	assign m_axis_trace_keep = 8'hff;
+	assign m_axis_trace_last = wr_evt_id == (wr_evt_n - 1'b1);
+	assign m_axis_trace_valid = wr_sts[WR_STS_DATA] & evt_fifo_empty_n;
+	
+	assign evt_fifo_ren = m_axis_trace_valid & m_axis_trace_ready;
+	
+	assign wr_idle_r = wr_sts[WR_STS_IDLE];
+	
+	assign ring_space_evt_n = (ring_len_r - ring_wptr_r) >> 3;
+	assign wr_start =
+		wr_sts[WR_STS_IDLE] & (ring_len_r != 32'd0) &
+		((evt_fifo_data_cnt >= BURST_EVT_N) | (flush_pending_r & evt_fifo_empty_n));
+	assign ring_wptr_nxt = ring_wptr_r + {21'd0, wr_evt_n, 3'b000};
+	
+	// 冲刷完成: 没有待写入的事件, 事件缓存为空且写入空闲
+	assign flush_fns = flush_pending_r & (~(|evt_pending)) & (~evt_fifo_empty_n) & wr_sts[WR_STS_IDLE];
+	
+	// 写入状态
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			wr_sts <= 4'b0001;
+		else if(
+			wr_start |
+			(wr_sts[WR_STS_CMD] & m_trace_dma_cmd_axis_ready) |
+			(wr_sts[WR_STS_DATA] & m_axis_trace_valid & m_axis_trace_ready & m_axis_trace_last) |
+			(wr_sts[WR_STS_WAIT] & trace_s2mm_cmd_done)
+		)
+			wr_sts <= # SIM_DELAY {wr_sts[2:0], wr_sts[3]};
+	end
+	
+	// 本次写入的事件数
+	always @(posedge aclk)
+	begin
+		if(wr_start)
+			wr_evt_n <= # SIM_DELAY
+				((evt_fifo_data_cnt >= BURST_EVT_N) & (ring_space_evt_n >= BURST_EVT_N)) ?
+					BURST_EVT_N:
+					(
+						(ring_space_evt_n < evt_fifo_data_cnt) ?
+							ring_space_evt_n[7:0]:
+							evt_fifo_data_cnt
+					);
+	end
+	
+	// 本次写入的事件编号
+	always @(posedge aclk)
+	begin
+		if(wr_start | (m_axis_trace_valid & m_axis_trace_ready))
+			wr_evt_id <= # SIM_DELAY
+				wr_start ?
+					8'd0:
+					(wr_evt_id + 1'b1);
+	end
+	
+	// 写指针
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ring_wptr_r <= 32'd0;
+		else if((regs_en & regs_wen & (regs_addr == 7)) | (wr_sts[WR_STS_WAIT] & trace_s2mm_cmd_done))
+			ring_wptr_r <= # SIM_DELAY
+				((regs_en & regs_wen & (regs_addr == 7)) | (ring_wptr_nxt == ring_len_r)) ?
+					32'd0:
+					ring_wptr_nxt;
+	end
+	
+	// 回绕次数
+	always @(posedge aclk or negedge aresetn)
+	begin
+		if(~aresetn)
+			ring_lap_n_r <= 32'd0;
+		else if(
+			(regs_en & regs_wen & (regs_addr == 7)) |
+			(wr_sts[WR_STS_WAIT] & trace_s2mm_cmd_done & (ring_wptr_nxt == ring_len_r))
+		)
+			ring_lap_n_r <= # SIM_DELAY
+				(regs_en & regs_wen & (regs_addr == 7)) ?
+					32'd0:
+					(ring_lap_n_r + 1'b1);
+	end
+	
+	/** 寄存器读结果 **/
+	always @(posedge aclk)
+	begin
+		if(regs_en & (~is_write))
+		begin
+			case(regs_addr)
+				0: regs_dout <= # SIM_DELAY {version_r[31:0]};
+				1: regs_dout <= # SIM_DELAY {acc_id_r[1:0], acc_type_r[29:0]};
+				2: regs_dout <= # SIM_DELAY {4'd0, evt_type_n_r[3:0], burst_evt_n_r[7:0], evt_fifo_depth_r[15:0]};
+	
+				4: regs_dout <= # SIM_DELAY {30'd0, flush_pending_r, en_trace_r};
+				5: regs_dout <= # SIM_DELAY {{(32-EVT_TYPE_N){1'b0}}, evt_mask_r};
+				6: regs_dout <= # SIM_DELAY {ring_baseaddr_r[31:0]};
+				7: regs_dout <= # SIM_DELAY {ring_len_r[31:0]};
+	
+				8: regs_dout <= # SIM_DELAY {ring_wptr_r[31:0]};
+				9: regs_dout <= # SIM_DELAY {ring_lap_n_r[31:0]};
+				10: regs_dout <= # SIM_DELAY {evt_drop_n_r[31:0]};
+				11: regs_dout <= # SIM_DELAY {30'd0, wr_idle_r, evt_fifo_empty_r};
+				12: regs_dout <= # SIM_DELAY {timestamp_r[31:0]};
+				13: regs_dout <= # SIM_DELAY {24'd0, timestamp_r[39:32]};
+	
+				default: regs_dout <= # SIM_DELAY 32'h0000_0000;
+			endcase
+		end
+	end
+	
+endmodule
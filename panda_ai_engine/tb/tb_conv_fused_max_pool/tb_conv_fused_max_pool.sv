@@ -0,0 +1,315 @@
+`timescale 1ns / 1ps
+
+module tb_conv_fused_max_pool();
+
+	/** 配置参数 **/
+	// 待测模块配置
+	localparam integer ATOMIC_K = 4; // 核并行数
+	localparam integer BUF_DEPTH = 64; // 行缓存深度
+	// 激励配置
+	localparam integer LAYER_N = 3; // 层数
+	// 时钟和复位配置
+	localparam real clk_p = 10.0; // 时钟周期
+	localparam real simulation_delay = 1.0; // 仿真延时
+
+	/** 每层的配置 **/
+	// 层号:              0       1       2
+	// 运算数据格式:      FP16    INT16   FP16(除能融合池化)
+	int layer_calfmt[LAYER_N] = '{2, 1, 2};
+	int layer_en[LAYER_N] = '{1, 1, 0};
+	int layer_w[LAYER_N] = '{7, 6, 3}; // 池化前的宽度
+	int layer_h[LAYER_N] = '{5, 4, 2}; // 池化前的高度
+	int layer_rgn_n[LAYER_N] = '{2, 1, 1}; // 输出通道域数
+	int layer_sub_row_n[LAYER_N] = '{3, 2, 2}; // 每个表面行的子表面行数
+
+	/** 时钟和复位 **/
+	reg clk;
+	reg rst_n;
+
+	initial
+	begin
+		clk <= 1'b1;
+
+		forever
+		begin
+			# (clk_p / 2) clk <= ~clk;
+		end
+	end
+
+	initial begin
+		rst_n <= 1'b0;
+
+		# (clk_p * 10 + simulation_delay);
+
+		rst_n <= 1'b1;
+	end
+
+	/** 待测模块 **/
+	// 运行时参数
+	reg en_fused_max_pool;
+	reg[1:0] calfmt;
+	reg[15:0] ofmap_w;
+	reg[15:0] ofmap_h;
+	// 池化前的最终结果(AXIS从机)
+	reg[ATOMIC_K*32-1:0] s_axis_data;
+	reg[ATOMIC_K*4-1:0] s_axis_keep;
+	reg[4:0] s_axis_user;
+	reg s_axis_last;
+	reg s_axis_valid;
+	wire s_axis_ready;
+	// 池化后的最终结果(AXIS主机)
+	wire[ATOMIC_K*32-1:0] m_axis_data;
+	wire[ATOMIC_K*4-1:0] m_axis_keep;
+	wire[4:0] m_axis_user;
+	wire m_axis_last;
+	wire m_axis_valid;
+	reg m_axis_ready;
+
+	conv_fused_max_pool #(
+		.ATOMIC_K(ATOMIC_K),
+		.BUF_DEPTH(BUF_DEPTH),
+		.SIM_DELAY(simulation_delay)
+	)dut(
+		.aclk(clk),
+		.aresetn(rst_n),
+
+		.en_fused_max_pool(en_fused_max_pool),
+		.calfmt(calfmt),
+		.ofmap_w(ofmap_w),
+		.ofmap_h(ofmap_h),
+
+		.s_axis_data(s_axis_data),
+		.s_axis_keep(s_axis_keep),
+		.s_axis_user(s_axis_user),
+		.s_axis_last(s_axis_last),
+		.s_axis_valid(s_axis_valid),
+		.s_axis_ready(s_axis_ready),
+
+		.m_axis_data(m_axis_data),
+		.m_axis_keep(m_axis_keep),
+		.m_axis_user(m_axis_user),
+		.m_axis_last(m_axis_last),
+		.m_axis_valid(m_axis_valid),
+		.m_axis_ready(m_axis_ready)
+	);
+
+	/** 参考模型 **/
+	typedef struct{
+		bit[ATOMIC_K*32-1:0] data;
+		bit[4:0] user;
+		bit last;
+	}Beat;
+
+	Beat exp_q[$]; // 期望的输出
+	int out_n; // 已检查的输出数
+	int err_n; // 错误数
+
+	// 返回a是否大于b
+	function automatic bit item_gt(input bit[31:0] a, input bit[31:0] b, input int fmt);
+		if(fmt == 2)
+			return $bitstoshortreal(a) > $bitstoshortreal(b);
+		else
+			return $signed(a) > $signed(b);
+	endfunction
+
+	function automatic bit[31:0] rand_item(input int fmt);
+		if(fmt == 2)
+			return $shortrealtobits(shortreal'(int'($urandom_range(0, 2000)) - 1000) / 7.0);
+		else
+			return $urandom_range(0, 2000) - 1000;
+	endfunction
+
+	/** 激励 **/
+	reg stim_done; // 激励完成(标志)
+
+	initial
+	begin
+		en_fused_max_pool <= 1'b0;
+		calfmt <= 2'b10;
+		ofmap_w <= 16'd0;
+		ofmap_h <= 16'd0;
+
+		s_axis_data <= {(ATOMIC_K*32){1'bx}};
+		s_axis_keep <= {(ATOMIC_K*4){1'bx}};
+		s_axis_user <= 5'bxxxxx;
+		s_axis_last <= 1'bx;
+		s_axis_valid <= 1'b0;
+
+		stim_done <= 1'b0;
+
+		repeat(10)
+		begin
+			@(posedge clk iff rst_n);
+		end
+
+		for(int l = 0;l < LAYER_N;l++)
+		begin
+			automatic int w = layer_w[l];
+			automatic int h = layer_h[l];
+			automatic bit[ATOMIC_K*32-1:0] fm[][][][]; // [输出通道域][y][子表面行][x]
+
+			en_fused_max_pool <= # simulation_delay layer_en[l];
+			calfmt <= # simulation_delay layer_calfmt[l];
+			ofmap_w <= # simulation_delay w - 1;
+			ofmap_h <= # simulation_delay h - 1;
+
+			@(posedge clk iff rst_n);
+
+			// 生成池化前的输出特征图
+			fm = new[layer_rgn_n[l]];
+
+			for(int r = 0;r < layer_rgn_n[l];r++)
+			begin
+				fm[r] = new[h];
+
+				for(int y = 0;y < h;y++)
+				begin
+					fm[r][y] = new[layer_sub_row_n[l]];
+
+					for(int s = 0;s < layer_sub_row_n[l];s++)
+					begin
+						fm[r][y][s] = new[w];
+
+						for(int x = 0;x < w;x++)
+						begin
+							for(int k = 0;k < ATOMIC_K;k++)
+								fm[r][y][s][x][k*32+:32] = rand_item(layer_calfmt[l]);
+						end
+					end
+				end
+			end
+
+			// 计算期望的输出
+			for(int r = 0;r < layer_rgn_n[l];r++)
+			begin
+				for(int y = 0;y < h;y++)
+				begin
+					for(int s = 0;s < layer_sub_row_n[l];s++)
+					begin
+						if(!layer_en[l])
+						begin
+							for(int x = 0;x < w;x++)
+							begin
+								automatic Beat b;
+
+								b.data = fm[r][y][s][x];
+								b.user = {s == (layer_sub_row_n[l] - 1), 4'(s)};
+								b.last = x == (w - 1);
+								exp_q.push_back(b);
+							end
+						end
+						else if((y % 2) == 1)
+						begin
+							for(int x = 0;x < w / 2;x++)
+							begin
+								automatic Beat b;
+
+								for(int k = 0;k < ATOMIC_K;k++)
+								begin
+									automatic bit[31:0] m = fm[r][y - 1][s][x * 2][k*32+:32];
+
+									if(item_gt(fm[r][y - 1][s][x * 2 + 1][k*32+:32], m, layer_calfmt[l]))
+										m = fm[r][y - 1][s][x * 2 + 1][k*32+:32];
+									if(item_gt(fm[r][y][s][x * 2][k*32+:32], m, layer_calfmt[l]))
+										m = fm[r][y][s][x * 2][k*32+:32];
+									if(item_gt(fm[r][y][s][x * 2 + 1][k*32+:32], m, layer_calfmt[l]))
+										m = fm[r][y][s][x * 2 + 1][k*32+:32];
+
+									b.data[k*32+:32] = m;
+								end
+
+								b.user = {s == (layer_sub_row_n[l] - 1), 4'(s)};
+								b.last = x == (w / 2 - 1);
+								exp_q.push_back(b);
+							end
+						end
+					end
+				end
+			end
+
+			// 发送池化前的输出特征图
+			for(int r = 0;r < layer_rgn_n[l];r++)
+			begin
+				for(int y = 0;y < h;y++)
+				begin
+					for(int s = 0;s < layer_sub_row_n[l];s++)
+					begin
+						for(int x = 0;x < w;x++)
+						begin
+							s_axis_data <= # simulation_delay fm[r][y][s][x];
+							s_axis_keep <= # simulation_delay {(ATOMIC_K*4){1'b1}};
+							s_axis_user <= # simulation_delay {s == (layer_sub_row_n[l] - 1), 4'(s)};
+							s_axis_last <= # simulation_delay x == (w - 1);
+							s_axis_valid <= # simulation_delay ($urandom_range(0, 3) != 0);
+
+							@(posedge clk iff (rst_n & s_axis_valid & s_axis_ready));
+						end
+					end
+				end
+			end
+
+			s_axis_valid <= # simulation_delay 1'b0;
+
+			// 等待本层的输出全部被检查
+			wait(exp_q.size() == 0);
+
+			repeat(5)
+			begin
+				@(posedge clk iff rst_n);
+			end
+		end
+
+		stim_done <= 1'b1;
+	end
+
+	/** 输出检查 **/
+	initial
+	begin
+		m_axis_ready <= 1'b0;
+		out_n = 0;
+		err_n = 0;
+
+		forever
+		begin
+			// 模拟输出的反压
+			m_axis_ready <= # simulation_delay ($urandom_range(0, 2) != 0);
+
+			@(posedge clk iff rst_n);
+
+			if(m_axis_valid & m_axis_ready)
+			begin
+				if(exp_q.size() == 0)
+				begin
+					$error("多余的输出");
+					err_n++;
+				end
+				else
+				begin
+					automatic Beat b = exp_q.pop_front();
+
+					if((m_axis_data != b.data) || (m_axis_user != b.user) || (m_axis_last != b.last))
+					begin
+						$error("输出#%0d不一致: data = %h/%h, user = %h/%h, last = %b/%b",
+							out_n, m_axis_data, b.data, m_axis_user, b.user, m_axis_last, b.last);
+						err_n++;
+					end
+
+					out_n++;
+				end
+			end
+		end
+	end
+
+	initial
+	begin
+		@(posedge clk iff stim_done);
+
+		$display("共检查%0d个输出", out_n);
+
+		if(err_n == 0)
+			$display("检查通过");
+
+		$stop();
+	end
+
+endmodule
@@ -0,0 +1,556 @@
+`timescale 1ns / 1ps
+
+module tb_conv_residual_add();
+
+	/** 配置参数 **/
+	// 待测模块配置
+	localparam integer ATOMIC_K = 4; // 核并行数
+	localparam integer MM2S_STREAM_DATA_WIDTH = 64; // MM2S通道DMA数据流的位宽
+	// 激励配置
+	localparam integer LAYER_N = 5; // 层数
+	localparam bit[31:0] OFMAP_BASEADDR = 32'h0001_0000; // 输出特征图基地址
+	localparam bit[31:0] RESIDUAL_BASEADDR = 32'h0000_0100; // 残差特征图基地址
+	// 时钟和复位配置
+	localparam real clk_p = 10.0; // 时钟周期
+	localparam real simulation_delay = 1.0; // 仿真延时
+
+	/** 每层的配置 **/
+	// 层号:                  0       1       2       3       4
+	// 运算数据格式:          FP16    FP16    INT16   INT8    INT16(除能残差相加)
+	// 输出数据大小类型:      4B      2B      2B      1B      4B
+	int layer_calfmt[LAYER_N] = '{2, 2, 1, 0, 1};
+	int layer_ofmap_data_type[LAYER_N] = '{2, 1, 1, 0, 2};
+	int layer_en[LAYER_N] = '{1, 1, 1, 1, 0};
+	int layer_relu[LAYER_N] = '{0, 1, 0, 1, 0};
+	int layer_scale_exp[LAYER_N] = '{0, -2, 3, -1, 0};
+	int layer_w[LAYER_N] = '{5, 3, 7, 6, 4};
+	int layer_sub_row_n[LAYER_N] = '{6, 4, 3, 5, 2}; // 子表面行数
+
+	/** 时钟和复位 **/
+	reg clk;
+	reg rst_n;
+
+	initial
+	begin
+		clk <= 1'b1;
+
+		forever
+		begin
+			# (clk_p / 2) clk <= ~clk;
+		end
+	end
+
+	initial begin
+		rst_n <= 1'b0;
+
+		# (clk_p * 10 + simulation_delay);
+
+		rst_n <= 1'b1;
+	end
+
+	/** 待测模块 **/
+	// 运行时参数
+	reg en_residual_add;
+	reg residual_relu;
+	reg[5:0] residual_scale_exp;
+	reg[1:0] calfmt;
+	reg[1:0] ofmap_data_type;
+	// 最终结果传输请求(AXIS从机)
+	reg[55:0] s_fnl_res_cmd_axis_data;
+	reg[24:0] s_fnl_res_cmd_axis_user;
+	reg s_fnl_res_cmd_axis_valid;
+	wire s_fnl_res_cmd_axis_ready;
+	// 最终结果传输请求(AXIS主机)
+	wire[55:0] m_fnl_res_cmd_axis_data;
+	wire[24:0] m_fnl_res_cmd_axis_user;
+	wire m_fnl_res_cmd_axis_valid;
+	reg m_fnl_res_cmd_axis_ready;
+	// 残差DMA(MM2S方向)命令流(AXIS主机)
+	wire[55:0] m_res_dma_cmd_axis_data;
+	wire m_res_dma_cmd_axis_user;
+	wire m_res_dma_cmd_axis_last;
+	wire m_res_dma_cmd_axis_valid;
+	reg m_res_dma_cmd_axis_ready;
+	// 残差DMA(MM2S方向)数据流(AXIS从机)
+	reg[MM2S_STREAM_DATA_WIDTH-1:0] s_res_dma_strm_axis_data;
+	reg[MM2S_STREAM_DATA_WIDTH/8-1:0] s_res_dma_strm_axis_keep;
+	reg s_res_dma_strm_axis_last;
+	reg s_res_dma_strm_axis_valid;
+	wire s_res_dma_strm_axis_ready;
+	// 相加前的最终结果(AXIS从机)
+	reg[ATOMIC_K*32-1:0] s_axis_data;
+	reg[ATOMIC_K*4-1:0] s_axis_keep;
+	reg[4:0] s_axis_user;
+	reg s_axis_last;
+	reg s_axis_valid;
+	wire s_axis_ready;
+	// 相加后的最终结果(AXIS主机)
+	wire[ATOMIC_K*32-1:0] m_axis_data;
+	wire[ATOMIC_K*4-1:0] m_axis_keep;
+	wire[4:0] m_axis_user;
+	wire m_axis_last;
+	wire m_axis_valid;
+	reg m_axis_ready;
+
+	conv_residual_add #(
+		.ATOMIC_K(ATOMIC_K),
+		.MM2S_STREAM_DATA_WIDTH(MM2S_STREAM_DATA_WIDTH),
+		.SIM_DELAY(simulation_delay)
+	)dut(
+		.aclk(clk),
+		.aresetn(rst_n),
+
+		.en_residual_add(en_residual_add),
+		.residual_relu(residual_relu),
+		.residual_scale_exp(residual_scale_exp),
+		.calfmt(calfmt),
+		.ofmap_data_type(ofmap_data_type),
+		.ofmap_baseaddr(OFMAP_BASEADDR),
+		.residual_baseaddr(RESIDUAL_BASEADDR),
+
+		.s_fnl_res_cmd_axis_data(s_fnl_res_cmd_axis_data),
+		.s_fnl_res_cmd_axis_user(s_fnl_res_cmd_axis_user),
+		.s_fnl_res_cmd_axis_valid(s_fnl_res_cmd_axis_valid),
+		.s_fnl_res_cmd_axis_ready(s_fnl_res_cmd_axis_ready),
+		.m_fnl_res_cmd_axis_data(m_fnl_res_cmd_axis_data),
+		.m_fnl_res_cmd_axis_user(m_fnl_res_cmd_axis_user),
+		.m_fnl_res_cmd_axis_valid(m_fnl_res_cmd_axis_valid),
+		.m_fnl_res_cmd_axis_ready(m_fnl_res_cmd_axis_ready),
+
+		.m_res_dma_cmd_axis_data(m_res_dma_cmd_axis_data),
+		.m_res_dma_cmd_axis_user(m_res_dma_cmd_axis_user),
+		.m_res_dma_cmd_axis_last(m_res_dma_cmd_axis_last),
+		.m_res_dma_cmd_axis_valid(m_res_dma_cmd_axis_valid),
+		.m_res_dma_cmd_axis_ready(m_res_dma_cmd_axis_ready),
+		.s_res_dma_strm_axis_data(s_res_dma_strm_axis_data),
+		.s_res_dma_strm_axis_keep(s_res_dma_strm_axis_keep),
+		.s_res_dma_strm_axis_last(s_res_dma_strm_axis_last),
+		.s_res_dma_strm_axis_valid(s_res_dma_strm_axis_valid),
+		.s_res_dma_strm_axis_ready(s_res_dma_strm_axis_ready),
+
+		.s_axis_data(s_axis_data),
+		.s_axis_keep(s_axis_keep),
+		.s_axis_user(s_axis_user),
+		.s_axis_last(s_axis_last),
+		.s_axis_valid(s_axis_valid),
+		.s_axis_ready(s_axis_ready),
+
+		.m_axis_data(m_axis_data),
+		.m_axis_keep(m_axis_keep),
+		.m_axis_user(m_axis_user),
+		.m_axis_last(m_axis_last),
+		.m_axis_valid(m_axis_valid),
+		.m_axis_ready(m_axis_ready)
+	);
+
+	/** 参考模型 **/
+	typedef struct{
+		bit[ATOMIC_K*32-1:0] data;
+		bit[4:0] user;
+		bit last;
+	}Beat;
+
+	typedef struct{
+		bit[31:0] addr;
+		int byte_n;
+	}Cmd;
+
+	Beat exp_q[$]; // 期望的输出
+	Cmd exp_fnl_cmd_q[$]; // 期望的最终结果传输请求
+	Cmd exp_res_cmd_q[$]; // 期望的残差读命令
+	Cmd res_cmd_q[$]; // 待响应的残差读命令
+	bit[7:0] res_mem[bit[31:0]]; // 残差特征图存储器
+	int out_n; // 已检查的输出数
+	int err_n; // 错误数
+
+	// 数据大小类型对应的字节数
+	function automatic int item_byte_n(input int data_type);
+		return (data_type == 0) ? 1:((data_type == 1) ? 2:4);
+	endfunction
+
+	// 生成随机的最终结果
+	function automatic bit[31:0] rand_fnl_item(input int fmt, input int data_type);
+		if(fmt == 2)
+			return $shortrealtobits(shortreal'(int'($urandom_range(0, 2000)) - 1000) / 7.0);
+		else if(data_type == 0)
+			return $urandom_range(0, 255) - 128;
+		else
+			return $urandom_range(0, 60000) - 30000;
+	endfunction
+
+	// 生成随机的残差(按输出数据大小类型存储)
+	function automatic bit[31:0] rand_res_item(input int fmt, input int data_type);
+		if(fmt == 2)
+		begin
+			if(data_type == 1)
+				return {$urandom_range(0, 1), 5'($urandom_range(8, 22)), 10'($urandom())}; // FP16
+			else
+				return $shortrealtobits(shortreal'(int'($urandom_range(0, 2000)) - 1000) / 3.0);
+		end
+		else if(data_type == 0)
+			return $urandom_range(0, 255);
+		else if(data_type == 1)
+			return $urandom_range(0, 65535);
+		else
+			return $urandom();
+	endfunction
+
+	// 计算缩放后的残差(FP)
+	function automatic real res_fp_value(input bit[31:0] item, input int data_type, input int scale_exp);
+		real v;
+
+		if(data_type == 1)
+			v = (1.0 + real'(item[9:0]) / 1024.0) * (2.0 ** (int'(item[14:10]) - 15)) * (item[15] ? -1.0:1.0);
+		else
+			v = $bitstoshortreal(item);
+
+		return v * (2.0 ** scale_exp);
+	endfunction
+
+	// 计算缩放后的残差(定点)
+	function automatic longint res_int_value(input bit[31:0] item, input int data_type, input int scale_exp);
+		longint v;
+
+		if(data_type == 0)
+			v = $signed(item[7:0]);
+		else if(data_type == 1)
+			v = $signed(item[15:0]);
+		else
+			v = $signed(item);
+
+		if(scale_exp >= 0)
+			return longint'(int'(v << scale_exp));
+		else
+			return v >>> (-scale_exp);
+	endfunction
+
+	// 计算相加后的结果
+	function automatic bit[31:0] add_item(input bit[31:0] fnl, input bit[31:0] res, input int l);
+		bit[31:0] sum;
+
+		if(layer_calfmt[l] == 2)
+		begin
+			shortreal s;
+
+			s = shortreal'(real'($bitstoshortreal(fnl)) + res_fp_value(res, layer_ofmap_data_type[l], layer_scale_exp[l]));
+			sum = $shortrealtobits(s);
+
+			if(sum == 32'h8000_0000)
+				sum = 32'h0000_0000;
+		end
+		else
+		begin
+			longint s;
+
+			s = longint'($signed(fnl)) + res_int_value(res, layer_ofmap_data_type[l], layer_scale_exp[l]);
+
+			if(s > 64'sh7FFF_FFFF)
+				s = 64'sh7FFF_FFFF;
+			else if(s < -64'sh8000_0000)
+				s = -64'sh8000_0000;
+
+			sum = s[31:0];
+		end
+
+		if(layer_relu[l] && sum[31])
+			sum = 32'h0000_0000;
+
+		return sum;
+	endfunction
+
+	/** 激励 **/
+	reg stim_done; // 激励完成(标志)
+	reg[23:0] cmd_id; // 命令ID
+
+	initial
+	begin
+		en_residual_add <= 1'b0;
+		residual_relu <= 1'b0;
+		residual_scale_exp <= 6'd0;
+		calfmt <= 2'b10;
+		ofmap_data_type <= 2'b10;
+
+		s_fnl_res_cmd_axis_data <= 56'dx;
+		s_fnl_res_cmd_axis_user <= 25'dx;
+		s_fnl_res_cmd_axis_valid <= 1'b0;
+
+		s_axis_data <= {(ATOMIC_K*32){1'bx}};
+		s_axis_keep <= {(ATOMIC_K*4){1'bx}};
+		s_axis_user <= 5'bxxxxx;
+		s_axis_last <= 1'bx;
+		s_axis_valid <= 1'b0;
+
+		stim_done <= 1'b0;
+		cmd_id = 24'd0;
+
+		repeat(10)
+		begin
+			@(posedge clk iff rst_n);
+		end
+
+		for(int l = 0;l < LAYER_N;l++)
+		begin
+			automatic int w = layer_w[l];
+			automatic int ibn = item_byte_n(layer_ofmap_data_type[l]);
+			automatic int row_byte_n = w * ATOMIC_K * ibn;
+			automatic bit[ATOMIC_K*32-1:0] fm[][]; // [子表面行][x]
+
+			en_residual_add <= # simulation_delay layer_en[l];
+			residual_relu <= # simulation_delay layer_relu[l];
+			residual_scale_exp <= # simulation_delay layer_scale_exp[l];
+			calfmt <= # simulation_delay layer_calfmt[l];
+			ofmap_data_type <= # simulation_delay layer_ofmap_data_type[l];
+
+			@(posedge clk iff rst_n);
+
+			fm = new[layer_sub_row_n[l]];
+
+			// 生成输出特征图和残差特征图, 计算期望的输出
+			for(int s = 0;s < layer_sub_row_n[l];s++)
+			begin
+				automatic Cmd c;
+
+				fm[s] = new[w];
+
+				c.addr = OFMAP_BASEADDR + s * row_byte_n;
+				c.byte_n = row_byte_n;
+				exp_fnl_cmd_q.push_back(c);
+
+				if(layer_en[l])
+				begin
+					c.addr = RESIDUAL_BASEADDR + s * row_byte_n;
+					exp_res_cmd_q.push_back(c);
+				end
+
+				for(int x = 0;x < w;x++)
+				begin
+					automatic Beat b;
+
+					for(int k = 0;k < ATOMIC_K;k++)
+					begin
+						automatic bit[31:0] res = rand_res_item(layer_calfmt[l], layer_ofmap_data_type[l]);
+						automatic bit[31:0] item_addr = RESIDUAL_BASEADDR + s * row_byte_n + (x * ATOMIC_K + k) * ibn;
+
+						fm[s][x][k*32+:32] = rand_fnl_item(layer_calfmt[l], layer_ofmap_data_type[l]);
+
+						for(int i = 0;i < ibn;i++)
+							res_mem[item_addr + i] = res[i*8+:8];
+
+						b.data[k*32+:32] = layer_en[l] ? add_item(fm[s][x][k*32+:32], res, l):fm[s][x][k*32+:32];
+					end
+
+					b.user = {s == (layer_sub_row_n[l] - 1), 4'(s % 16)};
+					b.last = x == (w - 1);
+					exp_q.push_back(b);
+				end
+			end
+
+			// 发送最终结果传输请求和相加前的最终结果
+			for(int s = 0;s < layer_sub_row_n[l];s++)
+			begin
+				s_fnl_res_cmd_axis_data <= # simulation_delay {24'(row_byte_n), OFMAP_BASEADDR + s * row_byte_n};
+				s_fnl_res_cmd_axis_user <= # simulation_delay {cmd_id, 1'b0};
+				s_fnl_res_cmd_axis_valid <= # simulation_delay 1'b1;
+
+				@(posedge clk iff (rst_n & s_fnl_res_cmd_axis_valid & s_fnl_res_cmd_axis_ready));
+
+				s_fnl_res_cmd_axis_valid <= # simulation_delay 1'b0;
+				cmd_id = cmd_id + 24'd1;
+
+				for(int x = 0;x < w;x++)
+				begin
+					s_axis_data <= # simulation_delay fm[s][x];
+					s_axis_keep <= # simulation_delay {(ATOMIC_K*4){1'b1}};
+					s_axis_user <= # simulation_delay {s == (layer_sub_row_n[l] - 1), 4'(s % 16)};
+					s_axis_last <= # simulation_delay x == (w - 1);
+					s_axis_valid <= # simulation_delay ($urandom_range(0, 3) != 0);
+
+					@(posedge clk iff (rst_n & s_axis_valid & s_axis_ready));
+				end
+
+				s_axis_valid <= # simulation_delay 1'b0;
+			end
+
+			// 等待本层的输出全部被检查
+			wait((exp_q.size() == 0) && (exp_fnl_cmd_q.size() == 0) && (exp_res_cmd_q.size() == 0));
+
+			repeat(5)
+			begin
+				@(posedge clk iff rst_n);
+			end
+		end
+
+		stim_done <= 1'b1;
+	end
+
+	/** 残差DMA **/
+	// 命令
+	initial
+	begin
+		m_res_dma_cmd_axis_ready <= 1'b0;
+
+		forever
+		begin
+			m_res_dma_cmd_axis_ready <= # simulation_delay ($urandom_range(0, 2) != 0);
+
+			@(posedge clk iff rst_n);
+
+			if(m_res_dma_cmd_axis_valid & m_res_dma_cmd_axis_ready)
+			begin
+				automatic Cmd c;
+
+				c.addr = m_res_dma_cmd_axis_data[31:0];
+				c.byte_n = m_res_dma_cmd_axis_data[55:32];
+
+				if(exp_res_cmd_q.size() == 0)
+				begin
+					$error("多余的残差读命令");
+					err_n++;
+				end
+				else
+				begin
+					automatic Cmd e = exp_res_cmd_q.pop_front();
+
+					if((c.addr != e.addr) || (c.byte_n != e.byte_n))
+					begin
+						$error("残差读命令不一致: addr = %h/%h, byte_n = %0d/%0d", c.addr, e.addr, c.byte_n, e.byte_n);
+						err_n++;
+					end
+				end
+
+				res_cmd_q.push_back(c);
+			end
+		end
+	end
+
+	// 数据
+	initial
+	begin
+		s_res_dma_strm_axis_data <= {MM2S_STREAM_DATA_WIDTH{1'bx}};
+		s_res_dma_strm_axis_keep <= {(MM2S_STREAM_DATA_WIDTH/8){1'bx}};
+		s_res_dma_strm_axis_last <= 1'bx;
+		s_res_dma_strm_axis_valid <= 1'b0;
+
+		forever
+		begin
+			@(posedge clk iff (rst_n & (res_cmd_q.size() > 0)));
+
+			begin
+				automatic Cmd c = res_cmd_q.pop_front();
+
+				for(int ofs = 0;ofs < c.byte_n;ofs += MM2S_STREAM_DATA_WIDTH/8)
+				begin
+					automatic bit[MM2S_STREAM_DATA_WIDTH-1:0] d = {MM2S_STREAM_DATA_WIDTH{1'bx}};
+					automatic bit[MM2S_STREAM_DATA_WIDTH/8-1:0] k = 0;
+
+					for(int i = 0;(i < MM2S_STREAM_DATA_WIDTH/8) && ((ofs + i) < c.byte_n);i++)
+					begin
+						d[i*8+:8] = res_mem[c.addr + ofs + i];
+						k[i] = 1'b1;
+					end
+
+					s_res_dma_strm_axis_data <= # simulation_delay d;
+					s_res_dma_strm_axis_keep <= # simulation_delay k;
+					s_res_dma_strm_axis_last <= # simulation_delay (ofs + MM2S_STREAM_DATA_WIDTH/8) >= c.byte_n;
+					s_res_dma_strm_axis_valid <= # simulation_delay ($urandom_range(0, 2) != 0);
+
+					do
+					begin
+						@(posedge clk iff rst_n);
+
+						if(~s_res_dma_strm_axis_valid)
+							s_res_dma_strm_axis_valid <= # simulation_delay ($urandom_range(0, 2) != 0);
+					end
+					while(~(s_res_dma_strm_axis_valid & s_res_dma_strm_axis_ready));
+				end
+
+				s_res_dma_strm_axis_valid <= # simulation_delay 1'b0;
+			end
+		end
+	end
+
+	/** 输出检查 **/
+	// 最终结果传输请求
+	initial
+	begin
+		m_fnl_res_cmd_axis_ready <= 1'b0;
+
+		forever
+		begin
+			m_fnl_res_cmd_axis_ready <= # simulation_delay ($urandom_range(0, 2) != 0);
+
+			@(posedge clk iff rst_n);
+
+			if(m_fnl_res_cmd_axis_valid & m_fnl_res_cmd_axis_ready)
+			begin
+				if(exp_fnl_cmd_q.size() == 0)
+				begin
+					$error("多余的最终结果传输请求");
+					err_n++;
+				end
+				else
+				begin
+					automatic Cmd e = exp_fnl_cmd_q.pop_front();
+
+					if((m_fnl_res_cmd_axis_data[31:0] != e.addr) || (m_fnl_res_cmd_axis_data[55:32] != e.byte_n))
+					begin
+						$error("最终结果传输请求不一致: addr = %h/%h, byte_n = %0d/%0d",
+							m_fnl_res_cmd_axis_data[31:0], e.addr, m_fnl_res_cmd_axis_data[55:32], e.byte_n);
+						err_n++;
+					end
+				end
+			end
+		end
+	end
+
+	// 相加后的最终结果
+	initial
+	begin
+		m_axis_ready <= 1'b0;
+		out_n = 0;
+		err_n = 0;
+
+		forever
+		begin
+			// 模拟输出的反压
+			m_axis_ready <= # simulation_delay ($urandom_range(0, 2) != 0);
+
+			@(posedge clk iff rst_n);
+
+			if(m_axis_valid & m_axis_ready)
+			begin
+				if(exp_q.size() == 0)
+				begin
+					$error("多余的输出");
+					err_n++;
+				end
+				else
+				begin
+					automatic Beat b = exp_q.pop_front();
+
+					if((m_axis_data != b.data) || (m_axis_user != b.user) || (m_axis_last != b.last))
+					begin
+						$error("输出#%0d不一致: data = %h/%h, user = %h/%h, last = %b/%b",
+							out_n, m_axis_data, b.data, m_axis_user, b.user, m_axis_last, b.last);
+						err_n++;
+					end
+
+					out_n++;
+				end
+			end
+		end
+	end
+
+	initial
+	begin
+		@(posedge clk iff stim_done);
+
+		$display("共检查%0d个输出", out_n);
+
+		if(err_n == 0)
+			$display("检查通过");
+
+		$stop();
+	end
+
+endmodule
@@ -0,0 +1,69 @@
+#!/bin/bash
+# 用Verilator编译panda_ai_engine, 并与仿真平台和未经修改的卷积/池化/逐元素操作驱动链接为sim_main
+# 用法: ./build.sh [额外的verilator参数]
+#     例如: ./build.sh -GATOMIC_N=4 --trace
+#     修改时钟倍率相关的顶层参数时, 须同时修改sim_main.c中的PandaSimCfg
+#     驱动以回调函数作为寄存器访问后端(定义*_MMIO_CB), 由仿真平台的MMIO回调函数转为总线读写
+# 注意: 可执行文件以-no-pie链接(DMA模型直接以总线地址访问主机存储器)
+
+set -e
+
+cd "$(dirname "$0")"
+
+ROOT=../../..
+OBJ=obj_dir
+TRACE=0
+DRV_DEF="-DAXI_GNR_CONV_MMIO_CB -DAXI_GNR_POOL_MMIO_CB -DAXI_ELM_WISE_PROC_MMIO_CB -DPANDA_AI_TRACE_MMIO_CB"
+
+for arg in "$@"; do
+	if [ "$arg" = "--trace" ]; then
+		TRACE=1
+	fi
+done
+
+# 收集RTL源文件
+# 同名文件只取靠前目录中的(卷积单元中的副本比池化单元中的更新)
+# fifo_base_on_ram.v中的模块名与文件名不同, 因此给出文件列表而不用-y搜索
+DIRS="panda_ai_engine panda_ai_engine/sub_module \
+	axi_generic_conv/sub_module axi_generic_conv/common axi_generic_conv/generic \
+	axi_generic_pool/sub_module axi_generic_pool/common axi_generic_pool/generic \
+	axi_element_wise_proc/sub_module axi_element_wise_proc/common axi_element_wise_proc/generic"
+
+: > filelist.f
+for d in $DIRS; do
+	for f in $ROOT/$d/*.v; do
+		if ! grep -q "/$(basename $f)\$" filelist.f; then
+			echo "$f" >> filelist.f
+		fi
+	done
+done
+
+# 编译RTL模型(库)
+verilator --cc --build -j 0 -O3 --no-timing \
+	-Wno-fatal -Wno-lint -Wno-style -Wno-STMTDLY -Wno-MULTITOP \
+	--top-module panda_ai_engine -Mdir $OBJ -f filelist.f "$@"
+
+VROOT=$(verilator --getenv VERILATOR_ROOT)
+
+# 编译仿真平台
+g++ -O2 -std=c++14 -DVM_TRACE=$TRACE -I$OBJ -I$VROOT/include -I$VROOT/include/vltstd \
+	-c panda_sim.cpp -o $OBJ/panda_sim.o
+
+# 编译驱动和示例
+DRV_SRC="$ROOT/axi_generic_conv/software/axi_generic_conv.c \
+	$ROOT/axi_generic_conv/software/axi_generic_conv_ref_model.c \
+	$ROOT/axi_generic_pool/software/axi_generic_pool.c \
+	$ROOT/axi_element_wise_proc/software/axi_element_wise_proc.c \
+	$ROOT/panda_ai_engine/software/panda_ai_trace.c \
+	sim_main.c"
+DRV_OBJ=""
+
+for f in $DRV_SRC; do
+	o=$OBJ/drv_$(basename $f .c).o
+
+	gcc -O2 -std=gnu99 $DRV_DEF -c $f -o $o
+	DRV_OBJ="$DRV_OBJ $o"
+done
+
+# 链接
+g++ -no-pie -o sim_main $DRV_OBJ $OBJ/panda_sim.o $OBJ/Vpanda_ai_engine__ALL.a $OBJ/libverilated.a -pthread -lm
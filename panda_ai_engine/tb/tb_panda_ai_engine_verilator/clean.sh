@@ -0,0 +1,3 @@
+#!/bin/bash
+cd "$(dirname "$0")"
+rm -rf obj_dir filelist.f sim_main *.vcd
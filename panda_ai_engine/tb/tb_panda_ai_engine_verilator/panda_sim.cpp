@@ -0,0 +1,1053 @@
+/************************************************************************************************************************
+大胖达AI引擎Verilator仿真平台
+@brief  驱动Verilator生成的panda_ai_engine模型(Vpanda_ai_engine), 包括:
+            时钟与复位: 各时钟按相对于主时钟的整数倍率同相产生
+            AXI-Lite主机: 访问卷积/池化/逐元素操作/事件跟踪单元的寄存器区
+            AXI主机: 以单次传输访问BN参数与Sigmoid函数值查找表存储器
+            DMA模型: 2个MM2S通道, 1个S2MM通道和事件跟踪S2MM通道, 按命令以总线地址直接访问主机存储器
+            MMIO回调: 驱动以回调函数作为寄存器访问后端, 按地址所在的寄存器区/存储器区转为总线读写
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 增加MMIO回调函数(驱动的回调寄存器访问后端)
+        2026.10.17 1.02 增加残差DMA(MM2S)通道模型
+        2026.10.17 1.03 去掉以SIGSEGV + 单步(SIGTRAP)拦截驱动访存的MMIO shim, 驱动统一通过MMIO回调访问加速器
+************************************************************************************************************************/
+
+#include "panda_sim.h"
+
+#include "Vpanda_ai_engine.h"
+#include "verilated.h"
+#if VM_TRACE
+#include "verilated_vcd_c.h"
+#endif
+
+#include <deque>
+#include <type_traits>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if !defined(__linux__)
+#error "panda_sim only supports Linux"
+#endif
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 复位保持的主时钟周期数
+#define PANDA_SIM_RST_CYCLE_N 16
+// 单次总线传输的超时周期数
+#define PANDA_SIM_BUS_TIMEOUT_CYCLE_N 4096
+
+// MMIO区的个数
+#define PANDA_SIM_MMIO_WIN_N 5
+// BN参数存储器区所用的总线主机编号
+#define PANDA_SIM_MEM_MST_ID 4
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 总线主机(AXI-Lite或单次传输的AXI)
+typedef struct{
+	IData* awaddr;
+	CData* awvalid;
+	CData* awready;
+	CData* bvalid;
+	CData* bready;
+	IData* araddr;
+	CData* arvalid;
+	CData* arready;
+	IData* rdata;
+	CData* rvalid;
+	CData* rready;
+	IData* wdata;
+	CData* wvalid;
+	CData* wready;
+	CData* wstrb; // AXI-Lite主机没有字节使能(NULL)
+
+	uint8_t aw_fire;
+	uint8_t w_fire;
+	uint8_t b_fire;
+	uint8_t ar_fire;
+	uint8_t r_fire;
+	uint8_t done; // 当前传输完成(标志)
+	uint32_t rdata_latched; // 读数据(锁存)
+}PandaSimBusMst;
+
+// 结构体: DMA命令
+typedef struct{
+	uint32_t addr; // 传输首地址
+	uint32_t btt; // 待传输字节数
+	uint8_t fixed; // 是否固定地址传输
+	uint64_t ready_cycle; // 可开始传输的周期
+}PandaSimDmaCmd;
+
+// 结构体: MMIO区
+typedef struct{
+	uint32_t base; // 传给驱动的基地址
+	uint32_t len; // 长度
+}PandaSimMmioWin;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@private
+@brief  把字节数组写入总线信号(位宽<=64)
+*************************/
+template<typename T>
+static inline void panda_sim_bus_set(T& sig, const uint8_t* buf, uint32_t byte_n){
+	T v = 0;
+
+	for(uint32_t i = 0;i < byte_n;i++){
+		v |= ((T)buf[i]) << (8 * i);
+	}
+
+	sig = v;
+}
+
+/*************************
+@private
+@brief  把字节数组写入总线信号(位宽>64)
+*************************/
+template<std::size_t W>
+static inline void panda_sim_bus_set(VlWide<W>& sig, const uint8_t* buf, uint32_t byte_n){
+	for(std::size_t i = 0;i < W;i++){
+		sig[i] = 0;
+	}
+
+	for(uint32_t i = 0;i < byte_n;i++){
+		sig[i / 4] |= ((EData)buf[i]) << (8 * (i % 4));
+	}
+}
+
+/*************************
+@private
+@brief  从总线信号读出字节数组(位宽<=64)
+*************************/
+template<typename T>
+static inline void panda_sim_bus_get(const T& sig, uint8_t* buf, uint32_t byte_n){
+	for(uint32_t i = 0;i < byte_n;i++){
+		buf[i] = (uint8_t)(sig >> (8 * i));
+	}
+}
+
+/*************************
+@private
+@brief  从总线信号读出字节数组(位宽>64)
+*************************/
+template<std::size_t W>
+static inline void panda_sim_bus_get(const VlWide<W>& sig, uint8_t* buf, uint32_t byte_n){
+	for(uint32_t i = 0;i < byte_n;i++){
+		buf[i] = (uint8_t)(sig[i / 4] >> (8 * (i % 4)));
+	}
+}
+
+/*************************
+@private
+@brief  读取字节使能中的某一位
+*************************/
+template<typename T>
+static inline uint8_t panda_sim_keep_bit(const T& keep, uint32_t i){
+	return (uint8_t)((keep >> i) & 1);
+}
+
+template<std::size_t W>
+static inline uint8_t panda_sim_keep_bit(const VlWide<W>& keep, uint32_t i){
+	return (uint8_t)((keep[i / 32] >> (i % 32)) & 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+extern "C" char __executable_start;
+
+/*************************
+@private
+@brief  把DMA总线地址转换为主机指针
+        总线地址即主机虚拟地址, 只允许访问DDR存储器模型以及可执行文件的数据段和brk堆
+@param  addr 总线地址
+        len 访问长度
+@return 主机指针
+*************************/
+static uint8_t* panda_sim_dma_host_ptr(uint32_t addr, uint32_t len){
+	uintptr_t s = (uintptr_t)addr;
+	uintptr_t e = s + (uintptr_t)len;
+
+	if(s >= PANDA_SIM_DDR_BASEADDR && e <= ((uintptr_t)PANDA_SIM_DDR_BASEADDR + PANDA_SIM_DDR_LEN)){
+		return (uint8_t*)s;
+	}
+
+	if(s >= (uintptr_t)(&__executable_start) && e <= (uintptr_t)sbrk(0)){
+		return (uint8_t*)s;
+	}
+
+	fprintf(stderr, "panda_sim: dma access out of range (addr = 0x%08x, len = %u)\n", addr, len);
+	abort();
+
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 类: MM2S通道模型
+template<typename DT, typename KT>
+class PandaSimMm2sChn{
+public:
+	QData* cmd_data;
+	CData* cmd_user;
+	CData* cmd_valid;
+	CData* cmd_ready;
+	DT* strm_data;
+	KT* strm_keep;
+	CData* strm_last;
+	CData* strm_valid;
+	CData* strm_ready;
+	CData* cmd_done;
+
+	uint64_t byte_n; // 已传输的字节数
+
+	PandaSimMm2sChn(QData* cmd_data, CData* cmd_user, CData* cmd_valid, CData* cmd_ready,
+		DT* strm_data, KT* strm_keep, CData* strm_last, CData* strm_valid, CData* strm_ready, CData* cmd_done):
+		cmd_data(cmd_data), cmd_user(cmd_user), cmd_valid(cmd_valid), cmd_ready(cmd_ready),
+		strm_data(strm_data), strm_keep(strm_keep), strm_last(strm_last), strm_valid(strm_valid), strm_ready(strm_ready),
+		cmd_done(cmd_done), byte_n(0), beat_ofs(0), cmd_fire(0), strm_fire(0){}
+
+	void reset(void){
+		this->cmd_fifo.clear();
+		this->beat_ofs = 0;
+
+		*this->cmd_ready = 0;
+		*this->strm_valid = 0;
+		*this->strm_last = 0;
+		*this->cmd_done = 0;
+	}
+
+	void pre_edge(void){
+		this->cmd_fire = (*this->cmd_valid) && (*this->cmd_ready);
+		this->strm_fire = (*this->strm_valid) && (*this->strm_ready);
+
+		if(this->cmd_fire){
+			this->cmd_latched.addr = (uint32_t)(*this->cmd_data);
+			this->cmd_latched.btt = (uint32_t)((*this->cmd_data >> 32) & 0x00FFFFFF);
+			this->cmd_latched.fixed = *this->cmd_user;
+		}
+	}
+
+	void post_edge(uint64_t cycle, const PandaSimCfg* cfg){
+		const uint32_t beat_byte_n = (uint32_t)sizeof(DT);
+
+		*this->cmd_done = 0;
+
+		if(this->cmd_fire){
+			this->cmd_latched.ready_cycle = cycle + cfg->dma_latency;
+			this->cmd_fifo.push_back(this->cmd_latched);
+		}
+
+		if(this->strm_fire){
+			PandaSimDmaCmd& cmd = this->cmd_fifo.front();
+			uint32_t now_byte_n = (cmd.btt - this->beat_ofs < beat_byte_n) ? (cmd.btt - this->beat_ofs):beat_byte_n;
+
+			this->beat_ofs += now_byte_n;
+			this->byte_n += now_byte_n;
+
+			if(this->beat_ofs >= cmd.btt){
+				this->cmd_fifo.pop_front();
+				this->beat_ofs = 0;
+
+				*this->cmd_done = 1;
+			}
+		}
+
+		// 待传输字节数为0的命令立即完成
+		while((!this->cmd_fifo.empty()) && this->cmd_fifo.front().btt == 0 && !(*this->cmd_done)){
+			this->cmd_fifo.pop_front();
+
+			*this->cmd_done = 1;
+		}
+
+		*this->cmd_ready = this->cmd_fifo.size() < cfg->dma_cmd_fifo_depth;
+
+		if((!this->cmd_fifo.empty()) && this->cmd_fifo.front().btt != 0 && this->cmd_fifo.front().ready_cycle <= cycle){
+			PandaSimDmaCmd& cmd = this->cmd_fifo.front();
+			uint32_t now_byte_n = (cmd.btt - this->beat_ofs < beat_byte_n) ? (cmd.btt - this->beat_ofs):beat_byte_n;
+			uint8_t beat[sizeof(DT)];
+			uint8_t keep[sizeof(DT) / 8 > 0 ? sizeof(DT) / 8:1];
+
+			memset(beat, 0, sizeof(beat));
+			memcpy(beat, panda_sim_dma_host_ptr(cmd.addr + (cmd.fixed ? 0:this->beat_ofs), now_byte_n), now_byte_n);
+
+			memset(keep, 0, sizeof(keep));
+			for(uint32_t i = 0;i < now_byte_n;i++){
+				keep[i / 8] |= (uint8_t)(1 << (i % 8));
+			}
+
+			panda_sim_bus_set(*this->strm_data, beat, beat_byte_n);
+			panda_sim_bus_set(*this->strm_keep, keep, (uint32_t)sizeof(keep));
+			*this->strm_last = (this->beat_ofs + now_byte_n) >= cmd.btt;
+			*this->strm_valid = 1;
+		}else{
+			*this->strm_valid = 0;
+			*this->strm_last = 0;
+		}
+	}
+
+private:
+	std::deque<PandaSimDmaCmd> cmd_fifo; // 命令fifo
+	uint32_t beat_ofs; // 当前命令已传输的字节数
+	uint8_t cmd_fire;
+	uint8_t strm_fire;
+	PandaSimDmaCmd cmd_latched; // 已接受的命令(锁存)
+};
+
+// 类: S2MM通道模型
+template<typename DT, typename KT>
+class PandaSimS2mmChn{
+public:
+	QData* cmd_data;
+	CData* cmd_user;
+	CData* cmd_valid;
+	CData* cmd_ready;
+	DT* strm_data;
+	KT* strm_keep;
+	CData* strm_valid;
+	CData* strm_ready;
+	CData* cmd_done;
+
+	uint64_t byte_n; // 已传输的字节数
+
+	PandaSimS2mmChn(QData* cmd_data, CData* cmd_user, CData* cmd_valid, CData* cmd_ready,
+		DT* strm_data, KT* strm_keep, CData* strm_valid, CData* strm_ready, CData* cmd_done):
+		cmd_data(cmd_data), cmd_user(cmd_user), cmd_valid(cmd_valid), cmd_ready(cmd_ready),
+		strm_data(strm_data), strm_keep(strm_keep), strm_valid(strm_valid), strm_ready(strm_ready),
+		cmd_done(cmd_done), byte_n(0), beat_ofs(0), cmd_fire(0), strm_fire(0){}
+
+	void reset(void){
+		this->cmd_fifo.clear();
+		this->beat_ofs = 0;
+
+		*this->cmd_ready = 0;
+		*this->strm_ready = 0;
+		*this->cmd_done = 0;
+	}
+
+	void pre_edge(void){
+		this->cmd_fire = (*this->cmd_valid) && (*this->cmd_ready);
+		this->strm_fire = (*this->strm_valid) && (*this->strm_ready);
+
+		if(this->cmd_fire){
+			this->cmd_latched.addr = (uint32_t)(*this->cmd_data);
+			this->cmd_latched.btt = (uint32_t)((*this->cmd_data >> 32) & 0x00FFFFFF);
+			this->cmd_latched.fixed = *this->cmd_user;
+		}
+
+		// 在握手时写存储器
+		if(this->strm_fire){
+			PandaSimDmaCmd& cmd = this->cmd_fifo.front();
+			uint8_t beat[sizeof(DT)];
+			uint32_t now_byte_n = 0;
+
+			panda_sim_bus_get(*this->strm_data, beat, (uint32_t)sizeof(DT));
+
+			for(uint32_t i = 0;i < (uint32_t)sizeof(DT) && this->beat_ofs + now_byte_n < cmd.btt;i++){
+				if(panda_sim_keep_bit(*this->strm_keep, i)){
+					*panda_sim_dma_host_ptr(cmd.addr + (cmd.fixed ? i:(this->beat_ofs + now_byte_n)), 1) = beat[i];
+
+					now_byte_n++;
+				}
+			}
+
+			this->beat_ofs += now_byte_n;
+			this->byte_n += now_byte_n;
+		}
+	}
+
+	void post_edge(uint64_t cycle, const PandaSimCfg* cfg){
+		*this->cmd_done = 0;
+
+		if(this->cmd_fire){
+			this->cmd_latched.ready_cycle = cycle + cfg->dma_latency;
+			this->cmd_fifo.push_back(this->cmd_latched);
+		}
+
+		if(this->strm_fire && this->beat_ofs >= this->cmd_fifo.front().btt){
+			this->cmd_fifo.pop_front();
+			this->beat_ofs = 0;
+
+			*this->cmd_done = 1;
+		}
+
+		while((!this->cmd_fifo.empty()) && this->cmd_fifo.front().btt == 0 && !(*this->cmd_done)){
+			this->cmd_fifo.pop_front();
+
+			*this->cmd_done = 1;
+		}
+
+		*this->cmd_ready = this->cmd_fifo.size() < cfg->dma_cmd_fifo_depth;
+		*this->strm_ready =
+			(!this->cmd_fifo.empty()) && this->cmd_fifo.front().btt != 0 && this->cmd_fifo.front().ready_cycle <= cycle &&
+			(cfg->s2mm_stall_period == 0 || (cycle % cfg->s2mm_stall_period) != 0);
+	}
+
+private:
+	std::deque<PandaSimDmaCmd> cmd_fifo; // 命令fifo
+	uint32_t beat_ofs; // 当前命令已传输的字节数
+	uint8_t cmd_fire;
+	uint8_t strm_fire;
+	PandaSimDmaCmd cmd_latched; // 已接受的命令(锁存)
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef std::remove_reference<decltype(((Vpanda_ai_engine*)0)->s0_dma_strm_axis_data)>::type PandaSimMm2sDataT;
+typedef std::remove_reference<decltype(((Vpanda_ai_engine*)0)->s0_dma_strm_axis_keep)>::type PandaSimMm2sKeepT;
+typedef std::remove_reference<decltype(((Vpanda_ai_engine*)0)->m_axis_fnl_res_data)>::type PandaSimS2mmDataT;
+typedef std::remove_reference<decltype(((Vpanda_ai_engine*)0)->m_axis_fnl_res_keep)>::type PandaSimS2mmKeepT;
+typedef std::remove_reference<decltype(((Vpanda_ai_engine*)0)->m_axis_trace_data)>::type PandaSimTraceDataT;
+typedef std::remove_reference<decltype(((Vpanda_ai_engine*)0)->m_axis_trace_keep)>::type PandaSimTraceKeepT;
+
+#define PANDA_SIM_AXIL_MST(top, name) { \
+	&(top)->s_axi_lite_##name##_awaddr, &(top)->s_axi_lite_##name##_awvalid, &(top)->s_axi_lite_##name##_awready, \
+	&(top)->s_axi_lite_##name##_bvalid, &(top)->s_axi_lite_##name##_bready, \
+	&(top)->s_axi_lite_##name##_araddr, &(top)->s_axi_lite_##name##_arvalid, &(top)->s_axi_lite_##name##_arready, \
+	&(top)->s_axi_lite_##name##_rdata, &(top)->s_axi_lite_##name##_rvalid, &(top)->s_axi_lite_##name##_rready, \
+	&(top)->s_axi_lite_##name##_wdata, &(top)->s_axi_lite_##name##_wvalid, &(top)->s_axi_lite_##name##_wready, \
+	NULL, 0, 0, 0, 0, 0, 0, 0}
+
+// 类: 仿真平台
+class PandaSim{
+public:
+	Vpanda_ai_engine* top;
+	PandaSimCfg cfg;
+	PandaSimSts sts;
+	uint8_t irq; // 中断电平
+
+	PandaSimBusMst bus_mst[5]; // 总线主机(卷积/池化/逐元素操作/事件跟踪寄存器区, BN参数存储器区)
+
+	PandaSimMm2sChn<PandaSimMm2sDataT, PandaSimMm2sKeepT> mm2s_0;
+	PandaSimMm2sChn<PandaSimMm2sDataT, PandaSimMm2sKeepT> mm2s_1;
+	CData mm2s_2_cmd_done; // 残差DMA通道没有命令完成信号输入, 仅供通道模型写入
+	PandaSimMm2sChn<PandaSimMm2sDataT, PandaSimMm2sKeepT> mm2s_2;
+	PandaSimS2mmChn<PandaSimS2mmDataT, PandaSimS2mmKeepT> s2mm;
+	PandaSimS2mmChn<PandaSimTraceDataT, PandaSimTraceKeepT> trace_s2mm;
+
+	PandaSim(VerilatedContext* ctx, const PandaSimCfg* cfg):
+		top(new Vpanda_ai_engine{ctx}),
+		cfg(*cfg),
+		irq(0),
+		mm2s_0(&top->m0_dma_cmd_axis_data, &top->m0_dma_cmd_axis_user, &top->m0_dma_cmd_axis_valid, &top->m0_dma_cmd_axis_ready,
+			&top->s0_dma_strm_axis_data, &top->s0_dma_strm_axis_keep, &top->s0_dma_strm_axis_last,
+			&top->s0_dma_strm_axis_valid, &top->s0_dma_strm_axis_ready, &top->mm2s_0_cmd_done),
+		mm2s_1(&top->m1_dma_cmd_axis_data, &top->m1_dma_cmd_axis_user, &top->m1_dma_cmd_axis_valid, &top->m1_dma_cmd_axis_ready,
+			&top->s1_dma_strm_axis_data, &top->s1_dma_strm_axis_keep, &top->s1_dma_strm_axis_last,
+			&top->s1_dma_strm_axis_valid, &top->s1_dma_strm_axis_ready, &top->mm2s_1_cmd_done),
+		mm2s_2_cmd_done(0),
+		mm2s_2(&top->m2_dma_cmd_axis_data, &top->m2_dma_cmd_axis_user, &top->m2_dma_cmd_axis_valid, &top->m2_dma_cmd_axis_ready,
+			&top->s2_dma_strm_axis_data, &top->s2_dma_strm_axis_keep, &top->s2_dma_strm_axis_last,
+			&top->s2_dma_strm_axis_valid, &top->s2_dma_strm_axis_ready, &mm2s_2_cmd_done),
+		s2mm(&top->m_dma_s2mm_cmd_axis_data, &top->m_dma_s2mm_cmd_axis_user,
+			&top->m_dma_s2mm_cmd_axis_valid, &top->m_dma_s2mm_cmd_axis_ready,
+			&top->m_axis_fnl_res_data, &top->m_axis_fnl_res_keep, &top->m_axis_fnl_res_valid, &top->m_axis_fnl_res_ready,
+			&top->s2mm_cmd_done),
+		trace_s2mm(&top->m_trace_dma_cmd_axis_data, &top->m_trace_dma_cmd_axis_user,
+			&top->m_trace_dma_cmd_axis_valid, &top->m_trace_dma_cmd_axis_ready,
+			&top->m_axis_trace_data, &top->m_axis_trace_keep, &top->m_axis_trace_valid, &top->m_axis_trace_ready,
+			&top->trace_s2mm_cmd_done),
+		ctx(ctx)
+#if VM_TRACE
+		, tfp(NULL)
+#endif
+	{
+		PandaSimBusMst axil_mst[4] = {
+			PANDA_SIM_AXIL_MST(top, conv),
+			PANDA_SIM_AXIL_MST(top, pool),
+			PANDA_SIM_AXIL_MST(top, elm),
+			PANDA_SIM_AXIL_MST(top, trace)
+		};
+		PandaSimBusMst mem_mst = {
+			&top->s_axi_conv_awaddr, &top->s_axi_conv_awvalid, &top->s_axi_conv_awready,
+			&top->s_axi_conv_bvalid, &top->s_axi_conv_bready,
+			&top->s_axi_conv_araddr, &top->s_axi_conv_arvalid, &top->s_axi_conv_arready,
+			&top->s_axi_conv_rdata, &top->s_axi_conv_rvalid, &top->s_axi_conv_rready,
+			&top->s_axi_conv_wdata, &top->s_axi_conv_wvalid, &top->s_axi_conv_wready,
+			&top->s_axi_conv_wstrb, 0, 0, 0, 0, 0, 0, 0
+		};
+
+		for(int i = 0;i < 4;i++){
+			this->bus_mst[i] = axil_mst[i];
+		}
+		this->bus_mst[PANDA_SIM_MEM_MST_ID] = mem_mst;
+
+		memset(&this->sts, 0, sizeof(PandaSimSts));
+
+		// 各时钟的半周期(以子步为单位)
+		uint32_t rate[5] = {1, cfg->mac_array_clk_rate, cfg->bn_act_clk_rate, cfg->mid_res_buf_clk_rate, cfg->elm_proc_clk_rate};
+		uint32_t rate_lcm = 1;
+
+		for(int i = 0;i < 5;i++){
+			uint32_t a = rate_lcm;
+			uint32_t b = rate[i];
+
+			while(b != 0){
+				uint32_t t = a % b;
+
+				a = b;
+				b = t;
+			}
+
+			rate_lcm = rate_lcm / a * rate[i];
+		}
+
+		for(int i = 0;i < 5;i++){
+			this->half_step_n[i] = rate_lcm / rate[i];
+		}
+		this->sub_step_n = rate_lcm * 2;
+
+#if VM_TRACE
+		if(cfg->wave_file != NULL){
+			Verilated::traceEverOn(true);
+
+			this->tfp = new VerilatedVcdC;
+			this->top->trace(this->tfp, 99);
+			this->tfp->open(cfg->wave_file);
+		}
+#endif
+	}
+
+	~PandaSim(){
+		this->top->final();
+
+#if VM_TRACE
+		if(this->tfp != NULL){
+			this->tfp->close();
+			delete this->tfp;
+		}
+#endif
+
+		delete this->top;
+	}
+
+	/*************************
+	@ctrl
+	@public
+	@brief  复位加速器并初始化各接口
+	*************************/
+	void reset(void){
+		this->top->aresetn = 0;
+		this->top->mac_array_aresetn = 0;
+		this->top->bn_act_aresetn = 0;
+		this->top->mid_res_buf_aresetn = 0;
+		this->top->elm_proc_aresetn = 0;
+
+		for(int i = 0;i < PANDA_SIM_MMIO_WIN_N;i++){
+			PandaSimBusMst* mst = &this->bus_mst[i];
+
+			*mst->awaddr = 0;
+			*mst->awvalid = 0;
+			*mst->bready = 0;
+			*mst->araddr = 0;
+			*mst->arvalid = 0;
+			*mst->rready = 0;
+			*mst->wdata = 0;
+			*mst->wvalid = 0;
+		}
+
+		// 单次递增传输, 每次4字节
+		this->top->s_axi_conv_arburst = 1;
+		this->top->s_axi_conv_arcache = 0;
+		this->top->s_axi_conv_arlen = 0;
+		this->top->s_axi_conv_arlock = 0;
+		this->top->s_axi_conv_arprot = 0;
+		this->top->s_axi_conv_arsize = 2;
+		this->top->s_axi_conv_awburst = 1;
+		this->top->s_axi_conv_awcache = 0;
+		this->top->s_axi_conv_awlen = 0;
+		this->top->s_axi_conv_awlock = 0;
+		this->top->s_axi_conv_awprot = 0;
+		this->top->s_axi_conv_awsize = 2;
+		this->top->s_axi_conv_wlast = 1;
+		this->top->s_axi_conv_wstrb = 0xF;
+
+		this->mm2s_0.reset();
+		this->mm2s_1.reset();
+		this->mm2s_2.reset();
+		this->s2mm.reset();
+		this->trace_s2mm.reset();
+
+		this->top->eval();
+
+		for(int i = 0;i < PANDA_SIM_RST_CYCLE_N;i++){
+			this->tick();
+		}
+
+		this->top->aresetn = 1;
+		this->top->mac_array_aresetn = 1;
+		this->top->bn_act_aresetn = 1;
+		this->top->mid_res_buf_aresetn = 1;
+		this->top->elm_proc_aresetn = 1;
+
+		for(int i = 0;i < PANDA_SIM_RST_CYCLE_N;i++){
+			this->tick();
+		}
+	}
+
+	/*************************
+	@ctrl
+	@public
+	@brief  推进到下一个主时钟上升沿
+	        在上升沿前采样各接口的握手, 在上升沿后更新各模型并驱动新的输入
+	*************************/
+	void tick(void){
+		for(uint32_t s = 1;s <= this->sub_step_n;s++){
+			uint32_t ph = s % this->sub_step_n;
+
+			if(ph == 0){
+				this->pre_edge();
+			}
+
+			this->top->aclk = clk_lvl(ph, this->half_step_n[0]);
+			this->top->mac_array_aclk = clk_lvl(ph, this->half_step_n[1]);
+			this->top->bn_act_aclk = clk_lvl(ph, this->half_step_n[2]);
+			this->top->mid_res_buf_aclk = clk_lvl(ph, this->half_step_n[3]);
+			this->top->elm_proc_aclk = clk_lvl(ph, this->half_step_n[4]);
+
+			this->ctx->timeInc(1);
+			this->top->eval();
+
+			if(ph == 0){
+				this->sts.cycle_n++;
+				this->post_edge();
+				this->top->eval();
+			}
+
+#if VM_TRACE
+			if(this->tfp != NULL){
+				this->tfp->dump(this->ctx->time());
+			}
+#endif
+		}
+	}
+
+	/*************************
+	@ctrl
+	@public
+	@brief  总线读
+	@param  mst_id 总线主机编号
+	        ofs 区内偏移地址
+	@return 读数据
+	*************************/
+	uint32_t bus_rd(int mst_id, uint32_t ofs){
+		PandaSimBusMst* mst = &this->bus_mst[mst_id];
+
+		*mst->araddr = ofs;
+		*mst->arvalid = 1;
+		*mst->rready = 1;
+		mst->done = 0;
+		mst->rdata_latched = 0;
+
+		this->top->eval();
+
+		if(!this->wait_bus(mst)){
+			fprintf(stderr, "panda_sim: read timeout (mst = %d, ofs = 0x%08x)\n", mst_id, ofs);
+		}
+
+		if(mst_id != PANDA_SIM_MEM_MST_ID){
+			this->sts.reg_rd_n++;
+		}
+
+		return mst->rdata_latched;
+	}
+
+	/*************************
+	@ctrl
+	@public
+	@brief  总线写
+	@param  mst_id 总线主机编号
+	        ofs 区内偏移地址
+	        data 写数据
+	@return none
+	*************************/
+	void bus_wr(int mst_id, uint32_t ofs, uint32_t data){
+		PandaSimBusMst* mst = &this->bus_mst[mst_id];
+
+		*mst->awaddr = ofs;
+		*mst->awvalid = 1;
+		*mst->wdata = data;
+		*mst->wvalid = 1;
+		*mst->bready = 1;
+		mst->done = 0;
+
+		this->top->eval();
+
+		if(!this->wait_bus(mst)){
+			fprintf(stderr, "panda_sim: write timeout (mst = %d, ofs = 0x%08x)\n", mst_id, ofs);
+		}
+
+		if(mst_id != PANDA_SIM_MEM_MST_ID){
+			this->sts.reg_wr_n++;
+		}
+	}
+
+	/*************************
+	@sts
+	@public
+	@brief  汇总DMA传输字节数
+	*************************/
+	void upd_sts(void){
+		this->sts.mm2s_byte_n[0] = this->mm2s_0.byte_n;
+		this->sts.mm2s_byte_n[1] = this->mm2s_1.byte_n;
+		this->sts.mm2s_byte_n[2] = this->mm2s_2.byte_n;
+		this->sts.s2mm_byte_n = this->s2mm.byte_n;
+		this->sts.trace_byte_n = this->trace_s2mm.byte_n;
+	}
+
+private:
+	VerilatedContext* ctx;
+#if VM_TRACE
+	VerilatedVcdC* tfp;
+#endif
+
+	uint32_t half_step_n[5]; // 各时钟的半周期(子步数)
+	uint32_t sub_step_n; // 每个主时钟周期的子步数
+
+	static inline uint8_t clk_lvl(uint32_t ph, uint32_t half_step_n){
+		return ((ph / half_step_n) & 1) ? 0:1;
+	}
+
+	void pre_edge(void){
+		for(int i = 0;i < PANDA_SIM_MMIO_WIN_N;i++){
+			PandaSimBusMst* mst = &this->bus_mst[i];
+
+			mst->aw_fire = (*mst->awvalid) && (*mst->awready);
+			mst->w_fire = (*mst->wvalid) && (*mst->wready);
+			mst->b_fire = (*mst->bvalid) && (*mst->bready);
+			mst->ar_fire = (*mst->arvalid) && (*mst->arready);
+			mst->r_fire = (*mst->rvalid) && (*mst->rready);
+
+			if(mst->r_fire){
+				mst->rdata_latched = *mst->rdata;
+			}
+		}
+
+		this->mm2s_0.pre_edge();
+		this->mm2s_1.pre_edge();
+		this->mm2s_2.pre_edge();
+		this->s2mm.pre_edge();
+		this->trace_s2mm.pre_edge();
+	}
+
+	void post_edge(void){
+		for(int i = 0;i < PANDA_SIM_MMIO_WIN_N;i++){
+			PandaSimBusMst* mst = &this->bus_mst[i];
+
+			if(mst->aw_fire){
+				*mst->awvalid = 0;
+			}
+			if(mst->w_fire){
+				*mst->wvalid = 0;
+			}
+			if(mst->b_fire){
+				*mst->bready = 0;
+				mst->done = 1;
+			}
+			if(mst->ar_fire){
+				*mst->arvalid = 0;
+			}
+			if(mst->r_fire){
+				*mst->rready = 0;
+				mst->done = 1;
+			}
+		}
+
+		this->mm2s_0.post_edge(this->sts.cycle_n, &this->cfg);
+		this->mm2s_1.post_edge(this->sts.cycle_n, &this->cfg);
+		this->mm2s_2.post_edge(this->sts.cycle_n, &this->cfg);
+		this->s2mm.post_edge(this->sts.cycle_n, &this->cfg);
+		this->trace_s2mm.post_edge(this->sts.cycle_n, &this->cfg);
+
+		this->irq =
+			(this->top->conv_irq ? PANDA_SIM_IRQ_CONV:0) |
+			(this->top->pool_irq ? PANDA_SIM_IRQ_POOL:0) |
+			(this->top->elm_irq ? PANDA_SIM_IRQ_ELM:0);
+	}
+
+	int wait_bus(PandaSimBusMst* mst){
+		for(int i = 0;i < PANDA_SIM_BUS_TIMEOUT_CYCLE_N;i++){
+			this->tick();
+
+			if(mst->done){
+				return 1;
+			}
+		}
+
+		// 超时(如访问未启用的事件跟踪单元), 撤销本次传输
+		*mst->awvalid = 0;
+		*mst->wvalid = 0;
+		*mst->bready = 0;
+		*mst->arvalid = 0;
+		*mst->rready = 0;
+		this->top->eval();
+
+		return 0;
+	}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static VerilatedContext* panda_sim_ctx = NULL; // Verilator上下文
+static PandaSim* panda_sim = NULL; // 仿真平台
+
+static PandaSimMmioWin panda_sim_mmio_win[PANDA_SIM_MMIO_WIN_N]; // MMIO区
+
+static uint32_t panda_sim_ddr_alloc_ofs = 0; // DDR存储器模型的分配位置
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@private
+@brief  查找地址所在的MMIO区
+@param  addr 主机地址
+@return MMIO区编号(不在任何MMIO区内时返回-1)
+*************************/
+static int panda_sim_find_win(uintptr_t addr){
+	for(int i = 0;i < PANDA_SIM_MMIO_WIN_N;i++){
+		if(addr >= panda_sim_mmio_win[i].base && addr < ((uintptr_t)panda_sim_mmio_win[i].base + panda_sim_mmio_win[i].len)){
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*************************
+@cfg
+@public
+@brief  获取默认的仿真平台配置参数(与panda_ai_engine的默认顶层参数一致)
+@param  cfg 配置参数(句柄)
+@return none
+*************************/
+void panda_sim_default_cfg(PandaSimCfg* cfg){
+	cfg->mac_array_clk_rate = 1;
+	cfg->bn_act_clk_rate = 1;
+	cfg->mid_res_buf_clk_rate = 1;
+	cfg->elm_proc_clk_rate = 2;
+
+	cfg->dma_latency = 16;
+	cfg->dma_cmd_fifo_depth = 4;
+	cfg->s2mm_stall_period = 0;
+
+	cfg->wave_file = NULL;
+}
+
+/*************************
+@init
+@public
+@brief  初始化仿真平台
+        映射DDR存储器模型, 并复位加速器
+@param  cfg 配置参数(句柄)
+@return 是否成功
+*************************/
+int panda_sim_init(const PandaSimCfg* cfg){
+	if(panda_sim != NULL){
+		return -1;
+	}
+
+	if(cfg->mac_array_clk_rate == 0 || cfg->bn_act_clk_rate == 0 ||
+		cfg->mid_res_buf_clk_rate == 0 || cfg->elm_proc_clk_rate == 0 || cfg->dma_cmd_fifo_depth == 0){
+		return -1;
+	}
+
+	const uint32_t win_base[PANDA_SIM_MMIO_WIN_N] = {
+		PANDA_SIM_CONV_BASEADDR, PANDA_SIM_POOL_BASEADDR, PANDA_SIM_ELM_BASEADDR, PANDA_SIM_TRACE_BASEADDR,
+		PANDA_SIM_CONV_MEM_BASEADDR
+	};
+
+	for(int i = 0;i < PANDA_SIM_MMIO_WIN_N;i++){
+		panda_sim_mmio_win[i].base = win_base[i];
+		panda_sim_mmio_win[i].len = (i == PANDA_SIM_MEM_MST_ID) ? PANDA_SIM_MEM_RGN_LEN:PANDA_SIM_REG_RGN_LEN;
+	}
+
+	void* ddr = mmap((void*)(uintptr_t)PANDA_SIM_DDR_BASEADDR, PANDA_SIM_DDR_LEN, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+
+	if(ddr != (void*)(uintptr_t)PANDA_SIM_DDR_BASEADDR){
+		fprintf(stderr, "panda_sim: cannot map ddr model at 0x%08x\n", PANDA_SIM_DDR_BASEADDR);
+
+		return -1;
+	}
+
+	panda_sim_ddr_alloc_ofs = 0;
+
+	panda_sim_ctx = new VerilatedContext;
+	panda_sim = new PandaSim(panda_sim_ctx, cfg);
+
+	panda_sim->reset();
+
+	return 0;
+}
+
+/*************************
+@init
+@public
+@brief  结束仿真
+        撤销DDR存储器模型的映射
+@return none
+*************************/
+void panda_sim_deinit(void){
+	if(panda_sim == NULL){
+		return;
+	}
+
+	delete panda_sim;
+	delete panda_sim_ctx;
+
+	panda_sim = NULL;
+	panda_sim_ctx = NULL;
+
+	munmap((void*)(uintptr_t)PANDA_SIM_DDR_BASEADDR, PANDA_SIM_DDR_LEN);
+}
+
+/*************************
+@ctrl
+@public
+@brief  运行若干个主时钟周期
+        驱动在轮询等待时可调用本函数, 以免每次推进时间都经过寄存器读
+@param  cycle_n 周期数
+@return none
+*************************/
+void panda_sim_run(uint32_t cycle_n){
+	for(uint32_t i = 0;i < cycle_n;i++){
+		panda_sim->tick();
+	}
+}
+
+/*************************
+@ctrl
+@public
+@brief  等待中断
+@param  irq_mask 中断掩码
+        timeout_cycle_n 超时周期数(0表示不超时)
+@return 是否成功(超时返回-1)
+*************************/
+int panda_sim_wait_irq(uint8_t irq_mask, uint64_t timeout_cycle_n){
+	for(uint64_t i = 0;timeout_cycle_n == 0 || i < timeout_cycle_n;i++){
+		if(panda_sim->irq & irq_mask){
+			return 0;
+		}
+
+		panda_sim->tick();
+	}
+
+	return -1;
+}
+
+/*************************
+@sts
+@public
+@brief  获取当前的中断电平
+@return 中断电平(PANDA_SIM_IRQ_*的组合)
+*************************/
+uint8_t panda_sim_get_irq(void){
+	return panda_sim->irq;
+}
+
+/*************************
+@sts
+@public
+@brief  获取仿真统计信息
+@param  sts 统计信息(句柄)
+@return none
+*************************/
+void panda_sim_get_sts(PandaSimSts* sts){
+	panda_sim->upd_sts();
+
+	*sts = panda_sim->sts;
+}
+
+/*************************
+@cfg
+@public
+@brief  从DDR存储器模型中分配缓存区
+        DDR存储器模型位于4GB以下, 其地址可直接作为总线地址传给加速器
+@param  len 长度(字节数)
+        align 对齐字节数(须为2的幂, 0表示不对齐)
+@return 缓存区首地址(失败时返回NULL)
+*************************/
+void* panda_sim_ddr_alloc(uint32_t len, uint32_t align){
+	uint32_t ofs = panda_sim_ddr_alloc_ofs;
+
+	if(align > 1){
+		ofs = (ofs + align - 1) & (~(align - 1));
+	}
+
+	if(((uint64_t)ofs + len) > PANDA_SIM_DDR_LEN){
+		return NULL;
+	}
+
+	panda_sim_ddr_alloc_ofs = ofs + len;
+
+	return (void*)(uintptr_t)(PANDA_SIM_DDR_BASEADDR + ofs);
+}
+
+/*************************
+@cfg
+@public
+@brief  释放DDR存储器模型中的全部缓存区
+@return none
+*************************/
+void panda_sim_ddr_free_all(void){
+	panda_sim_ddr_alloc_ofs = 0;
+}
+
+/*************************
+@sts
+@public
+@brief  MMIO回调(读1个字)
+        addr为传给驱动的基地址(PANDA_SIM_*_BASEADDR) + 偏移地址
+@param  arg 未使用
+        addr 主机地址
+@return 读数据
+*************************/
+uint32_t panda_sim_mmio_rd(void* arg, uintptr_t addr){
+	int win_id = panda_sim_find_win(addr);
+
+	(void)arg;
+
+	if(win_id == -1 || panda_sim == NULL){
+		fprintf(stderr, "panda_sim: mmio read out of range (addr = 0x%08lx)\n", (unsigned long)addr);
+
+		return 0;
+	}
+
+	return panda_sim->bus_rd(win_id, ((uint32_t)(addr - panda_sim_mmio_win[win_id].base)) & 0xFFFFFFFC);
+}
+
+/*************************
+@ctrl
+@public
+@brief  MMIO回调(写1个字)
+        addr为传给驱动的基地址(PANDA_SIM_*_BASEADDR) + 偏移地址
+@param  arg 未使用
+        addr 主机地址
+        data 写数据
+@return none
+*************************/
+void panda_sim_mmio_wr(void* arg, uintptr_t addr, uint32_t data){
+	int win_id = panda_sim_find_win(addr);
+
+	(void)arg;
+
+	if(win_id == -1 || panda_sim == NULL){
+		fprintf(stderr, "panda_sim: mmio write out of range (addr = 0x%08lx)\n", (unsigned long)addr);
+
+		return;
+	}
+
+	panda_sim->bus_wr(win_id, ((uint32_t)(addr - panda_sim_mmio_win[win_id].base)) & 0xFFFFFFFC, data);
+}
@@ -0,0 +1,98 @@
+/************************************************************************************************************************
+大胖达AI引擎Verilator仿真平台(接口头文件)
+@brief  用Verilator把panda_ai_engine编译为C++模型, 提供AXI-Lite主机, BN参数存储器的AXI主机, DMA与DDR存储器模型,
+        使卷积/池化/逐元素操作/事件跟踪驱动可直接在主机上运行
+
+        驱动以回调函数作为寄存器访问后端(编译时定义AXI_GNR_CONV_MMIO_CB、AXI_GNR_POOL_MMIO_CB、
+        AXI_ELM_WISE_PROC_MMIO_CB和PANDA_AI_TRACE_MMIO_CB, 见build.sh), 并把panda_sim_mmio_rd/panda_sim_mmio_wr作为回调函数,
+        以PANDA_SIM_*_BASEADDR作为基地址; 回调函数按地址所在的寄存器区/存储器区通过AXI-Lite/AXI读写1个字
+
+        DMA模型直接以总线地址作为主机虚拟地址访问存储器, 因此传给加速器的缓存区须位于4GB以下
+        (DDR存储器模型, 或以-no-pie链接时的全局数组和brk堆)
+
+        仅支持Linux, 可执行文件须以-no-pie链接(见build.sh)
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 增加MMIO回调函数(驱动的回调寄存器访问后端)
+        2026.10.17 1.02 增加残差DMA(MM2S)通道模型
+        2026.10.17 1.03 去掉MMIO shim(SIGSEGV + 单步拦截), 驱动统一通过MMIO回调访问加速器
+************************************************************************************************************************/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 各寄存器区/存储器区的基地址(传给驱动, 只用于区分所访问的区和字, 不映射到主机存储器)
+#define PANDA_SIM_CONV_BASEADDR 0xC0000000 // 通用卷积处理单元寄存器区
+#define PANDA_SIM_POOL_BASEADDR 0xC0010000 // 通用池化处理单元寄存器区
+#define PANDA_SIM_ELM_BASEADDR 0xC0020000 // 逐元素操作处理单元寄存器区
+#define PANDA_SIM_TRACE_BASEADDR 0xC0030000 // 事件跟踪单元寄存器区
+#define PANDA_SIM_CONV_MEM_BASEADDR 0xC0100000 // BN参数与Sigmoid函数值查找表存储器区
+
+// 寄存器区/存储器区的长度
+#define PANDA_SIM_REG_RGN_LEN 0x1000
+#define PANDA_SIM_MEM_RGN_LEN 0x10000
+
+// DDR存储器模型
+// 放在2GB以上, 避开可执行文件和随机化后的brk堆
+#define PANDA_SIM_DDR_BASEADDR 0xA0000000
+#define PANDA_SIM_DDR_LEN 0x20000000
+
+// 中断(掩码)
+#define PANDA_SIM_IRQ_CONV 0x01
+#define PANDA_SIM_IRQ_POOL 0x02
+#define PANDA_SIM_IRQ_ELM 0x04
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 结构体: 仿真平台配置参数
+typedef struct{
+	// 各时钟相对于主时钟(aclk)的倍率, 须与编译时的顶层参数一致
+	uint32_t mac_array_clk_rate; // 乘加阵列时钟倍率(CONV_MAC_ARRAY_CLK_RATE)
+	uint32_t bn_act_clk_rate; // BN与激活单元时钟倍率(BN_ACT_CLK_RATE)
+	uint32_t mid_res_buf_clk_rate; // 中间结果缓存时钟倍率(MID_RES_BUF_CLK_RATE)
+	uint32_t elm_proc_clk_rate; // 逐元素操作功能单元时钟倍率(ELM_PROC_FU_CLK_RATE)
+
+	// DMA模型
+	uint32_t dma_latency; // 从接受命令到输出第1个数据的周期数
+	uint32_t dma_cmd_fifo_depth; // 每个通道可缓存的命令数
+	uint32_t s2mm_stall_period; // S2MM通道每隔多少个周期反压1个周期(0表示不反压)
+
+	const char* wave_file; // 波形文件(NULL表示不记录, 仅在以--trace编译时有效)
+}PandaSimCfg;
+
+// 结构体: 仿真统计信息
+typedef struct{
+	uint64_t cycle_n; // 已仿真的主时钟周期数
+	uint64_t reg_rd_n; // 寄存器读次数
+	uint64_t reg_wr_n; // 寄存器写次数
+	uint64_t mm2s_byte_n[3]; // 各MM2S通道传输的字节数(#2为残差DMA通道)
+	uint64_t s2mm_byte_n; // S2MM通道传输的字节数
+	uint64_t trace_byte_n; // 事件跟踪S2MM通道传输的字节数
+}PandaSimSts;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void panda_sim_default_cfg(PandaSimCfg* cfg); // 获取默认的仿真平台配置参数
+int panda_sim_init(const PandaSimCfg* cfg); // 初始化仿真平台
+void panda_sim_deinit(void); // 结束仿真
+
+void panda_sim_run(uint32_t cycle_n); // 运行若干个主时钟周期
+int panda_sim_wait_irq(uint8_t irq_mask, uint64_t timeout_cycle_n); // 等待中断
+uint8_t panda_sim_get_irq(void); // 获取当前的中断电平
+void panda_sim_get_sts(PandaSimSts* sts); // 获取仿真统计信息
+
+void* panda_sim_ddr_alloc(uint32_t len, uint32_t align); // 从DDR存储器模型中分配缓存区
+void panda_sim_ddr_free_all(void); // 释放DDR存储器模型中的全部缓存区
+
+uint32_t panda_sim_mmio_rd(void* arg, uintptr_t addr); // MMIO回调(读1个字)
+void panda_sim_mmio_wr(void* arg, uintptr_t addr, uint32_t data); // MMIO回调(写1个字)
+
+#ifdef __cplusplus
+}
+#endif
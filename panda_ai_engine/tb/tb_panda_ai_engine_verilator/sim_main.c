@@ -0,0 +1,295 @@
+/************************************************************************************************************************
+大胖达AI引擎Verilator仿真示例
+@brief  在Verilator模型上运行未经修改的卷积/池化/逐元素操作驱动:
+            初始化3个处理单元, 用随机输入特征图/权重/BN参数运行1个FP16卷积层,
+            并与参考模型(axi_generic_conv_ref_model)逐字节比较输出特征图
+        用法: sim_main [输入特征图宽度 高度 通道数 卷积核个数]
+        驱动以仿真平台的MMIO回调函数作为寄存器访问后端
+@date   2026/10/16
+@author 陈家耀
+@eidt   2026.10.16 1.00 创建了第1个正式版本
+        2026.10.16 1.01 支持以MMIO回调函数作为驱动的寄存器访问后端
+        2026.10.17 1.02 驱动统一通过MMIO回调访问加速器, 报告寄存器读写次数
+************************************************************************************************************************/
+
+#include "panda_sim.h"
+
+#include "../../../axi_generic_conv/software/axi_generic_conv_ref_model.h"
+#include "../../../axi_generic_pool/software/axi_generic_pool.h"
+#include "../../../axi_element_wise_proc/software/axi_element_wise_proc.h"
+
+#include <stdio.h>
+#include <time.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// 轮询等待时每次推进的周期数
+#define WAIT_HOOK_CYCLE_N 64
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int test_conv_layer(uint16_t ifmap_w, uint16_t ifmap_h, uint16_t chn_n, uint16_t kernal_n);
+static uint16_t gen_rand_fp16(void);
+static void wait_done_hook(void* arg);
+static double get_wall_time(void);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static AxiGnrConvHandler axi_generic_conv; // 通用卷积处理单元
+static AxiGnrPoolHandler axi_generic_pool; // 通用池化处理单元
+static AxiElmWiseProcHandler axi_element_wise_proc; // 逐元素操作处理单元
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[]){
+	uint16_t ifmap_w = 16;
+	uint16_t ifmap_h = 16;
+	uint16_t chn_n = 16;
+	uint16_t kernal_n = 16;
+
+	if(argc >= 5){
+		ifmap_w = (uint16_t)atoi(argv[1]);
+		ifmap_h = (uint16_t)atoi(argv[2]);
+		chn_n = (uint16_t)atoi(argv[3]);
+		kernal_n = (uint16_t)atoi(argv[4]);
+	}
+
+	PandaSimCfg sim_cfg;
+
+	panda_sim_default_cfg(&sim_cfg);
+
+	if(panda_sim_init(&sim_cfg)){
+		return -1;
+	}
+
+	// 初始化3个处理单元
+	AxiGnrConvMmio conv_mmio;
+	AxiGnrPoolMmio pool_mmio;
+	AxiElmWiseProcMmio elm_mmio;
+
+	memset((void*)&conv_mmio, 0, sizeof(conv_mmio));
+	memset((void*)&pool_mmio, 0, sizeof(pool_mmio));
+	memset((void*)&elm_mmio, 0, sizeof(elm_mmio));
+
+	conv_mmio.reg_base = PANDA_SIM_CONV_BASEADDR;
+	conv_mmio.mem_base = PANDA_SIM_CONV_MEM_BASEADDR;
+	conv_mmio.rd = panda_sim_mmio_rd;
+	conv_mmio.wr = panda_sim_mmio_wr;
+	pool_mmio.reg_base = PANDA_SIM_POOL_BASEADDR;
+	pool_mmio.rd = panda_sim_mmio_rd;
+	pool_mmio.wr = panda_sim_mmio_wr;
+	elm_mmio.reg_base = PANDA_SIM_ELM_BASEADDR;
+	elm_mmio.rd = panda_sim_mmio_rd;
+	elm_mmio.wr = panda_sim_mmio_wr;
+
+	if(axi_generic_conv_init_mmio(&axi_generic_conv, &conv_mmio)){
+		printf("conv init failed\n");
+
+		return -1;
+	}
+	if(axi_generic_pool_init_mmio(&axi_generic_pool, &pool_mmio)){
+		printf("pool init failed\n");
+
+		return -1;
+	}
+	if(axi_element_wise_proc_init_mmio(&axi_element_wise_proc, &elm_mmio)){
+		printf("element-wise init failed\n");
+
+		return -1;
+	}
+
+	printf("conv: %s v%s, atomic_k = %d, atomic_c = %d\n", axi_generic_conv.property.accelerator_type,
+		axi_generic_conv.property.version, (int)axi_generic_conv.property.atomic_k, (int)axi_generic_conv.property.atomic_c);
+	printf("pool: %s v%s\n", axi_generic_pool.property.accelerator_type, axi_generic_pool.property.version);
+	printf("element-wise: %s v%s\n", axi_element_wise_proc.property.accelerator_type, axi_element_wise_proc.property.version);
+
+	int res = test_conv_layer(ifmap_w, ifmap_h, chn_n, kernal_n);
+
+	panda_sim_deinit();
+
+	return res;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int test_conv_layer(uint16_t ifmap_w, uint16_t ifmap_h, uint16_t chn_n, uint16_t kernal_n){
+	const AxiGnrConvProp* prop = &axi_generic_conv.property;
+	uint32_t ofmap_w = ifmap_w;
+	uint32_t ofmap_h = ifmap_h;
+	uint32_t in_fmap_n = ((uint32_t)ifmap_w) * ifmap_h * chn_n;
+	uint32_t kernal_wgt_n = 3 * 3 * ((uint32_t)chn_n) * kernal_n;
+	uint32_t out_fmap_len = ofmap_w * ofmap_h * kernal_n * 2;
+
+	if(kernal_n % prop->atomic_k){
+		printf("kernal_n must be a multiple of atomic_k(%d)\n", (int)prop->atomic_k);
+
+		return -1;
+	}
+
+	uint16_t* in_fmap = (uint16_t*)panda_sim_ddr_alloc(in_fmap_n * 2, 64);
+	uint16_t* kernal_wgt = (uint16_t*)panda_sim_ddr_alloc(kernal_wgt_n * 2, 64);
+	uint8_t* out_fmap = (uint8_t*)panda_sim_ddr_alloc(out_fmap_len, 64);
+	uint8_t* ref_out_fmap = (uint8_t*)panda_sim_ddr_alloc(out_fmap_len, 64);
+	BNParam* bn_params = (BNParam*)panda_sim_ddr_alloc(sizeof(BNParam) * kernal_n, 64);
+
+	if(in_fmap == NULL || kernal_wgt == NULL || out_fmap == NULL || ref_out_fmap == NULL || bn_params == NULL){
+		return -1;
+	}
+
+	srand(1);
+
+	for(uint32_t i = 0;i < in_fmap_n;i++){
+		in_fmap[i] = gen_rand_fp16();
+	}
+	for(uint32_t i = 0;i < kernal_wgt_n;i++){
+		kernal_wgt[i] = gen_rand_fp16();
+	}
+	for(uint32_t i = 0;i < kernal_n;i++){
+		bn_params[i].param_a = 0.5f + ((float)(rand() % 1024)) / 1024.0f;
+		bn_params[i].param_b = ((float)(rand() % 1024)) / 512.0f - 1.0f;
+	}
+
+	memset(out_fmap, 0, out_fmap_len);
+
+	AxiGnrConvCfg conv_cfg;
+	AxiGnrConvBufPlan buf_plan;
+
+	memset(&conv_cfg, 0, sizeof(AxiGnrConvCfg));
+
+	conv_cfg.ifmap_baseaddr = (uint8_t*)in_fmap;
+	conv_cfg.ofmap_baseaddr = out_fmap;
+	conv_cfg.kernal_wgt_baseaddr = (uint8_t*)kernal_wgt;
+	conv_cfg.group_n = 1;
+	conv_cfg.cal_cfg.cal_fmt = CONV_FP16;
+	conv_cfg.cal_cfg.conv_horizontal_stride = 1;
+	conv_cfg.cal_cfg.conv_vertical_stride = 1;
+	conv_cfg.fmap_cfg.external_padding_bottom = 1;
+	conv_cfg.fmap_cfg.external_padding_left = 1;
+	conv_cfg.fmap_cfg.external_padding_right = 1;
+	conv_cfg.fmap_cfg.external_padding_top = 1;
+	conv_cfg.fmap_cfg.ifmap_width = ifmap_w;
+	conv_cfg.fmap_cfg.ifmap_height = ifmap_h;
+	conv_cfg.fmap_cfg.ifmap_chn_n = chn_n;
+	conv_cfg.fmap_cfg.ofmap_data_type = CONV_O_2_BYTE;
+	conv_cfg.kernal_cfg.kernal_chn_n = chn_n;
+	conv_cfg.kernal_cfg.kernal_n = kernal_n;
+	conv_cfg.kernal_cfg.kernal_shape = CONV_KRN_3x3;
+	conv_cfg.bn_act_cfg.use_bn_unit = 1;
+	conv_cfg.bn_act_cfg.act_func_type = ACT_FUNC_NONE;
+	conv_cfg.bn_act_cfg.leaky_relu_param_alpha = 0.01f;
+
+	// 规划缓存划分并配置卷积层
+	if(axi_generic_conv_plan_buffer(prop, &conv_cfg, &buf_plan)){
+		printf("plan buffer failed\n");
+
+		return -1;
+	}
+
+	if(axi_generic_conv_enable(&axi_generic_conv) || axi_generic_conv_cfg(&axi_generic_conv, &conv_cfg)){
+		printf("conv cfg failed\n");
+
+		return -1;
+	}
+
+	axi_generic_conv_wr_bn_param_mem(&axi_generic_conv, bn_params, kernal_n);
+
+	if(axi_generic_conv_set_done_threshold(&axi_generic_conv, ofmap_h * (kernal_n / prop->atomic_k))){
+		return -1;
+	}
+
+	axi_generic_conv_set_wait_hook(&axi_generic_conv, wait_done_hook, NULL);
+
+	PandaSimSts sts_start;
+	PandaSimSts sts_end;
+	double wall_start = get_wall_time();
+
+	panda_sim_get_sts(&sts_start);
+
+	// 启动并等待完成
+	if(axi_generic_conv_enable_cal_sub_sys(&axi_generic_conv) ||
+		axi_generic_conv_enable_bn_act_proc(&axi_generic_conv) ||
+		axi_generic_conv_enable_pm_cnt(&axi_generic_conv) ||
+		axi_generic_conv_start(&axi_generic_conv) ||
+		axi_generic_conv_wait_done(&axi_generic_conv)){
+		printf("conv run failed\n");
+
+		return -1;
+	}
+
+	panda_sim_get_sts(&sts_end);
+
+	double wall_time = get_wall_time() - wall_start;
+	AxiGnrConvPerfMonsts pm_sts;
+
+	axi_generic_conv_get_pm_cnt(&axi_generic_conv, &pm_sts);
+
+	axi_generic_conv_disable_cal_sub_sys(&axi_generic_conv);
+	axi_generic_conv_disable_bn_act_proc(&axi_generic_conv);
+	axi_generic_conv_disable_pm_cnt(&axi_generic_conv);
+	axi_generic_conv_clr_cmd_fns_n(&axi_generic_conv, CONV_C_ALL);
+	axi_generic_conv_clr_pm_cnt(&axi_generic_conv);
+
+	// 运行参考模型并比较
+	conv_cfg.ofmap_baseaddr = ref_out_fmap;
+
+	if(axi_generic_conv_ref_run(prop, &conv_cfg, bn_params, NULL, 1)){
+		printf("reference model failed\n");
+
+		return -1;
+	}
+
+	uint32_t mismatch_n = 0;
+
+	for(uint32_t i = 0;i < out_fmap_len;i += 2){
+		if(out_fmap[i] != ref_out_fmap[i] || out_fmap[i + 1] != ref_out_fmap[i + 1]){
+			if(mismatch_n < 8){
+				printf("mismatch @%u: dut = 0x%02x%02x, ref = 0x%02x%02x\n", i / 2,
+					out_fmap[i + 1], out_fmap[i], ref_out_fmap[i + 1], ref_out_fmap[i]);
+			}
+
+			mismatch_n++;
+		}
+	}
+
+	uint64_t cycle_n = sts_end.cycle_n - sts_start.cycle_n;
+
+	printf("conv %ux%ux%u -> %ux%ux%u (3x3): %s (%u mismatches)\n",
+		(unsigned)ifmap_w, (unsigned)ifmap_h, (unsigned)chn_n,
+		(unsigned)ofmap_w, (unsigned)ofmap_h, (unsigned)kernal_n,
+		mismatch_n ? "FAIL":"PASS", mismatch_n);
+	printf("sim cycles = %llu, pm cycle_n = %llu, mm2s0 = %llu B, mm2s1 = %llu B, s2mm = %llu B\n",
+		(unsigned long long)cycle_n, (unsigned long long)pm_sts.cycle_n,
+		(unsigned long long)(sts_end.mm2s_byte_n[0] - sts_start.mm2s_byte_n[0]),
+		(unsigned long long)(sts_end.mm2s_byte_n[1] - sts_start.mm2s_byte_n[1]),
+		(unsigned long long)(sts_end.s2mm_byte_n - sts_start.s2mm_byte_n));
+	printf("wall time = %.3f s (%.1f kcycles/s), reg rd/wr = %llu/%llu\n",
+		wall_time, (wall_time > 0.0) ? ((double)cycle_n / wall_time / 1000.0):0.0,
+		(unsigned long long)(sts_end.reg_rd_n - sts_start.reg_rd_n),
+		(unsigned long long)(sts_end.reg_wr_n - sts_start.reg_wr_n));
+
+	return mismatch_n ? -1:0;
+}
+
+// 生成绝对值位于[2^-4, 2)的随机FP16数
+static uint16_t gen_rand_fp16(void){
+	uint16_t sign = (uint16_t)(rand() & 1);
+	uint16_t exp = (uint16_t)(11 + rand() % 5);
+	uint16_t mant = (uint16_t)(rand() & 0x3FF);
+
+	return (uint16_t)((sign << 15) | (exp << 10) | mant);
+}
+
+// 等待完成时推进仿真时间, 避免只靠轮询状态寄存器推进
+static void wait_done_hook(void* arg){
+	(void)arg;
+
+	panda_sim_run(WAIT_HOOK_CYCLE_N);
+}
+
+static double get_wall_time(void){
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
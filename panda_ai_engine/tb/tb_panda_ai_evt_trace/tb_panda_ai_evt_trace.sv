@@ -0,0 +1,382 @@
+`timescale 1ns / 1ps
+
+module tb_panda_ai_evt_trace();
+	
+	/** 配置参数 **/
+	// 待测模块配置
+	localparam integer EVT_FIFO_DEPTH = 64; // 事件缓存深度
+	localparam integer BURST_EVT_N = 8; // 每次写入的最大事件数
+	// 环形缓存区配置
+	localparam integer RING_BASEADDR = 32'h0000_0100; // 环形缓存区基地址
+	localparam integer RING_LEN = 8 * 40; // 环形缓存区大小
+	// 激励配置
+	localparam integer LAYER_N = 3; // 层数
+	localparam integer KERNAL_SET_N = 2; // 每层的核组数
+	localparam integer ROW_N = 4; // 每个核组的特征图表面行数/最终结果行数
+	// 时钟和复位配置
+	localparam real clk_p = 10.0; // 时钟周期
+	localparam real simulation_delay = 1.0; // 仿真延时
+	
+	/** 时钟和复位 **/
+	reg clk;
+	reg rst_n;
+	
+	initial
+	begin
+		clk <= 1'b1;
+	
+		forever
+		begin
+			# (clk_p / 2) clk <= ~clk;
+		end
+	end
+	
+	initial begin
+		rst_n <= 1'b0;
+	
+		# (clk_p * 10 + simulation_delay);
+	
+		rst_n <= 1'b1;
+	end
+	
+	/** 存储器模型 **/
+	reg[63:0] ddr[0:255]; // DDR(按8字节寻址)
+	
+	/** 待测模块 **/
+	// 寄存器配置接口(AXI-Lite从机)
+	reg[31:0] s_axi_lite_araddr;
+	reg s_axi_lite_arvalid;
+	wire s_axi_lite_arready;
+	reg[31:0] s_axi_lite_awaddr;
+	reg s_axi_lite_awvalid;
+	wire s_axi_lite_awready;
+	wire[1:0] s_axi_lite_bresp;
+	wire s_axi_lite_bvalid;
+	reg s_axi_lite_bready;
+	wire[31:0] s_axi_lite_rdata;
+	wire[1:0] s_axi_lite_rresp;
+	wire s_axi_lite_rvalid;
+	reg s_axi_lite_rready;
+	reg[31:0] s_axi_lite_wdata;
+	reg s_axi_lite_wvalid;
+	wire s_axi_lite_wready;
+	// 事件(指示)
+	reg on_conv_start;
+	reg on_s2mm_issue_fns;
+	reg on_kernal_set_start;
+	reg on_fmap_row_load;
+	reg on_fmap_row_load_done;
+	reg on_fmap_row_rplc;
+	reg on_fnl_res_row_wr;
+	reg on_fnl_res_row_wr_done;
+	// 事件跟踪DMA(S2MM方向)命令流(AXIS主机)
+	wire[55:0] m_trace_dma_cmd_axis_data;
+	wire m_trace_dma_cmd_axis_user;
+	wire m_trace_dma_cmd_axis_valid;
+	reg m_trace_dma_cmd_axis_ready;
+	// 事件数据流(AXIS主机)
+	wire[63:0] m_axis_trace_data;
+	wire[7:0] m_axis_trace_keep;
+	wire m_axis_trace_last;
+	wire m_axis_trace_valid;
+	reg m_axis_trace_ready;
+	// 事件跟踪DMA(S2MM方向)命令完成(指示)
+	reg trace_s2mm_cmd_done;
+	
+	panda_ai_evt_trace #(
+		.EVT_FIFO_DEPTH(EVT_FIFO_DEPTH),
+		.BURST_EVT_N(BURST_EVT_N),
+		.SIM_DELAY(simulation_delay)
+	)dut(
+		.aclk(clk),
+		.aresetn(rst_n),
+	
+		.s_axi_lite_araddr(s_axi_lite_araddr),
+		.s_axi_lite_arvalid(s_axi_lite_arvalid),
+		.s_axi_lite_arready(s_axi_lite_arready),
+		.s_axi_lite_awaddr(s_axi_lite_awaddr),
+		.s_axi_lite_awvalid(s_axi_lite_awvalid),
+		.s_axi_lite_awready(s_axi_lite_awready),
+		.s_axi_lite_bresp(s_axi_lite_bresp),
+		.s_axi_lite_bvalid(s_axi_lite_bvalid),
+		.s_axi_lite_bready(s_axi_lite_bready),
+		.s_axi_lite_rdata(s_axi_lite_rdata),
+		.s_axi_lite_rresp(s_axi_lite_rresp),
+		.s_axi_lite_rvalid(s_axi_lite_rvalid),
+		.s_axi_lite_rready(s_axi_lite_rready),
+		.s_axi_lite_wdata(s_axi_lite_wdata),
+		.s_axi_lite_wvalid(s_axi_lite_wvalid),
+		.s_axi_lite_wready(s_axi_lite_wready),
+	
+		.on_conv_start(on_conv_start),
+		.on_pool_start(1'b0),
+		.on_elm_start(1'b0),
+		.on_s2mm_issue_fns(on_s2mm_issue_fns),
+		.on_kernal_set_start(on_kernal_set_start),
+		.on_fmap_row_load(on_fmap_row_load),
+		.on_fmap_row_load_done(on_fmap_row_load_done),
+		.on_fmap_row_rplc(on_fmap_row_rplc),
+		.on_kernal_cgrp_load(1'b0),
+		.on_kernal_cgrp_load_done(1'b0),
+		.on_fnl_res_row_wr(on_fnl_res_row_wr),
+		.on_fnl_res_row_wr_done(on_fnl_res_row_wr_done),
+	
+		.m_trace_dma_cmd_axis_data(m_trace_dma_cmd_axis_data),
+		.m_trace_dma_cmd_axis_user(m_trace_dma_cmd_axis_user),
+		.m_trace_dma_cmd_axis_valid(m_trace_dma_cmd_axis_valid),
+		.m_trace_dma_cmd_axis_ready(m_trace_dma_cmd_axis_ready),
+	
+		.m_axis_trace_data(m_axis_trace_data),
+		.m_axis_trace_keep(m_axis_trace_keep),
+		.m_axis_trace_last(m_axis_trace_last),
+		.m_axis_trace_valid(m_axis_trace_valid),
+		.m_axis_trace_ready(m_axis_trace_ready),
+	
+		.trace_s2mm_cmd_done(trace_s2mm_cmd_done)
+	);
+	
+	/** AXI-Lite主机 **/
+	task automatic axi_lite_wr(input int addr, input int data);
+		s_axi_lite_awaddr <= # simulation_delay addr;
+		s_axi_lite_awvalid <= # simulation_delay 1'b1;
+		s_axi_lite_wdata <= # simulation_delay data;
+		s_axi_lite_wvalid <= # simulation_delay 1'b1;
+	
+		@(posedge clk iff s_axi_lite_awready);
+	
+		s_axi_lite_awvalid <= # simulation_delay 1'b0;
+	
+		@(posedge clk iff s_axi_lite_wready);
+	
+		s_axi_lite_wvalid <= # simulation_delay 1'b0;
+	
+		@(posedge clk iff s_axi_lite_bvalid);
+	endtask
+	
+	task automatic axi_lite_rd(input int addr, output int data);
+		s_axi_lite_araddr <= # simulation_delay addr;
+		s_axi_lite_arvalid <= # simulation_delay 1'b1;
+	
+		@(posedge clk iff s_axi_lite_arready);
+	
+		s_axi_lite_arvalid <= # simulation_delay 1'b0;
+	
+		@(posedge clk iff s_axi_lite_rvalid);
+	
+		data = s_axi_lite_rdata;
+	endtask
+	
+	/** 事件激励 **/
+	task automatic pulse(ref reg sig);
+		sig <= # simulation_delay 1'b1;
+	
+		@(posedge clk iff rst_n);
+	
+		sig <= # simulation_delay 1'b0;
+	endtask
+	
+	int drop_n; // 丢弃的事件数
+	int wptr; // 写指针
+	int lap_n; // 回绕次数
+	reg stim_done; // 激励完成(标志)
+	
+	initial
+	begin
+		automatic int rdata;
+	
+		s_axi_lite_araddr <= 32'd0;
+		s_axi_lite_arvalid <= 1'b0;
+		s_axi_lite_awaddr <= 32'd0;
+		s_axi_lite_awvalid <= 1'b0;
+		s_axi_lite_bready <= 1'b1;
+		s_axi_lite_rready <= 1'b1;
+		s_axi_lite_wdata <= 32'd0;
+		s_axi_lite_wvalid <= 1'b0;
+	
+		on_conv_start <= 1'b0;
+		on_s2mm_issue_fns <= 1'b0;
+		on_kernal_set_start <= 1'b0;
+		on_fmap_row_load <= 1'b0;
+		on_fmap_row_load_done <= 1'b0;
+		on_fmap_row_rplc <= 1'b0;
+		on_fnl_res_row_wr <= 1'b0;
+		on_fnl_res_row_wr_done <= 1'b0;
+	
+		stim_done <= 1'b0;
+	
+		repeat(10)
+		begin
+			@(posedge clk iff rst_n);
+		end
+	
+		// 配置环形缓存区并使能事件记录
+		axi_lite_wr(32'h18, RING_BASEADDR);
+		axi_lite_wr(32'h1C, RING_LEN);
+		axi_lite_wr(32'h10, 32'h0000_0001);
+	
+		for(int l = 0;l < LAYER_N;l++)
+		begin
+			pulse(on_conv_start);
+	
+			for(int k = 0;k < KERNAL_SET_N;k++)
+			begin
+				pulse(on_kernal_set_start);
+	
+				for(int r = 0;r < ROW_N;r++)
+				begin
+					pulse(on_fmap_row_load);
+	
+					repeat($urandom_range(2, 6))
+					begin
+						@(posedge clk iff rst_n);
+					end
+	
+					pulse(on_fmap_row_load_done);
+	
+					if(r != 0)
+						pulse(on_fmap_row_rplc);
+	
+					pulse(on_fnl_res_row_wr);
+	
+					repeat($urandom_range(1, 4))
+					begin
+						@(posedge clk iff rst_n);
+					end
+	
+					pulse(on_fnl_res_row_wr_done);
+				end
+			end
+	
+			pulse(on_s2mm_issue_fns);
+	
+			repeat(5)
+			begin
+				@(posedge clk iff rst_n);
+			end
+		end
+	
+		// 冲刷事件缓存
+		axi_lite_wr(32'h10, 32'h0000_0003);
+	
+		do
+		begin
+			axi_lite_rd(32'h10, rdata);
+		end
+		while(rdata & 32'h0000_0002);
+	
+		axi_lite_rd(32'h20, wptr);
+		axi_lite_rd(32'h24, lap_n);
+		axi_lite_rd(32'h28, drop_n);
+	
+		stim_done <= 1'b1;
+	end
+	
+	/** DMA(S2MM通道)模型 **/
+	initial
+	begin
+		m_trace_dma_cmd_axis_ready <= 1'b0;
+		m_axis_trace_ready <= 1'b0;
+		trace_s2mm_cmd_done <= 1'b0;
+	
+		forever
+		begin
+			automatic int baseaddr;
+			automatic int btt;
+	
+			m_trace_dma_cmd_axis_ready <= # simulation_delay 1'b1;
+	
+			@(posedge clk iff (rst_n & m_trace_dma_cmd_axis_valid & m_trace_dma_cmd_axis_ready));
+	
+			m_trace_dma_cmd_axis_ready <= # simulation_delay 1'b0;
+	
+			baseaddr = m_trace_dma_cmd_axis_data[31:0];
+			btt = m_trace_dma_cmd_axis_data[55:32];
+	
+			if((baseaddr < RING_BASEADDR) || ((baseaddr + btt) > (RING_BASEADDR + RING_LEN)))
+				$error("事件跟踪DMA命令越界: addr = %08x, btt = %0d", baseaddr, btt);
+	
+			for(int i = 0;i < btt / 8;i++)
+			begin
+				// 模拟DMA数据流的反压
+				m_axis_trace_ready <= # simulation_delay ($urandom_range(0, 3) != 0);
+	
+				@(posedge clk iff (rst_n & m_axis_trace_valid & m_axis_trace_ready));
+	
+				ddr[baseaddr / 8 + i] = m_axis_trace_data;
+	
+				if(m_axis_trace_last != (i == (btt / 8 - 1)))
+					$error("事件数据流的last信号错误");
+			end
+	
+			m_axis_trace_ready <= # simulation_delay 1'b0;
+	
+			repeat($urandom_range(2, 8))
+			begin
+				@(posedge clk iff rst_n);
+			end
+	
+			pulse(trace_s2mm_cmd_done);
+		end
+	end
+	
+	/** 事件缓存写入监测 **/
+	reg[63:0] evt_q[$]; // 写入事件缓存的事件
+	
+	always @(posedge clk)
+	begin
+		if(rst_n & dut.evt_fifo_wen)
+			evt_q.push_back(dut.evt_fifo_din);
+	end
+	
+	/** 检查 **/
+	initial
+	begin
+		automatic int err_n = 0;
+		automatic int evt_total = 0;
+		automatic int ring_evt_n = RING_LEN / 8;
+		automatic int layer_start_n = 0;
+		automatic int layer_end_n = 0;
+	
+		@(posedge clk iff stim_done);
+	
+		evt_total = lap_n * ring_evt_n + wptr / 8;
+	
+		if(evt_total != evt_q.size())
+		begin
+			$error("写出的事件数不一致: %0d != %0d", evt_total, evt_q.size());
+			err_n++;
+		end
+	
+		// 环形缓存区中保留最后ring_evt_n个事件
+		for(int i = (evt_total > ring_evt_n) ? (evt_total - ring_evt_n):0;i < evt_total;i++)
+		begin
+			if(ddr[RING_BASEADDR / 8 + (i % ring_evt_n)] != evt_q[i])
+			begin
+				$error("事件#%0d不一致: %016x != %016x", i, ddr[RING_BASEADDR / 8 + (i % ring_evt_n)], evt_q[i]);
+				err_n++;
+			end
+		end
+	
+		for(int i = 0;i < evt_q.size();i++)
+		begin
+			if(evt_q[i][63:60] == 4'd1)
+				layer_start_n++;
+			if(evt_q[i][63:60] == 4'd0)
+				layer_end_n++;
+		end
+	
+		if((drop_n == 0) && ((layer_start_n != LAYER_N) || (layer_end_n != LAYER_N)))
+		begin
+			$error("层开始/结束事件数错误: %0d/%0d", layer_start_n, layer_end_n);
+			err_n++;
+		end
+	
+		$display("共%0d个事件, 丢弃%0d个事件, 回绕%0d次", evt_total, drop_n, lap_n);
+	
+		if(err_n == 0)
+			$display("检查通过");
+	
+		$stop();
+	end
+	
+endmodule